@@ -83,7 +83,7 @@ def joinResults( results, baselineResults ):
         item += joined[ key ]
         joinedList.append( item )
     
-    return sorted( joinedList, lambda x, y: cmp( x, y ) )
+    return sorted( joinedList )
 
 
 def getValue( x ):
@@ -131,16 +131,39 @@ def printTable( table ):
     print( "|" + "|".join( "-" * width + "--" for width in col_width ) + "|" )
 
 
-def generateTable( results, baselineResults ):
+def colorSpeedUp( speedUp, threshold ):
+    """
+    Return the formatted speed up, colored in red if it is a regression beyond the threshold
+    and in green if it is an improvement beyond the threshold.
+
+    Arguments:
+        speedUp: The speed up over the baseline.
+        threshold: The relative change in time above which a result is flagged.
+    """
+    text = "{:.2f}x".format( speedUp )
+    if speedUp < 1.0 / ( 1.0 + threshold ):
+        return ( text, style.RED )
+    elif speedUp > 1.0 + threshold:
+        return ( text, style.GREEN )
+    else:
+        return text
+
+
+def generateTable( results, baselineResults, threshold ):
     """
     Print a table containing the speed up of the results over the baseline results.
-    
+
     Arguments:
         results: The dictionary of benchmark results.
         baselineResults: The dictionary of baseline benchmark results.
+        threshold: The relative increase of the run time above which a result is flagged as a regression.
+
+    Returns:
+        The number of regressions, excluding the benchmarks missing from either set of results.
     """
     lines = [ ( "XML Name", "Problem Name", "init speed up", "run speed up" ) ]
-    
+    numRegressions = 0
+
     joined = joinResults( results, baselineResults )
     for result in joined:
         xmlName = result[ 0 ]
@@ -150,9 +173,61 @@ def generateTable( results, baselineResults ):
         baseInitTime = result[ 4 ]
         baseRunTime = result[ 5 ]
 
+        runSpeedUp = baseRunTime / runTime
+        if runSpeedUp < 1.0 / ( 1.0 + threshold ):
+            numRegressions += 1
+
         lines.append( ( xmlName, problemName,
-                        "{:.2f}x".format( baseInitTime / initTime ),
-                        "{:.2f}x".format( baseRunTime / runTime ) ) )
+                        colorSpeedUp( baseInitTime / initTime, threshold ),
+                        colorSpeedUp( runSpeedUp, threshold ) ) )
+
+    printTable( lines )
+    return numRegressions
+
+
+problemNameRegex = r"(.*)_(\d+)$"
+meshSizeRegex = r"(.*)_(\d+)M_elem$"
+
+
+def generateScalingTable( results, weak ):
+    """
+    Print the parallel efficiency of the runs of each benchmark, relative to its run on the fewest nodes.
+
+    The runs of a strong scaling series share the XML and benchmark names. The runs of a weak scaling series
+    use the XML files generated by runBenchmarks.py for each scale (suffixed with the number of millions of
+    elements), and share the number of elements per node.
+
+    Arguments:
+        results: The dictionary of benchmark results.
+        weak: True for weak scaling, False for strong scaling.
+    """
+    series = {}
+    for ( xmlName, problemName ), ( _, runTime ) in results.items():
+        matches = re.search( problemNameRegex, problemName )
+        if matches is None:
+            continue
+        name, nodes = matches.groups()[ 0 ], int( matches.groups()[ 1 ] )
+
+        key = ( xmlName, name )
+        if weak:
+            meshMatches = re.search( meshSizeRegex, xmlName )
+            if meshMatches is None:
+                continue
+            elementsPerNode = round( float( meshMatches.groups()[ 1 ] ) / nodes, 3 )
+            key = ( meshMatches.groups()[ 0 ], name, elementsPerNode )
+
+        series.setdefault( key, [] ).append( ( nodes, runTime, xmlName ) )
+
+    lines = [ ( "XML Name", "Problem Name", "nodes", "run time", "efficiency" ) ]
+    for key in sorted( series ):
+        runs = sorted( series[ key ] )
+        refNodes, refTime = runs[ 0 ][ 0 ], runs[ 0 ][ 1 ]
+        for nodes, runTime, xmlName in runs:
+            if weak:
+                efficiency = refTime / runTime
+            else:
+                efficiency = ( refTime * refNodes ) / ( runTime * nodes )
+            lines.append( ( xmlName, key[ 1 ], str( nodes ), "{:.3f}s".format( runTime ), "{:.1f}%".format( 100 * efficiency ) ) )
 
     printTable( lines )
 
@@ -163,6 +238,10 @@ def main():
     parser = argparse.ArgumentParser()
     parser.add_argument( "toCompareDir", help="The directory where the new benchmarks were run." )
     parser.add_argument( "baselineDir", help="The directory where the baseline benchmarks were run." )
+    parser.add_argument( "--threshold", type=float, default=0.05,
+                         help="Relative increase of the run time above which a benchmark is flagged as a regression, the default is 0.05." )
+    parser.add_argument( "--scaling", choices=[ "weak", "strong" ],
+                         help="Also print the parallel efficiency of the scaling series of the new benchmarks." )
     args = parser.parse_args()
 
     toCompareDir = os.path.abspath( args.toCompareDir )
@@ -176,8 +255,15 @@ def main():
     results = getTimesFromFolder( toCompareDir )
     baselineResults = getTimesFromFolder( baselineDir )
 
-    generateTable( results, baselineResults )
-    return 0
+    numRegressions = generateTable( results, baselineResults, args.threshold )
+
+    if args.scaling is not None:
+        print( "" )
+        generateScalingTable( results, args.scaling == "weak" )
+
+    if numRegressions > 0:
+        print( "{}{} benchmark(s) are slower than the baseline by more than {:.0f}%.{}".format( style.RED, numRegressions, 100 * args.threshold, style.RESET ) )
+    return 1 if numRegressions > 0 else 0
 
 
 if __name__ == "__main__" and not sys.flags.interactive:
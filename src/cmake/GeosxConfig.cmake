@@ -1,8 +1,10 @@
 set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
+                          ASCENT
                           CALIPER
                           CHAI
                           CUDA
                           CUDA_NVTOOLSEXT
+                          DEVICE_TIMERS
                           HIP
 			  FMT_CONST_FORMATTER_WORKAROUND
                           FORTRAN_MANGLE_NO_UNDERSCORE
@@ -12,6 +14,7 @@ set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
                           METIS
                           MKL
                           MPI
+                          PAPI
                           PARMETIS
                           PETSC
                           PVTPackage
@@ -78,6 +81,8 @@ function( make_full_config_file
     set( GEOSX_LA_INTERFACE_HYPRE ON )
     set( GEOSX_LA_INTERFACE_TRILINOS OFF )
     set( GEOSX_LA_INTERFACE_PETSC OFF )
+    set( GEOS_COMPOSITIONAL_NUM_COMPONENTS_MASK 62 )
+    set( GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS 5 )
 
     configure_file( ${CMAKE_SOURCE_DIR}/coreComponents/common/GeosxConfig.hpp.in
                     ${CMAKE_SOURCE_DIR}/docs/doxygen/GeosxConfig.hpp )
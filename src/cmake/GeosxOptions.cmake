@@ -9,6 +9,8 @@ option( GEOS_ENABLE_TESTS "" ON )
 
 option( ENABLE_CALIPER "" OFF )
 
+option( ENABLE_ASCENT "Enables Ascent in-situ visualization" OFF )
+
 option( ENABLE_MATHPRESSO "" ON )
 
 option( ENABLE_CHAI "Enables CHAI" ON )
@@ -79,6 +81,12 @@ option( ENABLE_CUDA "" OFF )
 
 option( ENABLE_HIP "" OFF )
 
+option( ENABLE_DEVICE_TIMERS "Enables device timing of the scopes marked with GEOS_MARK_SCOPE and GEOS_MARK_FUNCTION" OFF )
+
+if( ENABLE_DEVICE_TIMERS AND NOT ( ENABLE_CUDA OR ENABLE_HIP ) )
+  message( FATAL_ERROR "ENABLE_DEVICE_TIMERS requires ENABLE_CUDA or ENABLE_HIP" )
+endif()
+
 if( CMAKE_HOST_APPLE AND CMAKE_CXX_COMPILER_ID STREQUAL "Clang" )
   option( ENABLE_OPENMP "Enables OpenMP compiler support" OFF )
 else()
@@ -201,10 +209,29 @@ if( ENABLE_HIP )
   set( GEOSX_BLOCK_SIZE 64 )
 endif()
 
+# the compositional flow kernels are compiled for each listed number of components,
+# restricting the list to the counts used in practice keeps the compilation time bounded
+set( GEOS_COMPOSITIONAL_NUM_COMPONENTS "1;2;3;4;5" CACHE STRING "Numbers of fluid components (from 1 to 16) supported by the compositional flow kernels" )
+if( NOT GEOS_COMPOSITIONAL_NUM_COMPONENTS )
+    message( FATAL_ERROR "GEOS_COMPOSITIONAL_NUM_COMPONENTS must list at least one number of components" )
+endif()
+set( GEOS_COMPOSITIONAL_NUM_COMPONENTS_MASK 0 )
+set( GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS 0 )
+foreach( NC ${GEOS_COMPOSITIONAL_NUM_COMPONENTS} )
+    if( NC LESS 1 OR NC GREATER 16 )
+        message( FATAL_ERROR "GEOS_COMPOSITIONAL_NUM_COMPONENTS: ${NC} components is out of the supported range [1, 16]" )
+    endif()
+    math( EXPR GEOS_COMPOSITIONAL_NUM_COMPONENTS_MASK "${GEOS_COMPOSITIONAL_NUM_COMPONENTS_MASK} | (1 << ${NC})" )
+    if( NC GREATER GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS )
+        set( GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS ${NC} )
+    endif()
+endforeach()
+
 message( "localIndex is an alias for ${GEOSX_LOCALINDEX_TYPE}" )
 message( "globalIndex is an alias for ${GEOSX_GLOBALINDEX_TYPE}" )
 message( "GEOSX_LOCALINDEX_TYPE_FLAG = ${GEOSX_LOCALINDEX_TYPE_FLAG}" )
 message( "GEOSX_GLOBALINDEX_TYPE_FLAG = ${GEOSX_GLOBALINDEX_TYPE_FLAG}" )
+message( "GEOS_COMPOSITIONAL_NUM_COMPONENTS = ${GEOS_COMPOSITIONAL_NUM_COMPONENTS}" )
 
 
 message( "CMAKE_CXX_FLAGS = ${CMAKE_CXX_FLAGS}" )
@@ -402,6 +402,58 @@ else()
     message(STATUS "Not using Caliper.")
 endif()
 
+################################
+# PAPI
+################################
+if(DEFINED PAPI_DIR)
+    message(STATUS "PAPI_DIR = ${PAPI_DIR}")
+
+    find_and_register(NAME papi
+                      INCLUDE_DIRECTORIES ${PAPI_DIR}/include
+                      LIBRARY_DIRECTORIES ${PAPI_DIR}/lib
+                      HEADER papi.h
+                      LIBRARIES papi)
+
+    set(ENABLE_PAPI ON CACHE BOOL "")
+    set(thirdPartyLibs ${thirdPartyLibs} papi)
+else()
+    if(ENABLE_PAPI)
+        message(WARNING "ENABLE_PAPI is ON but PAPI_DIR isn't defined.")
+    endif()
+
+    set(ENABLE_PAPI OFF CACHE BOOL "" FORCE)
+    message(STATUS "Not using PAPI.")
+endif()
+
+################################
+# Ascent
+################################
+if(DEFINED ASCENT_DIR)
+    message(STATUS "ASCENT_DIR = ${ASCENT_DIR}")
+
+    find_package(Ascent REQUIRED
+                 PATHS ${ASCENT_DIR}/lib/cmake/ascent
+                 NO_DEFAULT_PATH)
+
+    message( " ----> Ascent_VERSION = ${ASCENT_VERSION}")
+
+    if(ENABLE_MPI)
+        set(ascent_target ascent::ascent_mpi)
+    else()
+        set(ascent_target ascent::ascent)
+    endif()
+
+    set(ENABLE_ASCENT ON CACHE BOOL "")
+    set(thirdPartyLibs ${thirdPartyLibs} ${ascent_target})
+else()
+    if(ENABLE_ASCENT)
+        message(WARNING "ENABLE_ASCENT is ON but ASCENT_DIR isn't defined.")
+    endif()
+
+    set(ENABLE_ASCENT OFF CACHE BOOL "" FORCE)
+    message(STATUS "Not using Ascent.")
+endif()
+
 ################################
 # MATHPRESSO
 ################################
@@ -715,6 +767,7 @@ if(DEFINED VTK_DIR)
     message( " ----> VTK_VERSION=${VTK_VERSION}")
 
     set( VTK_TARGETS
+         VTK::FiltersExtraction
          VTK::FiltersParallelDIY2
          VTK::IOLegacy
          VTK::IOParallelXML
@@ -67,6 +67,14 @@ constexpr bool is_range_like = HasMemberFunction_begin< T > && HasMemberFunction
 template< typename CLASS >
 static constexpr bool HasMemberFunction_move = LvArray::bufferManipulation::HasMemberFunction_move< CLASS >;
 
+/**
+ * @brief Defines a static constexpr bool HasMemberFunction_getPreviousSpace< @p CLASS >
+ *        that is true iff the method @p CLASS ::getPreviousSpace() exists and the return value is convertable to a
+ *        LvArray::MemorySpace.
+ * @tparam CLASS The type to test.
+ */
+HAS_MEMBER_FUNCTION( getPreviousSpace, LvArray::MemorySpace, );
+
 /**
  * @brief Defines a static constexpr bool HasMemberFunction_setName< @p CLASS >
  *        that is true iff the method @p CLASS ::setName( string ) exists.
@@ -17,6 +17,26 @@ bool getPreferPinned( )
   return prefer_pinned_buffer;
 }
 
+bool prefer_unified_buffer = false;
+
+void setPreferUnified( bool p )
+{
+  prefer_unified_buffer = p;
+}
+
+bool getPreferUnified( )
+{
+  return prefer_unified_buffer;
+}
+
+umpire::Allocator getPooledAllocator( umpire::resource::MemoryResourceType const resource )
+{
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+  umpire::Allocator allocator = rm.getAllocator( resource );
+  string const poolName = allocator.getName() + "_POOL";
+  return rm.isAllocator( poolName ) ? rm.getAllocator( poolName ) : allocator;
+}
+
 }
 
 #endif
@@ -25,6 +25,9 @@
 #include <umpire/ResourceManager.hpp>
 #include <umpire/TypedAllocator.hpp>
 
+#include <new>
+#include <utility>
+
 namespace geos
 {
 /**
@@ -41,6 +44,27 @@ void setPreferPinned( bool p );
  */
 bool getPreferPinned( );
 
+/**
+ * @brief Set whether BufferAllocators should allocate unified memory.
+ * @param p Whether or not BufferAllocators should be instantiated
+ *          with a preference for unified memory, taking precedence over pinned memory.
+ */
+void setPreferUnified( bool p );
+
+/**
+ * @brief Get whether BufferAllocators should allocate unified memory.
+ * @return Whether or not BufferAllocators should be instantiated
+ *         with a preference for unified memory.
+ */
+bool getPreferUnified( );
+
+/**
+ * @brief Get the allocator of a memory resource, or the pool built on top of it by setupMemoryPools() if any.
+ * @param resource The memory resource.
+ * @return The allocator to use for the buffers allocated in @p resource.
+ */
+umpire::Allocator getPooledAllocator( umpire::resource::MemoryResourceType const resource );
+
 /**
  * @brief Wrapper class for umpire allocator, only used to determine which umpire allocator to use based on
  * availability.
@@ -65,23 +89,59 @@ private:
   // An umpire allocator allocating the type for which this class is instantiated.
   umpire::TypedAllocator< value_type > m_alloc;
   bool m_prefer_pinned_l;
+  bool m_unified_l;
 public:
 
   /**
    * @brief Default behavior is to allocate host memory, if there is a pinned memory allocator
    *        provided by umpire for the target platform, and getPreferPinned returns true,
-   *        use that instead.
+   *        use that instead. If there is a unified memory allocator and getPreferUnified
+   *        returns true, that is used in priority.
    */
   BufferAllocator()
     : m_alloc( umpire::TypedAllocator< T >( umpire::ResourceManager::getInstance().getAllocator( umpire::resource::Host ) ) )
     , m_prefer_pinned_l( getPreferPinned( ) )
+    , m_unified_l( false )
   {
   #if defined(UMPIRE_ENABLE_PINNED)
     if( m_prefer_pinned_l )
     {
-      m_alloc = umpire::TypedAllocator< T >( umpire::ResourceManager::getInstance().getAllocator( umpire::resource::Pinned ) );
+      m_alloc = umpire::TypedAllocator< T >( getPooledAllocator( umpire::resource::Pinned ) );
     }
   #endif
+  #if defined(UMPIRE_ENABLE_UM)
+    if( getPreferUnified( ) )
+    {
+      m_alloc = umpire::TypedAllocator< T >( getPooledAllocator( umpire::resource::Unified ) );
+      m_unified_l = true;
+    }
+  #endif
+  }
+
+  /**
+   * @brief Value-initialize an element of the buffer.
+   * @param p The address of the element.
+   * @note Unified buffers are left uninitialized: zeroing them on the host would migrate
+   *       the pages to the host right before the device packing kernels write them.
+   */
+  template< typename U >
+  void construct( U * const p )
+  {
+    if( !m_unified_l )
+    {
+      ::new( static_cast< void * >( p ) ) U();
+    }
+  }
+
+  /**
+   * @brief Construct an element of the buffer from @p args.
+   * @param p The address of the element.
+   * @param args The constructor arguments.
+   */
+  template< typename U, typename ... ARGS >
+  void construct( U * const p, ARGS && ... args )
+  {
+    ::new( static_cast< void * >( p ) ) U( std::forward< ARGS >( args )... );
   }
 
   /**
@@ -0,0 +1,206 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file DeviceTimers.cpp
+ */
+
+#include "DeviceTimers.hpp"
+
+#include "common/GeosxConfig.hpp"
+#include "common/Logger.hpp"
+
+#if defined( GEOSX_USE_CALIPER )
+#include <caliper/cali.h>
+#endif
+
+#if defined( GEOS_USE_CUDA )
+#include <cuda_runtime.h>
+#elif defined( GEOS_USE_HIP )
+#include <hip/hip_runtime.h>
+#endif
+
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace geos
+{
+
+namespace deviceTimers
+{
+
+namespace
+{
+
+#if defined( GEOS_USE_CUDA )
+using EventType = cudaEvent_t;
+#define GEOS_DEVICE_EVENT_CALL( call ) GEOS_ERROR_IF( ( call ) != cudaSuccess, "Device timers: " #call " failed" )
+#define GEOS_DEVICE_EVENT( name ) cuda ## name
+#elif defined( GEOS_USE_HIP )
+using EventType = hipEvent_t;
+#define GEOS_DEVICE_EVENT_CALL( call ) GEOS_ERROR_IF( ( call ) != hipSuccess, "Device timers: " #call " failed" )
+#define GEOS_DEVICE_EVENT( name ) hip ## name
+#endif
+
+/// Accumulated statistics of a timed scope
+struct Record
+{
+  /// Number of executions of the scope
+  long long count = 0;
+  /// Device time (in s)
+  double time = 0.0;
+  /// Number of bytes moved
+  double bytes = 0.0;
+  /// Number of floating point operations
+  double flops = 0.0;
+};
+
+std::mutex recordsMutex;
+
+std::map< std::string, Record > & records()
+{
+  static std::map< std::string, Record > recordsByName;
+  return recordsByName;
+}
+
+thread_local DeviceScopeTimer * innermostTimer = nullptr;
+
+} // namespace
+
+DeviceScopeTimer::DeviceScopeTimer( std::string name ):
+  m_name( std::move( name ) ),
+  m_start( nullptr ),
+  m_stop( nullptr ),
+  m_parent( innermostTimer ),
+  m_bytes( 0.0 ),
+  m_flops( 0.0 )
+{
+  innermostTimer = this;
+#if defined( GEOS_USE_CUDA ) || defined( GEOS_USE_HIP )
+  EventType start;
+  EventType stop;
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventCreate )( &start ) );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventCreate )( &stop ) );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventRecord )( start, 0 ) );
+  m_start = static_cast< void * >( start );
+  m_stop = static_cast< void * >( stop );
+#endif
+}
+
+DeviceScopeTimer::~DeviceScopeTimer()
+{
+  innermostTimer = m_parent;
+
+  float elapsedMs = 0.0;
+#if defined( GEOS_USE_CUDA ) || defined( GEOS_USE_HIP )
+  EventType const start = static_cast< EventType >( m_start );
+  EventType const stop = static_cast< EventType >( m_stop );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventRecord )( stop, 0 ) );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventSynchronize )( stop ) );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventElapsedTime )( &elapsedMs, start, stop ) );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventDestroy )( start ) );
+  GEOS_DEVICE_EVENT_CALL( GEOS_DEVICE_EVENT( EventDestroy )( stop ) );
+#endif
+  double const elapsed = 1.0e-3 * elapsedMs;
+
+#if defined( GEOSX_USE_CALIPER )
+  // set while the Caliper region of the scope is still open, so that the values are attributed to it
+  static cali::Annotation deviceTimeAnnotation( "geos.device.time", CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE );
+  static cali::Annotation deviceBytesAnnotation( "geos.device.bytes", CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE );
+  static cali::Annotation deviceFlopsAnnotation( "geos.device.flops", CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE );
+  deviceTimeAnnotation.set( elapsed );
+  if( m_bytes > 0.0 )
+  {
+    deviceBytesAnnotation.set( m_bytes );
+  }
+  if( m_flops > 0.0 )
+  {
+    deviceFlopsAnnotation.set( m_flops );
+  }
+#endif
+
+  std::lock_guard< std::mutex > lock( recordsMutex );
+  Record & record = records()[m_name];
+  ++record.count;
+  record.time += elapsed;
+  record.bytes += m_bytes;
+  record.flops += m_flops;
+}
+
+void DeviceScopeTimer::addTraffic( double const bytes, double const flops )
+{
+  m_bytes += bytes;
+  m_flops += flops;
+}
+
+DeviceScopeTimer * DeviceScopeTimer::current()
+{
+  return innermostTimer;
+}
+
+void addTraffic( double const bytes, double const flops )
+{
+  DeviceScopeTimer * const timer = DeviceScopeTimer::current();
+  if( timer != nullptr )
+  {
+    timer->addTraffic( bytes, flops );
+  }
+}
+
+void printReport()
+{
+  std::lock_guard< std::mutex > lock( recordsMutex );
+  if( records().empty() )
+  {
+    return;
+  }
+
+  std::ostringstream oss;
+  oss << "Device time of the marked scopes (rank 0, inclusive):\n";
+  oss << std::left << std::setw( 60 ) << "scope" << std::right
+      << std::setw( 10 ) << "calls"
+      << std::setw( 14 ) << "time (s)"
+      << std::setw( 12 ) << "GB/s"
+      << std::setw( 12 ) << "GFLOP/s" << "\n";
+  for( auto const & [name, record] : records() )
+  {
+    oss << std::left << std::setw( 60 ) << name << std::right
+        << std::setw( 10 ) << record.count
+        << std::setw( 14 ) << std::setprecision( 6 ) << record.time;
+    if( record.time > 0.0 && record.bytes > 0.0 )
+    {
+      oss << std::setw( 12 ) << std::setprecision( 4 ) << 1.0e-9 * record.bytes / record.time;
+    }
+    else
+    {
+      oss << std::setw( 12 ) << "-";
+    }
+    if( record.time > 0.0 && record.flops > 0.0 )
+    {
+      oss << std::setw( 12 ) << std::setprecision( 4 ) << 1.0e-9 * record.flops / record.time;
+    }
+    else
+    {
+      oss << std::setw( 12 ) << "-";
+    }
+    oss << "\n";
+  }
+  GEOS_LOG_RANK_0( oss.str() );
+}
+
+} // namespace deviceTimers
+
+} // namespace geos
@@ -0,0 +1,108 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file DeviceTimers.hpp
+ *
+ * Device timing of the scopes marked with GEOS_MARK_SCOPE and GEOS_MARK_FUNCTION (CMake option ENABLE_DEVICE_TIMERS).
+ */
+
+#ifndef GEOS_COMMON_DEVICETIMERS_HPP_
+#define GEOS_COMMON_DEVICETIMERS_HPP_
+
+#include <string>
+
+namespace geos
+{
+
+/// Namespace containing the device timing of the marked scopes.
+namespace deviceTimers
+{
+
+/**
+ * @brief Timer recording device events at the beginning and at the end of a marked scope.
+ *
+ * The time elapsed on the device between the two events, i.e. the duration of the kernels launched in the scope,
+ * is accumulated in a per-name record together with the traffic annotated with addTraffic, and attached to the
+ * enclosing Caliper region when Caliper is enabled. The end of the scope waits for the completion of its kernels,
+ * so that the device timing mode changes the overlap between the host and the device and is meant for profiling.
+ */
+class DeviceScopeTimer
+{
+public:
+
+  /**
+   * @brief Constructor, records the start event.
+   * @param name the name of the scope
+   */
+  explicit DeviceScopeTimer( std::string name );
+
+  /**
+   * @brief Destructor, records the stop event and accumulates the device time of the scope.
+   */
+  ~DeviceScopeTimer();
+
+  DeviceScopeTimer( DeviceScopeTimer const & ) = delete;
+  DeviceScopeTimer & operator=( DeviceScopeTimer const & ) = delete;
+
+  /**
+   * @brief Add the traffic of a kernel launched in the scope.
+   * @param bytes the number of bytes moved to and from the device memory
+   * @param flops the number of floating point operations
+   */
+  void addTraffic( double const bytes, double const flops );
+
+  /**
+   * @brief @return the innermost timed scope of the calling thread, or nullptr if there is none
+   */
+  static DeviceScopeTimer * current();
+
+private:
+
+  /// Name of the scope
+  std::string m_name;
+
+  /// Start event (cudaEvent_t or hipEvent_t)
+  void * m_start;
+
+  /// Stop event (cudaEvent_t or hipEvent_t)
+  void * m_stop;
+
+  /// Enclosing timed scope
+  DeviceScopeTimer * m_parent;
+
+  /// Number of bytes annotated in the scope
+  double m_bytes;
+
+  /// Number of floating point operations annotated in the scope
+  double m_flops;
+};
+
+/**
+ * @brief Add the traffic of a kernel to the innermost timed scope (no-op outside of a timed scope).
+ * @param bytes the number of bytes moved to and from the device memory
+ * @param flops the number of floating point operations
+ */
+void addTraffic( double const bytes, double const flops );
+
+/**
+ * @brief Print the device time, the achieved bandwidth and the throughput of each timed scope on rank 0.
+ */
+void printReport();
+
+} // namespace deviceTimers
+
+} // namespace geos
+
+#endif // GEOS_COMMON_DEVICETIMERS_HPP_
@@ -229,6 +229,54 @@ RAJA_INLINE void forRange( INDEX const begin, INDEX const end, LAMBDA && body )
   RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX >( begin, end ), std::forward< LAMBDA >( body ) );
 }
 
+/**
+ * @class ConcurrentDeviceKernels
+ * @brief Launches independent device kernels on different streams, and waits for all of them at once.
+ *
+ * Each kernel is launched asynchronously on a stream taken from the pool of streams of the device resources,
+ * so that the kernels of small subregions overlap instead of leaving the device idle between launches.
+ * The kernels must not depend on each other, and must not use reductions. Host builds run the kernels in order.
+ */
+class ConcurrentDeviceKernels
+{
+public:
+
+  /// Wait for the kernels that are still running
+  ~ConcurrentDeviceKernels()
+  {
+    wait();
+  }
+
+  /**
+   * @brief Launch a kernel over a range.
+   * @tparam LAMBDA type of the kernel body
+   * @param[in] end the size of the range
+   * @param[in] body the kernel body
+   */
+  template< typename LAMBDA >
+  void forAll( localIndex const end, LAMBDA && body )
+  {
+    if( end > 0 )
+    {
+      m_events.emplace_back( geos::forAll< parallelDeviceAsyncPolicy<> >( parallelDeviceStream(), end, std::forward< LAMBDA >( body ) ) );
+    }
+  }
+
+  /**
+   * @brief Wait for all the kernels launched so far.
+   */
+  void wait()
+  {
+    waitAllDeviceEvents( m_events );
+    m_events.clear();
+  }
+
+private:
+
+  /// The events recorded after each launch
+  parallelDeviceEvents m_events;
+};
+
 } // namespace geos
 
 #endif // GEOS_RAJAINTERFACE_RAJAINTERFACE_HPP
@@ -0,0 +1,289 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file HardwareCounters.cpp
+ */
+
+#include "HardwareCounters.hpp"
+
+#include "common/GeosxConfig.hpp"
+#include "common/Logger.hpp"
+
+#if defined( GEOSX_USE_CALIPER )
+#include <caliper/cali.h>
+#endif
+
+#include <papi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+
+namespace geos
+{
+
+namespace hardwareCounters
+{
+
+namespace
+{
+
+#define GEOS_PAPI_CALL( call ) \
+  do \
+  { \
+    int const papiReturn = ( call ); \
+    GEOS_ERROR_IF( papiReturn != PAPI_OK, "Hardware counters: " #call " failed: " << PAPI_strerror( papiReturn ) ); \
+  } while( false )
+
+/// Accumulated statistics of a counted scope
+struct Record
+{
+  /// Number of executions of the scope
+  long long count = 0;
+  /// Wall time (in s)
+  double time = 0.0;
+  /// Accumulated value of each counter
+  std::vector< long long > values;
+};
+
+/// State of the counters, only accessed from the thread that initialized them
+struct State
+{
+  /// PAPI event set of the counters
+  int eventSet = PAPI_NULL;
+  /// Id of the thread on which the counters are read
+  std::thread::id threadId;
+  /// PAPI names of the counters
+  std::vector< std::string > names;
+  /// Accumulated statistics of each scope
+  std::map< std::string, Record > records;
+#if defined( GEOSX_USE_CALIPER )
+  /// Names of the Caliper attributes of the counters (stable addresses)
+  std::deque< std::string > attributeNames;
+  /// Caliper attributes of the counters
+  std::vector< cali::Annotation > annotations;
+#endif
+};
+
+State * state = nullptr;
+
+double wallTime()
+{
+  return std::chrono::duration< double >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+std::vector< std::string > expandCounterNames( std::string const & counterNames )
+{
+  std::vector< std::string > names;
+  std::istringstream iss( counterNames );
+  std::string name;
+  while( std::getline( iss, name, ',' ) )
+  {
+    if( name.empty() )
+    {
+      continue;
+    }
+    if( name == "cache" )
+    {
+      names.insert( names.end(), { "PAPI_L1_DCM", "PAPI_L2_DCM", "PAPI_L3_TCM" } );
+    }
+    else if( name == "vectorization" )
+    {
+      names.insert( names.end(), { "PAPI_TOT_INS", "PAPI_VEC_INS" } );
+    }
+    else
+    {
+      names.emplace_back( name );
+    }
+  }
+  return names;
+}
+
+/// @return the index of the counter @p name, or -1 if it is not counted
+int counterIndex( std::string const & name )
+{
+  auto const it = std::find( state->names.begin(), state->names.end(), name );
+  return it == state->names.end() ? -1 : static_cast< int >( it - state->names.begin() );
+}
+
+} // namespace
+
+void initialize( std::string const & counterNames )
+{
+  GEOS_ERROR_IF( state != nullptr, "Hardware counters: the counters are already initialized" );
+
+  std::vector< std::string > const names = expandCounterNames( counterNames );
+  GEOS_THROW_IF( names.empty(), "Hardware counters: no counter given in \"" << counterNames << "\"", InputError );
+
+  int const version = PAPI_library_init( PAPI_VER_CURRENT );
+  GEOS_ERROR_IF( version != PAPI_VER_CURRENT, "Hardware counters: PAPI_library_init failed: " << PAPI_strerror( version ) );
+
+  state = new State();
+  state->threadId = std::this_thread::get_id();
+  GEOS_PAPI_CALL( PAPI_create_eventset( &state->eventSet ) );
+
+  for( std::string const & name : names )
+  {
+    if( counterIndex( name ) >= 0 )
+    {
+      continue;
+    }
+    int code = 0;
+    GEOS_THROW_IF( PAPI_event_name_to_code( const_cast< char * >( name.c_str() ), &code ) != PAPI_OK,
+                   "Hardware counters: unknown counter " << name << " (see papi_avail)", InputError );
+    int const ret = PAPI_add_event( state->eventSet, code );
+    GEOS_THROW_IF( ret != PAPI_OK,
+                   "Hardware counters: counter " << name << " cannot be counted: " << PAPI_strerror( ret ), InputError );
+    state->names.emplace_back( name );
+#if defined( GEOSX_USE_CALIPER )
+    state->attributeNames.emplace_back( "geos.papi." + name );
+    state->annotations.emplace_back( state->attributeNames.back().c_str(), CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE );
+#endif
+  }
+
+  GEOS_PAPI_CALL( PAPI_start( state->eventSet ) );
+}
+
+void finalize()
+{
+  if( state == nullptr )
+  {
+    return;
+  }
+  std::vector< long long > values( state->names.size() );
+  GEOS_PAPI_CALL( PAPI_stop( state->eventSet, values.data() ) );
+  GEOS_PAPI_CALL( PAPI_cleanup_eventset( state->eventSet ) );
+  GEOS_PAPI_CALL( PAPI_destroy_eventset( &state->eventSet ) );
+  PAPI_shutdown();
+  delete state;
+  state = nullptr;
+}
+
+CounterScope::CounterScope( std::string name ):
+  m_name( std::move( name ) ),
+  m_active( state != nullptr && std::this_thread::get_id() == state->threadId ),
+  m_startTime( 0.0 ),
+  m_startValues()
+{
+  if( m_active )
+  {
+    m_startValues.resize( state->names.size() );
+    GEOS_PAPI_CALL( PAPI_read( state->eventSet, m_startValues.data() ) );
+    m_startTime = wallTime();
+  }
+}
+
+CounterScope::~CounterScope()
+{
+  if( !m_active || state == nullptr )
+  {
+    return;
+  }
+
+  double const elapsed = wallTime() - m_startTime;
+  std::vector< long long > values( state->names.size() );
+  GEOS_PAPI_CALL( PAPI_read( state->eventSet, values.data() ) );
+
+  Record & record = state->records[m_name];
+  record.values.resize( values.size(), 0 );
+  ++record.count;
+  record.time += elapsed;
+  for( std::size_t i = 0; i < values.size(); ++i )
+  {
+    long long const delta = values[i] - m_startValues[i];
+    record.values[i] += delta;
+#if defined( GEOSX_USE_CALIPER )
+    // set while the Caliper region of the scope is still open, so that the values are attributed to it
+    state->annotations[i].set( static_cast< double >( delta ) );
+#endif
+  }
+}
+
+void printReport()
+{
+  if( state == nullptr || state->records.empty() )
+  {
+    return;
+  }
+
+  // derived metrics, available when the counters they use are counted
+  int const l3Misses = counterIndex( "PAPI_L3_TCM" );
+  int const totalInstructions = counterIndex( "PAPI_TOT_INS" );
+  int const vectorInstructions = counterIndex( "PAPI_VEC_INS" );
+
+  std::ostringstream oss;
+  oss << "Hardware counters of the marked scopes (rank 0, main thread, inclusive):\n";
+  oss << std::left << std::setw( 60 ) << "scope" << std::right
+      << std::setw( 10 ) << "calls"
+      << std::setw( 14 ) << "time (s)";
+  for( std::string const & name : state->names )
+  {
+    oss << std::setw( 16 ) << name;
+  }
+  if( l3Misses >= 0 )
+  {
+    oss << std::setw( 16 ) << "DRAM GB/s (est)";
+  }
+  if( totalInstructions >= 0 && vectorInstructions >= 0 )
+  {
+    oss << std::setw( 12 ) << "vec. ratio";
+  }
+  oss << "\n";
+
+  for( auto const & [name, record] : state->records )
+  {
+    oss << std::left << std::setw( 60 ) << name << std::right
+        << std::setw( 10 ) << record.count
+        << std::setw( 14 ) << std::setprecision( 6 ) << record.time;
+    for( long long const value : record.values )
+    {
+      oss << std::setw( 16 ) << value;
+    }
+    if( l3Misses >= 0 )
+    {
+      // one cache line of 64 bytes loaded from memory per last level cache miss
+      if( record.time > 0.0 )
+      {
+        oss << std::setw( 16 ) << std::setprecision( 4 ) << 1.0e-9 * 64.0 * record.values[l3Misses] / record.time;
+      }
+      else
+      {
+        oss << std::setw( 16 ) << "-";
+      }
+    }
+    if( totalInstructions >= 0 && vectorInstructions >= 0 )
+    {
+      if( record.values[totalInstructions] > 0 )
+      {
+        oss << std::setw( 12 ) << std::setprecision( 4 )
+            << static_cast< double >( record.values[vectorInstructions] ) / record.values[totalInstructions];
+      }
+      else
+      {
+        oss << std::setw( 12 ) << "-";
+      }
+    }
+    oss << "\n";
+  }
+  GEOS_LOG_RANK_0( oss.str() );
+}
+
+} // namespace hardwareCounters
+
+} // namespace geos
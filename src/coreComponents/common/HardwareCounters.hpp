@@ -0,0 +1,98 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file HardwareCounters.hpp
+ *
+ * PAPI hardware performance counters of the scopes marked with GEOS_MARK_SCOPE and GEOS_MARK_FUNCTION
+ * (CMake option ENABLE_PAPI, command line option --hardware-counters).
+ */
+
+#ifndef GEOS_COMMON_HARDWARECOUNTERS_HPP_
+#define GEOS_COMMON_HARDWARECOUNTERS_HPP_
+
+#include <string>
+#include <vector>
+
+namespace geos
+{
+
+/// Namespace containing the hardware performance counters of the marked scopes.
+namespace hardwareCounters
+{
+
+/**
+ * @brief Start the hardware performance counters on the calling thread.
+ * @param counterNames comma-separated list of PAPI event names (e.g. "PAPI_L1_DCM,PAPI_TOT_INS"), in which
+ *        the presets "cache" (L1, L2 and L3 misses) and "vectorization" (total and vector instructions)
+ *        can also be used
+ *
+ * The scopes marked on other threads are not counted.
+ */
+void initialize( std::string const & counterNames );
+
+/**
+ * @brief Stop the hardware performance counters.
+ */
+void finalize();
+
+/**
+ * @brief Scope reading the hardware performance counters and the wall time at its beginning and at its end.
+ *
+ * The differences are accumulated in a per-name record and attached to the enclosing Caliper region when
+ * Caliper is enabled. The scope is a no-op when the counters have not been initialized, or on another thread.
+ */
+class CounterScope
+{
+public:
+
+  /**
+   * @brief Constructor, reads the counters at the beginning of the scope.
+   * @param name the name of the scope
+   */
+  explicit CounterScope( std::string name );
+
+  /**
+   * @brief Destructor, reads the counters at the end of the scope and accumulates the differences.
+   */
+  ~CounterScope();
+
+  CounterScope( CounterScope const & ) = delete;
+  CounterScope & operator=( CounterScope const & ) = delete;
+
+private:
+
+  /// Name of the scope
+  std::string m_name;
+
+  /// True if the counters are read by this scope
+  bool m_active;
+
+  /// Wall time at the beginning of the scope (in s)
+  double m_startTime;
+
+  /// Counter values at the beginning of the scope
+  std::vector< long long > m_startValues;
+};
+
+/**
+ * @brief Print the wall time, the counters and the derived metrics of each counted scope on rank 0.
+ */
+void printReport();
+
+} // namespace hardwareCounters
+
+} // namespace geos
+
+#endif // GEOS_COMMON_HARDWARECOUNTERS_HPP_
@@ -55,8 +55,11 @@ public:
    * @param numberOfBuffersToStoreOnHost   Maximum number of array to store on host memory . If negative opposite of the percent of left
    * memory we want to use( -80 = use 80% of remaining memory ).
    * @param maxNumberOfBuffers             Number of arrays expected to be stores in the LIFO.
+   * @param compressionTolerance           Compression of the buffers stored on disk (negative = no compression,
+   *                                       0 = lossless, positive = lossy with this absolute error bound).
    */
-  LifoStorage( std::string name, size_t elemCnt, int numberOfBuffersToStoreOnDevice, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers ):
+  LifoStorage( std::string name, size_t elemCnt, int numberOfBuffersToStoreOnDevice, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers,
+               double compressionTolerance = -1.0 ):
     m_maxNumberOfBuffers( maxNumberOfBuffers ),
     m_bufferSize( elemCnt*sizeof( T ) ),
     m_bufferCount( 0 )
@@ -82,12 +85,13 @@ public:
 #ifdef GEOS_USE_CUDA
     if( numberOfBuffersToStoreOnDevice > 0 )
     {
-      m_lifo = std::make_unique< LifoStorageCuda< T, INDEX_TYPE > >( name, elemCnt, numberOfBuffersToStoreOnDevice, numberOfBuffersToStoreOnHost, maxNumberOfBuffers );
+      m_lifo = std::make_unique< LifoStorageCuda< T, INDEX_TYPE > >( name, elemCnt, numberOfBuffersToStoreOnDevice, numberOfBuffersToStoreOnHost, maxNumberOfBuffers,
+                                                                 compressionTolerance );
     }
     else
 #endif
     {
-      m_lifo = std::make_unique< LifoStorageHost< T, INDEX_TYPE > >( name, elemCnt, numberOfBuffersToStoreOnHost, maxNumberOfBuffers );
+      m_lifo = std::make_unique< LifoStorageHost< T, INDEX_TYPE > >( name, elemCnt, numberOfBuffersToStoreOnHost, maxNumberOfBuffers, compressionTolerance );
     }
 
   }
@@ -100,9 +104,12 @@ public:
    * @param numberOfBuffersToStoreOnDevice Maximum number of array to store on device memory.
    * @param numberOfBuffersToStoreOnHost   Maximum number of array to store on host memory.
    * @param maxNumberOfBuffers             Number of arrays expected to be stores in the LIFO.
+   * @param compressionTolerance           Compression of the buffers stored on disk (negative = no compression,
+   *                                       0 = lossless, positive = lossy with this absolute error bound).
    */
-  LifoStorage( std::string name, arrayView1d< T > array, int numberOfBuffersToStoreOnDevice, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers ):
-    LifoStorage( name, array.size(), numberOfBuffersToStoreOnDevice, numberOfBuffersToStoreOnHost, maxNumberOfBuffers ) {}
+  LifoStorage( std::string name, arrayView1d< T > array, int numberOfBuffersToStoreOnDevice, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers,
+               double compressionTolerance = -1.0 ):
+    LifoStorage( name, array.size(), numberOfBuffersToStoreOnDevice, numberOfBuffersToStoreOnHost, maxNumberOfBuffers, compressionTolerance ) {}
 
   /**
    * Asynchroneously push a copy of the given LvArray into the LIFO
@@ -23,6 +23,10 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <vector>
 
 #ifdef LIFO_DISABLE_CALIPER
 #define LIFO_MARK_FUNCTION
@@ -59,16 +63,21 @@ public:
    * @param elemCnt                        Number of elments in the LvArray we want to store in the LIFO storage.
    * @param numberOfBuffersToStoreOnHost   Maximum number of array to store on host memory ( -1 = use 80% of remaining memory ).
    * @param maxNumberOfBuffers             Number of arrays expected to be stores in the LIFO.
+   * @param compressionTolerance           Compression of the buffers stored on disk (negative = no compression,
+   *                                       0 = lossless, positive = lossy with this absolute error bound).
    */
-  LifoStorageCommon( std::string name, size_t elemCnt, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers ):
+  LifoStorageCommon( std::string name, size_t elemCnt, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers, double compressionTolerance ):
     m_maxNumberOfBuffers( maxNumberOfBuffers ),
     m_bufferSize( elemCnt*sizeof( T ) ),
+    m_compressionTolerance( compressionTolerance ),
     m_name( name ),
     m_hostDeque( numberOfBuffersToStoreOnHost, elemCnt, LvArray::MemorySpace::host ),
     m_bufferCount( 0 ), m_bufferToHostCount( 0 ), m_bufferToDiskCount( 0 ),
     m_continue( true ),
     m_hasPoppedBefore( false )
   {
+    GEOS_ERROR_IF( m_compressionTolerance > 0 && !std::is_floating_point< T >::value,
+                   "Lossy compression of the LIFO storage is only available for floating point buffers" );
     m_worker[0] = std::thread( &LifoStorageCommon< T, INDEX_TYPE >::wait_and_consume_tasks, this, 0 );
     m_worker[1] = std::thread( &LifoStorageCommon< T, INDEX_TYPE >::wait_and_consume_tasks, this, 1 );
   }
@@ -173,6 +182,10 @@ protected:
   int m_maxNumberOfBuffers;
   /// size of one buffer in bytes
   size_t m_bufferSize;
+  /// compression of the buffers stored on disk (negative: none, 0: lossless, positive: lossy absolute error bound)
+  double m_compressionTolerance;
+  /// work buffer for compressed data, only used by the host/disk worker
+  std::vector< unsigned char > m_compressedBuffer;
   /// name used to store data on disk
   std::string m_name;
   /// Queue of data stored on host memory
@@ -261,7 +274,17 @@ protected:
     std::ofstream wf( fileName, std::ios::out | std::ios::binary );
     GEOS_ERROR_IF( !wf || wf.fail() || !wf.is_open(),
                    "Could not open file "<< fileName << " for writting" );
-    wf.write( (const char *)d, m_bufferSize );
+    if( m_compressionTolerance < 0 )
+    {
+      wf.write( (const char *)d, m_bufferSize );
+    }
+    else
+    {
+      compress( d );
+      size_t const compressedSize = m_compressedBuffer.size();
+      wf.write( (const char *)&compressedSize, sizeof( size_t ) );
+      wf.write( (const char *)m_compressedBuffer.data(), compressedSize );
+    }
     GEOS_ERROR_IF( wf.bad() || wf.fail(),
                    "An error occured while writting "<< fileName );
     wf.close();
@@ -280,11 +303,175 @@ protected:
     std::ifstream wf( fileName, std::ios::in | std::ios::binary );
     GEOS_ERROR_IF( !wf,
                    "Could not open file "<< fileName << " for reading" );
-    wf.read( (char *)d, m_bufferSize );
+    if( m_compressionTolerance < 0 )
+    {
+      wf.read( (char *)d, m_bufferSize );
+    }
+    else
+    {
+      size_t compressedSize = 0;
+      wf.read( (char *)&compressedSize, sizeof( size_t ) );
+      m_compressedBuffer.resize( compressedSize );
+      wf.read( (char *)m_compressedBuffer.data(), compressedSize );
+      decompress( d );
+    }
+    GEOS_ERROR_IF( wf.bad() || wf.fail(),
+                   "An error occured while reading "<< fileName );
     wf.close();
     remove( fileName.c_str() );
   }
 
+  /**
+   * Encode a buffer into m_compressedBuffer.
+   *
+   * Each value is mapped to an integer (its bit pattern in lossless mode, its quantization
+   * with a step of twice the tolerance in lossy mode), the differences between consecutive
+   * integers are stored as variable length integers and runs of zero differences are merged.
+   * Smooth or quiescent regions of the wavefield are thus stored with a few bytes.
+   *
+   * @param d Data to compress.
+   */
+  void compress( const T * d )
+  {
+    LIFO_MARK_FUNCTION;
+    size_t const elemCnt = m_bufferSize / sizeof( T );
+    m_compressedBuffer.clear();
+    m_compressedBuffer.reserve( m_bufferSize / 4 );
+
+    uint64_t previous = 0;
+    size_t zeroRun = 0;
+    for( size_t i = 0; i < elemCnt; ++i )
+    {
+      uint64_t const current = toInteger( d[i] );
+      // zigzag encoding of the signed difference
+      uint64_t const diff = current - previous;
+      uint64_t const code = ( diff << 1 ) ^ ( uint64_t )( -( int64_t )( diff >> 63 ) );
+      previous = current;
+      if( code == 0 )
+      {
+        ++zeroRun;
+        continue;
+      }
+      if( zeroRun > 0 )
+      {
+        writeVarint( 0 );
+        writeVarint( zeroRun - 1 );
+        zeroRun = 0;
+      }
+      writeVarint( code );
+    }
+    if( zeroRun > 0 )
+    {
+      writeVarint( 0 );
+      writeVarint( zeroRun - 1 );
+    }
+  }
+
+  /**
+   * Decode m_compressedBuffer into a buffer.
+   *
+   * @param d Buffer to store the decompressed data.
+   */
+  void decompress( T * d )
+  {
+    LIFO_MARK_FUNCTION;
+    size_t const elemCnt = m_bufferSize / sizeof( T );
+    size_t pos = 0;
+    uint64_t previous = 0;
+    size_t i = 0;
+    while( i < elemCnt )
+    {
+      uint64_t const code = readVarint( pos );
+      if( code == 0 )
+      {
+        size_t const zeroRun = readVarint( pos ) + 1;
+        GEOS_ERROR_IF( i + zeroRun > elemCnt, "LIFO : corrupted compressed buffer" );
+        for( size_t j = 0; j < zeroRun; ++j )
+        {
+          d[i++] = fromInteger( previous );
+        }
+      }
+      else
+      {
+        uint64_t const diff = ( code >> 1 ) ^ ( uint64_t )( -( int64_t )( code & 1 ) );
+        previous += diff;
+        d[i++] = fromInteger( previous );
+      }
+    }
+  }
+
+  /**
+   * Append a variable length integer to m_compressedBuffer.
+   *
+   * @param value The value to append.
+   */
+  void writeVarint( uint64_t value )
+  {
+    while( value >= 0x80 )
+    {
+      m_compressedBuffer.push_back( ( unsigned char )( value | 0x80 ) );
+      value >>= 7;
+    }
+    m_compressedBuffer.push_back( ( unsigned char ) value );
+  }
+
+  /**
+   * Read a variable length integer from m_compressedBuffer.
+   *
+   * @param pos Current position in m_compressedBuffer, advanced past the integer.
+   * @return The value read.
+   */
+  uint64_t readVarint( size_t & pos ) const
+  {
+    uint64_t value = 0;
+    int shift = 0;
+    unsigned char byte;
+    do
+    {
+      GEOS_ERROR_IF( pos >= m_compressedBuffer.size(), "LIFO : corrupted compressed buffer" );
+      byte = m_compressedBuffer[pos++];
+      value |= ( uint64_t )( byte & 0x7f ) << shift;
+      shift += 7;
+    } while( byte & 0x80 );
+    return value;
+  }
+
+  /**
+   * Map a value to the integer encoded by the compression.
+   *
+   * @param value The value to map.
+   * @return The bit pattern of the value if lossless, its quantization otherwise.
+   */
+  uint64_t toInteger( T const value ) const
+  {
+    if( m_compressionTolerance > 0 )
+    {
+      double const scaled = std::round( ( double ) value / ( 2.0 * m_compressionTolerance ) );
+      GEOS_ERROR_IF( !( std::abs( scaled ) < 4.0e18 ), "LIFO : value " << value << " cannot be quantized" );
+      return ( uint64_t )( int64_t ) scaled;
+    }
+    uint64_t bits = 0;
+    std::memcpy( &bits, &value, sizeof( T ) );
+    return bits;
+  }
+
+  /**
+   * Map an integer encoded by the compression back to a value.
+   *
+   * @param bits The integer to map.
+   * @return The corresponding value.
+   */
+  T fromInteger( uint64_t const bits ) const
+  {
+    if( m_compressionTolerance > 0 )
+    {
+      return ( T )( ( double )( int64_t ) bits * 2.0 * m_compressionTolerance );
+    }
+    T value;
+    std::memcpy( &value, &bits, sizeof( T ) );
+    return value;
+  }
+
 
 private:
   /**
@@ -49,9 +49,11 @@ public:
    * @param elemCnt                        Number of elments in the LvArray we want to store in the LIFO storage.
    * @param numberOfBuffersToStoreOnHost   Maximum number of array to store on host memory ( -1 = use 80% of remaining memory ).
    * @param maxNumberOfBuffers             Number of arrays expected to be stores in the LIFO.
+   * @param compressionTolerance           Compression of the buffers stored on disk (negative = no compression,
+   *                                       0 = lossless, positive = lossy with this absolute error bound).
    */
-  LifoStorageHost( std::string name, size_t elemCnt, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers ):
-    LifoStorageCommon< T, INDEX_TYPE >( name, elemCnt, numberOfBuffersToStoreOnHost, maxNumberOfBuffers ),
+  LifoStorageHost( std::string name, size_t elemCnt, int numberOfBuffersToStoreOnHost, int maxNumberOfBuffers, double compressionTolerance ):
+    LifoStorageCommon< T, INDEX_TYPE >( name, elemCnt, numberOfBuffersToStoreOnHost, maxNumberOfBuffers, compressionTolerance ),
     m_pushToHostFutures( maxNumberOfBuffers ),
     m_popFromHostFutures( maxNumberOfBuffers )
   {}
@@ -21,6 +21,9 @@
 #include "Path.hpp"
 #include "codingUtilities/StringUtilities.hpp"
 
+// System includes
+#include <vector>
+
 namespace geos
 {
 
@@ -75,6 +78,11 @@ int n_ranks = 1;
 
 std::ostream * rankStream = nullptr;
 
+std::ostringstream * rankBuffer = nullptr;
+
+/// The stream the buffered rank messages are written to
+std::ostream * rankOutput = nullptr;
+
 #ifdef GEOSX_USE_MPI
 MPI_Comm comm;
 #endif
@@ -127,6 +135,14 @@ void InitializeLogger( const std::string & rankOutputDir )
 
 void FinalizeLogger()
 {
+  FlushRankBuffers();
+  if( internal::rankBuffer != nullptr )
+  {
+    internal::rankStream = internal::rankOutput;
+    delete internal::rankBuffer;
+    internal::rankBuffer = nullptr;
+  }
+
   if( internal::rankStream != &std::cout )
   {
     delete internal::rankStream;
@@ -135,6 +151,71 @@ void FinalizeLogger()
   internal::rankStream = nullptr;
 }
 
+void BufferRankOutput()
+{
+  if( internal::rankBuffer == nullptr )
+  {
+    internal::rankOutput = internal::rankStream;
+    internal::rankBuffer = new std::ostringstream();
+    internal::rankStream = internal::rankBuffer;
+  }
+}
+
+void FlushRankBuffers()
+{
+  if( internal::rankBuffer == nullptr )
+  {
+    return;
+  }
+
+#ifdef GEOSX_USE_MPI
+  // each rank writing to its own file does not need to wait for the others
+  if( internal::rankOutput == &std::cout && internal::n_ranks > 1 )
+  {
+    std::string const messages = internal::rankBuffer->str();
+    internal::rankBuffer->str( "" );
+
+    int const size = static_cast< int >( messages.size() );
+    std::vector< int > sizes( internal::rank == 0 ? internal::n_ranks : 0 );
+    MPI_Gather( &size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, internal::comm );
+
+    std::vector< int > offsets( sizes.size() + 1, 0 );
+    for( std::size_t i = 0; i < sizes.size(); ++i )
+    {
+      offsets[i + 1] = offsets[i] + sizes[i];
+    }
+    std::vector< char > allMessages( offsets.back() );
+    MPI_Gatherv( messages.data(), size, MPI_CHAR,
+                 allMessages.data(), sizes.data(), offsets.data(), MPI_CHAR, 0, internal::comm );
+
+    if( internal::rank == 0 && !allMessages.empty() )
+    {
+      std::cout.write( allMessages.data(), static_cast< std::streamsize >( allMessages.size() ) );
+      std::cout.flush();
+    }
+    return;
+  }
+#endif
+
+  FlushLocalRankBuffer();
+}
+
+void FlushLocalRankBuffer()
+{
+  if( internal::rankBuffer == nullptr )
+  {
+    return;
+  }
+
+  std::string const messages = internal::rankBuffer->str();
+  internal::rankBuffer->str( "" );
+  if( !messages.empty() )
+  {
+    *internal::rankOutput << messages;
+    internal::rankOutput->flush();
+  }
+}
+
 } // namespace logger
 
 } // namespace geos
@@ -26,6 +26,7 @@
 #include "LvArray/src/Macros.hpp"
 
 // System includes
+#include <sstream>
 #include <stdexcept>
 
 #if defined(GEOSX_USE_MPI)
@@ -536,6 +537,8 @@ extern int n_ranks;
 
 extern std::ostream * rankStream;
 
+extern std::ostringstream * rankBuffer;
+
 #if defined(GEOSX_USE_MPI)
 extern MPI_Comm comm;
 #endif
@@ -558,9 +561,31 @@ void InitializeLogger( const std::string & rank_output_dir="" );
 
 /**
  * @brief Finalize the logger and close the rank streams.
+ * @details The buffered rank messages are flushed first, so this must be called by all the ranks.
  */
 void FinalizeLogger();
 
+/**
+ * @brief Accumulate the rank messages in memory instead of writing them as they are logged.
+ * @details The messages are only written by FlushRankBuffers(), which keeps verbose rank logging
+ * from flushing the output stream at every line.
+ */
+void BufferRankOutput();
+
+/**
+ * @brief Write the buffered rank messages, if any.
+ * @details When the ranks share the standard output, the messages are gathered and written by rank 0
+ * in the order of the ranks, so that the output does not depend on the timing of the ranks.
+ * This must be called by all the ranks.
+ */
+void FlushRankBuffers();
+
+/**
+ * @brief Write the buffered messages of this rank directly to its output stream.
+ * @details Unlike FlushRankBuffers(), this does not communicate, and is meant to be used before aborting on an error.
+ */
+void FlushLocalRankBuffer();
+
 } // namespace logger
 
 } // namespace geos
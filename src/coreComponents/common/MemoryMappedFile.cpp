@@ -0,0 +1,83 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MemoryMappedFile.cpp
+ */
+
+#include "MemoryMappedFile.hpp"
+
+#include "common/Format.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace geos
+{
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  close();
+}
+
+void MemoryMappedFile::open( string const & filename )
+{
+  close();
+
+  int const fd = ::open( filename.c_str(), O_RDONLY );
+  if( fd < 0 )
+  {
+    throw std::runtime_error( GEOS_FMT( "Could not open file {}: {}", filename, std::strerror( errno ) ) );
+  }
+
+  struct stat status;
+  if( ::fstat( fd, &status ) != 0 || status.st_size == 0 )
+  {
+    ::close( fd );
+    throw std::runtime_error( GEOS_FMT( "Could not get the size of file {}, or the file is empty", filename ) );
+  }
+
+  std::size_t const size = static_cast< std::size_t >( status.st_size );
+  void * const data = ::mmap( nullptr, size, PROT_READ, MAP_SHARED, fd, 0 );
+  // the mapping remains valid once the file descriptor is closed
+  ::close( fd );
+  if( data == MAP_FAILED )
+  {
+    throw std::runtime_error( GEOS_FMT( "Could not map file {} in memory: {}", filename, std::strerror( errno ) ) );
+  }
+
+  // the accesses follow the mesh, not the file order, so reading ahead would load pages that are never used
+  ::madvise( data, size, MADV_RANDOM );
+
+  m_data = data;
+  m_size = size;
+}
+
+void MemoryMappedFile::close()
+{
+  if( m_data != nullptr )
+  {
+    ::munmap( m_data, m_size );
+  }
+  m_data = nullptr;
+  m_size = 0;
+}
+
+} // namespace geos
@@ -0,0 +1,92 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MemoryMappedFile.hpp
+ */
+
+#ifndef GEOS_COMMON_MEMORYMAPPEDFILE_HPP
+#define GEOS_COMMON_MEMORYMAPPEDFILE_HPP
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @class MemoryMappedFile
+ * @brief Read-only mapping of a whole file in memory.
+ *
+ * The pages of the file are only loaded by the operating system when they are first read,
+ * and they are shared by all the processes of the node mapping the same file.
+ */
+class MemoryMappedFile
+{
+public:
+
+  /// Create an object mapping no file
+  MemoryMappedFile() = default;
+
+  /// Unmap the file
+  ~MemoryMappedFile();
+
+  /// @cond DO_NOT_DOCUMENT
+  MemoryMappedFile( MemoryMappedFile const & ) = delete;
+  MemoryMappedFile( MemoryMappedFile && ) = delete;
+  MemoryMappedFile & operator=( MemoryMappedFile const & ) = delete;
+  MemoryMappedFile & operator=( MemoryMappedFile && ) = delete;
+  /// @endcond
+
+  /**
+   * @brief Map a file in memory.
+   * @param[in] filename the name of the file
+   * @throw std::runtime_error if the file cannot be opened or mapped
+   */
+  void open( string const & filename );
+
+  /**
+   * @brief Unmap the file, if any.
+   */
+  void close();
+
+  /**
+   * @tparam T the type of the values stored in the file
+   * @return the content of the file, or nullptr if no file is mapped
+   */
+  template< typename T >
+  T const * data() const { return static_cast< T const * >( m_data ); }
+
+  /**
+   * @return the size of the file in bytes
+   */
+  std::size_t size() const { return m_size; }
+
+  /**
+   * @return true if no file is mapped
+   */
+  bool empty() const { return m_data == nullptr; }
+
+private:
+
+  /// The address of the mapping
+  void * m_data = nullptr;
+
+  /// The size of the mapping in bytes
+  std::size_t m_size = 0;
+
+};
+
+} // namespace geos
+
+#endif //GEOS_COMMON_MEMORYMAPPEDFILE_HPP
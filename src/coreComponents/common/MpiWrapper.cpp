@@ -262,6 +262,36 @@ int MpiWrapper::checkAll( int count, MPI_Request array_of_requests[], int * flag
 #endif
 }
 
+int MpiWrapper::start( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Start( request );
+#else
+  GEOS_UNUSED_VAR( request );
+  return 0;
+#endif
+}
+
+int MpiWrapper::startAll( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#else
+  GEOS_UNUSED_VAR( count, array_of_requests );
+  return 0;
+#endif
+}
+
+int MpiWrapper::requestFree( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#else
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 int MpiWrapper::wait( MPI_Request * request, MPI_Status * status )
 {
 #ifdef GEOSX_USE_MPI
@@ -216,6 +216,28 @@ public:
 
   static double wtime( void );
 
+  /**
+   * @brief Wrapper around MPI_Start(), activating a persistent request.
+   * @param[inout] request The persistent request created by sendInit() or recvInit().
+   * @return MPI_SUCCESS on success
+   */
+  static int start( MPI_Request * request );
+
+  /**
+   * @brief Wrapper around MPI_Startall(), activating a set of persistent requests.
+   * @param[in] count The number of requests in @p array_of_requests
+   * @param[inout] array_of_requests The persistent requests to start
+   * @return MPI_SUCCESS on success
+   */
+  static int startAll( int count, MPI_Request array_of_requests[] );
+
+  /**
+   * @brief Wrapper around MPI_Request_free(), releasing (in particular persistent) requests.
+   * @param[inout] request The request to free, set to MPI_REQUEST_NULL on return
+   * @return MPI_SUCCESS on success
+   */
+  static int requestFree( MPI_Request * request );
+
 
   /**
    * Wait on MPI_Requests to complete on at a time and trigger a callback to
@@ -329,6 +351,42 @@ public:
                          int * displacements,
                          MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoall.
+   * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] count The number of values sent to (and received from) each process.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoall().
+   */
+  template< typename T >
+  static int allToAll( T const * sendbuf,
+                       int count,
+                       T * recvbuf,
+                       MPI_Comm comm );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoallv.
+   * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] sendcounts The number of values to send to each process.
+   * @param[in] senddispls The displacement in @p sendbuf of the values sent to each process.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] recvcounts The number of values to receive from each process.
+   * @param[in] recvdispls The displacement in @p recvbuf of the values received from each process.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoallv().
+   */
+  template< typename T >
+  static int allToAllv( T const * sendbuf,
+                        int const * sendcounts,
+                        int const * senddispls,
+                        T * recvbuf,
+                        int const * recvcounts,
+                        int const * recvdispls,
+                        MPI_Comm comm );
+
   /**
    * @brief Convenience function for MPI_Allgather.
    * @tparam T The type to send/recieve. This must have a valid conversion to MPI_Datatype in getMpiType();
@@ -355,6 +413,19 @@ public:
   template< typename T >
   static int allReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[out] recvbuf The pointer to the receive buffer, only valid after completion of @p request.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the reduction operates.
+   * @param[out] request The MPI_Request to wait on for completion.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
+
 
   template< typename T >
   static int scan( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
@@ -483,6 +554,44 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that contains the data to be sent, which must stay valid
+   *                as long as the request is used.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request, to be activated with start() or startAll().
+   * @return
+   */
+  template< typename T >
+  static int sendInit( T const * const buf,
+                       int count,
+                       int dest,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that receives the data, which must stay valid
+   *                 as long as the request is used.
+   * @param[in] count The number of elements in \p buf
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages
+   * @param[in] comm The handle to the MPI_Comm
+   * @param[out] request Pointer to the persistent MPI_Request, to be activated with start() or startAll().
+   * @return
+   */
+  template< typename T >
+  static int recvInit( T * const buf,
+                       int count,
+                       int source,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
   /**
    * @brief Compute exclusive prefix sum and full sum
    * @tparam T type of local (rank) value
@@ -668,12 +777,48 @@ int MpiWrapper::allgatherv( T_SEND const * const sendbuf,
 #else
   static_assert( std::is_same< T_SEND, T_RECV >::value,
                  "MpiWrapper::allgatherv() for serial run requires send and receive buffers are of the same type" );
-  GEOS_ERROR_IF_NE_MSG( sendcount, recvcount, "sendcount is not equal to recvcount." );
-  std::copy( sendbuf, sendbuf + sendcount, recvbuf )
+  GEOS_ERROR_IF_NE_MSG( sendcount, recvcounts[0], "sendcount is not equal to recvcount." );
+  std::copy( sendbuf, sendbuf + sendcount, recvbuf + displacements[0] );
+  return 0;
+#endif
+}
+
+
+template< typename T >
+int MpiWrapper::allToAll( T const * const sendbuf,
+                          int const count,
+                          T * const recvbuf,
+                          MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoall( sendbuf, count, internal::getMpiType< T >(),
+                       recvbuf, count, internal::getMpiType< T >(),
+                       comm );
+#else
+  std::copy( sendbuf, sendbuf + count, recvbuf );
   return 0;
 #endif
 }
 
+template< typename T >
+int MpiWrapper::allToAllv( T const * const sendbuf,
+                           int const * const sendcounts,
+                           int const * const senddispls,
+                           T * const recvbuf,
+                           int const * const recvcounts,
+                           int const * const recvdispls,
+                           MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoallv( sendbuf, sendcounts, senddispls, internal::getMpiType< T >(),
+                        recvbuf, recvcounts, recvdispls, internal::getMpiType< T >(),
+                        comm );
+#else
+  GEOS_ERROR_IF_NE_MSG( sendcounts[0], recvcounts[0], "sendcount is not equal to recvcount." );
+  std::copy( sendbuf + senddispls[0], sendbuf + senddispls[0] + sendcounts[0], recvbuf + recvdispls[0] );
+  return 0;
+#endif
+}
 
 template< typename T >
 void MpiWrapper::allGather( T const myValue, array1d< T > & allValues, MPI_Comm MPI_PARAM( comm ) )
@@ -738,6 +883,27 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int const count,
+                            MPI_Op const MPI_PARAM( op ),
+                            MPI_Comm const MPI_PARAM( comm ),
+                            MPI_Request * const request )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const mpiType = internal::getMpiType< T >();
+  return MPI_Iallreduce( sendbuf == recvbuf ? MPI_IN_PLACE : sendbuf, recvbuf, count, mpiType, op, comm, request );
+#else
+  if( sendbuf != recvbuf )
+  {
+    memcpy( recvbuf, sendbuf, count * sizeof( T ) );
+  }
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::scan( T const * const sendbuf,
                       T * const recvbuf,
@@ -966,6 +1132,42 @@ int MpiWrapper::iSend( T const * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::sendInit( T const * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( dest ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  GEOS_ERROR_IF( (*request)!=MPI_REQUEST_NULL,
+                 "Attempting to use an MPI_Request that is still in use." );
+  return MPI_Send_init( buf, count, internal::getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOS_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::recvInit( T * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( source ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  GEOS_ERROR_IF( (*request)!=MPI_REQUEST_NULL,
+                 "Attempting to use an MPI_Request that is still in use." );
+  return MPI_Recv_init( buf, count, internal::getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOS_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
 template< typename U, typename T >
 U MpiWrapper::prefixSum( T const value, MPI_Comm comm )
 {
@@ -0,0 +1,99 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file NodeSharedBuffer.cpp
+ */
+
+#include "NodeSharedBuffer.hpp"
+
+#include <algorithm>
+#include <climits>
+
+namespace geos
+{
+
+NodeSharedBuffer::~NodeSharedBuffer()
+{
+  free();
+}
+
+void NodeSharedBuffer::allocate( arrayView1d< real64 const > const & values, MPI_Comm const comm )
+{
+  free();
+
+  m_size = values.size();
+  MpiWrapper::broadcast( m_size, 0, comm );
+
+#ifdef GEOSX_USE_MPI
+  // the ranks are ordered as in comm, so that the first rank of comm is the first rank of its node
+  int const rank = MpiWrapper::commRank( comm );
+  MPI_CHECK_ERROR( MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_nodeComm ) );
+  int const nodeRank = MpiWrapper::commRank( m_nodeComm );
+
+  // only the first rank of the node allocates memory, the window segments of the other ranks are empty
+  MPI_Aint const localSize = ( nodeRank == 0 ) ? static_cast< MPI_Aint >( m_size * sizeof( real64 ) ) : 0;
+  real64 * localData = nullptr;
+  MPI_CHECK_ERROR( MPI_Win_allocate_shared( localSize, sizeof( real64 ), MPI_INFO_NULL, m_nodeComm, &localData, &m_window ) );
+
+  MPI_Aint segmentSize = 0;
+  int displacementUnit = 0;
+  MPI_CHECK_ERROR( MPI_Win_shared_query( m_window, 0, &segmentSize, &displacementUnit, &m_data ) );
+
+  // the values are sent from the first rank to the first rank of each node only
+  MPI_Comm leaderComm = MpiWrapper::commSplit( comm, nodeRank == 0 ? 0 : MPI_UNDEFINED, rank );
+  if( nodeRank == 0 )
+  {
+    if( rank == 0 )
+    {
+      std::copy( values.begin(), values.end(), m_data );
+    }
+    // the values are sent by chunks, since the tables may hold more values than an MPI count can address
+    localIndex constexpr chunkSize = INT_MAX;
+    for( localIndex offset = 0; offset < m_size; offset += chunkSize )
+    {
+      int const count = LvArray::integerConversion< int >( std::min( chunkSize, m_size - offset ) );
+      MpiWrapper::bcast( m_data + offset, count, 0, leaderComm );
+    }
+    MpiWrapper::commFree( leaderComm );
+  }
+
+  // the other ranks of the node must not read the values before they have been written
+  // (the shared windows use the unified memory model, in which the barrier is enough)
+  MpiWrapper::barrier( m_nodeComm );
+#else
+  GEOS_UNUSED_VAR( comm );
+  m_localValues.resize( m_size );
+  std::copy( values.begin(), values.end(), m_localValues.begin() );
+  m_data = m_localValues.data();
+#endif
+}
+
+void NodeSharedBuffer::free()
+{
+#ifdef GEOSX_USE_MPI
+  if( m_window != MPI_WIN_NULL )
+  {
+    MPI_CHECK_ERROR( MPI_Win_free( &m_window ) );
+    MpiWrapper::commFree( m_nodeComm );
+    m_nodeComm = MPI_COMM_NULL;
+  }
+#else
+  m_localValues.clear();
+#endif
+  m_data = nullptr;
+  m_size = 0;
+}
+
+} // namespace geos
@@ -0,0 +1,103 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file NodeSharedBuffer.hpp
+ */
+
+#ifndef GEOS_COMMON_NODESHAREDBUFFER_HPP
+#define GEOS_COMMON_NODESHAREDBUFFER_HPP
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+
+namespace geos
+{
+
+/**
+ * @class NodeSharedBuffer
+ * @brief Read-only buffer of values stored once per compute node.
+ *
+ * The buffer lives in an MPI-3 shared-memory window: the first rank of each node owns the memory,
+ * and the other ranks of the node read it directly. The memory is host memory, so the buffer cannot
+ * be accessed from device kernels. Without MPI, the buffer is a plain copy of the values.
+ */
+class NodeSharedBuffer
+{
+public:
+
+  /// Create an empty buffer
+  NodeSharedBuffer() = default;
+
+  /// Free the shared memory, this is a collective call on the ranks of the node
+  ~NodeSharedBuffer();
+
+  /// @cond DO_NOT_DOCUMENT
+  NodeSharedBuffer( NodeSharedBuffer const & ) = delete;
+  NodeSharedBuffer( NodeSharedBuffer && ) = delete;
+  NodeSharedBuffer & operator=( NodeSharedBuffer const & ) = delete;
+  NodeSharedBuffer & operator=( NodeSharedBuffer && ) = delete;
+  /// @endcond
+
+  /**
+   * @brief Allocate the buffer on every node, and fill it with the values of the first rank.
+   * @param[in] values the values, only read on the first rank of @p comm
+   * @param[in] comm the communicator, all of its ranks must call this function
+   */
+  void allocate( arrayView1d< real64 const > const & values, MPI_Comm const comm = MPI_COMM_GEOSX );
+
+  /**
+   * @brief Free the buffer, this is a collective call on the communicator used to allocate it
+   */
+  void free();
+
+  /**
+   * @return the values, or nullptr if the buffer has not been allocated
+   */
+  real64 const * data() const { return m_data; }
+
+  /**
+   * @return the number of values
+   */
+  localIndex size() const { return m_size; }
+
+  /**
+   * @return true if the buffer has not been allocated
+   */
+  bool empty() const { return m_data == nullptr; }
+
+private:
+
+  /// The values, in the memory of the first rank of the node
+  real64 * m_data = nullptr;
+
+  /// The number of values
+  localIndex m_size = 0;
+
+#ifdef GEOSX_USE_MPI
+  /// The communicator of the ranks sharing the memory
+  MPI_Comm m_nodeComm = MPI_COMM_NULL;
+
+  /// The shared-memory window
+  MPI_Win m_window = MPI_WIN_NULL;
+#else
+  /// The copy of the values, when running without MPI
+  array1d< real64 > m_localValues;
+#endif
+
+};
+
+} // namespace geos
+
+#endif //GEOS_COMMON_NODESHAREDBUFFER_HPP
@@ -127,10 +127,47 @@ namespace timingHelpers
 
 #endif // GEOSX_USE_CALIPER
 
-/// Mark scope with both Caliper and NVTX if enabled
-#define GEOS_MARK_SCOPE(name) GEOS_CALIPER_MARK_SCOPE(name); GEOS_NVTX_MARK_SCOPE(name)
-/// Mark function with both Caliper and NVTX if enabled
-#define GEOS_MARK_FUNCTION GEOS_CALIPER_MARK_FUNCTION; GEOS_NVTX_MARK_FUNCTION
+#if defined( GEOS_USE_DEVICE_TIMERS )
+#include "common/DeviceTimers.hpp"
+
+/// Time the kernels of a scope on the device (only a local helper should not be used elsewhere)
+#define GEOS_DEVICE_MARK_SCOPE(name) geos::deviceTimers::DeviceScopeTimer __device_timer##__LINE__(STRINGIZE_NX(name))
+/// Time the kernels of a function on the device (only a local helper should not be used elsewhere)
+#define GEOS_DEVICE_MARK_FUNCTION geos::deviceTimers::DeviceScopeTimer __device_timer##__func__(timingHelpers::stripPF(__PRETTY_FUNCTION__))
+/// Annotate the innermost marked scope with the bytes moved and the floating point operations of a kernel
+#define GEOS_MARK_TRAFFIC(bytes, flops) geos::deviceTimers::addTraffic(bytes, flops)
+
+#else
+
+/// @cond DO_NOT_DOCUMENT
+#define GEOS_DEVICE_MARK_SCOPE(name)
+#define GEOS_DEVICE_MARK_FUNCTION
+#define GEOS_MARK_TRAFFIC(bytes, flops)
+/// @endcond
+
+#endif // GEOS_USE_DEVICE_TIMERS
+
+#if defined( GEOS_USE_PAPI )
+#include "common/HardwareCounters.hpp"
+
+/// Read the hardware counters of a scope (only a local helper should not be used elsewhere)
+#define GEOS_COUNTERS_MARK_SCOPE(name) geos::hardwareCounters::CounterScope __counter_scope##__LINE__(STRINGIZE_NX(name))
+/// Read the hardware counters of a function (only a local helper should not be used elsewhere)
+#define GEOS_COUNTERS_MARK_FUNCTION geos::hardwareCounters::CounterScope __counter_scope##__func__(timingHelpers::stripPF(__PRETTY_FUNCTION__))
+
+#else
+
+/// @cond DO_NOT_DOCUMENT
+#define GEOS_COUNTERS_MARK_SCOPE(name)
+#define GEOS_COUNTERS_MARK_FUNCTION
+/// @endcond
+
+#endif // GEOS_USE_PAPI
+
+/// Mark scope with Caliper, NVTX, the device timers and the hardware counters if enabled
+#define GEOS_MARK_SCOPE(name) GEOS_CALIPER_MARK_SCOPE(name); GEOS_NVTX_MARK_SCOPE(name); GEOS_DEVICE_MARK_SCOPE(name); GEOS_COUNTERS_MARK_SCOPE(name)
+/// Mark function with Caliper, NVTX, the device timers and the hardware counters if enabled
+#define GEOS_MARK_FUNCTION GEOS_CALIPER_MARK_FUNCTION; GEOS_NVTX_MARK_FUNCTION; GEOS_DEVICE_MARK_FUNCTION; GEOS_COUNTERS_MARK_FUNCTION
 /// Mark the beginning of function, only useful when you don't want to or can't mark the whole function.
 #define GEOS_MARK_FUNCTION_BEGIN(name) GEOS_CALIPER_MARK_FUNCTION_BEGIN(name)
 /// Mark the end of function, only useful when you don't want to or can't mark the whole function.
@@ -20,6 +20,11 @@
 
 // TPL includes
 #include <umpire/ResourceManager.hpp>
+#include <umpire/strategy/QuickPool.hpp>
+
+#if defined( GEOSX_USE_CHAI )
+#include <chai/ArrayManager.hpp>
+#endif
 
 #if defined( GEOSX_USE_CALIPER )
 #include <caliper/cali-manager.h>
@@ -29,6 +34,7 @@
 #endif
 
 // System includes
+#include <array>
 #include <iomanip>
 
 #if defined( GEOSX_USE_MKL )
@@ -37,6 +43,9 @@
 
 #if defined( GEOSX_USE_OPENMP )
 #include <omp.h>
+#if defined( __linux__ )
+#include <sched.h>
+#endif
 #endif
 
 #if defined( GEOS_USE_CUDA )
@@ -74,6 +83,8 @@ void setupLvArray()
 {
   LvArray::system::setErrorHandler( []()
   {
+    // the other ranks may not reach a collective flush
+    logger::FlushLocalRankBuffer();
   #if defined( GEOSX_USE_MPI )
     int mpi = 0;
     MPI_Initialized( &mpi );
@@ -107,6 +118,38 @@ void setupOpenMP()
 {
 #ifdef GEOSX_USE_OPENMP
   GEOS_LOG_RANK_0( "Max threads: " << omp_get_max_threads() );
+
+  if( omp_get_max_threads() > 1 )
+  {
+    // unbound threads may migrate away from the NUMA node holding the pages they first touched
+    omp_proc_bind_t const procBind = omp_get_proc_bind();
+    static std::array< char const *, 5 > const procBindNames = { "false", "true", "master", "close", "spread" };
+    GEOS_LOG_RANK_0( "OpenMP thread binding: " << ( static_cast< std::size_t >( procBind ) < procBindNames.size() ? procBindNames[procBind] : "unknown" )
+                                               << ", places: " << omp_get_num_places() );
+    if( procBind == omp_proc_bind_false )
+    {
+      GEOS_LOG_RANK_0( "Warning: the OpenMP threads are not bound, set OMP_PROC_BIND and OMP_PLACES "
+                       "(e.g. OMP_PROC_BIND=close OMP_PLACES=cores) to keep the threads close to their memory" );
+    }
+
+#if defined( __linux__ )
+    // count the ranks whose CPU set holds fewer cores than threads, these ranks oversubscribe their cores
+    cpu_set_t cpuSet;
+    CPU_ZERO( &cpuSet );
+    int numCpus = 0;
+    if( sched_getaffinity( 0, sizeof( cpu_set_t ), &cpuSet ) == 0 )
+    {
+      numCpus = CPU_COUNT( &cpuSet );
+    }
+    int const isOversubscribed = ( numCpus > 0 && numCpus < omp_get_max_threads() ) ? 1 : 0;
+    int const numOversubscribedRanks = MpiWrapper::sum( isOversubscribed );
+    if( numOversubscribedRanks > 0 )
+    {
+      GEOS_LOG_RANK_0( "Warning: " << numOversubscribedRanks << " rank(s) can only run on fewer cores than their "
+                                   << omp_get_max_threads() << " threads, check the binding of the MPI ranks" );
+    }
+#endif
+  }
 #endif
 }
 
@@ -304,6 +347,35 @@ static void addUmpireHighWaterMarks()
 }
 
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void setupMemoryPools()
+{
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+
+  // Create a pool on top of each of the resources allocated frequently, if available on the platform.
+  string pooledResources;
+  for( string const resourceName : { "DEVICE", "PINNED", "UM" } )
+  {
+    string const poolName = resourceName + "_POOL";
+    if( rm.isAllocator( resourceName ) && !rm.isAllocator( poolName ) )
+    {
+      rm.makeAllocator< umpire::strategy::QuickPool >( poolName, rm.getAllocator( resourceName ) );
+      pooledResources += ( pooledResources.empty() ? "" : ", " ) + resourceName;
+    }
+  }
+
+#if defined( GEOSX_USE_CHAI ) && defined( GEOS_USE_DEVICE )
+  // The device allocations of the arrays go through CHAI.
+  if( rm.isAllocator( "DEVICE_POOL" ) )
+  {
+    umpire::Allocator devicePool = rm.getAllocator( "DEVICE_POOL" );
+    chai::ArrayManager::getInstance()->setAllocator( chai::GPU, devicePool );
+  }
+#endif
+
+  GEOS_LOG_RANK_0( "Using Umpire memory pools for the resources: " << ( pooledResources.empty() ? "none" : pooledResources ) );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void setupEnvironment( int argc, char * argv[] )
 {
@@ -318,6 +390,13 @@ void setupEnvironment( int argc, char * argv[] )
 void cleanupEnvironment()
 {
   LvArray::system::resetSignalHandling();
+#if defined( GEOS_USE_DEVICE_TIMERS )
+  deviceTimers::printReport();
+#endif
+#if defined( GEOS_USE_PAPI )
+  hardwareCounters::printReport();
+  hardwareCounters::finalize();
+#endif
   finalizeLogger();
   addUmpireHighWaterMarks();
   finalizeCaliper();
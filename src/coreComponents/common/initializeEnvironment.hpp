@@ -71,6 +71,14 @@ struct CommandLineOptions
   /// Generally only used by the integration tests.
   integer suppressPinned = false;
 
+  /// True iff MPI communication buffers should be allocated in unified memory
+  /// ( if available ), so that device packing kernels write to device-resident pages
+  /// and a CUDA-aware MPI can operate on them without a host round-trip.
+  integer useUnifiedBuffers = false;
+
+  /// True iff the device arrays and the MPI communication buffers should be allocated from Umpire memory pools.
+  integer useMemoryPools = false;
+
   /// The name of the schema.
   string schemaName;
 
@@ -83,11 +91,20 @@ struct CommandLineOptions
   /// The string used to initialize caliper.
   string timerOutput = "";
 
+  /// The comma-separated list of hardware counters to read in the marked scopes.
+  string hardwareCounters = "";
+
   /// Trace host-device data migration.
   integer traceDataMigration = false;
 
   /// Print memory usage in data repository
   real64 printMemoryUsage = -1.0;
+
+  /// Number of cycles sampled to estimate the resources of the run, -1 if the run is not a dry run.
+  integer dryRunCycles = -1;
+
+  /// True iff the rank messages should be buffered in memory and written once per cycle.
+  integer bufferRankOutput = false;
 };
 
 /**
@@ -117,7 +134,7 @@ void setupLvArray();
 void setupMKL();
 
 /**
- * @brief Setup OpenMP.
+ * @brief Setup OpenMP, and report the binding of the threads.
  */
 void setupOpenMP();
 
@@ -133,6 +150,13 @@ void setupMPI( int argc, char * argv[] );
  */
 void finalizeMPI();
 
+/**
+ * @brief Setup the Umpire memory pools. The device arrays and the pinned or unified MPI communication
+ *        buffers allocated afterwards are taken from the pools, which avoids a device allocation each time
+ *        a temporary array or a buffer is created.
+ */
+void setupMemoryPools();
+
 
 /**
  * @brief Setup/init the environment.
@@ -152,6 +152,46 @@ void testLifoStorageAsync( int elemCnt, int numberOfElementsOnDevice, int number
   }
 }
 
+template< typename POLICY >
+void testLifoStorageCompressed( int elemCnt, int numberOfElementsOnDevice, int numberOfElementsOnHost, int totalNumberOfBuffers,
+                                double compressionTolerance )
+{
+  array1d< float > array( elemCnt );
+  array.move( local::RAJAHelper< POLICY >::space );
+  LifoStorage< float, localIndex > lifo( "lifo", array, numberOfElementsOnDevice, numberOfElementsOnHost, totalNumberOfBuffers,
+                                         compressionTolerance );
+
+  // half of each buffer is zero, as in a wavefield that has not reached part of the domain yet
+  for( int j = 0; j < totalNumberOfBuffers; j++ )
+  {
+    float * dataPointer = array.data();
+    forAll< POLICY >( elemCnt, [dataPointer, j, elemCnt] GEOS_HOST_DEVICE ( int i )
+    {
+      dataPointer[ i ] = ( 2 * i < elemCnt ) ? 0.0f : (float)( j + 1 ) / ( i + 1 );
+    } );
+    lifo.push( array );
+  }
+
+  for( int j = 0; j < totalNumberOfBuffers; j++ )
+  {
+    lifo.pop( array );
+    float * dataPointer = array.data();
+    float const tolerance = compressionTolerance;
+    forAll< POLICY >( elemCnt, [dataPointer, totalNumberOfBuffers, j, elemCnt, tolerance] GEOS_HOST_DEVICE ( int i )
+    {
+      float const expected = ( 2 * i < elemCnt ) ? 0.0f : (float)( totalNumberOfBuffers - j ) / ( i + 1 );
+      if( tolerance > 0 )
+      {
+        PORTABLE_EXPECT_NEAR( dataPointer[ i ], expected, 1.001 * tolerance );
+      }
+      else
+      {
+        PORTABLE_EXPECT_EQ( dataPointer[ i ], expected );
+      }
+    } );
+  }
+}
+
 
 TEST( LifoStorageTest, LifoStorageBufferOnHost )
 {
@@ -168,6 +208,16 @@ TEST( LifoStorageTest, LifoStorageAsyncBufferOnHost )
   testLifoStorageAsync< local::serialPolicy >( 10, 2, 3, 10 );
 }
 
+TEST( LifoStorageTest, LifoStorageLosslessCompressionOnHost )
+{
+  testLifoStorageCompressed< local::serialPolicy >( 100, 0, 3, 10, 0.0 );
+}
+
+TEST( LifoStorageTest, LifoStorageLossyCompressionOnHost )
+{
+  testLifoStorageCompressed< local::serialPolicy >( 100, 0, 3, 10, 1.0e-4 );
+}
+
 
 #ifdef GEOS_USE_CUDA
 TEST( LifoStorageTest, LifoStorageBufferOnCUDA )
@@ -0,0 +1,66 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/MemoryMappedFile.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using namespace geos;
+
+TEST( MemoryMappedFile, mapValues )
+{
+  string const filename = "testMemoryMappedFile.bin";
+  int const numValues = 1000;
+  {
+    std::ofstream file( filename, std::ios::binary );
+    for( int i = 0; i < numValues; ++i )
+    {
+      real64 const value = 0.25 * i;
+      file.write( reinterpret_cast< char const * >( &value ), sizeof( real64 ) );
+    }
+  }
+
+  MemoryMappedFile mappedFile;
+  EXPECT_TRUE( mappedFile.empty() );
+
+  mappedFile.open( filename );
+  ASSERT_FALSE( mappedFile.empty() );
+  ASSERT_EQ( mappedFile.size(), numValues * sizeof( real64 ) );
+  real64 const * const values = mappedFile.data< real64 >();
+  for( int i = 0; i < numValues; ++i )
+  {
+    EXPECT_EQ( values[i], 0.25 * i );
+  }
+
+  mappedFile.close();
+  EXPECT_TRUE( mappedFile.empty() );
+  std::remove( filename.c_str() );
+}
+
+TEST( MemoryMappedFile, missingFile )
+{
+  MemoryMappedFile mappedFile;
+  EXPECT_THROW( mappedFile.open( "testMemoryMappedFileMissing.bin" ), std::runtime_error );
+  EXPECT_TRUE( mappedFile.empty() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
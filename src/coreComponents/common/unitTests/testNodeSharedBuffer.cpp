@@ -0,0 +1,57 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "common/NodeSharedBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+TEST( NodeSharedBuffer, allocate )
+{
+  localIndex const numValues = 1000;
+  array1d< real64 > values;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    values.resize( numValues );
+    for( localIndex i = 0; i < numValues; ++i )
+    {
+      values[i] = 0.5 * i;
+    }
+  }
+
+  NodeSharedBuffer buffer;
+  EXPECT_TRUE( buffer.empty() );
+
+  buffer.allocate( values.toViewConst() );
+  ASSERT_FALSE( buffer.empty() );
+  ASSERT_EQ( buffer.size(), numValues );
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    EXPECT_EQ( buffer.data()[i], 0.5 * i );
+  }
+
+  buffer.free();
+  EXPECT_TRUE( buffer.empty() );
+  EXPECT_EQ( buffer.size(), 0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  MpiWrapper::init( &argc, &argv );
+  int const result = RUN_ALL_TESTS();
+  MpiWrapper::finalize();
+  return result;
+}
@@ -59,6 +59,13 @@ TableCapillaryPressure::TableCapillaryPressure( std::string const & name,
                     string( viewKeyStruct::wettingNonWettingCapPresTableNameString() ) +
                     " to specify the table names" );
 
+  registerWrapper( viewKeyStruct::uniformResamplingSizeString(), &m_uniformResamplingSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of points of the uniform saturation grid on which the tables are resampled at initialization. "
+                    "The lookups in the resampled tables compute the interval index directly instead of doing a binary search. "
+                    "The default, 0, uses the input tables" );
+
   registerWrapper( viewKeyStruct::capPresWrappersString(), &m_capPresKernelWrappers ).
     setSizedFromParent( 0 ).
     setRestartFlags( RestartFlags::NO_WRITE );
@@ -68,6 +75,11 @@ void TableCapillaryPressure::postProcessInput()
 {
   CapillaryPressureBase::postProcessInput();
 
+  GEOS_THROW_IF_LT_MSG( m_uniformResamplingSize, 0,
+                        GEOS_FMT( "{}: {} must be non-negative",
+                                  getFullName(), viewKeyStruct::uniformResamplingSizeString() ),
+                        InputError );
+
   integer const numPhases = m_phaseNames.size();
   GEOS_THROW_IF( numPhases != 2 && numPhases != 3,
                  GEOS_FMT( "{}: the expected number of fluid phases is either two, or three",
@@ -147,14 +159,14 @@ void TableCapillaryPressure::createAllTableKernelWrappers()
   if( numPhases == 2 )
   {
     TableFunction const & capPresTable = functionManager.getGroup< TableFunction >( m_wettingNonWettingCapPresTableName );
-    m_capPresKernelWrappers.emplace_back( capPresTable.createKernelWrapper() );
+    m_capPresKernelWrappers.emplace_back( capPresTable.createKernelWrapper( m_uniformResamplingSize ) );
   }
   else if( numPhases == 3 )
   {
     TableFunction const & capPresTableWI = functionManager.getGroup< TableFunction >( m_wettingIntermediateCapPresTableName );
-    m_capPresKernelWrappers.emplace_back( capPresTableWI.createKernelWrapper() );
+    m_capPresKernelWrappers.emplace_back( capPresTableWI.createKernelWrapper( m_uniformResamplingSize ) );
     TableFunction const & capPresTableNWI = functionManager.getGroup< TableFunction >( m_nonWettingIntermediateCapPresTableName );
-    m_capPresKernelWrappers.emplace_back( capPresTableNWI.createKernelWrapper() );
+    m_capPresKernelWrappers.emplace_back( capPresTableNWI.createKernelWrapper( m_uniformResamplingSize ) );
   }
 }
 
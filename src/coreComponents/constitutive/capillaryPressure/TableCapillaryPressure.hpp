@@ -90,6 +90,7 @@ private:
     static constexpr char const * wettingIntermediateCapPresTableNameString() { return "wettingIntermediateCapPressureTableName"; }
     static constexpr char const * nonWettingIntermediateCapPresTableNameString() { return "nonWettingIntermediateCapPressureTableName"; }
     static constexpr char const * capPresWrappersString() { return "capPresWrappers"; }
+    static constexpr char const * uniformResamplingSizeString() { return "uniformResamplingSize"; }
 
   };
 
@@ -113,6 +114,9 @@ private:
   /// Capillary pressure table names (one for each phase in the non-wetting-intermediate pair)
   string m_nonWettingIntermediateCapPresTableName;
 
+  /// Number of points of the uniform grid on which the tables are resampled (0 to use the input tables)
+  integer m_uniformResamplingSize;
+
   /// Capillary pressure kernel wrapper for the first pair (wetting-intermediate if NP=3, wetting-non-wetting otherwise)
   array1d< TableFunction::KernelWrapper > m_capPresKernelWrappers;
 
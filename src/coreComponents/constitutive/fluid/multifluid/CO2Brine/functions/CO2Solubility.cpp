@@ -176,15 +176,14 @@ void calculateCO2Solubility( string const & functionName,
   constexpr real64 zeta[] = { 3.36389723e-4, -1.98298980e-5, 0, 0, 0, 0, 0, 2.12220830e-3, -5.24873303e-3, 0, 0 };
 
   localIndex const nPressures = tableCoords.nPressures();
-  localIndex const nTemperatures = tableCoords.nTemperatures();
 
-  for( localIndex i = 0; i < nPressures; ++i )
+  PVTFunctionHelpers::computeTableValues( tableCoords, values, [&]( localIndex const j )
   {
-    real64 const P = tableCoords.getPressure( i ) / P_Pa_f;
+    real64 const T = tableCoords.getTemperature( j );
 
-    for( localIndex j = 0; j < nTemperatures; ++j )
+    for( localIndex i = 0; i < nPressures; ++i )
     {
-      real64 const T = tableCoords.getTemperature( j );
+      real64 const P = tableCoords.getPressure( i ) / P_Pa_f;
 
       // compute reduced volume by solving the CO2 equation of state
       real64 const V_r = CO2SolubilityFunction( functionName, tolerance, T, P, &co2EOS );
@@ -205,14 +204,15 @@ void calculateCO2Solubility( string const & functionName,
                        GEOS_FMT( "CO2Solubility: exp(logK) = {} is too small (logK = {}, P = {}, T = {}, V_r = {}), resulting solubility value is {}",
                                  expLogK, logK, P, T, V_r, values[j*nPressures+i] ));
 
+      // the value is computed by a single rank, which reports the correction
       if( values[j*nPressures+i] < 0 )
       {
-        GEOS_LOG_RANK_0( GEOS_FMT( "CO2Solubility: negative solubility value = {}, y_CO2 = {}, P = {}, PWater(T) = {}; corrected to 0",
-                                   values[j * nPressures + i], y_CO2, P, Pw ) );
+        GEOS_LOG_RANK( GEOS_FMT( "CO2Solubility: negative solubility value = {}, y_CO2 = {}, P = {}, PWater(T) = {}; corrected to 0",
+                                 values[j * nPressures + i], y_CO2, P, Pw ) );
         values[j*nPressures+i] = 0.0;
       }
     }
-  }
+  } );
 }
 
 TableFunction const * makeSolubilityTable( string_array const & inputParams,
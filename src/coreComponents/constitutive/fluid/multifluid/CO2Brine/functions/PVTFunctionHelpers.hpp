@@ -17,6 +17,7 @@
  */
 
 #include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
 #include "common/Units.hpp"
 
 #ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_CO2BRINE_FUNCTIONS_PVTFUNCTIONHELPERS_HPP_
@@ -227,6 +228,55 @@ initializePropertyTable( string_array const & inputParameters,
   }
 }
 
+/**
+ * @brief Compute the values of a property table, each rank computing a slab of temperatures
+ * @tparam FUNC type of the function computing the values at one temperature
+ * @param[in] tableCoords the (p,T) coordinates of the table
+ * @param[out] values the values of the table, with the pressure index changing the fastest
+ * @param[in] func the function called as func( j ) to compute values[j*nPressures+i] for all the pressures i
+ * @details The slabs are gathered on all the ranks, so that the equation of state is solved only once
+ * for each point of the table. This must be called by all the ranks.
+ */
+template< typename FUNC >
+void
+computeTableValues( PTTableCoordinates const & tableCoords,
+                    array1d< real64 > const & values,
+                    FUNC && func )
+{
+  localIndex const nPressures = tableCoords.nPressures();
+  localIndex const nTemperatures = tableCoords.nTemperatures();
+  int const numRanks = MpiWrapper::commSize();
+  int const rank = MpiWrapper::commRank();
+
+  if( numRanks == 1 || nTemperatures < numRanks )
+  {
+    for( localIndex j = 0; j < nTemperatures; ++j )
+    {
+      func( j );
+    }
+    return;
+  }
+
+  std::vector< int > counts( numRanks );
+  std::vector< int > offsets( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    localIndex const jBegin = nTemperatures * r / numRanks;
+    localIndex const jEnd = nTemperatures * ( r + 1 ) / numRanks;
+    counts[r] = LvArray::integerConversion< int >( ( jEnd - jBegin ) * nPressures );
+    offsets[r] = LvArray::integerConversion< int >( jBegin * nPressures );
+  }
+
+  for( localIndex j = nTemperatures * rank / numRanks; j < nTemperatures * ( rank + 1 ) / numRanks; ++j )
+  {
+    func( j );
+  }
+
+  // the send buffer cannot alias the receive buffer
+  std::vector< real64 > const slab( values.begin() + offsets[rank], values.begin() + offsets[rank] + counts[rank] );
+  MpiWrapper::allgatherv( slab.data(), counts[rank], values.data(), counts.data(), offsets.data(), MPI_COMM_GEOSX );
+}
+
 } // namespace PVTFunctionHelpers
 
 } // namespace PVTProps
@@ -256,17 +256,16 @@ void SpanWagnerCO2Density::calculateCO2Density( string const & functionName,
   constexpr real64 TK_f = constants::zeroDegreesCelsiusInKelvin;
 
   localIndex const nPressures = tableCoords.nPressures();
-  localIndex const nTemperatures = tableCoords.nTemperatures();
 
-  for( localIndex i = 0; i < nPressures; ++i )
+  PVTFunctionHelpers::computeTableValues( tableCoords, densities, [&]( localIndex const j )
   {
-    real64 const PPa = tableCoords.getPressure( i );
-    for( localIndex j = 0; j < nTemperatures; ++j )
+    real64 const TK = tableCoords.getTemperature( j ) + TK_f;
+    for( localIndex i = 0; i < nPressures; ++i )
     {
-      real64 const TK = tableCoords.getTemperature( j ) + TK_f;
+      real64 const PPa = tableCoords.getPressure( i );
       densities[j*nPressures+i] = spanWagnerCO2DensityFunction( functionName, tolerance, TK, PPa, &co2HelmholtzEnergy );
     }
-  }
+  } );
 }
 
 SpanWagnerCO2Density::SpanWagnerCO2Density( string const & name,
@@ -93,6 +93,8 @@ void MultiFluidBase::resizeFields( localIndex const size, localIndex const numPt
   integer const numPhase = numFluidPhases();
   integer const numComp = numFluidComponents();
   integer const numDof = numComp + 2;
+  // the enthalpy and internal energy derivatives are only read by the thermal solvers, so they are not stored otherwise
+  integer const numThermalDof = isThermal() ? numDof : 0;
 
   m_phaseFraction.value.resize( size, numPts, numPhase );
   m_phaseFraction.derivs.resize( size, numPts, numPhase, numDof );
@@ -109,11 +111,11 @@ void MultiFluidBase::resizeFields( localIndex const size, localIndex const numPt
 
   m_phaseEnthalpy.value.resize( size, numPts, numPhase );
   m_phaseEnthalpy_n.resize( size, numPts, numPhase );
-  m_phaseEnthalpy.derivs.resize( size, numPts, numPhase, numDof );
+  m_phaseEnthalpy.derivs.resize( size, numPts, numPhase, numThermalDof );
 
   m_phaseInternalEnergy.value.resize( size, numPts, numPhase );
   m_phaseInternalEnergy_n.resize( size, numPts, numPhase );
-  m_phaseInternalEnergy.derivs.resize( size, numPts, numPhase, numDof );
+  m_phaseInternalEnergy.derivs.resize( size, numPts, numPhase, numThermalDof );
 
   m_phaseCompFraction.value.resize( size, numPts, numPhase, numComp );
   m_phaseCompFraction_n.resize( size, numPts, numPhase, numComp );
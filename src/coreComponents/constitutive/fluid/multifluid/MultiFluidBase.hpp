@@ -164,6 +164,10 @@ public:
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseEnthalpy_n() const
   { return m_phaseEnthalpy_n; }
 
+  /**
+   * @brief Get the derivatives of the phase enthalpy.
+   * @return the derivatives, whose last dimension is zero if the fluid is not thermal (see isThermal)
+   */
   arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseEnthalpy() const
   { return m_phaseEnthalpy.derivs; }
 
@@ -173,6 +177,10 @@ public:
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseInternalEnergy_n() const
   { return m_phaseInternalEnergy_n; }
 
+  /**
+   * @brief Get the derivatives of the phase internal energy.
+   * @return the derivatives, whose last dimension is zero if the fluid is not thermal (see isThermal)
+   */
   arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseInternalEnergy() const
   { return m_phaseInternalEnergy.derivs; }
 
@@ -887,8 +895,11 @@ MultiFluidBase::KernelWrapper::
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, phaseFrac.derivs[ip], work, Deriv::dC );
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseDens[ip], work, Deriv::dC );
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseVisc[ip], work, Deriv::dC );
-    applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseEnthalpy[ip], work, Deriv::dC );
-    applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseInternalEnergy[ip], work, Deriv::dC );
+    if( dPhaseEnthalpy.size( 1 ) > 0 ) // the thermal derivatives are not stored for isothermal fluids
+    {
+      applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseEnthalpy[ip], work, Deriv::dC );
+      applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseInternalEnergy[ip], work, Deriv::dC );
+    }
 
     for( integer ic = 0; ic < numComp; ++ic )
     {
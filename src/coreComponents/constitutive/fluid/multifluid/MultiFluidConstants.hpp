@@ -19,6 +19,7 @@
 #ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_MULTIFLUIDCONSTANTS_HPP_
 #define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_MULTIFLUIDCONSTANTS_HPP_
 
+#include "common/GeosxConfig.hpp"
 #include "LvArray/src/Macros.hpp"
 
 namespace geos
@@ -30,9 +31,10 @@ struct MultiFluidConstants
 {
   /**
    * @brief Maximum supported number of fluid components (species)
-   * @note This puts an upper bound on memory use, allowing to optimize code better
+   * @note This puts an upper bound on memory use, allowing to optimize code better.
+   *       It is raised when the compositional flow kernels are compiled for more components.
    */
-  static constexpr integer MAX_NUM_COMPONENTS = 9;
+  static constexpr integer MAX_NUM_COMPONENTS = GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS > 9 ? GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS : 9;
 
   /**
    * @brief Maximum supported number of fluid phases
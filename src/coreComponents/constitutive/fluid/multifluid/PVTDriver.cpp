@@ -24,6 +24,7 @@
 #include "constitutive/fluid/multifluid/MultiFluidSelector.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidConstants.hpp"
 #include "fileIO/Outputs/OutputBase.hpp"
+#include "fileIO/timeHistory/HDFFile.hpp"
 #include "functions/FunctionManager.hpp"
 #include "functions/TableFunction.hpp"
 
@@ -46,8 +47,15 @@ PVTDriver::PVTDriver( const string & name,
     setDescription( "Fluid to test" );
 
   registerWrapper( viewKeyStruct::feedString(), &m_feed ).
-    setInputFlag( InputFlags::REQUIRED ).
-    setDescription( "Feed composition array [mol fraction]" );
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Feed composition array [mol fraction]. Required if " +
+                    string( viewKeyStruct::batchFeedString() ) + " is not specified" );
+
+  registerWrapper( viewKeyStruct::batchFeedString(), &m_batchFeed ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Feed compositions of the batch mode [mol fraction], with one row per feed. "
+                    "If specified, the pressure/temperature path is evaluated in parallel for each feed, "
+                    "and the output file is written in HDF5" );
 
   registerWrapper( viewKeyStruct::pressureFunctionString(), &m_pressureFunctionName ).
     setInputFlag( InputFlags::REQUIRED ).
@@ -84,11 +92,34 @@ void PVTDriver::postProcessInput()
   m_numPhases = baseFluid.numFluidPhases();
   m_numComponents = baseFluid.numFluidComponents();
 
-  // resize data table to fit number of timesteps and fluid phases:
-  // (numRows,numCols) = (numSteps+1,4+3*numPhases)
+  // check that a single feed or a batch of feeds is given
+
+  GEOS_THROW_IF( m_feed.empty() == m_batchFeed.empty(),
+                 getDataContext() << ": exactly one of " << viewKeyStruct::feedString() << " and "
+                                  << viewKeyStruct::batchFeedString() << " must be specified",
+                 InputError );
+  if( m_batchFeed.empty() )
+  {
+    GEOS_THROW_IF_NE_MSG( m_feed.size(), m_numComponents,
+                          GEOS_FMT( "{}: {} must have one value per fluid component", getDataContext(), viewKeyStruct::feedString() ),
+                          InputError );
+  }
+  else
+  {
+    GEOS_THROW_IF_NE_MSG( m_batchFeed.size( 1 ), m_numComponents,
+                          GEOS_FMT( "{}: {} must have one column per fluid component", getDataContext(), viewKeyStruct::batchFeedString() ),
+                          InputError );
+    GEOS_THROW_IF( m_baselineFile != "none",
+                   getDataContext() << ": baseline comparison is not supported in batch mode",
+                   InputError );
+  }
+  localIndex const numFeeds = m_batchFeed.empty() ? 1 : m_batchFeed.size( 0 );
+
+  // resize data table to fit number of feeds, timesteps and fluid phases:
+  // (numFeeds,numRows,numCols) = (numFeeds,numSteps+1,4+3*numPhases)
   // column order = time, pressure, temp, totalDensity, phaseFraction_{1:NP}, phaseDensity_{1:NP}, phaseViscosity_{1:NP}
 
-  m_table.resize( m_numSteps+1, 3*m_numPhases+4 );
+  m_table.resize( numFeeds, m_numSteps+1, 3*m_numPhases+4 );
 
   // initialize functions
 
@@ -107,13 +138,16 @@ void PVTDriver::postProcessInput()
   real64 const maxTime = coordinates[0][coordinates.sizeOfArray( 0 )-1];
   real64 const dt = (maxTime-minTime) / m_numSteps;
 
-  // set input columns
+  // set input columns, all the feeds follow the same path
 
-  for( integer n=0; n<m_numSteps+1; ++n )
+  for( localIndex k=0; k<numFeeds; ++k )
   {
-    m_table( n, TIME ) = minTime + n*dt;
-    m_table( n, PRES ) = pressureFunction.evaluate( &m_table( n, TIME ) );
-    m_table( n, TEMP ) = temperatureFunction.evaluate( &m_table( n, TIME ) );
+    for( integer n=0; n<m_numSteps+1; ++n )
+    {
+      m_table( k, n, TIME ) = minTime + n*dt;
+      m_table( k, n, PRES ) = pressureFunction.evaluate( &m_table( k, n, TIME ) );
+      m_table( k, n, TEMP ) = temperatureFunction.evaluate( &m_table( k, n, TIME ) );
+    }
   }
 }
 
@@ -149,16 +183,20 @@ bool PVTDriver::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
     GEOS_LOG_RANK_0( "  Steps .................. " << m_numSteps );
     GEOS_LOG_RANK_0( "  Output ................. " << m_outputFile );
     GEOS_LOG_RANK_0( "  Baseline ............... " << m_baselineFile );
+    if( !m_batchFeed.empty() )
+    {
+      GEOS_LOG_RANK_0( "  Batch Feeds ............ " << m_batchFeed.size( 0 ) );
+    }
   }
 
-  // create a dummy discretization with one quadrature point for
-  // storing constitutive data
+  // create a dummy discretization with one element per feed
+  // and one quadrature point for storing constitutive data
 
   conduit::Node node;
   dataRepository::Group rootGroup( "root", node );
   dataRepository::Group discretization( "discretization", &rootGroup );
 
-  discretization.resize( 1 );   // one element
+  discretization.resize( m_table.size( 0 ) );   // one element per feed
   baseFluid.allocateConstitutiveData( discretization, 1 );   // one quadrature point
 
   // pass the solid through the ConstitutivePassThru to downcast from the
@@ -176,7 +214,14 @@ bool PVTDriver::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
 
   if( m_outputFile != "none" )
   {
-    outputResults();
+    if( m_batchFeed.empty() )
+    {
+      outputResults();
+    }
+    else
+    {
+      outputBatchResults();
+    }
   }
 
   if( m_baselineFile != "none" )
@@ -204,11 +249,11 @@ void PVTDriver::outputResults()
   fprintf( fp, "# columns %d-%d = phase densities\n", 5+m_numPhases, 4+2*m_numPhases );
   fprintf( fp, "# columns %d-%d = phase viscosities\n", 5+2*m_numPhases, 4+3*m_numPhases );
 
-  for( integer n=0; n<m_table.size( 0 ); ++n )
+  for( integer n=0; n<m_table.size( 1 ); ++n )
   {
-    for( integer col=0; col<m_table.size( 1 ); ++col )
+    for( integer col=0; col<m_table.size( 2 ); ++col )
     {
-      fprintf( fp, "%.4e ", m_table( n, col ) );
+      fprintf( fp, "%.4e ", m_table( 0, n, col ) );
     }
     fprintf( fp, "\n" );
   }
@@ -216,6 +261,19 @@ void PVTDriver::outputResults()
 }
 
 
+void PVTDriver::outputBatchResults()
+{
+  // the results dataset has the size (feeds, steps+1, columns),
+  // with the same column ordering as the text output
+
+  HDFFile file( m_outputFile, true, true, MPI_COMM_SELF );
+  file.writeDataset( "results", m_table.data(),
+                     { m_table.size( 0 ), m_table.size( 1 ), m_table.size( 2 ) } );
+  file.writeDataset( "feedCompositions", m_batchFeed.data(),
+                     { m_batchFeed.size( 0 ), m_batchFeed.size( 1 ) } );
+}
+
+
 void PVTDriver::compareWithBaseline()
 {
   // open baseline file
@@ -237,14 +295,14 @@ void PVTDriver::compareWithBaseline()
   // specific.
 
   real64 value;
-  for( integer row=0; row < m_table.size( 0 ); ++row )
+  for( integer row=0; row < m_table.size( 1 ); ++row )
   {
-    for( integer col=0; col < m_table.size( 1 ); ++col )
+    for( integer col=0; col < m_table.size( 2 ); ++col )
     {
       GEOS_THROW_IF( file.eof(), "Baseline file appears shorter than internal results", std::runtime_error );
       file >> value;
 
-      real64 const error = fabs( m_table[row][col]-value ) / ( fabs( value )+1 );
+      real64 const error = fabs( m_table[0][row][col]-value ) / ( fabs( value )+1 );
       GEOS_THROW_IF( error > MultiFluidConstants::baselineTolerance, "Results do not match baseline at data row " << row+1
                                                                                                                   << " (row " << row+m_numColumns << " with header)"
                                                                                                                   << " and column " << col+1, std::runtime_error );
@@ -30,6 +30,8 @@ namespace geos
  * Class to allow for testing PVT behavior without the
  * complexity of setting up a full simulation.
  *
+ * In batch mode, the same pressure/temperature path is evaluated for a list of feed compositions,
+ * each feed being assigned to its own constitutive point so that all the paths run in parallel.
  */
 class PVTDriver : public TaskBase
 {
@@ -51,16 +53,21 @@ public:
   /**
    * @brief Run test using loading protocol in table
    * @param i Fluid constitutive model
-   * @param table Table with input/output time history
+   * @param table Table with input/output time history of each feed composition
    */
   template< typename FLUID_TYPE >
-  void runTest( FLUID_TYPE & fluid, arrayView2d< real64 > const & table );
+  void runTest( FLUID_TYPE & fluid, arrayView3d< real64 > const & table );
 
   /**
    * @brief Ouput table to file for easy plotting
    */
   void outputResults();
 
+  /**
+   * @brief Output the tables of all the feed compositions of a batch to a single HDF5 file
+   */
+  void outputBatchResults();
+
   /**
    * @brief Read in a baseline table from file and compare with computed one (for unit testing purposes)
    */
@@ -80,6 +87,7 @@ private:
     constexpr static char const * outputString() { return "output"; }
     constexpr static char const * baselineString() { return "baseline"; }
     constexpr static char const * feedString() { return "feedComposition"; }
+    constexpr static char const * batchFeedString() { return "batchFeedCompositions"; }
   };
 
   integer m_numSteps;      ///< Number of load steps
@@ -93,7 +101,8 @@ private:
   string m_outputFile;              ///< Output file (optional, no output if not specified)
 
   array1d< real64 > m_feed;  ///< User specified feed composition
-  array2d< real64 > m_table; ///< Table storing time-history of input/output
+  array2d< real64 > m_batchFeed; ///< User specified feed compositions of the batch mode, one row per feed
+  array3d< real64 > m_table; ///< Table storing time-history of input/output of each feed composition
 
   Path m_baselineFile; ///< Baseline file (optional, for unit testing of solid models)
 
@@ -25,7 +25,7 @@ namespace geos
 {
 
 template< typename FLUID_TYPE >
-void PVTDriver::runTest( FLUID_TYPE & fluid, arrayView2d< real64 > const & table )
+void PVTDriver::runTest( FLUID_TYPE & fluid, arrayView3d< real64 > const & table )
 {
   // get number of phases and components
 
@@ -40,21 +40,27 @@ void PVTDriver::runTest( FLUID_TYPE & fluid, arrayView2d< real64 > const & table
 
   typename FLUID_TYPE::KernelWrapper const kernelWrapper = fluid.createKernelWrapper();
 
-  // set composition to user specified feed
+  // set composition to user specified feeds, one per constitutive point
   // it is more convenient to provide input in molar, so perform molar to mass conversion here
 
-  GEOS_ASSERT_EQ( numComponents, m_feed.size() );
-  array2d< real64, compflow::LAYOUT_COMP > const compositionValues( 1, numComponents );
+  localIndex const numFeeds = table.size( 0 );
+  array2d< real64, compflow::LAYOUT_COMP > const compositionValues( numFeeds, numComponents );
 
-  real64 sum = 0.0;
-  for( integer i = 0; i < numComponents; ++i )
+  for( localIndex k = 0; k < numFeeds; ++k )
   {
-    compositionValues[0][i] = m_feed[i] * fluid.componentMolarWeights()[i];
-    sum += compositionValues[0][i];
-  }
-  for( integer i = 0; i < numComponents; ++i )
-  {
-    compositionValues[0][i] /= sum;
+    arraySlice1d< real64 const > const feed = m_batchFeed.empty() ? m_feed.toSliceConst() : m_batchFeed.toSliceConst()[k];
+    GEOS_ASSERT_EQ( numComponents, feed.size() );
+
+    real64 sum = 0.0;
+    for( integer i = 0; i < numComponents; ++i )
+    {
+      compositionValues[k][i] = feed[i] * fluid.componentMolarWeights()[i];
+      sum += compositionValues[k][i];
+    }
+    for( integer i = 0; i < numComponents; ++i )
+    {
+      compositionValues[k][i] /= sum;
+    }
   }
 
   arrayView2d< real64 const, compflow::USD_COMP > const composition = compositionValues;
@@ -69,14 +75,14 @@ void PVTDriver::runTest( FLUID_TYPE & fluid, arrayView2d< real64 > const & table
   {
     for( integer n = 0; n <= numSteps; ++n )
     {
-      kernelWrapper.update( i, 0, table( n, PRES ), table( n, TEMP ), composition[i] );
-      table( n, TEMP + 1 ) = kernelWrapper.totalDensity()( i, 0 );
+      kernelWrapper.update( i, 0, table( i, n, PRES ), table( i, n, TEMP ), composition[i] );
+      table( i, n, TEMP + 1 ) = kernelWrapper.totalDensity()( i, 0 );
 
       for( integer p = 0; p < numPhases; ++p )
       {
-        table( n, TEMP + 2 + p ) = kernelWrapper.phaseFraction()( i, 0, p );
-        table( n, TEMP + 2 + p + numPhases ) = kernelWrapper.phaseDensity()( i, 0, p );
-        table( n, TEMP + 2 + p + 2 * numPhases ) = kernelWrapper.phaseViscosity()( i, 0, p );
+        table( i, n, TEMP + 2 + p ) = kernelWrapper.phaseFraction()( i, 0, p );
+        table( i, n, TEMP + 2 + p + numPhases ) = kernelWrapper.phaseDensity()( i, 0, p );
+        table( i, n, TEMP + 2 + p + 2 * numPhases ) = kernelWrapper.phaseViscosity()( i, 0, p );
       }
     }
   } );
@@ -418,18 +418,27 @@ void BlackOilFluid::refineUndersaturatedTables( integer const numRefinedPressure
   }
 
   // Step 4: copy undersaturated data (array1d< array1d< real64 > >) into the final 2D arrays that will be used in the kernels
+  // Since the refined pressure grid is uniform and shared by all the branches, the kernels locate a pressure by index
+  // arithmetic, and the slopes of each interval are stored to get the values (and their derivatives) with a single blend
 
-  m_PVTO.undersaturatedPressure2d.resize( m_PVTO.numSaturatedPoints, refinedPres.size() );
+  m_PVTO.undersaturatedPressureIncrement = refinedPres[1] - refinedPres[0];
   m_PVTO.undersaturatedBo2d.resize( m_PVTO.numSaturatedPoints, refinedPres.size() );
   m_PVTO.undersaturatedViscosity2d.resize( m_PVTO.numSaturatedPoints, refinedPres.size() );
+  m_PVTO.undersaturatedBoSlope2d.resize( m_PVTO.numSaturatedPoints, refinedPres.size() - 1 );
+  m_PVTO.undersaturatedViscositySlope2d.resize( m_PVTO.numSaturatedPoints, refinedPres.size() - 1 );
   for( integer i = 0; i < m_PVTO.numSaturatedPoints; ++i )
   {
     for( integer j = 0; j < refinedPres.size(); ++j )
     {
-      m_PVTO.undersaturatedPressure2d[i][j] = m_PVTO.undersaturatedPressure[i][j];
       m_PVTO.undersaturatedBo2d[i][j] = m_PVTO.undersaturatedBo[i][j];
       m_PVTO.undersaturatedViscosity2d[i][j] = m_PVTO.undersaturatedViscosity[i][j];
     }
+    for( integer j = 0; j < refinedPres.size() - 1; ++j )
+    {
+      real64 const dPres = refinedPres[j + 1] - refinedPres[j];
+      m_PVTO.undersaturatedBoSlope2d[i][j] = ( m_PVTO.undersaturatedBo[i][j + 1] - m_PVTO.undersaturatedBo[i][j] ) / dPres;
+      m_PVTO.undersaturatedViscositySlope2d[i][j] = ( m_PVTO.undersaturatedViscosity[i][j + 1] - m_PVTO.undersaturatedViscosity[i][j] ) / dPres;
+    }
   }
 }
 
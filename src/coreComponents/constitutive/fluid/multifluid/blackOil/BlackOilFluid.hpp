@@ -234,6 +234,8 @@ private:
 
     /**
      * @brief Utility function to compute Bo and Visc (and derivatives) as a function of Rs in the undersaturated case
+     * @details The undersaturated branches are sampled on a uniform pressure grid, so the values and their analytical
+     *          derivatives are obtained by index arithmetic and a linear blend of the two branches bracketing Rs
      * @param[in] needDerivs flag to decide whether derivatives are computed or not
      * @param[in] pres pressure in the cell
      * @param[in] Rs ratio of volume of gas to the volume of oil at standard conditions
@@ -257,19 +259,6 @@ private:
                                            real64 & dVisc_dPres,
                                            real64 dVisc_dComp[] ) const;
 
-    /**
-     * @brief Utility function to compute Bo and Visc (no derivatives) as a function of Rs in the undersaturated case
-     * @param[in] Rs ratio of volume of gas to the volume of oil at standard conditions
-     * @param[in] pres pressure in the cell
-     * @param[out] Bo oil formation volume factor
-     * @param[out] visc oil viscosity
-     */
-    GEOS_HOST_DEVICE
-    void computeUndersaturatedBoViscosity( real64 const Rs,
-                                           real64 const pres,
-                                           real64 & Bo,
-                                           real64 & visc ) const;
-
     /**
      * @brief Utility function to compute the mass and molar densities as a function of Rs and Bo
      * @param[in] needDerivs flag to decide whether derivatives are computed or not
@@ -983,90 +972,69 @@ BlackOilFluid::KernelWrapper::
                                     real64 & dVisc_dPres,
                                     real64 dVisc_dComp[] ) const
 {
-  computeUndersaturatedBoViscosity( Rs, P, Bo, visc );
+  // Step 1: interpolate for presBub
+  arrayView1d< real64 const > const & RsVec = m_PVTOView.m_Rs;
+  integer const idx = LvArray::sortedArrayManipulation::find( RsVec.begin(),
+                                                              RsVec.size(),
+                                                              Rs );
+  integer const iUp  = LvArray::math::min( LvArray::math::max( idx, 1 ), LvArray::integerConversion< integer >( RsVec.size()-1 ) );
+  integer const iLow = iUp-1;
+
+  real64 presBub = 0.0;
+  real64 dPresBub_dRs = 0.0;
+  interpolation::linearInterpolation( Rs - RsVec[iLow], RsVec[iUp] - Rs,
+                                      m_PVTOView.m_bubblePressure[iLow], m_PVTOView.m_bubblePressure[iUp],
+                                      presBub, dPresBub_dRs );
+  real64 const deltaPres = P - presBub;
+
+  // Step 2: locate deltaPres in the uniform undersaturated pressure grid, the first and last intervals
+  // being extended to extrapolate linearly below and above the grid
+  integer const numIntervals = LvArray::integerConversion< integer >( m_PVTOView.m_undersaturatedBoSlope2d.size( 1 ) );
+  real64 const position = LvArray::math::min( LvArray::math::max( deltaPres * m_PVTOView.m_invUndersaturatedPressureIncrement, 0.0 ),
+                                              static_cast< real64 >( numIntervals - 1 ) );
+  integer const iP = static_cast< integer >( position );
+  real64 const deltaPresInInterval = deltaPres - iP * m_PVTOView.m_undersaturatedPressureIncrement;
+
+  // Step 3: weights of the two branches, as a function of the distance to their Rs
+  real64 const deltaRsLow = LvArray::math::abs( Rs - RsVec[iLow] );
+  real64 const deltaRsUp = LvArray::math::abs( RsVec[iUp] - Rs );
+  real64 const sumDeltaRs = deltaRsLow + deltaRsUp;
+  real64 const weightUp = deltaRsLow / sumDeltaRs;
+  real64 const dDeltaRsLow_dRs = ( Rs >= RsVec[iLow] ) ? 1.0 : -1.0;
+  real64 const dDeltaRsUp_dRs = ( Rs <= RsVec[iUp] ) ? -1.0 : 1.0;
+  real64 const dWeightUp_dRs = ( dDeltaRsLow_dRs * sumDeltaRs - deltaRsLow * ( dDeltaRsLow_dRs + dDeltaRsUp_dRs ) ) / ( sumDeltaRs * sumDeltaRs );
+
+  // Step 4: interpolate for Bo and viscosity, the derivatives coming out of the same lookup
+  auto interpolate = [&] ( arrayView2d< real64 const > const & values,
+                           arrayView2d< real64 const > const & slopes,
+                           real64 & value,
+                           real64 & dValue_dPres,
+                           real64 & dValue_dRs )
+  {
+    real64 const slopeLow = slopes[iLow][iP];
+    real64 const slopeUp = slopes[iUp][iP];
+    real64 const valueLow = values[iLow][iP] + slopeLow * deltaPresInInterval;
+    real64 const valueUp = values[iUp][iP] + slopeUp * deltaPresInInterval;
+    value = weightUp * valueUp + ( 1.0 - weightUp ) * valueLow;
+    dValue_dPres = weightUp * slopeUp + ( 1.0 - weightUp ) * slopeLow;
+    // at fixed pressure, a change of Rs moves the bubble-point pressure and the weights of the branches
+    dValue_dRs = dWeightUp_dRs * ( valueUp - valueLow ) - dValue_dPres * dPresBub_dRs;
+  };
+
+  real64 dBo_dRs = 0.0;
+  real64 dVisc_dRs = 0.0;
+  interpolate( m_PVTOView.m_undersaturatedBo2d, m_PVTOView.m_undersaturatedBoSlope2d, Bo, dBo_dPres, dBo_dRs );
+  interpolate( m_PVTOView.m_undersaturatedViscosity2d, m_PVTOView.m_undersaturatedViscositySlope2d, visc, dVisc_dPres, dVisc_dRs );
 
   if( needDerivs )
   {
-    // numerical derivatives
-
-    // 1. dPres
-    real64 const eps = 1e-6;
-    real64 const inv_eps = 1.0 / eps;
-    real64 const P_eps = P + eps;
-    real64 Bo_eps   = 0.0;
-    real64 visc_eps = 0.0;
-    computeUndersaturatedBoViscosity( Rs, P_eps, Bo_eps, visc_eps );
-    dBo_dPres = (Bo_eps - Bo) * inv_eps;
-    dVisc_dPres = (visc_eps - visc) * inv_eps;
-
-    // 2. dRs
-    real64 const Rs_eps = Rs + eps;
-    computeUndersaturatedBoViscosity( Rs_eps, P, Bo_eps, visc_eps );
-    real64 const dBo_dRs =   (Bo_eps - Bo) * inv_eps;
-    real64 const dVisc_dRs = (visc_eps - visc) * inv_eps;
-
-    // 3. chainrule to dComp
+    // chainrule to dComp
     for( integer i = 0; i < HNC_BO; ++i )
     {
       dBo_dComp[i] = dBo_dRs * dRs_dComp[i];
       dVisc_dComp[i] = dVisc_dRs * dRs_dComp[i];
     }
   }
-
-}
-
-GEOS_HOST_DEVICE
-GEOS_FORCE_INLINE
-void
-BlackOilFluid::KernelWrapper::
-  computeUndersaturatedBoViscosity( real64 const Rs,
-                                    real64 const pres,
-                                    real64 & Bo,
-                                    real64 & visc ) const
-{
-  // Step 1: interpolate for presBub
-  arrayView1d< real64 const > const RsVec = m_PVTOView.m_Rs;
-  integer idx = LvArray::sortedArrayManipulation::find( RsVec.begin(),
-                                                        RsVec.size(),
-                                                        Rs );
-  integer const iUp  = LvArray::math::min( LvArray::math::max( idx, 1 ), LvArray::integerConversion< integer >( RsVec.size()-1 ) );
-  integer const iLow = iUp-1;
-
-  real64 const presBub = interpolation::linearInterpolation( Rs - m_PVTOView.m_Rs[iLow], m_PVTOView.m_Rs[iUp] - Rs,
-                                                             m_PVTOView.m_bubblePressure[iLow], m_PVTOView.m_bubblePressure[iUp] );
-  real64 const deltaPres = pres - presBub;
-
-  // Step 2: get indices in undersatured pressure table
-  real64 const deltaRsUp = LvArray::math::abs( m_PVTOView.m_Rs[iUp] - Rs );
-  real64 const deltaRsLow = LvArray::math::abs( Rs - m_PVTOView.m_Rs[iLow] );
-  arraySlice1d< real64 const > const & presUp = m_PVTOView.m_undersaturatedPressure2d[iUp];
-  arraySlice1d< real64 const > const & presLow = m_PVTOView.m_undersaturatedPressure2d[iLow];
-
-  idx = LvArray::sortedArrayManipulation::find( presUp.begin(),
-                                                presUp.size(),
-                                                deltaPres );
-  integer const iUpP  = LvArray::math::min( LvArray::math::max( idx, 1 ), LvArray::integerConversion< integer >( presUp.size()-1 ) );
-  integer const iLowP = iUpP-1;
-
-  // Step 3: interpolate for Bo
-  arraySlice1d< real64 const > const & BoUp = m_PVTOView.m_undersaturatedBo2d[iUp];
-  arraySlice1d< real64 const > const & BoLow = m_PVTOView.m_undersaturatedBo2d[iLow];
-
-  real64 const BoInterpLow = interpolation::linearInterpolation( deltaPres-presLow[iLowP], presLow[iUpP]-deltaPres,
-                                                                 BoLow[iLowP], BoLow[iUpP] );
-  real64 const BoInterpUp = interpolation::linearInterpolation( deltaPres-presUp[iLowP], presUp[iUpP]-deltaPres,
-                                                                BoUp[iLowP], BoUp[iUpP] );
-  Bo = interpolation::linearInterpolation( deltaRsLow, deltaRsUp, BoInterpLow, BoInterpUp );
-
-  // Step 4: interpolate for viscosity
-  arraySlice1d< real64 const > const & viscUp = m_PVTOView.m_undersaturatedViscosity2d[iUp];
-  arraySlice1d< real64 const > const & viscLow = m_PVTOView.m_undersaturatedViscosity2d[iLow];
-
-  real64 const viscInterpLow = interpolation::linearInterpolation( deltaPres-presLow[iLowP], presLow[iUpP]-deltaPres,
-                                                                   viscLow[iLowP], viscLow[iUpP] );
-  real64 const viscInterpUp = interpolation::linearInterpolation( deltaPres-presUp[iLowP], presUp[iUpP]-deltaPres,
-                                                                  viscUp[iLowP], viscUp[iUpP] );
-  visc = interpolation::linearInterpolation( deltaRsLow, deltaRsUp, viscInterpLow, viscInterpUp );
 }
 
 GEOS_HOST_DEVICE
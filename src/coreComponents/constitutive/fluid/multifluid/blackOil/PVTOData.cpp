@@ -26,9 +26,11 @@ PVTOData::KernelWrapper PVTOData::createKernelWrapper() const
                                   bubblePressure.toViewConst(),
                                   saturatedBo.toViewConst(),
                                   saturatedViscosity.toViewConst(),
-                                  undersaturatedPressure2d.toViewConst(),
+                                  undersaturatedPressureIncrement,
                                   undersaturatedBo2d.toViewConst(),
                                   undersaturatedViscosity2d.toViewConst(),
+                                  undersaturatedBoSlope2d.toViewConst(),
+                                  undersaturatedViscositySlope2d.toViewConst(),
                                   surfaceMassDensity.toViewConst(),
                                   surfaceMoleDensity.toViewConst());
 }
@@ -37,9 +39,11 @@ PVTOData::KernelWrapper::KernelWrapper( arrayView1d< real64 const > const & Rs,
                                         arrayView1d< real64 const > const & bubblePressure,
                                         arrayView1d< real64 const > const & saturatedBo,
                                         arrayView1d< real64 const > const & saturatedViscosity,
-                                        arrayView2d< real64 const > const & undersaturatedPressure,
+                                        real64 const undersaturatedPressureIncrement,
                                         arrayView2d< real64 const > const & undersaturatedBo,
                                         arrayView2d< real64 const > const & undersaturatedViscosity,
+                                        arrayView2d< real64 const > const & undersaturatedBoSlope,
+                                        arrayView2d< real64 const > const & undersaturatedViscositySlope,
                                         arrayView1d< real64 const > const & surfaceMassDensity,
                                         arrayView1d< real64 const > const & surfaceMoleDensity )
   :
@@ -47,9 +51,12 @@ PVTOData::KernelWrapper::KernelWrapper( arrayView1d< real64 const > const & Rs,
   m_bubblePressure( bubblePressure ),
   m_saturatedBo( saturatedBo ),
   m_saturatedViscosity( saturatedViscosity ),
-  m_undersaturatedPressure2d( undersaturatedPressure ),
+  m_undersaturatedPressureIncrement( undersaturatedPressureIncrement ),
+  m_invUndersaturatedPressureIncrement( 1.0 / undersaturatedPressureIncrement ),
   m_undersaturatedBo2d( undersaturatedBo ),
   m_undersaturatedViscosity2d( undersaturatedViscosity ),
+  m_undersaturatedBoSlope2d( undersaturatedBoSlope ),
+  m_undersaturatedViscositySlope2d( undersaturatedViscositySlope ),
   m_surfaceMassDensity( surfaceMassDensity ),
   m_surfaceMoleDensity( surfaceMoleDensity )
 {}
@@ -50,9 +50,11 @@ public:
                    arrayView1d< real64 const > const & bubblePressure,
                    arrayView1d< real64 const > const & saturatedBo,
                    arrayView1d< real64 const > const & saturatedViscosity,
-                   arrayView2d< real64 const > const & undersaturatedPressure,
+                   real64 const undersaturatedPressureIncrement,
                    arrayView2d< real64 const > const & undersaturatedBo,
                    arrayView2d< real64 const > const & undersaturatedViscosity,
+                   arrayView2d< real64 const > const & undersaturatedBoSlope,
+                   arrayView2d< real64 const > const & undersaturatedViscositySlope,
                    arrayView1d< real64 const > const & surfaceMassDensity,
                    arrayView1d< real64 const > const & surfaceMoleDensity );
 
@@ -64,9 +66,10 @@ public:
       m_saturatedBo.move( space, touch );
       m_saturatedViscosity.move( space, touch );
 
-      m_undersaturatedPressure2d.move( space, touch );
       m_undersaturatedBo2d.move( space, touch );
       m_undersaturatedViscosity2d.move( space, touch );
+      m_undersaturatedBoSlope2d.move( space, touch );
+      m_undersaturatedViscositySlope2d.move( space, touch );
 
       m_surfaceMassDensity.move( space, touch );
       m_surfaceMoleDensity.move( space, touch );
@@ -88,12 +91,18 @@ public:
 
     // Undersaturated data (no free gas)
 
-    /// Undersaturated pressure
-    arrayView2d< real64 const > m_undersaturatedPressure2d;
+    /// Spacing of the uniform undersaturated pressure grid (relative to the bubble-point pressure)
+    real64 m_undersaturatedPressureIncrement;
+    /// Inverse of the spacing of the uniform undersaturated pressure grid
+    real64 m_invUndersaturatedPressureIncrement;
     /// Undersaturated oil phase formation volume factor
     arrayView2d< real64 const > m_undersaturatedBo2d;
     /// Undersaturated oil phase viscosity
     arrayView2d< real64 const > m_undersaturatedViscosity2d;
+    /// Slope wrt pressure of the undersaturated oil phase formation volume factor on each interval of the grid
+    arrayView2d< real64 const > m_undersaturatedBoSlope2d;
+    /// Slope wrt pressure of the undersaturated oil phase viscosity on each interval of the grid
+    arrayView2d< real64 const > m_undersaturatedViscositySlope2d;
 
     /// Surface mass density
     arrayView1d< real64 const > m_surfaceMassDensity;
@@ -125,12 +134,16 @@ public:
 
   // Undersaturated data (no free gas)
 
-  /// Undersaturated pressure
-  array2d< real64 > undersaturatedPressure2d;
+  /// Spacing of the uniform undersaturated pressure grid, shared by all the branches
+  real64 undersaturatedPressureIncrement = 0.0;
   /// Undersaturated oil phase formation volume factor
   array2d< real64 > undersaturatedBo2d;
   /// Undersaturated oil phase viscosity
   array2d< real64 > undersaturatedViscosity2d;
+  /// Slope wrt pressure of the undersaturated oil phase formation volume factor, also used for extrapolation
+  array2d< real64 > undersaturatedBoSlope2d;
+  /// Slope wrt pressure of the undersaturated oil phase viscosity, also used for extrapolation
+  array2d< real64 > undersaturatedViscositySlope2d;
 
   /// Surface mass density
   array1d< real64 > surfaceMassDensity;
@@ -0,0 +1,464 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BatchedNegativeTwoPhaseFlash.hpp
+ */
+
+#ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_FUNCTIONS_BATCHEDNEGATIVETWOPHASEFLASH_HPP_
+#define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_FUNCTIONS_BATCHEDNEGATIVETWOPHASEFLASH_HPP_
+
+#include "FlashWarmStartCache.hpp"
+#include "NegativeTwoPhaseFlash.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+namespace geos
+{
+
+namespace constitutive
+{
+
+/**
+ * @brief Negative two-phase flash of many cells at once.
+ * @tparam BATCH_SIZE number of cells (lanes) flashed together by one thread
+ *
+ * The cells are first ordered by the phase state predicted from the Wilson K-values, so that cells
+ * with similar iteration counts are flashed by neighbouring threads (the same warp on device).
+ * Each thread then performs the successive substitution iterations of NegativeTwoPhaseFlash on a batch
+ * of BATCH_SIZE cells in lockstep: a lane is masked out as soon as it has converged, and the batch stops
+ * when all the lanes have converged. On device, a batch size of one relies on the ordering only; on host,
+ * larger batches amortize the loop control and expose the per-component loops to vectorization.
+ *
+ * When a FlashWarmStartCache is provided, the iterations start from the K-values of the last converged flash
+ * of each cell instead of the Wilson K-values, and single-phase cells whose state has not changed beyond the
+ * tolerance of the cache are not flashed again.
+ */
+template< integer BATCH_SIZE >
+struct BatchedNegativeTwoPhaseFlash
+{
+  /// Number of cells flashed together by one thread
+  static constexpr integer batchSize = BATCH_SIZE;
+
+  /// Phase state predicted from the Wilson K-values
+  enum class PhaseState : integer
+  {
+    LIQUID = 0,   ///< the Rachford-Rice solution is below zero
+    TWO_PHASE = 1, ///< the Rachford-Rice solution is between zero and one
+    VAPOUR = 2    ///< the Rachford-Rice solution is above one
+  };
+
+  /**
+   * @brief Predict the phase state of a mixture from the signs of the Rachford-Rice function at zero and one
+   * evaluated with the Wilson K-values
+   * @param[in] numComps number of components
+   * @param[in] pressure pressure
+   * @param[in] temperature temperature
+   * @param[in] composition composition of the mixture
+   * @param[in] criticalPressure critical pressures
+   * @param[in] criticalTemperature critical temperatures
+   * @param[in] acentricFactor acentric factors
+   * @return the predicted phase state
+   */
+  GEOS_HOST_DEVICE
+  static PhaseState predictPhaseState( integer const numComps,
+                                       real64 const pressure,
+                                       real64 const temperature,
+                                       arraySlice1d< real64 const > const composition,
+                                       arrayView1d< real64 const > const criticalPressure,
+                                       arrayView1d< real64 const > const criticalTemperature,
+                                       arrayView1d< real64 const > const acentricFactor )
+  {
+    stackArray1d< real64, MultiFluidConstants::MAX_NUM_COMPONENTS > kVapourLiquid( numComps );
+    KValueInitialization::computeWilsonGasLiquidKvalue( numComps,
+                                                        pressure,
+                                                        temperature,
+                                                        criticalPressure,
+                                                        criticalTemperature,
+                                                        acentricFactor,
+                                                        kVapourLiquid );
+    real64 valueAtZero = 0.0;
+    real64 valueAtOne = 0.0;
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      valueAtZero += composition[ic] * ( kVapourLiquid[ic] - 1.0 );
+      valueAtOne += composition[ic] * ( kVapourLiquid[ic] - 1.0 ) / kVapourLiquid[ic];
+    }
+    if( valueAtZero <= 0.0 )
+    {
+      return PhaseState::LIQUID;
+    }
+    if( 0.0 <= valueAtOne )
+    {
+      return PhaseState::VAPOUR;
+    }
+    return PhaseState::TWO_PHASE;
+  }
+
+  /**
+   * @brief Order the cells by predicted phase state
+   * @tparam POLICY the execution policy used to predict the phase states
+   * @param[in] numComps number of components
+   * @param[in] pressure pressure of each cell
+   * @param[in] temperature temperature of each cell
+   * @param[in] composition composition of the mixture in each cell
+   * @param[in] criticalPressure critical pressures
+   * @param[in] criticalTemperature critical temperatures
+   * @param[in] acentricFactor acentric factors
+   * @param[out] order the cell indices, grouped by predicted phase state (stable within each group)
+   */
+  template< typename POLICY >
+  static void sortByPhaseState( integer const numComps,
+                                arrayView1d< real64 const > const pressure,
+                                arrayView1d< real64 const > const temperature,
+                                arrayView2d< real64 const > const composition,
+                                arrayView1d< real64 const > const criticalPressure,
+                                arrayView1d< real64 const > const criticalTemperature,
+                                arrayView1d< real64 const > const acentricFactor,
+                                arrayView1d< localIndex > const order )
+  {
+    localIndex const numCells = pressure.size();
+    array1d< integer > states( numCells );
+    arrayView1d< integer > const statesView = states.toView();
+
+    forAll< POLICY >( numCells, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      statesView[k] = static_cast< integer >( predictPhaseState( numComps,
+                                                                 pressure[k],
+                                                                 temperature[k],
+                                                                 composition[k],
+                                                                 criticalPressure,
+                                                                 criticalTemperature,
+                                                                 acentricFactor ) );
+    } );
+
+    // counting sort on host, there are only three states
+    states.move( LvArray::MemorySpace::host, false );
+    order.move( LvArray::MemorySpace::host, true );
+    localIndex offsets[4] = { 0, 0, 0, 0 };
+    for( localIndex k = 0; k < numCells; ++k )
+    {
+      ++offsets[states[k] + 1];
+    }
+    for( integer s = 0; s < 3; ++s )
+    {
+      offsets[s + 1] += offsets[s];
+    }
+    for( localIndex k = 0; k < numCells; ++k )
+    {
+      order[offsets[states[k]]++] = k;
+    }
+  }
+
+  /**
+   * @brief Perform the negative two-phase flash of a batch of cells
+   * @param[in] numComps number of components
+   * @param[in] numLanes number of cells in the batch (at most BATCH_SIZE)
+   * @param[in] cells indices of the cells of the batch
+   * @param[in] pressure pressure of each cell
+   * @param[in] temperature temperature of each cell
+   * @param[in] composition composition of the mixture in each cell
+   * @param[in] criticalPressure critical pressures
+   * @param[in] criticalTemperature critical temperatures
+   * @param[in] acentricFactor acentric factors
+   * @param[in] binaryInteractionCoefficients binary coefficients (currently not implemented)
+   * @param[out] vapourPhaseMoleFraction the calculated vapour (gas) mole fraction of each cell
+   * @param[out] liquidComposition the calculated liquid phase composition of each cell
+   * @param[out] vapourComposition the calculated vapour phase composition of each cell
+   * @param[out] converged an indicator of success of the flash of each cell
+   * @param[in] warmStart the cache of the last converged flashes (disabled if default constructed)
+   */
+  template< typename EOS_TYPE_LIQUID, typename EOS_TYPE_VAPOUR >
+  GEOS_HOST_DEVICE
+  static void computeBatch( integer const numComps,
+                            integer const numLanes,
+                            localIndex const (&cells)[BATCH_SIZE],
+                            arrayView1d< real64 const > const pressure,
+                            arrayView1d< real64 const > const temperature,
+                            arrayView2d< real64 const > const composition,
+                            arrayView1d< real64 const > const criticalPressure,
+                            arrayView1d< real64 const > const criticalTemperature,
+                            arrayView1d< real64 const > const acentricFactor,
+                            real64 const & binaryInteractionCoefficients,
+                            arrayView1d< real64 > const vapourPhaseMoleFraction,
+                            arrayView2d< real64 > const liquidComposition,
+                            arrayView2d< real64 > const vapourComposition,
+                            arrayView1d< integer > const converged,
+                            FlashWarmStartCache::KernelWrapper const & warmStart )
+  {
+    constexpr integer maxNumComps = MultiFluidConstants::MAX_NUM_COMPONENTS;
+    stackArray2d< real64, BATCH_SIZE * maxNumComps > kVapourLiquid( BATCH_SIZE, numComps );
+    stackArray1d< integer, maxNumComps > presentComponentIds[BATCH_SIZE];
+    stackArray1d< real64, maxNumComps > logLiquidFugacity( numComps );
+    stackArray1d< real64, maxNumComps > logVapourFugacity( numComps );
+    bool active[BATCH_SIZE];
+    bool skipped[BATCH_SIZE];
+
+    for( integer lane = 0; lane < numLanes; ++lane )
+    {
+      localIndex const k = cells[lane];
+      active[lane] = true;
+      skipped[lane] = false;
+      converged[k] = 0;
+
+      presentComponentIds[lane].resize( numComps );
+      integer presentCount = 0;
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        liquidComposition[k][ic] = composition[k][ic];
+        vapourComposition[k][ic] = composition[k][ic];
+        if( MultiFluidConstants::epsilon < composition[k][ic] )
+        {
+          presentComponentIds[lane][presentCount++] = ic;
+        }
+      }
+      presentComponentIds[lane].resize( presentCount );
+
+      if( warmStart.canSkipFlash( k, numComps, pressure[k], temperature[k], composition[k] ) )
+      {
+        // the cell stays in the same single phase, the trial composition of the absent phase is taken from the cached K-values
+        arraySlice1d< real64 const > const cachedKValues = warmStart.kValues( k );
+        bool const isLiquid = ( warmStart.phaseState( k ) == 0 );
+        arraySlice1d< real64 > const trialComposition = isLiquid ? vapourComposition[k] : liquidComposition[k];
+        for( integer const ic : presentComponentIds[lane] )
+        {
+          trialComposition[ic] = isLiquid ? cachedKValues[ic] * composition[k][ic] : composition[k][ic] / cachedKValues[ic];
+        }
+        NegativeTwoPhaseFlash::normalizeComposition( numComps, trialComposition );
+        vapourPhaseMoleFraction[k] = isLiquid ? 0.0 : 1.0;
+        active[lane] = false;
+        skipped[lane] = true;
+        converged[k] = 1;
+        continue;
+      }
+
+      if( warmStart.phaseState( k ) != FlashWarmStartCache::noState )
+      {
+        arraySlice1d< real64 const > const cachedKValues = warmStart.kValues( k );
+        for( integer ic = 0; ic < numComps; ++ic )
+        {
+          kVapourLiquid[lane][ic] = cachedKValues[ic];
+        }
+      }
+      else
+      {
+        KValueInitialization::computeWilsonGasLiquidKvalue( numComps,
+                                                            pressure[k],
+                                                            temperature[k],
+                                                            criticalPressure,
+                                                            criticalTemperature,
+                                                            acentricFactor,
+                                                            kVapourLiquid[lane] );
+      }
+    }
+
+    for( localIndex iterationCount = 0; iterationCount < MultiFluidConstants::maxSSIIterations; ++iterationCount )
+    {
+      integer numActive = 0;
+      for( integer lane = 0; lane < numLanes; ++lane )
+      {
+        if( !active[lane] )
+        {
+          continue;
+        }
+        localIndex const k = cells[lane];
+
+        // Solve Rachford-Rice Equation
+        vapourPhaseMoleFraction[k] = RachfordRice::solve( kVapourLiquid[lane].toSliceConst(), composition[k], presentComponentIds[lane].toSliceConst() );
+
+        // Assign phase compositions
+        for( integer const ic : presentComponentIds[lane] )
+        {
+          liquidComposition[k][ic] = composition[k][ic] / ( 1.0 + vapourPhaseMoleFraction[k] * ( kVapourLiquid[lane][ic] - 1.0 ) );
+          vapourComposition[k][ic] = kVapourLiquid[lane][ic] * liquidComposition[k][ic];
+        }
+
+        NegativeTwoPhaseFlash::normalizeComposition( numComps, liquidComposition[k] );
+        NegativeTwoPhaseFlash::normalizeComposition( numComps, vapourComposition[k] );
+
+        // Compute the phase fugacities
+        CubicEOSPhaseModel< EOS_TYPE_LIQUID >::compute( numComps,
+                                                        pressure[k],
+                                                        temperature[k],
+                                                        liquidComposition[k].toSliceConst(),
+                                                        criticalPressure,
+                                                        criticalTemperature,
+                                                        acentricFactor,
+                                                        binaryInteractionCoefficients,
+                                                        logLiquidFugacity );
+        CubicEOSPhaseModel< EOS_TYPE_VAPOUR >::compute( numComps,
+                                                        pressure[k],
+                                                        temperature[k],
+                                                        vapourComposition[k].toSliceConst(),
+                                                        criticalPressure,
+                                                        criticalTemperature,
+                                                        acentricFactor,
+                                                        binaryInteractionCoefficients,
+                                                        logVapourFugacity );
+
+        // Check convergence and update the K-values of the lanes that have not converged
+        bool laneConverged = true;
+        for( integer const ic : presentComponentIds[lane] )
+        {
+          real64 const fugacityRatio = exp( logLiquidFugacity[ic] - logVapourFugacity[ic] ) * liquidComposition[k][ic] / vapourComposition[k][ic];
+          if( MultiFluidConstants::fugacityTolerance < fabs( fugacityRatio - 1.0 ) )
+          {
+            laneConverged = false;
+          }
+          logLiquidFugacity[ic] = fugacityRatio;
+        }
+
+        if( laneConverged )
+        {
+          active[lane] = false;
+          converged[k] = 1;
+          continue;
+        }
+
+        for( integer const ic : presentComponentIds[lane] )
+        {
+          kVapourLiquid[lane][ic] *= logLiquidFugacity[ic];
+        }
+        ++numActive;
+      }
+
+      if( numActive == 0 )
+      {
+        break;
+      }
+    }
+
+    // Retrieve physical bounds from negative flash values
+    for( integer lane = 0; lane < numLanes; ++lane )
+    {
+      localIndex const k = cells[lane];
+      if( !skipped[lane] )
+      {
+        if( converged[k] )
+        {
+          integer const state = ( vapourPhaseMoleFraction[k] <= 0.0 ) ? 0 : ( ( 1.0 <= vapourPhaseMoleFraction[k] ) ? 2 : 1 );
+          warmStart.store( k, numComps, pressure[k], temperature[k], composition[k], kVapourLiquid[lane].toSliceConst(), state );
+        }
+        else
+        {
+          warmStart.invalidate( k );
+        }
+      }
+      if( vapourPhaseMoleFraction[k] <= 0.0 )
+      {
+        vapourPhaseMoleFraction[k] = 0.0;
+        for( integer ic = 0; ic < numComps; ++ic )
+        {
+          liquidComposition[k][ic] = composition[k][ic];
+        }
+      }
+      else if( 1.0 <= vapourPhaseMoleFraction[k] )
+      {
+        vapourPhaseMoleFraction[k] = 1.0;
+        for( integer ic = 0; ic < numComps; ++ic )
+        {
+          vapourComposition[k][ic] = composition[k][ic];
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Perform the negative two-phase flash of all the cells
+   * @tparam POLICY the execution policy
+   * @param[in] numComps number of components
+   * @param[in] pressure pressure of each cell
+   * @param[in] temperature temperature of each cell
+   * @param[in] composition composition of the mixture in each cell
+   * @param[in] criticalPressure critical pressures
+   * @param[in] criticalTemperature critical temperatures
+   * @param[in] acentricFactor acentric factors
+   * @param[in] binaryInteractionCoefficients binary coefficients (currently not implemented)
+   * @param[out] vapourPhaseMoleFraction the calculated vapour (gas) mole fraction of each cell
+   * @param[out] liquidComposition the calculated liquid phase composition of each cell
+   * @param[out] vapourComposition the calculated vapour phase composition of each cell
+   * @param[out] converged an indicator of success of the flash of each cell
+   * @param[in] warmStart the cache of the last converged flashes (disabled if default constructed)
+   * @return true if the flash has converged in all the cells
+   */
+  template< typename POLICY, typename EOS_TYPE_LIQUID, typename EOS_TYPE_VAPOUR >
+  static bool compute( integer const numComps,
+                       arrayView1d< real64 const > const pressure,
+                       arrayView1d< real64 const > const temperature,
+                       arrayView2d< real64 const > const composition,
+                       arrayView1d< real64 const > const criticalPressure,
+                       arrayView1d< real64 const > const criticalTemperature,
+                       arrayView1d< real64 const > const acentricFactor,
+                       real64 const binaryInteractionCoefficients,
+                       arrayView1d< real64 > const vapourPhaseMoleFraction,
+                       arrayView2d< real64 > const liquidComposition,
+                       arrayView2d< real64 > const vapourComposition,
+                       arrayView1d< integer > const converged,
+                       FlashWarmStartCache::KernelWrapper const & warmStart = FlashWarmStartCache::KernelWrapper() )
+  {
+    localIndex const numCells = pressure.size();
+    array1d< localIndex > order( numCells );
+    sortByPhaseState< POLICY >( numComps,
+                                pressure,
+                                temperature,
+                                composition,
+                                criticalPressure,
+                                criticalTemperature,
+                                acentricFactor,
+                                order.toView() );
+    arrayView1d< localIndex const > const orderView = order.toViewConst();
+
+    localIndex const numBatches = ( numCells + BATCH_SIZE - 1 ) / BATCH_SIZE;
+    forAll< POLICY >( numBatches, [=] GEOS_HOST_DEVICE ( localIndex const batchIndex )
+    {
+      localIndex cells[BATCH_SIZE]{};
+      integer numLanes = 0;
+      for( integer lane = 0; lane < BATCH_SIZE; ++lane )
+      {
+        localIndex const index = batchIndex * BATCH_SIZE + lane;
+        if( index < numCells )
+        {
+          cells[numLanes++] = orderView[index];
+        }
+      }
+      computeBatch< EOS_TYPE_LIQUID, EOS_TYPE_VAPOUR >( numComps,
+                                                        numLanes,
+                                                        cells,
+                                                        pressure,
+                                                        temperature,
+                                                        composition,
+                                                        criticalPressure,
+                                                        criticalTemperature,
+                                                        acentricFactor,
+                                                        binaryInteractionCoefficients,
+                                                        vapourPhaseMoleFraction,
+                                                        liquidComposition,
+                                                        vapourComposition,
+                                                        converged,
+                                                        warmStart );
+    } );
+
+    RAJA::ReduceMin< ReducePolicy< POLICY >, integer > allConverged( 1 );
+    forAll< POLICY >( numCells, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      allConverged.min( converged[k] );
+    } );
+    return allConverged.get() == 1;
+  }
+};
+
+} // namespace constitutive
+
+} // namespace geos
+
+#endif //GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_FUNCTIONS_BATCHEDNEGATIVETWOPHASEFLASH_HPP_
@@ -84,7 +84,7 @@ public:
   compute( integer const numComps,
            real64 const & pressure,
            real64 const & temperature,
-           arrayView1d< real64 const > const composition,
+           arraySlice1d< real64 const > const composition,
            arrayView1d< real64 const > const criticalPressure,
            arrayView1d< real64 const > const criticalTemperature,
            arrayView1d< real64 const > const acentricFactor,
@@ -112,7 +112,7 @@ public:
   computeMixtureCoefficients( integer const numComps,
                               real64 const & pressure,
                               real64 const & temperature,
-                              arrayView1d< real64 const > const composition,
+                              arraySlice1d< real64 const > const composition,
                               arrayView1d< real64 const > const criticalPressure,
                               arrayView1d< real64 const > const criticalTemperature,
                               arrayView1d< real64 const > const acentricFactor,
@@ -150,7 +150,7 @@ public:
   computeMixtureCoefficients( integer const numComps,
                               real64 const & pressure,
                               real64 const & temperature,
-                              arrayView1d< real64 const > const composition,
+                              arraySlice1d< real64 const > const composition,
                               arrayView1d< real64 const > const criticalPressure,
                               arrayView1d< real64 const > const criticalTemperature,
                               arrayView1d< real64 const > const acentricFactor,
@@ -181,7 +181,7 @@ public:
   GEOS_FORCE_INLINE
   static void
   computeCompressibilityFactor( integer const numComps,
-                                arrayView1d< real64 const > const composition,
+                                arraySlice1d< real64 const > const composition,
                                 real64 const & binaryInteractionCoefficients,
                                 arraySlice1d< real64 const > const aPureCoefficient,
                                 arraySlice1d< real64 const > const bPureCoefficient,
@@ -239,7 +239,7 @@ public:
   GEOS_FORCE_INLINE
   static void
   computeLogFugacityCoefficients( integer const numComps,
-                                  arrayView1d< real64 const > const composition,
+                                  arraySlice1d< real64 const > const composition,
                                   real64 const & binaryInteractionCoefficients,
                                   real64 const & compressibilityFactor,
                                   arraySlice1d< real64 const > const aPureCoefficient,
@@ -277,7 +277,7 @@ CubicEOSPhaseModel< EOS_TYPE >::
 compute( integer const numComps,
          real64 const & pressure,
          real64 const & temperature,
-         arrayView1d< real64 const > const composition,
+         arraySlice1d< real64 const > const composition,
          arrayView1d< real64 const > const criticalPressure,
          arrayView1d< real64 const > const criticalTemperature,
          arrayView1d< real64 const > const acentricFactor,
@@ -334,7 +334,7 @@ CubicEOSPhaseModel< EOS_TYPE >::
 computeMixtureCoefficients( integer const numComps,
                             real64 const & pressure,
                             real64 const & temperature,
-                            arrayView1d< real64 const > const composition,
+                            arraySlice1d< real64 const > const composition,
                             arrayView1d< real64 const > const criticalPressure,
                             arrayView1d< real64 const > const criticalTemperature,
                             arrayView1d< real64 const > const acentricFactor,
@@ -373,7 +373,7 @@ CubicEOSPhaseModel< EOS_TYPE >::
 computeMixtureCoefficients( integer const numComps,
                             real64 const & pressure,
                             real64 const & temperature,
-                            arrayView1d< real64 const > const composition,
+                            arraySlice1d< real64 const > const composition,
                             arrayView1d< real64 const > const criticalPressure,
                             arrayView1d< real64 const > const criticalTemperature,
                             arrayView1d< real64 const > const acentricFactor,
@@ -435,7 +435,7 @@ GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
 computeCompressibilityFactor( integer const numComps,
-                              arrayView1d< real64 const > const composition,
+                              arraySlice1d< real64 const > const composition,
                               real64 const & binaryInteractionCoefficients,
                               arraySlice1d< real64 const > const aPureCoefficient,
                               arraySlice1d< real64 const > const bPureCoefficient,
@@ -567,7 +567,7 @@ GEOS_HOST_DEVICE
 void
 CubicEOSPhaseModel< EOS_TYPE >::
 computeLogFugacityCoefficients( integer const numComps,
-                                arrayView1d< real64 const > const composition,
+                                arraySlice1d< real64 const > const composition,
                                 real64 const & binaryInteractionCoefficients,
                                 real64 const & compressibilityFactor,
                                 arraySlice1d< real64 const > const aPureCoefficient,
@@ -0,0 +1,280 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FlashWarmStartCache.hpp
+ */
+
+#ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_FUNCTIONS_FLASHWARMSTARTCACHE_HPP_
+#define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_FUNCTIONS_FLASHWARMSTARTCACHE_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+namespace geos
+{
+
+namespace constitutive
+{
+
+/**
+ * @class FlashWarmStartCache
+ * @brief Per-cell storage of the last converged flash, used to warm start the next flash of the same cell.
+ *
+ * Between two Newton iterations the state of most cells changes very little, so the converged K-values of
+ * the previous flash are a much better initial guess than the Wilson correlation. In addition, a cell that
+ * was found single-phase is not flashed again as long as its pressure, temperature and composition stay
+ * within a relative tolerance of the state of the last converged flash.
+ */
+class FlashWarmStartCache
+{
+public:
+
+  /// Phase state value of a cell without a converged flash
+  static constexpr integer noState = -1;
+
+  /**
+   * @class KernelWrapper
+   * @brief Views on the cache usable in device kernels.
+   *
+   * A default constructed wrapper is disabled: no K-values are available and no flash is skipped.
+   */
+  class KernelWrapper
+  {
+public:
+
+    /// Default constructor, builds a disabled wrapper
+    KernelWrapper() = default;
+
+    /**
+     * @brief Constructor.
+     * @param kValues converged K-values of the last flash of each cell
+     * @param pressure pressure of the last converged flash of each cell
+     * @param temperature temperature of the last converged flash of each cell
+     * @param composition composition of the last converged flash of each cell
+     * @param phaseState phase state of the last converged flash of each cell
+     * @param skipTolerance relative change of state below which a single-phase cell is not flashed again
+     */
+    KernelWrapper( arrayView2d< real64 > const & kValues,
+                   arrayView1d< real64 > const & pressure,
+                   arrayView1d< real64 > const & temperature,
+                   arrayView2d< real64 > const & composition,
+                   arrayView1d< integer > const & phaseState,
+                   real64 const skipTolerance ):
+      m_kValues( kValues ),
+      m_pressure( pressure ),
+      m_temperature( temperature ),
+      m_composition( composition ),
+      m_phaseState( phaseState ),
+      m_skipTolerance( skipTolerance ),
+      m_enabled( true )
+    {}
+
+    /**
+     * @brief Check whether the cache holds a converged flash for a cell
+     * @param[in] k the cell index
+     * @return the phase state of the last converged flash, or noState
+     */
+    GEOS_HOST_DEVICE
+    integer phaseState( localIndex const k ) const
+    {
+      return m_enabled ? m_phaseState[k] : noState;
+    }
+
+    /**
+     * @brief Check whether the state of a single-phase cell has changed enough to require a new flash
+     * @param[in] k the cell index
+     * @param[in] numComps number of components
+     * @param[in] pressure current pressure
+     * @param[in] temperature current temperature
+     * @param[in] composition current composition
+     * @return true if the cell was single-phase and its state is within the tolerance of the last converged flash
+     */
+    GEOS_HOST_DEVICE
+    bool canSkipFlash( localIndex const k,
+                       integer const numComps,
+                       real64 const pressure,
+                       real64 const temperature,
+                       arraySlice1d< real64 const > const composition ) const
+    {
+      integer const state = phaseState( k );
+      // the two-phase cells are always flashed again, only from a better initial guess
+      if( m_skipTolerance < 0.0 || ( state != 0 && state != 2 ) )
+      {
+        return false;
+      }
+      if( m_skipTolerance * LvArray::math::abs( m_pressure[k] ) < LvArray::math::abs( pressure - m_pressure[k] ) ||
+          m_skipTolerance * LvArray::math::abs( m_temperature[k] ) < LvArray::math::abs( temperature - m_temperature[k] ) )
+      {
+        return false;
+      }
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        if( m_skipTolerance < LvArray::math::abs( composition[ic] - m_composition[k][ic] ) )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * @brief Get the K-values of the last converged flash of a cell
+     * @param[in] k the cell index
+     * @return the K-values
+     */
+    GEOS_HOST_DEVICE
+    arraySlice1d< real64 const > kValues( localIndex const k ) const
+    {
+      return m_kValues[k];
+    }
+
+    /**
+     * @brief Store the result of a converged flash
+     * @param[in] k the cell index
+     * @param[in] numComps number of components
+     * @param[in] pressure pressure
+     * @param[in] temperature temperature
+     * @param[in] composition composition
+     * @param[in] kValues converged K-values
+     * @param[in] state phase state (0 for liquid, 1 for two-phase, 2 for vapour)
+     */
+    GEOS_HOST_DEVICE
+    void store( localIndex const k,
+                integer const numComps,
+                real64 const pressure,
+                real64 const temperature,
+                arraySlice1d< real64 const > const composition,
+                arraySlice1d< real64 const > const kValues,
+                integer const state ) const
+    {
+      if( !m_enabled )
+      {
+        return;
+      }
+      m_pressure[k] = pressure;
+      m_temperature[k] = temperature;
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        m_composition[k][ic] = composition[ic];
+        m_kValues[k][ic] = kValues[ic];
+      }
+      m_phaseState[k] = state;
+    }
+
+    /**
+     * @brief Invalidate the cached flash of a cell
+     * @param[in] k the cell index
+     */
+    GEOS_HOST_DEVICE
+    void invalidate( localIndex const k ) const
+    {
+      if( m_enabled )
+      {
+        m_phaseState[k] = noState;
+      }
+    }
+
+private:
+
+    /// Converged K-values
+    arrayView2d< real64 > m_kValues;
+
+    /// Pressure of the last converged flash
+    arrayView1d< real64 > m_pressure;
+
+    /// Temperature of the last converged flash
+    arrayView1d< real64 > m_temperature;
+
+    /// Composition of the last converged flash
+    arrayView2d< real64 > m_composition;
+
+    /// Phase state of the last converged flash
+    arrayView1d< integer > m_phaseState;
+
+    /// Relative change of state below which a single-phase cell is not flashed again
+    real64 m_skipTolerance{ -1.0 };
+
+    /// Flag indicating whether the cache is in use
+    bool m_enabled{ false };
+  };
+
+  /**
+   * @brief Constructor.
+   * @param numCells number of cells
+   * @param numComps number of components
+   * @param skipTolerance relative change of state below which a single-phase cell is not flashed again
+   *        (a negative value disables the skip, the cache is then only used for the initial K-values)
+   */
+  FlashWarmStartCache( localIndex const numCells,
+                       integer const numComps,
+                       real64 const skipTolerance ):
+    m_kValues( numCells, numComps ),
+    m_pressure( numCells ),
+    m_temperature( numCells ),
+    m_composition( numCells, numComps ),
+    m_phaseState( numCells ),
+    m_skipTolerance( skipTolerance )
+  {
+    m_phaseState.setValues< serialPolicy >( noState );
+  }
+
+  /**
+   * @brief Invalidate all the cached flashes, for instance after a time step cut
+   */
+  void reset()
+  {
+    m_phaseState.setValues< serialPolicy >( noState );
+  }
+
+  /**
+   * @brief Create a wrapper usable in device kernels
+   * @return the kernel wrapper
+   */
+  KernelWrapper createKernelWrapper()
+  {
+    return KernelWrapper( m_kValues.toView(),
+                          m_pressure.toView(),
+                          m_temperature.toView(),
+                          m_composition.toView(),
+                          m_phaseState.toView(),
+                          m_skipTolerance );
+  }
+
+private:
+
+  /// Converged K-values of the last flash of each cell
+  array2d< real64 > m_kValues;
+
+  /// Pressure of the last converged flash of each cell
+  array1d< real64 > m_pressure;
+
+  /// Temperature of the last converged flash of each cell
+  array1d< real64 > m_temperature;
+
+  /// Composition of the last converged flash of each cell
+  array2d< real64 > m_composition;
+
+  /// Phase state of the last converged flash of each cell
+  array1d< integer > m_phaseState;
+
+  /// Relative change of state below which a single-phase cell is not flashed again
+  real64 const m_skipTolerance;
+};
+
+} // namespace constitutive
+
+} // namespace geos
+
+#endif //GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_COMPOSITIONAL_FUNCTIONS_FLASHWARMSTARTCACHE_HPP_
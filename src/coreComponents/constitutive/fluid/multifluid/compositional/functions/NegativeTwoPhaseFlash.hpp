@@ -177,7 +177,6 @@ public:
     return converged;
   }
 
-private:
   /**
    * @brief Normalise a composition in place to ensure that the components add up to unity
    * @param[in] numComps number of components
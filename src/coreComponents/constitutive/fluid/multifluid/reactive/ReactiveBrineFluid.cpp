@@ -240,7 +240,9 @@ ReactiveBrineFluid< PHASE > ::createKernelWrapper()
                         m_primarySpeciesConcentration.toView(),
                         m_secondarySpeciesConcentration.toView(),
                         m_primarySpeciesTotalConcentration.toView(),
-                        m_kineticReactionRates.toView() );
+                        m_kineticReactionRates.toView(),
+                        m_speciationWarmStart != 0,
+                        m_speciationSkipTolerance );
 }
 
 template< typename PHASE >
@@ -263,7 +265,9 @@ ReactiveBrineFluid< PHASE > ::KernelWrapper::
                  arrayView2d< real64, compflow::USD_COMP > const & primarySpeciesConcentration,
                  arrayView2d< real64, compflow::USD_COMP > const & secondarySpeciesConcentration,
                  arrayView2d< real64, compflow::USD_COMP > const & primarySpeciesTotalConcentration,
-                 arrayView2d< real64, compflow::USD_COMP > const & kineticReactionRates )
+                 arrayView2d< real64, compflow::USD_COMP > const & kineticReactionRates,
+                 bool const useSpeciationWarmStart,
+                 real64 const speciationSkipTolerance )
   : ReactiveMultiFluid::KernelWrapper( std::move( componentMolarWeight ),
                                        useMass,
                                        std::move( phaseFraction ),
@@ -280,7 +284,9 @@ ReactiveBrineFluid< PHASE > ::KernelWrapper::
                                        primarySpeciesConcentration,
                                        secondarySpeciesConcentration,
                                        primarySpeciesTotalConcentration,
-                                       kineticReactionRates ),
+                                       kineticReactionRates,
+                                       useSpeciationWarmStart,
+                                       speciationSkipTolerance ),
   m_isThermal( isThermal ),
   m_phase( phase.createKernelWrapper() )
 {}
@@ -105,7 +105,8 @@ public:
                          real64 const temperature,
                          arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const override;
 
-    virtual void updateChemistry( localIndex const k,
+    GEOS_HOST_DEVICE
+    virtual bool updateChemistry( localIndex const k,
                                   localIndex const q,
                                   real64 const pressure,
                                   real64 const temperature,
@@ -133,7 +134,9 @@ private:
                    arrayView2d< real64, compflow::USD_COMP > const & primarySpeciesConcentration,
                    arrayView2d< real64, compflow::USD_COMP > const & secondarySpeciesConcentration,
                    arrayView2d< real64, compflow::USD_COMP > const & primarySpeciesTotalConcentration,
-                   arrayView2d< real64, compflow::USD_COMP > const & kineticReactionRates );
+                   arrayView2d< real64, compflow::USD_COMP > const & kineticReactionRates,
+                   bool const useSpeciationWarmStart,
+                   real64 const speciationSkipTolerance );
 
 
     /// Flag to specify whether the model is thermal or not
@@ -359,7 +362,7 @@ ReactiveBrineFluid< PHASE >::KernelWrapper::
 }
 
 template< typename PHASE >
-inline void
+GEOS_HOST_DEVICE inline bool
 ReactiveBrineFluid< PHASE >::KernelWrapper::
   updateChemistry( localIndex const k,
                    localIndex const q,
@@ -370,12 +373,35 @@ ReactiveBrineFluid< PHASE >::KernelWrapper::
 {
   real64 const totalMolecularWeight = PVTProps::PureWaterProperties::MOLECULAR_WEIGHT;
 
+  stackArray1d< real64, chemicalReactions::ReactionsBase::maxNumPrimarySpecies > totalConcentration( m_numPrimarySpecies );
   convertMoleFractionToMolarity( m_totalDensity( k, q ).value,
                                  totalMolecularWeight,
                                  composition,
-                                 m_primarySpeciesTotalConcentration[k] );
+                                 totalConcentration );
+
+  // the stored total concentrations are those of the previous solve, and the equilibrium constants
+  // do not depend on pressure and temperature, so the previous speciation is kept if they barely changed
+  if( m_speciationSkipTolerance > 0.0 )
+  {
+    bool skip = true;
+    for( integer i = 0; i < m_numPrimarySpecies && skip; ++i )
+    {
+      real64 const previousTotalConcentration = m_primarySpeciesTotalConcentration[k][i];
+      skip = previousTotalConcentration > 0.0 && m_primarySpeciesConcentration[k][i] > 0.0 &&
+             LvArray::math::abs( totalConcentration[i] - previousTotalConcentration ) <= m_speciationSkipTolerance * previousTotalConcentration;
+    }
+    if( skip )
+    {
+      return true;
+    }
+  }
+
+  for( integer i = 0; i < m_numPrimarySpecies; ++i )
+  {
+    m_primarySpeciesTotalConcentration[k][i] = totalConcentration[i];
+  }
 
-  computeChemistry( pressure,
+  return computeChemistry( pressure,
                     temperature,
                     m_primarySpeciesTotalConcentration[k],
                     m_primarySpeciesConcentration[k],
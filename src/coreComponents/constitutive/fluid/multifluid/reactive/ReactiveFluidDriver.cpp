@@ -253,7 +253,8 @@ void ReactiveFluidDriver::runTest( FLUID_TYPE & fluid, arrayView2d< real64 > con
   {
     for( integer n = 0; n <= numSteps; ++n )
     {
-      kernelWrapper.updateChemistry( ei, 0, table( n, PRES ), table( n, TEMP ), composition[0] );
+      bool const converged = kernelWrapper.updateChemistry( ei, 0, table( n, PRES ), table( n, TEMP ), composition[0] );
+      GEOS_ERROR_IF( !converged, "Equilibrium reactions did not converge." );
       for( integer p=0; p<numPrimarySpecies; ++p )
       {
         table( n, TEMP+1+p ) = primarySpeciesConcentration( ei, p );
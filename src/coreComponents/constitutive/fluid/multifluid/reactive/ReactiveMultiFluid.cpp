@@ -29,7 +29,9 @@ namespace constitutive
 
 ReactiveMultiFluid::
   ReactiveMultiFluid( string const & name, Group * const parent ):
-  MultiFluidBase( name, parent )
+  MultiFluidBase( name, parent ),
+  m_speciationWarmStart( 1 ),
+  m_speciationSkipTolerance( 0.0 )
 {
   // For now this is being hardcoded. We will see where this should come from.
   m_numPrimarySpecies = 7;
@@ -40,6 +42,17 @@ ReactiveMultiFluid::
   registerField( fields::reactivefluid::secondarySpeciesConcentration{}, &m_secondarySpeciesConcentration );
   registerField( fields::reactivefluid::primarySpeciesTotalConcentration{}, &m_primarySpeciesTotalConcentration );
   registerField( fields::reactivefluid::kineticReactionRates{}, &m_kineticReactionRates );
+
+  registerWrapper( viewKeyStruct::speciationWarmStartString(), &m_speciationWarmStart ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1 ).
+    setDescription( "Flag (0 or 1) to start the equilibrium speciation solve of a cell from its concentrations of the previous solve" );
+
+  registerWrapper( viewKeyStruct::speciationSkipToleranceString(), &m_speciationSkipTolerance ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Relative change of the total concentrations of a cell since its previous solve below which the equilibrium "
+                    "speciation solve is skipped (0 to always solve)" );
 }
 
 bool ReactiveMultiFluid::isThermal() const
@@ -67,6 +80,14 @@ void ReactiveMultiFluid::postProcessInput()
                         GEOS_FMT( "{}: invalid number of phases", getFullName() ),
                         InputError );
 
+  GEOS_THROW_IF( m_speciationWarmStart != 0 && m_speciationWarmStart != 1,
+                 GEOS_FMT( "{}: invalid {} option - must be 0 or 1", getFullName(), viewKeyStruct::speciationWarmStartString() ),
+                 InputError );
+
+  GEOS_THROW_IF_LT_MSG( m_speciationSkipTolerance, 0.0,
+                        GEOS_FMT( "{}: {} must be non-negative", getFullName(), viewKeyStruct::speciationSkipToleranceString() ),
+                        InputError );
+
   createChemicalReactions();
 }
 
@@ -71,14 +71,24 @@ public:
 
 public:
 
-    void computeChemistry( real64 const pressure,
+    /**
+     * @brief Solve the equilibrium reactions and compute the kinetic reaction rates of a cell.
+     * @return true if the equilibrium reactions converged
+     */
+    GEOS_HOST_DEVICE
+    bool computeChemistry( real64 const pressure,
                            real64 const temperature,
                            arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
                            arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
                            arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
                            arraySlice1d< real64, compflow::USD_COMP - 1 > const & kineticReactionRates ) const;
 
-    virtual void updateChemistry( localIndex const k,
+    /**
+     * @brief Update the speciation of a cell, one cell per thread when called in a kernel.
+     * @return true if the equilibrium reactions converged, or if the solve was skipped
+     */
+    GEOS_HOST_DEVICE
+    virtual bool updateChemistry( localIndex const k,
                                   localIndex const q,
                                   real64 const pressure,
                                   real64 const temperature,
@@ -105,6 +115,8 @@ public:
      * @param secondarySpeciesConcentration
      * @param primarySpeciesTotalConcentration
      * @param kineticReactionRates
+     * @param useSpeciationWarmStart
+     * @param speciationSkipTolerance
      */
     KernelWrapper( arrayView1d< real64 const > componentMolarWeight,
                    bool const useMass,
@@ -122,7 +134,9 @@ public:
                    arrayView2d< real64, compflow::USD_COMP > const & primarySpeciesConcentration,
                    arrayView2d< real64, compflow::USD_COMP > const & secondarySpeciesConcentration,
                    arrayView2d< real64, compflow::USD_COMP > const & primarySpeciesTotalConcentration,
-                   arrayView2d< real64, compflow::USD_COMP > const & kineticReactionRates ):
+                   arrayView2d< real64, compflow::USD_COMP > const & kineticReactionRates,
+                   bool const useSpeciationWarmStart,
+                   real64 const speciationSkipTolerance ):
       MultiFluidBase::KernelWrapper( std::move( componentMolarWeight ),
                                      useMass,
                                      std::move( phaseFraction ),
@@ -139,11 +153,14 @@ public:
       m_primarySpeciesConcentration( primarySpeciesConcentration ),
       m_secondarySpeciesConcentration( secondarySpeciesConcentration ),
       m_primarySpeciesTotalConcentration( primarySpeciesTotalConcentration ),
-      m_kineticReactionRates( kineticReactionRates )
+      m_kineticReactionRates( kineticReactionRates ),
+      m_useSpeciationWarmStart( useSpeciationWarmStart ),
+      m_speciationSkipTolerance( speciationSkipTolerance )
     {}
 
 protected:
 
+    GEOS_HOST_DEVICE
     void convertMoleFractionToMolarity( real64 const totalDensity,
                                         real64 const totalMolecularWeight,
                                         arraySlice1d< geos::real64 const, compflow::USD_COMP - 1 > const & composition,
@@ -164,10 +181,19 @@ protected:
     arrayView2d< real64, compflow::USD_COMP >  m_primarySpeciesTotalConcentration;
 
     arrayView2d< real64, compflow::USD_COMP >  m_kineticReactionRates;
+
+    /// Flag to start the equilibrium solve from the concentrations of the previous solve
+    bool m_useSpeciationWarmStart;
+
+    /// Relative change of the total concentrations below which the equilibrium solve is skipped
+    real64 m_speciationSkipTolerance;
   };
 
   struct viewKeyStruct : ConstitutiveBase::viewKeyStruct
-  {};
+  {
+    static constexpr char const * speciationWarmStartString() { return "speciationWarmStart"; }
+    static constexpr char const * speciationSkipToleranceString() { return "speciationSkipTolerance"; }
+  };
 
 protected:
 
@@ -195,9 +221,16 @@ protected:
   array2d< real64, multifluid::LAYOUT_FLUID >  m_primarySpeciesTotalConcentration;
 
   array2d< real64, multifluid::LAYOUT_FLUID >  m_kineticReactionRates;
+
+  /// Flag to start the equilibrium solve from the concentrations of the previous solve
+  integer m_speciationWarmStart;
+
+  /// Relative change of the total concentrations below which the equilibrium solve is skipped
+  real64 m_speciationSkipTolerance;
 };
 
-inline void
+GEOS_HOST_DEVICE
+inline bool
 ReactiveMultiFluid::KernelWrapper::
   computeChemistry( real64 const pressure,
                     real64 const temperature,
@@ -209,19 +242,25 @@ ReactiveMultiFluid::KernelWrapper::
   GEOS_UNUSED_VAR( pressure );
 
   // 2. solve for equilibrium
-  m_equilibriumReactions.updateConcentrations( temperature,
-                                               primarySpeciesTotalConcentration,
-                                               primarySpeciesConcentration,
-                                               secondarySpeciesConcentration );
+  bool const converged = m_equilibriumReactions.updateConcentrations( temperature,
+                                                                      primarySpeciesTotalConcentration,
+                                                                      primarySpeciesConcentration,
+                                                                      secondarySpeciesConcentration,
+                                                                      m_useSpeciationWarmStart );
+  if( !converged )
+  {
+    return false;
+  }
 
   // 3. compute kinetic reaction rates
   m_kineticReactions.computeReactionRates( temperature,
                                            primarySpeciesConcentration,
                                            secondarySpeciesConcentration,
                                            kineticReactionRates );
+  return true;
 }
 
-
+GEOS_HOST_DEVICE
 inline void
 ReactiveMultiFluid::KernelWrapper::
   convertMoleFractionToMolarity( real64 const totalDensity,
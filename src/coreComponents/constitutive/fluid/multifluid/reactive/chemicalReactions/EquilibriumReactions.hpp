@@ -21,8 +21,10 @@
 
 #include "ReactionsBase.hpp"
 
+#include "codingUtilities/Utilities.hpp"
 #include "constitutive/fluid/multifluid/Layouts.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidConstants.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
 
 namespace geos
 {
@@ -68,25 +70,35 @@ public:
     {}
 
     /**
-     * @brief Construct a new update Concentrations object
+     * @brief Solve the equilibrium reactions of a cell for the concentrations of the species.
      *
-     * @param temperature
-     * @param totalConc
-     * @param dLog10PrimaryConc_dTotalConc
+     * @param temperature the temperature
+     * @param primarySpeciesTotalConcentration the total concentration of the primary species
+     * @param primarySpeciesConcentration the concentration of the primary species, used as initial guess if @p useWarmStart
+     * @param secondarySpeciesConcentration the concentration of the secondary species
+     * @param useWarmStart flag to start the Newton iterations from the concentrations of the previous solve when they are valid
+     * @return true if the Newton iterations converged
+     *
+     * @details The system of a cell is solved with the fixed-size dense solver, so that the cells can be
+     * processed in a batch, one cell per thread, on the host or on the device.
      */
-    void updateConcentrations( real64 const temperature,
+    GEOS_HOST_DEVICE
+    bool updateConcentrations( real64 const temperature,
                                arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
-                               arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesContentration,
-                               arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration ) const;
+                               arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                               arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
+                               bool const useWarmStart ) const;
 private:
 
+    GEOS_HOST_DEVICE
     void assembleEquilibriumReactionSystem( real64 const temperature,
                                             arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
                                             arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
                                             arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
-                                            arraySlice2d< real64 > const & matrix,
-                                            arraySlice1d< real64 > const & rhs ) const;
+                                            real64 ( &matrix )[ReactionsBase::maxNumPrimarySpecies][ReactionsBase::maxNumPrimarySpecies],
+                                            real64 ( &rhs )[ReactionsBase::maxNumPrimarySpecies] ) const;
 
+    GEOS_HOST_DEVICE
     void computeSeondarySpeciesConcAndDerivative( real64 const temperature,
                                                   arraySlice1d< real64 const > const & log10PrimaryActCoeff,
                                                   arraySlice1d< real64 const > const & dLog10PrimaryActCoeff_dIonicStrength,
@@ -96,6 +108,7 @@ private:
                                                   arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
                                                   arraySlice2d< real64 > const & dLog10SecConc_dLog10PrimaryConc ) const;
 
+    GEOS_HOST_DEVICE
     void computeTotalConcAndDerivative( real64 const temperature,
                                         arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
                                         arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
@@ -103,9 +116,11 @@ private:
                                         arraySlice1d< real64 > const & totalConc,
                                         arraySlice2d< real64 > const & dTotalConc_dLog10PrimaryConc ) const;
 
-    void updatePrimarySpeciesConcentrations( arraySlice1d< real64 const > const solution,
+    GEOS_HOST_DEVICE
+    void updatePrimarySpeciesConcentrations( real64 const ( &solution )[ReactionsBase::maxNumPrimarySpecies],
                                              arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration ) const;
 
+    GEOS_HOST_DEVICE
     void setInitialGuess( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
                           arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration ) const;
 
@@ -121,6 +136,261 @@ private:
 
 };
 
+GEOS_HOST_DEVICE
+inline void
+EquilibriumReactions::KernelWrapper::assembleEquilibriumReactionSystem( real64 const temperature,
+                                                                        arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
+                                                                        arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                                                                        arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
+                                                                        real64 ( & matrix )[ReactionsBase::maxNumPrimarySpecies][ReactionsBase::maxNumPrimarySpecies],
+                                                                        real64 ( & rhs )[ReactionsBase::maxNumPrimarySpecies] ) const
+{
+
+  stackArray1d< real64, ReactionsBase::maxNumPrimarySpecies > log10PrimaryActCoeff( m_numPrimarySpecies );
+  stackArray1d< real64, ReactionsBase::maxNumSecondarySpecies > log10SecActCoeff( m_numSecondarySpecies );
+  stackArray2d< real64, ReactionsBase::maxNumSecondarySpecies * ReactionsBase::maxNumPrimarySpecies > dLog10SecConc_dLog10PrimaryConc( m_numSecondarySpecies, m_numPrimarySpecies );
+  stackArray1d< real64, ReactionsBase::maxNumPrimarySpecies > totalConcentration( m_numPrimarySpecies );
+  stackArray2d< real64, ReactionsBase::maxNumPrimarySpecies * ReactionsBase::maxNumPrimarySpecies > dTotalConc_dLog10PrimaryConc( m_numPrimarySpecies, m_numPrimarySpecies );
+
+  real64 ionicStrength = 0.0;
+  stackArray1d< real64, ReactionsBase::maxNumPrimarySpecies > dLog10PrimaryActCoeff_dIonicStrength( m_numPrimarySpecies );
+  stackArray1d< real64, ReactionsBase::maxNumSecondarySpecies > dLog10SecActCoeff_dIonicStrength( m_numSecondarySpecies );
+
+  /// activity coefficients
+  computeIonicStrength( primarySpeciesConcentration,
+                        secondarySpeciesConcentration,
+                        ionicStrength );
+
+  computeLog10ActCoefBDotModel( temperature,
+                                ionicStrength,
+                                log10PrimaryActCoeff,
+                                dLog10PrimaryActCoeff_dIonicStrength,
+                                log10SecActCoeff,
+                                dLog10SecActCoeff_dIonicStrength );
+
+  computeSeondarySpeciesConcAndDerivative( temperature,
+                                           log10PrimaryActCoeff,
+                                           dLog10PrimaryActCoeff_dIonicStrength,
+                                           log10SecActCoeff,
+                                           dLog10SecActCoeff_dIonicStrength,
+                                           primarySpeciesConcentration,
+                                           secondarySpeciesConcentration,
+                                           dLog10SecConc_dLog10PrimaryConc );
+
+  computeTotalConcAndDerivative( temperature,
+                                 primarySpeciesConcentration,
+                                 secondarySpeciesConcentration,
+                                 dLog10SecConc_dLog10PrimaryConc,
+                                 totalConcentration,
+                                 dTotalConc_dLog10PrimaryConc );
+
+  for( int i=0; i<m_numPrimarySpecies; i++ )
+  {
+    rhs[i] = 1 - totalConcentration[i] / primarySpeciesTotalConcentration[i];
+    rhs[i] = -rhs[i];
+    for( int j=0; j<m_numPrimarySpecies; j++ )
+    {
+      matrix[i][j] = -dTotalConc_dLog10PrimaryConc( i, j ) / primarySpeciesTotalConcentration[i];
+    }
+  }
+}
+
+GEOS_HOST_DEVICE
+inline bool
+EquilibriumReactions::KernelWrapper::updateConcentrations( real64 const temperature,
+                                                           arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
+                                                           arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                                                           arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
+                                                           bool const useWarmStart ) const
+
+{
+  // the system is solved with the fixed size of the largest reaction network, the unused
+  // unknowns being decoupled by an identity block
+  constexpr integer maxSize = ReactionsBase::maxNumPrimarySpecies;
+  real64 matrix[maxSize][maxSize]{};
+  real64 rhs[maxSize]{};
+  real64 solution[maxSize]{};
+
+  // the concentrations of the previous solve are a valid initial guess if they are all positive
+  bool warmStart = useWarmStart;
+  for( integer i = 0; i < m_numPrimarySpecies && warmStart; i++ )
+  {
+    warmStart = primarySpeciesConcentration[i] > 0.0;
+  }
+  for( integer i = 0; i < m_numSecondarySpecies && warmStart; i++ )
+  {
+    warmStart = secondarySpeciesConcentration[i] > 0.0;
+  }
+  if( !warmStart )
+  {
+    setInitialGuess( primarySpeciesTotalConcentration, primarySpeciesConcentration );
+  }
+
+  for( int iteration = 0; iteration < m_maxNumIterations; iteration++ )
+  {
+    for( integer i = 0; i < maxSize; i++ )
+    {
+      rhs[i] = 0.0;
+      for( integer j = 0; j < maxSize; j++ )
+      {
+        matrix[i][j] = ( i == j && i >= m_numPrimarySpecies ) ? 1.0 : 0.0;
+      }
+    }
+
+    assembleEquilibriumReactionSystem( temperature,
+                                       primarySpeciesTotalConcentration,
+                                       primarySpeciesConcentration,
+                                       secondarySpeciesConcentration,
+                                       matrix,
+                                       rhs );
+
+    real64 residualNorm = 0.0;
+    for( integer i = 0; i < m_numPrimarySpecies; i++ )
+    {
+      residualNorm += rhs[i] * rhs[i];
+    }
+    residualNorm = sqrt( residualNorm );
+
+    // the secondary concentrations of a cold start are only consistent after the first update,
+    // while those of a warm start come from a converged solve
+    if( residualNorm < m_newtonTol && ( iteration >= 1 || warmStart ) )
+    {
+      return true;
+    }
+
+    if( !denseLinearAlgebra::solve< maxSize >( matrix, rhs, solution ) )
+    {
+      return false;
+    }
+
+    updatePrimarySpeciesConcentrations( solution, primarySpeciesConcentration );
+  }
+  return false;
+}
+
+// function to compute the derivative of the concentration of secondary species with respect to the concentration of the primary species.
+GEOS_HOST_DEVICE
+inline void
+EquilibriumReactions::KernelWrapper::computeSeondarySpeciesConcAndDerivative( real64 const temperature,
+                                                                              arraySlice1d< real64 const > const & log10PrimaryActCoeff,
+                                                                              arraySlice1d< real64 const > const & dLog10PrimaryActCoeff_dIonicStrength,
+                                                                              arraySlice1d< real64 const > const & log10SecActCoeff,
+                                                                              arraySlice1d< real64 const > const & dLog10SecActCoeff_dIonicStrength,
+                                                                              arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                                                                              arraySlice1d< real64, compflow::USD_COMP - 1 > const & secondarySpeciesConectration,
+                                                                              arraySlice2d< real64 > const & dLog10SecConc_dLog10PrimaryConc ) const
+{
+  GEOS_UNUSED_VAR( temperature );
+
+  real64 const ln10 = log( 10.0 );
+
+  // quantities of the primary species shared by all the secondary species
+  real64 log10PrimaryActivity[ReactionsBase::maxNumPrimarySpecies]{};
+  real64 dIonicStrength_dLog10PrimaryConc[ReactionsBase::maxNumPrimarySpecies]{};
+  for( int jPri = 0; jPri < m_numPrimarySpecies; jPri++ )
+  {
+    log10PrimaryActivity[jPri] = log10( primarySpeciesConcentration[jPri] ) + log10PrimaryActCoeff[jPri];
+    dIonicStrength_dLog10PrimaryConc[jPri] = ln10 * 0.5 * m_chargePrimary[jPri] * m_chargePrimary[jPri] * primarySpeciesConcentration[jPri];
+  }
+
+  // Compute d(concentration of dependent species)/d(concentration of basis species)
+  for( int iSec = 0; iSec < m_numSecondarySpecies; iSec++ )
+  {
+    real64 log10SecConc = -m_log10EqConst[iSec] - log10SecActCoeff[iSec];
+
+    // contribution to the derivative from all primary activity coefficients, which does not depend on jPri
+    real64 dLog10SecActivity_dIonicStrength = -dLog10SecActCoeff_dIonicStrength[iSec];
+    for( int kDerivative = 0; kDerivative < m_numPrimarySpecies; kDerivative++ )
+    {
+      dLog10SecActivity_dIonicStrength += m_stoichMatrix[iSec][kDerivative] * dLog10PrimaryActCoeff_dIonicStrength[kDerivative];
+    }
+
+    for( int jPri = 0; jPri < m_numPrimarySpecies; jPri++ )
+    {
+      log10SecConc += m_stoichMatrix[iSec][jPri] * log10PrimaryActivity[jPri];
+      dLog10SecConc_dLog10PrimaryConc[iSec][jPri] = m_stoichMatrix[iSec][jPri] + dLog10SecActivity_dIonicStrength * dIonicStrength_dLog10PrimaryConc[jPri];
+    }
+    secondarySpeciesConectration[iSec] = pow( 10, log10SecConc );
+  }
+
+}
+
+GEOS_HOST_DEVICE
+inline void
+EquilibriumReactions::KernelWrapper::computeTotalConcAndDerivative( real64 const temperature,
+                                                                    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                                                                    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConectration,
+                                                                    arraySlice2d< real64 const > const & dLog10SecConc_dLog10PrimaryConc,
+                                                                    arraySlice1d< real64 > const & totalConc,
+                                                                    arraySlice2d< real64 > const & dTotalConc_dLog10PrimaryConc ) const
+
+
+{
+  GEOS_UNUSED_VAR( temperature );
+
+  real64 const ln10 = log( 10.0 );
+
+  // This function computes the total concentration and its derivative with respect to log10(basis species concentrations).
+  for( int iPri = 0; iPri < m_numPrimarySpecies; iPri++ )
+  {
+    totalConc[iPri] = primarySpeciesConcentration[iPri];
+    // d(total concentration)/d(log10(concentration))
+    for( int kDerivative = 0; kDerivative < m_numPrimarySpecies; kDerivative++ )
+    {
+      dTotalConc_dLog10PrimaryConc[iPri][kDerivative] = 0.0;
+    }
+    dTotalConc_dLog10PrimaryConc[iPri][iPri] = ln10 * primarySpeciesConcentration[iPri];
+    // contribution from all dependent species
+    for( int jSec = 0; jSec < m_numSecondarySpecies; jSec++ )
+    {
+      // the stoichiometric matrix is sparse
+      if( isZero( m_stoichMatrix[jSec][iPri] ) )
+      {
+        continue;
+      }
+      real64 const stoichSecConc = m_stoichMatrix[jSec][iPri] * secondarySpeciesConectration[jSec];
+      totalConc[iPri] += stoichSecConc;
+      for( int kDerivative = 0; kDerivative < m_numPrimarySpecies; kDerivative++ )
+      {
+        // add contribution to the derivtive from dependent species via the chain rule
+        dTotalConc_dLog10PrimaryConc[iPri][kDerivative] += ln10 * stoichSecConc * dLog10SecConc_dLog10PrimaryConc[jSec][kDerivative];
+      }
+    }
+  }
+}
+
+GEOS_HOST_DEVICE
+inline void
+EquilibriumReactions::KernelWrapper::
+  updatePrimarySpeciesConcentrations( real64 const ( &solution )[ReactionsBase::maxNumPrimarySpecies],
+                                      arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration ) const
+{
+  for( integer i = 0; i < m_numPrimarySpecies; i++ )
+  {
+    primarySpeciesConcentration[i] *= pow( 10, solution[i] );
+  }
+}
+
+GEOS_HOST_DEVICE
+inline void
+EquilibriumReactions::KernelWrapper::setInitialGuess( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesTotalConcentration,
+                                                      arraySlice1d< real64, compflow::USD_COMP - 1 > const & primarySpeciesConcentration ) const
+{
+  for( integer i = 0; i < m_numPrimarySpecies; i++ )
+  {
+    primarySpeciesConcentration[i] = primarySpeciesTotalConcentration[i];
+  }
+  real64 const hPlusConcentration = 2*primarySpeciesConcentration[2]-2*primarySpeciesConcentration[3]-primarySpeciesConcentration[4]+2*primarySpeciesConcentration[5]+primarySpeciesConcentration[6];
+  if( hPlusConcentration < 0 )
+  {
+    primarySpeciesConcentration[0] = -hPlusConcentration;
+  }
+  else
+  {
+    primarySpeciesConcentration[0] = 1e-7;
+  }
+
+}
 
 } // end namespace chemicalReactions
 
@@ -84,6 +84,7 @@ public:
      * @param specificSurfaceArea the surface area available per unit volume
      * @param reactionRates
      */
+    GEOS_HOST_DEVICE
     void computeReactionRates( real64 const & temperature,
                                arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
                                arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
@@ -114,6 +115,56 @@ private:
   real64 m_specificSurfaceArea;
 };
 
+GEOS_HOST_DEVICE
+inline void
+KineticReactions::KernelWrapper::computeReactionRates( real64 const & temperature,
+                                                       arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                                                       arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
+                                                       arraySlice1d< real64, compflow::USD_COMP - 1 > const & reactionRates ) const
+{
+  /// 1. Create local vectors
+  stackArray1d< real64, ReactionsBase::maxNumPrimarySpecies > log10PrimaryActCoeff( m_numPrimarySpecies );
+  stackArray1d< real64, ReactionsBase::maxNumSecondarySpecies > log10SecActCoeff( m_numSecondarySpecies );
+
+  real64 ionicStrength = 0.0;
+  stackArray1d< real64, ReactionsBase::maxNumPrimarySpecies > dIonicStrength_dPrimaryConcentration( m_numPrimarySpecies );
+  stackArray1d< real64, ReactionsBase::maxNumPrimarySpecies > dLog10PrimaryActCoeff_dIonicStrength( m_numPrimarySpecies );
+  stackArray1d< real64, ReactionsBase::maxNumSecondarySpecies > dLog10SecActCoeff_dIonicStrength( m_numSecondarySpecies );
+
+  /// 2. Compute activity coefficients
+  computeIonicStrength( primarySpeciesConcentration,
+                        secondarySpeciesConcentration,
+                        ionicStrength );
+
+  computeLog10ActCoefBDotModel( temperature,
+                                ionicStrength,
+                                log10PrimaryActCoeff,
+                                dLog10PrimaryActCoeff_dIonicStrength,
+                                log10SecActCoeff,
+                                dLog10SecActCoeff_dIonicStrength );
+
+
+  /// 3. Compute the log10 of the activities, shared by all the reactions
+  real64 log10PrimaryActivity[ReactionsBase::maxNumPrimarySpecies]{};
+  for( int iPri = 0; iPri < m_numPrimarySpecies; ++iPri )
+  {
+    log10PrimaryActivity[iPri] = log10( primarySpeciesConcentration[iPri] ) + log10PrimaryActCoeff[iPri];
+  }
+
+  /// 4. Compute reaction rates
+  for( int iRxn = 0; iRxn < m_numKineticReactions; iRxn++ )
+  {
+    real64 saturationIndex = -m_log10EqConst[iRxn];
+
+    for( int iPri = 0; iPri < m_numPrimarySpecies; ++iPri )
+    {
+      saturationIndex += m_stoichMatrix[iRxn][iPri] * log10PrimaryActivity[iPri];
+    }
+
+    reactionRates[iRxn] = m_specificSurfaceArea * (1.0 - pow( 10, saturationIndex ) ) * m_reactionRateConstant[iRxn];
+  }
+}
+
 } // end namespace chemicalReactions
 
 } // end namespace constitutive
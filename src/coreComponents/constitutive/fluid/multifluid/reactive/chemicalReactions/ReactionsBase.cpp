@@ -87,63 +87,6 @@ ReactionsBase::ReactionsBase( string const & name, integer const numPrimarySpeci
 
 }
 
-void ReactionsBase::KernelWrapper::computeLog10ActCoefBDotModel( real64 const temperature,
-                                                                 real64 const ionicStrength,
-                                                                 arraySlice1d< real64 > const & log10PrimaryActCoeff,
-                                                                 arraySlice1d< real64 > const & dLog10PrimaryActCoeff_dIonicStrength,
-                                                                 arraySlice1d< real64 > const & log10SecActCoeff,
-                                                                 arraySlice1d< real64 > const & dLog10SecActCoeff_dIonicStrength ) const
-{
-  // Compute log10(ActivityCoefficient) for basis and dependent species along with their
-  // derivatives with respect to Ionic strength using the B-Dot Model
-  // which is the same as the Extended Debye-Huckel model in GEOS.
-  // localIndex const NBasis = m_numPrimarySpecies;
-  // localIndex const NDependent = m_numSecondarySpecies;
-
-  GEOS_UNUSED_VAR( temperature );
-
-  for( localIndex i = 0; i < m_numPrimarySpecies; ++i )
-  {
-    log10PrimaryActCoeff[i] = m_WATEQBDot * ionicStrength - m_DebyeHuckelA * m_chargePrimary[i] * m_chargePrimary[i] * sqrt( ionicStrength ) /
-                              (1.0 + m_ionSizePrimary[i] * m_DebyeHuckelB * sqrt( ionicStrength ));
-    dLog10PrimaryActCoeff_dIonicStrength[i] = m_WATEQBDot - m_DebyeHuckelA * m_chargePrimary[i] * m_chargePrimary[i] *
-                                              (0.5 / sqrt( ionicStrength ) / (1.0 + m_ionSizePrimary[i] * m_DebyeHuckelB * sqrt( ionicStrength )) - 0.5 * m_ionSizePrimary[i] * m_DebyeHuckelB /
-                                               (1.0 + m_ionSizePrimary[i] * m_DebyeHuckelB * sqrt( ionicStrength )) /
-                                               (1.0 + m_ionSizePrimary[i] * m_DebyeHuckelB * sqrt( ionicStrength )));
-//    log10PrimaryActCoeff[i] = 0;
-//    dLog10PrimaryActCoeff_dIonicStrength[i] = 0;
-  }
-  for( localIndex i = 0; i < m_numSecondarySpecies; ++i )
-  {
-    log10SecActCoeff[i] = m_WATEQBDot * ionicStrength - m_DebyeHuckelA * m_chargeSec[i] * m_chargeSec[i] * sqrt( ionicStrength ) /
-                          (1.0 + m_ionSizeSec[i] * m_DebyeHuckelB * sqrt( ionicStrength ));
-    dLog10SecActCoeff_dIonicStrength[i] = m_WATEQBDot - m_DebyeHuckelA * m_chargeSec[i] * m_chargeSec[i] *
-                                          (0.5 / sqrt( ionicStrength ) / (1.0 + m_ionSizeSec[i] * m_DebyeHuckelB * sqrt( ionicStrength )) - 0.5 * m_ionSizeSec[i] * m_DebyeHuckelB /
-                                           (1.0 + m_ionSizeSec[i] * m_DebyeHuckelB * sqrt( ionicStrength )) /
-                                           (1.0 + m_ionSizeSec[i] * m_DebyeHuckelB * sqrt( ionicStrength )));
-//    log10SecActCoeff[i] = 0;
-//    dLog10SecActCoeff_dIonicStrength[i] = 0;
-  }
-}
-
-void ReactionsBase::KernelWrapper::computeIonicStrength( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
-                                                         arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
-                                                         real64 & ionicStrength ) const
-{
-  //get ionic strength
-  ionicStrength = 0.0;
-  // Primary species
-  for( localIndex i = 0; i < m_numPrimarySpecies; ++i )
-  {
-    ionicStrength += 0.5 * m_chargePrimary[i] * m_chargePrimary[i] * primarySpeciesConcentration[i];
-  }
-  // Secondary species
-  for( int j = 0; j < m_numSecondarySpecies; ++j )
-  {
-    ionicStrength += 0.5 * m_chargeSec[j] * m_chargeSec[j] * secondarySpeciesConcentration[j];
-  }
-}
-
 } // end namespace chemicalReactions
 
 } // namespace constitutive
@@ -20,6 +20,7 @@
 #define GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_REACTIVE_CHEMICALREACTIONS_REACTIONSBASE_HPP_
 
 #include "dataRepository/ObjectCatalog.hpp"
+#include "constitutive/fluid/multifluid/Layouts.hpp"
 
 namespace geos
 {
@@ -124,6 +125,7 @@ protected:
      * @param log10SecActCoeff
      * @param dLog10SecActCoeff_dIonicStrength
      */
+    GEOS_HOST_DEVICE
     void computeLog10ActCoefBDotModel( real64 const temperature,
                                        real64 const ionicStrength,
                                        arraySlice1d< real64 > const & log10PrimaryActCoeff,
@@ -135,6 +137,7 @@ protected:
      *
      * @return
      */
+    GEOS_HOST_DEVICE
     void computeIonicStrength( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
                                arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
                                real64 & ionicStrength ) const;
@@ -160,6 +163,59 @@ protected:
 
 };
 
+GEOS_HOST_DEVICE
+inline void
+ReactionsBase::KernelWrapper::computeLog10ActCoefBDotModel( real64 const temperature,
+                                                           real64 const ionicStrength,
+                                                           arraySlice1d< real64 > const & log10PrimaryActCoeff,
+                                                           arraySlice1d< real64 > const & dLog10PrimaryActCoeff_dIonicStrength,
+                                                           arraySlice1d< real64 > const & log10SecActCoeff,
+                                                           arraySlice1d< real64 > const & dLog10SecActCoeff_dIonicStrength ) const
+{
+  // Compute log10(ActivityCoefficient) for basis and dependent species along with their
+  // derivatives with respect to Ionic strength using the B-Dot Model
+  // which is the same as the Extended Debye-Huckel model in GEOS.
+
+  GEOS_UNUSED_VAR( temperature );
+
+  real64 const sqrtIonicStrength = sqrt( ionicStrength );
+
+  for( localIndex i = 0; i < m_numPrimarySpecies; ++i )
+  {
+    real64 const denominator = 1.0 + m_ionSizePrimary[i] * m_DebyeHuckelB * sqrtIonicStrength;
+    log10PrimaryActCoeff[i] = m_WATEQBDot * ionicStrength - m_DebyeHuckelA * m_chargePrimary[i] * m_chargePrimary[i] * sqrtIonicStrength / denominator;
+    dLog10PrimaryActCoeff_dIonicStrength[i] = m_WATEQBDot - m_DebyeHuckelA * m_chargePrimary[i] * m_chargePrimary[i] *
+                                              (0.5 / sqrtIonicStrength / denominator - 0.5 * m_ionSizePrimary[i] * m_DebyeHuckelB / denominator / denominator);
+  }
+  for( localIndex i = 0; i < m_numSecondarySpecies; ++i )
+  {
+    real64 const denominator = 1.0 + m_ionSizeSec[i] * m_DebyeHuckelB * sqrtIonicStrength;
+    log10SecActCoeff[i] = m_WATEQBDot * ionicStrength - m_DebyeHuckelA * m_chargeSec[i] * m_chargeSec[i] * sqrtIonicStrength / denominator;
+    dLog10SecActCoeff_dIonicStrength[i] = m_WATEQBDot - m_DebyeHuckelA * m_chargeSec[i] * m_chargeSec[i] *
+                                          (0.5 / sqrtIonicStrength / denominator - 0.5 * m_ionSizeSec[i] * m_DebyeHuckelB / denominator / denominator);
+  }
+}
+
+GEOS_HOST_DEVICE
+inline void
+ReactionsBase::KernelWrapper::computeIonicStrength( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & primarySpeciesConcentration,
+                                                   arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & secondarySpeciesConcentration,
+                                                   real64 & ionicStrength ) const
+{
+  //get ionic strength
+  ionicStrength = 0.0;
+  // Primary species
+  for( localIndex i = 0; i < m_numPrimarySpecies; ++i )
+  {
+    ionicStrength += 0.5 * m_chargePrimary[i] * m_chargePrimary[i] * primarySpeciesConcentration[i];
+  }
+  // Secondary species
+  for( int j = 0; j < m_numSecondarySpecies; ++j )
+  {
+    ionicStrength += 0.5 * m_chargeSec[j] * m_chargeSec[j] * secondarySpeciesConcentration[j];
+  }
+}
+
 } // end namespace chemicalReactions
 
 } // end namespace constitutive
@@ -61,6 +61,13 @@ TableRelativePermeability::TableRelativePermeability( std::string const & name,
                     string( viewKeyStruct::wettingNonWettingRelPermTableNamesString() ) +
                     " to specify the table names" );
 
+  registerWrapper( viewKeyStruct::uniformResamplingSizeString(), &m_uniformResamplingSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of points of the uniform saturation grid on which the tables are resampled at initialization. "
+                    "The lookups in the resampled tables compute the interval index directly instead of doing a binary search. "
+                    "The default, 0, uses the input tables" );
+
   registerWrapper( viewKeyStruct::phaseMinVolumeFractionString(), &m_phaseMinVolumeFraction ).
     setInputFlag( InputFlags::FALSE ). // will be deduced from tables
     setSizedFromParent( 0 );
@@ -74,6 +81,11 @@ void TableRelativePermeability::postProcessInput()
 {
   RelativePermeabilityBase::postProcessInput();
 
+  GEOS_THROW_IF_LT_MSG( m_uniformResamplingSize, 0,
+                        GEOS_FMT( "{}: {} must be non-negative",
+                                  getFullName(), viewKeyStruct::uniformResamplingSizeString() ),
+                        InputError );
+
   integer const numPhases = m_phaseNames.size();
   GEOS_THROW_IF( numPhases != 2 && numPhases != 3,
                  GEOS_FMT( "{}: the expected number of fluid phases is either two, or three",
@@ -231,7 +243,7 @@ void TableRelativePermeability::createAllTableKernelWrappers()
     for( integer ip = 0; ip < m_wettingNonWettingRelPermTableNames.size(); ++ip )
     {
       TableFunction const & relPermTable = functionManager.getGroup< TableFunction >( m_wettingNonWettingRelPermTableNames[ip] );
-      m_relPermKernelWrappers.emplace_back( relPermTable.createKernelWrapper() );
+      m_relPermKernelWrappers.emplace_back( relPermTable.createKernelWrapper( m_uniformResamplingSize ) );
     }
   }
   else if( numPhases == 3 )
@@ -239,12 +251,12 @@ void TableRelativePermeability::createAllTableKernelWrappers()
     for( integer ip = 0; ip < m_wettingIntermediateRelPermTableNames.size(); ++ip )
     {
       TableFunction const & relPermTable = functionManager.getGroup< TableFunction >( m_wettingIntermediateRelPermTableNames[ip] );
-      m_relPermKernelWrappers.emplace_back( relPermTable.createKernelWrapper() );
+      m_relPermKernelWrappers.emplace_back( relPermTable.createKernelWrapper( m_uniformResamplingSize ) );
     }
     for( integer ip = 0; ip < m_nonWettingIntermediateRelPermTableNames.size(); ++ip )
     {
       TableFunction const & relPermTable = functionManager.getGroup< TableFunction >( m_nonWettingIntermediateRelPermTableNames[ip] );
-      m_relPermKernelWrappers.emplace_back( relPermTable.createKernelWrapper() );
+      m_relPermKernelWrappers.emplace_back( relPermTable.createKernelWrapper( m_uniformResamplingSize ) );
     }
   }
 }
@@ -130,6 +130,7 @@ private:
     static constexpr char const * wettingNonWettingRelPermTableNamesString() { return "wettingNonWettingRelPermTableNames"; }
     static constexpr char const * wettingIntermediateRelPermTableNamesString() { return "wettingIntermediateRelPermTableNames"; }
     static constexpr char const * nonWettingIntermediateRelPermTableNamesString() { return "nonWettingIntermediateRelPermTableNames"; }
+    static constexpr char const * uniformResamplingSizeString() { return "uniformResamplingSize"; }
   };
 
   arrayView1d< real64 const > getPhaseMinVolumeFraction() const override { return m_phaseMinVolumeFraction; };
@@ -154,6 +155,9 @@ private:
   /// Relative permeability table names (one for each phase in the non-wetting-intermediate pair)
   array1d< string > m_nonWettingIntermediateRelPermTableNames;
 
+  /// Number of points of the uniform grid on which the tables are resampled (0 to use the input tables)
+  integer m_uniformResamplingSize;
+
   /// Kernel wrappers for relative permeabilities in the following order:
   /// Two-phase flow:
   ///  0- wetting-phase
@@ -81,6 +81,13 @@ TableRelativePermeabilityHysteresis::TableRelativePermeabilityHysteresis( std::s
     setDescription( "Imbibition relative permeability table name for the non-wetting phase.\n"
                     "To neglect hysteresis on this phase, just use the same table name for the drainage and imbibition curves" );
 
+  registerWrapper( viewKeyStruct::uniformResamplingSizeString(), &m_uniformResamplingSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Number of points of the uniform saturation grid on which the tables are resampled at initialization. "
+                    "The lookups in the resampled tables compute the interval index directly instead of doing a binary search. "
+                    "The default, 0, uses the input tables" );
+
   // hysteresis input parameters
 
   registerWrapper( viewKeyStruct::jerauldParameterAString(), &m_jerauldParam_a ).
@@ -149,6 +156,11 @@ void TableRelativePermeabilityHysteresis::postProcessInput()
 {
   RelativePermeabilityBase::postProcessInput();
 
+  GEOS_THROW_IF_LT_MSG( m_uniformResamplingSize, 0,
+                        GEOS_FMT( "{}: {} must be non-negative",
+                                  getFullName(), viewKeyStruct::uniformResamplingSizeString() ),
+                        InputError );
+
   using IPT = TableRelativePermeabilityHysteresis::ImbibitionPhasePairPhaseType;
 
   integer const numPhases = m_phaseNames.size();
@@ -523,18 +535,18 @@ void TableRelativePermeabilityHysteresis::createAllTableKernelWrappers()
     for( integer ip = 0; ip < m_drainageWettingNonWettingRelPermTableNames.size(); ++ip )
     {
       TableFunction const & drainageRelPermTable = functionManager.getGroup< TableFunction >( m_drainageWettingNonWettingRelPermTableNames[ip] );
-      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
+      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
     }
 
     TableFunction const & imbibitionWettingRelPermTable = m_phaseHasHysteresis[IPT::WETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageWettingNonWettingRelPermTableNames[0] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper() );
+    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
 
     TableFunction const & imbibitionNonWettingRelPermTable = m_phaseHasHysteresis[IPT::NONWETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionNonWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageWettingNonWettingRelPermTableNames[1] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper() );
+    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
 
   }
   else if( numPhases == 3 )
@@ -542,23 +554,23 @@ void TableRelativePermeabilityHysteresis::createAllTableKernelWrappers()
     for( integer ip = 0; ip < m_drainageWettingIntermediateRelPermTableNames.size(); ++ip )
     {
       TableFunction const & drainageRelPermTable = functionManager.getGroup< TableFunction >( m_drainageWettingIntermediateRelPermTableNames[ip] );
-      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
+      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
     }
     for( integer ip = 0; ip < m_drainageNonWettingIntermediateRelPermTableNames.size(); ++ip )
     {
       TableFunction const & drainageRelPermTable = functionManager.getGroup< TableFunction >( m_drainageNonWettingIntermediateRelPermTableNames[ip] );
-      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper() );
+      m_drainageRelPermKernelWrappers.emplace_back( drainageRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
     }
 
     TableFunction const & imbibitionWettingRelPermTable = m_phaseHasHysteresis[IPT::WETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageWettingIntermediateRelPermTableNames[0] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper() );
+    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionWettingRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
 
     TableFunction const & imbibitionNonWettingRelPermTable = m_phaseHasHysteresis[IPT::NONWETTING]
       ? functionManager.getGroup< TableFunction >( m_imbibitionNonWettingRelPermTableName )
       : functionManager.getGroup< TableFunction >( m_drainageNonWettingIntermediateRelPermTableNames[0] );
-    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper() );
+    m_imbibitionRelPermKernelWrappers.emplace_back( imbibitionNonWettingRelPermTable.createKernelWrapper( m_uniformResamplingSize ) );
   }
 
 }
@@ -429,6 +429,9 @@ private:
     static constexpr char const * imbibitionNonWettingRelPermTableNameString()
     { return "imbibitionNonWettingRelPermTableName"; }
 
+    static constexpr char const * uniformResamplingSizeString()
+    { return "uniformResamplingSize"; }
+
   };
 
   arrayView1d< real64 const > getPhaseMinVolumeFraction() const override
@@ -510,6 +513,9 @@ private:
   ///  1- non-wetting-phase
   array1d< TableFunction::KernelWrapper > m_imbibitionRelPermKernelWrappers;
 
+  /// Number of points of the uniform grid on which the tables are resampled (0 to use the input tables)
+  integer m_uniformResamplingSize;
+
   // Hysteresis parameters
 
   /// Parameter a introduced by Jerauld in the Land model
@@ -196,76 +196,47 @@ void DruckerPragerUpdates::smallStrainUpdate( localIndex const k,
   // else, plasticity (trial stress point lies outside yield surface)
 
   // the return mapping can in general be written as a newton iteration.
-  // here we have a linear problem, so the algorithm will converge in one
-  // iteration, but this is a template for more general models with either
-  // nonlinear hardening or yield surfaces.
-
-  real64 solution[3] = {}, residual[3] = {}, delta[3] = {};
+  // here we have a linear problem (up to the complete cohesion loss), so the
+  // plastic multiplier is computed in closed form. This avoids a data-dependent
+  // number of iterations per quadrature point inside the mechanics kernels.
+  //
+  // resid1 = P - trialP + dlambda*bulkMod*dG/dP = 0
+  // resid2 = Q - trialQ + dlambda*3*shearMod*dG/dQ = 0
+  // resid3 = F = Q + friction*P - cohesion(dlambda) = 0
+
+  real64 solution[3] = {};
   real64 jacobian[3][3] = {{}}, jacobianInv[3][3] = {{}};
 
-  solution[0] = trialP; // initial guess for newP
-  solution[1] = trialQ; // initial guess for newQ
-  solution[2] = 1e-5;   // initial guess for plastic multiplier
+  // apply a linear cohesion decay model,
+  // then check for complete cohesion loss
 
-  real64 norm, normZero = 1e30;
+  real64 cohesionDeriv = m_hardening[k];
+  real64 const denominator = 3 * m_shearModulus[k] + m_friction[k] * m_bulkModulus[k] * m_dilation[k];
 
-  // begin newton loop
+  solution[2] = yield / ( denominator + cohesionDeriv );
+  m_newCohesion[k][q] = m_oldCohesion[k][q] + solution[2] * cohesionDeriv;
 
-  for( localIndex iter=0; iter<20; ++iter )
+  if( m_newCohesion[k][q] < 0 )
   {
-    // apply a linear cohesion decay model,
-    // then check for complete cohesion loss
-
-    m_newCohesion[k][q] = m_oldCohesion[k][q] + solution[2] * m_hardening[k];
-    real64 cohesionDeriv = m_hardening[k];
-
-    if( m_newCohesion[k][q] < 0 )
-    {
-      m_newCohesion[k][q] = 0;
-      cohesionDeriv = 0;
-    }
-
-    // assemble residual system
-    // resid1 = P - trialP + dlambda*bulkMod*dG/dP = 0
-    // resid2 = Q - trialQ + dlambda*3*shearMod*dG/dQ = 0
-    // resid3 = F = 0
-
-    residual[0] = solution[0] - trialP + solution[2] * m_bulkModulus[k] * m_dilation[k];
-    residual[1] = solution[1] - trialQ + solution[2] * 3 * m_shearModulus[k];
-    residual[2] = solution[1] + m_friction[k] * solution[0] - m_newCohesion[k][q];
-
-    // check for convergence
-
-    norm = LvArray::tensorOps::l2Norm< 3 >( residual );
-
-    if( iter==0 )
-    {
-      normZero = norm;
-    }
-
-    if( norm < 1e-8*(normZero+1))
-    {
-      break;
-    }
+    m_newCohesion[k][q] = 0;
+    cohesionDeriv = 0;
+    solution[2] = ( trialQ + m_friction[k] * trialP ) / denominator;
+  }
 
-    // solve Newton system
+  solution[0] = trialP - solution[2] * m_bulkModulus[k] * m_dilation[k];
+  solution[1] = trialQ - solution[2] * 3 * m_shearModulus[k];
 
-    jacobian[0][0] = 1;
-    jacobian[0][2] = m_bulkModulus[k] * m_dilation[k];
-    jacobian[1][1] = 1;
-    jacobian[1][2] = 3 * m_shearModulus[k];
-    jacobian[2][0] = m_friction[k];
-    jacobian[2][1] = 1;
-    jacobian[2][2] = -cohesionDeriv;
+  // the inverse of the jacobian of the residual system gives the consistent tangent
 
-    LvArray::tensorOps::invert< 3 >( jacobianInv, jacobian );
-    LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( delta, jacobianInv, residual );
+  jacobian[0][0] = 1;
+  jacobian[0][2] = m_bulkModulus[k] * m_dilation[k];
+  jacobian[1][1] = 1;
+  jacobian[1][2] = 3 * m_shearModulus[k];
+  jacobian[2][0] = m_friction[k];
+  jacobian[2][1] = 1;
+  jacobian[2][2] = -cohesionDeriv;
 
-    for( localIndex i=0; i<3; ++i )
-    {
-      solution[i] -= delta[i];
-    }
-  }
+  LvArray::tensorOps::invert< 3 >( jacobianInv, jacobian );
 
   // re-construct stress = P*eye + sqrt(2/3)*Q*nhat
 
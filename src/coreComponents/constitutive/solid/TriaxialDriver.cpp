@@ -17,7 +17,9 @@
  */
 
 #include "TriaxialDriver.hpp"
+#include "codingUtilities/StringUtilities.hpp"
 #include "fileIO/Outputs/OutputBase.hpp"
+#include "fileIO/timeHistory/HDFFile.hpp"
 
 namespace geos
 {
@@ -64,6 +66,17 @@ TriaxialDriver::TriaxialDriver( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( "none" ).
     setDescription( "Baseline file" );
+
+  registerWrapper( viewKeyStruct::batchParameterNamesString(), &m_batchParameterNames ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Names of the material fields (e.g. bulkModulus, shearModulus) varied in batch mode. "
+                    "If specified, the loading protocol is run in parallel for each row of " +
+                    string( viewKeyStruct::batchParameterValuesString() ) + ", and the output file is written in HDF5" );
+
+  registerWrapper( viewKeyStruct::batchParameterValuesString(), &m_batchParameterValues ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Values of the batch fields, with one row per parameter set and one column per name in " +
+                    string( viewKeyStruct::batchParameterNamesString() ) );
 }
 
 
@@ -78,6 +91,20 @@ void TriaxialDriver::postProcessInput()
                  getDataContext() << ": Test mode \'" << m_mode << "\' not recognized.",
                  InputError );
 
+  if( !m_batchParameterNames.empty() )
+  {
+    GEOS_THROW_IF( m_batchParameterValues.size( 0 ) == 0,
+                   getDataContext() << ": " << viewKeyStruct::batchParameterValuesString() << " must contain at least one parameter set",
+                   InputError );
+    GEOS_THROW_IF_NE_MSG( m_batchParameterValues.size( 1 ), m_batchParameterNames.size(),
+                          GEOS_FMT( "{}: {} must have one column per name in {}", getDataContext(),
+                                    viewKeyStruct::batchParameterValuesString(), viewKeyStruct::batchParameterNamesString() ),
+                          InputError );
+    GEOS_THROW_IF( m_baselineFile != "none",
+                   getDataContext() << ": baseline comparison is not supported in batch mode",
+                   InputError );
+  }
+
   // initialize table functions
 
   FunctionManager & functionManager = FunctionManager::getInstance();
@@ -98,20 +125,26 @@ void TriaxialDriver::postProcessInput()
   // resize data arrays
 
   integer const length = m_numSteps+1;
-  m_table.resize( length, m_numColumns );
+  localIndex const numSets = numParameterSets();
+  m_table.resize( numSets, length, m_numColumns );
 
-  // set time column
+  // all the parameter sets follow the same loading protocol
 
-  for( integer n=0; n<length; ++n )
+  for( localIndex k=0; k<numSets; ++k )
   {
-    m_table( n, TIME ) = minTime + n*dt;
-  }
+    // set time column
 
-  // initial stress is always isotropic
+    for( integer n=0; n<length; ++n )
+    {
+      m_table( k, n, TIME ) = minTime + n*dt;
+    }
 
-  m_table( 0, SIG0 ) = m_initialStress;
-  m_table( 0, SIG1 ) = m_initialStress;
-  m_table( 0, SIG2 ) = m_initialStress;
+    // initial stress is always isotropic
+
+    m_table( k, 0, SIG0 ) = m_initialStress;
+    m_table( k, 0, SIG1 ) = m_initialStress;
+    m_table( k, 0, SIG2 ) = m_initialStress;
+  }
 
   // preset certain columns depending on testing mode:
   //   mixedControl .... specified axial strain and radial stress
@@ -120,49 +153,52 @@ void TriaxialDriver::postProcessInput()
 
   for( integer n=0; n<length; ++n )
   {
-    real64 axi = axialFunction.evaluate( &m_table( n, TIME ) );
-    real64 rad = radialFunction.evaluate( &m_table( n, TIME ) );
+    real64 axi = axialFunction.evaluate( &m_table( 0, n, TIME ) );
+    real64 rad = radialFunction.evaluate( &m_table( 0, n, TIME ) );
 
-    if( m_mode == "mixedControl" )
+    for( localIndex k=0; k<numSets; ++k )
     {
-      m_table( n, EPS0 ) = axi;
-      m_table( n, SIG1 ) = rad;
-      m_table( n, SIG2 ) = rad;
-    }
-    else if( m_mode == "strainControl" )
-    {
-      m_table( n, EPS0 ) = axi;
-      m_table( n, EPS1 ) = rad;
-      m_table( n, EPS2 ) = rad;
-    }
-    else if( m_mode == "stressControl" )
-    {
-      m_table( n, SIG0 ) = axi;
-      m_table( n, SIG1 ) = rad;
-      m_table( n, SIG2 ) = rad;
+      if( m_mode == "mixedControl" )
+      {
+        m_table( k, n, EPS0 ) = axi;
+        m_table( k, n, SIG1 ) = rad;
+        m_table( k, n, SIG2 ) = rad;
+      }
+      else if( m_mode == "strainControl" )
+      {
+        m_table( k, n, EPS0 ) = axi;
+        m_table( k, n, EPS1 ) = rad;
+        m_table( k, n, EPS2 ) = rad;
+      }
+      else if( m_mode == "stressControl" )
+      {
+        m_table( k, n, SIG0 ) = axi;
+        m_table( k, n, SIG1 ) = rad;
+        m_table( k, n, SIG2 ) = rad;
+      }
     }
   }
 
   // double check the initial stress value is consistent with any function values that
   // may overwrite it.
 
-  GEOS_THROW_IF( !isEqual( m_initialStress, m_table( 0, SIG0 ), 1e-6 ),
+  GEOS_THROW_IF( !isEqual( m_initialStress, m_table( 0, 0, SIG0 ), 1e-6 ),
                  getDataContext() << ": Initial stress values indicated by initialStress and axialFunction(time=0) appear inconsistent",
                  InputError );
 
-  GEOS_THROW_IF( !isEqual( m_initialStress, m_table( 0, SIG1 ), 1e-6 ),
+  GEOS_THROW_IF( !isEqual( m_initialStress, m_table( 0, 0, SIG1 ), 1e-6 ),
                  getDataContext() << ": Initial stress values indicated by initialStress and radialFunction(time=0) appear inconsistent",
                  InputError );
 }
 
 
 template< typename SOLID_TYPE >
-void TriaxialDriver::runStrainControlTest( SOLID_TYPE & solid, arrayView2d< real64 > const & table )
+void TriaxialDriver::runStrainControlTest( SOLID_TYPE & solid, arrayView3d< real64 > const & table )
 {
   typename SOLID_TYPE::KernelWrapper updates = solid.createKernelUpdates();
   localIndex const numSteps = m_numSteps;
 
-  forAll< parallelDevicePolicy<> >( 1, [=]  GEOS_HOST_DEVICE ( integer const ei )
+  forAll< parallelDevicePolicy<> >( table.size( 0 ), [=]  GEOS_HOST_DEVICE ( integer const ei )
   {
     real64 stress[6] = {};
     real64 timeIncrement = 0;
@@ -171,27 +207,27 @@ void TriaxialDriver::runStrainControlTest( SOLID_TYPE & solid, arrayView2d< real
 
     for( integer n = 1; n <= numSteps; ++n )
     {
-      strainIncrement[0] = table( n, EPS0 )-table( n-1, EPS0 );
-      strainIncrement[1] = table( n, EPS1 )-table( n-1, EPS1 );
-      strainIncrement[2] = table( n, EPS2 )-table( n-1, EPS2 );
+      strainIncrement[0] = table( ei, n, EPS0 )-table( ei, n-1, EPS0 );
+      strainIncrement[1] = table( ei, n, EPS1 )-table( ei, n-1, EPS1 );
+      strainIncrement[2] = table( ei, n, EPS2 )-table( ei, n-1, EPS2 );
 
-      timeIncrement = table( n, TIME )-table( n-1, TIME );
+      timeIncrement = table( ei, n, TIME )-table( ei, n-1, TIME );
 
       updates.smallStrainUpdate( ei, 0, timeIncrement, strainIncrement, stress, stiffness );
       updates.saveConvergedState ( ei, 0 );
 
-      table( n, SIG0 ) = stress[0];
-      table( n, SIG1 ) = stress[1];
-      table( n, SIG2 ) = stress[2];
+      table( ei, n, SIG0 ) = stress[0];
+      table( ei, n, SIG1 ) = stress[1];
+      table( ei, n, SIG2 ) = stress[2];
 
-      table( n, ITER ) = 0;
+      table( ei, n, ITER ) = 0;
     }
   } );
 }
 
 
 template< typename SOLID_TYPE >
-void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real64 > const & table )
+void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView3d< real64 > const & table )
 {
   typename SOLID_TYPE::KernelWrapper updates = solid.createKernelUpdates();
   integer const numSteps = m_numSteps;
@@ -199,7 +235,7 @@ void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real6
   integer const maxCuts = m_maxCuts;
   real64 const newtonTol = m_newtonTol;
 
-  forAll< parallelDevicePolicy<> >( 1, [=]  GEOS_HOST_DEVICE ( integer const ei )
+  forAll< parallelDevicePolicy<> >( table.size( 0 ), [=]  GEOS_HOST_DEVICE ( integer const ei )
   {
     real64 stress[6] = {};
     real64 timeIncrement = 0;
@@ -210,17 +246,17 @@ void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real6
     real64 scale = 0;
     for( integer n = 1; n <= numSteps; ++n )
     {
-      scale += fabs( table( n, SIG0 )) + fabs( table( n, SIG1 )) + fabs( table( n, SIG2 ));
+      scale += fabs( table( ei, n, SIG0 )) + fabs( table( ei, n, SIG1 )) + fabs( table( ei, n, SIG2 ));
     }
     scale = 3 * numSteps / scale;
 
     for( integer n=1; n<=numSteps; ++n )
     {
-      strainIncrement[0] = table( n, EPS0 )-table( n-1, EPS0 );
+      strainIncrement[0] = table( ei, n, EPS0 )-table( ei, n-1, EPS0 );
       strainIncrement[1] = 0;
       strainIncrement[2] = 0;
 
-      timeIncrement = table( n, TIME )-table( n-1, TIME );
+      timeIncrement = table( ei, n, TIME )-table( ei, n-1, TIME );
 
       real64 norm, normZero = 1e30;
       integer k = 0;
@@ -230,7 +266,7 @@ void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real6
       {
         updates.smallStrainUpdate( ei, 0, timeIncrement, strainIncrement, stress, stiffness );
 
-        norm = scale*fabs( stress[1]-table( n, SIG1 ) );
+        norm = scale*fabs( stress[1]-table( ei, n, SIG1 ) );
 
         if( k == 0 )
         {
@@ -250,7 +286,7 @@ void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real6
         }
         else // newton update
         {
-          deltaStrainIncrement  = (stress[1]-table( n, SIG1 )) / (stiffness[1][1]+stiffness[1][2]);
+          deltaStrainIncrement  = (stress[1]-table( ei, n, SIG1 )) / (stiffness[1][1]+stiffness[1][2]);
           strainIncrement[1]   -= deltaStrainIncrement;
           strainIncrement[2]    = strainIncrement[1];
         }
@@ -258,12 +294,12 @@ void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real6
 
       updates.saveConvergedState ( ei, 0 );
 
-      table( n, SIG0 ) = stress[0];
-      table( n, EPS1 ) = table( n-1, EPS1 )+strainIncrement[1];
-      table( n, EPS2 ) = table( n, EPS1 );
+      table( ei, n, SIG0 ) = stress[0];
+      table( ei, n, EPS1 ) = table( ei, n-1, EPS1 )+strainIncrement[1];
+      table( ei, n, EPS2 ) = table( ei, n, EPS1 );
 
-      table( n, ITER ) = k;
-      table( n, NORM ) = norm;
+      table( ei, n, ITER ) = k;
+      table( ei, n, NORM ) = norm;
 
       if( norm > newtonTol )
       {
@@ -275,7 +311,7 @@ void TriaxialDriver::runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real6
 
 
 template< typename SOLID_TYPE >
-void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView2d< real64 > const & table )
+void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView3d< real64 > const & table )
 {
   typename SOLID_TYPE::KernelWrapper updates = solid.createKernelUpdates();
   integer const numSteps = m_numSteps;
@@ -283,7 +319,7 @@ void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView2d< real
   integer const maxCuts = m_maxCuts;
   real64 const newtonTol = m_newtonTol;
 
-  forAll< parallelDevicePolicy<> >( 1, [=]  GEOS_HOST_DEVICE ( integer const ei )
+  forAll< parallelDevicePolicy<> >( table.size( 0 ), [=]  GEOS_HOST_DEVICE ( integer const ei )
   {
     real64 stress[6] = {};
     real64 timeIncrement = 0;
@@ -297,7 +333,7 @@ void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView2d< real
     real64 scale = 0;
     for( integer n = 1; n <= numSteps; ++n )
     {
-      scale += fabs( table( n, SIG0 )) + fabs( table( n, SIG1 )) + fabs( table( n, SIG2 ));
+      scale += fabs( table( ei, n, SIG0 )) + fabs( table( ei, n, SIG1 )) + fabs( table( ei, n, SIG2 ));
     }
     scale = 3 * numSteps / scale;
 
@@ -308,7 +344,7 @@ void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView2d< real
       strainIncrement[1] = 0;
       strainIncrement[2] = 0;
 
-      timeIncrement = table( n, TIME )-table( n-1, TIME );
+      timeIncrement = table( ei, n, TIME )-table( ei, n-1, TIME );
 
       real64 norm, normZero = 1e30, det;
       integer k = 0;
@@ -318,8 +354,8 @@ void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView2d< real
       {
         updates.smallStrainUpdate( ei, 0, timeIncrement, strainIncrement, stress, stiffness );
 
-        resid[0] = scale * (stress[0]-table( n, SIG0 ));
-        resid[1] = scale * (stress[1]-table( n, SIG1 ));
+        resid[0] = scale * (stress[0]-table( ei, n, SIG0 ));
+        resid[1] = scale * (stress[1]-table( ei, n, SIG1 ));
 
         norm = sqrt( resid[0]*resid[0] + resid[1]*resid[1] );
         //  std::cout<<"k= "<<k<<std::endl;
@@ -365,12 +401,12 @@ void TriaxialDriver::runStressControlTest( SOLID_TYPE & solid, arrayView2d< real
 
       updates.saveConvergedState ( ei, 0 );
 
-      table( n, EPS0 ) = table( n-1, EPS0 )+strainIncrement[0];
-      table( n, EPS1 ) = table( n-1, EPS1 )+strainIncrement[1];
-      table( n, EPS2 ) = table( n, EPS1 );
+      table( ei, n, EPS0 ) = table( ei, n-1, EPS0 )+strainIncrement[0];
+      table( ei, n, EPS1 ) = table( ei, n-1, EPS1 )+strainIncrement[1];
+      table( ei, n, EPS2 ) = table( ei, n, EPS1 );
 
-      table( n, ITER ) = k;
-      table( n, NORM ) = norm;
+      table( ei, n, ITER ) = k;
+      table( ei, n, NORM ) = norm;
 
       if( norm > newtonTol )
       {
@@ -413,25 +449,36 @@ bool TriaxialDriver::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
     GEOS_LOG_RANK_0( "  Steps ............. " << m_numSteps );
     GEOS_LOG_RANK_0( "  Output ............ " << m_outputFile );
     GEOS_LOG_RANK_0( "  Baseline .......... " << m_baselineFile );
+    if( !m_batchParameterNames.empty() )
+    {
+      GEOS_LOG_RANK_0( "  Batch Parameters .. " << stringutilities::join( m_batchParameterNames, ", " ) );
+      GEOS_LOG_RANK_0( "  Parameter Sets .... " << numParameterSets() );
+    }
   }
 
-  // create a dummy discretization with one quadrature point for
-  // storing constitutive data
+  // create a dummy discretization with one element per parameter set
+  // and one quadrature point for storing constitutive data
 
   conduit::Node node;
   dataRepository::Group rootGroup( "root", node );
   dataRepository::Group discretization( "discretization", &rootGroup );
 
-  discretization.resize( 1 );   // one element
+  localIndex const numSets = numParameterSets();
+  discretization.resize( numSets );   // one element per parameter set
   baseSolid.allocateConstitutiveData( discretization, 1 );   // one quadrature point
 
+  setBatchParameters( baseSolid );
+
   // set the initial stress state using the data table
 
   arrayView3d< real64, solid::STRESS_USD > stressArray = baseSolid.getStress();
 
-  stressArray( 0, 0, 0 ) = m_table( 0, SIG0 );
-  stressArray( 0, 0, 1 ) = m_table( 0, SIG1 );
-  stressArray( 0, 0, 2 ) = m_table( 0, SIG2 );
+  for( localIndex k = 0; k < numSets; ++k )
+  {
+    stressArray( k, 0, 0 ) = m_table( k, 0, SIG0 );
+    stressArray( k, 0, 1 ) = m_table( k, 0, SIG1 );
+    stressArray( k, 0, 2 ) = m_table( k, 0, SIG2 );
+  }
 
   baseSolid.saveConvergedState();
 
@@ -464,7 +511,14 @@ bool TriaxialDriver::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
 
   if( m_outputFile != "none" )
   {
-    outputResults();
+    if( m_batchParameterNames.empty() )
+    {
+      outputResults();
+    }
+    else
+    {
+      outputBatchResults();
+    }
   }
 
   if( m_baselineFile != "none" )
@@ -476,19 +530,51 @@ bool TriaxialDriver::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
 }
 
 
-void TriaxialDriver::validateResults()
+void TriaxialDriver::setBatchParameters( SolidBase & solid ) const
 {
-  for( integer n=0; n<m_numSteps; ++n )
+  for( integer p = 0; p < m_batchParameterNames.size(); ++p )
   {
-    if( m_table( n, NORM ) > m_newtonTol )
+    string const & fieldName = m_batchParameterNames[p];
+    GEOS_THROW_IF( !solid.hasWrapper( fieldName ),
+                   getDataContext() << ": material " << m_solidMaterialName << " has no field named " << fieldName,
+                   InputError );
+    GEOS_THROW_IF( !solid.getWrapperBase( fieldName ).sizedFromParent(),
+                   getDataContext() << ": field " << fieldName << " of material " << m_solidMaterialName
+                                    << " is not defined per constitutive point and cannot be varied in batch mode",
+                   InputError );
+
+    arrayView1d< real64 > const field = solid.getReference< array1d< real64 > >( fieldName );
+    for( localIndex k = 0; k < field.size(); ++k )
     {
-      GEOS_LOG_RANK_0( "WARNING: Material driver failed to converge at loadstep " << n << "." );
-      GEOS_LOG_RANK_0( "         This usually indicates the material has completely failed and/or the loading state is inadmissible." );
-      GEOS_LOG_RANK_0( "         In rare cases, it may indicate a problem in the material model implementation." );
+      field[k] = m_batchParameterValues( k, p );
+    }
+  }
+}
 
-      for( integer col=EPS0; col<ITER; ++col )
+
+void TriaxialDriver::validateResults()
+{
+  for( localIndex k=0; k<m_table.size( 0 ); ++k )
+  {
+    for( integer n=0; n<m_numSteps; ++n )
+    {
+      if( m_table( k, n, NORM ) > m_newtonTol )
       {
-        m_table( n, col ) = 0;
+        if( m_batchParameterNames.empty() )
+        {
+          GEOS_LOG_RANK_0( "WARNING: Material driver failed to converge at loadstep " << n << "." );
+        }
+        else
+        {
+          GEOS_LOG_RANK_0( "WARNING: Material driver failed to converge at loadstep " << n << " of parameter set " << k << "." );
+        }
+        GEOS_LOG_RANK_0( "         This usually indicates the material has completely failed and/or the loading state is inadmissible." );
+        GEOS_LOG_RANK_0( "         In rare cases, it may indicate a problem in the material model implementation." );
+
+        for( integer col=EPS0; col<ITER; ++col )
+        {
+          m_table( k, n, col ) = 0;
+        }
       }
     }
   }
@@ -522,7 +608,7 @@ void TriaxialDriver::outputResults()
   {
     for( integer col=0; col<m_numColumns; ++col )
     {
-      fprintf( fp, "%.4e ", m_table( n, col ) );
+      fprintf( fp, "%.4e ", m_table( 0, n, col ) );
     }
     fprintf( fp, "\n" );
   }
@@ -530,6 +616,19 @@ void TriaxialDriver::outputResults()
 }
 
 
+void TriaxialDriver::outputBatchResults()
+{
+  // the results dataset has the size (parameter sets, steps+1, columns),
+  // with the same column ordering as the text output
+
+  HDFFile file( m_outputFile, true, true, MPI_COMM_SELF );
+  file.writeDataset( "results", m_table.data(),
+                     { m_table.size( 0 ), m_table.size( 1 ), m_table.size( 2 ) } );
+  file.writeDataset( "parameters", m_batchParameterValues.data(),
+                     { m_batchParameterValues.size( 0 ), m_batchParameterValues.size( 1 ) } );
+}
+
+
 void TriaxialDriver::compareWithBaseline()
 {
   // open baseline file
@@ -553,16 +652,16 @@ void TriaxialDriver::compareWithBaseline()
   real64 value;
   real64 error;
 
-  for( integer row=0; row < m_table.size( 0 ); ++row )
+  for( integer row=0; row < m_table.size( 1 ); ++row )
   {
-    for( integer col=0; col < m_table.size( 1 ); ++col )
+    for( integer col=0; col < m_table.size( 2 ); ++col )
     {
       GEOS_THROW_IF( file.eof(), "Baseline file appears shorter than internal results", std::runtime_error );
       file >> value;
 
       if( col < ITER ) // only compare "real" data columns
       {
-        error = fabs( m_table[row][col]-value ) / ( fabs( value )+1 );
+        error = fabs( m_table[0][row][col]-value ) / ( fabs( value )+1 );
         GEOS_THROW_IF( error > m_baselineTol, "Results do not match baseline at data row " << row+1
                                                                                            << " (row " << row+10 << " with header)"
                                                                                            << " and column " << col+1, std::runtime_error );
@@ -39,6 +39,8 @@ using namespace constitutive;
  * Class to allow for triaxial (and similar) tests of the solid constitutive models without the
  * complexity of setting up a single element test.
  *
+ * In batch mode, the same loading protocol is run for a list of material parameter sets,
+ * each set being assigned to its own constitutive point so that all the tests run in parallel.
  */
 class TriaxialDriver : public TaskBase
 {
@@ -61,26 +63,26 @@ public:
   /**
    * @brief Run a strain-controlled test using loading protocol in table
    * @param solid Solid constitutive model
-   * @param table Table with stress / strain time history
+   * @param table Table with stress / strain time history of each parameter set
    */
   template< typename SOLID_TYPE >
-  void runStrainControlTest( SOLID_TYPE & solid, arrayView2d< real64 > const & table );
+  void runStrainControlTest( SOLID_TYPE & solid, arrayView3d< real64 > const & table );
 
   /**
    * @brief Run a stress-controlled test using loading protocol in table
    * @param solid Solid constitutive model
-   * @param table Table with stress / strain time history
+   * @param table Table with stress / strain time history of each parameter set
    */
   template< typename SOLID_TYPE >
-  void runStressControlTest( SOLID_TYPE & solid, arrayView2d< real64 > const & table );
+  void runStressControlTest( SOLID_TYPE & solid, arrayView3d< real64 > const & table );
 
   /**
    * @brief Run a mixed stress/strain-controlled test using loading protocol in table
    * @param solid Solid constitutive model
-   * @param table Table with stress / strain time history
+   * @param table Table with stress / strain time history of each parameter set
    */
   template< typename SOLID_TYPE >
-  void runMixedControlTest( SOLID_TYPE & solid, arrayView2d< real64 > const & table );
+  void runMixedControlTest( SOLID_TYPE & solid, arrayView3d< real64 > const & table );
 
   /**
    * @brief Validate results by checking residual and removing erroneous data
@@ -92,6 +94,11 @@ public:
    */
   void outputResults();
 
+  /**
+   * @brief Output the tables of all the parameter sets of a batch to a single HDF5 file
+   */
+  void outputBatchResults();
+
   /**
    * @brief Read in a baseline table from file and compare with computed one (for unit testing purposes)
    */
@@ -112,8 +119,19 @@ private:
     constexpr static char const * numStepsString() { return "steps"; }
     constexpr static char const * outputString() { return "output"; }
     constexpr static char const * baselineString() { return "baseline"; }
+    constexpr static char const * batchParameterNamesString() { return "batchParameterNames"; }
+    constexpr static char const * batchParameterValuesString() { return "batchParameterValues"; }
   };
 
+  /**
+   * @brief Assign the values of the batch parameter sets to the constitutive points of the material
+   * @param solid Solid constitutive model, allocated with one point per parameter set
+   */
+  void setBatchParameters( SolidBase & solid ) const;
+
+  /// @return the number of parameter sets tested, one when not in batch mode
+  localIndex numParameterSets() const { return m_batchParameterNames.empty() ? 1 : m_batchParameterValues.size( 0 ); }
+
   integer m_numSteps;          ///< Number of load steps
   string m_solidMaterialName;  ///< Material identifier
   string m_mode;               ///< Test mode: strainControl, stressControl, mixedControl
@@ -122,7 +140,9 @@ private:
   real64 m_initialStress;      ///< Initial stress value (scalar used to set an isotropic stress state)
   string m_outputFile;         ///< Output file (optional, no output if not specified)
   Path m_baselineFile;         ///< Baseline file (optional, for unit testing of solid models)
-  array2d< real64 > m_table;   ///< Table storing time-history of axial/radial stresses and strains
+  string_array m_batchParameterNames;         ///< Names of the material fields varied in batch mode
+  array2d< real64 > m_batchParameterValues;   ///< Values of the batch fields, one row per parameter set
+  array3d< real64 > m_table;   ///< Table storing time-history of axial/radial stresses and strains of each parameter set
 
   static integer const m_numColumns = 9; ///< Number of columns in data table
   enum columnKeys { TIME, EPS0, EPS1, EPS2, SIG0, SIG1, SIG2, ITER, NORM }; ///< Enumeration of column keys
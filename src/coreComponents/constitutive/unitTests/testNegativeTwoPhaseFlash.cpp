@@ -14,6 +14,8 @@
 
 // Source includes
 #include "codingUtilities/UnitTestUtilities.hpp"
+#include "constitutive/fluid/multifluid/compositional/functions/BatchedNegativeTwoPhaseFlash.hpp"
+#include "constitutive/fluid/multifluid/compositional/functions/FlashWarmStartCache.hpp"
 #include "constitutive/fluid/multifluid/compositional/functions/NegativeTwoPhaseFlash.hpp"
 #include "constitutive/fluid/multifluid/compositional/functions/CubicEOSPhaseModel.hpp"
 #include "TestFluid.hpp"
@@ -131,6 +133,99 @@ public:
     }
   }
 
+  void testBatchedFlash( FlashData< NC > const & data )
+  {
+    // the number of cells is not a multiple of the batch size to exercise partial batches
+    constexpr integer batchSize = 4;
+    constexpr integer numCells = 5;
+
+    real64 const expectedPressure = std::get< 0 >( data );
+    real64 const expectedTemperature = std::get< 1 >( data );
+    stackArray1d< real64, NC > feed;
+    TestFluid< NC >::createArray( feed, std::get< 2 >( data ));
+
+    bool const expectedStatus = std::get< 3 >( data );
+    real64 const expectedVapourFraction = std::get< 4 >( data );
+
+    stackArray1d< real64, NC > expectedLiquidComposition;
+    TestFluid< NC >::createArray( expectedLiquidComposition, std::get< 5 >( data ));
+    stackArray1d< real64, NC > expectedVapourComposition;
+    TestFluid< NC >::createArray( expectedVapourComposition, std::get< 6 >( data ));
+
+    array1d< real64 > pressure( numCells );
+    array1d< real64 > temperature( numCells );
+    array2d< real64 > composition( numCells, numComps );
+    for( integer k = 0; k < numCells; ++k )
+    {
+      pressure[k] = expectedPressure;
+      temperature[k] = expectedTemperature;
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        composition[k][ic] = feed[ic];
+      }
+    }
+
+    array1d< real64 > vapourFraction( numCells );
+    array2d< real64 > liquidComposition( numCells, numComps );
+    array2d< real64 > vapourComposition( numCells, numComps );
+    array1d< integer > converged( numCells );
+
+    auto const flashAndCheck = [&]( constitutive::FlashWarmStartCache::KernelWrapper const & warmStart )
+    {
+      bool const status = constitutive::BatchedNegativeTwoPhaseFlash< batchSize >::compute< serialPolicy, EOS_TYPE, EOS_TYPE >(
+        numComps,
+        pressure.toViewConst(),
+        temperature.toViewConst(),
+        composition.toViewConst(),
+        m_fluid->getCriticalPressure(),
+        m_fluid->getCriticalTemperature(),
+        m_fluid->getAcentricFactor(),
+        binaryInteractionCoefficients,
+        vapourFraction.toView(),
+        liquidComposition.toView(),
+        vapourComposition.toView(),
+        converged.toView(),
+        warmStart );
+
+      // Check the flash success result
+      ASSERT_EQ( expectedStatus, status );
+
+      if( !expectedStatus )
+      {
+        return;
+      }
+
+      for( integer k = 0; k < numCells; ++k )
+      {
+        checkRelativeError( expectedVapourFraction, vapourFraction[k], relTol, absTol );
+
+        if( expectedVapourFraction < 1.0 - absTol )
+        {
+          for( integer ic=0; ic<numComps; ++ic )
+          {
+            checkRelativeError( expectedLiquidComposition[ic], liquidComposition[k][ic], relTol, absTol );
+          }
+        }
+
+        if( absTol < expectedVapourFraction )
+        {
+          for( integer ic=0; ic<numComps; ++ic )
+          {
+            checkRelativeError( expectedVapourComposition[ic], vapourComposition[k][ic], relTol, absTol );
+          }
+        }
+      }
+    };
+
+    // Cold start
+    flashAndCheck( constitutive::FlashWarmStartCache::KernelWrapper() );
+
+    // First flash fills the cache, the second one warm starts from it (or skips single-phase cells)
+    constitutive::FlashWarmStartCache cache( numCells, numComps, 1.0e-6 );
+    flashAndCheck( cache.createKernelWrapper() );
+    flashAndCheck( cache.createKernelWrapper() );
+  }
+
 protected:
   real64 const binaryInteractionCoefficients{0.0};
   std::unique_ptr< TestFluid< NC > > m_fluid{};
@@ -146,21 +241,41 @@ TEST_P( NegativeTwoPhaseFlash2CompPR, testNegativeFlash )
   testFlash( GetParam() );
 }
 
+TEST_P( NegativeTwoPhaseFlash2CompPR, testBatchedNegativeFlash )
+{
+  testBatchedFlash( GetParam() );
+}
+
 TEST_P( NegativeTwoPhaseFlash2CompSRK, testNegativeFlash )
 {
   testFlash( GetParam() );
 }
 
+TEST_P( NegativeTwoPhaseFlash2CompSRK, testBatchedNegativeFlash )
+{
+  testBatchedFlash( GetParam() );
+}
+
 TEST_P( NegativeTwoPhaseFlash4CompPR, testNegativeFlash )
 {
   testFlash( GetParam() );
 }
 
+TEST_P( NegativeTwoPhaseFlash4CompPR, testBatchedNegativeFlash )
+{
+  testBatchedFlash( GetParam() );
+}
+
 TEST_P( NegativeTwoPhaseFlash4CompSRK, testNegativeFlash )
 {
   testFlash( GetParam() );
 }
 
+TEST_P( NegativeTwoPhaseFlash4CompSRK, testBatchedNegativeFlash )
+{
+  testBatchedFlash( GetParam() );
+}
+
 //-------------------------------------------------------------------------------
 // Data generated by PVTPackage
 //-------------------------------------------------------------------------------
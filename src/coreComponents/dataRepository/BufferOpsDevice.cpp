@@ -307,6 +307,125 @@ UnpackByIndexDevice ( buffer_unit_type const * & buffer,
   return unpackSize;
 }
 
+template< bool DO_PACKING, int NDIM, int USD >
+localIndex
+PackByIndexSinglePrecision( buffer_unit_type * & buffer,
+                            ArrayView< real64 const, NDIM, USD > const & var,
+                            arrayView1d< localIndex const > const & indices,
+                            bool onDevice,
+                            parallelDeviceEvents & events )
+{
+  localIndex const numIndices = indices.size();
+  localIndex const sliceSize = numIndices > 0 ? var.size() / var.size( 0 ) : 0;
+  localIndex const dataSize = numIndices * sliceSize * sizeof( real32 );
+  if( DO_PACKING )
+  {
+    uintptr_t const misalignment = reinterpret_cast< uintptr_t >( buffer ) % sizeof( real32 );
+    if( misalignment != 0 )
+    {
+      buffer += sizeof( real32 ) - misalignment;
+    }
+
+    real32 * const packBuffer = reinterpret_cast< real32 * >( buffer );
+    auto const packSlice = [=] GEOS_HOST_DEVICE ( localIndex const ii )
+    {
+      real32 * threadBuffer = &packBuffer[ ii * sliceSize ];
+      LvArray::forValuesInSlice( var[ indices[ ii ] ], [&] GEOS_HOST_DEVICE ( real64 const & value )
+      {
+        *threadBuffer = static_cast< real32 >( value );
+        ++threadBuffer;
+      } );
+    };
+    if( onDevice )
+    {
+      parallelDeviceStream stream;
+      events.emplace_back( forAll< parallelDevicePolicy< > >( stream, numIndices, packSlice ) );
+    }
+    else
+    {
+      forAll< serialPolicy >( numIndices, packSlice );
+    }
+
+    buffer += dataSize;
+  }
+  return sizeof( real32 ) - 1 + dataSize;
+}
+
+template< int NDIM, int USD >
+localIndex
+UnpackByIndexSinglePrecision( buffer_unit_type const * & buffer,
+                              ArrayView< real64, NDIM, USD > const & var,
+                              arrayView1d< localIndex const > const & indices,
+                              bool onDevice,
+                              parallelDeviceEvents & events,
+                              MPI_Op op )
+{
+  GEOS_ERROR_IF( op != MPI_REPLACE && op != MPI_SUM,
+                 "Unsupported MPI operator! MPI_SUM and MPI_REPLACE are supported for the single precision transport." );
+
+  localIndex const numIndices = indices.size();
+  localIndex const sliceSize = numIndices > 0 ? var.size() / var.size( 0 ) : 0;
+  localIndex const dataSize = numIndices * sliceSize * sizeof( real32 );
+
+  uintptr_t const misalignment = reinterpret_cast< uintptr_t >( buffer ) % sizeof( real32 );
+  if( misalignment != 0 )
+  {
+    buffer += sizeof( real32 ) - misalignment;
+  }
+
+  real32 const * const unpackBuffer = reinterpret_cast< real32 const * >( buffer );
+  bool const add = ( op == MPI_SUM );
+  auto const unpackSlice = [=] GEOS_HOST_DEVICE ( localIndex const ii )
+  {
+    real32 const * threadBuffer = &unpackBuffer[ ii * sliceSize ];
+    LvArray::forValuesInSlice( var[ indices[ ii ] ], [&] GEOS_HOST_DEVICE ( real64 & value )
+    {
+      value = add ? value + *threadBuffer : *threadBuffer;
+      ++threadBuffer;
+    } );
+  };
+  if( onDevice )
+  {
+    parallelDeviceStream stream;
+    events.emplace_back( forAll< parallelDeviceAsyncPolicy<> >( stream, numIndices, unpackSlice ) );
+  }
+  else
+  {
+    forAll< serialPolicy >( numIndices, unpackSlice );
+  }
+
+  buffer += dataSize;
+  return sizeof( real32 ) - 1 + dataSize;
+}
+
+#define DECLARE_SINGLE_PRECISION_PACK_UNPACK( NDIM, USD ) \
+  template localIndex PackByIndexSinglePrecision< true, NDIM, USD > \
+    ( buffer_unit_type * &buffer, \
+    ArrayView< real64 const, NDIM, USD > const & var, \
+    arrayView1d< localIndex const > const & indices, \
+    bool onDevice, \
+    parallelDeviceEvents & events ); \
+  template localIndex PackByIndexSinglePrecision< false, NDIM, USD > \
+    ( buffer_unit_type * &buffer, \
+    ArrayView< real64 const, NDIM, USD > const & var, \
+    arrayView1d< localIndex const > const & indices, \
+    bool onDevice, \
+    parallelDeviceEvents & events ); \
+  template localIndex UnpackByIndexSinglePrecision< NDIM, USD > \
+    ( buffer_unit_type const * & buffer, \
+    ArrayView< real64, NDIM, USD > const & var, \
+    arrayView1d< localIndex const > const & indices, \
+    bool onDevice, \
+    parallelDeviceEvents & events, \
+    MPI_Op op )
+
+DECLARE_SINGLE_PRECISION_PACK_UNPACK( 1, 0 );
+DECLARE_SINGLE_PRECISION_PACK_UNPACK( 2, 0 );
+DECLARE_SINGLE_PRECISION_PACK_UNPACK( 2, 1 );
+DECLARE_SINGLE_PRECISION_PACK_UNPACK( 3, 0 );
+DECLARE_SINGLE_PRECISION_PACK_UNPACK( 3, 1 );
+DECLARE_SINGLE_PRECISION_PACK_UNPACK( 3, 2 );
+
 #define DECLARE_PACK_UNPACK( TYPE, NDIM, USD ) \
   template localIndex PackDevice< true, TYPE, NDIM, USD > \
     ( buffer_unit_type * &buffer, \
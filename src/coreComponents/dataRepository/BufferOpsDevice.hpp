@@ -224,6 +224,45 @@ UnpackDataByIndexDevice( buffer_unit_type const * & GEOS_UNUSED_PARAM( buffer ),
   return 0;
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Pack selected indices of an array of real64, converted to real32.
+ * @tparam DO_PACKING whether to pack or only compute the packed size
+ * @param buffer the buffer, advanced upon completion
+ * @param var the array to pack
+ * @param indices the indices to pack
+ * @param onDevice whether the conversion kernel runs on device or on host
+ * @param events the events of the device kernels
+ * @return the packed size
+ */
+template< bool DO_PACKING, int NDIM, int USD >
+localIndex
+PackByIndexSinglePrecision( buffer_unit_type * & buffer,
+                            ArrayView< real64 const, NDIM, USD > const & var,
+                            arrayView1d< localIndex const > const & indices,
+                            bool onDevice,
+                            parallelDeviceEvents & events );
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Unpack selected indices of an array of real64 packed with PackByIndexSinglePrecision.
+ * @param buffer the buffer, advanced upon completion
+ * @param var the array to unpack into
+ * @param indices the indices to unpack
+ * @param onDevice whether the conversion kernel runs on device or on host
+ * @param events the events of the device kernels
+ * @param op the operation applied to the unpacked values (MPI_REPLACE or MPI_SUM)
+ * @return the unpacked size
+ */
+template< int NDIM, int USD >
+localIndex
+UnpackByIndexSinglePrecision( buffer_unit_type const * & buffer,
+                              ArrayView< real64, NDIM, USD > const & var,
+                              arrayView1d< localIndex const > const & indices,
+                              bool onDevice,
+                              parallelDeviceEvents & events,
+                              MPI_Op op=MPI_REPLACE );
+
 } // namespace bufferOps
 } // namespace geos
 
@@ -1275,6 +1275,59 @@ Unpack( buffer_unit_type const * & buffer,
   return sizeOfUnpackedChars;
 }
 
+namespace internal
+{
+
+/**
+ * @brief Pack the entries of a map in parallel.
+ * @tparam DO_PACKING whether the entries are packed, or only sized
+ * @tparam SIZE_FUNC type of the function returning the packed size of an entry
+ * @tparam PACK_FUNC type of the function packing an entry
+ * @param buffer the buffer, advanced past the packed entries
+ * @param numEntries the number of entries
+ * @param entrySize the function, called as entrySize( a ), returning the number of packed chars of the entry @p a
+ * @param packEntry the function, called as packEntry( entryBuffer, a ), packing the entry @p a at @p entryBuffer
+ * @return the number of packed chars of all the entries
+ *
+ * @details The entries are written at the offsets given by the prefix sum of their sizes, so that
+ *          the buffer is the same as the one of a serial packing of the entries in order.
+ */
+template< bool DO_PACKING, typename SIZE_FUNC, typename PACK_FUNC >
+localIndex packEntriesInParallel( buffer_unit_type * & buffer,
+                                  localIndex const numEntries,
+                                  SIZE_FUNC && entrySize,
+                                  PACK_FUNC && packEntry )
+{
+  if( !DO_PACKING )
+  {
+    RAJA::ReduceSum< parallelHostReduce, localIndex > sizeOfPackedChars( 0 );
+    forAll< parallelHostPolicy >( numEntries, [=]( localIndex const a )
+    {
+      sizeOfPackedChars += entrySize( a );
+    } );
+    return sizeOfPackedChars.get();
+  }
+
+  array1d< localIndex > offsets( numEntries + 1 );
+  forAll< parallelHostPolicy >( numEntries, [&]( localIndex const a )
+  {
+    offsets[a + 1] = entrySize( a );
+  } );
+  RAJA::inclusive_scan_inplace< parallelHostPolicy >( RAJA::make_span( offsets.data(), numEntries + 1 ) );
+
+  buffer_unit_type * const begin = buffer;
+  forAll< parallelHostPolicy >( numEntries, [&]( localIndex const a )
+  {
+    buffer_unit_type * entryBuffer = begin + offsets[a];
+    packEntry( entryBuffer, a );
+  } );
+
+  buffer += offsets[numEntries];
+  return offsets[numEntries];
+}
+
+} // namespace internal
+
 template< bool DO_PACKING, typename SORTED >
 localIndex
 Pack( buffer_unit_type * & buffer,
@@ -1284,14 +1337,21 @@ Pack( buffer_unit_type * & buffer,
       arrayView1d< globalIndex const > const & localToGlobalMap,
       arrayView1d< globalIndex const > const & relatedObjectLocalToGlobalMap )
 {
-  localIndex sizeOfPackedChars=0;
-  array1d< globalIndex > junk;
+  array1d< globalIndex > const junk;
 
-  sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
-  for( localIndex a=0; a<indices.size(); ++a )
+  localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, indices.size() );
+
+  // each entry holds its global index, the length of its array and the global indices of the array
+  auto entrySize = [&]( localIndex const a )
+  {
+    return LvArray::integerConversion< localIndex >( sizeof( globalIndex ) + sizeof( localIndex ) +
+                                                     var.sizeOfArray( indices[a] ) * sizeof( globalIndex ) );
+  };
+
+  auto packEntry = [&]( buffer_unit_type * & entryBuffer, localIndex const a )
   {
     localIndex const li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    Pack< true >( entryBuffer, localToGlobalMap[li] );
 
     typename mapBase< localIndex, array1d< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1300,12 +1360,14 @@ Pack( buffer_unit_type * & buffer,
                                                 junk :
                                                 iterUnmappedGI->second;
 
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer,
-                                             var[li],
-                                             unmappedGI.data(),
-                                             var.sizeOfArray( li ),
-                                             relatedObjectLocalToGlobalMap );
-  }
+    Pack< true >( entryBuffer,
+                  var[li],
+                  unmappedGI.data(),
+                  var.sizeOfArray( li ),
+                  relatedObjectLocalToGlobalMap );
+  };
+
+  sizeOfPackedChars += internal::packEntriesInParallel< DO_PACKING >( buffer, indices.size(), entrySize, packEntry );
 
   return sizeOfPackedChars;
 }
@@ -1319,14 +1381,21 @@ Pack( buffer_unit_type * & buffer,
       arrayView1d< globalIndex const > const & localToGlobalMap,
       arrayView1d< globalIndex const > const & relatedObjectLocalToGlobalMap )
 {
-  localIndex sizeOfPackedChars=0;
-  SortedArray< globalIndex > junk;
+  SortedArray< globalIndex > const junk;
 
-  sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
-  for( localIndex a=0; a<indices.size(); ++a )
+  localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, indices.size() );
+
+  // each entry holds its global index, the length of its array and the global indices of the array
+  auto entrySize = [&]( localIndex const a )
+  {
+    return LvArray::integerConversion< localIndex >( sizeof( globalIndex ) + sizeof( localIndex ) +
+                                                     var.sizeOfArray( indices[a] ) * sizeof( globalIndex ) );
+  };
+
+  auto packEntry = [&]( buffer_unit_type * & entryBuffer, localIndex const a )
   {
     localIndex const li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    Pack< true >( entryBuffer, localToGlobalMap[li] );
 
     typename mapBase< localIndex, SortedArray< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1335,12 +1404,14 @@ Pack( buffer_unit_type * & buffer,
                                                     junk :
                                                     iterUnmappedGI->second;
 
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer,
-                                             var[li],
-                                             unmappedGI.data(),
-                                             var.sizeOfArray( li ),
-                                             relatedObjectLocalToGlobalMap );
-  }
+    Pack< true >( entryBuffer,
+                  var[li],
+                  unmappedGI.data(),
+                  var.sizeOfArray( li ),
+                  relatedObjectLocalToGlobalMap );
+  };
+
+  sizeOfPackedChars += internal::packEntriesInParallel< DO_PACKING >( buffer, indices.size(), entrySize, packEntry );
 
   return sizeOfPackedChars;
 }
@@ -21,19 +21,145 @@
 #include "common/MpiWrapper.hpp"
 #include "common/TimingMacros.hpp"
 #include "common/Path.hpp"
+#include "common/Span.hpp"
 
 // TPL includes
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_hdf5.hpp>
+#include <hdf5.h>
+
+// System includes
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <string_view>
 
 namespace geos
 {
 namespace dataRepository
 {
 
-string writeRootFile( conduit::Node & root, string const & rootPath )
+namespace
+{
+
+/// Name of the node replacing data written in an earlier restart file, holding the location of that data
+constexpr char const * referenceKey = "__restartReference__";
+
+/// Size below which data is always written, even if it did not change
+constexpr std::size_t minReferencedBytes = 4096;
+
+/// Name of the node replacing the values of an array read directly into the array, holding the location of the values
+constexpr char const * deferredValuesKey = "__deferredValues__";
+
+/// @return the restart files opened to read the deferred values, by path
+std::map< string, hid_t > & openedRestartFiles()
+{
+  static std::map< string, hid_t > files;
+  return files;
+}
+
+/**
+ * @brief Get a restart file opened for reading, opening it if needed.
+ * @param filePath the path of the file
+ * @return the HDF5 identifier of the file
+ */
+hid_t getRestartFile( string const & filePath )
+{
+  std::map< string, hid_t > & files = openedRestartFiles();
+  auto it = files.find( filePath );
+  if( it == files.end() )
+  {
+    it = files.emplace( filePath, conduit::relay::io::hdf5_open_file_for_read( filePath ) ).first;
+  }
+  return it->second;
+}
+
+/**
+ * @brief Check whether an object of a HDF5 file is a group.
+ * @param file the HDF5 identifier of the file
+ * @param path the path of the object in the file
+ * @return true if the object is a group, false if it is a dataset
+ */
+bool isHdf5Group( hid_t const file, string const & path )
+{
+  hid_t const object = H5Oopen( file, path.c_str(), H5P_DEFAULT );
+  GEOS_ERROR_IF_LT_MSG( object, 0, "Unable to open " << path << " in the restart file" );
+  bool const isGroup = H5Iget_type( object ) == H5I_GROUP;
+  H5Oclose( object );
+  return isGroup;
+}
+
+/**
+ * @brief Read a tree of a restart file, except the values of the arrays, replaced by their location.
+ * @param filePath the path of the file
+ * @param path the path of the tree in the file
+ * @param rootDirName the directory of the root file, to which the references to earlier restart files are relative
+ * @param node the node receiving the tree
+ */
+void readTreeWithoutArrayValues( string const & filePath,
+                                 string const & path,
+                                 string const & rootDirName,
+                                 conduit::Node & node )
+{
+  hid_t const file = getRestartFile( filePath );
+  std::vector< std::string > childNames;
+  conduit::relay::io::hdf5_group_list_child_names( file, path, childNames );
+
+  // the values of the arrays written without packing come with their dimensions
+  bool const isArray = std::find( childNames.begin(), childNames.end(), "__dimensions__" ) != childNames.end();
+  for( std::string const & childName : childNames )
+  {
+    string const childPath = path.empty() || path == "/" ? childName : path + "/" + childName;
+    bool const isGroup = isHdf5Group( file, childPath );
+    if( isArray && childName == "__values__" )
+    {
+      if( !isGroup )
+      {
+        node[ deferredValuesKey ] = filePath + ":" + childPath;
+        continue;
+      }
+      conduit::Node reference;
+      conduit::relay::io::hdf5_read( file, childPath, reference );
+      if( reference.number_of_children() == 1 && reference.has_child( referenceKey ) )
+      {
+        node[ deferredValuesKey ] = joinPath( rootDirName, reference[ referenceKey ].as_string() );
+        continue;
+      }
+    }
+
+    if( isGroup )
+    {
+      readTreeWithoutArrayValues( filePath, childPath, rootDirName, node[ childName ] );
+    }
+    else
+    {
+      conduit::relay::io::hdf5_read( file, childPath, node[ childName ] );
+    }
+  }
+}
+
+/**
+ * @brief Get the number of consecutive ranks whose trees are written in the same file.
+ * @param numWriters the requested number of ranks writing files, 0 for one file per rank
+ * @return the number of ranks per file
+ */
+int getRanksPerFile( integer const numWriters )
+{
+  int const numRanks = MpiWrapper::commSize();
+  if( numWriters <= 0 || numWriters >= numRanks )
+  {
+    return 1;
+  }
+  return ( numRanks + numWriters - 1 ) / numWriters;
+}
+
+string writeRootFile( conduit::Node & root, string const & rootPath, int const ranksPerFile )
 {
   string const completeRootPath = rootPath;
   string const rootFileName = splitPath( completeRootPath ).second;
+  int const numRanks = MpiWrapper::commSize();
 
   if( MpiWrapper::commRank() == 0 )
   {
@@ -42,30 +168,97 @@ string writeRootFile( conduit::Node & root, string const & rootPath )
     root[ "protocol/name" ] = "hdf5";
     root[ "protocol/version" ] = CONDUIT_VERSION;
 
-    root[ "number_of_files" ] = MpiWrapper::commSize();
+    // files are named after the rank writing them
+    root[ "number_of_files" ] = ( numRanks + ranksPerFile - 1 ) / ranksPerFile;
     root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
 
-    root[ "number_of_trees" ] = 1;
-    root[ "tree_pattern" ] = "/";
+    if( ranksPerFile == 1 )
+    {
+      root[ "number_of_trees" ] = 1;
+      root[ "tree_pattern" ] = "/";
+    }
+    else
+    {
+      root[ "number_of_trees" ] = numRanks;
+      root[ "tree_pattern" ] = "rank_%07d";
+      root[ "ranks_per_file" ] = ranksPerFile;
+    }
 
     conduit::relay::io::save( root, completeRootPath + ".root", "hdf5" );
   }
 
   MpiWrapper::barrier( MPI_COMM_GEOSX );
-  return GEOS_FMT( "{}/rank_{:07}.hdf5", completeRootPath.data(), MpiWrapper::commRank() );
+  return GEOS_FMT( "{}/rank_{:07}.hdf5", completeRootPath.data(), ( MpiWrapper::commRank() / ranksPerFile ) * ranksPerFile );
+}
+
+/**
+ * @brief Gather a buffer of each rank of a communicator on its first rank.
+ * @param[in] buffer the buffer of the current rank
+ * @param[in] comm the communicator
+ * @param[out] allBuffers the concatenated buffers, on the first rank only
+ * @param[out] offsets the offset of the buffer of each rank in @p allBuffers, followed by the total size
+ */
+void gatherBuffers( Span< char const > const buffer,
+                    MPI_Comm const comm,
+                    std::vector< char > & allBuffers,
+                    std::vector< int > & offsets )
+{
+  GEOS_ERROR_IF_GT_MSG( buffer.size(), static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                        "Restart tree is too large to be sent to its writer" );
+  int const bufferSize = static_cast< int >( buffer.size() );
+
+  int const groupRank = MpiWrapper::commRank( comm );
+  int const groupSize = MpiWrapper::commSize( comm );
+  std::vector< int > sizes( groupSize );
+  MpiWrapper::gather( &bufferSize, 1, sizes.data(), 1, 0, comm );
+
+  offsets.assign( groupSize + 1, 0 );
+  std::size_t totalSize = 0;
+  for( int r = 0; r < groupSize; ++r )
+  {
+    offsets[r] = static_cast< int >( totalSize );
+    totalSize += sizes[r];
+  }
+  GEOS_ERROR_IF_GT_MSG( totalSize, static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                        "Restart trees are too large to be gathered on their writer, the number of writers should be increased" );
+  offsets[groupSize] = static_cast< int >( totalSize );
+
+  allBuffers.resize( groupRank == 0 ? totalSize : 0 );
+  MpiWrapper::gatherv( buffer.data(), bufferSize, allBuffers.data(), sizes.data(), offsets.data(), 0, comm );
+}
+
+} // namespace
+
+string writeRootFile( conduit::Node & root, string const & rootPath )
+{
+  return writeRootFile( root, rootPath, 1 );
 }
 
 
-string readRootNode( string const & rootPath )
+string readRootNode( string const & rootPath, string & treePath )
 {
   string rankFilePattern;
+  string treePattern;
+  int ranksPerFile = 1;
+  int numWrittenRanks = 0;
   if( MpiWrapper::commRank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
     int const nFiles = node.child( "number_of_files" ).value();
-    GEOS_THROW_IF_NE( nFiles, MpiWrapper::commSize(), InputError );
+    int const nTrees = node.child( "number_of_trees" ).value();
+    if( nTrees == 1 )
+    {
+      numWrittenRanks = nFiles;
+    }
+    else
+    {
+      // aggregated files contain one tree per rank
+      numWrittenRanks = nTrees;
+      ranksPerFile = node.fetch_existing( "ranks_per_file" ).value();
+      treePattern = node.fetch_existing( "tree_pattern" ).as_string();
+    }
 
     string const filePattern = node.fetch_existing( "file_pattern" ).as_string();
     string const rootDirName = splitPath( rootPath ).first;
@@ -74,29 +267,205 @@ string readRootNode( string const & rootPath )
     GEOS_LOG_RANK_VAR( rankFilePattern );
   }
 
+  // checked on all the ranks, so that they all stop
+  MpiWrapper::broadcast( numWrittenRanks, 0 );
+  GEOS_THROW_IF_NE_MSG( numWrittenRanks, MpiWrapper::commSize(),
+                        GEOS_FMT( "The restart {} was written with {} ranks, but the simulation runs with {} ranks. "
+                                  "The restart data (local maps, ghosts, neighbors) is specific to the partition it was "
+                                  "written with, so a simulation must be restarted with the same number of ranks",
+                                  rootPath, numWrittenRanks, MpiWrapper::commSize() ),
+                        InputError );
+
   MpiWrapper::broadcast( rankFilePattern, 0 );
+  MpiWrapper::broadcast( treePattern, 0 );
+  MpiWrapper::broadcast( ranksPerFile, 0 );
 
+  int const rank = MpiWrapper::commRank();
   char buffer[ 1024 ];
-  GEOS_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::commRank() ), 1024 );
+  if( !treePattern.empty() )
+  {
+    GEOS_ERROR_IF_GE( std::snprintf( buffer, 1024, treePattern.data(), rank ), 1024 );
+    treePath = buffer;
+  }
+  GEOS_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), ( rank / ranksPerFile ) * ranksPerFile ), 1024 );
   return buffer;
 }
 
-void writeTree( string const & path, conduit::Node & root )
+string gatherTree( string const & path,
+                   conduit::Node & root,
+                   integer const numWriters,
+                   bool const copyData,
+                   conduit::Node & output )
 {
   GEOS_MARK_FUNCTION;
 
+  int const ranksPerFile = getRanksPerFile( numWriters );
   conduit::Node rootFileNode;
-  string const filePathForRank = writeRootFile( rootFileNode, path );
-  GEOS_LOG_RANK( "Writing out restart file at " << filePathForRank );
-  conduit::relay::io::save( root, filePathForRank, "hdf5" );
+  string const filePathForRank = writeRootFile( rootFileNode, path, ranksPerFile );
+
+  if( ranksPerFile == 1 )
+  {
+    if( copyData )
+    {
+      root.compact_to( output );
+    }
+    else
+    {
+      output.set_external( root );
+    }
+    return filePathForRank;
+  }
+
+  // the trees are sent with their compact schema, so that the writer can rebuild them
+  conduit::Schema schema;
+  root.schema().compact_to( schema );
+  string schemaJson = schema.to_json();
+  std::vector< conduit::uint8 > data;
+  root.serialize( data );
+
+  int const rank = MpiWrapper::commRank();
+  MPI_Comm groupComm = MpiWrapper::commSplit( MPI_COMM_GEOSX, rank / ranksPerFile, rank );
+  bool const isWriter = MpiWrapper::commRank( groupComm ) == 0;
+
+  std::vector< char > allSchemas;
+  std::vector< int > schemaOffsets;
+  gatherBuffers( Span< char const >( schemaJson.data(), schemaJson.size() ), groupComm, allSchemas, schemaOffsets );
+  schemaJson.clear();
+
+  std::vector< char > allData;
+  std::vector< int > dataOffsets;
+  gatherBuffers( Span< char const >( reinterpret_cast< char const * >( data.data() ), data.size() ), groupComm, allData, dataOffsets );
+  data = std::vector< conduit::uint8 >();
+
+  if( isWriter )
+  {
+    for( std::size_t r = 0; r + 1 < schemaOffsets.size(); ++r )
+    {
+      string const rankSchema( allSchemas.data() + schemaOffsets[r], schemaOffsets[r + 1] - schemaOffsets[r] );
+      conduit::Generator const generator( rankSchema, "conduit_json", allData.data() + dataOffsets[r] );
+      generator.walk( output[ GEOS_FMT( "rank_{:07}", rank + r ) ] );
+    }
+  }
+
+  MpiWrapper::commFree( groupComm );
+  return isWriter ? filePathForRank : string();
+}
+
+void writeTree( string const & path, conduit::Node & root, integer const numWriters )
+{
+  GEOS_MARK_FUNCTION;
+
+  conduit::Node output;
+  string const filePath = gatherTree( path, root, numWriters, false, output );
+  if( !filePath.empty() )
+  {
+    GEOS_LOG_RANK( "Writing out restart file at " << filePath );
+    conduit::relay::io::save( output, filePath, "hdf5" );
+  }
+}
+
+void referenceUnchangedData( conduit::Node & output, string const & filePath, RestartDataIndex & writtenData )
+{
+  GEOS_MARK_FUNCTION;
+
+  // the references are relative to the directory of the root file, so that restarts can be moved
+  std::pair< string, string > const fileSplit = splitPath( filePath );
+  string const fileName = joinPath( splitPath( fileSplit.first ).second, fileSplit.second );
+
+  std::function< void( conduit::Node & ) > const referenceNode = [&]( conduit::Node & node )
+  {
+    if( node.number_of_children() > 0 )
+    {
+      for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+      {
+        referenceNode( node.child( i ) );
+      }
+      return;
+    }
+
+    // small values are cheaper to rewrite than to reference
+    std::size_t const numBytes = LvArray::integerConversion< std::size_t >( node.total_bytes_compact() );
+    if( !node.dtype().is_number() || !node.is_compact() || numBytes < minReferencedBytes )
+    {
+      return;
+    }
+
+    string const nodePath = node.path();
+    std::size_t const hash = std::hash< std::string_view >{}( std::string_view( static_cast< char const * >( node.data_ptr() ), numBytes ) );
+    auto const written = writtenData.find( nodePath );
+    if( written != writtenData.end() && written->second.first == hash )
+    {
+      node.reset();
+      node[ referenceKey ] = written->second.second;
+    }
+    else
+    {
+      writtenData[ nodePath ] = { hash, fileName + ":" + nodePath };
+    }
+  };
+  referenceNode( output );
 }
 
 void loadTree( string const & path, conduit::Node & root )
 {
   GEOS_MARK_FUNCTION;
-  string const filePathForRank = readRootNode( path );
-  GEOS_LOG_RANK( "Reading in restart file at " << filePathForRank );
-  conduit::relay::io::load( filePathForRank, "hdf5", root );
+  string treePath;
+  string const filePathForRank = readRootNode( path, treePath );
+  GEOS_LOG_RANK( "Reading in restart file at " << filePathForRank << ( treePath.empty() ? "" : ":" + treePath ) );
+
+  // the values of the arrays are not loaded in the tree, they are read directly into the arrays by loadFromConduit
+  string const rootDirName = splitPath( path ).first;
+  readTreeWithoutArrayValues( filePathForRank, treePath.empty() ? "/" : treePath, rootDirName, root );
+
+  // load the (other) data written in earlier restart files
+  std::function< void( conduit::Node & ) > const resolveReferences = [&]( conduit::Node & node )
+  {
+    if( node.number_of_children() == 1 && node.has_child( referenceKey ) )
+    {
+      string const reference = node[ referenceKey ].as_string();
+      node.reset();
+      conduit::relay::io::load( joinPath( rootDirName, reference ), "hdf5", node );
+      return;
+    }
+    for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+    {
+      resolveReferences( node.child( i ) );
+    }
+  };
+  resolveReferences( root );
+}
+
+bool readDeferredValues( conduit::Node const & node, conduit::DataType const & dtype, void * const data )
+{
+  if( !node.has_child( deferredValuesKey ) )
+  {
+    return false;
+  }
+
+  string const location = node.fetch_existing( deferredValuesKey ).as_string();
+  std::size_t const separator = location.rfind( ':' );
+  GEOS_ERROR_IF( separator == string::npos, "Invalid location of restart values: " << location );
+
+  // the dataset is read into the memory of the array when it is compatible with it, and copied otherwise
+  conduit::Node values;
+  values.set_external( dtype, data );
+  conduit::relay::io::hdf5_read( getRestartFile( location.substr( 0, separator ) ), location.substr( separator + 1 ), values );
+  if( values.data_ptr() != data )
+  {
+    GEOS_ERROR_IF_NE_MSG( values.dtype().strided_bytes(), dtype.strided_bytes(),
+                          "The restart values at " << location << " do not match the array they are read into" );
+    std::memcpy( data, values.data_ptr(), dtype.strided_bytes() );
+  }
+  return true;
+}
+
+void finishLoadingTree()
+{
+  for( auto const & file : openedRestartFiles() )
+  {
+    conduit::relay::io::hdf5_close_file( file.second );
+  }
+  openedRestartFiles().clear();
 }
 
 } /* end namespace dataRepository */
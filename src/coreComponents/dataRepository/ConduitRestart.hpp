@@ -27,6 +27,7 @@
 #include <conduit.hpp>
 
 // System includes
+#include <unordered_map>
 
 
 /// @cond DO_NOT_DOCUMENT
@@ -90,10 +91,61 @@ using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::rem
 
 string writeRootFile( conduit::Node & root, string const & rootPath );
 
-void writeTree( string const & path, conduit::Node & root );
+/**
+ * @brief Write the root file of a restart and gather the trees of the ranks in the trees to be written.
+ * @param path the path of the restart, without extension
+ * @param root the tree of the current rank
+ * @param numWriters the number of ranks writing files, each one writing the trees of a group of consecutive ranks,
+ *                   or 0 for one file per rank
+ * @param copyData whether the data of @p root must be copied, so that @p output can be written after @p root changes
+ * @param output the trees to be written by the current rank
+ * @return the file to be written by the current rank, or an empty string if it does not write any file
+ */
+string gatherTree( string const & path,
+                   conduit::Node & root,
+                   integer const numWriters,
+                   bool const copyData,
+                   conduit::Node & output );
+
+void writeTree( string const & path, conduit::Node & root, integer const numWriters = 0 );
+
+/// For each data node written in full, the hash of its data and its location relative to the restart directory
+using RestartDataIndex = std::unordered_map< string, std::pair< std::size_t, string > >;
 
+/**
+ * @brief Replace the data nodes of @p output that did not change since they were last written with a reference
+ *        to the restart file they were written in. The references are resolved by loadTree.
+ * @param output the trees to be written by the current rank, as returned by gatherTree
+ * @param filePath the file to be written by the current rank, as returned by gatherTree
+ * @param writtenData the data written in the earlier restart files, updated with the data written in full in @p filePath
+ */
+void referenceUnchangedData( conduit::Node & output, string const & filePath, RestartDataIndex & writtenData );
+
+/**
+ * @brief Load the tree of the current rank from a restart.
+ * @param path the path of the restart, without extension
+ * @param root the node receiving the tree
+ *
+ * @details The values of the arrays are not loaded in the tree: they are replaced by their location, so that
+ *          loadFromConduit reads them directly into the arrays (see readDeferredValues), wrapper by wrapper.
+ *          The restart files stay open until finishLoadingTree is called.
+ */
 void loadTree( string const & path, conduit::Node & root );
 
+/**
+ * @brief Read the values of an array, deferred by loadTree, directly into the memory of the array.
+ * @param node the node of the wrapper of the array
+ * @param dtype the data type of the array memory, that must match the written values
+ * @param data the memory of the array, sized to receive the values
+ * @return true if the values were deferred and have been read, false if they are in the tree
+ */
+bool readDeferredValues( conduit::Node const & node, conduit::DataType const & dtype, void * const data );
+
+/**
+ * @brief Close the restart files opened by loadTree, once the tree has been loaded by loadFromConduit.
+ */
+void finishLoadingTree();
+
 } // namespace dataRepository
 } // namespace geos
 
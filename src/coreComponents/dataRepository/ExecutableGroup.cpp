@@ -35,4 +35,15 @@ void ExecutableGroup::cleanup( real64 const GEOS_UNUSED_PARAM( time_n ),
                                DomainPartition & GEOS_UNUSED_PARAM( domain ) )
 {}
 
+ExecutableGroup::ReadOnlyTask ExecutableGroup::executeReadOnly( real64 const GEOS_UNUSED_PARAM( time_n ),
+                                                                real64 const GEOS_UNUSED_PARAM( dt ),
+                                                                integer const GEOS_UNUSED_PARAM( cycleNumber ),
+                                                                integer const GEOS_UNUSED_PARAM( eventCounter ),
+                                                                real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                                                                DomainPartition & GEOS_UNUSED_PARAM( domain ) )
+{
+  GEOS_ERROR( getDataContext() << ": read-only execution is not supported" );
+  return {};
+}
+
 }
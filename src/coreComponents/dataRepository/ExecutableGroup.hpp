@@ -23,6 +23,8 @@
 #include "common/DataTypes.hpp"
 #include "Group.hpp"
 
+#include <functional>
+
 
 namespace geos
 {
@@ -86,6 +88,45 @@ public:
                         real64 const eventProgress,
                         DomainPartition & domain );
 
+  /**
+   * @brief Work of a read-only execution, run by the event manager after executeReadOnly has returned.
+   */
+  struct ReadOnlyTask
+  {
+    /// Work run on a task thread, concurrently with the following events: it may only use the snapshot
+    /// captured by executeReadOnly, and must neither access the data repository nor communicate.
+    std::function< void() > compute;
+    /// Work run on the main thread once compute is done, at the end of the following cycle and in the same
+    /// order on all the ranks, so that it can communicate (e.g. the MPI reductions and the logging).
+    std::function< void() > complete;
+  };
+
+  /**
+   * @brief Whether the target can be executed by a read-only event.
+   * @return true if executeReadOnly is implemented
+   */
+  virtual bool supportsReadOnlyExecution() const
+  { return false; }
+
+  /**
+   * @brief Extension point of the targets of read-only events.
+   * @param[in] time_n        current time level
+   * @param[in] dt            time step to be taken
+   * @param[in] cycleNumber   global cycle number
+   * @param[in] eventCounter  index of event that triggered execution
+   * @param[in] eventProgress fractional progress in current cycle
+   * @param[in] domain        the physical domain
+   * @return the work left once the state read by the target has been captured in a snapshot
+   *
+   * @details Only called if supportsReadOnlyExecution returns true. The target must not modify @p domain.
+   */
+  virtual ReadOnlyTask executeReadOnly( real64 const time_n,
+                                        real64 const dt,
+                                        integer const cycleNumber,
+                                        integer const eventCounter,
+                                        real64 const eventProgress,
+                                        DomainPartition & domain );
+
   /**
    * @brief Supplies the timestep request for this target to the event manager.
    * @param[in] time current time level
@@ -1089,12 +1089,14 @@ public:
   template< typename KEY >
   WrapperBase const & getWrapperBase( KEY const & key ) const
   {
-    WrapperBase const * const wrapper = m_wrappers[ key ];
+    // the deferred allocation of the wrapper is not an observable modification of the group
+    WrapperBase * const wrapper = const_cast< WrapperBase * >( m_wrappers[ key ] );
     GEOS_THROW_IF( wrapper == nullptr,
                    "Group " << getDataContext() << " has no wrapper named " << key << std::endl
                             << dumpWrappersNames(),
                    std::domain_error );
 
+    wrapper->allocateIfDeferred();
     return *wrapper;
   }
 
@@ -1110,6 +1112,7 @@ public:
                             << dumpWrappersNames(),
                    std::domain_error );
 
+    wrapper->allocateIfDeferred();
     return *wrapper;
   }
 
@@ -1206,14 +1209,28 @@ public:
    */
   template< typename T, typename LOOKUP_TYPE >
   Wrapper< T > const * getWrapperPointer( LOOKUP_TYPE const & index ) const
-  { return dynamicCast< Wrapper< T > const * >( m_wrappers[ index ] ); }
+  {
+    WrapperBase * const wrapper = const_cast< WrapperBase * >( m_wrappers[ index ] );
+    if( wrapper != nullptr )
+    {
+      wrapper->allocateIfDeferred();
+    }
+    return dynamicCast< Wrapper< T > const * >( wrapper );
+  }
 
   /**
    * @copydoc getWrapperPointer(LOOKUP_TYPE const &) const
    */
   template< typename T, typename LOOKUP_TYPE >
   Wrapper< T > * getWrapperPointer( LOOKUP_TYPE const & index )
-  { return dynamicCast< Wrapper< T > * >( m_wrappers[ index ] ); }
+  {
+    WrapperBase * const wrapper = m_wrappers[ index ];
+    if( wrapper != nullptr )
+    {
+      wrapper->allocateIfDeferred();
+    }
+    return dynamicCast< Wrapper< T > * >( wrapper );
+  }
 
   ///@}
 
@@ -20,7 +20,9 @@
 #define GEOS_DATAREPOSITORY_KEYINDEXT_HPP_
 
 
+#include <functional>
 #include <ostream>
+#include <type_traits>
 
 /**
  * @class KeyIndexT
@@ -32,7 +34,9 @@
  * is templated on a contains a KEY_TYPE, which is defaulted to a string, an
  * INDEX_TYPE that defaults to an int. The key is const, while the index is set
  * upon first use. The intent is to use the index for lookups, and check the
- * key to confirm the key is correct.
+ * key to confirm the key is correct. The hash of the key is computed once at
+ * construction, so that confirming the cached index or looking up another
+ * container does not require hashing the key again.
  */
 template< typename KEY_TYPE = std::string,
           typename INDEX_TYPE = int,
@@ -60,6 +64,7 @@ public:
    */
   KeyIndexT( KEY_TYPE const & key ):
     m_key( key ),
+    m_hash( std::hash< std::remove_const_t< KEY_TYPE > >{}( m_key ) ),
     m_index( INVALID_INDEX )
   {}
 
@@ -105,6 +110,13 @@ public:
   KEY_TYPE const & key() const
   { return m_key; }
 
+  /**
+   * @brief Access for the hash of the key, computed at construction.
+   * @return the hash of the key
+   */
+  std::size_t hash() const
+  { return m_hash; }
+
   /**
    * @brief Access for the index.
    * @return a const reference to the index
@@ -134,6 +146,9 @@ private:
   /// const key value
   KEY_TYPE const m_key;
 
+  /// hash of the key
+  std::size_t const m_hash;
+
   /// index value
   INDEX_TYPE mutable m_index;
 };
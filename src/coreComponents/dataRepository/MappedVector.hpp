@@ -26,6 +26,7 @@
 #include "LvArray/src/limits.hpp"
 
 // System includes
+#include <functional>
 #include <vector>
 
 namespace geos
@@ -39,7 +40,9 @@ namespace geos
  * of a mapped key lookup O(n) if only the key is known.
  *
  * In addition, a keyIndex can be used for lookup, which will give similar
- * performance to an index lookup after the first use of a keyIndex.
+ * performance to an index lookup after the first use of a keyIndex. The index
+ * cached in the keyIndex is always confirmed against the hash and the key stored
+ * in the container, so the same keyIndex can safely be used with several containers.
  */
 template< typename T,
           typename T_PTR=T *,
@@ -193,24 +196,7 @@ public:
    * @return pointer to const T
    */
   inline T const * operator[]( KeyIndex const & keyIndex ) const
-  {
-    INDEX_TYPE index = keyIndex.index();
-
-    if( index==KeyIndex::invalid_index )
-    {
-      index = getIndex( keyIndex.key() );
-      keyIndex.setIndex( index );
-    }
-#ifdef MAPPED_VECTOR_RANGE_CHECKING
-    else if( m_values[index].first!=keyIndex.Key() )
-    {
-      index = getIndex( keyIndex.Key() );
-      keyIndex.setIndex( index );
-    }
-#endif
-
-    return this->operator[]( index );
-  }
+  { return this->operator[]( getIndex( keyIndex ) ); }
 
   /**
    *
@@ -283,6 +269,25 @@ public:
     return ( iter!=m_keyLookup.end() ? iter->second : KeyIndex::invalid_index );
   }
 
+  /**
+   * @brief Find the index of the key of a keyIndex, and cache it in the keyIndex.
+   * @param keyIndex the keyIndex to look up
+   * @return index associated with the key of @p keyIndex
+   * @note The cached index is confirmed with the hash precomputed in the keyIndex, the lookup map
+   *       being only searched when the cached index is missing or stale.
+   */
+  inline INDEX_TYPE getIndex( KeyIndex const & keyIndex ) const
+  {
+    INDEX_TYPE index = keyIndex.index();
+
+    if( !isIndexOf( index, keyIndex ) )
+    {
+      index = getIndex( keyIndex.key() );
+      keyIndex.setIndex( index );
+    }
+    return index;
+  }
+
 
   /**
    * @name modifier functions
@@ -321,6 +326,7 @@ public:
 
     // delete and shift vector entries
     m_values.erase( m_values.begin() + index );
+    m_keyHashes.erase( m_keyHashes.begin() + index );
     m_ownsValues.erase( m_ownsValues.begin() + index );
 
     // rebuild parts of const key vectors after deleted entry
@@ -361,16 +367,7 @@ public:
    *  This function will set the element at the given key to nullptr.
    */
   void erase( KeyIndex & keyIndex )
-  {
-    INDEX_TYPE index = keyIndex.Index();
-
-    if( (index==KeyIndex::invalid_index) || (m_values[index].first!=keyIndex.Key()) )
-    {
-      index = getIndex( keyIndex.Key() );
-      keyIndex.setIndex( index );
-    }
-    erase( index );
-  }
+  { erase( getIndex( keyIndex ) ); }
 
   /**
    * @brief function to clear the MappedVector
@@ -384,6 +381,7 @@ public:
     m_constKeyValues.clear();
     m_constValues.clear();
     m_values.clear();
+    m_keyHashes.clear();
     m_ownsValues.clear();
     m_keyLookup.clear();
   }
@@ -444,9 +442,26 @@ private:
   deleteValue( INDEX_TYPE GEOS_UNUSED_PARAM( index ) )
   {}
 
+  /**
+   * @brief Check whether an index refers to the entry of a keyIndex.
+   * @param index the index to check
+   * @param keyIndex the keyIndex
+   * @return true if @p index is valid and the entry at @p index has the key of @p keyIndex
+   */
+  inline bool isIndexOf( INDEX_TYPE const index, KeyIndex const & keyIndex ) const
+  {
+    return index > KeyIndex::invalid_index &&
+           index < static_cast< INDEX_TYPE >( m_values.size() ) &&
+           m_keyHashes[index] == keyIndex.hash() &&
+           m_values[index].first == keyIndex.key();
+  }
+
   /// random access container that holds the values
   valueContainer m_values;
 
+  /// hashes of the keys of the values, used to confirm the indices cached in keyIndices
+  std::vector< std::size_t > m_keyHashes;
+
   /// clone of random access container that holds const keys
   constKeyValueContainer m_constKeyValues;
 
@@ -475,6 +490,7 @@ T * MappedVector< T, T_PTR, KEY_TYPE, INDEX_TYPE >::insert( KEY_TYPE const & key
   {
     value_type newEntry = std::make_pair( keyName, std::move( source ) );
     m_values.push_back( std::move( newEntry ) );
+    m_keyHashes.push_back( std::hash< KEY_TYPE >{}( keyName ) );
     //TODO this needs to be a safe conversion
     index = static_cast< INDEX_TYPE >(m_values.size()) - 1;
     m_ownsValues.resize( index + 1 );
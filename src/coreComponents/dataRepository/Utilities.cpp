@@ -194,5 +194,23 @@ void printMemoryAllocation( Group const & group, integer const indent, real64 co
   }
 }
 
+void collectMemoryAllocations( Group const & group, std::vector< WrapperAllocation > & allocations )
+{
+  string const groupPath = group.getPath();
+  for( auto & view : group.wrappers() )
+  {
+    size_t const bytesAllocated = view.second->bytesAllocated();
+    if( bytesAllocated > 0 )
+    {
+      allocations.push_back( { groupPath, view.second->getName(), view.second->getPreviousSpace(), bytesAllocated } );
+    }
+  }
+
+  for( auto & subGroup : group.getSubGroups() )
+  {
+    collectMemoryAllocations( *(subGroup.second), allocations );
+  }
+}
+
 }
 }
@@ -35,5 +35,28 @@ class Group;
  */
 void printMemoryAllocation( Group const & group, integer const indent, real64 const threshold );
 
+/**
+ * @brief Memory allocated on the current rank for the object held by a Wrapper.
+ */
+struct WrapperAllocation
+{
+  /// Path of the Group holding the Wrapper
+  string groupPath;
+  /// Name of the Wrapper
+  string wrapperName;
+  /// Memory space in which the object was last moved
+  LvArray::MemorySpace space;
+  /// Number of bytes allocated for the object
+  size_t bytes;
+};
+
+/**
+ * @brief Collects the non-empty allocations of the Wrappers of a group and of its subgroups recursively
+ *
+ * @param group The group to traverse
+ * @param[inout] allocations The list to which the allocations are appended
+ */
+void collectMemoryAllocations( Group const & group, std::vector< WrapperAllocation > & allocations );
+
 }
 }
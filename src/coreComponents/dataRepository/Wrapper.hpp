@@ -357,6 +357,24 @@ public:
     return unpackedSize;
   }
 
+  /// @copydoc WrapperBase::unpackByIndexSinglePrecision
+  virtual
+  localIndex unpackByIndexSinglePrecision( buffer_unit_type const * & buffer,
+                                           arrayView1d< localIndex const > const & unpackIndices,
+                                           bool onDevice,
+                                           parallelDeviceEvents & events,
+                                           MPI_Op op ) override final
+  {
+    if constexpr ( wrapperHelpers::is_single_precision_transportable< T > )
+    {
+      return bufferOps::UnpackByIndexSinglePrecision( buffer, referenceAsView(), unpackIndices, onDevice, events, op );
+    }
+    else
+    {
+      return unpackByIndex( buffer, unpackIndices, false, onDevice, events, op );
+    }
+  }
+
   ///@}
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +390,9 @@ public:
     return m_isClone ? 0 : wrapperHelpers::byteSize< T >( *m_data );
   }
 
+  virtual LvArray::MemorySpace getPreviousSpace() const override final
+  { return wrapperHelpers::getPreviousSpace( *m_data ); }
+
 
   /**
    * @name Methods that delegate to the wrapped type
@@ -395,6 +416,10 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void reserve( localIndex const newCapacity ) override
   {
+    if( isAllocationDeferred() )
+    {
+      return;
+    }
     wrapperHelpers::move( *m_data, hostMemorySpace, true );
     wrapperHelpers::reserve( reference(), newCapacity );
   }
@@ -409,6 +434,11 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void resize( localIndex const newSize ) override
   {
+    // a wrapper whose allocation is deferred is allocated to the size of its parent when retrieved
+    if( isAllocationDeferred() )
+    {
+      return;
+    }
     wrapperHelpers::move( *m_data, hostMemorySpace, true );
     wrapperHelpers::resizeDefault( reference(), newSize, m_default );
   }
@@ -447,6 +477,10 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void copy( localIndex const sourceIndex, localIndex const destIndex ) override
   {
+    if( isAllocationDeferred() )
+    {
+      return;
+    }
     copy_wrapper::copy( reference(), sourceIndex, destIndex );
   }
 
@@ -554,6 +588,10 @@ public:
   void erase( std::set< localIndex > const & indicesToErase ) override
   {
     GEOS_ERROR_IF( indicesToErase.size() == 0, "Wrapper::erase() can only be called on a populated set of indices!" );
+    if( isAllocationDeferred() )
+    {
+      return;
+    }
     erase_wrapper::erase( reference(), indicesToErase );
   }
 
@@ -798,7 +836,7 @@ public:
   {
     m_conduitNode.reset();
 
-    if( getRestartFlags() == RestartFlags::NO_WRITE )
+    if( getRestartFlags() == RestartFlags::NO_WRITE || isAllocationDeferred() )
     {
       return;
     }
@@ -824,6 +862,14 @@ public:
       return false;
     }
 
+    // the wrapper was not allocated when the restart was written
+    if( !m_conduitNode.has_child( "__sizedFromParent__" ) )
+    {
+      m_conduitNode.reset();
+      return isAllocationDeferred();
+    }
+
+    m_allocationDeferred = false;
     setSizedFromParent( m_conduitNode[ "__sizedFromParent__" ].value() );
 
     wrapperHelpers::pullDataFromConduitNode( *m_data, m_conduitNode );
@@ -891,6 +937,24 @@ public:
     return *this;
   }
 
+  /**
+   * @copydoc WrapperBase::setTrackModifications(bool const)
+   */
+  Wrapper< T > & setTrackModifications( bool const track = true )
+  {
+    WrapperBase::setTrackModifications( track );
+    return *this;
+  }
+
+  /**
+   * @copydoc WrapperBase::setLazyAllocation(bool const)
+   */
+  Wrapper< T > & setLazyAllocation( bool const lazy = true )
+  {
+    WrapperBase::setLazyAllocation( lazy );
+    return *this;
+  }
+
   /**
    * @copydoc WrapperBase::setRegisteringObjects(string const &)
    */
@@ -923,10 +987,20 @@ public:
 #if defined(GEOSX_USE_PYGEOSX)
   virtual PyObject * createPythonObject( ) override
   { return wrapperHelpers::createPythonObject( reference() ); }
+
+  virtual PyObject * createPythonArrayInterface( LvArray::MemorySpace const space ) override
+  { return wrapperHelpers::createPythonArrayInterface( reference(), space ); }
 #endif
 
 private:
 
+  virtual void releaseResizedDimension() override
+  {
+    wrapperHelpers::move( *m_data, hostMemorySpace, true );
+    wrapperHelpers::releaseResizedDimension( *m_data );
+    setName();
+  }
+
   /**
    * @brief Concrete implementation of the packing method.
    * @tparam DO_PACKING A template parameter to discriminate between actually packing or only computing the packing size.
@@ -1012,6 +1086,54 @@ private:
     return packedSize;
   }
 
+  /**
+   * @brief Concrete implementation of the single precision packing by index.
+   * @tparam DO_PACKING whether to pack or only compute the packed size
+   * @param[in,out] buffer the buffer, advanced upon completion
+   * @param[in] packList the indices to pack
+   * @param[in] onDevice whether to use device-based packing functions
+   * @param[out] events the events of the device packing kernels
+   * @return the packed size
+   */
+  template< bool DO_PACKING >
+  localIndex packByIndexSinglePrecisionImpl( buffer_unit_type * & buffer,
+                                             arrayView1d< localIndex const > const & packList,
+                                             bool onDevice,
+                                             parallelDeviceEvents & events ) const
+  {
+    if constexpr ( wrapperHelpers::is_single_precision_transportable< T > )
+    {
+      return bufferOps::PackByIndexSinglePrecision< DO_PACKING >( buffer, reference().toViewConst(), packList, onDevice, events );
+    }
+    else
+    {
+      // the other types are transported in their own precision
+      return packByIndexImpl< DO_PACKING >( buffer, packList, false, onDevice, events );
+    }
+  }
+
+  /**
+   * @copydoc WrapperBase::packByIndexSinglePrecisionPrivate
+   */
+  localIndex packByIndexSinglePrecisionPrivate( buffer_unit_type * & buffer,
+                                                arrayView1d< localIndex const > const & packList,
+                                                bool onDevice,
+                                                parallelDeviceEvents & events ) const override final
+  {
+    return this->packByIndexSinglePrecisionImpl< true >( buffer, packList, onDevice, events );
+  }
+
+  /**
+   * @copydoc WrapperBase::packByIndexSinglePrecisionSizePrivate
+   */
+  localIndex packByIndexSinglePrecisionSizePrivate( arrayView1d< localIndex const > const & packList,
+                                                    bool onDevice,
+                                                    parallelDeviceEvents & events ) const override final
+  {
+    buffer_unit_type * dummy;
+    return this->packByIndexSinglePrecisionImpl< false >( dummy, packList, onDevice, events );
+  }
+
   /**
    * @copydoc WrapperBase::packPrivate
    */
@@ -38,6 +38,13 @@ WrapperBase::WrapperBase( string const & name,
   m_successfulReadFromInput( false ),
   m_description(),
   m_registeringObjects(),
+  m_trackModifications( false ),
+  m_modificationCount( 0 ),
+  m_isSynchronized( false ),
+  m_synchronizedModificationCount( 0 ),
+  m_synchronizedMeshTimestamp( 0 ),
+  m_synchronizedSize( 0 ),
+  m_allocationDeferred( false ),
   m_conduitNode( parent.getConduitNode()[ name ] ),
   m_dataContext( std::make_unique< WrapperContext >( *this ) )
 {}
@@ -58,6 +65,32 @@ void WrapperBase::copyWrapperAttributes( WrapperBase const & source )
   m_plotLevel  = source.m_plotLevel;
   m_inputFlag = source.m_inputFlag;
   m_description = source.m_description;
+  m_trackModifications = source.m_trackModifications;
+}
+
+WrapperBase & WrapperBase::setLazyAllocation( bool const lazy )
+{
+  GEOS_ERROR_IF( lazy && m_sizedFromParent != 1,
+                 getDataContext() << ": only the wrappers sized from their parent can be allocated lazily." );
+  if( !lazy )
+  {
+    allocateIfDeferred();
+  }
+  else if( !m_allocationDeferred )
+  {
+    releaseResizedDimension();
+    m_allocationDeferred = true;
+  }
+  return *this;
+}
+
+void WrapperBase::allocateIfDeferred()
+{
+  if( m_allocationDeferred )
+  {
+    m_allocationDeferred = false;
+    resize( m_parent->size() );
+  }
 }
 
 string WrapperBase::getPath() const
@@ -113,6 +113,11 @@ public:
    */
   virtual size_t bytesAllocated() const = 0;
 
+  /**
+   * @brief @return the memory space in which the wrapped object was last moved (host for non-movable objects).
+   */
+  virtual LvArray::MemorySpace getPreviousSpace() const = 0;
+
 
   /**
    * @brief Calls T::resize( num_dims, dims )
@@ -347,6 +352,47 @@ public:
                                     parallelDeviceEvents & events,
                                     MPI_Op op=MPI_REPLACE ) = 0;
 
+  /**
+   * @brief Pack selected indices of the wrapped object in single precision, to reduce the volume of the halo exchanges.
+   * @tparam DO_PACKING A template parameter to discriminate between actually packing or only computing the packing size.
+   * @param[in,out] buffer The buffer that will receive the packed data.
+   * @param[in] packList The element we want packed.
+   * @param[in] onDevice Whether to use device-based packing functions
+   *                     (buffer must be either pinned or a device pointer)
+   * @param[out] events A collection of events to poll for completion of async
+   *                    packing kernels ( device packing is incomplete until all
+   *                    events are finalized )
+   * @return The packed size.
+   * @details The arrays of real64 are converted to real32 in the buffer, the other types are packed in their own precision.
+   * No metadata is packed.
+   */
+  template< bool DO_PACKING >
+  localIndex packByIndexSinglePrecision( buffer_unit_type * & buffer,
+                                         arrayView1d< localIndex const > const & packList,
+                                         bool onDevice,
+                                         parallelDeviceEvents & events ) const
+  {
+    return DO_PACKING ? packByIndexSinglePrecisionPrivate( buffer, packList, onDevice, events ) : packByIndexSinglePrecisionSizePrivate( packList, onDevice, events );
+  }
+
+  /**
+   * @brief Unpack selected indices of the wrapped object packed with packByIndexSinglePrecision().
+   * @param[in,out] buffer the binary buffer pointer, advanced upon completion
+   * @param[in] unpackIndices the list of indices to unpack
+   * @param[in] onDevice    whether to use device-based packing functions
+   *                         (buffer must be either pinned or a device pointer)
+   * @param[out] events      a collection of events to poll for completion of async
+   *                         packing kernels ( device packing is incomplete until all
+   *                         events are finalized )
+   * @param[in] op           the operation to perform while unpacking
+   * @return                  the number of @p buffer_unit_type units unpacked
+   */
+  virtual localIndex unpackByIndexSinglePrecision( buffer_unit_type const * & buffer,
+                                                   arrayView1d< localIndex const > const & unpackIndices,
+                                                   bool onDevice,
+                                                   parallelDeviceEvents & events,
+                                                   MPI_Op op=MPI_REPLACE ) = 0;
+
   ///@}
 
   /**
@@ -528,6 +574,111 @@ public:
 
   ///@}
 
+  /**
+   * @name Modification tracking
+   *
+   * The halo synchronizations skip the wrappers that track their modifications and have not been
+   * modified since their last synchronization on the same mesh. The tracking is opt-in: a wrapper
+   * that tracks its modifications must be marked as modified by every writer of its owned values.
+   */
+  ///@{
+
+  /**
+   * @brief Set whether the modifications of the wrapped object are tracked.
+   * @param track whether markModified() is called after each modification of the wrapped object
+   * @return a reference to this wrapper
+   */
+  WrapperBase & setTrackModifications( bool const track = true )
+  {
+    m_trackModifications = track;
+    m_isSynchronized = false;
+    return *this;
+  }
+
+  /**
+   * @brief @return whether the modifications of the wrapped object are tracked.
+   */
+  bool tracksModifications() const
+  { return m_trackModifications; }
+
+  /**
+   * @brief Mark the wrapped object as modified.
+   */
+  void markModified()
+  { ++m_modificationCount; }
+
+  /**
+   * @brief @return the number of modifications of the wrapped object marked so far.
+   */
+  Timestamp getModificationCount() const
+  { return m_modificationCount; }
+
+  /**
+   * @brief Check whether the ghost copies of the wrapped object are up to date.
+   * @param meshTimestamp the modification timestamp of the mesh the wrapper belongs to
+   * @return true if the modifications are tracked and the wrapped object has not been modified
+   *   (nor the mesh or the size of the wrapped object changed) since the last synchronization
+   */
+  bool isSynchronized( Timestamp const meshTimestamp ) const
+  {
+    return m_trackModifications &&
+           m_isSynchronized &&
+           m_synchronizedModificationCount == m_modificationCount &&
+           m_synchronizedMeshTimestamp == meshTimestamp &&
+           m_synchronizedSize == size();
+  }
+
+  /**
+   * @brief Record that the ghost copies of the wrapped object have been synchronized.
+   * @param meshTimestamp the modification timestamp of the mesh the wrapper belongs to
+   */
+  void markSynchronized( Timestamp const meshTimestamp )
+  {
+    m_isSynchronized = true;
+    m_synchronizedModificationCount = m_modificationCount;
+    m_synchronizedMeshTimestamp = meshTimestamp;
+    m_synchronizedSize = size();
+  }
+
+  ///@}
+
+  /**
+   * @name Deferred allocation
+   *
+   * A wrapper sized from its parent can be allocated lazily: its dimension resized with its parent stays empty
+   * (and is not resized with its parent) until the wrapper is first retrieved from its parent
+   * group (getWrapper, getReference, getField...). The restart and the outputs skip the wrappers
+   * that have not been allocated. This is meant for the optional fields registered in
+   * registerDataOnMesh that are only used by some options of a solver or a model.
+   *
+   * @note The wrapped object of a wrapper whose allocation is deferred must not be accessed
+   *   without going through its parent group (e.g. through a member referencing the wrapped object).
+   */
+  ///@{
+
+  /**
+   * @brief Set whether the allocation of the wrapped object is deferred until its first retrieval.
+   * @param lazy whether the allocation is deferred
+   * @return a reference to this wrapper
+   *
+   * @details Deferring the allocation releases the resized dimension of the wrapped object, it must
+   *   be done when the wrapper is registered, before its values are set.
+   */
+  WrapperBase & setLazyAllocation( bool const lazy = true );
+
+  /**
+   * @brief @return whether the allocation of the wrapped object is still deferred.
+   */
+  bool isAllocationDeferred() const
+  { return m_allocationDeferred; }
+
+  /**
+   * @brief Allocate the wrapped object to the size of the parent if its allocation is deferred.
+   */
+  void allocateIfDeferred();
+
+  ///@}
+
   /**
    * @name Miscellaneous
    */
@@ -629,6 +780,13 @@ public:
    * @return A Python object representing the wrapped object.
    */
   virtual PyObject * createPythonObject( ) = 0;
+
+  /**
+   * @brief Return a dictionary describing the wrapped array in the NumPy array interface format.
+   * @param space The memory space the data is moved to, and marked as modified in.
+   * @return The dictionary, or nullptr if the wrapped object is not an array of a numeric type.
+   */
+  virtual PyObject * createPythonArrayInterface( LvArray::MemorySpace const space ) = 0;
 #endif
 
 protected:
@@ -688,12 +846,38 @@ protected:
   /// A vector of the names of the objects that created this Wrapper.
   std::set< string > m_registeringObjects;
 
+  /// Flag to indicate if the modifications of the wrapped object are tracked
+  bool m_trackModifications;
+
+  /// Number of modifications of the wrapped object marked so far
+  Timestamp m_modificationCount;
+
+  /// Flag to indicate if the wrapped object has been synchronized at least once
+  bool m_isSynchronized;
+
+  /// Number of modifications of the wrapped object at its last synchronization
+  Timestamp m_synchronizedModificationCount;
+
+  /// Modification timestamp of the mesh at the last synchronization
+  Timestamp m_synchronizedMeshTimestamp;
+
+  /// Size of the wrapped object at the last synchronization
+  localIndex m_synchronizedSize;
+
+  /// Flag to indicate if the allocation of the wrapped object is deferred until its first retrieval
+  bool m_allocationDeferred;
+
   /// A reference to the corresponding conduit::Node.
   conduit::Node & m_conduitNode;
 
   /// A DataContext object that can helps to contextualize this Group.
   std::unique_ptr< DataContext > m_dataContext;
 
+  /**
+   * @brief Release the dimension of the wrapped object resized with its parent.
+   */
+  virtual void releaseResizedDimension() = 0;
+
 private:
 
   /**
@@ -756,6 +940,30 @@ private:
                                              bool withMetadata,
                                              bool onDevice,
                                              parallelDeviceEvents & events ) const = 0;
+
+  /**
+   * @brief Pack selected indices of wrapped object into a buffer, in single precision.
+   * @param[in,out] buffer the binary buffer pointer, advanced upon completion
+   * @param[in] packList the list of indices to pack
+   * @param[in] onDevice    whether to use device-based packing functions
+   * @param[out] events      a collection of events to poll for completion of async packing kernels
+   * @return               the number of @p buffer_unit_type units packed
+   */
+  virtual localIndex packByIndexSinglePrecisionPrivate( buffer_unit_type * & buffer,
+                                                        arrayView1d< localIndex const > const & packList,
+                                                        bool onDevice,
+                                                        parallelDeviceEvents & events ) const = 0;
+
+  /**
+   * @brief Get the buffer size needed to pack the selected indices of the wrapped object in single precision.
+   * @param[in] packList the list of indices to pack
+   * @param[in] onDevice    whether to use device-based packing functions
+   * @param[out] events      a collection of events to poll for completion of async packing kernels
+   * @return             the number of @p buffer_unit_type units needed to pack
+   */
+  virtual localIndex packByIndexSinglePrecisionSizePrivate( arrayView1d< localIndex const > const & packList,
+                                                            bool onDevice,
+                                                            parallelDeviceEvents & events ) const = 0;
 };
 
 } /// namespace dataRepository
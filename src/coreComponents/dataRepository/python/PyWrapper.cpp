@@ -18,6 +18,7 @@
 
 // Source includes
 #include "PyWrapper.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
 
 
 #define VERIFY_NON_NULL_SELF( self ) \
@@ -99,6 +100,47 @@ static PyObject * PyWrapper_value( PyWrapper * const self, PyObject * const args
   return ret;
 }
 
+/**
+ * @brief Return the array interface of the wrapped array in @p space, or raise an AttributeError.
+ */
+static PyObject * createArrayInterface( PyWrapper * const self, LvArray::MemorySpace const space )
+{
+  VERIFY_NON_NULL_SELF( self );
+  VERIFY_INITIALIZED( self );
+
+  PyObject * const ret = self->wrapper->createPythonArrayInterface( space );
+  PYTHON_ERROR_IF( ret == nullptr && PyErr_Occurred() == nullptr, PyExc_AttributeError,
+                   "The wrapped object is not an array of a numeric type.", nullptr );
+
+  return ret;
+}
+
+static constexpr char const * PyWrapper_arrayInterfaceDocString =
+  "The NumPy array interface of the wrapped array, in host memory.\n"
+  "\n"
+  "The data is moved to host and marked as modified there when the interface is requested, "
+  "so that ``numpy.asarray(wrapper)`` is a view of the data without any copy. The view is only "
+  "valid until the next call into pygeosx, which may move or reallocate the data.";
+static PyObject * PyWrapper_getArrayInterface( PyWrapper * const self, void * const )
+{ return createArrayInterface( self, hostMemorySpace ); }
+
+static constexpr char const * PyWrapper_cudaArrayInterfaceDocString =
+  "The CUDA array interface of the wrapped array, in device memory.\n"
+  "\n"
+  "The data is moved to the device and marked as modified there when the interface is requested, "
+  "so that CuPy, PyTorch or Numba can use it without any copy. No stream is given since the moves are "
+  "synchronous. As for the host interface, the view is only valid until the next call into pygeosx.";
+static PyObject * PyWrapper_getCudaArrayInterface( PyWrapper * const self, void * const )
+{
+#if defined( GEOS_USE_DEVICE )
+  return createArrayInterface( self, parallelDeviceMemorySpace );
+#else
+  GEOS_UNUSED_VAR( self );
+  PyErr_SetString( PyExc_AttributeError, "GEOS was built without device support." );
+  return nullptr;
+#endif
+}
+
 BEGIN_ALLOW_DESIGNATED_INITIALIZERS
 
 static PyMethodDef PyWrapperMethods[] = {
@@ -106,6 +148,12 @@ static PyMethodDef PyWrapperMethods[] = {
   { nullptr, nullptr, 0, nullptr } // Sentinel
 };
 
+static PyGetSetDef PyWrapperGetSetters[] = {
+  { "__array_interface__", (getter) PyWrapper_getArrayInterface, nullptr, PyWrapper_arrayInterfaceDocString, nullptr },
+  { "__cuda_array_interface__", (getter) PyWrapper_getCudaArrayInterface, nullptr, PyWrapper_cudaArrayInterfaceDocString, nullptr },
+  { nullptr, nullptr, nullptr, nullptr, nullptr } // Sentinel
+};
+
 static PyTypeObject PyWrapperType = {
   PyVarObject_HEAD_INIT( nullptr, 0 )
     .tp_name = "pygeosx.Wrapper",
@@ -115,6 +163,7 @@ static PyTypeObject PyWrapperType = {
   .tp_flags = Py_TPFLAGS_DEFAULT,
   .tp_doc = PyWrapper::docString,
   .tp_methods = PyWrapperMethods,
+  .tp_getset = PyWrapperGetSetters,
   .tp_new = PyType_GenericNew,
 };
 
@@ -0,0 +1,93 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "dataRepository/MappedVector.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+using IntMappedVector = MappedVector< int, int *, string, int >;
+
+TEST( testMappedVector, keyIndexLookup )
+{
+  int a = 1, b = 2, c = 3;
+  IntMappedVector values;
+  values.insert( "a", &a, false );
+  values.insert( "b", &b, false );
+
+  IntMappedVector::KeyIndex const keyB( "b" );
+  EXPECT_FALSE( keyB.isIndexSet() );
+  EXPECT_EQ( values[ keyB ], &b );
+  EXPECT_EQ( keyB.index(), 1 );
+
+  // the cached index is reused on the next lookup
+  EXPECT_EQ( values[ keyB ], &b );
+  EXPECT_EQ( keyB.index(), 1 );
+
+  // a missing key does not resolve to an entry
+  IntMappedVector::KeyIndex const keyC( "c" );
+  EXPECT_EQ( values[ keyC ], nullptr );
+  EXPECT_FALSE( keyC.isIndexSet() );
+
+  // the cached index is updated when the entries are shifted
+  values.erase( 0 );
+  values.insert( "c", &c, false );
+  EXPECT_EQ( values[ keyB ], &b );
+  EXPECT_EQ( keyB.index(), 0 );
+  EXPECT_EQ( values[ keyC ], &c );
+  EXPECT_EQ( keyC.index(), 1 );
+}
+
+TEST( testMappedVector, keyIndexAcrossContainers )
+{
+  int a = 1, b = 2;
+  IntMappedVector first;
+  first.insert( "a", &a, false );
+  first.insert( "b", &b, false );
+
+  IntMappedVector second;
+  second.insert( "b", &b, false );
+
+  // an index cached from one container is never used for an entry with another key in a second one
+  IntMappedVector::KeyIndex const keyA( "a" );
+  EXPECT_EQ( first[ keyA ], &a );
+  EXPECT_EQ( second[ keyA ], nullptr );
+  EXPECT_EQ( first[ keyA ], &a );
+
+  IntMappedVector::KeyIndex const keyB( "b" );
+  EXPECT_EQ( first[ keyB ], &b );
+  EXPECT_EQ( second[ keyB ], &b );
+  EXPECT_EQ( keyB.index(), 0 );
+}
+
+TEST( testMappedVector, keyIndexGetIndex )
+{
+  int a = 1, b = 2;
+  IntMappedVector values;
+  values.insert( "a", &a, false );
+  values.insert( "b", &b, false );
+
+  // the index found in the lookup map is cached in the keyIndex
+  IntMappedVector::KeyIndex const keyB( "b" );
+  EXPECT_EQ( values.getIndex( keyB ), 1 );
+  EXPECT_EQ( keyB.index(), 1 );
+
+  // a stale cached index is refreshed
+  values.erase( 0 );
+  EXPECT_EQ( values.getIndex( keyB ), 0 );
+  EXPECT_EQ( keyB.index(), 0 );
+}
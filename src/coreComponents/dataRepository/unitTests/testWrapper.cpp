@@ -149,3 +149,29 @@ TYPED_TEST( WrapperSetGet, Description )
   this->testDescription( "First description." );
   this->testDescription( "Second description." );
 }
+
+TEST( WrapperLazyAllocation, AllocatedWhenRetrieved )
+{
+  conduit::Node node;
+  Group group( "root", node );
+  group.resize( 10 );
+
+  Wrapper< array2d< real64 > > & wrapper = group.registerWrapper< array2d< real64 > >( "field" ).
+                                             setApplyDefaultValue( 1.0 ).
+                                             setLazyAllocation();
+  wrapper.reference().resizeDimension< 1 >( 3 );
+  EXPECT_TRUE( wrapper.isAllocationDeferred() );
+  EXPECT_EQ( wrapper.reference().size( 0 ), 0 );
+  EXPECT_EQ( wrapper.reference().size( 1 ), 3 );
+
+  // the deferred wrapper is not resized with its parent
+  group.resize( 20 );
+  EXPECT_EQ( wrapper.reference().size( 0 ), 0 );
+
+  // the wrapper is allocated to the size of its parent when retrieved
+  arrayView2d< real64 const > const values = group.getReference< array2d< real64 > >( "field" );
+  EXPECT_FALSE( wrapper.isAllocationDeferred() );
+  ASSERT_EQ( values.size( 0 ), 20 );
+  ASSERT_EQ( values.size( 1 ), 3 );
+  EXPECT_EQ( values( 19, 2 ), 1.0 );
+}
@@ -41,6 +41,7 @@
 #include <conduit.hpp>
 
 // System includes
+#include <cstdint>
 #include <cstring>
 
 #if RESTART_TYPE_LOGGING
@@ -219,6 +220,31 @@ resizeDimensions( T & value, int num_dims, localIndex const * const dims )
 }
 
 
+template< typename T, int NDIM, typename PERMUTATION >
+inline void
+releaseResizedDimension( Array< T, NDIM, PERMUTATION > & value )
+{
+  // the array is replaced (rather than resized) so that its buffer is freed
+  int const resizeIndex = value.getSingleParameterResizeIndex();
+  localIndex dims[ NDIM ];
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    dims[ dim ] = value.size( dim );
+  }
+  dims[ resizeIndex ] = 0;
+
+  Array< T, NDIM, PERMUTATION > released;
+  released.setSingleParameterResizeIndex( resizeIndex );
+  released.resize( NDIM, dims );
+  value = std::move( released );
+}
+
+template< typename T >
+inline void
+releaseResizedDimension( T & value )
+{ resize( value, 0 ); }
+
+
 template< typename T >
 inline localIndex
 byteSizeOfElement()
@@ -285,6 +311,16 @@ move( T & GEOS_UNUSED_PARAM( value ),
       bool const GEOS_UNUSED_PARAM( touch ) )
 {}
 
+template< typename T >
+std::enable_if_t< traits::HasMemberFunction_getPreviousSpace< T >, LvArray::MemorySpace >
+getPreviousSpace( T const & value )
+{ return value.getPreviousSpace(); }
+
+template< typename T >
+std::enable_if_t< !traits::HasMemberFunction_getPreviousSpace< T >, LvArray::MemorySpace >
+getPreviousSpace( T const & GEOS_UNUSED_PARAM( value ) )
+{ return hostMemorySpace; }
+
 // This is for an object that needs to be packed.
 template< typename T >
 std::enable_if_t< !bufferOps::can_memcpy< typename traits::Pointer< T > > >
@@ -482,9 +518,16 @@ pullDataFromConduitNode( Array< T, NDIM, PERMUTATION > & var,
 
   var.resize( NDIM, dims );
 
-  // Finally memcpy
-  conduit::Node const & valuesNode = node.fetch_existing( "__values__" );
+  // The values are either read directly from the restart file into the array...
   localIndex numBytesFromArray =  var.size() * sizeof( T );
+  conduit::DataType const dtype( conduitTypeInfo< T >::id, numBytesFromArray / conduitTypeInfo< T >::sizeOfConduitType );
+  if( readDeferredValues( node, dtype, var.data() ) )
+  {
+    return;
+  }
+
+  // ... or copied from the tree
+  conduit::Node const & valuesNode = node.fetch_existing( "__values__" );
   GEOS_ERROR_IF_NE( numBytesFromArray, valuesNode.dtype().strided_bytes() );
   std::memcpy( var.data(), valuesNode.data_ptr(), numBytesFromArray );
 }
@@ -700,6 +743,14 @@ localIndex numArrayComp( T const & GEOS_UNUSED_PARAM( var ) )
   return 0;
 }
 
+/// Whether a wrapped type is converted to single precision by the single precision halo transport.
+template< typename T >
+constexpr bool is_single_precision_transportable = false;
+
+/// The arrays of real64 up to three dimensions are converted to single precision.
+template< int NDIM, typename PERMUTATION >
+constexpr bool is_single_precision_transportable< Array< real64, NDIM, PERMUTATION > > = ( NDIM <= 3 );
+
 template< bool DO_PACKING, typename T, typename IDX >
 inline std::enable_if_t< bufferOps::is_packable_by_index< T >, localIndex >
 PackByIndex( buffer_unit_type * & buffer, T & var, IDX & idx )
@@ -837,6 +888,57 @@ inline std::enable_if_t< !LvArray::python::CanCreate< T >, PyObject * >
 createPythonObject( T & )
 { return nullptr; }
 
+/// Whether @p T is an array of a numeric type, which can be exported through the NumPy array interface
+template< typename T, bool = traits::is_array< T > >
+struct IsNumericArray : std::false_type {};
+
+/// @copydoc IsNumericArray
+template< typename T >
+struct IsNumericArray< T, true > : std::is_arithmetic< typename T::ValueType > {};
+
+template< typename T >
+inline std::enable_if_t< IsNumericArray< T >::value, PyObject * >
+createPythonArrayInterface( T & array, LvArray::MemorySpace const space )
+{
+  using ValueType = typename T::ValueType;
+
+  // The consumer of the interface may write to the data.
+  array.move( space, true );
+
+  char const kind = std::is_same< ValueType, bool >::value ? 'b' :
+                    std::is_floating_point< ValueType >::value ? 'f' :
+                    std::is_signed< ValueType >::value ? 'i' : 'u';
+  string const typeString = GEOS_FMT( "<{}{}", kind, sizeof( ValueType ) );
+
+  PyObject * const shape = PyTuple_New( T::NDIM );
+  PyObject * const strides = PyTuple_New( T::NDIM );
+  if( shape == nullptr || strides == nullptr )
+  {
+    Py_XDECREF( shape );
+    Py_XDECREF( strides );
+    return nullptr;
+  }
+
+  for( int dim = 0; dim < T::NDIM; ++dim )
+  {
+    PyTuple_SET_ITEM( shape, dim, PyLong_FromLongLong( array.size( dim ) ) );
+    PyTuple_SET_ITEM( strides, dim, PyLong_FromLongLong( array.strides()[ dim ] * sizeof( ValueType ) ) );
+  }
+
+  unsigned long long const address = reinterpret_cast< std::uintptr_t >( array.data() );
+  return Py_BuildValue( "{s:N,s:N,s:s,s:(KO),s:i}",
+                        "shape", shape,
+                        "strides", strides,
+                        "typestr", typeString.c_str(),
+                        "data", address, Py_False,
+                        "version", 3 );
+}
+
+template< typename T >
+inline std::enable_if_t< !IsNumericArray< T >::value, PyObject * >
+createPythonArrayInterface( T &, LvArray::MemorySpace const )
+{ return nullptr; }
+
 #endif
 
 } // namespace wrapperHelpers
@@ -0,0 +1,304 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file denseLASolvers.hpp
+ *
+ * Fixed-size dense LU factorization, solve and inverse for the small systems (N < 32) solved inside kernels.
+ * The matrices live in registers or on the stack, so these functions can be called from GEOS_HOST_DEVICE code,
+ * and the batched versions simply launch one factorization per matrix of the batch.
+ */
+
+#ifndef GEOS_DENSELINEARALGEBRA_DENSELASOLVERS_HPP_
+#define GEOS_DENSELINEARALGEBRA_DENSELASOLVERS_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+namespace geos
+{
+
+namespace denseLinearAlgebra
+{
+
+/**
+ * @brief LU factorization with partial pivoting, P A = L U, computed in place.
+ * @tparam N the size of the matrix
+ * @param[inout] A on input, the matrix, on output, L (unit diagonal not stored) and U
+ * @param[out] pivots the row permutation, row i of P A is row pivots[i] of A
+ * @return false if a zero pivot was found, i.e. the matrix is singular
+ */
+template< integer N >
+GEOS_HOST_DEVICE
+inline
+bool luFactor( real64 ( & A )[N][N],
+               integer ( & pivots )[N] )
+{
+  static_assert( N > 0, "The size of the matrix must be positive" );
+
+  for( integer i = 0; i < N; ++i )
+  {
+    pivots[i] = i;
+  }
+
+  for( integer k = 0; k < N; ++k )
+  {
+    // find the pivot in column k
+    integer p = k;
+    real64 maxVal = LvArray::math::abs( A[k][k] );
+    for( integer i = k + 1; i < N; ++i )
+    {
+      real64 const val = LvArray::math::abs( A[i][k] );
+      if( val > maxVal )
+      {
+        maxVal = val;
+        p = i;
+      }
+    }
+    if( maxVal <= 0.0 )
+    {
+      return false;
+    }
+
+    if( p != k )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        real64 const tmp = A[k][j];
+        A[k][j] = A[p][j];
+        A[p][j] = tmp;
+      }
+      integer const tmp = pivots[k];
+      pivots[k] = pivots[p];
+      pivots[p] = tmp;
+    }
+
+    // eliminate below the pivot
+    real64 const invPivot = 1.0 / A[k][k];
+    for( integer i = k + 1; i < N; ++i )
+    {
+      A[i][k] *= invPivot;
+      real64 const lik = A[i][k];
+      for( integer j = k + 1; j < N; ++j )
+      {
+        A[i][j] -= lik * A[k][j];
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve A x = b with the factorization computed by luFactor.
+ * @tparam N the size of the system
+ * @param[in] LU the factors computed by luFactor
+ * @param[in] pivots the row permutation computed by luFactor
+ * @param[in] b the right-hand side
+ * @param[out] x the solution, it must not alias b
+ */
+template< integer N >
+GEOS_HOST_DEVICE
+inline
+void luSolve( real64 const ( &LU )[N][N],
+              integer const ( &pivots )[N],
+              real64 const ( &b )[N],
+              real64 ( & x )[N] )
+{
+  // forward substitution with the permuted right-hand side, L y = P b
+  for( integer i = 0; i < N; ++i )
+  {
+    real64 sum = b[pivots[i]];
+    for( integer j = 0; j < i; ++j )
+    {
+      sum -= LU[i][j] * x[j];
+    }
+    x[i] = sum;
+  }
+
+  // backward substitution, U x = y
+  for( integer i = N - 1; i >= 0; --i )
+  {
+    real64 sum = x[i];
+    for( integer j = i + 1; j < N; ++j )
+    {
+      sum -= LU[i][j] * x[j];
+    }
+    x[i] = sum / LU[i][i];
+  }
+}
+
+/**
+ * @brief Solve the linear system A x = b.
+ * @tparam N the size of the system
+ * @param[inout] A the matrix, overwritten by its LU factors
+ * @param[in] b the right-hand side
+ * @param[out] x the solution, it must not alias b
+ * @return false if the matrix is singular, in which case x is not computed
+ */
+template< integer N >
+GEOS_HOST_DEVICE
+inline
+bool solve( real64 ( & A )[N][N],
+            real64 const ( &b )[N],
+            real64 ( & x )[N] )
+{
+  integer pivots[N];
+  if( !luFactor< N >( A, pivots ) )
+  {
+    return false;
+  }
+  luSolve< N >( A, pivots, b, x );
+  return true;
+}
+
+/**
+ * @brief Compute the inverse of a matrix.
+ * @tparam N the size of the matrix
+ * @param[inout] A the matrix, overwritten by its LU factors
+ * @param[out] Ainv the inverse of the matrix
+ * @return false if the matrix is singular, in which case Ainv is not computed
+ */
+template< integer N >
+GEOS_HOST_DEVICE
+inline
+bool invert( real64 ( & A )[N][N],
+             real64 ( & Ainv )[N][N] )
+{
+  integer pivots[N];
+  if( !luFactor< N >( A, pivots ) )
+  {
+    return false;
+  }
+
+  // solve for one column of the identity at a time
+  real64 e[N];
+  real64 col[N];
+  for( integer j = 0; j < N; ++j )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      e[i] = ( i == j ) ? 1.0 : 0.0;
+    }
+    luSolve< N >( A, pivots, e, col );
+    for( integer i = 0; i < N; ++i )
+    {
+      Ainv[i][j] = col[i];
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve a batch of linear systems A_k x_k = b_k in place.
+ * @tparam N the size of the systems
+ * @tparam POLICY the execution policy
+ * @param[inout] A the batch of matrices, of size numSystems x N x N, overwritten by their LU factors
+ * @param[inout] b the batch of right-hand sides, of size numSystems x N, overwritten by the solutions
+ * @return the number of singular matrices in the batch, whose right-hand sides are left untouched
+ */
+template< integer N, typename POLICY = parallelDevicePolicy<> >
+localIndex batchedSolve( arrayView3d< real64 > const & A,
+                         arrayView2d< real64 > const & b )
+{
+  GEOS_ERROR_IF_NE_MSG( A.size( 1 ), N, "Wrong number of rows in the batched matrices" );
+  GEOS_ERROR_IF_NE_MSG( A.size( 2 ), N, "Wrong number of columns in the batched matrices" );
+  GEOS_ERROR_IF_NE_MSG( A.size( 0 ), b.size( 0 ), "The numbers of matrices and right-hand sides differ" );
+  GEOS_ERROR_IF_NE_MSG( b.size( 1 ), N, "Wrong size of the batched right-hand sides" );
+
+  RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numSingular( 0 );
+  forAll< POLICY >( A.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    real64 localA[N][N];
+    real64 localB[N];
+    real64 localX[N];
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        localA[i][j] = A( k, i, j );
+      }
+      localB[i] = b( k, i );
+    }
+
+    bool const success = solve< N >( localA, localB, localX );
+
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        A( k, i, j ) = localA[i][j];
+      }
+      if( success )
+      {
+        b( k, i ) = localX[i];
+      }
+    }
+    numSingular += success ? 0 : 1;
+  } );
+  return numSingular.get();
+}
+
+/**
+ * @brief Compute the inverses of a batch of matrices.
+ * @tparam N the size of the matrices
+ * @tparam POLICY the execution policy
+ * @param[in] A the batch of matrices, of size numMatrices x N x N
+ * @param[out] Ainv the batch of inverses, of size numMatrices x N x N
+ * @return the number of singular matrices in the batch, whose inverses are left untouched
+ */
+template< integer N, typename POLICY = parallelDevicePolicy<> >
+localIndex batchedInvert( arrayView3d< real64 const > const & A,
+                          arrayView3d< real64 > const & Ainv )
+{
+  GEOS_ERROR_IF_NE_MSG( A.size( 1 ), N, "Wrong number of rows in the batched matrices" );
+  GEOS_ERROR_IF_NE_MSG( A.size( 2 ), N, "Wrong number of columns in the batched matrices" );
+  GEOS_ERROR_IF_NE_MSG( A.size( 0 ), Ainv.size( 0 ), "The numbers of matrices and inverses differ" );
+  GEOS_ERROR_IF_NE_MSG( Ainv.size( 1 ), N, "Wrong number of rows in the batched inverses" );
+  GEOS_ERROR_IF_NE_MSG( Ainv.size( 2 ), N, "Wrong number of columns in the batched inverses" );
+
+  RAJA::ReduceSum< ReducePolicy< POLICY >, localIndex > numSingular( 0 );
+  forAll< POLICY >( A.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    real64 localA[N][N];
+    real64 localAinv[N][N];
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        localA[i][j] = A( k, i, j );
+      }
+    }
+
+    bool const success = invert< N >( localA, localAinv );
+
+    if( success )
+    {
+      for( integer i = 0; i < N; ++i )
+      {
+        for( integer j = 0; j < N; ++j )
+        {
+          Ainv( k, i, j ) = localAinv[i][j];
+        }
+      }
+    }
+    numSingular += success ? 0 : 1;
+  } );
+  return numSingular.get();
+}
+
+} // namespace denseLinearAlgebra
+
+} // namespace geos
+
+#endif //GEOS_DENSELINEARALGEBRA_DENSELASOLVERS_HPP_
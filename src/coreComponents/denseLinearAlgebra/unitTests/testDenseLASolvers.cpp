@@ -0,0 +1,160 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testDenseLASolvers.cpp
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+
+#include "common/DataTypes.hpp"
+#include "denseLinearAlgebra/denseLASolvers.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace geos;
+
+static real64 const tolerance = 1e3 * std::numeric_limits< real64 >::epsilon();
+
+/**
+ * @brief Fill a batch of random, well-conditioned matrices and right-hand sides
+ */
+template< integer N >
+void fillBatch( array3d< real64 > & A, array2d< real64 > & b, localIndex const numSystems )
+{
+  A.resize( numSystems, N, N );
+  b.resize( numSystems, N );
+
+  array2d< real64 > matrix( N, N );
+  array1d< real64 > rhs( N );
+  for( localIndex k = 0; k < numSystems; ++k )
+  {
+    BlasLapackLA::matrixRand( matrix, BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+    BlasLapackLA::vectorRand( rhs, BlasLapackLA::RandomNumberDistribution::UNIFORM_m1p1 );
+    for( integer i = 0; i < N; ++i )
+    {
+      // the shift keeps the matrices away from singularity, without making the pivoting unnecessary
+      matrix( i, ( i + 1 ) % N ) += N;
+      for( integer j = 0; j < N; ++j )
+      {
+        A( k, i, j ) = matrix( i, j );
+      }
+      b( k, i ) = rhs( i );
+    }
+  }
+}
+
+template< integer N >
+void batchedSolveTest()
+{
+  localIndex const numSystems = 100;
+  array3d< real64 > A;
+  array2d< real64 > b;
+  fillBatch< N >( A, b, numSystems );
+
+  array3d< real64 > const A0 = A;
+  array2d< real64 > const b0 = b;
+
+  localIndex const numSingular = denseLinearAlgebra::batchedSolve< N >( A.toView(), b.toView() );
+  EXPECT_EQ( numSingular, 0 );
+
+  b.move( hostMemorySpace, false );
+  for( localIndex k = 0; k < numSystems; ++k )
+  {
+    // check the residual of the original system
+    for( integer i = 0; i < N; ++i )
+    {
+      real64 residual = -b0( k, i );
+      for( integer j = 0; j < N; ++j )
+      {
+        residual += A0( k, i, j ) * b( k, j );
+      }
+      EXPECT_NEAR( residual, 0.0, tolerance );
+    }
+  }
+}
+
+template< integer N >
+void batchedInvertTest()
+{
+  localIndex const numMatrices = 100;
+  array3d< real64 > A;
+  array2d< real64 > b;
+  fillBatch< N >( A, b, numMatrices );
+
+  array3d< real64 > Ainv( numMatrices, N, N );
+  localIndex const numSingular = denseLinearAlgebra::batchedInvert< N >( A.toViewConst(), Ainv.toView() );
+  EXPECT_EQ( numSingular, 0 );
+
+  Ainv.move( hostMemorySpace, false );
+  array2d< real64 > matrix( N, N );
+  array2d< real64 > matrixInv( N, N );
+  for( localIndex k = 0; k < numMatrices; ++k )
+  {
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        matrix( i, j ) = A( k, i, j );
+      }
+    }
+    BlasLapackLA::matrixInverse( matrix, matrixInv );
+    for( integer i = 0; i < N; ++i )
+    {
+      for( integer j = 0; j < N; ++j )
+      {
+        EXPECT_NEAR( Ainv( k, i, j ), matrixInv( i, j ), tolerance );
+      }
+    }
+  }
+}
+
+TEST( DenseLASolvers, batchedSolve )
+{
+  batchedSolveTest< 1 >();
+  batchedSolveTest< 3 >();
+  batchedSolveTest< 7 >();
+  batchedSolveTest< 16 >();
+}
+
+TEST( DenseLASolvers, batchedInvert )
+{
+  batchedInvertTest< 1 >();
+  batchedInvertTest< 4 >();
+  batchedInvertTest< 9 >();
+}
+
+TEST( DenseLASolvers, singularMatrix )
+{
+  real64 A[3][3] = { { 1.0, 2.0, 3.0 },
+                     { 2.0, 4.0, 6.0 },
+                     { 0.0, 1.0, 1.0 } };
+  real64 const b[3] = { 1.0, 1.0, 1.0 };
+  real64 x[3];
+  EXPECT_FALSE( denseLinearAlgebra::solve< 3 >( A, b, x ) );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geos::setupEnvironment( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::cleanupEnvironment();
+
+  return result;
+}
@@ -40,6 +40,7 @@ EventBase::EventBase( const string & name,
   m_maxEventDt( -1.0 ),
   m_finalDtStretch( 1e-3 ),
   m_targetExactStartStop( 0 ),
+  m_readOnly( 0 ),
   m_currentSubEvent( 0 ),
   m_targetExecFlag( 0 ),
   m_eventForecast( 0 ),
@@ -48,7 +49,8 @@ EventBase::EventBase( const string & name,
   m_timeStepEventCount( 0 ),
   m_eventProgress( 0 ),
   m_currentEventDtRequest( 0.0 ),
-  m_target( nullptr )
+  m_target( nullptr ),
+  m_taskPool( nullptr )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -89,6 +91,13 @@ EventBase::EventBase( const string & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "If this option is set, the event will reduce its timestep requests to match any specified beginTime/endTimes exactly." );
 
+  registerWrapper( viewKeyStruct::readOnlyString(), &m_readOnly ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "If this option is set, the target only reads the simulation state: it captures a snapshot of the state it needs, "
+                    "and the rest of its work runs on the task threads of the event manager, concurrently with the following events. "
+                    "Its results are then reported at the end of the following cycle. Only supported by some targets (e.g. SolidMechanicsStatistics)." );
+
   registerWrapper( viewKeyStruct::lastTimeString(), &m_lastTime ).
     setApplyDefaultValue( -1.0e100 ).
     setDescription( "Last event occurrence (time)" );
@@ -155,6 +164,11 @@ void EventBase::getTargetReferences()
     }
   }
 
+  GEOS_THROW_IF( m_readOnly && m_target != nullptr && !m_target->supportsReadOnlyExecution(),
+                 GEOS_FMT( "{}: the target {} cannot be executed by a read-only event",
+                           getWrapperDataContext( viewKeyStruct::readOnlyString() ), m_eventTarget ),
+                 InputError );
+
   this->forSubGroups< EventBase >( []( EventBase & subEvent )
   {
     subEvent.getTargetReferences();
@@ -230,8 +244,16 @@ bool EventBase::execute( real64 const time_n,
   if((m_target != nullptr) && (m_targetExecFlag == 0))
   {
     m_targetExecFlag = 1;
-    earlyReturn = earlyReturn ||
-                  m_target->execute( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+    if( m_readOnly )
+    {
+      m_taskPool->submit( m_target->executeReadOnly( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain ),
+                          cycleNumber );
+    }
+    else
+    {
+      earlyReturn = earlyReturn ||
+                    m_target->execute( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+    }
   }
 
   // Iterate through the sub-event list using the managed integer m_currentSubEvent
@@ -336,6 +358,24 @@ integer EventBase::getExitFlag()
 
 
 
+void EventBase::reinit()
+{
+  m_lastTime = -1.0e100;
+  m_lastCycle = -1.0e9;
+  m_currentSubEvent = 0;
+  m_targetExecFlag = 0;
+  m_eventForecast = 0;
+  m_exitFlag = 0;
+  m_eventProgress = 0;
+  m_currentEventDtRequest = 0.0;
+
+  this->forSubGroups< EventBase >( []( EventBase & subEvent )
+  {
+    subEvent.reinit();
+  } );
+}
+
+
 void EventBase::getExecutionOrder( array1d< integer > & eventCounters )
 {
   // The first entry counts all events, the second tracks solver events
@@ -376,4 +416,14 @@ void EventBase::setProgressIndicator( array1d< integer > & eventCounters )
   } );
 }
 
+void EventBase::setTaskPool( EventTaskPool * const taskPool )
+{
+  m_taskPool = taskPool;
+
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.setTaskPool( taskPool );
+  } );
+}
+
 } /* namespace geos */
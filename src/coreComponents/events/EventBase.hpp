@@ -21,6 +21,7 @@
 
 #include "dataRepository/Group.hpp"
 #include "dataRepository/ExecutableGroup.hpp"
+#include "events/EventTaskPool.hpp"
 
 
 namespace geos
@@ -160,6 +161,11 @@ public:
     return std::numeric_limits< real64 >::max();
   }
 
+  /**
+   * @brief Reset the execution state of the event and of its sub-events, to run the event loop again from the start.
+   */
+  virtual void reinit() override;
+
   /**
    * @brief Helper function to validate the consistency of the event input
    * @note We cannot use postProcessInput here because we can perform the validation only after the m_target pointer is set
@@ -182,6 +188,12 @@ public:
    */
   void setProgressIndicator( array1d< integer > & eventCounters );
 
+  /**
+   * @brief Set the task pool running the targets of the read-only event/sub-events.
+   * @param taskPool the task pool of the event manager
+   */
+  void setTaskPool( EventTaskPool * const taskPool );
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
@@ -197,6 +209,7 @@ public:
     static constexpr char const * currentSubEventString() { return "currentSubEvent"; }
     static constexpr char const * isTargetExecutingString() { return "isTargetExecuting"; }
     static constexpr char const * finalDtStretchString() { return "finalDtStretch"; }
+    static constexpr char const * readOnlyString() { return "readOnly"; }
 
     dataRepository::ViewKey eventTarget = { eventTargetString() };
     dataRepository::ViewKey beginTime = { beginTimeString() };
@@ -343,6 +356,7 @@ private:
   real64 m_maxEventDt;
   real64 m_finalDtStretch;
   integer m_targetExactStartStop;
+  integer m_readOnly;
   integer m_currentSubEvent;
   integer m_targetExecFlag;
   integer m_eventForecast;
@@ -354,6 +368,9 @@ private:
 
   /// A pointer to the optional event target
   ExecutableGroup * m_target;
+
+  /// The task pool running the target if the event is read-only
+  EventTaskPool * m_taskPool;
 };
 
 } /* namespace geos */
@@ -22,6 +22,8 @@
 #include "events/EventBase.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 
+#include <chrono>
+
 namespace geos
 {
 
@@ -38,7 +40,9 @@ EventManager::EventManager( string const & name,
   m_dt(),
   m_cycle(),
   m_currentSubEvent(),
-  m_timeOutputFormat( TimeOutputFormat::seconds )
+  m_timeOutputFormat( TimeOutputFormat::seconds ),
+  m_taskThreads( 1 ),
+  m_taskPool()
 {
   setInputFlags( InputFlags::REQUIRED );
 
@@ -80,6 +84,13 @@ EventManager::EventManager( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "Format of the time in the GEOS log." );
+
+  registerWrapper( viewKeyStruct::taskThreadsString(), &m_taskThreads ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Number of threads running the targets of the read-only events concurrently with the other events. "
+                    "If set to 0, the read-only events run on the main thread when they are executed." );
 }
 
 
@@ -106,6 +117,20 @@ void EventManager::expandObjectCatalogs()
 }
 
 
+void EventManager::reinit()
+{
+  m_time = m_minTime;
+  m_dt = 0;
+  m_cycle = 0;
+  m_currentSubEvent = 0;
+
+  this->forSubGroups< EventBase >( []( EventBase & subEvent )
+  {
+    subEvent.reinit();
+  } );
+}
+
+
 bool EventManager::run( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
@@ -121,10 +146,17 @@ bool EventManager::run( DomainPartition & domain )
     subEvent.validate();
   } );
 
-  // Set the progress indicators
+  // Set the progress indicators and the task pool of the read-only events
+  GEOS_THROW_IF_LT_MSG( m_taskThreads, 0,
+                        getWrapperDataContext( viewKeyStruct::taskThreadsString() ) << ": the number of task threads must be non-negative",
+                        InputError );
+  m_taskPool.setNumThreads( m_taskThreads );
+  m_eventWallTimes.resize( this->numSubGroups(), 0.0 );
+  m_eventExecutionCounts.resize( this->numSubGroups(), 0 );
   this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
   {
     subEvent.setProgressIndicator( eventCounters );
+    subEvent.setTaskPool( &m_taskPool );
   } );
 
   // Inform user if it appears this is a mid-loop restart
@@ -190,7 +222,10 @@ bool EventManager::run( DomainPartition & domain )
       }
       else if( subEvent->isReadyForExec() )
       {
+        std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
         earlyReturn = subEvent->execute( m_time, m_dt, m_cycle, 0, 0, domain );
+        m_eventWallTimes[m_currentSubEvent] += std::chrono::duration< real64 >( std::chrono::steady_clock::now() - startTime ).count();
+        ++m_eventExecutionCounts[m_currentSubEvent];
       }
 
       // Check the exit flag
@@ -205,12 +240,20 @@ bool EventManager::run( DomainPartition & domain )
       }
     }
 
+    // Complete the read-only tasks of the previous cycle, which ran concurrently with the events of this cycle
+    m_taskPool.completeTasks( m_cycle - 1 );
+
+    // Write the rank messages of the cycle, if they are buffered
+    logger::FlushRankBuffers();
+
     // Increment time/cycle, reset the subevent counter
     m_time += m_dt;
     ++m_cycle;
     m_currentSubEvent = 0;
   }
 
+  m_taskPool.completeAllTasks();
+
   // Cleanup
   GEOS_LOG_RANK_0( "Cleaning up events" );
 
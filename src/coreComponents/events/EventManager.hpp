@@ -18,6 +18,7 @@
 
 #include "dataRepository/Group.hpp"
 #include "EventBase.hpp"
+#include "EventTaskPool.hpp"
 
 namespace geos
 {
@@ -79,6 +80,53 @@ public:
    */
   bool run( DomainPartition & domain );
 
+  /**
+   * @brief Reset the time, the cycle and the state of all the events, to run the event loop again from the start.
+   */
+  virtual void reinit() override;
+
+  /**
+   * @brief Get the simulation time at the beginning of the current cycle.
+   * @return the current time
+   */
+  real64 getTime() const { return m_time; }
+
+  /**
+   * @brief Get the simulation end time.
+   * @return the max time
+   */
+  real64 getMaxTime() const { return m_maxTime; }
+
+  /**
+   * @brief Get the current cycle.
+   * @return the current cycle
+   */
+  integer getCycle() const { return m_cycle; }
+
+  /**
+   * @brief Get the maximum number of cycles.
+   * @return the max cycle
+   */
+  integer getMaxCycle() const { return m_maxCycle; }
+
+  /**
+   * @brief Set the maximum number of cycles, e.g. to run only a few cycles of the event loop.
+   * @param[in] maxCycle the max cycle
+   */
+  void setMaxCycle( integer const maxCycle ) { m_maxCycle = maxCycle; }
+
+  /**
+   * @brief Get the wall time spent in the executions of each event.
+   * @return the cumulative wall time (in s) of each event, in the order of the events
+   */
+  std::vector< real64 > const & getEventWallTimes() const { return m_eventWallTimes; }
+
+  /**
+   * @brief Get the number of executions of each event.
+   * @return the number of executions of each event, in the order of the events
+   */
+  std::vector< integer > const & getEventExecutionCounts() const { return m_eventExecutionCounts; }
+
   /**
    * @name viewKeyStruct/groupKeyStruct
    */
@@ -96,6 +144,7 @@ public:
     static constexpr char const * currentSubEventString() { return "currentSubEvent"; }
 
     static constexpr char const * timeOutputFormat() { return "timeOutputFormat"; }
+    static constexpr char const * taskThreadsString() { return "taskThreads"; }
 
 
     dataRepository::ViewKey time = { "time" };
@@ -167,6 +216,18 @@ private:
 
   /// time output type
   TimeOutputFormat m_timeOutputFormat;
+
+  /// Number of threads running the targets of the read-only events
+  integer m_taskThreads;
+
+  /// Task pool running the targets of the read-only events
+  EventTaskPool m_taskPool;
+
+  /// Cumulative wall time of the executions of each event (in s)
+  std::vector< real64 > m_eventWallTimes;
+
+  /// Number of executions of each event
+  std::vector< integer > m_eventExecutionCounts;
 };
 
 /// valid strings fort the time output enum.
@@ -0,0 +1,157 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file EventTaskPool.cpp
+ */
+
+#include "EventTaskPool.hpp"
+
+#include "LvArray/src/system.hpp"
+
+#include <limits>
+
+namespace geos
+{
+
+EventTaskPool::~EventTaskPool()
+{
+  stopThreads();
+}
+
+void EventTaskPool::setNumThreads( integer const numThreads )
+{
+  GEOS_ERROR_IF_LT( numThreads, 0 );
+  if( LvArray::integerConversion< integer >( m_threads.size() ) == numThreads )
+  {
+    return;
+  }
+
+  completeAllTasks();
+  stopThreads();
+
+  m_stop = false;
+  for( integer i = 0; i < numThreads; ++i )
+  {
+    m_threads.emplace_back( [this]() { work(); } );
+  }
+}
+
+void EventTaskPool::submit( ExecutableGroup::ReadOnlyTask task, integer const cycle )
+{
+  if( m_threads.empty() )
+  {
+    m_entries.push_back( { std::move( task ), cycle, false, nullptr } );
+    compute( m_entries.back() );
+    m_entries.back().computed = true;
+    ++m_nextToCompute;
+    return;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_entries.push_back( { std::move( task ), cycle, false, nullptr } );
+  }
+  m_taskSubmitted.notify_one();
+}
+
+void EventTaskPool::completeTasks( integer const cycle )
+{
+  while( true )
+  {
+    Entry entry;
+    {
+      std::unique_lock< std::mutex > lock( m_mutex );
+      if( m_entries.empty() || m_entries.front().cycle > cycle )
+      {
+        return;
+      }
+      m_taskComputed.wait( lock, [this]() { return m_entries.front().computed; } );
+      entry = std::move( m_entries.front() );
+      m_entries.pop_front();
+      --m_nextToCompute;
+    }
+
+    if( entry.error )
+    {
+      std::rethrow_exception( entry.error );
+    }
+    if( entry.task.complete )
+    {
+      entry.task.complete();
+    }
+  }
+}
+
+void EventTaskPool::completeAllTasks()
+{
+  completeTasks( std::numeric_limits< integer >::max() );
+}
+
+void EventTaskPool::work()
+{
+  LvArray::system::FloatingPointExceptionGuard threadGuard;
+  while( true )
+  {
+    Entry * entry = nullptr;
+    {
+      std::unique_lock< std::mutex > lock( m_mutex );
+      m_taskSubmitted.wait( lock, [this]() { return m_stop || m_nextToCompute < m_entries.size(); } );
+      if( m_nextToCompute == m_entries.size() )
+      {
+        return;
+      }
+      entry = &m_entries[m_nextToCompute++];
+    }
+
+    compute( *entry );
+
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      entry->computed = true;
+    }
+    m_taskComputed.notify_all();
+  }
+}
+
+void EventTaskPool::compute( Entry & entry )
+{
+  try
+  {
+    if( entry.task.compute )
+    {
+      entry.task.compute();
+    }
+  }
+  catch( ... )
+  {
+    entry.error = std::current_exception();
+  }
+}
+
+void EventTaskPool::stopThreads()
+{
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+  m_taskSubmitted.notify_all();
+  for( std::thread & thread : m_threads )
+  {
+    thread.join();
+  }
+  m_threads.clear();
+}
+
+} /* namespace geos */
@@ -0,0 +1,128 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file EventTaskPool.hpp
+ */
+
+#ifndef GEOS_EVENTS_EVENTTASKPOOL_HPP_
+#define GEOS_EVENTS_EVENTTASKPOOL_HPP_
+
+#include "dataRepository/ExecutableGroup.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace geos
+{
+
+/**
+ * @class EventTaskPool
+ *
+ * Thread pool of the event manager, running the tasks of the read-only events.
+ *
+ * The compute part of the tasks runs on the threads of the pool, in any order, while the complete part
+ * runs on the main thread in the order of submission when the event manager completes the tasks.
+ */
+class EventTaskPool
+{
+public:
+
+  /// Constructor, the pool has no thread until setNumThreads is called.
+  EventTaskPool() = default;
+
+  /// Destructor, waits for the tasks being computed (without completing them).
+  ~EventTaskPool();
+
+  EventTaskPool( EventTaskPool const & ) = delete;
+  EventTaskPool & operator=( EventTaskPool const & ) = delete;
+
+  /**
+   * @brief Set the number of threads of the pool.
+   * @param numThreads the number of threads, the tasks are computed on the main thread at submission if 0
+   */
+  void setNumThreads( integer const numThreads );
+
+  /**
+   * @brief Submit a task.
+   * @param task the task of a read-only event
+   * @param cycle the cycle of the event
+   */
+  void submit( ExecutableGroup::ReadOnlyTask task, integer const cycle );
+
+  /**
+   * @brief Wait for the tasks submitted up to a given cycle, and complete them in the order of submission.
+   * @param cycle the last cycle of the tasks to complete
+   *
+   * @details An exception thrown while computing a task is rethrown here.
+   */
+  void completeTasks( integer const cycle );
+
+  /**
+   * @brief Wait for all the tasks, and complete them in the order of submission.
+   */
+  void completeAllTasks();
+
+private:
+
+  /// A submitted task
+  struct Entry
+  {
+    /// The task
+    ExecutableGroup::ReadOnlyTask task;
+    /// The cycle of submission
+    integer cycle = 0;
+    /// True once the compute part has run
+    bool computed = false;
+    /// Exception thrown by the compute part
+    std::exception_ptr error;
+  };
+
+  /// Main function of the threads of the pool
+  void work();
+
+  /// Compute the task of an entry, catching its exception
+  static void compute( Entry & entry );
+
+  /// Stop and join the threads of the pool
+  void stopThreads();
+
+  /// Submitted tasks, in the order of submission (the deque keeps the references to the entries valid on insertion)
+  std::deque< Entry > m_entries;
+
+  /// Index in m_entries of the first task to compute
+  std::size_t m_nextToCompute = 0;
+
+  /// Threads of the pool
+  std::vector< std::thread > m_threads;
+
+  /// True when the threads must exit
+  bool m_stop = false;
+
+  /// Mutex protecting the entries
+  std::mutex m_mutex;
+
+  /// Signals a new task to the threads
+  std::condition_variable m_taskSubmitted;
+
+  /// Signals a computed task to the main thread
+  std::condition_variable m_taskComputed;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_EVENTS_EVENTTASKPOOL_HPP_ */
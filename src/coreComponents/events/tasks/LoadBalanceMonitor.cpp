@@ -0,0 +1,189 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LoadBalanceMonitor.cpp
+ */
+
+#include "LoadBalanceMonitor.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/NeighborCommunicator.hpp"
+
+namespace geos
+{
+
+using namespace dataRepository;
+
+LoadBalanceMonitor::LoadBalanceMonitor( string const & name,
+                                        Group * const parent ):
+  TaskBase( name, parent ),
+  m_cellElementWeight( 1.0 ),
+  m_surfaceElementWeight( 1.0 ),
+  m_wellElementWeight( 1.0 ),
+  m_imbalanceTolerance( 1.2 ),
+  m_haltOnImbalance( 0 ),
+  m_imbalance( 1.0 )
+{
+  enableLogLevelInput();
+
+  registerWrapper( viewKeyStruct::cellElementWeightString(), &m_cellElementWeight ).
+    setApplyDefaultValue( 1.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Work associated with each locally owned cell element" );
+
+  registerWrapper( viewKeyStruct::surfaceElementWeightString(), &m_surfaceElementWeight ).
+    setApplyDefaultValue( 1.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Work associated with each locally owned surface (face or embedded) element" );
+
+  registerWrapper( viewKeyStruct::wellElementWeightString(), &m_wellElementWeight ).
+    setApplyDefaultValue( 1.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Work associated with each locally owned well element" );
+
+  registerWrapper( viewKeyStruct::imbalanceToleranceString(), &m_imbalanceTolerance ).
+    setApplyDefaultValue( 1.2 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Tolerance on the ratio of the maximum work of a rank over the average work of the ranks" );
+
+  registerWrapper( viewKeyStruct::haltOnImbalanceString(), &m_haltOnImbalance ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to stop the simulation when the imbalance exceeds the tolerance, so that it can be restarted "
+                    "with a new partition" );
+
+  registerWrapper( viewKeyStruct::imbalanceString(), &m_imbalance ).
+    setApplyDefaultValue( 1.0 ).
+    setInputFlag( InputFlags::FALSE ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Ratio of the maximum work of a rank over the average work of the ranks, measured at the last execution" );
+}
+
+void LoadBalanceMonitor::postProcessInput()
+{
+  GEOS_THROW_IF( m_cellElementWeight < 0.0 || m_surfaceElementWeight < 0.0 || m_wellElementWeight < 0.0,
+                 GEOS_FMT( "Task {}: the element weights must be non-negative", getDataContext() ),
+                 InputError );
+
+  GEOS_THROW_IF_LT_MSG( m_imbalanceTolerance, 1.0,
+                        GEOS_FMT( "Task {}: the imbalance tolerance must be greater than or equal to 1",
+                                  getDataContext() ),
+                        InputError );
+}
+
+real64 LoadBalanceMonitor::computeLocalWork( DomainPartition const & domain ) const
+{
+  real64 work = 0.0;
+  domain.forMeshBodies( [&]( MeshBody const & meshBody )
+  {
+    ElementRegionManager const & elemManager = meshBody.getBaseDiscretization().getElemManager();
+
+    elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+    {
+      work += m_cellElementWeight * subRegion.getNumberOfLocalIndices();
+    } );
+    elemManager.forElementSubRegions< FaceElementSubRegion, EmbeddedSurfaceSubRegion >( [&]( auto const & subRegion )
+    {
+      work += m_surfaceElementWeight * subRegion.getNumberOfLocalIndices();
+    } );
+    elemManager.forElementSubRegions< WellElementSubRegion >( [&]( WellElementSubRegion const & subRegion )
+    {
+      work += m_wellElementWeight * subRegion.getNumberOfLocalIndices();
+    } );
+  } );
+  return work;
+}
+
+void LoadBalanceMonitor::reportCommunication( real64 const time_n, DomainPartition & domain ) const
+{
+  std::vector< NeighborCommunicator > & neighbors = domain.getNeighbors();
+
+  real64 localBytes = 0.0;
+  real64 localWaitTime = 0.0;
+  for( NeighborCommunicator const & neighbor : neighbors )
+  {
+    localBytes += neighbor.numBytesSent() + neighbor.numBytesReceived();
+    localWaitTime += neighbor.waitTime();
+  }
+
+  real64 const maxBytes = MpiWrapper::max( localBytes );
+  real64 const avgBytes = MpiWrapper::sum( localBytes ) / MpiWrapper::commSize();
+  real64 const maxWaitTime = MpiWrapper::max( localWaitTime );
+  real64 const avgWaitTime = MpiWrapper::sum( localWaitTime ) / MpiWrapper::commSize();
+
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "Task `{}`: at time {}s, communicated bytes per rank: max = {}, average = {}, "
+                                      "wait time per rank: max = {}s, average = {}s",
+                                      getName(), time_n, maxBytes, avgBytes, maxWaitTime, avgWaitTime ) );
+
+  // a neighbor is flagged when its traffic or wait time exceeds the tolerance times the average over the neighbors of the rank
+  if( getLogLevel() >= 2 && !neighbors.empty() )
+  {
+    real64 const avgNeighborBytes = localBytes / neighbors.size();
+    real64 const avgNeighborWaitTime = localWaitTime / neighbors.size();
+    for( NeighborCommunicator const & neighbor : neighbors )
+    {
+      real64 const bytes = neighbor.numBytesSent() + neighbor.numBytesReceived();
+      if( bytes > m_imbalanceTolerance * avgNeighborBytes || neighbor.waitTime() > m_imbalanceTolerance * avgNeighborWaitTime )
+      {
+        GEOS_LOG_RANK( GEOS_FMT( "Task `{}`: imbalanced neighbor {}: {} bytes sent, {} bytes received in {} exchanges, "
+                                 "wait time = {}s (averages over the neighbors: {} bytes, {}s)",
+                                 getName(), neighbor.neighborRank(), neighbor.numBytesSent(), neighbor.numBytesReceived(),
+                                 neighbor.numExchanges(), neighbor.waitTime(), avgNeighborBytes, avgNeighborWaitTime ) );
+      }
+    }
+  }
+
+  for( NeighborCommunicator & neighbor : neighbors )
+  {
+    neighbor.resetStatistics();
+  }
+}
+
+bool LoadBalanceMonitor::execute( real64 const time_n,
+                                  real64 const GEOS_UNUSED_PARAM( dt ),
+                                  integer const GEOS_UNUSED_PARAM( cycleNumber ),
+                                  integer const GEOS_UNUSED_PARAM( eventCounter ),
+                                  real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                                  DomainPartition & domain )
+{
+  real64 const localWork = computeLocalWork( domain );
+  real64 const maxWork = MpiWrapper::max( localWork );
+  real64 const minWork = MpiWrapper::min( localWork );
+  real64 const avgWork = MpiWrapper::sum( localWork ) / MpiWrapper::commSize();
+
+  m_imbalance = avgWork > 0.0 ? maxWork / avgWork : 1.0;
+
+  reportCommunication( time_n, domain );
+
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "Task `{}`: at time {}s, work per rank: min = {}, max = {}, average = {}, imbalance = {:.3f}",
+                                      getName(), time_n, minWork, maxWork, avgWork, m_imbalance ) );
+
+  if( m_imbalance > m_imbalanceTolerance )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "Task `{}`: at time {}s, the load imbalance {:.3f} exceeds the tolerance {}{}",
+                               getName(), time_n, m_imbalance, m_imbalanceTolerance,
+                               m_haltOnImbalance ? ", stopping the simulation" : "" ) );
+    return m_haltOnImbalance != 0;
+  }
+
+  return false;
+}
+
+REGISTER_CATALOG_ENTRY( TaskBase,
+                        LoadBalanceMonitor,
+                        string const &, dataRepository::Group * const )
+
+} /* namespace geos */
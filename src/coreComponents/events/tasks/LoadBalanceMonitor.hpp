@@ -0,0 +1,133 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LoadBalanceMonitor.hpp
+ */
+
+#ifndef GEOS_EVENTS_TASKS_LOADBALANCEMONITOR_HPP_
+#define GEOS_EVENTS_TASKS_LOADBALANCEMONITOR_HPP_
+
+#include "events/tasks/TaskBase.hpp"
+
+namespace geos
+{
+
+/**
+ * @class LoadBalanceMonitor
+ *
+ * Task measuring the work of each rank, estimated from its locally owned elements, and reporting
+ * the load imbalance across ranks. Combined with a periodic event, it tracks how the imbalance
+ * evolves as surface elements are created by topology changes (e.g. fracture growth), so that
+ * the run can be stopped and repartitioned when the imbalance exceeds a tolerance. The task also
+ * reports the bytes exchanged with the neighbor ranks and the time spent waiting for them since
+ * its last execution, to diagnose the slowdowns caused by the partition.
+ */
+class LoadBalanceMonitor : public TaskBase
+{
+public:
+
+  /**
+   * @brief Constructor for the load balance monitor
+   * @param[in] name the name of the task coming from the xml
+   * @param[in] parent the parent group of the task
+   */
+  LoadBalanceMonitor( string const & name,
+                      Group * const parent );
+
+  /// Accessor for the catalog name
+  static string catalogName() { return "LoadBalanceMonitor"; }
+
+  /**
+   * @defgroup Tasks Interface Functions
+   *
+   * This function implements the interface defined by the abstract TaskBase class
+   */
+  /**@{*/
+
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**@}*/
+
+  /**
+   * @brief Compute the work of the current rank.
+   * @param[in] domain the domain partition
+   * @return the weighted number of locally owned elements of all the mesh bodies
+   */
+  real64 computeLocalWork( DomainPartition const & domain ) const;
+
+  /**
+   * @brief Get the imbalance measured at the last execution.
+   * @return the ratio of the maximum work over the average work of the ranks
+   */
+  real64 getImbalance() const { return m_imbalance; }
+
+private:
+
+  /**
+   * @brief Report the communication statistics gathered by the neighbor communicators since the last
+   *        execution, flag the neighbors with an imbalanced traffic or wait time, and reset the statistics.
+   * @param[in] time_n the current time
+   * @param[in] domain the domain partition
+   */
+  void reportCommunication( real64 const time_n, DomainPartition & domain ) const;
+
+  /**
+   * @struct viewKeyStruct holds char strings and viewKeys for fast lookup
+   */
+  struct viewKeyStruct
+  {
+    /// String for the weight of the cell elements
+    constexpr static char const * cellElementWeightString() { return "cellElementWeight"; }
+    /// String for the weight of the surface elements
+    constexpr static char const * surfaceElementWeightString() { return "surfaceElementWeight"; }
+    /// String for the weight of the well elements
+    constexpr static char const * wellElementWeightString() { return "wellElementWeight"; }
+    /// String for the imbalance tolerance
+    constexpr static char const * imbalanceToleranceString() { return "imbalanceTolerance"; }
+    /// String for the flag stopping the run when the tolerance is exceeded
+    constexpr static char const * haltOnImbalanceString() { return "haltOnImbalance"; }
+    /// String for the measured imbalance
+    constexpr static char const * imbalanceString() { return "imbalance"; }
+  };
+
+  void postProcessInput() override;
+
+  /// Work of a cell element
+  real64 m_cellElementWeight;
+
+  /// Work of a surface (face or embedded) element
+  real64 m_surfaceElementWeight;
+
+  /// Work of a well element
+  real64 m_wellElementWeight;
+
+  /// Tolerance on the ratio of the maximum work over the average work
+  real64 m_imbalanceTolerance;
+
+  /// Flag stopping the run when the imbalance exceeds the tolerance
+  integer m_haltOnImbalance;
+
+  /// Imbalance measured at the last execution
+  real64 m_imbalance;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_EVENTS_TASKS_LOADBALANCEMONITOR_HPP_ */
@@ -0,0 +1,219 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MemoryReport.cpp
+ */
+
+#include "MemoryReport.hpp"
+
+#include "codingUtilities/StringUtilities.hpp"
+#include "common/MpiWrapper.hpp"
+#include "dataRepository/Utilities.hpp"
+#include "mesh/DomainPartition.hpp"
+
+#include <umpire/ResourceManager.hpp>
+
+#if defined( GEOSX_USE_CALIPER ) && defined( GEOSX_USE_ADIAK )
+#include <adiak.hpp>
+#endif
+
+#include <algorithm>
+#include <map>
+
+namespace geos
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/**
+ * @brief Format a number of bytes with a metric prefix.
+ * @param[in] bytes the number of bytes
+ * @return the formatted size
+ */
+string formatBytes( size_t const bytes )
+{
+  return stringutilities::toMetricPrefixString( bytes ) + 'B';
+}
+
+/**
+ * @brief Format the tables of the largest allocations of the current rank.
+ * @param[in] allocations the allocations of the wrappers of the current rank
+ * @param[in] localBytes the number of bytes allocated by the wrappers of the current rank
+ * @param[in] maxNumberOfEntries the number of entries of the tables
+ * @return the formatted tables
+ */
+string formatLocalReport( std::vector< WrapperAllocation > & allocations,
+                          size_t const localBytes,
+                          integer const maxNumberOfEntries )
+{
+  real64 const percentFactor = localBytes > 0 ? 100.0 / localBytes : 0.0;
+  size_t const numEntries = LvArray::integerConversion< size_t >( maxNumberOfEntries );
+
+  // sum the allocations of the wrappers of each group, e.g. the fields of an element sub-region
+  std::map< string, size_t > groupBytes;
+  for( WrapperAllocation const & allocation : allocations )
+  {
+    groupBytes[allocation.groupPath] += allocation.bytes;
+  }
+  std::vector< std::pair< string, size_t > > groups( groupBytes.begin(), groupBytes.end() );
+  std::stable_sort( groups.begin(), groups.end(),
+                    []( auto const & lhs, auto const & rhs ) { return lhs.second > rhs.second; } );
+
+  std::stable_sort( allocations.begin(), allocations.end(),
+                    []( WrapperAllocation const & lhs, WrapperAllocation const & rhs ) { return lhs.bytes > rhs.bytes; } );
+
+  string report = GEOS_FMT( "  Largest groups of rank {}:\n", MpiWrapper::commRank() );
+  for( size_t i = 0; i < std::min( numEntries, groups.size() ); ++i )
+  {
+    report += GEOS_FMT( "    {:>9s} {:>6.2f}%  {}\n",
+                        formatBytes( groups[i].second ), percentFactor * groups[i].second, groups[i].first );
+  }
+
+  report += GEOS_FMT( "  Largest wrappers of rank {}:\n", MpiWrapper::commRank() );
+  for( size_t i = 0; i < std::min( numEntries, allocations.size() ); ++i )
+  {
+    WrapperAllocation const & allocation = allocations[i];
+    report += GEOS_FMT( "    {:>9s} {:>6.2f}%  {:<6}  {}/{}\n",
+                        formatBytes( allocation.bytes ), percentFactor * allocation.bytes,
+                        allocation.space == hostMemorySpace ? "host" : "device",
+                        allocation.groupPath, allocation.wrapperName );
+  }
+
+  // the Umpire allocators also account for the memory allocated outside of the data repository
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+  std::vector< string > allocatorNames = rm.getAllocatorNames();
+  std::sort( allocatorNames.begin(), allocatorNames.end() );
+  report += GEOS_FMT( "  Umpire allocators of rank {}:\n", MpiWrapper::commRank() );
+  for( string const & allocatorName : allocatorNames )
+  {
+    // Skip umpire internal allocators.
+    if( allocatorName.rfind( "__umpire_internal", 0 ) == 0 )
+      continue;
+
+    umpire::Allocator allocator = rm.getAllocator( allocatorName );
+    report += GEOS_FMT( "    {:<15} current size: {:>9s}, high-water mark: {:>9s}\n",
+                        allocatorName, formatBytes( allocator.getCurrentSize() ), formatBytes( allocator.getHighWatermark() ) );
+  }
+
+  return report;
+}
+
+}
+
+MemoryReport::MemoryReport( string const & name,
+                            Group * const parent ):
+  TaskBase( name, parent ),
+  m_maxNumberOfEntries( 20 ),
+  m_rankHighWaterMark( 0.0 ),
+  m_totalHighWaterMark( 0.0 )
+{
+  enableLogLevelInput();
+
+  registerWrapper( viewKeyStruct::maxNumberOfEntriesString(), &m_maxNumberOfEntries ).
+    setApplyDefaultValue( 20 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of entries of the tables listing the largest groups and wrappers of the rank with the largest allocations. "
+                    "Set to 0 to only report the totals and the high-water marks" );
+
+  registerWrapper( viewKeyStruct::rankHighWaterMarkString(), &m_rankHighWaterMark ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::FALSE ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Largest number of bytes allocated by the data repository of a single rank over the executions" );
+
+  registerWrapper( viewKeyStruct::totalHighWaterMarkString(), &m_totalHighWaterMark ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::FALSE ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Largest number of bytes allocated by the data repository of all the ranks over the executions" );
+}
+
+void MemoryReport::postProcessInput()
+{
+  GEOS_THROW_IF_LT_MSG( m_maxNumberOfEntries, 0,
+                        GEOS_FMT( "Task {}: the number of entries must be non-negative", getDataContext() ),
+                        InputError );
+}
+
+bool MemoryReport::execute( real64 const time_n,
+                            real64 const GEOS_UNUSED_PARAM( dt ),
+                            integer const GEOS_UNUSED_PARAM( cycleNumber ),
+                            integer const GEOS_UNUSED_PARAM( eventCounter ),
+                            real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                            DomainPartition & domain )
+{
+  std::vector< WrapperAllocation > allocations;
+  collectMemoryAllocations( domain, allocations );
+
+  size_t hostBytes = 0;
+  size_t deviceBytes = 0;
+  for( WrapperAllocation const & allocation : allocations )
+  {
+    ( allocation.space == hostMemorySpace ? hostBytes : deviceBytes ) += allocation.bytes;
+  }
+  size_t const localBytes = hostBytes + deviceBytes;
+
+  size_t const maxBytes = MpiWrapper::max( localBytes );
+  size_t const sumBytes = MpiWrapper::sum( localBytes );
+  size_t const maxHostBytes = MpiWrapper::max( hostBytes );
+  size_t const maxDeviceBytes = MpiWrapper::max( deviceBytes );
+
+  m_rankHighWaterMark = std::max( m_rankHighWaterMark, static_cast< real64 >( maxBytes ) );
+  m_totalHighWaterMark = std::max( m_totalHighWaterMark, static_cast< real64 >( sumBytes ) );
+
+  GEOS_LOG_RANK_0( GEOS_FMT( "Task `{}`: at time {}s, data repository allocations: rank max = {} (host {}, device {}), "
+                             "high-water mark = {}; sum over ranks = {}, high-water mark = {}",
+                             getName(), time_n,
+                             formatBytes( maxBytes ), formatBytes( maxHostBytes ), formatBytes( maxDeviceBytes ),
+                             formatBytes( static_cast< size_t >( m_rankHighWaterMark ) ),
+                             formatBytes( sumBytes ),
+                             formatBytes( static_cast< size_t >( m_totalHighWaterMark ) ) ) );
+
+  if( m_maxNumberOfEntries > 0 )
+  {
+    // the tables are formatted by the rank with the largest allocations, which limits the size of the run
+    int const reportingRank = MpiWrapper::min( localBytes == maxBytes ? MpiWrapper::commRank() : MpiWrapper::commSize() );
+    string report;
+    if( MpiWrapper::commRank() == reportingRank )
+    {
+      report = formatLocalReport( allocations, localBytes, m_maxNumberOfEntries );
+    }
+    MpiWrapper::broadcast( report, reportingRank );
+    GEOS_LOG_RANK_0( report );
+  }
+
+  return false;
+}
+
+void MemoryReport::cleanup( real64 const GEOS_UNUSED_PARAM( time_n ),
+                            integer const GEOS_UNUSED_PARAM( cycleNumber ),
+                            integer const GEOS_UNUSED_PARAM( eventCounter ),
+                            real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                            DomainPartition & GEOS_UNUSED_PARAM( domain ) )
+{
+#if defined( GEOSX_USE_CALIPER ) && defined( GEOSX_USE_ADIAK )
+  adiak::value( GEOS_FMT( "{} rank high-water mark", getName() ), m_rankHighWaterMark );
+  adiak::value( GEOS_FMT( "{} total high-water mark", getName() ), m_totalHighWaterMark );
+#endif
+}
+
+REGISTER_CATALOG_ENTRY( TaskBase,
+                        MemoryReport,
+                        string const &, dataRepository::Group * const )
+
+} /* namespace geos */
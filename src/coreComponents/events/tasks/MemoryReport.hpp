@@ -0,0 +1,114 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MemoryReport.hpp
+ */
+
+#ifndef GEOS_EVENTS_TASKS_MEMORYREPORT_HPP_
+#define GEOS_EVENTS_TASKS_MEMORYREPORT_HPP_
+
+#include "events/tasks/TaskBase.hpp"
+
+namespace geos
+{
+
+/**
+ * @class MemoryReport
+ *
+ * Task reporting the memory allocated by the data repository of the domain, split between the host
+ * and the device memory spaces, along with the high-water marks reached over the executions. The
+ * largest wrappers and groups (e.g. element sub-regions) of the rank with the largest allocations are
+ * listed in a sorted table, followed by the current sizes and high-water marks of its Umpire allocators,
+ * to identify which fields dominate the memory footprint of a run.
+ */
+class MemoryReport : public TaskBase
+{
+public:
+
+  /**
+   * @brief Constructor for the memory report
+   * @param[in] name the name of the task coming from the xml
+   * @param[in] parent the parent group of the task
+   */
+  MemoryReport( string const & name,
+                Group * const parent );
+
+  /// Accessor for the catalog name
+  static string catalogName() { return "MemoryReport"; }
+
+  /**
+   * @defgroup Tasks Interface Functions
+   *
+   * This function implements the interface defined by the abstract TaskBase class
+   */
+  /**@{*/
+
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  virtual void cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**@}*/
+
+  /**
+   * @brief Get the high-water mark of the allocations of a single rank.
+   * @return the largest number of bytes allocated by a rank over the executions
+   */
+  real64 getRankHighWaterMark() const { return m_rankHighWaterMark; }
+
+  /**
+   * @brief Get the high-water mark of the allocations summed over the ranks.
+   * @return the largest number of bytes allocated by all the ranks over the executions
+   */
+  real64 getTotalHighWaterMark() const { return m_totalHighWaterMark; }
+
+private:
+
+  /**
+   * @struct viewKeyStruct holds char strings and viewKeys for fast lookup
+   */
+  struct viewKeyStruct
+  {
+    /// String for the number of entries of the tables
+    constexpr static char const * maxNumberOfEntriesString() { return "maxNumberOfEntries"; }
+    /// String for the high-water mark of a single rank
+    constexpr static char const * rankHighWaterMarkString() { return "rankHighWaterMark"; }
+    /// String for the high-water mark summed over the ranks
+    constexpr static char const * totalHighWaterMarkString() { return "totalHighWaterMark"; }
+  };
+
+  void postProcessInput() override;
+
+  /// Number of entries of the tables of the largest wrappers and groups
+  integer m_maxNumberOfEntries;
+
+  /// High-water mark of the allocations of a single rank, in bytes
+  real64 m_rankHighWaterMark;
+
+  /// High-water mark of the allocations summed over the ranks, in bytes
+  real64 m_totalHighWaterMark;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_EVENTS_TASKS_MEMORYREPORT_HPP_ */
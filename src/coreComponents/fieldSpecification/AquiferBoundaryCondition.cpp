@@ -292,18 +292,32 @@ void AquiferBoundaryCondition::computeInfluxConstant()
   m_influxConstant = 6.283 * m_thickness * ( m_angle / 360.0 ) * m_porosity * m_totalCompressibility * m_innerRadius * m_innerRadius;
 }
 
-AquiferBoundaryCondition::KernelWrapper AquiferBoundaryCondition::createKernelWrapper() const
+AquiferBoundaryCondition::KernelWrapper AquiferBoundaryCondition::createKernelWrapper( real64 const timeAtBeginningOfStep,
+                                                                                      real64 const dt ) const
 {
   FunctionManager const & functionManager = FunctionManager::getInstance();
   TableFunction const & pressureInfluenceFunction = functionManager.getGroup< TableFunction >( m_pressureInfluenceFunctionName );
 
-  return AquiferBoundaryCondition::KernelWrapper( m_initialPressure,
-                                                  m_density,
-                                                  m_elevation * m_gravityVector[2],
-                                                  m_timeConstant,
-                                                  m_influxConstant,
-                                                  m_cumulativeFlux,
-                                                  pressureInfluenceFunction.createKernelWrapper() );
+  // compute the dimensionless time (equation 5.5 of the Eclipse TD)
+  real64 const dimensionlessTimeAtBeginningOfStep = timeAtBeginningOfStep / m_timeConstant;
+  real64 const dimensionlessTimeAtEndOfStep = ( timeAtBeginningOfStep + dt ) / m_timeConstant;
+
+  // compute the pressure influence and its derivative wrt to dimensionless time
+  real64 dPresInfluence_dTime = 0;
+  real64 const presInfluence = pressureInfluenceFunction.createKernelWrapper().compute( &dimensionlessTimeAtEndOfStep, &dPresInfluence_dTime );
+
+  // compute the b (equation 5.9 of the Eclipse TD)
+  real64 const timeConstantInv = 1.0 / m_timeConstant;
+  real64 const denom = presInfluence - dimensionlessTimeAtBeginningOfStep * dPresInfluence_dTime;
+  real64 const b = timeConstantInv * m_influxConstant / denom;
+
+  // compute the part of a (equation 5.8 of the Eclipse TD) that does not depend on the reservoir
+  real64 const gravCoef = m_elevation * m_gravityVector[2];
+  real64 const a0 = b * ( m_initialPressure - m_density * gravCoef ) - timeConstantInv * m_cumulativeFlux * dPresInfluence_dTime / denom;
+
+  return AquiferBoundaryCondition::KernelWrapper( m_density,
+                                                  a0,
+                                                  b );
 }
 
 REGISTER_CATALOG_ENTRY( FieldSpecificationBase, AquiferBoundaryCondition, string const &, Group * const )
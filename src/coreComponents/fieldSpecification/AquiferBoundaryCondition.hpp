@@ -45,34 +45,21 @@ public:
 
     /**
      * @brief Constructor of the kernel wrapper
-     * @param[in] initialPressure the initial pressure in the aquifer
      * @param[in] density the water density in the aquifer
-     * @param[in] gravCoef the elevation * gravVector in the aquifer
-     * @param[in] timeConstant the time constant of the aquifer
-     * @param[in] influxConstant the influx constant of the aquifer
-     * @param[in] cumulativeFlux the cumulative flux of the aquifer
-     * @param[in] pressureInfluenceFunction the pressure influence function of the aquifer
+     * @param[in] aquiferFluxConstant the part of the coefficient a (equation 5.8 of the Eclipse TD) that does not
+     *                                depend on the reservoir, for the current time step
+     * @param[in] aquiferFluxSlope the coefficient b (equation 5.9 of the Eclipse TD) for the current time step
      */
-    KernelWrapper( real64 initialPressure,
-                   real64 density,
-                   real64 gravCoef,
-                   real64 timeConstant,
-                   real64 influxConstant,
-                   real64 cumulativeFlux,
-                   TableFunction::KernelWrapper pressureInfluenceFunction )
-      : m_initialPressure( initialPressure ),
-      m_density( density ),
-      m_gravCoef( gravCoef ),
-      m_timeConstant( timeConstant ),
-      m_influxConstant( influxConstant ),
-      m_cumulativeFlux( cumulativeFlux ),
-      m_pressureInfluenceFunction( pressureInfluenceFunction )
+    KernelWrapper( real64 density,
+                   real64 aquiferFluxConstant,
+                   real64 aquiferFluxSlope )
+      : m_density( density ),
+      m_aquiferFluxConstant( aquiferFluxConstant ),
+      m_aquiferFluxSlope( aquiferFluxSlope )
     {}
 
     /**
      * @brief Compute the aquifer-reservoir volumetric flux
-     * @param[in] timeAtBeginningOfStep the time at the beginning of the step
-     * @param[in] dt the time step size
      * @param[in] reservoirPressure the reservoir pressure
      * @param[in] reservoirPressure_n the reservoir pressure at the beginning of the time step
      * @param[in] reservoirGravCoef the elevation * gravVector in the aquifer
@@ -82,9 +69,7 @@ public:
      */
     GEOS_HOST_DEVICE
     inline real64
-    compute( real64 const & timeAtBeginningOfStep,
-             real64 const & dt,
-             real64 const & reservoirPressure,
+    compute( real64 const & reservoirPressure,
              real64 const & reservoirPressure_n,
              real64 const & reservoirGravCoef,
              real64 const & areaFraction,
@@ -94,26 +79,16 @@ private:
 
     // Physical parameters
 
-    /// Aquifer initial pressure
-    real64 m_initialPressure;
-
     /// Aquifer water density
     real64 m_density;
 
-    /// Aquifer gravity coefficient
-    real64 m_gravCoef;
-
-    /// Aquifer time constant
-    real64 m_timeConstant;
+    // Coefficients of the time step, computed once on the host
 
-    /// Aquifer influx constant
-    real64 m_influxConstant;
+    /// Part of the coefficient a that does not depend on the reservoir
+    real64 m_aquiferFluxConstant;
 
-    /// Aquifer cumulative influx
-    real64 m_cumulativeFlux;
-
-    /// Pressure influence function
-    TableFunction::KernelWrapper m_pressureInfluenceFunction;
+    /// Coefficient b
+    real64 m_aquiferFluxSlope;
 
   };
 
@@ -146,9 +121,15 @@ private:
 
   /**
    * @brief Create the wrapper performing in-kernel aquifer flow rate computation
+   * @param[in] timeAtBeginningOfStep the time at the beginning of the step
+   * @param[in] dt the time step size
    * @return the kernel wrapper
+   *
+   * The pressure influence function is evaluated once here for the time step,
+   * instead of once per aquifer face in the kernels.
    */
-  KernelWrapper createKernelWrapper() const;
+  KernelWrapper createKernelWrapper( real64 const timeAtBeginningOfStep,
+                                     real64 const dt ) const;
 
   /**
    * @brief Setter for the R1Tensor storing the gravity vector
@@ -348,36 +329,20 @@ private:
 GEOS_HOST_DEVICE
 real64
 AquiferBoundaryCondition::KernelWrapper::
-  compute( real64 const & timeAtBeginningOfStep,
-           real64 const & dt,
-           real64 const & reservoirPressure,
+  compute( real64 const & reservoirPressure,
            real64 const & reservoirPressure_n,
            real64 const & reservoirGravCoef,
            real64 const & areaFraction,
            real64 & dAquiferVolFlux_dPres ) const
 {
-  // compute the dimensionless time (equation 5.5 of the Eclipse TD)
-  real64 const dimensionlessTimeAtBeginningOfStep = timeAtBeginningOfStep / m_timeConstant;
-  real64 const dimensionlessTimeAtEndOfStep = ( timeAtBeginningOfStep + dt ) / m_timeConstant;
-
-  // compute the pressure influence and its derivative wrt to dimensionless time
-  real64 dPresInfluence_dTime = 0;
-  real64 const presInfluence = m_pressureInfluenceFunction.compute( &dimensionlessTimeAtEndOfStep, &dPresInfluence_dTime );
-
-  // compute the potential difference between the reservoir (old pressure) and the aquifer
-  real64 const potDiff = m_initialPressure - reservoirPressure_n - m_density * ( m_gravCoef - reservoirGravCoef );
-
-  // compute the a (equation 5.8 of the Eclipse TD)
-  real64 const timeConstantInv = 1.0 / m_timeConstant;
-  real64 const denom = presInfluence - dimensionlessTimeAtBeginningOfStep * dPresInfluence_dTime;
-  real64 const a = timeConstantInv * ( m_influxConstant * potDiff - m_cumulativeFlux * dPresInfluence_dTime ) / denom;
-
-  // compute the b (equation 5.9 of the Eclipse TD)
-  real64 const b = timeConstantInv * m_influxConstant / denom;
+  // compute the a (equation 5.8 of the Eclipse TD), in which the potential difference between the
+  // reservoir (old pressure) and the aquifer is the only contribution depending on the reservoir
+  real64 const a = m_aquiferFluxConstant
+                   - m_aquiferFluxSlope * ( reservoirPressure_n - m_density * reservoirGravCoef );
 
   // compute the average inflow rate Q (equation 5.7 of the Eclipse TD)
-  real64 const aquiferVolFlux =  areaFraction * ( a - b * ( reservoirPressure - reservoirPressure_n ) );
-  dAquiferVolFlux_dPres = -areaFraction * b;
+  real64 const aquiferVolFlux =  areaFraction * ( a - m_aquiferFluxSlope * ( reservoirPressure - reservoirPressure_n ) );
+  dAquiferVolFlux_dPres = -areaFraction * m_aquiferFluxSlope;
 
   return aquiferVolFlux;
 }
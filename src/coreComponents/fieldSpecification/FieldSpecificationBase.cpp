@@ -100,6 +100,7 @@ void FieldSpecificationBase::setMeshObjectPath( Group const & meshBodies )
   try
   {
     m_meshObjectPaths = std::make_unique< MeshObjectPath >( m_objectPath, meshBodies );
+    m_applicationPlans.clear();
   }
   catch( std::exception const & e )
   {
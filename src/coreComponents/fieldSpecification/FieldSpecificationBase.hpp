@@ -32,6 +32,8 @@
 #include "functions/FunctionManager.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
 
+#include <typeindex>
+
 namespace geos
 {
 class Function;
@@ -124,23 +126,13 @@ public:
   void apply( MeshLevel & mesh,
               LAMBDA && lambda ) const
   {
-    MeshObjectPath const & meshObjectPaths = this->getMeshObjectPaths();
-    meshObjectPaths.forObjectsInPath< OBJECT_TYPE >( mesh,
-                                                     [&] ( OBJECT_TYPE & object )
+    ApplicationPlan const & plan = getApplicationPlan< OBJECT_TYPE >( mesh );
+    for( ApplicationTarget const & target : plan.targets )
     {
-      {
-        dataRepository::Group const & setGroup = object.getGroup( ObjectManagerBase::groupKeyStruct::setsString() );
-        string_array setNames = this->getSetNames();
-        for( auto & setName : setNames )
-        {
-          if( setGroup.hasWrapper( setName ) )
-          {
-            SortedArrayView< localIndex const > const & targetSet = setGroup.getReference< SortedArray< localIndex > >( setName );
-            lambda( dynamic_cast< BC_TYPE const & >(*this), setName, targetSet, object, getFieldName() );
-          }
-        }
-      }
-    } );
+      SortedArrayView< localIndex const > const targetSet = target.set->toViewConst();
+      lambda( dynamic_cast< BC_TYPE const & >(*this), target.setName, targetSet,
+              dynamicCast< OBJECT_TYPE & >( *target.object ), getFieldName() );
+    }
   }
 
   /**
@@ -528,6 +520,7 @@ public:
   void addSetName( string const & setName )
   {
     m_setNames.emplace_back( setName );
+    m_applicationPlans.clear();
   }
 
   /**
@@ -553,6 +546,50 @@ protected:
 
 private:
 
+  /**
+   * @struct ApplicationTarget
+   * @brief An object and one of its sets targeted by the specification
+   */
+  struct ApplicationTarget
+  {
+    /// The object holding the set
+    dataRepository::Group * object;
+    /// The name of the set
+    string setName;
+    /// The set
+    SortedArray< localIndex > const * set;
+  };
+
+  /**
+   * @struct ApplicationPlan
+   * @brief The targets of the specification on a mesh level, resolved once instead of at every application
+   *
+   * The plan stays valid as long as the mesh level is not modified and no set is added to the targeted objects.
+   */
+  struct ApplicationPlan
+  {
+    /// Whether the targets have been resolved
+    bool isResolved = false;
+    /// The modification timestamp of the mesh level when the targets have been resolved
+    Timestamp meshTimestamp = 0;
+    /// The set groups of the objects in the path, with their number of sets when the targets have been resolved
+    std::vector< std::pair< dataRepository::Group const *, localIndex > > setGroups;
+    /// The resolved targets
+    std::vector< ApplicationTarget > targets;
+  };
+
+  /**
+   * @brief Get the targets of the specification on a mesh level, resolving them if the mesh has changed
+   * @tparam OBJECT_TYPE The type of discretization/mesh object that the specification is being applied to.
+   * @param mesh The MeshLevel that the specification is applied to
+   * @return the application plan
+   */
+  template< typename OBJECT_TYPE >
+  ApplicationPlan const & getApplicationPlan( MeshLevel & mesh ) const;
+
+  /// The application plans, per mesh level and type of targeted object
+  mutable std::map< std::pair< MeshLevel const *, std::type_index >, ApplicationPlan > m_applicationPlans;
+
 
   /// the names of the sets that the boundary condition is applied to
   string_array m_setNames;
@@ -594,6 +631,41 @@ private:
 };
 
 
+template< typename OBJECT_TYPE >
+FieldSpecificationBase::ApplicationPlan const &
+FieldSpecificationBase::getApplicationPlan( MeshLevel & mesh ) const
+{
+  ApplicationPlan & plan = m_applicationPlans[ { &mesh, std::type_index( typeid( OBJECT_TYPE ) ) } ];
+
+  bool isValid = plan.isResolved && plan.meshTimestamp == mesh.getModificationTimestamp();
+  for( auto const & setGroup : plan.setGroups )
+  {
+    isValid = isValid && setGroup.first->numWrappers() == setGroup.second;
+  }
+  if( isValid )
+  {
+    return plan;
+  }
+
+  plan.isResolved = true;
+  plan.meshTimestamp = mesh.getModificationTimestamp();
+  plan.setGroups.clear();
+  plan.targets.clear();
+  getMeshObjectPaths().forObjectsInPath< OBJECT_TYPE >( mesh, [&] ( OBJECT_TYPE & object )
+  {
+    dataRepository::Group const & setGroup = object.getGroup( ObjectManagerBase::groupKeyStruct::setsString() );
+    plan.setGroups.emplace_back( &setGroup, setGroup.numWrappers() );
+    for( string const & setName : m_setNames )
+    {
+      if( setGroup.hasWrapper( setName ) )
+      {
+        plan.targets.push_back( { &object, setName, &setGroup.getReference< SortedArray< localIndex > >( setName ) } );
+      }
+    }
+  } );
+  return plan;
+}
+
 template< typename FIELD_OP, typename POLICY, typename T, int N, int USD >
 void FieldSpecificationBase::applyFieldValueKernel( ArrayView< T, N, USD > const & field,
                                                     SortedArrayView< localIndex const > const & targetSet,
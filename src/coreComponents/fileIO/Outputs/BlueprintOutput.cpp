@@ -29,6 +29,10 @@
 #include <conduit_blueprint.hpp>
 #include <conduit_relay.hpp>
 
+#if defined( GEOSX_USE_ASCENT )
+#include <ascent.hpp>
+#endif
+
 namespace geos
 {
 namespace internal
@@ -124,6 +128,37 @@ BlueprintOutput::BlueprintOutput( string const & name,
     setApplyDefaultValue( false ).
     setInputFlag( dataRepository::InputFlags::OPTIONAL ).
     setDescription( "If true writes out data associated with every quadrature point." );
+
+  registerWrapper( "inSitu", &m_inSitu ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setDescription( "If true publishes the mesh and the fields to Ascent in-process instead of writing them to disk. "
+                    "The fields are referenced, not copied." );
+
+  registerWrapper( "ascentActionsFile", &m_ascentActionsFile ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setDescription( "Ascent actions file (yaml or json) describing the in-situ pipelines, scenes and extracts. "
+                    "If empty, Ascent looks for ascent_actions.yaml in the working directory." );
+}
+
+BlueprintOutput::~BlueprintOutput()
+{
+#if defined( GEOSX_USE_ASCENT )
+  if( m_ascent )
+  {
+    m_ascent->close();
+  }
+#endif
+}
+
+void BlueprintOutput::postProcessInput()
+{
+#if !defined( GEOSX_USE_ASCENT )
+  GEOS_THROW_IF( m_inSitu != 0,
+                 GEOS_FMT( "{} `{}`: in-situ mode requires GEOSX to be built with Ascent (ENABLE_ASCENT)",
+                           catalogName(), getDataContext() ),
+                 InputError );
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,6 +196,35 @@ bool BlueprintOutput::execute( real64 const time,
   conduit::Node info;
   GEOS_ASSERT_MSG( conduit::blueprint::verify( "mesh", meshRoot, info ), info.to_json() );
 
+#if defined( GEOSX_USE_ASCENT )
+  if( m_inSitu )
+  {
+    GEOS_MARK_SCOPE( publishToAscent );
+    if( !m_ascent )
+    {
+      conduit::Node options;
+#if defined( GEOSX_USE_MPI )
+      options[ "mpi_comm" ] = MPI_Comm_c2f( MPI_COMM_GEOSX );
+#endif
+      options[ "default_dir" ] = OutputBase::getOutputDirectory();
+      if( !m_ascentActionsFile.empty() )
+      {
+        options[ "actions_file" ] = m_ascentActionsFile;
+      }
+      m_ascent = std::make_unique< ascent::Ascent >();
+      m_ascent->open( options );
+    }
+
+    mesh[ "state/domain_id" ] = MpiWrapper::commRank();
+
+    /// The mesh node only references the host buffers of the fields, the pipelines run before they are modified.
+    m_ascent->publish( mesh );
+    conduit::Node const actions;
+    m_ascent->execute( actions );
+    return false;
+  }
+#endif
+
   /// Generate the Blueprint index.
   conduit::Node fileRoot;
   conduit::Node & index = fileRoot[ "blueprint_index/mesh" ];
@@ -268,7 +332,7 @@ void BlueprintOutput::writeOutWrappersAsFields( Group const & group,
 
   group.forWrappers( [&] ( dataRepository::WrapperBase const & wrapper )
   {
-    if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.sizedFromParent() )
+    if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.sizedFromParent() && !wrapper.isAllocationDeferred() )
     {
       string const name = prefix.empty() ? wrapper.getName() : prefix + "-" + wrapper.getName();
 
@@ -296,7 +360,7 @@ void BlueprintOutput::writeOutConstitutiveData( dataRepository::Group const & co
 
   constitutiveModel.forWrappers( [&] ( dataRepository::WrapperBase const & wrapper )
   {
-    if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.sizedFromParent() )
+    if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.sizedFromParent() && !wrapper.isAllocationDeferred() )
     {
       string const fieldName = constitutiveModel.getName() + "-quadrature-averaged-" + wrapper.getName();
       averagedConstitutiveData.registerWrapper( wrapper.averageOverSecondDim( fieldName, averagedConstitutiveData ) ).
@@ -21,6 +21,13 @@
 
 #include "fileIO/Outputs/OutputBase.hpp"
 
+#if defined( GEOSX_USE_ASCENT )
+namespace ascent
+{
+class Ascent;
+}
+#endif
+
 namespace geos
 {
 
@@ -46,10 +53,9 @@ public:
                    Group * const parent );
 
   /**
-   * @brief Destructor.
+   * @brief Destructor, closes the in-situ session if any.
    */
-  virtual ~BlueprintOutput() override
-  {}
+  virtual ~BlueprintOutput() override;
 
   /**
    * @brief Get the name used to register this object in an XML file.
@@ -58,7 +64,12 @@ public:
   static string catalogName() { return "Blueprint"; }
 
   /**
-   * @brief Writes out a Blueprint plot file.
+   * @brief Check the consistency of the in-situ options.
+   */
+  virtual void postProcessInput() override;
+
+  /**
+   * @brief Writes out a Blueprint plot file, or publishes the Blueprint mesh to Ascent in in-situ mode.
    * @copydetails EventBase::execute()
    */
   virtual bool execute( real64 const time_n,
@@ -128,6 +139,17 @@ private:
 
   // If true will write out the full quadrature data, otherwise it is averaged over.
   int m_outputFullQuadratureData = 0;
+
+  // If true the Blueprint mesh is published to Ascent instead of being written to disk.
+  int m_inSitu = 0;
+
+  // The file describing the Ascent pipelines (slices, contours, renders...), the Ascent default if empty.
+  Path m_ascentActionsFile;
+
+#if defined( GEOSX_USE_ASCENT )
+  // The Ascent session, opened at the first in-situ execution.
+  std::unique_ptr< ascent::Ascent > m_ascent;
+#endif
 };
 
 
@@ -21,6 +21,8 @@
 
 #include "fileIO/Outputs/OutputBase.hpp"
 
+#include <functional>
+
 namespace geos
 {
 
@@ -54,8 +56,12 @@ public:
    */
   static string catalogName() { return "Python"; }
 
+  /// Type of the callback called by the event in place of returning to Python
+  using Callback = std::function< void ( real64 const time_n, real64 const dt, integer const cycleNumber ) >;
+
   /**
-   * @brief Signals the EventManager to exit the loop early, and return to Python.
+   * @brief Signals the EventManager to exit the loop early, and return to Python,
+   *        or calls the callback without leaving the event loop if one has been set.
    * @note It is an error to use this event when not running through pygeosx.
    * @copydetails EventBase::execute()
    */
@@ -66,14 +72,28 @@ public:
                         real64 const eventProgress,
                         DomainPartition & domain ) override
   {
-    GEOS_UNUSED_VAR( time_n );
-    GEOS_UNUSED_VAR( dt );
-    GEOS_UNUSED_VAR( cycleNumber );
     GEOS_UNUSED_VAR( eventCounter );
     GEOS_UNUSED_VAR( eventProgress );
     GEOS_UNUSED_VAR( domain );
+    if( m_callback )
+    {
+      m_callback( time_n, dt, cycleNumber );
+      return false;
+    }
     return true;
   }
+
+  /**
+   * @brief Set the callback called at each execution of the event.
+   * @param callback The callback, or an empty function to return to Python again.
+   */
+  void setCallback( Callback callback )
+  { m_callback = std::move( callback ); }
+
+private:
+
+  /// Callback called in place of returning to Python
+  Callback m_callback;
 };
 
 
@@ -18,6 +18,10 @@
 
 #include "RestartOutput.hpp"
 
+// TPL includes
+#include <conduit_relay.hpp>
+#include <hdf5.h>
+
 namespace geos
 {
 
@@ -25,11 +29,76 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_numberOfWriters( 0 ),
+  m_writeAsynchronously( 0 ),
+  m_writeIncrementally( 0 )
+{
+  registerWrapper( viewKeys.numberOfWriters.key(), &m_numberOfWriters ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of ranks writing the restart files. The ranks are split into groups of consecutive ranks, "
+                    "each group sending its data to its first rank which writes a single file for the whole group. "
+                    "If this attribute is 0 or larger than the number of ranks, every rank writes its own file" );
+
+  registerWrapper( viewKeys.writeAsynchronously.key(), &m_writeAsynchronously ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Should the restart files be written by a background thread while the simulation proceeds or not. "
+                    "The data is copied before the simulation proceeds, and a restart file is completed before the next one "
+                    "and at the end of the simulation. Requires a thread-safe HDF5 library" );
+
+  registerWrapper( viewKeys.writeIncrementally.key(), &m_writeIncrementally ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Should the data that did not change since it was last written be replaced by a reference to the "
+                    "earlier restart file or not. The restart files referenced by the restart file used to restart "
+                    "the simulation must be kept" );
+}
 
 RestartOutput::~RestartOutput()
-{}
+{
+  if( m_backgroundWrite.valid() )
+  {
+    m_backgroundWrite.wait();
+  }
+}
+
+void RestartOutput::postProcessInput()
+{
+  GEOS_THROW_IF_LT_MSG( m_numberOfWriters, 0,
+                        GEOS_FMT( "{} `{}`: the number of writers must be non-negative",
+                                  catalogName(), getDataContext() ),
+                        InputError );
+
+  if( m_writeAsynchronously )
+  {
+    // other outputs use HDF5 from the main thread while the restart file is written
+    hbool_t isThreadSafe = 0;
+    H5is_library_threadsafe( &isThreadSafe );
+    if( !isThreadSafe )
+    {
+      GEOS_WARNING( GEOS_FMT( "{} `{}`: the HDF5 library is not thread-safe, the restart files are written synchronously",
+                              catalogName(), getDataContext() ) );
+      m_writeAsynchronously = 0;
+    }
+  }
+}
+
+void RestartOutput::reinit()
+{
+  flush();
+  m_writtenData.clear();
+}
+
+void RestartOutput::flush()
+{
+  if( m_backgroundWrite.valid() )
+  {
+    // rethrows the errors raised while writing
+    m_backgroundWrite.get();
+  }
+}
 
 bool RestartOutput::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
                              real64 const GEOS_UNUSED_PARAM( dt ),
@@ -46,8 +115,40 @@ bool RestartOutput::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
   // integer const eventProgressPercent = static_cast<integer const>(eventProgress * 100.0);
   string const fileName = GEOS_FMT( "{}_restart_{:09}", getFileNameRoot(), cycleNumber );
 
+  // a single restart file is written in the background at a time
+  flush();
+
   rootGroup.prepareToWrite();
-  writeTree( joinPath( OutputBase::getOutputDirectory(), fileName ), *(rootGroup.getConduitNode().parent()) );
+
+  // when writing asynchronously, the trees are copied so that the simulation can modify its data while they are written
+  auto output = std::make_shared< conduit::Node >();
+  string const filePath = gatherTree( joinPath( OutputBase::getOutputDirectory(), fileName ),
+                                      *(rootGroup.getConduitNode().parent()),
+                                      m_numberOfWriters,
+                                      m_writeAsynchronously,
+                                      *output );
+  if( !filePath.empty() )
+  {
+    if( m_writeIncrementally )
+    {
+      referenceUnchangedData( *output, filePath, m_writtenData );
+    }
+
+    if( m_writeAsynchronously )
+    {
+      GEOS_LOG_RANK( "Writing out restart file at " << filePath << " in the background" );
+      m_backgroundWrite = std::async( std::launch::async, [output, filePath]()
+      {
+        LvArray::system::FloatingPointExceptionGuard threadGuard;
+        conduit::relay::io::save( *output, filePath, "hdf5" );
+      } );
+    }
+    else
+    {
+      GEOS_LOG_RANK( "Writing out restart file at " << filePath );
+      conduit::relay::io::save( *output, filePath, "hdf5" );
+    }
+  }
   rootGroup.finishWriting();
 
   return false;
@@ -20,6 +20,9 @@
 #define GEOS_FILEIO_OUTPUTS_RESTARTOUTPUT_HPP_
 
 #include "OutputBase.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+
+#include <future>
 
 
 namespace geos
@@ -69,14 +72,47 @@ public:
                         DomainPartition & domain ) override
   {
     execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    flush();
   }
 
+  /**
+   * @brief Write the next restart file in full.
+   */
+  virtual void reinit() override;
+
+  /**
+   * @brief Wait for the restart file being written in the background, if any.
+   */
+  void flush();
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
+    dataRepository::ViewKey numberOfWriters = { "numberOfWriters" };
+    dataRepository::ViewKey writeAsynchronously = { "writeAsynchronously" };
+    dataRepository::ViewKey writeIncrementally = { "writeIncrementally" };
   } viewKeys;
   /// @endcond
+
+private:
+
+  virtual void postProcessInput() override;
+
+  /// Number of ranks writing restart files, 0 for one file per rank
+  integer m_numberOfWriters;
+
+  /// Flag to write the restart files in a background thread
+  integer m_writeAsynchronously;
+
+  /// Flag to reference the data that did not change since the previous restart files
+  integer m_writeIncrementally;
+
+  /// Data written in full in the previous restart files
+  dataRepository::RestartDataIndex m_writtenData;
+
+  /// Restart file being written in the background
+  std::future< void > m_backgroundWrite;
 };
 
 
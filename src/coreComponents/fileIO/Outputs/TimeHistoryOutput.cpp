@@ -15,11 +15,15 @@
 #include "TimeHistoryOutput.hpp"
 
 #include "fileIO/timeHistory/HDFFile.hpp"
+#include "fileIO/timeHistory/SharedMemoryHistoryIO.hpp"
 
 #if defined(GEOSX_USE_PYGEOSX)
 #include "fileIO/python/PyHistoryOutputType.hpp"
 #endif
 
+#include <algorithm>
+#include <cctype>
+
 namespace geos
 {
 TimeHistoryOutput::TimeHistoryOutput( string const & name,
@@ -29,6 +33,8 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
+  m_compressionLevel( 0 ),
+  m_sharedMemorySlots( 64 ),
   m_io( )
 {
   registerWrapper( viewKeys::timeHistoryOutputTargetString(), &m_collectorPaths ).
@@ -43,7 +49,9 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   registerWrapper( viewKeys::timeHistoryOutputFormatString(), &m_format ).
     setApplyDefaultValue( "hdf" ).
     setInputFlag( InputFlags::OPTIONAL ).
-    setDescription( "The output file format for time history output." );
+    setDescription( "The output format for time history output: `hdf` for an HDF5 file, or `sharedMemory` to publish the collected "
+                    "records into POSIX shared-memory ring buffers (one segment per rank and dataset, named `/filename.rank.index`) "
+                    "read by external processes without any file." );
 
   registerWrapper( viewKeys::timeHistoryRestartString(), &m_recordCount ).
     setApplyDefaultValue( 0 ).
@@ -51,9 +59,59 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::timeHistoryCompressionLevelString(), &m_compressionLevel ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The deflate level of the time history datasets, from 0 (no compression) to 9." );
+
+  registerWrapper( viewKeys::timeHistorySharedMemorySlotsString(), &m_sharedMemorySlots ).
+    setApplyDefaultValue( 64 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The number of records held by each shared-memory ring buffer (only used with the `sharedMemory` format). "
+                    "The records not read by the consumers before the ring wraps around are lost." );
+
+  registerWrapper( viewKeys::timeHistoryAbsoluteTolerancesString(), &m_absoluteTolerances ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "The absolute error tolerated on the floating-point values of each source, in the order of `sources`. "
+                    "The values are rounded to the coarsest power of ten keeping the error below the tolerance, "
+                    "so that fewer bits are stored. A tolerance of 0 stores the values exactly, which is the default for all the sources. "
+                    "The time and the coordinates of the collected objects are always stored exactly." );
+
+}
+
+void TimeHistoryOutput::postProcessInput()
+{
+  GEOS_THROW_IF( m_format != "hdf" && m_format != "sharedMemory",
+                 GEOS_FMT( "{} `{}`: unknown format `{}`, the valid formats are `hdf` and `sharedMemory`",
+                           catalogName(), getDataContext(), m_format ),
+                 InputError );
+
+  GEOS_THROW_IF( m_sharedMemorySlots < 1,
+                 GEOS_FMT( "{} `{}`: `{}` must be at least 1",
+                           catalogName(), getDataContext(), viewKeys::timeHistorySharedMemorySlotsString() ),
+                 InputError );
+
+  GEOS_THROW_IF( m_compressionLevel < 0 || m_compressionLevel > 9,
+                 GEOS_FMT( "{} `{}`: the compression level must be between 0 and 9",
+                           catalogName(), getDataContext() ),
+                 InputError );
+
+  GEOS_THROW_IF( !m_absoluteTolerances.empty() && m_absoluteTolerances.size() != m_collectorPaths.size(),
+                 GEOS_FMT( "{} `{}`: `{}` must contain one tolerance per source, {} found for {} sources",
+                           catalogName(), getDataContext(), viewKeys::timeHistoryAbsoluteTolerancesString(),
+                           m_absoluteTolerances.size(), m_collectorPaths.size() ),
+                 InputError );
+
+  for( real64 const tolerance : m_absoluteTolerances )
+  {
+    GEOS_THROW_IF( tolerance < 0.0,
+                   GEOS_FMT( "{} `{}`: the tolerances must be positive or zero",
+                             catalogName(), getDataContext() ),
+                   InputError );
+  }
 }
 
-void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector )
+void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector, real64 const absoluteTolerance )
 {
   GEOS_ASSERT( m_io.empty() );
 
@@ -62,7 +120,23 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
   string const outputDirectory = getOutputDirectory();
   string const outputFile = joinPath( outputDirectory, m_filename );
 
-  auto registerBufferCalls = [&]( HistoryCollection & hc, string prefix = "" )
+  auto makeIO = [&]( HistoryMetadata const & metadata, real64 const tolerance, MPI_Comm const comm ) -> std::unique_ptr< BufferedHistoryIO >
+  {
+    if( m_format == "sharedMemory" )
+    {
+      // the index of the dataset in the list is the same on every rank, except for the time written by the first rank only
+      string segmentName = m_filename;
+      std::replace_if( segmentName.begin(), segmentName.end(), []( unsigned char const c ) { return !std::isalnum( c ) && c != '_' && c != '-'; }, '_' );
+      segmentName = GEOS_FMT( "/{}.{}.{}", segmentName, MpiWrapper::commRank(), m_io.size() );
+      return std::make_unique< SharedMemoryHistoryIO >( segmentName, metadata, m_recordCount, m_sharedMemorySlots );
+    }
+    auto io = std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount, 1, 2, comm );
+    io->setCompressionLevel( m_compressionLevel );
+    io->setAbsoluteTolerance( tolerance );
+    return io;
+  };
+
+  auto registerBufferCalls = [&]( HistoryCollection & hc, real64 const tolerance, string prefix = "" )
   {
     for( localIndex collectorIdx = 0; collectorIdx < hc.numCollectors(); ++collectorIdx )
     {
@@ -73,7 +147,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
         metadata.setName( prefix + metadata.getName() );
       }
 
-      m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount ) );
+      m_io.emplace_back( makeIO( metadata, tolerance, MPI_COMM_GEOSX ) );
       hc.registerBufferProvider( collectorIdx, [this, idx = m_io.size() - 1]( localIndex count )
       {
         m_io[idx]->updateCollectingCount( count );
@@ -84,11 +158,11 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
   };
 
   // FIXME Why stop (pseudo) recursion at one single level?
-  registerBufferCalls( collector );
+  registerBufferCalls( collector, absoluteTolerance );
 
   for( localIndex metaIdx = 0; metaIdx < collector.numMetaDataCollectors(); ++metaIdx )
   {
-    registerBufferCalls( collector.getMetaDataCollector( metaIdx ), collector.getTargetName() + " " );
+    registerBufferCalls( collector.getMetaDataCollector( metaIdx ), 0.0, collector.getTargetName() + " " );
   }
 
   // Do the time output last so its at the end of the m_io list, since writes are parallel
@@ -98,7 +172,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
   if( MpiWrapper::commRank() == 0 )
   {
     HistoryMetadata timeMetadata = collector.getTimeMetaData();
-    m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, timeMetadata, m_recordCount, 1, 2, MPI_COMM_SELF ) );
+    m_io.emplace_back( makeIO( timeMetadata, 0.0, MPI_COMM_SELF ) );
     // We copy the back `idx` not to rely on possible future appends to `m_io`.
     collector.registerTimeBufferProvider( [this, idx = m_io.size() - 1]() { return m_io[idx]->getBufferHead(); } );
     m_io.back()->init( !freshInit );
@@ -109,6 +183,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
 
 void TimeHistoryOutput::initializePostInitialConditionsPostSubGroups()
 {
+  if( m_format == "hdf" )
   {
     // check whether to truncate or append to the file up front so we don't have to bother during later accesses
     string const outputDirectory = getOutputDirectory();
@@ -122,13 +197,13 @@ void TimeHistoryOutput::initializePostInitialConditionsPostSubGroups()
   }
 
   DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
-  for( auto collectorPath : m_collectorPaths )
+  for( localIndex collectorIdx = 0; collectorIdx < m_collectorPaths.size(); ++collectorIdx )
   {
     try
     {
-      HistoryCollection & collector = this->getGroupByPath< HistoryCollection >( collectorPath );
+      HistoryCollection & collector = this->getGroupByPath< HistoryCollection >( m_collectorPaths[collectorIdx] );
       collector.initializePostSubGroups();
-      initCollectorParallel( domain, collector );
+      initCollectorParallel( domain, collector, m_absoluteTolerances.empty() ? 0.0 : m_absoluteTolerances[collectorIdx] );
     }
     catch( std::exception const & e )
     {
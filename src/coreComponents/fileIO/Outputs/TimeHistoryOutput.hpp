@@ -97,6 +97,9 @@ public:
     static constexpr char const * timeHistoryOutputFilenameString() { return "filename"; }
     static constexpr char const * timeHistoryOutputFormatString() { return "format"; }
     static constexpr char const * timeHistoryRestartString() { return "restart"; }
+    static constexpr char const * timeHistoryCompressionLevelString() { return "compressionLevel"; }
+    static constexpr char const * timeHistoryAbsoluteTolerancesString() { return "absoluteTolerances"; }
+    static constexpr char const * timeHistorySharedMemorySlotsString() { return "sharedMemorySlots"; }
 
     dataRepository::ViewKey timeHistoryOutputTarget = { "sources" };
     dataRepository::ViewKey timeHistoryOutputFilename = { "filename" };
@@ -115,12 +118,15 @@ public:
 
 private:
 
+  virtual void postProcessInput() override;
+
   /**
    * @brief Initialize a time history collector to write to an MPI comm-specific file collectively.
    * @param group The ProblemManager cast to a Group
    * @param collector The HistoryCollector to intialize
+   * @param absoluteTolerance The absolute error tolerated on the collected values, 0 for lossless storage
    */
-  void initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector );
+  void initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector, real64 const absoluteTolerance );
 
   /// The paths of the collectors to collect history from.
   string_array m_collectorPaths;
@@ -130,6 +136,12 @@ private:
   string m_filename;
   /// The discrete number of time history states expected to be written to the file
   integer m_recordCount;
+  /// The deflate level of the time history datasets
+  integer m_compressionLevel;
+  /// The number of records held by each shared-memory ring buffer
+  integer m_sharedMemorySlots;
+  /// The absolute error tolerated on the values of each collector, in the order of the collector paths
+  array1d< real64 > m_absoluteTolerances;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
 };
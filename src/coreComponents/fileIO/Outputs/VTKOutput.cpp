@@ -36,6 +36,8 @@ VTKOutput::VTKOutput( string const & name,
   m_plotLevel(),
   m_onlyPlotSpecifiedFieldNames(),
   m_fieldNames(),
+  m_numberOfWriters( 0 ),
+  m_writeAsynchronously( 0 ),
   m_writer( getOutputDirectory() + '/' + m_plotFileRoot )
 {
   registerWrapper( viewKeysStruct::plotFileRoot, &m_plotFileRoot ).
@@ -76,6 +78,28 @@ VTKOutput::VTKOutput( string const & name,
     setApplyDefaultValue( m_outputRegionType ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Output region types.  Valid options: ``" + EnumStrings< vtk::VTKRegionTypes >::concat( "``, ``" ) + "``" );
+
+  registerWrapper( viewKeysStruct::numberOfWriters, &m_numberOfWriters ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of ranks writing the vtk files. The ranks are split into groups of consecutive ranks, "
+                    "each group sending its data to its first rank which writes a single file for the whole group. "
+                    "If this attribute is 0 or larger than the number of ranks, every rank writes its own files" );
+
+  registerWrapper( viewKeysStruct::writeAsynchronously, &m_writeAsynchronously ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Should the vtu files be written by a background thread while the simulation proceeds or not. "
+                    "The files of an output step are completed before the next output step and at the end of the simulation." );
+
+  registerWrapper( viewKeysStruct::regionNames, &m_regionNames ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Names of the regions to output. If this attribute is not specified, all the regions of the selected `outputRegionType` are output" );
+
+  registerWrapper( viewKeysStruct::outputBox, &m_outputBox ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Bounds { xMin, yMin, zMin, xMax, yMax, zMax } of the box the output is restricted to. "
+                    "Only the cells inside or crossing the box are written. If this attribute is not specified, the whole mesh is output" );
 }
 
 VTKOutput::~VTKOutput()
@@ -83,9 +107,23 @@ VTKOutput::~VTKOutput()
 
 void VTKOutput::postProcessInput()
 {
+  GEOS_THROW_IF( !m_outputBox.empty() && m_outputBox.size() != 6,
+                 GEOS_FMT( "{}: `{}` must contain the 6 values xMin, yMin, zMin, xMax, yMax, zMax, {} found",
+                           getDataContext(), viewKeysStruct::outputBox, m_outputBox.size() ),
+                 InputError );
+  GEOS_THROW_IF( !m_outputBox.empty() &&
+                 ( m_outputBox[0] > m_outputBox[3] || m_outputBox[1] > m_outputBox[4] || m_outputBox[2] > m_outputBox[5] ),
+                 GEOS_FMT( "{}: the minimum bounds of `{}` must not be greater than its maximum bounds",
+                           getDataContext(), viewKeysStruct::outputBox ),
+                 InputError );
+
   m_writer.setOutputLocation( getOutputDirectory(), m_plotFileRoot );
   m_writer.setFieldNames( m_fieldNames.toViewConst() );
   m_writer.setOnlyPlotSpecifiedFieldNamesFlag( m_onlyPlotSpecifiedFieldNames );
+  m_writer.setNumberOfWriters( m_numberOfWriters );
+  m_writer.setWriteAsynchronously( m_writeAsynchronously );
+  m_writer.setRegionNames( m_regionNames.toViewConst() );
+  m_writer.setOutputBox( m_outputBox.toViewConst() );
 
   string const fieldNamesString = viewKeysStruct::fieldNames;
   string const onlyPlotSpecifiedFieldNamesString = viewKeysStruct::onlyPlotSpecifiedFieldNames;
@@ -96,6 +134,11 @@ void VTKOutput::postProcessInput()
                            onlyPlotSpecifiedFieldNamesString, fieldNamesString ),
                  InputError );
 
+  GEOS_THROW_IF_LT_MSG( m_numberOfWriters, 0,
+                        GEOS_FMT( "{} `{}`: the number of writers must be non-negative",
+                                  catalogName(), getDataContext() ),
+                        InputError );
+
   GEOS_LOG_RANK_0_IF( !m_fieldNames.empty() && ( m_onlyPlotSpecifiedFieldNames != 0 ),
                       GEOS_FMT(
                         "{} `{}`: found {} fields to plot in `{}`. These fields will be output regardless of the `plotLevel` specified by the user. No other field will be output.",
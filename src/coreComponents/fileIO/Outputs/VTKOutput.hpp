@@ -76,6 +76,7 @@ public:
                         DomainPartition & domain ) override
   {
     execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    m_writer.flush();
   }
 
   /**
@@ -94,6 +95,10 @@ public:
     static constexpr auto outputRegionTypeString = "outputRegionType";
     static constexpr auto onlyPlotSpecifiedFieldNames = "onlyPlotSpecifiedFieldNames";
     static constexpr auto fieldNames = "fieldNames";
+    static constexpr auto numberOfWriters = "numberOfWriters";
+    static constexpr auto writeAsynchronously = "writeAsynchronously";
+    static constexpr auto regionNames = "regionNames";
+    static constexpr auto outputBox = "outputBox";
   } vtkOutputViewKeys;
   /// @endcond
 
@@ -120,6 +125,18 @@ private:
   /// array of names of the fields to output
   array1d< string > m_fieldNames;
 
+  /// names of the regions to output, all the regions if empty
+  array1d< string > m_regionNames;
+
+  /// bounds of the box the output is clipped to, as xMin, yMin, zMin, xMax, yMax, zMax, no clipping if empty
+  array1d< real64 > m_outputBox;
+
+  /// number of ranks writing the vtk pieces, 0 meaning all the ranks
+  integer m_numberOfWriters;
+
+  /// Should the vtu files be written by a background thread or not.
+  integer m_writeAsynchronously;
+
   /// VTK output mode
   vtk::VTKOutputMode m_writeBinaryData = vtk::VTKOutputMode::BINARY;
 
@@ -0,0 +1,472 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file XDMFOutput.cpp
+ */
+
+/// Source includes
+#include "XDMFOutput.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+#include "common/TimingMacros.hpp"
+#include "common/TypeDispatch.hpp"
+#include "constitutive/ConstitutiveBase.hpp"
+#include "fileIO/Outputs/OutputUtilities.hpp"
+#include "fileIO/timeHistory/HDFFile.hpp"
+#include "mesh/DomainPartition.hpp"
+
+// TPL includes
+#include <conduit.hpp>
+#include <hdf5.h>
+
+// System includes
+#include <fstream>
+#include <set>
+#include <unordered_map>
+
+namespace geos
+{
+
+using namespace dataRepository;
+
+namespace internal
+{
+
+/**
+ * @brief Get the HDF5 native type corresponding to a value type.
+ * @tparam T the value type
+ * @return the HDF5 type
+ */
+template< typename T >
+hid_t getHDFDataType();
+
+template<>
+hid_t getHDFDataType< real64 >() { return H5T_NATIVE_DOUBLE; }
+
+template<>
+hid_t getHDFDataType< int >() { return H5T_NATIVE_INT; }
+
+template<>
+hid_t getHDFDataType< long >() { return H5T_NATIVE_LONG; }
+
+template<>
+hid_t getHDFDataType< long long >() { return H5T_NATIVE_LLONG; }
+
+/**
+ * @brief Get the XDMF topology name and the node ordering (from GEOS to XDMF) of a cell type.
+ * @param[in] elementType the cell type
+ * @param[out] ordering the position in the GEOS cell of each XDMF cell node
+ * @return the XDMF topology name, or an empty string if the cell type is not supported
+ */
+string getXdmfTopology( ElementType const elementType, std::vector< localIndex > & ordering )
+{
+  switch( elementType )
+  {
+    case ElementType::Tetrahedron: ordering = { 0, 1, 2, 3 }; return "Tetrahedron";
+    case ElementType::Pyramid:     ordering = { 0, 1, 3, 2, 4 }; return "Pyramid";
+    case ElementType::Wedge:       ordering = { 0, 4, 2, 1, 5, 3 }; return "Wedge";
+    case ElementType::Hexahedron:  ordering = { 0, 1, 3, 2, 4, 5, 7, 6 }; return "Hexahedron";
+    default: ordering.clear(); return "";
+  }
+}
+
+/**
+ * @brief Collectively write a two-dimensional dataset, each rank writing a contiguous block of rows.
+ * @tparam T the value type
+ * @param[in] fileId the HDF5 file, opened by all the ranks
+ * @param[in] path path of the dataset in the file, intermediate groups are created as needed
+ * @param[in] values the local rows, stored row-major
+ * @param[in] rowOffset index of the first local row in the dataset
+ * @param[in] numGlobalRows number of rows of the dataset
+ * @param[in] numColumns number of columns of the dataset
+ */
+template< typename T >
+void writeDataset( hid_t const fileId,
+                   string const & path,
+                   std::vector< T > const & values,
+                   globalIndex const rowOffset,
+                   globalIndex const numGlobalRows,
+                   globalIndex const numColumns )
+{
+  hsize_t const numLocalRows = numColumns > 0 ? values.size() / LvArray::integerConversion< std::size_t >( numColumns ) : 0;
+  hsize_t const fileDims[2] = { LvArray::integerConversion< hsize_t >( numGlobalRows ),
+                                LvArray::integerConversion< hsize_t >( numColumns ) };
+  hsize_t const localDims[2] = { numLocalRows, fileDims[1] };
+  hsize_t const fileOffset[2] = { LvArray::integerConversion< hsize_t >( rowOffset ), 0 };
+
+  hid_t const linkProperties = H5Pcreate( H5P_LINK_CREATE );
+  H5Pset_create_intermediate_group( linkProperties, 1 );
+
+  hid_t const fileSpace = H5Screate_simple( 2, fileDims, nullptr );
+  hid_t const memorySpace = H5Screate_simple( 2, localDims, nullptr );
+  hid_t const dataset = H5Dcreate( fileId, path.c_str(), getHDFDataType< T >(), fileSpace, linkProperties, H5P_DEFAULT, H5P_DEFAULT );
+  GEOS_ERROR_IF_LT_MSG( dataset, 0, GEOS_FMT( "Could not create the HDF5 dataset {}", path ) );
+
+  if( numLocalRows > 0 )
+  {
+    H5Sselect_hyperslab( fileSpace, H5S_SELECT_SET, fileOffset, nullptr, localDims, nullptr );
+  }
+  else
+  {
+    // ranks without rows still take part in the collective write
+    H5Sselect_none( fileSpace );
+    H5Sselect_none( memorySpace );
+  }
+
+  hid_t const transferProperties = H5Pcreate( H5P_DATASET_XFER );
+#ifdef GEOSX_USE_MPI
+  H5Pset_dxpl_mpio( transferProperties, H5FD_MPIO_COLLECTIVE );
+#endif
+
+  // HDF5 rejects null buffers, even with an empty selection
+  T const dummy{};
+  H5Dwrite( dataset, getHDFDataType< T >(), memorySpace, fileSpace, transferProperties,
+            values.empty() ? &dummy : values.data() );
+
+  H5Pclose( transferProperties );
+  H5Dclose( dataset );
+  H5Sclose( memorySpace );
+  H5Sclose( fileSpace );
+  H5Pclose( linkProperties );
+}
+
+/**
+ * @brief Copy the values of a field at a list of indices in a row-major buffer.
+ * @param[in] wrapper a wrapper around the field
+ * @param[in] indices the indices of the rows to copy
+ * @param[out] values the copied values, converted to real64
+ * @return the number of components of the field, consistent across ranks
+ */
+globalIndex packField( WrapperBase const & wrapper,
+                       std::vector< localIndex > const & indices,
+                       std::vector< real64 > & values )
+{
+  globalIndex numComponents = 0;
+  types::dispatch( types::ListofTypeList< types::StandardArrays >{}, [&]( auto tupleOfTypes )
+  {
+    using ArrayType = camp::first< decltype( tupleOfTypes ) >;
+    using T = typename ArrayType::ValueType;
+    auto const sourceArray = Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
+
+    numComponents = 1;
+    for( int dim = 1; dim < ArrayType::NDIM; ++dim )
+    {
+      numComponents *= sourceArray.size( dim );
+    }
+    numComponents = MpiWrapper::max( numComponents );
+
+    values.resize( indices.size() * numComponents );
+    forAll< parallelHostPolicy >( LvArray::integerConversion< localIndex >( indices.size() ), [&]( localIndex const i )
+    {
+      LvArray::forValuesInSlice( sourceArray[indices[i]], [&, compIndex = 0]( T const & value ) mutable
+      {
+        values[i * numComponents + compIndex++] = static_cast< real64 >( value );
+      } );
+    } );
+  }, wrapper );
+  return numComponents;
+}
+
+/**
+ * @brief Build the XDMF description of an attribute stored in an HDF5 dataset.
+ * @param[in] name name of the attribute
+ * @param[in] center center of the attribute (Cell or Node)
+ * @param[in] numRows number of rows of the dataset
+ * @param[in] numComponents number of columns of the dataset
+ * @param[in] location location of the dataset, as file:path
+ * @return the XDMF element
+ */
+string xdmfAttribute( string const & name,
+                      string const & center,
+                      globalIndex const numRows,
+                      globalIndex const numComponents,
+                      string const & location )
+{
+  string const type = numComponents == 1 ? "Scalar" : ( numComponents == 3 ? "Vector" : "Matrix" );
+  return GEOS_FMT( "        <Attribute Name=\"{}\" AttributeType=\"{}\" Center=\"{}\">\n"
+                   "          <DataItem Dimensions=\"{} {}\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">{}</DataItem>\n"
+                   "        </Attribute>\n",
+                   name, type, center, numRows, numComponents, location );
+}
+
+} // namespace internal
+
+XDMFOutput::XDMFOutput( string const & name,
+                        Group * const parent ):
+  OutputBase( name, parent ),
+  m_plotFileRoot( name ),
+  m_plotLevel(),
+  m_isMeshWritten( false ),
+  m_previousCycle( -1 )
+{
+  registerWrapper( xdmfOutputViewKeys.plotFileRoot, &m_plotFileRoot ).
+    setDefaultValue( m_plotFileRoot ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of the XDMF file, and of the directory containing the HDF5 files, for this output." );
+
+  registerWrapper( xdmfOutputViewKeys.plotLevel, &m_plotLevel ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Level detail plot. Only fields with lower of equal plot level will be output." );
+}
+
+XDMFOutput::~XDMFOutput()
+{}
+
+void XDMFOutput::reinit()
+{
+  m_isMeshWritten = false;
+  m_previousCycle = -1;
+  m_steps.clear();
+}
+
+bool XDMFOutput::execute( real64 const time_n,
+                          real64 const GEOS_UNUSED_PARAM( dt ),
+                          integer const cycleNumber,
+                          integer const GEOS_UNUSED_PARAM( eventCounter ),
+                          real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                          DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  // the final output of cleanup repeats the last periodic output
+  if( cycleNumber == m_previousCycle )
+  {
+    return false;
+  }
+  m_previousCycle = cycleNumber;
+
+  string const dataDirectory = joinPath( getOutputDirectory(), m_plotFileRoot );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    makeDirsForPath( dataDirectory );
+  }
+  MpiWrapper::barrier();
+
+  std::unique_ptr< HDFFile > meshFile;
+  if( !m_isMeshWritten )
+  {
+    meshFile = std::make_unique< HDFFile >( joinPath( dataDirectory, "mesh" ), true, true, MPI_COMM_GEOSX );
+  }
+
+  string const stepName = GEOS_FMT( "cycle_{:07}", cycleNumber );
+  HDFFile stepFile( joinPath( dataDirectory, stepName ), true, true, MPI_COMM_GEOSX );
+
+  string grids;
+  domain.forMeshBodies( [&]( MeshBody const & meshBody )
+  {
+    MeshLevel const & mesh = meshBody.getBaseDiscretization();
+    mesh.getElemManager().forElementRegions< CellElementRegion >( [&]( CellElementRegion const & region )
+    {
+      region.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+      {
+        string const gridPath = GEOS_FMT( "/{}/{}/{}", meshBody.getName(), region.getName(), subRegion.getName() );
+        grids += writeSubRegion( gridPath,
+                                 mesh.getNodeManager(),
+                                 subRegion,
+                                 meshFile.get(),
+                                 stepFile,
+                                 joinPath( m_plotFileRoot, stepName + ".hdf5" ) );
+      } );
+    } );
+  } );
+  m_isMeshWritten = true;
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    m_steps.emplace_back( GEOS_FMT( "    <Grid Name=\"{}\" GridType=\"Collection\" CollectionType=\"Spatial\">\n"
+                                    "      <Time Value=\"{}\"/>\n"
+                                    "{}"
+                                    "    </Grid>\n",
+                                    stepName, time_n, grids ) );
+    writeXdmfFile();
+  }
+
+  return false;
+}
+
+string XDMFOutput::writeSubRegion( string const & gridPath,
+                                   NodeManager const & nodeManager,
+                                   CellElementSubRegion const & subRegion,
+                                   HDFFile * const meshFile,
+                                   HDFFile & stepFile,
+                                   string const & stepFileName ) const
+{
+  std::vector< localIndex > ordering;
+  string const topology = internal::getXdmfTopology( subRegion.getElementType(), ordering );
+  if( topology.empty() )
+  {
+    GEOS_LOG_RANK_0_IF( meshFile != nullptr,
+                        GEOS_FMT( "{} `{}`: cell type {} of sub-region {} is not supported, the sub-region is not output",
+                                  catalogName(), getDataContext(), subRegion.getElementType(), gridPath ) );
+    return "";
+  }
+  globalIndex const numNodesPerCell = LvArray::integerConversion< globalIndex >( ordering.size() );
+
+  // owned cells and the nodes they use, numbered locally in order of appearance
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList().toViewConst();
+  std::vector< localIndex > cellIndices;
+  std::vector< localIndex > nodeIndices;
+  std::unordered_map< localIndex, globalIndex > nodeNumbers;
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    if( ghostRank[ei] >= 0 )
+    {
+      continue;
+    }
+    cellIndices.push_back( ei );
+    for( localIndex a = 0; a < cellToNodes.size( 1 ); ++a )
+    {
+      if( nodeNumbers.emplace( cellToNodes( ei, a ), LvArray::integerConversion< globalIndex >( nodeIndices.size() ) ).second )
+      {
+        nodeIndices.push_back( cellToNodes( ei, a ) );
+      }
+    }
+  }
+
+  globalIndex const numLocalCells = LvArray::integerConversion< globalIndex >( cellIndices.size() );
+  globalIndex const numLocalNodes = LvArray::integerConversion< globalIndex >( nodeIndices.size() );
+  globalIndex const cellOffset = MpiWrapper::prefixSum< globalIndex >( numLocalCells );
+  globalIndex const nodeOffset = MpiWrapper::prefixSum< globalIndex >( numLocalNodes );
+  globalIndex const numCells = MpiWrapper::sum( numLocalCells );
+  globalIndex const numNodes = MpiWrapper::sum( numLocalNodes );
+
+  if( meshFile != nullptr )
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const referencePosition = nodeManager.referencePosition();
+    std::vector< real64 > points( 3 * nodeIndices.size() );
+    for( std::size_t i = 0; i < nodeIndices.size(); ++i )
+    {
+      for( integer dim = 0; dim < 3; ++dim )
+      {
+        points[3 * i + dim] = referencePosition( nodeIndices[i], dim );
+      }
+    }
+    internal::writeDataset( *meshFile, gridPath + "/points", points, nodeOffset, numNodes, 3 );
+
+    std::vector< globalIndex > connectivity( cellIndices.size() * ordering.size() );
+    for( std::size_t i = 0; i < cellIndices.size(); ++i )
+    {
+      for( std::size_t a = 0; a < ordering.size(); ++a )
+      {
+        connectivity[i * ordering.size() + a] = nodeOffset + nodeNumbers.at( cellToNodes( cellIndices[i], ordering[a] ) );
+      }
+    }
+    internal::writeDataset( *meshFile, gridPath + "/connectivity", connectivity, cellOffset, numCells, numNodesPerCell );
+  }
+
+  string const meshFileName = joinPath( m_plotFileRoot, "mesh.hdf5" );
+  string grid = GEOS_FMT( "      <Grid Name=\"{}\" GridType=\"Uniform\">\n"
+                          "        <Topology TopologyType=\"{}\" NumberOfElements=\"{}\">\n"
+                          "          <DataItem Dimensions=\"{} {}\" NumberType=\"Int\" Precision=\"{}\" Format=\"HDF\">{}:{}/connectivity</DataItem>\n"
+                          "        </Topology>\n"
+                          "        <Geometry GeometryType=\"XYZ\">\n"
+                          "          <DataItem Dimensions=\"{} 3\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">{}:{}/points</DataItem>\n"
+                          "        </Geometry>\n",
+                          gridPath, topology, numCells,
+                          numCells, numNodesPerCell, sizeof( globalIndex ), meshFileName, gridPath,
+                          numNodes, meshFileName, gridPath );
+
+  // fields are written in name order, so that all the ranks write the same datasets in the same order
+  std::vector< real64 > values;
+  auto const writeFields = [&]( Group const & group,
+                                std::set< string > const & fieldNames,
+                                std::vector< localIndex > const & indices,
+                                globalIndex const offset,
+                                globalIndex const numRows,
+                                string const & center )
+  {
+    for( string const & fieldName : fieldNames )
+    {
+      globalIndex const numComponents = internal::packField( group.getWrapperBase( fieldName ), indices, values );
+      string const datasetPath = GEOS_FMT( "{}/{}/{}", gridPath, center, fieldName );
+      internal::writeDataset( stepFile, datasetPath, values, offset, numRows, numComponents );
+      grid += internal::xdmfAttribute( fieldName, center, numRows, numComponents, stepFileName + ":" + datasetPath );
+    }
+  };
+
+  PlotLevel const plotLevel = toPlotLevel( m_plotLevel );
+  auto const isPlotted = [&]( WrapperBase const & wrapper, string const & fieldName )
+  {
+    return !wrapper.isAllocationDeferred() &&
+           outputUtilities::isFieldPlotEnabled( wrapper.getPlotLevel(), plotLevel, fieldName, {}, 0 );
+  };
+
+  // constitutive fields are averaged over the quadrature points, as in the VTK output
+  conduit::Node fakeRoot;
+  Group materialData( "materialData", fakeRoot );
+  materialData.resize( subRegion.size() );
+  std::set< string > materialFields;
+  subRegion.getConstitutiveModels().forSubGroups( [&]( Group const & material )
+  {
+    material.forWrappers( [&]( WrapperBase const & wrapper )
+    {
+      string const fieldName = constitutive::ConstitutiveBase::makeFieldName( material.getName(), wrapper.getName() );
+      if( isPlotted( wrapper, fieldName ) )
+      {
+        materialData.registerWrapper( wrapper.averageOverSecondDim( fieldName, materialData ) );
+        materialFields.insert( fieldName );
+      }
+    } );
+  } );
+  writeFields( materialData, materialFields, cellIndices, cellOffset, numCells, "Cell" );
+
+  std::set< string > cellFields;
+  for( auto const & wrapperIter : subRegion.wrappers() )
+  {
+    if( isPlotted( *wrapperIter.second, wrapperIter.first ) && materialFields.count( wrapperIter.first ) == 0 )
+    {
+      cellFields.insert( wrapperIter.first );
+    }
+  }
+  writeFields( subRegion, cellFields, cellIndices, cellOffset, numCells, "Cell" );
+
+  std::set< string > nodeFields;
+  for( auto const & wrapperIter : nodeManager.wrappers() )
+  {
+    if( isPlotted( *wrapperIter.second, wrapperIter.first ) )
+    {
+      nodeFields.insert( wrapperIter.first );
+    }
+  }
+  writeFields( nodeManager, nodeFields, nodeIndices, nodeOffset, numNodes, "Node" );
+
+  grid += "      </Grid>\n";
+  return grid;
+}
+
+void XDMFOutput::writeXdmfFile() const
+{
+  string const fileName = joinPath( getOutputDirectory(), m_plotFileRoot + ".xmf" );
+  std::ofstream xdmfFile( fileName );
+  GEOS_ERROR_IF( !xdmfFile, GEOS_FMT( "{} `{}`: could not open {}", catalogName(), getDataContext(), fileName ) );
+
+  xdmfFile << "<?xml version=\"1.0\" ?>\n"
+           << "<Xdmf Version=\"3.0\">\n"
+           << "  <Domain>\n"
+           << "  <Grid Name=\"" << m_plotFileRoot << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+  for( string const & step : m_steps )
+  {
+    xdmfFile << step;
+  }
+  xdmfFile << "  </Grid>\n"
+           << "  </Domain>\n"
+           << "</Xdmf>\n";
+}
+
+REGISTER_CATALOG_ENTRY( OutputBase, XDMFOutput, string const &, Group * const )
+
+} /* namespace geos */
@@ -0,0 +1,136 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file XDMFOutput.hpp
+ */
+
+#ifndef GEOS_FILEIO_OUTPUTS_XDMFOUTPUT_HPP_
+#define GEOS_FILEIO_OUTPUTS_XDMFOUTPUT_HPP_
+
+#include "fileIO/Outputs/OutputBase.hpp"
+
+namespace geos
+{
+
+// Forward declarations
+class HDFFile;
+class NodeManager;
+class CellElementSubRegion;
+
+/**
+ * @class XDMFOutput
+ * @brief A class writing the cell regions and their fields in shared HDF5 files described by an XDMF index.
+ *
+ * All the ranks write collectively in a single HDF5 file per output step, each rank writing its owned cells
+ * at an offset computed from the counts of the previous ranks. The cell topology and the point coordinates
+ * are written once in a separate mesh file, which all the steps of the XDMF temporal collection refer to.
+ */
+class XDMFOutput : public OutputBase
+{
+public:
+
+  /// @copydoc geos::dataRepository::Group::Group(string const & name, Group * const parent)
+  XDMFOutput( string const & name,
+              Group * const parent );
+
+  /// Destructor
+  virtual ~XDMFOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string catalogName() { return "XDMF"; }
+
+  /**
+   * @brief Writes out a set of HDF5 files and updates the XDMF index.
+   * @copydoc EventBase::execute()
+   */
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**
+   * @brief Write one final output step as the code exits
+   * @copydoc ExecutableGroup::cleanup()
+   */
+  virtual void cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override
+  {
+    execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+  }
+
+  /**
+   * @brief Clears the steps accumulated in the XDMF index.
+   */
+  virtual void reinit() override;
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto plotFileRoot = "plotFileRoot";
+    static constexpr auto plotLevel = "plotLevel";
+  } xdmfOutputViewKeys;
+  /// @endcond
+
+private:
+
+  /**
+   * @brief Write the owned cells of a sub-region and the fields associated with them and with their nodes.
+   * @param[in] gridPath path of the sub-region in the HDF5 files
+   * @param[in] nodeManager the node manager of the mesh level
+   * @param[in] subRegion the sub-region
+   * @param[in] meshFile the mesh file, or nullptr if the mesh has already been written
+   * @param[in] stepFile the file of the current step
+   * @param[in] stepFileName name of the file of the current step, relative to the XDMF file
+   * @return the XDMF description of the sub-region (only meaningful on rank 0)
+   */
+  string writeSubRegion( string const & gridPath,
+                         NodeManager const & nodeManager,
+                         CellElementSubRegion const & subRegion,
+                         HDFFile * const meshFile,
+                         HDFFile & stepFile,
+                         string const & stepFileName ) const;
+
+  /**
+   * @brief Write the XDMF index with all the steps written so far (rank 0 only).
+   */
+  void writeXdmfFile() const;
+
+  /// Name of the XDMF file and associated directory containing the HDF5 files
+  string m_plotFileRoot;
+
+  /// Maximum plot level of the fields to be written
+  integer m_plotLevel;
+
+  /// Flag indicating whether the mesh file has been written
+  bool m_isMeshWritten;
+
+  /// Cycle of the last step written
+  integer m_previousCycle;
+
+  /// XDMF descriptions of the steps written so far
+  std::vector< string > m_steps;
+};
+
+} // namespace geos
+
+#endif // GEOS_FILEIO_OUTPUTS_XDMFOUTPUT_HPP_
@@ -21,6 +21,7 @@
 #include "physicsSolvers/surfaceGeneration/SurfaceGeneratorFields.hpp"
 
 #include <cstdint>
+#include <type_traits>
 #include <tuple>
 #include <cstdio>
 
@@ -54,8 +55,9 @@ void ChomboCoupler::write( double dt )
 
   localIndex const n_faces = face_connectivity.size();
 
-  /* Copy the face connectivity into a contiguous array. */
-  std::int64_t * connectivity_array = new std::int64_t[4 * n_faces];
+  /* Copy the face connectivity into a contiguous array, reused across the coupling steps. */
+  m_connectivity.resizeWithoutInitializationOrDestruction( 4 * n_faces );
+  std::int64_t * const connectivity_array = m_connectivity.data();
   for( localIndex i = 0; i < n_faces; ++i )
   {
     for( localIndex j = 0; j < 4; ++j )
@@ -78,7 +80,8 @@ void ChomboCoupler::write( double dt )
     }
   } );
 
-  bool * faceMask = new bool[n_faces];
+  m_faceMask.resizeWithoutInitializationOrDestruction( n_faces );
+  bool * const faceMask = m_faceMask.data();
   for( localIndex i = 0; i < n_faces; ++i )
   {
     bool isVoid = (faceToElementRegionIndex[i][0] == voidRegionIndex) ||
@@ -94,19 +97,24 @@ void ChomboCoupler::write( double dt )
   face_fields["Pressure"] = std::make_tuple( H5T_NATIVE_DOUBLE, 1, pressure_ptr );
 
   /* Build the node FieldMap. */
+  NodeManager const & nodes = m_mesh.getNodeManager();
   copyNodalData();
 
   FieldMap_in node_fields;
-  node_fields["position"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, m_referencePositionCopy.data() );
-  node_fields["displacement"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, m_displacementCopy.data() );
-  node_fields["velocity"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, m_velocityCopy.data() );
+  node_fields["position"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3,
+                                             nodalDataPtr< nodes::REFERENCE_POSITION_PERM >( nodes.referencePosition(),
+                                                                                            m_referencePositionCopy ) );
+  node_fields["displacement"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3,
+                                                 nodalDataPtr< nodes::TOTAL_DISPLACEMENT_PERM >( nodes.getField< fields::solidMechanics::totalDisplacement >(),
+                                                                                                m_displacementCopy ) );
+  node_fields["velocity"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3,
+                                             nodalDataPtr< nodes::VELOCITY_PERM >( nodes.getField< fields::solidMechanics::velocity >(),
+                                                                                  m_velocityCopy ) );
 
   writeBoundaryFile( m_comm, m_outputPath.data(), dt, faceMask,
                      m_face_offset, m_n_faces_written, n_faces, connectivity_array, face_fields,
-                     m_node_offset, m_n_nodes_written, m_referencePositionCopy.size( 0 ), node_fields );
+                     m_node_offset, m_n_nodes_written, nodes.size(), node_fields );
   GEOS_LOG_RANK_0( "Wrote file: " << m_outputPath );
-  delete[] connectivity_array;
-  delete[] faceMask;
 }
 
 void ChomboCoupler::read( bool usePressures )
@@ -127,19 +135,29 @@ void ChomboCoupler::read( bool usePressures )
     real64 * pressure_ptr = faces.getReference< real64_array >( "ChomboPressure" ).data();
     face_fields["Pressure"] = std::make_tuple( H5T_NATIVE_DOUBLE, 1, pressure_ptr );
 
+    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & reference_pos = nodes.referencePosition();
+    constexpr bool readInPlace = std::is_same< nodes::REFERENCE_POSITION_PERM, RAJA::PERM_IJ >::value;
+    if( !readInPlace )
+    {
+      m_referencePositionCopy.resizeWithoutInitializationOrDestruction( n_nodes, 3 );
+    }
+
+    /* The positions are read directly into the nodes when their layout matches the coupling format. */
     FieldMap_out node_fields;
-    node_fields["position"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, m_referencePositionCopy.data() );
+    node_fields["position"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, readInPlace ? reference_pos.data() : m_referencePositionCopy.data() );
 
     readBoundaryFile( m_comm, m_inputPath.data(),
                       m_face_offset, m_n_faces_written, n_faces, face_fields,
                       m_node_offset, m_n_nodes_written, n_nodes, node_fields );
 
-    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & reference_pos = nodes.referencePosition();
-    for( localIndex i = 0; i < n_nodes; ++i )
+    if( !readInPlace )
     {
-      for( localIndex j = 0; j < 3; ++j )
+      for( localIndex i = 0; i < n_nodes; ++i )
       {
-        reference_pos( i, j ) = m_referencePositionCopy( i, j );
+        for( localIndex j = 0; j < 3; ++j )
+        {
+          reference_pos( i, j ) = m_referencePositionCopy( i, j );
+        }
       }
     }
   }
@@ -169,20 +187,35 @@ void ChomboCoupler::copyNodalData()
   GEOS_ERROR_IF_NE( velocity.size( 0 ), numNodes );
   GEOS_ERROR_IF_NE( velocity.size( 1 ), 3 );
 
-  m_referencePositionCopy.resizeWithoutInitializationOrDestruction( numNodes, 3 );
-  m_displacementCopy.resizeWithoutInitializationOrDestruction( numNodes, 3 );
-  m_velocityCopy.resizeWithoutInitializationOrDestruction( numNodes, 3 );
+  copyIfPermuted< nodes::REFERENCE_POSITION_PERM >( referencePos, m_referencePositionCopy );
+  copyIfPermuted< nodes::TOTAL_DISPLACEMENT_PERM >( displacement, m_displacementCopy );
+  copyIfPermuted< nodes::VELOCITY_PERM >( velocity, m_velocityCopy );
+}
+
+template< typename PERMUTATION, typename VIEW >
+void ChomboCoupler::copyIfPermuted( VIEW const & src, array2d< real64 > & dst )
+{
+  if( std::is_same< PERMUTATION, RAJA::PERM_IJ >::value )
+  {
+    return;
+  }
 
+  localIndex const numNodes = src.size( 0 );
+  dst.resizeWithoutInitializationOrDestruction( numNodes, 3 );
   for( localIndex i = 0; i < numNodes; ++i )
   {
     for( localIndex j = 0; j < 3; ++j )
     {
-      m_referencePositionCopy( i, j ) = referencePos( i, j );
-      m_displacementCopy( i, j ) = displacement( i, j );
-      m_velocityCopy( i, j ) = velocity( i, j );
+      dst( i, j ) = src( i, j );
     }
   }
 }
 
+template< typename PERMUTATION, typename VIEW >
+real64 const * ChomboCoupler::nodalDataPtr( VIEW const & src, array2d< real64 > const & copy )
+{
+  return std::is_same< PERMUTATION, RAJA::PERM_IJ >::value ? src.data() : copy.data();
+}
+
 
 } // namespace geos
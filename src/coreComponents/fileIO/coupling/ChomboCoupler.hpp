@@ -57,11 +57,32 @@ private:
   /**
    * @brief Copy nodal data into local arrays.
    * @details The purpose of this method is to de-permute the nodal data since the
-   *   coupling format has a fixed data layout. If this copying becomes a bottleneck
-   *   the coupling format should be updated so we can do a zero copy write.
+   *   coupling format has a fixed data layout. The fields whose layout already matches
+   *   the coupling format (row-major) are not copied, and are written directly.
    */
   void copyNodalData();
 
+  /**
+   * @brief Copy a nodal field into a row-major array, unless its layout is already row-major.
+   * @tparam PERMUTATION the permutation of the field
+   * @tparam VIEW the type of the view of the field
+   * @param src the view of the field
+   * @param dst the row-major copy, left untouched if the field is not copied
+   */
+  template< typename PERMUTATION, typename VIEW >
+  static void copyIfPermuted( VIEW const & src, array2d< real64 > & dst );
+
+  /**
+   * @brief Get the row-major data of a nodal field.
+   * @tparam PERMUTATION the permutation of the field
+   * @tparam VIEW the type of the view of the field
+   * @param src the view of the field
+   * @param copy the row-major copy made by copyIfPermuted
+   * @return the data of the field if its layout is row-major, and the data of the copy otherwise
+   */
+  template< typename PERMUTATION, typename VIEW >
+  static real64 const * nodalDataPtr( VIEW const & src, array2d< real64 > const & copy );
+
   /// The MPI communicator used to read and write the file.
   MPI_Comm const m_comm;
   /// The path to write the file to.
@@ -86,6 +107,10 @@ private:
   array2d< real64 > m_displacementCopy;
   /// A copy of the nodal velocity.
   array2d< real64 > m_velocityCopy;
+  /// The contiguous face connectivity, reused across the coupling steps.
+  array1d< std::int64_t > m_connectivity;
+  /// The mask of the faces written, reused across the coupling steps.
+  array1d< bool > m_faceMask;
 };
 
 } /* namespace geos */
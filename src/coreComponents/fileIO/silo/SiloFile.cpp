@@ -2023,7 +2023,7 @@ void SiloFile::writeWrappersToSilo( string const & meshname,
   {
     auto const & wrapper = wrapperIter.second;
 
-    if( wrapper->getPlotLevel() <= m_plotLevel )
+    if( wrapper->getPlotLevel() <= m_plotLevel && !wrapper->isAllocationDeferred() )
     {
       // the field name is the key to the map
       string const & fieldName = wrapper->getName();
@@ -3196,7 +3196,8 @@ int SiloFile::getMeshType( string const & meshName ) const
 
 bool SiloFile::isFieldPlotEnabled( dataRepository::WrapperBase const & wrapper ) const
 {
-  return outputUtilities::isFieldPlotEnabled( wrapper.getPlotLevel(),
+  return !wrapper.isAllocationDeferred() &&
+         outputUtilities::isFieldPlotEnabled( wrapper.getPlotLevel(),
                                               m_plotLevel,
                                               wrapper.getName(),
                                               m_fieldNames,
@@ -93,4 +93,15 @@ bool HDFFile::hasDataset( const string & name ) const
   return ( exists == 0 );
 }
 
+void HDFFile::writeDataset( string const & name, real64 const * const values, std::vector< localIndex > const & dims ) const
+{
+  std::vector< hsize_t > const hdfDims( dims.begin(), dims.end() );
+  hid_t const space = H5Screate_simple( LvArray::integerConversion< int >( hdfDims.size() ), hdfDims.data(), nullptr );
+  hid_t const dataset = H5Dcreate( m_fileId, name.c_str(), H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  GEOS_ERROR_IF_LT_MSG( dataset, 0, GEOS_FMT( "Could not create the HDF5 dataset {} in {}", name, m_filename ) );
+  H5Dwrite( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values );
+  H5Dclose( dataset );
+  H5Sclose( space );
+}
+
 }
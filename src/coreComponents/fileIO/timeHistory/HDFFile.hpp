@@ -48,6 +48,14 @@ public:
    */
   bool hasDataset( const string & name ) const;
 
+  /**
+   * @brief Write a dense array as a new dataset, from the calling rank only.
+   * @param[in] name The dataset name.
+   * @param[in] values The values of the array, stored row-major.
+   * @param[in] dims The dimensions of the array.
+   */
+  void writeDataset( string const & name, real64 const * values, std::vector< localIndex > const & dims ) const;
+
   /**
    * @brief Get the HDF hid_t file identifier.
    * @return the HDF hid_t file id.
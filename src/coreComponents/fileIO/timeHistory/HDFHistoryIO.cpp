@@ -4,6 +4,8 @@
 
 #include "common/MpiWrapper.hpp"
 
+#include <cmath>
+
 namespace geos
 {
 
@@ -110,7 +112,9 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_name( name ),
   m_comm( comm ),
   m_subcomm( MPI_COMM_NULL ),
-  m_sizeChanged( true )
+  m_sizeChanged( true ),
+  m_compressionLevel( 0 ),
+  m_absoluteTolerance( 0.0 )
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
   {
@@ -202,7 +206,6 @@ void HDFHistoryIO::init( bool existsOkay )
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -213,6 +216,15 @@ void HDFHistoryIO::init( bool existsOkay )
     dimChunks[1] = m_chunkSize;
     historyFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
 
+    // group the states in chunks of about 1MB, a chunk per state being too small to compress or write efficiently
+    hsize_t chunkBytes = m_typeSize;
+    for( hsize_t dd = 1; dd < m_rank+1; ++dd )
+    {
+      chunkBytes *= dimChunks[dd];
+    }
+    hsize_t const targetChunkBytes = 1 << 20;
+    dimChunks[0] = std::max( hsize_t( 1 ), targetChunkBytes / chunkBytes );
+
     HDFFile target( m_filename, false, true, subcomm );
     bool inTarget = target.hasDataset( m_name );
     if( !inTarget )
@@ -222,12 +234,25 @@ void HDFHistoryIO::init( bool existsOkay )
       // chunking is required to create an extensible dataset
       dcplId = H5Pcreate( H5P_DATASET_CREATE );
       H5Pset_chunk( dcplId, m_rank + 1, &dimChunks[0] );
+      if( m_absoluteTolerance > 0.0 && H5Tget_class( m_hdfType ) == H5T_FLOAT )
+      {
+        // keeping D decimal digits bounds the rounding error by 0.5 * 10^-D,
+        // the filter must come before the deflate one to compress the reduced values
+        int const decimalDigits = static_cast< int >( std::ceil( -std::log10( 2.0 * m_absoluteTolerance ) ) );
+        H5Pset_scaleoffset( dcplId, H5Z_SO_FLOAT_DSCALE, decimalDigits );
+      }
+      if( m_compressionLevel > 0 )
+      {
+        // parallel writes with filters require collective transfers, see writeRows
+        H5Pset_deflate( dcplId, m_compressionLevel );
+      }
       maxFileDims[0] = H5S_UNLIMITED;
       maxFileDims[1] = H5S_UNLIMITED;
       hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
       hid_t dataset = H5Dcreate( target, m_name.c_str(), m_hdfType, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
       H5Dclose( dataset );
       H5Sclose( space );
+      H5Pclose( dcplId );
     }
     else if( existsOkay )
     {
@@ -248,48 +273,29 @@ void HDFHistoryIO::write()
   resizeFileIfNeeded( m_bufferedCount );
   if( m_bufferedCount > 0 )
   {
-    buffer_unit_type * dataBuffer = nullptr;
+    buffer_unit_type const * dataBuffer = nullptr;
     if( m_dataBuffer.size() > 0 )
     {
       dataBuffer = &m_dataBuffer[0];
     }
-    for( localIndex row = 0; row < m_bufferedCount; ++row )
+    if( !m_sizeChanged )
     {
-      // if the size changed at all, update the partitioning and dataset extent before each row is to be written
-      //  to ensure the correct mpi ranks participate and that there is enough room to write the largest row during execution
-      if( m_sizeChanged )
+      // all the buffered rows have the same partitioning, write them at once
+      writeRows( dataBuffer, LvArray::integerConversion< hsize_t >( m_bufferedCount ), m_localIdxCounts_buffered[ 0 ] );
+      m_writeHead += m_bufferedCount;
+    }
+    else
+    {
+      for( localIndex row = 0; row < m_bufferedCount; ++row )
       {
+        // if the size changed at all, update the partitioning and dataset extent before each row is to be written
+        //  to ensure the correct mpi ranks participate and that there is enough room to write the largest row during execution
         // since the highwater might change (the max # of indices / 2nd dimension) when updating the partitioning
         setupPartition( m_localIdxCounts_buffered[ row ] );
         // keep the write limit the same (will only change in resizeFileIfNeeded call above)
         updateDatasetExtent( m_writeLimit );
-      }
-
-      if( m_subcomm != MPI_COMM_NULL )
-      {
-        HDFFile target( m_filename, false, true, m_subcomm );
-
-        hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-        hid_t filespace = H5Dget_space( dataset );
-
-        std::vector< hsize_t > fileOffset( m_rank+1 );
-        fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
-        // the m_globalIdxOffset will be updated for each row during the partition setup if the size has changed during buffered collection
-        fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
-
-        std::vector< hsize_t > bufferedCounts( m_rank+1 );
-        bufferedCounts[0] = LvArray::integerConversion< hsize_t >( 1 );
-        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_buffered[ row ] );
-        for( hsize_t dd = 2; dd < m_rank+1; ++dd )
-        {
-          bufferedCounts[dd] = m_dims[dd-1];
-        }
-        hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
-
-        hid_t fileHyperslab = filespace;
-        H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
 
-        H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
+        writeRows( dataBuffer, 1, m_localIdxCounts_buffered[ row ] );
 
         // forward the data buffer pointer to the start of the next row
         if( dataBuffer )
@@ -302,13 +308,8 @@ void HDFHistoryIO::write()
           dataBuffer += rowsize;
         }
 
-        // unfortunately have to close/open the file for each row since the accessing mpi ranks and extents can change over time
-        H5Sclose( memspace );
-        H5Sclose( filespace );
-        H5Dclose( dataset );
+        m_writeHead++;
       }
-
-      m_writeHead++;
     }
   }
   m_sizeChanged = false;
@@ -316,6 +317,50 @@ void HDFHistoryIO::write()
   emptyBuffer( );
 }
 
+void HDFHistoryIO::writeRows( buffer_unit_type const * dataBuffer, hsize_t rowCount, globalIndex localIdxCount )
+{
+  if( m_subcomm == MPI_COMM_NULL )
+  {
+    return;
+  }
+
+  // unfortunately have to close/open the file for each write since the accessing mpi ranks and extents can change over time
+  HDFFile target( m_filename, false, true, m_subcomm );
+
+  hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+  hid_t filespace = H5Dget_space( dataset );
+
+  std::vector< hsize_t > fileOffset( m_rank+1 );
+  fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
+  // the m_globalIdxOffset will be updated for each row during the partition setup if the size has changed during buffered collection
+  fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
+
+  std::vector< hsize_t > bufferedCounts( m_rank+1 );
+  bufferedCounts[0] = rowCount;
+  bufferedCounts[1] = LvArray::integerConversion< hsize_t >( localIdxCount );
+  for( hsize_t dd = 2; dd < m_rank+1; ++dd )
+  {
+    bufferedCounts[dd] = m_dims[dd-1];
+  }
+  hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
+
+  hid_t fileHyperslab = filespace;
+  H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
+
+  // all the ranks of the subcomm write, aggregating their data in large file system requests
+  hid_t transferProperties = H5Pcreate( H5P_DATASET_XFER );
+#ifdef GEOSX_USE_MPI
+  H5Pset_dxpl_mpio( transferProperties, H5FD_MPIO_COLLECTIVE );
+#endif
+
+  H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, transferProperties, dataBuffer );
+
+  H5Pclose( transferProperties );
+  H5Sclose( memspace );
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+}
+
 void HDFHistoryIO::compressInFile()
 {
   // set the write limit in the file to the current write head
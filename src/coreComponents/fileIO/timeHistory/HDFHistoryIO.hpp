@@ -100,8 +100,33 @@ public:
   localIndex getBufferedCount() override
   { return m_bufferedCount; }
 
+  /**
+   * @brief Set the deflate level of the dataset, must be called before init.
+   * @param[in] compressionLevel The deflate level, from 0 (no compression) to 9.
+   */
+  void setCompressionLevel( integer compressionLevel )
+  { m_compressionLevel = compressionLevel; }
+
+  /**
+   * @brief Set the absolute error tolerated on the values of a floating-point dataset, must be called before init.
+   * @param[in] absoluteTolerance The tolerated error, 0 to store the values exactly.
+   * @details The values are rounded to the coarsest power of ten keeping the error below the tolerance
+   *          by the HDF5 scale-offset filter, which only stores the bits needed by the rounded values.
+   *          The tolerance is ignored for integer datasets.
+   */
+  void setAbsoluteTolerance( real64 absoluteTolerance )
+  { m_absoluteTolerance = absoluteTolerance; }
+
 private:
 
+  /**
+   * @brief Collectively write consecutive buffered rows to the file, starting at the write head.
+   * @param[in] dataBuffer The first row to write.
+   * @param[in] rowCount The number of rows to write.
+   * @param[in] localIdxCount The number of local indices in each row.
+   */
+  void writeRows( buffer_unit_type const * dataBuffer, hsize_t rowCount, globalIndex localIdxCount );
+
   /**
    * @brief Get the size in bytes the buffer is currently set to hold per collection operation.
    * @return The size in bytes.
@@ -184,6 +209,10 @@ private:
   MPI_Comm m_subcomm;
   /// Whether the size of the collected data has changed between writes to file
   int m_sizeChanged;
+  /// The deflate level of the dataset (0 for no compression)
+  integer m_compressionLevel;
+  /// The absolute error tolerated on the values of the dataset (0 for lossless storage)
+  real64 m_absoluteTolerance;
 };
 
 }
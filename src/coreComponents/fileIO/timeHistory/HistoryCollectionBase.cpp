@@ -57,6 +57,8 @@ bool HistoryCollectionBase::execute( real64 const time_n,
                                      real64 const eventProgress,
                                      DomainPartition & domain )
 {
+  // the sets are updated once for all the collections, which all see the same set changes
+  this->updateSetsIndices( domain );
   for( localIndex collectionIdx = 0; collectionIdx < numCollectors(); ++collectionIdx )
   {
     // std::function defines the == and =! comparable against nullptr_t to check the
@@ -64,7 +66,6 @@ bool HistoryCollectionBase::execute( real64 const time_n,
     GEOS_ERROR_IF( m_bufferProviders[collectionIdx] == nullptr,
                    "History collection buffer retrieval function is unassigned, did you declare a related TimeHistoryOutput event?" );
     // using GEOS_ERROR_IF_EQ caused type issues since the values are used in streams
-    this->updateSetsIndices( domain );
     HistoryMetadata hmd = this->getMetaData( domain, collectionIdx );
     buffer_unit_type * buffer = m_bufferProviders[collectionIdx]( hmd.size( 0 ) );
     collect( domain, collectionIdx, buffer );
@@ -147,85 +147,58 @@ void PackCollection::updateSetsIndices( DomainPartition const & domain )
 
   std::size_t const numSets = collectAll ? 1 : setNames.size();
   m_setsIndices.resize( numSets );
-  // `oldSetSizes` will help us check if the sets have changed.
-  std::vector< localIndex > oldSetSizes( numSets );
-  for( std::size_t setIdx = 0; setIdx < numSets; ++setIdx )
+
+  // filter out the ghost indices immediately when we update the index sets
+  arrayView1d< integer const > const ghostRank = m_targetIsMeshObject ? asOMB( targetGrp )->ghostRank() : arrayView1d< integer const >();
+  auto const isCollected = [&]( localIndex const i )
   {
-    oldSetSizes[setIdx] = m_setsIndices[setIdx].size();
-  }
+    return !m_targetIsMeshObject || ghostRank[ i ] < 0;
+  };
 
-  if( collectAll )
+  // The index lists are only rewritten when the collected indices change, so that the copies made
+  // in the collection memory space are reused from one collection to the next.
+  auto const updateIndices = [&]( array1d< localIndex > & setIndices, localIndex const candidateCount, auto const & candidate )
   {
-    // Here we only have one "all" set.
-    array1d< localIndex > & setIndices = m_setsIndices.front();
-    setIndices.resize( targetGrp->size() );
-    for( localIndex i = 0; i < targetGrp->size(); ++i )
+    bool changed = false;
+    localIndex count = 0;
+    for( localIndex k = 0; k < candidateCount && !changed; ++k )
     {
-      setIndices[i] = i;
+      localIndex const i = candidate( k );
+      if( isCollected( i ) )
+      {
+        changed = count >= setIndices.size() || setIndices[ count ] != i;
+        ++count;
+      }
     }
-  }
-  else
-  {
-    ObjectManagerBase const * targetOMB = asOMB( targetGrp );
-    for( std::size_t setIdx = 0; setIdx < numSets; ++setIdx )
+    if( !changed && count == setIndices.size() )
     {
-      string const & setName = setNames[setIdx];
-      array1d< localIndex > & setIndices = m_setsIndices[setIdx];
+      return;
+    }
 
-      SortedArrayView< localIndex const > const & set = targetOMB->getSet( setName );
-      localIndex const setSize = set.size();
-      setIndices.resize( setSize );
-      if( setSize > 0 )
+    m_setChanged = true;
+    setIndices.clear();
+    for( localIndex k = 0; k < candidateCount; ++k )
+    {
+      localIndex const i = candidate( k );
+      if( isCollected( i ) )
       {
-        for( localIndex idx = 0; idx < setSize; ++idx )
-        {
-          setIndices[idx] = set[idx];
-        }
+        setIndices.emplace_back( i );
       }
     }
-  }
+  };
 
-  // filter out the ghost indices immediately when we update the index sets
-  if( m_targetIsMeshObject )
+  if( collectAll )
   {
-    arrayView1d< integer const > const ghostRank = asOMB( targetGrp )->ghostRank();
+    // Here we only have one "all" set.
+    updateIndices( m_setsIndices.front(), targetGrp->size(), []( localIndex const k ) { return k; } );
+  }
+  else
+  {
+    ObjectManagerBase const * targetOMB = asOMB( targetGrp );
     for( std::size_t setIdx = 0; setIdx < numSets; ++setIdx )
     {
-      array1d< localIndex > & setIndices = m_setsIndices[ setIdx ];
-      array1d< localIndex > ownedIndices( setIndices.size() );
-
-      localIndex ownIdx = 0;
-      for( localIndex idx = 0; idx < setIndices.size(); ++idx )
-      {
-        if( ghostRank[ setIndices[ idx ] ] < 0 )
-        {
-          ownedIndices[ ownIdx ] = setIndices[ idx ];
-          ++ownIdx;
-        }
-      }
-
-      localIndex const newSetSize = ownIdx;
-
-      if( oldSetSizes[ setIdx ] != newSetSize )
-      {
-        m_setChanged = true;
-      }
-      if( !m_setChanged )  // if the size hasn't changed check the individual values
-      {
-        for( localIndex idx = 0; idx < ownedIndices.size(); ++idx )
-        {
-          if( setIndices[ idx ] != ownedIndices[ idx ] )
-          {
-            m_setChanged = true;
-            break;
-          }
-        }
-      }
-      setIndices.resize( newSetSize );
-      for( localIndex idx = 0; idx < newSetSize; ++idx )
-      {
-        setIndices[ idx ] = ownedIndices[ idx ];
-      }
+      SortedArrayView< localIndex const > const & set = targetOMB->getSet( setNames[setIdx] );
+      updateIndices( m_setsIndices[setIdx], set.size(), [&]( localIndex const k ) { return set[k]; } );
     }
   }
 }
@@ -293,7 +266,11 @@ void PackCollection::collect( DomainPartition const & domain,
   {
     targetField.pack< true >( buffer, false, true, events );
   }
-  m_setChanged = false;
+  // the sets are updated once for all the collections of an event
+  if( collectionIdx == numCollectors() - 1 )
+  {
+    m_setChanged = false;
+  }
   GEOS_ASYNC_WAIT( 6000000000, 10, testAllDeviceEvents( events ) );
 }
 
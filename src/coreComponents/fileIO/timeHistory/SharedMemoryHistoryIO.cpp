@@ -0,0 +1,280 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SharedMemoryHistoryIO.cpp
+ */
+
+#include "SharedMemoryHistoryIO.hpp"
+
+#include "common/Format.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace geos
+{
+
+static_assert( std::atomic< std::uint64_t >::is_always_lock_free,
+               "The shared-memory time history requires lock-free 64-bit atomics to be read by other processes" );
+
+namespace
+{
+
+/// Alignment of the header and of the slots in the segment, to keep the slots on distinct cache lines
+constexpr std::uint64_t segmentAlignment = 64;
+
+std::uint64_t alignUp( std::uint64_t const bytes )
+{
+  return ( bytes + segmentAlignment - 1 ) / segmentAlignment * segmentAlignment;
+}
+
+/**
+ * @brief Get the kind and size of the values from the type_index of the type.
+ * @param type the std::type_index(typeid(T)) of the type T
+ * @param kind the kind of the values
+ * @param size the size in bytes of the values
+ * @note Unknown types are stored as characters, as in the HDF5 output.
+ */
+void getTypeInfo( std::type_index const & type, char & kind, std::uint32_t & size )
+{
+  if( type == std::type_index( typeid( real32 ) ) || type == std::type_index( typeid( real64 ) ) )
+  {
+    kind = 'f';
+    size = type == std::type_index( typeid( real32 ) ) ? sizeof( real32 ) : sizeof( real64 );
+  }
+  else if( type == std::type_index( typeid( integer ) ) )
+  {
+    kind = 'i';
+    size = sizeof( integer );
+  }
+  else if( type == std::type_index( typeid( localIndex ) ) )
+  {
+    kind = 'i';
+    size = sizeof( localIndex );
+  }
+  else if( type == std::type_index( typeid( globalIndex ) ) )
+  {
+    kind = 'i';
+    size = sizeof( globalIndex );
+  }
+  else
+  {
+    kind = 'c';
+    size = sizeof( char );
+  }
+}
+
+} // namespace
+
+SharedMemoryHistoryIO::SharedMemoryHistoryIO( string const & segmentName,
+                                              HistoryMetadata const & spec,
+                                              localIndex writeHead,
+                                              localIndex slotCount,
+                                              localIndex overallocMultiple ):
+  m_segmentName( segmentName ),
+  m_segment( nullptr ),
+  m_segmentBytes( 0 ),
+  m_slotCount( LvArray::integerConversion< std::uint64_t >( std::max( slotCount, localIndex( 1 ) ) ) ),
+  m_overallocMultiple( LvArray::integerConversion< std::uint64_t >( std::max( overallocMultiple, localIndex( 1 ) ) ) ),
+  m_bufferedCount( 0 ),
+  m_publishedCount( LvArray::integerConversion< std::uint64_t >( writeHead ) ),
+  m_writtenCount( LvArray::integerConversion< std::uint64_t >( writeHead ) ),
+  m_name( spec.getName() ),
+  m_typeSize( 0 ),
+  m_typeKind( 'c' ),
+  m_dims( spec.getDims() )
+{
+  GEOS_ERROR_IF( m_segmentName.empty() || m_segmentName[0] != '/' || m_segmentName.find( '/', 1 ) != string::npos,
+                 GEOS_FMT( "Invalid shared-memory segment name `{}`: it must start with a '/' and contain no other '/'", m_segmentName ) );
+  GEOS_ERROR_IF_GT_MSG( m_dims.size(), SharedMemoryHistoryHeader::maxRank,
+                        GEOS_FMT( "The rank of the history data `{}` is too large for the shared-memory layout", m_name ) );
+  getTypeInfo( spec.getType(), m_typeKind, m_typeSize );
+}
+
+SharedMemoryHistoryIO::~SharedMemoryHistoryIO()
+{
+  // the segment is kept for the readers, it is removed by the next run or by the readers
+  unmapSegment();
+}
+
+std::uint64_t SharedMemoryHistoryIO::getRowBytes() const
+{
+  std::uint64_t rowBytes = m_typeSize;
+  for( localIndex const dim : m_dims )
+  {
+    rowBytes *= LvArray::integerConversion< std::uint64_t >( dim );
+  }
+  return rowBytes;
+}
+
+SharedMemoryHistorySlot * SharedMemoryHistoryIO::getSlot( std::uint64_t const record ) const
+{
+  auto const * const header = static_cast< SharedMemoryHistoryHeader const * >( m_segment );
+  buffer_unit_type * const slot = static_cast< buffer_unit_type * >( m_segment ) + header->headerBytes + ( record % m_slotCount ) * header->slotStride;
+  return reinterpret_cast< SharedMemoryHistorySlot * >( slot );
+}
+
+void SharedMemoryHistoryIO::unmapSegment()
+{
+  if( m_segment != nullptr )
+  {
+    ::munmap( m_segment, m_segmentBytes );
+  }
+  m_segment = nullptr;
+  m_segmentBytes = 0;
+}
+
+void SharedMemoryHistoryIO::createSegment( std::uint64_t const slotBytes )
+{
+  if( m_segment != nullptr )
+  {
+    // tell the readers still mapping the segment to open the new one once they have copied its records
+    static_cast< SharedMemoryHistoryHeader * >( m_segment )->state.store( 2, std::memory_order_release );
+    unmapSegment();
+  }
+  ::shm_unlink( m_segmentName.c_str() );
+
+  int const fd = ::shm_open( m_segmentName.c_str(), O_CREAT | O_RDWR | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+  if( fd < 0 )
+  {
+    throw std::runtime_error( GEOS_FMT( "Could not create shared-memory segment {}: {}", m_segmentName, std::strerror( errno ) ) );
+  }
+
+  std::uint64_t const headerBytes = alignUp( sizeof( SharedMemoryHistoryHeader ) );
+  std::uint64_t const slotStride = alignUp( sizeof( SharedMemoryHistorySlot ) + slotBytes );
+  size_t const size = LvArray::integerConversion< size_t >( headerBytes + m_slotCount * slotStride );
+  if( ::ftruncate( fd, LvArray::integerConversion< off_t >( size ) ) != 0 )
+  {
+    ::close( fd );
+    throw std::runtime_error( GEOS_FMT( "Could not resize shared-memory segment {}: {}", m_segmentName, std::strerror( errno ) ) );
+  }
+
+  void * const data = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  // the mapping remains valid once the file descriptor is closed
+  ::close( fd );
+  if( data == MAP_FAILED )
+  {
+    throw std::runtime_error( GEOS_FMT( "Could not map shared-memory segment {}: {}", m_segmentName, std::strerror( errno ) ) );
+  }
+  m_segment = data;
+  m_segmentBytes = size;
+
+  // the segment is zero-filled by ftruncate: the state is 0 until the header is complete, and the slots are empty
+  SharedMemoryHistoryHeader * const header = new ( m_segment ) SharedMemoryHistoryHeader;
+  std::memcpy( header->magic, "GEOSTHSM", sizeof( header->magic ) );
+  header->version = 1;
+  header->headerBytes = LvArray::integerConversion< std::uint32_t >( headerBytes );
+  header->slotCount = m_slotCount;
+  header->slotStride = slotStride;
+  header->slotBytes = slotBytes;
+  header->typeSize = m_typeSize;
+  header->typeKind = m_typeKind;
+  header->rank = LvArray::integerConversion< std::uint32_t >( m_dims.size() );
+  header->mpiRank = LvArray::integerConversion< std::uint32_t >( MpiWrapper::commRank() );
+  for( size_t dd = 0; dd < m_dims.size(); ++dd )
+  {
+    header->dims[dd] = LvArray::integerConversion< std::uint64_t >( m_dims[dd] );
+  }
+  std::strncpy( header->name, m_name.c_str(), SharedMemoryHistoryHeader::maxNameLength - 1 );
+  for( std::uint64_t slot = 0; slot < m_slotCount; ++slot )
+  {
+    new ( getSlot( slot ) ) SharedMemoryHistorySlot;
+  }
+  header->publishedCount.store( m_publishedCount, std::memory_order_relaxed );
+  header->state.store( 1, std::memory_order_release );
+}
+
+void SharedMemoryHistoryIO::init( bool GEOS_UNUSED_PARAM( existsOkay ) )
+{
+  // a previous segment is always replaced, the numbering of the records continues from the write head on restart
+  createSegment( std::max( getRowBytes(), std::uint64_t( m_typeSize ) ) * m_overallocMultiple );
+}
+
+buffer_unit_type * SharedMemoryHistoryIO::getBufferHead()
+{
+  GEOS_ERROR_IF( m_segment == nullptr, GEOS_FMT( "Shared-memory segment {} used before init", m_segmentName ) );
+
+  std::uint64_t const rowBytes = getRowBytes();
+  if( rowBytes > static_cast< SharedMemoryHistoryHeader const * >( m_segment )->slotBytes )
+  {
+    publish();
+    createSegment( rowBytes * m_overallocMultiple );
+  }
+  else if( m_writtenCount - m_publishedCount == m_slotCount )
+  {
+    // every slot holds a record not yet published, publish them before reusing the oldest one
+    publish();
+  }
+
+  SharedMemoryHistorySlot * const slot = getSlot( m_writtenCount );
+  slot->sequence.store( 2 * m_writtenCount + 1, std::memory_order_relaxed );
+  std::atomic_thread_fence( std::memory_order_release );
+  slot->record = m_writtenCount;
+  slot->count = LvArray::integerConversion< std::uint64_t >( m_dims.empty() ? 1 : m_dims[0] );
+  slot->bytes = rowBytes;
+
+  ++m_writtenCount;
+  ++m_bufferedCount;
+  return reinterpret_cast< buffer_unit_type * >( slot + 1 );
+}
+
+void SharedMemoryHistoryIO::publish()
+{
+  if( m_segment == nullptr )
+  {
+    return;
+  }
+  for( std::uint64_t record = m_publishedCount; record < m_writtenCount; ++record )
+  {
+    getSlot( record )->sequence.store( 2 * record + 2, std::memory_order_release );
+  }
+  m_publishedCount = m_writtenCount;
+  static_cast< SharedMemoryHistoryHeader * >( m_segment )->publishedCount.store( m_publishedCount, std::memory_order_release );
+}
+
+void SharedMemoryHistoryIO::write()
+{
+  publish();
+  m_bufferedCount = 0;
+}
+
+void SharedMemoryHistoryIO::compressInFile()
+{
+  publish();
+  if( m_segment != nullptr )
+  {
+    static_cast< SharedMemoryHistoryHeader * >( m_segment )->state.store( 3, std::memory_order_release );
+  }
+}
+
+void SharedMemoryHistoryIO::updateCollectingCount( localIndex count )
+{
+  // the slots are resized, if needed, when the next record is collected
+  if( !m_dims.empty() )
+  {
+    m_dims[0] = count;
+  }
+}
+
+}
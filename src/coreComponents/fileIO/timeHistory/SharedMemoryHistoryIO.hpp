@@ -0,0 +1,211 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SharedMemoryHistoryIO.hpp
+ */
+
+#ifndef GEOS_FILEIO_TIMEHISTORY_SHAREDMEMORYHISTORYIO_HPP_
+#define GEOS_FILEIO_TIMEHISTORY_SHAREDMEMORYHISTORYIO_HPP_
+
+#include "dataRepository/HistoryDataSpec.hpp"
+#include "BufferedHistoryIO.hpp"
+#include "common/DataTypes.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace geos
+{
+
+/**
+ * @brief Header at the start of a time history shared-memory segment.
+ * @details The segment is made of this header, followed by @p slotCount slots of @p slotStride bytes.
+ *          Each slot starts with a SharedMemoryHistorySlot header, followed by the data of one record,
+ *          packed as the collector packs it (the first dimension, of extent SharedMemoryHistorySlot::count,
+ *          varies the slowest). Record @p r is stored in slot @p r % @p slotCount.
+ *
+ *          The segment is written by a single rank and can be read by any process of the node:
+ *          - @p publishedCount is the number of records published since the start of the simulation
+ *            (records published before a restart included);
+ *          - the @p sequence of a slot is 2r+1 while record @p r is written into it, and 2r+2 once it is published,
+ *            so a reader copying record @p r checks that the sequence is 2r+2 before and after the copy;
+ *          - @p state is 1 while the segment is written, 2 when it has been replaced by a segment with larger
+ *            slots under the same name (the reader must open it again), and 3 at the end of the simulation.
+ *
+ *          All integers use the byte order of the node, and the atomic members are lock-free 64-bit integers.
+ */
+struct SharedMemoryHistoryHeader
+{
+  /// Maximum rank of the collected data
+  static constexpr std::uint32_t maxRank = 8;
+  /// Maximum length of the name of the collected data, including the terminating null character
+  static constexpr std::uint32_t maxNameLength = 128;
+
+  /// Identifier of the layout, "GEOSTHSM"
+  char magic[8];
+  /// Version of the layout, incremented when the layout changes
+  std::uint32_t version;
+  /// Size in bytes of this header, the offset of the first slot
+  std::uint32_t headerBytes;
+  /// Number of slots of the ring buffer
+  std::uint64_t slotCount;
+  /// Distance in bytes between the starts of two consecutive slots
+  std::uint64_t slotStride;
+  /// Maximum size in bytes of the data of a record
+  std::uint64_t slotBytes;
+  /// Size in bytes of a value
+  std::uint32_t typeSize;
+  /// Kind of the values: 'f' for floating-point, 'i' for signed integer, 'c' for characters
+  char typeKind;
+  /// Padding
+  char padding[3];
+  /// Rank of the collected data
+  std::uint32_t rank;
+  /// Rank of the MPI process writing the segment
+  std::uint32_t mpiRank;
+  /// Extent of each dimension of the collected data (the first one is given by each record)
+  std::uint64_t dims[maxRank];
+  /// Name of the collected data, null-terminated
+  char name[maxNameLength];
+  /// State of the segment
+  std::atomic< std::uint64_t > state;
+  /// Number of records published
+  std::atomic< std::uint64_t > publishedCount;
+};
+
+/**
+ * @brief Header of a slot of a time history shared-memory segment.
+ */
+struct SharedMemoryHistorySlot
+{
+  /// Sequence number of the slot, odd while a record is written into it
+  std::atomic< std::uint64_t > sequence;
+  /// Index of the record stored in the slot
+  std::uint64_t record;
+  /// Extent of the first dimension of the record
+  std::uint64_t count;
+  /// Size in bytes of the data of the record
+  std::uint64_t bytes;
+};
+
+/**
+ * @class SharedMemoryHistoryIO
+ * @brief Perform buffered history output for a single type into a POSIX shared-memory ring buffer.
+ * @details The collectors pack their data directly into the slots of the segment, which are published
+ *          to the readers on each write, so that external processes can monitor the time history without
+ *          any file. The records of a segment that the readers have not copied before the ring wraps
+ *          around are lost. The layout of the segment is described by SharedMemoryHistoryHeader.
+ */
+class SharedMemoryHistoryIO : public BufferedHistoryIO
+{
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] segmentName The name of the shared-memory segment, starting with a '/'.
+   * @param[in] spec The metadata of the history data being collected.
+   * @param[in] writeHead How many time history states have been written before (used on restart).
+   * @param[in] slotCount The number of records the ring buffer holds.
+   * @param[in] overallocMultiple Integer to scale the size of the slots when a record does not fit.
+   */
+  SharedMemoryHistoryIO( string const & segmentName,
+                         HistoryMetadata const & spec,
+                         localIndex writeHead = 0,
+                         localIndex slotCount = 64,
+                         localIndex overallocMultiple = 2 );
+
+  /// Destructor
+  virtual ~SharedMemoryHistoryIO() override;
+
+  virtual buffer_unit_type * getBufferHead() override;
+
+  /// @copydoc geos::BufferedHistoryIO::init
+  virtual void init( bool existsOkay ) override;
+
+  /// @copydoc geos::BufferedHistoryIO::write
+  virtual void write() override;
+
+  /// @copydoc geos::BufferedHistoryIO::compressInFile
+  virtual void compressInFile() override;
+
+  /// @copydoc geos::BufferedHistoryIO::updateCollectingCount
+  virtual void updateCollectingCount( localIndex count ) override;
+
+  localIndex getBufferedCount() override
+  { return m_bufferedCount; }
+
+  /**
+   * @brief Get the name of the shared-memory segment.
+   * @return The name of the segment.
+   */
+  string const & getSegmentName() const
+  { return m_segmentName; }
+
+private:
+
+  /// @brief Publish the records written into the slots since the last publication.
+  void publish();
+
+  /**
+   * @brief Create the segment, replacing any previous segment with the same name.
+   * @param[in] slotBytes The maximum size in bytes of the data of a record.
+   */
+  void createSegment( std::uint64_t slotBytes );
+
+  /// @brief Unmap the segment.
+  void unmapSegment();
+
+  /**
+   * @brief Get the header of a slot.
+   * @param[in] record The index of the record stored in the slot.
+   * @return The header of the slot.
+   */
+  SharedMemoryHistorySlot * getSlot( std::uint64_t record ) const;
+
+  /**
+   * @brief Get the size in bytes of the data of a record with the current collecting count.
+   * @return The size in bytes.
+   */
+  std::uint64_t getRowBytes() const;
+
+  /// The name of the shared-memory segment
+  string m_segmentName;
+  /// The mapped segment
+  void * m_segment;
+  /// The size in bytes of the mapped segment
+  size_t m_segmentBytes;
+  /// The number of slots of the ring buffer
+  std::uint64_t const m_slotCount;
+  /// How much to scale the size of the slots by when a record does not fit
+  std::uint64_t const m_overallocMultiple;
+  /// The number of records collected since the last write
+  localIndex m_bufferedCount;
+  /// The number of records published
+  std::uint64_t m_publishedCount;
+  /// The number of records written into the slots
+  std::uint64_t m_writtenCount;
+  /// The name of the history data
+  string m_name;
+  /// The size in bytes of a value
+  std::uint32_t m_typeSize;
+  /// The kind of the values
+  char m_typeKind;
+  /// The dimensions of the history data
+  std::vector< localIndex > m_dims;
+};
+
+}
+
+#endif
@@ -22,18 +22,24 @@
 #include "fileIO/Outputs/OutputUtilities.hpp"
 
 // TPL includes
+#include <vtkAppendFilter.h>
+#include <vtkBox.h>
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
 #include <vtkDoubleArray.h>
+#include <vtkExtractGeometry.h>
+#include <vtkFieldData.h>
 #include <vtkPassThrough.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkSmartPointer.h>
 #include <vtkThreshold.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridWriter.h>
 
 // System includes
+#include <limits>
 #include <numeric>
 #include <unordered_set>
 
@@ -54,9 +60,29 @@ VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string name ):
   m_requireFieldRegistrationCheck( true ),
   m_previousCycle( -1 ),
   m_outputMode( VTKOutputMode::BINARY ),
-  m_outputRegionType( VTKRegionTypes::ALL )
+  m_outputRegionType( VTKRegionTypes::ALL ),
+  m_numWriters( 0 ),
+  m_writerGroupComm( MPI_COMM_NULL ),
+  m_writeAsynchronously( false )
 {}
 
+VTKPolyDataWriterInterface::~VTKPolyDataWriterInterface()
+{
+  if( m_backgroundWrite.valid() )
+  {
+    m_backgroundWrite.wait();
+  }
+}
+
+void VTKPolyDataWriterInterface::flush()
+{
+  if( m_backgroundWrite.valid() )
+  {
+    // rethrows the errors raised while writing
+    m_backgroundWrite.get();
+  }
+}
+
 static int
 toVTKCellType( ElementType const elementType, localIndex const numNodes )
 {
@@ -1032,16 +1058,35 @@ void VTKPolyDataWriterInterface::writeCellElementRegions( real64 const time,
 {
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & region )
   {
-    CellData VTKCells = getVtkCells( region, nodeManager.size() );
-    vtkSmartPointer< vtkPoints > const VTKPoints = getVtkPoints( nodeManager, VTKCells.nodes );
+    if( !isRegionOutput( region.getName() ) )
+    {
+      return;
+    }
 
+    // The points and cells only depend on the mesh, hence they are rebuilt only after a topology change
+    Timestamp const meshTimestamp = elemManager.getMeshModificationTimestamp();
+    CachedGeometry & cached = m_cachedGeometry[ region.getPath() ];
+    if( cached.grid == nullptr || cached.meshTimestamp != meshTimestamp )
+    {
+      CellData VTKCells = getVtkCells( region, nodeManager.size() );
+      vtkSmartPointer< vtkPoints > const VTKPoints = getVtkPoints( nodeManager, VTKCells.nodes );
+
+      auto const geometry = vtkSmartPointer< vtkUnstructuredGrid >::New();
+      geometry->SetCells( VTKCells.cellTypes.data(), VTKCells.cells );
+      geometry->SetPoints( VTKPoints );
+
+      cached.meshTimestamp = meshTimestamp;
+      cached.grid = geometry;
+      cached.nodes = std::move( VTKCells.nodes );
+    }
+
+    // The grid of this step shares the points and cells of the cached geometry, and only owns its fields
     auto const ug = vtkSmartPointer< vtkUnstructuredGrid >::New();
-    ug->SetCells( VTKCells.cellTypes.data(), VTKCells.cells );
-    ug->SetPoints( VTKPoints );
+    ug->CopyStructure( cached.grid );
 
     writeTimestamp( ug.GetPointer(), time );
     writeElementFields( region, ug->GetCellData() );
-    writeNodeFields( nodeManager, VTKCells.nodes, ug->GetPointData() );
+    writeNodeFields( nodeManager, cached.nodes, ug->GetPointData() );
 
     string const regionDir = joinPath( path, region.getName() );
     writeUnstructuredGrid( regionDir, ug.GetPointer() );
@@ -1054,6 +1099,11 @@ void VTKPolyDataWriterInterface::writeParticleRegions( real64 const time,
 {
   particleManager.forParticleRegions< ParticleRegion >( [&]( ParticleRegion const & region )
   {
+    if( !isRegionOutput( region.getName() ) )
+    {
+      return;
+    }
+
     auto VTKCells = getVtkCells( region );
     auto VTKPoints = getVtkPoints( region );
 
@@ -1076,6 +1126,11 @@ void VTKPolyDataWriterInterface::writeWellElementRegions( real64 const time,
 {
   elemManager.forElementRegions< WellElementRegion >( [&]( WellElementRegion const & region )
   {
+    if( !isRegionOutput( region.getName() ) )
+    {
+      return;
+    }
+
     auto const & subRegion = region.getSubRegion< WellElementSubRegion >( 0 );
     ElementData well = getWell( subRegion, nodeManager );
 
@@ -1099,6 +1154,11 @@ void VTKPolyDataWriterInterface::writeSurfaceElementRegions( real64 const time,
 {
   elemManager.forElementRegions< SurfaceElementRegion >( [&]( SurfaceElementRegion const & region )
   {
+    if( !isRegionOutput( region.getName() ) )
+    {
+      return;
+    }
+
     auto const ug = vtkSmartPointer< vtkUnstructuredGrid >::New();
     ElementData surface = [&]()
     {
@@ -1168,10 +1228,18 @@ void VTKPolyDataWriterInterface::writeVtmFile( integer const cycle,
 
       auto addElementRegion = [&]( ElementRegionBase const & region )
       {
+        if( !isRegionOutput( region.getName() ) )
+        {
+          return;
+        }
         std::vector< string > const blockPath{ meshBody.getName(), meshLevel.getName(), region.getCatalogName(), region.getName() };
         string const regionPath = joinPath( meshPath, region.getName() );
         for( int i = 0; i < mpiSize; i++ )
         {
+          if( getWriterRank( i ) != i )
+          {
+            continue;
+          }
           string const dataSetName = getRankFileName( i );
           string const dataSetFile = joinPath( regionPath, dataSetName + ".vtu" );
           vtmWriter.addDataSet( blockPath, dataSetName, dataSetFile );
@@ -1180,10 +1248,18 @@ void VTKPolyDataWriterInterface::writeVtmFile( integer const cycle,
 
       auto addParticleRegion = [&]( ParticleRegionBase const & region )
       {
+        if( !isRegionOutput( region.getName() ) )
+        {
+          return;
+        }
         std::vector< string > const blockPath{ meshBody.getName(), meshLevel.getName(), region.getCatalogName(), region.getName() };
         string const regionPath = joinPath( meshPath, region.getName() );
         for( int i = 0; i < mpiSize; i++ )
         {
+          if( getWriterRank( i ) != i )
+          {
+            continue;
+          }
           string const dataSetName = getRankFileName( i );
           string const dataSetFile = joinPath( regionPath, dataSetName + ".vtu" );
           vtmWriter.addDataSet( blockPath, dataSetName, dataSetFile );
@@ -1230,6 +1306,93 @@ int toVtkOutputMode( VTKOutputMode const mode )
   }
 }
 
+int VTKPolyDataWriterInterface::getWriterRank( int const rank ) const
+{
+  int const numRanks = MpiWrapper::commSize();
+  if( m_numWriters <= 0 || m_numWriters >= numRanks )
+  {
+    return rank;
+  }
+  int const groupSize = ( numRanks + m_numWriters - 1 ) / m_numWriters;
+  return ( rank / groupSize ) * groupSize;
+}
+
+/**
+ * @brief Gather the pieces of a group of ranks and merge them on the first rank of the group.
+ * @param[in] piece the piece of the current rank
+ * @param[in] comm the communicator of the group
+ * @return the merged piece on the first rank of the group, nullptr on the other ranks
+ */
+static vtkSmartPointer< vtkDataObject > gatherPieces( vtkDataObject * const piece,
+                                                      MPI_Comm const comm )
+{
+  // Raw binary serialization, read back without any loss of precision
+  auto const pieceWriter = vtkSmartPointer< vtkXMLUnstructuredGridWriter >::New();
+  pieceWriter->SetInputData( piece );
+  pieceWriter->SetWriteToOutputString( true );
+  pieceWriter->SetDataModeToAppended();
+  pieceWriter->EncodeAppendedDataOff();
+  pieceWriter->Write();
+  string const buffer = pieceWriter->GetOutputString();
+
+  GEOS_ERROR_IF_GT_MSG( buffer.size(), static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                        "VTK piece is too large to be sent to its writer" );
+  int const bufferSize = static_cast< int >( buffer.size() );
+
+  int const groupRank = MpiWrapper::commRank( comm );
+  int const groupSize = MpiWrapper::commSize( comm );
+  std::vector< int > sizes( groupSize );
+  MpiWrapper::gather( &bufferSize, 1, sizes.data(), 1, 0, comm );
+
+  std::vector< int > offsets( groupSize, 0 );
+  std::size_t totalSize = 0;
+  for( int r = 0; r < groupSize; ++r )
+  {
+    offsets[r] = static_cast< int >( totalSize );
+    totalSize += sizes[r];
+  }
+  GEOS_ERROR_IF_GT_MSG( totalSize, static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                        "VTK pieces are too large to be gathered on their writer, the number of writers should be increased" );
+
+  std::vector< char > allBuffers( groupRank == 0 ? totalSize : 0 );
+  MpiWrapper::gatherv( buffer.data(), bufferSize, allBuffers.data(), sizes.data(), offsets.data(), 0, comm );
+
+  if( groupRank != 0 )
+  {
+    return nullptr;
+  }
+
+  std::vector< vtkSmartPointer< vtkUnstructuredGrid > > grids( groupSize );
+  auto const appender = vtkSmartPointer< vtkAppendFilter >::New();
+  appender->MergePointsOff();
+  integer numInputs = 0;
+  for( int r = 0; r < groupSize; ++r )
+  {
+    auto const pieceReader = vtkSmartPointer< vtkXMLUnstructuredGridReader >::New();
+    pieceReader->ReadFromInputStringOn();
+    pieceReader->SetInputString( std::string( allBuffers.data() + offsets[r], sizes[r] ) );
+    pieceReader->Update();
+    grids[r] = pieceReader->GetOutput();
+
+    // Empty pieces may lack some arrays, which would then be dropped from the merged piece
+    if( grids[r]->GetNumberOfCells() > 0 )
+    {
+      appender->AddInputData( grids[r] );
+      ++numInputs;
+    }
+  }
+
+  if( numInputs == 0 )
+  {
+    return grids[0];
+  }
+
+  appender->Update();
+  vtkSmartPointer< vtkDataObject > merged = appender->GetOutputDataObject( 0 );
+  merged->GetFieldData()->PassData( grids[0]->GetFieldData() );
+  return merged;
+}
+
 void VTKPolyDataWriterInterface::writeUnstructuredGrid( string const & path,
                                                         vtkUnstructuredGrid * ug ) const
 {
@@ -1254,15 +1417,50 @@ void VTKPolyDataWriterInterface::writeUnstructuredGrid( string const & path,
   }
 
   filter->SetInputDataObject( ug );
+
+  // The cells lying outside of the output box are discarded after the ghost cells,
+  // keeping the cells crossing its boundary so that the clipped region has no holes.
+  if( !m_outputBox.empty() )
+  {
+    auto box = vtkSmartPointer< vtkBox >::New();
+    box->SetBounds( m_outputBox[0], m_outputBox[3], m_outputBox[1], m_outputBox[4], m_outputBox[2], m_outputBox[5] );
+
+    auto extractor = vtkSmartPointer< vtkExtractGeometry >::New();
+    extractor->SetImplicitFunction( box );
+    extractor->ExtractInsideOn();
+    extractor->ExtractBoundaryCellsOn();
+    extractor->SetInputConnection( filter->GetOutputPort() );
+
+    filter = extractor;
+  }
+
   filter->Update();
 
+  vtkSmartPointer< vtkDataObject > piece = filter->GetOutputDataObject( 0 );
+  int const rank = MpiWrapper::commRank();
+  if( m_writerGroupComm != MPI_COMM_NULL )
+  {
+    piece = gatherPieces( piece, m_writerGroupComm );
+    if( getWriterRank( rank ) != rank )
+    {
+      return;
+    }
+  }
+
   makeDirectory( path );
-  string const vtuFilePath = joinPath( path, getRankFileName( MpiWrapper::commRank() ) + ".vtu" );
+  string const vtuFilePath = joinPath( path, getRankFileName( rank ) + ".vtu" );
   auto const vtuWriter = vtkSmartPointer< vtkXMLUnstructuredGridWriter >::New();
-  vtuWriter->SetInputData( filter->GetOutputDataObject( 0 ) );
+  vtuWriter->SetInputData( piece );
   vtuWriter->SetFileName( vtuFilePath.c_str() );
   vtuWriter->SetDataMode( toVtkOutputMode( m_outputMode ) );
-  vtuWriter->Write();
+  if( m_writeAsynchronously )
+  {
+    m_pendingWrites.emplace_back( [vtuWriter]() { vtuWriter->Write(); } );
+  }
+  else
+  {
+    vtuWriter->Write();
+  }
 }
 
 void VTKPolyDataWriterInterface::write( real64 const time,
@@ -1273,6 +1471,9 @@ void VTKPolyDataWriterInterface::write( real64 const time,
   // triggered inside VTK by a progress indicator
   LvArray::system::FloatingPointExceptionGuard guard;
 
+  // At most one step is written in the background at a time
+  flush();
+
   string const stepSubDir = joinPath( m_outputName, getCycleSubFolder( cycle ) );
   string const stepSubDirFull = joinPath( m_outputDir, stepSubDir );
 
@@ -1283,6 +1484,12 @@ void VTKPolyDataWriterInterface::write( real64 const time,
   }
   MpiWrapper::barrier( MPI_COMM_GEOSX );
 
+  // Ranks sharing a writer send it their pieces
+  if( m_numWriters > 0 && m_numWriters < MpiWrapper::commSize() )
+  {
+    m_writerGroupComm = MpiWrapper::commSplit( MPI_COMM_GEOSX, getWriterRank( rank ), rank );
+  }
+
   // loop over all mesh levels and mesh bodies
   domain.forMeshBodies( [&]( MeshBody const & meshBody )
   {
@@ -1332,6 +1539,25 @@ void VTKPolyDataWriterInterface::write( real64 const time,
     } );
   } );
 
+  if( m_writerGroupComm != MPI_COMM_NULL )
+  {
+    MpiWrapper::commFree( m_writerGroupComm );
+    m_writerGroupComm = MPI_COMM_NULL;
+  }
+
+  if( !m_pendingWrites.empty() )
+  {
+    m_backgroundWrite = std::async( std::launch::async, [writes = std::move( m_pendingWrites )]()
+    {
+      LvArray::system::FloatingPointExceptionGuard threadGuard;
+      for( std::function< void() > const & write : writes )
+      {
+        write();
+      }
+    } );
+    m_pendingWrites.clear();
+  }
+
   if( rank == 0 )
   {
     string const vtmName = stepSubDir + ".vtm";
@@ -1355,7 +1581,8 @@ void VTKPolyDataWriterInterface::clearData()
 
 bool VTKPolyDataWriterInterface::isFieldPlotEnabled( dataRepository::WrapperBase const & wrapper ) const
 {
-  return outputUtilities::isFieldPlotEnabled( wrapper.getPlotLevel(),
+  return !wrapper.isAllocationDeferred() &&
+         outputUtilities::isFieldPlotEnabled( wrapper.getPlotLevel(),
                                               m_plotLevel,
                                               wrapper.getName(),
                                               m_fieldNames,
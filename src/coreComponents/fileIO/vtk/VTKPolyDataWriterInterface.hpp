@@ -16,12 +16,19 @@
 #define GEOS_FILEIO_VTK_VTKPOLYDATAWRITERINTERFACE_HPP_
 
 #include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
 #include "dataRepository/WrapperBase.hpp"
 #include "dataRepository/Wrapper.hpp"
 #include "fileIO/vtk/VTKPVDWriter.hpp"
 #include "fileIO/vtk/VTKVTMWriter.hpp"
 #include "codingUtilities/EnumStrings.hpp"
 
+#include <vtkSmartPointer.h>
+
+#include <functional>
+#include <future>
+#include <map>
+
 class vtkUnstructuredGrid;
 class vtkPointData;
 class vtkCellData;
@@ -80,6 +87,17 @@ public:
    */
   explicit VTKPolyDataWriterInterface( string outputName );
 
+  /**
+   * @brief Destructor, waiting for the files being written in the background
+   */
+  ~VTKPolyDataWriterInterface();
+
+  /// Deleted copy constructor
+  VTKPolyDataWriterInterface( VTKPolyDataWriterInterface const & ) = delete;
+
+  /// Deleted copy assignment
+  VTKPolyDataWriterInterface & operator=( VTKPolyDataWriterInterface const & ) = delete;
+
   /**
    * @brief Defines if the vtk outputs should contain the ghost cells.
    * @param writeGhostCells The boolean flag.
@@ -109,6 +127,34 @@ public:
     m_outputMode = mode;
   }
 
+  /**
+   * @brief Set the number of ranks writing the VTK pieces
+   * @param[in] numWriters the number of writers, 0 for all the ranks
+   * @details The ranks are split into contiguous groups, and the first rank of each group
+   * gathers the data of its group and writes a single piece for all of them.
+   */
+  void setNumberOfWriters( integer numWriters )
+  {
+    m_numWriters = numWriters;
+  }
+
+  /**
+   * @brief Defines if the vtu files are written by a background thread
+   * @param writeAsynchronously The boolean flag.
+   * @details The data is copied into the VTK objects during the call to write(), so that the
+   * simulation can proceed while the files are written. The previous step is flushed
+   * at the beginning of the next call to write().
+   */
+  void setWriteAsynchronously( bool writeAsynchronously )
+  {
+    m_writeAsynchronously = writeAsynchronously;
+  }
+
+  /**
+   * @brief Wait for the files being written in the background
+   */
+  void flush();
+
   /**
    * @brief Set the output region type
    * @param[in] regionType output region type to be set
@@ -148,6 +194,25 @@ public:
     m_fieldNames.insert( fieldNames.begin(), fieldNames.end() );
   }
 
+  /**
+   * @brief Set the names of the regions to output
+   * @param[in] regionNames the regions to output, all the regions being output if empty
+   */
+  void setRegionNames( arrayView1d< string const > const & regionNames )
+  {
+    m_regionNames.insert( regionNames.begin(), regionNames.end() );
+  }
+
+  /**
+   * @brief Set the box the output is restricted to
+   * @param[in] outputBox the bounds xMin, yMin, zMin, xMax, yMax, zMax of the box, no restriction being applied if empty
+   * @details The cells lying inside the box or crossing its boundary are written, the other ones are discarded.
+   */
+  void setOutputBox( arrayView1d< real64 const > const & outputBox )
+  {
+    m_outputBox.assign( outputBox.begin(), outputBox.end() );
+  }
+
 
   /**
    * @brief Main method of this class. Write all the files for one time step.
@@ -200,6 +265,16 @@ private:
    */
   bool isFieldPlotEnabled( dataRepository::WrapperBase const & wrapper ) const;
 
+  /**
+   * @brief Check if this region is output
+   * @param[in] regionName the name of the region
+   * @return true if no region names were specified or if the region is one of them, false otherwise
+   */
+  bool isRegionOutput( string const & regionName ) const
+  {
+    return m_regionNames.empty() || m_regionNames.count( regionName ) > 0;
+  }
+
   /**
    * @brief Writes the files for all the CellElementRegions.
    * @details There will be one file written per CellElementRegion and per rank.
@@ -291,6 +366,13 @@ private:
   void writeUnstructuredGrid( string const & path,
                               vtkUnstructuredGrid * ug ) const;
 
+  /**
+   * @brief Get the rank writing the piece of a given rank
+   * @param[in] rank the rank
+   * @return the first rank of the group of @p rank, or @p rank itself if all the ranks write
+   */
+  int getWriterRank( int const rank ) const;
+
 private:
 
   /// Output directory name
@@ -318,6 +400,12 @@ private:
   /// Names of the fields to output
   std::set< string > m_fieldNames;
 
+  /// Names of the regions to output, all the regions if empty
+  std::set< string > m_regionNames;
+
+  /// Bounds of the box the output is restricted to, no restriction if empty
+  std::vector< real64 > m_outputBox;
+
   /// The previousCycle
   integer m_previousCycle;
 
@@ -326,6 +414,38 @@ private:
 
   /// Region output type, could be CELL, WELL, SURFACE, or ALL
   VTKRegionTypes m_outputRegionType;
+
+  /// Number of ranks writing the pieces, 0 meaning all the ranks
+  integer m_numWriters;
+
+  /// Communicator of the group of ranks sharing a writer, valid during a call to write()
+  MPI_Comm m_writerGroupComm;
+
+  /// Should the vtu files be written by a background thread or not.
+  bool m_writeAsynchronously;
+
+  /// vtu files of the current step, to be written once all of them are ready
+  mutable std::vector< std::function< void() > > m_pendingWrites;
+
+  /// Background write of the vtu files of the previous step
+  std::future< void > m_backgroundWrite;
+
+  /**
+   * @struct CachedGeometry
+   * @brief Points and cells of a cell element region, reused by the output steps while the mesh is unchanged.
+   */
+  struct CachedGeometry
+  {
+    /// Modification timestamp of the mesh level the geometry was built for
+    Timestamp meshTimestamp;
+    /// Grid holding the points and cells of the region, without any field
+    vtkSmartPointer< vtkUnstructuredGrid > grid;
+    /// Indices of the nodes of the region, in the order of the points of the grid
+    array1d< localIndex > nodes;
+  };
+
+  /// Geometry of the cell element regions written so far, indexed by the path of the region
+  mutable std::map< string, CachedGeometry > m_cachedGeometry;
 };
 
 } // namespace vtk
@@ -28,7 +28,8 @@ using namespace finiteElement;
 
 
 FiniteElementDiscretization::FiniteElementDiscretization( string const & name, Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_shapeFunctionGradients( ShapeFunctionGradientsOption::automatic )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -48,11 +49,42 @@ FiniteElementDiscretization::FiniteElementDiscretization( string const & name, G
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
     setDescription( "Specifier to indicate whether to force the use of VEM" );
+
+  registerWrapper( viewKeyStruct::storeVemProjectorsString(), &m_storeVemProjectors ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Specifier to indicate whether to compute the projectors of the virtual elements once at initialization "
+                    "and store them for each cell, instead of computing them each time an element is used" );
+
+  registerWrapper( viewKeyStruct::shapeFunctionGradientsString(), &m_shapeFunctionGradients ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( m_shapeFunctionGradients ).
+    setDescription( "Specifier to indicate whether the shape function gradients are computed once at initialization and "
+                    "stored for each cell (trading memory traffic for arithmetic), or computed by the kernels from the nodal "
+                    "coordinates each time they are needed. With automatic, they are stored on host builds and computed on "
+                    "device builds. Options are:\n* " + EnumStrings< ShapeFunctionGradientsOption >::concat( "\n* " ) );
 }
 
 FiniteElementDiscretization::~FiniteElementDiscretization()
 {}
 
+bool FiniteElementDiscretization::storeShapeFunctionGradients() const
+{
+  switch( m_shapeFunctionGradients )
+  {
+    case ShapeFunctionGradientsOption::stored:   return true;
+    case ShapeFunctionGradientsOption::computed: return false;
+    default:
+    {
+#if defined(GEOS_USE_DEVICE)
+      return false;
+#else
+      return true;
+#endif
+    }
+  }
+}
+
 
 void FiniteElementDiscretization::postProcessInput()
 {
@@ -61,6 +93,8 @@ void FiniteElementDiscretization::postProcessInput()
                  getDataContext() << ": Only standard element formulations and spectral element formulations are currently supported." );
   GEOS_ERROR_IF_GT_MSG( m_useVem, 1,
                         getDataContext() << ": The flag useVirtualElements can be either 0 or 1" );
+  GEOS_ERROR_IF_GT_MSG( m_storeVemProjectors, 1,
+                        getDataContext() << ": The flag storeVirtualElementProjectors can be either 0 or 1" );
 }
 
 std::unique_ptr< FiniteElementBase >
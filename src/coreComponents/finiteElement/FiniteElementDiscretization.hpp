@@ -19,6 +19,7 @@
 #ifndef GEOS_FINITEELEMENT_FINITEELEMENTDISCRETIZATION_HPP_
 #define GEOS_FINITEELEMENT_FINITEELEMENTDISCRETIZATION_HPP_
 
+#include "codingUtilities/EnumStrings.hpp"
 #include "common/TimingMacros.hpp"
 #include "dataRepository/Group.hpp"
 #include "dataRepository/Wrapper.hpp"
@@ -49,6 +50,18 @@ public:
 
 
 
+  /**
+   * @enum ShapeFunctionGradientsOption
+   *
+   * The options for the evaluation of the shape function gradients in the kernels
+   */
+  enum class ShapeFunctionGradientsOption : integer
+  {
+    automatic, //!< stored on host builds, computed on device builds
+    stored,    //!< computed once at initialization and read by the kernels
+    computed   //!< computed by the kernels from the nodal coordinates each time they are needed
+  };
+
   FiniteElementDiscretization() = delete;
 
   explicit FiniteElementDiscretization( string const & name, Group * const parent );
@@ -70,6 +83,20 @@ public:
                                         typename FE_TYPE::template MeshData< SUBREGION_TYPE > meshData,
                                         FE_TYPE & fe ) const;
 
+  /**
+   * @brief Compute and store the projectors of the virtual elements of a sub-region, if requested.
+   * @tparam SUBREGION_TYPE The type of the sub-region.
+   * @tparam FE_TYPE The type of the finite element, nothing is done if it is not a virtual element.
+   * @param elementSubRegion The sub-region, on which the projectors are registered.
+   * @param meshData The mesh data of the finite element.
+   * @param finiteElement The finite element, which reads the stored projectors from then on.
+   */
+  template< typename SUBREGION_TYPE,
+            typename FE_TYPE >
+  void storeVirtualElementProjectors( SUBREGION_TYPE & elementSubRegion,
+                                      typename FE_TYPE::template MeshData< SUBREGION_TYPE > const & meshData,
+                                      FE_TYPE & finiteElement ) const;
+
 
   /**
    * @brief Factory method to instantiate a type of finite element formulation.
@@ -90,6 +117,8 @@ private:
     static constexpr char const * orderString() { return "order"; }
     static constexpr char const * formulationString() { return "formulation"; }
     static constexpr char const * useVemString() { return "useVirtualElements"; }
+    static constexpr char const * storeVemProjectorsString() { return "storeVirtualElementProjectors"; }
+    static constexpr char const * shapeFunctionGradientsString() { return "shapeFunctionGradients"; }
   };
 
   /// The order of the finite element basis
@@ -101,10 +130,27 @@ private:
   /// Optional parameter indicating if the class should use Virtual Elements.
   int m_useVem;
 
+  /// Optional parameter indicating if the projectors of the Virtual Elements are stored at initialization.
+  int m_storeVemProjectors;
+
+  /// Optional parameter indicating if the shape function gradients are stored or computed in the kernels.
+  ShapeFunctionGradientsOption m_shapeFunctionGradients;
+
+  /**
+   * @brief Check whether the shape function gradients are stored at initialization.
+   * @return true if the gradients are stored, false if they are computed in the kernels
+   */
+  bool storeShapeFunctionGradients() const;
+
   void postProcessInput() override final;
 
 };
 
+ENUM_STRINGS( FiniteElementDiscretization::ShapeFunctionGradientsOption,
+              "automatic",
+              "stored",
+              "computed" );
+
 template< typename SUBREGION_TYPE,
           typename FE_TYPE >
 void
@@ -126,11 +172,18 @@ FiniteElementDiscretization::
 
   constexpr localIndex numNodesPerElem = FE_TYPE::maxSupportPoints;
   constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
-  dNdX.resizeWithoutInitializationOrDestruction( elementSubRegion->size(), numQuadraturePointsPerElem, numNodesPerElem, 3 );
+  // the determinants are always stored since they are also used outside of the kernels (e.g., for the mass matrix),
+  // whereas the gradients are only stored if the kernels are meant to read them instead of computing them
+  bool const storeGradients = storeShapeFunctionGradients();
+  dNdX.resizeWithoutInitializationOrDestruction( storeGradients ? elementSubRegion->size() : 0,
+                                                 numQuadraturePointsPerElem, numNodesPerElem, 3 );
   detJ.resize( elementSubRegion->size(), numQuadraturePointsPerElem );
 
-  finiteElement.setGradNView( dNdX.toViewConst() );
-  finiteElement.setDetJView( detJ.toViewConst() );
+  if( storeGradients )
+  {
+    finiteElement.setGradNView( dNdX.toViewConst() );
+    finiteElement.setDetJView( detJ.toViewConst() );
+  }
 
   for( localIndex k = 0; k < elementSubRegion->size(); ++k )
   {
@@ -154,9 +207,12 @@ FiniteElementDiscretization::
       real64 dNdXLocal[numNodesPerElem][3];
       detJ( k, q ) = finiteElement.calcGradN( q, xLocal, feStack, dNdXLocal );
 
-      for( localIndex b = 0; b < numSupportPoints; ++b )
+      if( storeGradients )
       {
-        LvArray::tensorOps::copy< 3 >( dNdX[ k ][ q ][ b ], dNdXLocal[b] );
+        for( localIndex b = 0; b < numSupportPoints; ++b )
+        {
+          LvArray::tensorOps::copy< 3 >( dNdX[ k ][ q ][ b ], dNdXLocal[b] );
+        }
       }
     }
   }
@@ -164,6 +220,45 @@ FiniteElementDiscretization::
 }
 
 
+template< typename SUBREGION_TYPE,
+          typename FE_TYPE >
+void
+FiniteElementDiscretization::
+  storeVirtualElementProjectors( SUBREGION_TYPE & elementSubRegion,
+                                 typename FE_TYPE::template MeshData< SUBREGION_TYPE > const & meshData,
+                                 FE_TYPE & finiteElement ) const
+{
+  if constexpr ( finiteElement::isConformingVirtualElementOrder1< FE_TYPE > )
+  {
+    if( m_storeVemProjectors == 0 )
+    {
+      return;
+    }
+
+    GEOS_MARK_FUNCTION;
+
+    string const basisFunctionsName = getName() + "_vemBasisFunctionsIntegralMean";
+    string const stabilizationName = getName() + "_vemStabilizationMatrix";
+    string const basisDerivativesName = getName() + "_vemBasisDerivativesIntegralMean";
+    array2d< real64 > & basisFunctionsIntegralMean =
+      elementSubRegion.template registerWrapper< array2d< real64 > >( basisFunctionsName ).
+        setRestartFlags( dataRepository::RestartFlags::NO_WRITE ).reference();
+    array2d< real64 > & stabilizationMatrix =
+      elementSubRegion.template registerWrapper< array2d< real64 > >( stabilizationName ).
+        setRestartFlags( dataRepository::RestartFlags::NO_WRITE ).reference();
+    array3d< real64 > & basisDerivativesIntegralMean =
+      elementSubRegion.template registerWrapper< array3d< real64 > >( basisDerivativesName ).
+        setRestartFlags( dataRepository::RestartFlags::NO_WRITE ).reference();
+    elementSubRegion.excludeWrappersFromPacking( { basisFunctionsName, stabilizationName, basisDerivativesName } );
+
+    finiteElement.storeProjectors( meshData, basisFunctionsIntegralMean, stabilizationMatrix, basisDerivativesIntegralMean );
+  }
+  else
+  {
+    GEOS_UNUSED_VAR( elementSubRegion, meshData, finiteElement );
+  }
+}
+
 } /* namespace geos */
 
 #endif /* GEOS_FINITEELEMENT_FINITEELEMENTDISCRETIZATION_HPP_ */
@@ -357,6 +357,95 @@ public:
                                          stack.basisDerivativesIntegralMean );
   }
 
+  /**
+   * @brief Setup method, reading the projectors stored by @ref storeProjectors if any, and
+   * computing them with @ref setupStack otherwise.
+   * @tparam LEAF Type of the derived finite element implementation.
+   * @param cellIndex The index of the cell with respect to the cell sub region to which the element
+   * has been initialized previously (see @ref fillMeshData).
+   * @param meshData Object previously initialized by @ref fillMeshData.
+   * @param stack Object that holds stack variables.
+   */
+  template< typename LEAF, typename SUBREGION_TYPE >
+  GEOS_HOST_DEVICE
+  inline
+  void setup( localIndex const & cellIndex,
+              MeshData< SUBREGION_TYPE > const & meshData,
+              StackVariables & stack ) const
+  {
+    if( m_viewStabilizationMatrix.size( 0 ) == 0 )
+    {
+      setupStack( cellIndex, meshData, stack );
+      return;
+    }
+
+    localIndex const numCellPoints = meshData.cellToNodeMap[cellIndex].size();
+    stack.numSupportPoints = numCellPoints;
+    stack.quadratureWeight = meshData.cellVolumes( cellIndex );
+    for( localIndex i = 0; i < numCellPoints; ++i )
+    {
+      stack.basisFunctionsIntegralMean[i] = m_viewBasisFunctionsIntegralMean( cellIndex, i );
+      for( localIndex d = 0; d < 3; ++d )
+      {
+        stack.basisDerivativesIntegralMean[i][d] = m_viewBasisDerivativesIntegralMean( cellIndex, i, d );
+      }
+      for( localIndex j = i; j < numCellPoints; ++j )
+      {
+        real64 const value = m_viewStabilizationMatrix( cellIndex, packedStabilizationIndex( i, j ) );
+        stack.stabilizationMatrix[i][j] = value;
+        stack.stabilizationMatrix[j][i] = value;
+      }
+    }
+  }
+
+  /**
+   * @brief Compute the projectors of all the cells once and store them, so that @ref setup reads
+   * them instead of computing them each time the element is used.
+   * @param meshData Object previously initialized by @ref fillMeshData.
+   * @param basisFunctionsIntegralMean The integral means of the basis functions, resized to
+   * number of cells times @p MAXCELLNODES.
+   * @param stabilizationMatrix The upper triangles of the symmetric stabilization matrices,
+   * resized to number of cells times @p MAXCELLNODES * ( @p MAXCELLNODES + 1 ) / 2.
+   * @param basisDerivativesIntegralMean The integral means of the derivatives of the basis functions,
+   * resized to number of cells times @p MAXCELLNODES times 3.
+   *
+   * The storage is sized for the cell shape of this element, and the arrays must outlive the
+   * copies of this element.
+   */
+  template< typename SUBREGION_TYPE >
+  void storeProjectors( MeshData< SUBREGION_TYPE > const & meshData,
+                        array2d< real64 > & basisFunctionsIntegralMean,
+                        array2d< real64 > & stabilizationMatrix,
+                        array3d< real64 > & basisDerivativesIntegralMean )
+  {
+    localIndex const numCells = meshData.cellVolumes.size();
+    basisFunctionsIntegralMean.resizeWithoutInitializationOrDestruction( numCells, MAXCELLNODES );
+    stabilizationMatrix.resizeWithoutInitializationOrDestruction( numCells, MAXCELLNODES * ( MAXCELLNODES + 1 ) / 2 );
+    basisDerivativesIntegralMean.resizeWithoutInitializationOrDestruction( numCells, MAXCELLNODES, 3 );
+
+    for( localIndex k = 0; k < numCells; ++k )
+    {
+      StackVariables stack;
+      setupStack( k, meshData, stack );
+      for( localIndex i = 0; i < stack.numSupportPoints; ++i )
+      {
+        basisFunctionsIntegralMean( k, i ) = stack.basisFunctionsIntegralMean[i];
+        for( localIndex d = 0; d < 3; ++d )
+        {
+          basisDerivativesIntegralMean( k, i, d ) = stack.basisDerivativesIntegralMean[i][d];
+        }
+        for( localIndex j = i; j < stack.numSupportPoints; ++j )
+        {
+          stabilizationMatrix( k, packedStabilizationIndex( i, j ) ) = stack.stabilizationMatrix[i][j];
+        }
+      }
+    }
+
+    m_viewBasisFunctionsIntegralMean = basisFunctionsIntegralMean.toViewConst();
+    m_viewStabilizationMatrix = stabilizationMatrix.toViewConst();
+    m_viewBasisDerivativesIntegralMean = basisDerivativesIntegralMean.toViewConst();
+  }
+
   /**
    * @defgroup DeprecatedSyntax VEM functions with deprecated syntax.
    *
@@ -505,6 +594,29 @@ public:
 
 private:
 
+  /**
+   * @brief Get the position of an entry of the upper triangle of the stabilization matrix in its
+   * packed storage.
+   * @param i The row index.
+   * @param j The column index, not lower than @p i.
+   * @return The position in the row-wise packed upper triangle.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  static localIndex packedStabilizationIndex( localIndex const i, localIndex const j )
+  {
+    return i * MAXCELLNODES - i * ( i - 1 ) / 2 + j - i;
+  }
+
+  /// View to the stored integral means of the basis functions, empty if the projectors are not stored.
+  arrayView2d< real64 const > m_viewBasisFunctionsIntegralMean;
+
+  /// View to the stored upper triangles of the stabilization matrices, empty if the projectors are not stored.
+  arrayView2d< real64 const > m_viewStabilizationMatrix;
+
+  /// View to the stored integral means of the derivatives of the basis functions, empty if the projectors are not stored.
+  arrayView3d< real64 const > m_viewBasisDerivativesIntegralMean;
+
   GEOS_HOST_DEVICE
   static void
     computeFaceIntegrals( InputNodeCoords const & nodesCoords,
@@ -607,6 +719,14 @@ private:
   }
 };
 
+/// Whether a finite element type is a ConformingVirtualElementOrder1.
+template< typename FE_TYPE >
+constexpr bool isConformingVirtualElementOrder1 = false;
+
+/// @copydoc isConformingVirtualElementOrder1
+template< localIndex MAXCELLNODES, localIndex MAXFACENODES >
+constexpr bool isConformingVirtualElementOrder1< ConformingVirtualElementOrder1< MAXCELLNODES, MAXFACENODES > > = true;
+
 /// Convenience typedef for VEM on tetrahedra.
 using H1_Tetrahedron_VEM_Gauss1 = ConformingVirtualElementOrder1< 4, 3 >;
 #if !defined( GEOS_USE_HIP )
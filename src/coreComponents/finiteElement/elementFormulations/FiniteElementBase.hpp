@@ -16,12 +16,6 @@
  * @file FiniteElementBase.hpp
  */
 
-#if defined(GEOS_USE_DEVICE)
-#define CALC_FEM_SHAPE_IN_KERNEL
-#endif
-
-
-
 #ifndef GEOS_FINITEELEMENT_ELEMENTFORMULATIONS_FINITEELEMENTBASE_HPP_
 #define GEOS_FINITEELEMENT_ELEMENTFORMULATIONS_FINITEELEMENTBASE_HPP_
 
@@ -57,16 +51,9 @@ public:
    * @param source The object to copy.
    */
   FiniteElementBase( FiniteElementBase const & source ):
-#ifdef CALC_FEM_SHAPE_IN_KERNEL
-    m_viewGradN(),
-    m_viewDetJ()
-#else
     m_viewGradN( source.m_viewGradN ),
     m_viewDetJ( source.m_viewDetJ )
-#endif
-  {
-    GEOS_UNUSED_VAR( source ); // suppress warning when CALC_FEM_SHAPE_IN_KERNEL is defined
-  }
+  {}
 
   /// Default Move constructor
   FiniteElementBase( FiniteElementBase && ) = default;
@@ -268,7 +255,8 @@ public:
    * @param gradN Return array of the shape function gradients.
    * @return The determinant of the Jacobian transformation matrix.
    *
-   * This function calls the function to calculate shape function gradients.
+   * This function returns the pre-calculated shape function gradients if they have been stored
+   * (see @ref setGradNView), and otherwise calls the function to calculate them from @p X.
    */
   template< typename LEAF >
   GEOS_HOST_DEVICE
@@ -287,7 +275,8 @@ public:
    * @param gradN Return array of the shape function gradients.
    * @return The determinant of the Jacobian transformation matrix.
    *
-   * This function calls the function to calculate shape function gradients.
+   * This function returns the pre-calculated shape function gradients if they have been stored
+   * (see @ref setGradNView), and otherwise calls the function to calculate them from @p X.
    */
   template< typename LEAF >
   GEOS_HOST_DEVICE
@@ -757,6 +746,18 @@ public:
     return m_viewDetJ;
   }
 
+  /**
+   * @brief Check whether the shape function gradients have been pre-calculated for this element.
+   * @return true if the gradients are read from m_viewGradN, false if they are computed from the
+   *   nodal coordinates each time they are requested.
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  bool hasStoredGradN() const
+  {
+    return m_viewGradN.size( 0 ) > 0;
+  }
+
 
 protected:
   /// View to potentially hold pre-calculated shape function gradients.
@@ -808,7 +809,11 @@ real64 FiniteElementBase::getGradN( localIndex const k,
                                     real64 const (&X)[LEAF::maxSupportPoints][3],
                                     real64 (& gradN)[LEAF::maxSupportPoints][3] ) const
 {
-  GEOS_UNUSED_VAR( k );
+  if( hasStoredGradN() )
+  {
+    LvArray::tensorOps::copy< LEAF::maxSupportPoints, 3 >( gradN, m_viewGradN[ k ][ q ] );
+    return m_viewDetJ( k, q );
+  }
   return LEAF::calcGradN( q, X, gradN );
 }
 
@@ -821,7 +826,11 @@ real64 FiniteElementBase::getGradN( localIndex const k,
                                     typename LEAF::StackVariables const & stack,
                                     real64 ( & gradN )[LEAF::maxSupportPoints][3] ) const
 {
-  GEOS_UNUSED_VAR( k );
+  if( hasStoredGradN() )
+  {
+    LvArray::tensorOps::copy< LEAF::maxSupportPoints, 3 >( gradN, m_viewGradN[ k ][ q ] );
+    return m_viewDetJ( k, q );
+  }
   return LEAF::calcGradN( q, X, stack, gradN );
 }
 
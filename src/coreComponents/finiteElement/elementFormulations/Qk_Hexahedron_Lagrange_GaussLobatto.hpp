@@ -573,6 +573,118 @@ public:
                                   real64 const (&X)[numNodes][3],
                                   FUNC && stiffnessVal );
 
+  /**
+   * @brief Computes the gradient of a nodal field with respect to the parent coordinates
+   *   at a quadrature point. Since the Gauss-Lobatto quadrature points coincide with the
+   *   support points, only the 3*num1dNodes support points aligned with @p q contribute.
+   * @param q The quadrature point index
+   * @param var Array containing the values of the field at the support points.
+   * @param grad Array to store the gradient with respect to the parent coordinates.
+   */
+  GEOS_HOST_DEVICE
+  static void
+  parentGradient( int const q,
+                  real64 const (&var)[numNodes],
+                  real64 ( &grad )[3] );
+
+  /**
+   * @brief Computes the gradient of a nodal vector field with respect to the parent coordinates
+   *   at a quadrature point, i.e. grad[i][j] = d var_i / d xi_j. Called on the support point
+   *   coordinates, this is the Jacobian transformation at @p q.
+   * @param q The quadrature point index
+   * @param var Array containing the values of the field at the support points.
+   * @param grad Array to store the gradient with respect to the parent coordinates.
+   */
+  GEOS_HOST_DEVICE
+  static void
+  parentGradient( int const q,
+                  real64 const (&var)[numNodes][3],
+                  real64 ( &grad )[3][3] );
+
+  /**
+   * @brief Adds the contraction of the parent shape function gradients at a quadrature point
+   *   with a flux, i.e. y_a += dN_a/dxi_j * flux_j. This is the transpose of parentGradient.
+   * @param q The quadrature point index
+   * @param flux The flux in the parent coordinates.
+   * @param y Array of support point values to add into.
+   */
+  GEOS_HOST_DEVICE
+  static void
+  plusParentGradientTranspose( int const q,
+                               real64 const (&flux)[3],
+                               real64 ( &y )[numNodes] );
+
+  /**
+   * @brief Adds the contraction of the parent shape function gradients at a quadrature point
+   *   with a tensor flux, i.e. y_a_i += dN_a/dxi_j * flux_ij.
+   * @param q The quadrature point index
+   * @param flux The flux in the parent coordinates.
+   * @param y Array of support point values to add into.
+   */
+  GEOS_HOST_DEVICE
+  static void
+  plusParentGradientTranspose( int const q,
+                               real64 const (&flux)[3][3],
+                               real64 ( &y )[numNodes][3] );
+
+  /**
+   * @brief Sum-factorized counterpart of computeStiffnessTerm: adds the contribution of the
+   *   quadrature point @p q to y = R var, without forming the entries of R. The cost is
+   *   O(num1dNodes) per quadrature point instead of O(num1dNodes^2).
+   * @param q The quadrature point index
+   * @param X Array containing the coordinates of the support points.
+   * @param var Array containing the values of the field at the support points.
+   * @param y Array of support point values to add into.
+   */
+  GEOS_HOST_DEVICE
+  static void
+  applyStiffnessTerm( int const q,
+                      real64 const (&X)[numNodes][3],
+                      real64 const (&var)[numNodes],
+                      real64 ( &y )[numNodes] );
+
+  /**
+   * @brief Sum-factorized application of a system of stiffness operators acting on scalar fields,
+   *   such as the pseudo-acoustic anisotropic operators: adds the contribution of the quadrature
+   *   point @p q to y_f += R_f(var), where the physical flux of each equation is computed by a
+   *   callback from the physical gradients of all the fields.
+   * @tparam NUM_FIELDS The number of coupled scalar fields.
+   * @param q The quadrature point index
+   * @param X Array containing the coordinates of the support points.
+   * @param var Array containing the values of the fields at the support points.
+   * @param y Array of support point values to add into, for each equation.
+   * @param flux Callback function accepting the gradients grad[f][j] = d var_f / d x_j and
+   *   returning the flux of each equation in its second argument.
+   */
+  template< int NUM_FIELDS, typename FUNC >
+  GEOS_HOST_DEVICE
+  static void
+  applyCoupledStiffnessTerm( int const q,
+                             real64 const (&X)[numNodes][3],
+                             real64 const (&var)[NUM_FIELDS][numNodes],
+                             real64 ( &y )[NUM_FIELDS][numNodes],
+                             FUNC && flux );
+
+  /**
+   * @brief Sum-factorized counterpart of computeFirstOrderStiffnessTerm: adds the contribution
+   *   of the quadrature point @p q to y = R var for a vector field, where the stress is computed
+   *   by a callback from the physical gradient of the field.
+   * @param q The quadrature point index
+   * @param X Array containing the coordinates of the support points.
+   * @param var Array containing the values of the field at the support points.
+   * @param y Array of support point values to add into.
+   * @param stress Callback function accepting the gradient grad[i][j] = d var_i / d x_j and
+   *   returning the stress tensor in its second argument.
+   */
+  template< typename FUNC >
+  GEOS_HOST_DEVICE
+  static void
+  applyFirstOrderStiffnessTerm( int const q,
+                                real64 const (&X)[numNodes][3],
+                                real64 const (&var)[numNodes][3],
+                                real64 ( &y )[numNodes][3],
+                                FUNC && stress );
+
 
   /**
    * @brief Apply a Jacobian transformation matrix from the parent space to the
@@ -1420,6 +1532,220 @@ computeFirstOrderStiffnessTerm( int q,
 
 }
 
+template< typename GL_BASIS >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+parentGradient( int const q,
+                real64 const (&var)[numNodes],
+                real64 (& grad)[3] )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  grad[0] = 0.0;
+  grad[1] = 0.0;
+  grad[2] = 0.0;
+  for( int i=0; i<num1dNodes; i++ )
+  {
+    grad[0] += GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*var[ GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc ) ];
+    grad[1] += GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) )*var[ GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc ) ];
+    grad[2] += GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qc ) )*var[ GL_BASIS::TensorProduct3D::linearIndex( qa, qb, i ) ];
+  }
+}
+
+template< typename GL_BASIS >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+parentGradient( int const q,
+                real64 const (&var)[numNodes][3],
+                real64 (& grad)[3][3] )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  LvArray::tensorOps::fill< 3, 3 >( grad, 0.0 );
+  for( int i=0; i<num1dNodes; i++ )
+  {
+    real64 const * const GEOS_RESTRICT varA = var[ GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc ) ];
+    real64 const * const GEOS_RESTRICT varB = var[ GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc ) ];
+    real64 const * const GEOS_RESTRICT varC = var[ GL_BASIS::TensorProduct3D::linearIndex( qa, qb, i ) ];
+    real64 const ga = GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) );
+    real64 const gb = GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) );
+    real64 const gc = GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qc ) );
+    for( int c=0; c<3; c++ )
+    {
+      grad[c][0] += ga*varA[c];
+      grad[c][1] += gb*varB[c];
+      grad[c][2] += gc*varC[c];
+    }
+  }
+}
+
+template< typename GL_BASIS >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+plusParentGradientTranspose( int const q,
+                             real64 const (&flux)[3],
+                             real64 (& y)[numNodes] )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  for( int i=0; i<num1dNodes; i++ )
+  {
+    y[ GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc ) ] += GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*flux[0];
+    y[ GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc ) ] += GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) )*flux[1];
+    y[ GL_BASIS::TensorProduct3D::linearIndex( qa, qb, i ) ] += GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qc ) )*flux[2];
+  }
+}
+
+template< typename GL_BASIS >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+plusParentGradientTranspose( int const q,
+                             real64 const (&flux)[3][3],
+                             real64 (& y)[numNodes][3] )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  for( int i=0; i<num1dNodes; i++ )
+  {
+    real64 * const GEOS_RESTRICT yA = y[ GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc ) ];
+    real64 * const GEOS_RESTRICT yB = y[ GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc ) ];
+    real64 * const GEOS_RESTRICT yC = y[ GL_BASIS::TensorProduct3D::linearIndex( qa, qb, i ) ];
+    real64 const ga = GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) );
+    real64 const gb = GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) );
+    real64 const gc = GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qc ) );
+    for( int c=0; c<3; c++ )
+    {
+      yA[c] += ga*flux[c][0];
+      yB[c] += gb*flux[c][1];
+      yC[c] += gc*flux[c][2];
+    }
+  }
+}
+
+template< typename GL_BASIS >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+applyStiffnessTerm( int const q,
+                    real64 const (&X)[numNodes][3],
+                    real64 const (&var)[numNodes],
+                    real64 (& y)[numNodes] )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  real64 const w = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc );
+
+  real64 J[3][3] = {{0}};
+  parentGradient( q, X, J );
+  real64 const detJ = LvArray::tensorOps::determinant< 3 >( J );
+
+  // compute detJ*J^{-1}J^{-T}, as in computeBMatrix
+  real64 B[6];
+  B[0] = (J[0][0]*J[0][0]+J[1][0]*J[1][0]+J[2][0]*J[2][0])/detJ;
+  B[1] = (J[0][1]*J[0][1]+J[1][1]*J[1][1]+J[2][1]*J[2][1])/detJ;
+  B[2] = (J[0][2]*J[0][2]+J[1][2]*J[1][2]+J[2][2]*J[2][2])/detJ;
+  B[3] = (J[0][1]*J[0][2]+J[1][1]*J[1][2]+J[2][1]*J[2][2])/detJ;
+  B[4] = (J[0][0]*J[0][2]+J[1][0]*J[1][2]+J[2][0]*J[2][2])/detJ;
+  B[5] = (J[0][0]*J[0][1]+J[1][0]*J[1][1]+J[2][0]*J[2][1])/detJ;
+  LvArray::tensorOps::symInvert< 3 >( B );
+
+  real64 grad[3];
+  parentGradient( q, var, grad );
+
+  real64 const flux[3] = { w*( B[0]*grad[0] + B[5]*grad[1] + B[4]*grad[2] ),
+                           w*( B[5]*grad[0] + B[1]*grad[1] + B[3]*grad[2] ),
+                           w*( B[4]*grad[0] + B[3]*grad[1] + B[2]*grad[2] ) };
+
+  plusParentGradientTranspose( q, flux, y );
+}
+
+template< typename GL_BASIS >
+template< int NUM_FIELDS, typename FUNC >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+applyCoupledStiffnessTerm( int const q,
+                           real64 const (&X)[numNodes][3],
+                           real64 const (&var)[NUM_FIELDS][numNodes],
+                           real64 (& y)[NUM_FIELDS][numNodes],
+                           FUNC && flux )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  real64 J[3][3] = {{0}};
+  parentGradient( q, X, J );
+  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+  real64 const detJxW = detJ*GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc );
+
+  // physical gradients, J now holds the inverse Jacobian d xi / d x
+  real64 grad[NUM_FIELDS][3];
+  for( int f = 0; f < NUM_FIELDS; ++f )
+  {
+    real64 parentGrad[3];
+    parentGradient( q, var[f], parentGrad );
+    LvArray::tensorOps::Ri_eq_AjiBj< 3, 3 >( grad[f], J, parentGrad );
+  }
+
+  real64 physicalFlux[NUM_FIELDS][3] = {{0}};
+  flux( grad, physicalFlux );
+
+  // flux in the parent coordinates: detJxW * J^{-1} * flux
+  for( int f = 0; f < NUM_FIELDS; ++f )
+  {
+    real64 parentFlux[3];
+    LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( parentFlux, J, physicalFlux[f] );
+    LvArray::tensorOps::scale< 3 >( parentFlux, detJxW );
+    plusParentGradientTranspose( q, parentFlux, y[f] );
+  }
+}
+
+template< typename GL_BASIS >
+template< typename FUNC >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
+applyFirstOrderStiffnessTerm( int const q,
+                              real64 const (&X)[numNodes][3],
+                              real64 const (&var)[numNodes][3],
+                              real64 (& y)[numNodes][3],
+                              FUNC && stress )
+{
+  int qa, qb, qc;
+  GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+  real64 J[3][3] = {{0}};
+  parentGradient( q, X, J );
+  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+  real64 const detJxW = detJ*GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc );
+
+  real64 parentGrad[3][3];
+  parentGradient( q, var, parentGrad );
+
+  // physical gradient, J now holds the inverse Jacobian d xi / d x
+  real64 grad[3][3];
+  LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( grad, parentGrad, J );
+
+  real64 sigma[3][3] = {{0}};
+  stress( grad, sigma );
+
+  // flux in the parent coordinates: detJxW * sigma * J^{-T}
+  real64 flux[3][3];
+  LvArray::tensorOps::Rij_eq_AikBjk< 3, 3, 3 >( flux, sigma, J );
+  LvArray::tensorOps::scale< 3, 3 >( flux, detJxW );
+
+  plusParentGradientTranspose( q, flux, y );
+}
+
 template< typename GL_BASIS >
 template< typename FUNC >
 GEOS_HOST_DEVICE
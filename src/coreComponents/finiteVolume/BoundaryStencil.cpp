@@ -66,6 +66,39 @@ void BoundaryStencil::addVectors( real64 const & transMultiplier,
   LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[size], cellToFaceVec );
 }
 
+void BoundaryStencil::resize( localIndex const size )
+{
+  m_elementRegionIndices.resize( size, 2 );
+  m_elementSubRegionIndices.resize( size, 2 );
+  m_elementIndices.resize( size, 2 );
+  m_weights.resize( size, 2 );
+
+  m_faceNormal.resize( size );
+  m_cellToFaceVec.resize( size );
+  m_weightMultiplier.resize( size );
+}
+
+void BoundaryStencil::set( localIndex const iconn,
+                           localIndex const (&elementRegionIndices)[2],
+                           localIndex const (&elementSubRegionIndices)[2],
+                           localIndex const (&elementIndices)[2],
+                           real64 const (&weights)[2],
+                           real64 const transMultiplier,
+                           real64 const (&faceNormal)[3],
+                           real64 const (&cellToFaceVec)[3] )
+{
+  for( localIndex a = 0; a < 2; ++a )
+  {
+    m_elementRegionIndices( iconn, a ) = elementRegionIndices[a];
+    m_elementSubRegionIndices( iconn, a ) = elementSubRegionIndices[a];
+    m_elementIndices( iconn, a ) = elementIndices[a];
+    m_weights( iconn, a ) = weights[a];
+  }
+  m_weightMultiplier[iconn] = transMultiplier;
+  LvArray::tensorOps::copy< 3 >( m_faceNormal[iconn], faceNormal );
+  LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[iconn], cellToFaceVec );
+}
+
 BoundaryStencil::KernelWrapper BoundaryStencil::createKernelWrapper() const
 {
   return { m_elementRegionIndices,
@@ -66,6 +66,15 @@ public:
                        real64 & weight,
                        real64 ( &dWeight_dCoef )[3] ) const;
 
+  /**
+   * @brief Refresh the transmissibility multiplier of a connection from the face field.
+   * @param[in] iconn connection index
+   * @param[in] faceTransMultiplier the transmissibility multiplier of the faces
+   */
+  GEOS_HOST_DEVICE
+  void updateTransMultiplier( localIndex const iconn,
+                              arrayView1d< real64 const > const & faceTransMultiplier ) const;
+
   /**
    * @brief Give the number of stencil entries.
    * @return The number of stencil entries
@@ -147,6 +156,34 @@ public:
                    real64 const (&faceNormal)[3],
                    real64 const (&cellToFaceVec)[3] );
 
+  /**
+   * @brief Resize the stencil, so that its entries can be filled concurrently with set().
+   * @param[in] size the new number of stencil entries
+   */
+  void resize( localIndex const size );
+
+  /**
+   * @brief Fill a stencil entry allocated by resize().
+   * @param[in] iconn the index of the stencil entry
+   * @param[in] elementRegionIndices the region indices of the element and face (-1 for the face)
+   * @param[in] elementSubRegionIndices the subregion indices of the element and face (-1 for the face)
+   * @param[in] elementIndices the indices of the element and face
+   * @param[in] weights the weights of the element and face
+   * @param[in] transMultiplier the transmissibility multiplier
+   * @param[in] faceNormal the normal to the face
+   * @param[in] cellToFaceVec distance vector between the cell center and the face
+   * @note Distinct entries can be filled concurrently, the connector map is filled separately
+   *   with setConnectorIndex().
+   */
+  void set( localIndex const iconn,
+            localIndex const (&elementRegionIndices)[2],
+            localIndex const (&elementSubRegionIndices)[2],
+            localIndex const (&elementIndices)[2],
+            real64 const (&weights)[2],
+            real64 const transMultiplier,
+            real64 const (&faceNormal)[3],
+            real64 const (&cellToFaceVec)[3] );
+
   /**
    * @copydoc StencilBase<BoundaryStencilTraits,BoundaryStencil>::size
    */
@@ -183,6 +220,19 @@ private:
 
 };
 
+GEOS_HOST_DEVICE
+inline void
+BoundaryStencilWrapper::
+  updateTransMultiplier( localIndex const iconn,
+                         arrayView1d< real64 const > const & faceTransMultiplier ) const
+{
+  // aquifer stencils do not store the multipliers
+  if( iconn < m_weightMultiplier.size() )
+  {
+    m_weightMultiplier[iconn] = faceTransMultiplier[m_elementIndices[iconn][BoundaryStencil::Order::FACE]];
+  }
+}
+
 GEOS_HOST_DEVICE
 inline void
 BoundaryStencilWrapper::
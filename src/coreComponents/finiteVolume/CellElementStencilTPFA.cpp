@@ -37,6 +37,7 @@ void CellElementStencilTPFA::reserve( localIndex const size )
   m_cellToFaceVec.reserve( 6 * size );
   m_transMultiplier.reserve( size );
   m_geometricStabilizationCoef.reserve( size );
+  m_faceIndices.reserve( size );
 }
 
 void CellElementStencilTPFA::add( localIndex const numPts,
@@ -63,6 +64,7 @@ void CellElementStencilTPFA::add( localIndex const numPts,
     m_weights( oldSize, a ) = weights[a];
   }
   m_connectorIndices[connectorIndex] = oldSize;
+  m_faceIndices.emplace_back( connectorIndex );
 }
 
 void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
@@ -87,6 +89,45 @@ void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
   }
 }
 
+void CellElementStencilTPFA::resize( localIndex const size )
+{
+  m_elementRegionIndices.resize( size, 2 );
+  m_elementSubRegionIndices.resize( size, 2 );
+  m_elementIndices.resize( size, 2 );
+  m_weights.resize( size, 2 );
+
+  m_faceNormal.resize( size );
+  m_cellToFaceVec.resize( size );
+  m_transMultiplier.resize( size );
+  m_geometricStabilizationCoef.resize( size );
+  m_faceIndices.resize( size );
+}
+
+void CellElementStencilTPFA::set( localIndex const iconn,
+                                  localIndex const (&elementRegionIndices)[2],
+                                  localIndex const (&elementSubRegionIndices)[2],
+                                  localIndex const (&elementIndices)[2],
+                                  real64 const (&weights)[2],
+                                  real64 const transMultiplier,
+                                  real64 const geometricStabilizationCoef,
+                                  real64 const (&faceNormal)[3],
+                                  real64 const (&cellToFaceVec)[2][3],
+                                  localIndex const faceIndex )
+{
+  for( localIndex a = 0; a < 2; ++a )
+  {
+    m_elementRegionIndices( iconn, a ) = elementRegionIndices[a];
+    m_elementSubRegionIndices( iconn, a ) = elementSubRegionIndices[a];
+    m_elementIndices( iconn, a ) = elementIndices[a];
+    m_weights( iconn, a ) = weights[a];
+    LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[iconn][a], cellToFaceVec[a] );
+  }
+  m_transMultiplier[iconn] = transMultiplier;
+  m_geometricStabilizationCoef[iconn] = geometricStabilizationCoef;
+  LvArray::tensorOps::copy< 3 >( m_faceNormal[iconn], faceNormal );
+  m_faceIndices[iconn] = faceIndex;
+}
+
 CellElementStencilTPFA::KernelWrapper
 CellElementStencilTPFA::createKernelWrapper() const
 {
@@ -97,7 +138,8 @@ CellElementStencilTPFA::createKernelWrapper() const
            m_faceNormal,
            m_cellToFaceVec,
            m_transMultiplier,
-           m_geometricStabilizationCoef };
+           m_geometricStabilizationCoef,
+           m_faceIndices };
 }
 
 CellElementStencilTPFAWrapper::
@@ -108,7 +150,8 @@ CellElementStencilTPFAWrapper::
                                  arrayView2d< real64 > const & faceNormal,
                                  arrayView3d< real64 > const & cellToFaceVec,
                                  arrayView1d< real64 > const & transMultiplier,
-                                 arrayView1d< real64 > const & geometricStabilizationCoef )
+                                 arrayView1d< real64 > const & geometricStabilizationCoef,
+                                 arrayView1d< localIndex const > const & faceIndices )
   : StencilWrapperBase( elementRegionIndices,
                         elementSubRegionIndices,
                         elementIndices,
@@ -116,7 +159,8 @@ CellElementStencilTPFAWrapper::
   m_faceNormal( faceNormal ),
   m_cellToFaceVec( cellToFaceVec ),
   m_transMultiplier( transMultiplier ),
-  m_geometricStabilizationCoef( geometricStabilizationCoef )
+  m_geometricStabilizationCoef( geometricStabilizationCoef ),
+  m_faceIndices( faceIndices )
 {}
 
 } /* namespace geos */
@@ -45,6 +45,7 @@ public:
    * @param cellToFaceVec Cell center to face center vector
    * @param transMultiplier Transmissibility multiplier
    * @param geometricStabilizationCoef Geometric coefficient for pressure jump stabilization
+   * @param faceIndices Index of the face of each connection
    */
   CellElementStencilTPFAWrapper( IndexContainerType const & elementRegionIndices,
                                  IndexContainerType const & elementSubRegionIndices,
@@ -53,7 +54,8 @@ public:
                                  arrayView2d< real64 > const & faceNormal,
                                  arrayView3d< real64 > const & cellToFaceVec,
                                  arrayView1d< real64 > const & transMultiplier,
-                                 arrayView1d< real64 > const & geometricStabilizationCoef );
+                                 arrayView1d< real64 > const & geometricStabilizationCoef,
+                                 arrayView1d< localIndex const > const & faceIndices );
 
   /**
    * @brief Compute weights and derivatives w.r.t to one variable.
@@ -83,6 +85,17 @@ public:
                        real64 ( &weight )[1][2],
                        real64 ( &dWeight_dVar )[1][2] ) const;
 
+  /**
+   * @brief Refresh the transmissibility multiplier of a connection from the face field.
+   * @param[in] iconn connection index
+   * @param[in] faceTransMultiplier the transmissibility multiplier of the faces
+   * @note The permeability is combined with the geometric weights in computeWeights, so only the multiplier is stored.
+   */
+  GEOS_HOST_DEVICE
+  void updateTransMultiplier( localIndex const iconn,
+                              arrayView1d< real64 const > const & faceTransMultiplier ) const
+  { m_transMultiplier[iconn] = faceTransMultiplier[m_faceIndices[iconn]]; }
+
   /**
    * @brief Compute the stabilization weights
    * @param[in] iconn connection index
@@ -133,6 +146,7 @@ private:
   arrayView3d< real64 > m_cellToFaceVec;
   arrayView1d< real64 > m_transMultiplier;
   arrayView1d< real64 > m_geometricStabilizationCoef;
+  arrayView1d< localIndex const > m_faceIndices;
 };
 
 
@@ -169,6 +183,38 @@ public:
                    real64 const (&faceNormal)[3],
                    real64 const (&cellToFaceVec)[2][3] );
 
+  /**
+   * @brief Resize the stencil, so that its entries can be filled concurrently with set().
+   * @param[in] size the new number of stencil entries
+   */
+  void resize( localIndex const size );
+
+  /**
+   * @brief Fill a stencil entry allocated by resize().
+   * @param[in] iconn the index of the stencil entry
+   * @param[in] elementRegionIndices the element region indices of the two cells
+   * @param[in] elementSubRegionIndices the element subregion indices of the two cells
+   * @param[in] elementIndices the element indices of the two cells
+   * @param[in] weights the half-transmissibilities of the two cells
+   * @param[in] transMultiplier the transmissibility multiplier
+   * @param[in] geometricStabilizationCoef the stabilization weight
+   * @param[in] faceNormal the normal to the face
+   * @param[in] cellToFaceVec distance vectors between the cell centers and the face
+   * @param[in] faceIndex the index of the face
+   * @note Distinct entries can be filled concurrently, the connector map is filled separately
+   *   with setConnectorIndex().
+   */
+  void set( localIndex const iconn,
+            localIndex const (&elementRegionIndices)[2],
+            localIndex const (&elementSubRegionIndices)[2],
+            localIndex const (&elementIndices)[2],
+            real64 const (&weights)[2],
+            real64 const transMultiplier,
+            real64 const geometricStabilizationCoef,
+            real64 const (&faceNormal)[3],
+            real64 const (&cellToFaceVec)[2][3],
+            localIndex const faceIndex );
+
   /**
    * @brief Return the stencil size.
    * @return the stencil size
@@ -208,6 +254,7 @@ private:
   array3d< real64 > m_cellToFaceVec;
   array1d< real64 > m_transMultiplier;
   array1d< real64 > m_geometricStabilizationCoef;
+  array1d< localIndex > m_faceIndices;
 };
 
 GEOS_HOST_DEVICE
@@ -44,6 +44,12 @@ HybridMimeticDiscretization::HybridMimeticDiscretization( string const & name,
   registerWrapper( viewKeyStruct::innerProductTypeString(), &m_innerProductType ).
     setInputFlag( InputFlags::REQUIRED ).
     setDescription( "Type of inner product used in the hybrid FVM solver" );
+
+  registerWrapper( viewKeyStruct::useSinglePrecisionTransMatrixString(), &m_useSinglePrecisionTransMatrix ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to store the transmissibility matrices precomputed in the elements in single precision, "
+                    "which halves their memory footprint" );
 }
 
 void HybridMimeticDiscretization::initializePostInitialConditionsPreSubGroups()
@@ -74,8 +74,17 @@ public:
 
     /// @return The key for the inner product
     static constexpr char const * innerProductString() { return "innerProduct"; }
+
+    /// @return The key for the flag to store the transmissibility matrices in single precision
+    static constexpr char const * useSinglePrecisionTransMatrixString() { return "useSinglePrecisionTransMatrix"; }
   };
 
+  /**
+   * @brief Get the flag to store the precomputed transmissibility matrices in single precision
+   * @return the flag to store the precomputed transmissibility matrices in single precision
+   */
+  integer useSinglePrecisionTransMatrix() const { return m_useSinglePrecisionTransMatrix; }
+
 protected:
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
@@ -85,6 +94,9 @@ private:
   /// type of of inner product used in the hybrid FVM solver
   string m_innerProductType;
 
+  /// flag to store the precomputed transmissibility matrices in single precision
+  integer m_useSinglePrecisionTransMatrix;
+
   /**
    * @brief Factory method to instantiate a type of mimetic inner product.
    * @return A unique_ptr< MimeticInnerProductBase > which contains the new
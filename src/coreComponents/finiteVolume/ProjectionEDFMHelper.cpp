@@ -9,6 +9,22 @@
 namespace geos
 {
 
+namespace
+{
+
+/// A non-neighboring pEDFM connection between a fracture element and the cell across a face of its host cell
+struct NonNeighboringConnection
+{
+  /// the face crossed by the connection
+  localIndex faceIdx;
+  /// the cell across the face
+  CellDescriptor neighborCell;
+  /// the half geometric transmissibilities of the cell and of the fracture element
+  real64 weights[2];
+};
+
+} // namespace
+
 ProjectionEDFMHelper::ProjectionEDFMHelper( MeshLevel const & mesh,
                                             CellElementStencilTPFA & cellStencil,
                                             EmbeddedSurfaceToCellStencil & edfmStencil,
@@ -35,7 +51,10 @@ void ProjectionEDFMHelper::addNonNeighboringConnections() const
   arrayView1d< integer const > const ghostRank = fractureSubRegion.ghostRank();
   OrderedVariableToManyElementRelation const & surfaceElementsToCells = fractureSubRegion.getToCellRelation();
 
-  for( localIndex fracElement = 0; fracElement < fractureSubRegion.size(); fracElement++ )
+  // The faces and weights of the connections only read the mesh, so they are computed in parallel over the
+  // fracture elements; the connections are then added to the stencils in the order of the fracture elements.
+  std::vector< std::vector< NonNeighboringConnection > > connections( fractureSubRegion.size() );
+  forAll< parallelHostPolicy >( fractureSubRegion.size(), [&] ( localIndex const fracElement )
   {
     if( ghostRank[fracElement] < 0 )
     {
@@ -53,16 +72,22 @@ void ProjectionEDFMHelper::addNonNeighboringConnections() const
       std::vector< localIndex > const faces = selectFaces( cellSubRegion.faceList(), cellID, fracElement, fractureSubRegion );
       for( localIndex const faceIdx : faces )
       {
-        CellDescriptor neighborCell = otherCell( faceIdx, cellID );
-        real64 fractureMatrixWeights[2];
-        computeFractureMatrixWeights( neighborCell, fracElement, fractureSubRegion, faceIdx, fractureMatrixWeights );
+        NonNeighboringConnection connection{ faceIdx, otherCell( faceIdx, cellID ), { 0.0, 0.0 } };
+        computeFractureMatrixWeights( connection.neighborCell, fracElement, fractureSubRegion, faceIdx, connection.weights );
+        connections[fracElement].push_back( connection );
+      }
+    }
+  } );
 
-        addNonNeighboringConnection( fracElement, neighborCell, fractureMatrixWeights, fractureSubRegion );
+  for( localIndex fracElement = 0; fracElement < fractureSubRegion.size(); fracElement++ )
+  {
+    for( NonNeighboringConnection const & connection : connections[fracElement] )
+    {
+      addNonNeighboringConnection( fracElement, connection.neighborCell, connection.weights, fractureSubRegion );
 
-        // zero out matrix-matrix connections that are replaced by fracture-matrix connections
-        // I assume that the m-m connection index is equal to the face id
-        m_cellStencil.zero( faceIdx );
-      }
+      // zero out matrix-matrix connections that are replaced by fracture-matrix connections
+      // I assume that the m-m connection index is equal to the face id
+      m_cellStencil.zero( connection.faceIdx );
     }
   }
 }
@@ -203,6 +203,15 @@ public:
    */
   virtual localIndex size() const = 0;
 
+  /**
+   * @brief Map a connector to a stencil entry that was filled without going through add().
+   * @param[in] connectorIndex The index of the connector element that the stencil acts across
+   * @param[in] iconn The index of the stencil entry
+   * @note The map is not thread-safe, this must be called serially.
+   */
+  void setConnectorIndex( localIndex const connectorIndex, localIndex const iconn )
+  { m_connectorIndices[connectorIndex] = iconn; }
+
   /**
    * @brief Set the name used in data movement logging callbacks.
    * @param name the name prefix for the stencil's data arrays
@@ -264,6 +273,7 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::reserve( localIndex const size )
   m_elementSubRegionIndices.reserve( size * 2 );
   m_elementIndices.reserve( size * 2 );
   m_weights.reserve( size * 2 );
+  m_connectorIndices.reserve( size );
 }
 
 
@@ -132,46 +132,80 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
     regionFilter.insert( ei );
   } );
 
-  stencil.reserve( faceManager.size() );
-
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
 
-  forAll< serialPolicy >( faceManager.size(), [=, &stencil]( localIndex const kf )
+  // Applies the face filters and computes the face geometry, returns true if the face is a connection
+  auto const computeFaceGeometry = [=, &regionFilter]( localIndex const kf,
+                                                       real64 ( & faceCenter )[3],
+                                                       real64 ( & faceNormal )[3],
+                                                       real64 & faceArea )
   {
     // Filter out boundary faces
     if( elemList[kf][0] < 0 || elemList[kf][1] < 0 || isZero( transMultiplier[kf] ) )
     {
-      return;
+      return false;
     }
 
     // Filter out faces where neither cell is locally owned
     if( elemGhostRank[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] >= 0 &&
         elemGhostRank[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] >= 0 )
     {
-      return;
+      return false;
     }
 
     // Filter out faces where either of two cells is outside of target regions
     if( !( regionFilter.contains( elemRegionList[kf][0] ) && regionFilter.contains( elemRegionList[kf][1] ) ) )
     {
-      return;
+      return false;
     }
 
-    real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
-    real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenter, faceNormal, areaTolerance );
+    if( !computationalGeometry::centroid_axisAlignedRectangle( faceToNodes[kf], X, faceCenter, faceNormal, faceArea ) )
+    {
+      faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenter, faceNormal, areaTolerance );
+    }
 
-    if( faceArea < areaTolerance )
+    return faceArea >= areaTolerance;
+  };
+
+  // First pass: flag the faces that become connections, and scan the flags into the connection offsets
+  localIndex const numFaces = faceManager.size();
+  array1d< localIndex > isConnection( numFaces );
+  arrayView1d< localIndex > const isConnectionView = isConnection.toView();
+  forAll< parallelHostPolicy >( numFaces, [=]( localIndex const kf )
+  {
+    real64 faceCenter[ 3 ], faceNormal[ 3 ];
+    real64 faceArea;
+    isConnectionView[kf] = computeFaceGeometry( kf, faceCenter, faceNormal, faceArea ) ? 1 : 0;
+  } );
+
+  array1d< localIndex > connectionOffsets( numFaces + 1 );
+  connectionOffsets[0] = 0;
+  RAJA::inclusive_scan< parallelHostPolicy >( RAJA::make_span( isConnection.data(), numFaces ),
+                                              RAJA::make_span( connectionOffsets.data() + 1, numFaces ) );
+  arrayView1d< localIndex const > const connectionOffsetsView = connectionOffsets.toViewConst();
+
+  // Second pass: the stencil is allocated once and each connection is filled at its offset
+  localIndex const firstConnection = stencil.size();
+  stencil.resize( firstConnection + connectionOffsets[numFaces] );
+
+  forAll< parallelHostPolicy >( numFaces, [=, &stencil]( localIndex const kf )
+  {
+    if( connectionOffsetsView[kf+1] == connectionOffsetsView[kf] )
     {
       return;
     }
 
-    stackArray1d< localIndex, 2 > regionIndex( 2 );
-    stackArray1d< localIndex, 2 > subRegionIndex( 2 );
-    stackArray1d< localIndex, 2 > elementIndex( 2 );
-    stackArray1d< real64, 2 > stencilWeights( 2 );
-    stackArray1d< real64, 2 > stencilStabilizationWeights( 2 );
-    stackArray1d< globalIndex, 2 > stencilCellsGlobalIndex( 2 );
+    real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
+    real64 faceArea;
+    computeFaceGeometry( kf, faceCenter, faceNormal, faceArea );
+
+    localIndex regionIndex[2];
+    localIndex subRegionIndex[2];
+    localIndex elementIndex[2];
+    real64 stencilWeights[2];
+    real64 stencilStabilizationWeights[2];
+    globalIndex stencilCellsGlobalIndex[2];
 
     for( localIndex ke = 0; ke < 2; ++ke )
     {
@@ -203,21 +237,32 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       std::swap( subRegionIndex[0], subRegionIndex[1] );
       std::swap( elementIndex[0], elementIndex[1] );
       std::swap( stencilWeights[0], stencilWeights[1] );
-      std::swap( stencilStabilizationWeights[0], stencilStabilizationWeights[1] );
       std::swap( cellToFaceVec[0][0], cellToFaceVec[1][0] );
       std::swap( cellToFaceVec[0][1], cellToFaceVec[1][1] );
       std::swap( cellToFaceVec[0][2], cellToFaceVec[1][2] );
     }
 
-    stencil.add( 2,
-                 regionIndex.data(),
-                 subRegionIndex.data(),
-                 elementIndex.data(),
-                 stencilWeights.data(),
+    stencil.set( firstConnection + connectionOffsetsView[kf],
+                 regionIndex,
+                 subRegionIndex,
+                 elementIndex,
+                 stencilWeights,
+                 transMultiplier[kf],
+                 sumStabilizationWeight,
+                 faceNormal,
+                 cellToFaceVec,
                  kf );
-
-    stencil.addVectors( transMultiplier[kf], sumStabilizationWeight, faceNormal, cellToFaceVec );
   } );
+
+  // The connector map is not thread-safe, it is filled serially once the connections are in place
+  stencil.reserve( stencil.size() );
+  for( localIndex kf = 0; kf < numFaces; ++kf )
+  {
+    if( connectionOffsets[kf+1] > connectionOffsets[kf] )
+    {
+      stencil.setConnectorIndex( kf, firstConnection + connectionOffsets[kf] );
+    }
+  }
 }
 
 void TwoPointFluxApproximation::registerFractureStencil( Group & stencilGroup ) const
@@ -1008,18 +1053,51 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
 
   constexpr localIndex numPts = BoundaryStencil::maxNumPointsInFlux;
 
-  stackArray1d< localIndex, numPts > stencilRegionIndices( numPts );
-  stackArray1d< localIndex, numPts > stencilSubRegionIndices( numPts );
-  stackArray1d< localIndex, numPts > stencilElemOrFaceIndices( numPts );
-  stackArray1d< real64, numPts > stencilWeights( numPts );
-
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
 
-  // loop over faces and calculate faceArea, faceNormal and faceCenter
-  stencil.reserve( faceSet.size() );
-  for( localIndex kf : faceSet )
+  // Returns true if the element ke of face kf is connected to the boundary by this rank
+  auto const isConnection = [=, &regionFilter]( localIndex const kf, localIndex const ke )
   {
+    localIndex const er  = elemRegionList[kf][ke];
+    localIndex const esr = elemSubRegionList[kf][ke];
+    localIndex const ei  = elemList[kf][ke];
+
+    // Filter out elements not locally present, not in target regions, or ghosted - to be handled by the owning rank
+    return er >= 0 && regionFilter.contains( er ) && elemGhostRank[er][esr][ei] < 0;
+  };
+
+  // First pass: count the connections of each face, and scan the counts into the connection offsets
+  localIndex const numFaces = faceSet.size();
+  array1d< localIndex > numConnections( numFaces );
+  arrayView1d< localIndex > const numConnectionsView = numConnections.toView();
+  forAll< parallelHostPolicy >( numFaces, [=]( localIndex const i )
+  {
+    for( localIndex ke = 0; ke < numPts; ++ke )
+    {
+      numConnectionsView[i] += isConnection( faceSet[i], ke ) ? 1 : 0;
+    }
+  } );
+
+  array1d< localIndex > connectionOffsets( numFaces + 1 );
+  connectionOffsets[0] = 0;
+  RAJA::inclusive_scan< parallelHostPolicy >( RAJA::make_span( numConnections.data(), numFaces ),
+                                              RAJA::make_span( connectionOffsets.data() + 1, numFaces ) );
+  arrayView1d< localIndex const > const connectionOffsetsView = connectionOffsets.toViewConst();
+
+  // Second pass: the stencil is allocated once and the connections are filled at their offsets
+  localIndex const firstConnection = stencil.size();
+  stencil.resize( firstConnection + connectionOffsets[numFaces] );
+
+  forAll< parallelHostPolicy >( numFaces, [=, &stencil]( localIndex const i )
+  {
+    localIndex iconn = firstConnection + connectionOffsetsView[i];
+    if( connectionOffsetsView[i+1] == connectionOffsetsView[i] )
+    {
+      return;
+    }
+
+    localIndex const kf = faceSet[i];
     real64 faceCenter[ 3 ];
     real64 faceNormal[ 3 ];
     real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf],
@@ -1030,27 +1108,14 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
 
     for( localIndex ke = 0; ke < numPts; ++ke )
     {
-      localIndex const er  = elemRegionList[kf][ke];
-      localIndex const esr = elemSubRegionList[kf][ke];
-      localIndex const ei  = elemList[kf][ke];
-
-      // Filter out elements not locally present
-      if( er < 0 )
+      if( !isConnection( kf, ke ) )
       {
         continue;
       }
 
-      // Filter out elements not in target regions
-      if( !regionFilter.contains( er ) )
-      {
-        continue;
-      }
-
-      // Filter out ghosted elements - to be handled by the owning rank
-      if( elemGhostRank[er][esr][ei] >= 0 )
-      {
-        continue;
-      }
+      localIndex const er  = elemRegionList[kf][ke];
+      localIndex const esr = elemSubRegionList[kf][ke];
+      localIndex const ei  = elemList[kf][ke];
 
       real64 cellToFaceVec[ 3 ];
       LvArray::tensorOps::copy< 3 >( cellToFaceVec, faceCenter );
@@ -1064,6 +1129,11 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
       real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec );
       real64 const faceWeight = faceArea / c2fDistance;
 
+      localIndex stencilRegionIndices[numPts];
+      localIndex stencilSubRegionIndices[numPts];
+      localIndex stencilElemOrFaceIndices[numPts];
+      real64 stencilWeights[numPts];
+
       stencilRegionIndices[BoundaryStencil::Order::ELEM] = er;
       stencilSubRegionIndices[BoundaryStencil::Order::ELEM] = esr;
       stencilElemOrFaceIndices[BoundaryStencil::Order::ELEM] = ei;
@@ -1074,14 +1144,25 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
       stencilElemOrFaceIndices[BoundaryStencil::Order::FACE] = kf;
       stencilWeights[BoundaryStencil::Order::FACE] = -faceWeight;
 
-      stencil.add( stencilRegionIndices.size(),
-                   stencilRegionIndices.data(),
-                   stencilSubRegionIndices.data(),
-                   stencilElemOrFaceIndices.data(),
-                   stencilWeights.data(),
-                   kf );
+      stencil.set( iconn++,
+                   stencilRegionIndices,
+                   stencilSubRegionIndices,
+                   stencilElemOrFaceIndices,
+                   stencilWeights,
+                   transMultiplier[kf],
+                   faceNormal,
+                   cellToFaceVec );
+    }
+  } );
 
-      stencil.addVectors( transMultiplier[kf], faceNormal, cellToFaceVec );
+  // The connector map is not thread-safe, it is filled serially once the connections are in place
+  stencil.reserve( stencil.size() );
+  for( localIndex i = 0; i < numFaces; ++i )
+  {
+    if( connectionOffsets[i+1] > connectionOffsets[i] )
+    {
+      // as before, a face connected to two elements maps to its last connection
+      stencil.setConnectorIndex( faceSet[i], firstConnection + connectionOffsets[i+1] - 1 );
     }
   }
 }
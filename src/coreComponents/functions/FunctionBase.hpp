@@ -148,6 +148,23 @@ protected:
                   SortedArrayView< localIndex const > const & set,
                   arrayView1d< real64 > const & result ) const;
 
+  /**
+   * @brief Method to apply a device-callable kernel wrapper to a set of objects
+   * @tparam POLICY the RAJA execution policy
+   * @tparam KERNEL_WRAPPER type of the kernel wrapper, providing a compute( real64 const * input ) method
+   * @param group a pointer to the object holding the function arguments
+   * @param time current time
+   * @param set the subset of nodes to apply the function to
+   * @param result an array to hold the results of the function
+   * @param kernelWrapper the kernel wrapper evaluating the function
+   */
+  template< typename POLICY, typename KERNEL_WRAPPER >
+  void evaluateKernelT( dataRepository::Group const & group,
+                        real64 const time,
+                        SortedArrayView< localIndex const > const & set,
+                        arrayView1d< real64 > const & result,
+                        KERNEL_WRAPPER const & kernelWrapper ) const;
+
   virtual void postProcessInput() override { initializeFunction(); }
 
 };
@@ -217,6 +234,80 @@ void FunctionBase::evaluateT( dataRepository::Group const & group,
     result[i] = static_cast< LEAF const * >( this )->evaluate( input );
   } );
 }
+
+template< typename POLICY, typename KERNEL_WRAPPER >
+void FunctionBase::evaluateKernelT( dataRepository::Group const & group,
+                                    real64 const time,
+                                    SortedArrayView< localIndex const > const & set,
+                                    arrayView1d< real64 > const & result,
+                                    KERNEL_WRAPPER const & kernelWrapper ) const
+{
+  // the time is captured by value, since a pointer to it would not be valid on device
+  real64 const * inputPtrs[MAX_VARS]{};
+  bool isTime[MAX_VARS]{};
+  localIndex varSize[MAX_VARS]{};
+  localIndex varStride[MAX_VARS][2]{};
+
+  integer const numVars = LvArray::integerConversion< integer >( m_inputVarNames.size() );
+  localIndex totalVarSize = 0;
+  for( integer varIndex = 0; varIndex < numVars; ++varIndex )
+  {
+    string const & varName = m_inputVarNames[varIndex];
+
+    if( varName == "time" )
+    {
+      isTime[varIndex] = true;
+      varSize[varIndex] = 1;
+    }
+    else
+    {
+      dataRepository::WrapperBase const & wrapper = group.getWrapperBase( varName );
+      varSize[varIndex] = wrapper.numArrayComp();
+
+      using Types = types::ListofTypeList< types::ArrayTypes< types::TypeList< real64 >, types::DimsUpTo< 2 > > >;
+      types::dispatch( Types{}, [&]( auto tupleOfTypes )
+      {
+        using ArrayType = camp::first< decltype( tupleOfTypes ) >;
+        auto const view = dataRepository::Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
+        view.move( parallelDeviceMemorySpace, false );
+        for( int dim = 0; dim < ArrayType::NDIM; ++dim )
+        {
+          varStride[varIndex][dim] = view.strides()[dim];
+        }
+        inputPtrs[varIndex] = view.data();
+      }, wrapper );
+    }
+    totalVarSize += varSize[varIndex];
+  }
+
+  // Make sure the inputs do not exceed the maximum length
+  GEOS_ERROR_IF_GT_MSG( totalVarSize, MAX_VARS,
+                        getDataContext() << ": Function input size exceeded" );
+
+  // Make sure the result / set size match
+  GEOS_ERROR_IF_NE_MSG( result.size(), set.size(),
+                        getDataContext() << ": To apply a function to a set, the size of the result and set must match" );
+
+  forAll< POLICY >( set.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const index = set[i];
+    real64 input[MAX_VARS]{};
+    int offset = 0;
+    for( integer varIndex = 0; varIndex < numVars; ++varIndex )
+    {
+      if( isTime[varIndex] )
+      {
+        input[offset++] = time;
+        continue;
+      }
+      for( localIndex compIndex = 0; compIndex < varSize[varIndex]; ++compIndex )
+      {
+        input[offset++] = inputPtrs[varIndex][index * varStride[varIndex][0] + compIndex * varStride[varIndex][1]];
+      }
+    }
+    result[i] = kernelWrapper.compute( input );
+  } );
+}
 } /* namespace geos */
 
 #endif /* GEOS_FUNCTIONS_FUNCTIONBASE_HPP_ */
@@ -19,7 +19,6 @@
 #include "MultivariableTableFunction.hpp"
 
 #include "common/DataTypes.hpp"
-#include <algorithm>
 
 namespace geos
 {
@@ -128,32 +127,6 @@ void MultivariableTableFunction::setTableValues( real64_array values )
 {
   m_pointData = std::move( values );
 }
-void MultivariableTableFunction::getHypercubePoints( globalIndex const hypercubeIndex, globalIndex_array & hypercubePoints ) const
-{
-  auto remainder = hypercubeIndex;
-  auto pwr = m_numVerts;
-
-  for( auto j = 0; j < m_numVerts; ++j )
-  {
-    hypercubePoints[j] = 0;
-  }
-
-  for( auto i = 0; i < m_numDims; ++i )
-  {
-
-    integer const axis_idx = remainder / m_axisHypercubeMults[i];
-    remainder = remainder % m_axisHypercubeMults[i];
-
-    pwr /= 2;
-
-    for( auto j = 0; j < m_numVerts; ++j )
-    {
-      auto zero_or_one = (j / pwr) % 2;
-      hypercubePoints[j] += (axis_idx + zero_or_one) * m_axisPointMults[i];
-    }
-  }
-}
-
 
 void MultivariableTableFunction::initializeFunction()
 {
@@ -217,21 +190,41 @@ void MultivariableTableFunction::initializeFunction()
 
   // initialize hypercube data storage
   m_hypercubeData.resize( numTableHypercubes * m_numVerts * m_numOps );
-  globalIndex_array points( m_numVerts );
+
+  integer const numDims = m_numDims;
+  integer const numOps = m_numOps;
+  integer const numVerts = m_numVerts;
+  arrayView1d< globalIndex const > const axisPointMults = m_axisPointMults.toViewConst();
+  arrayView1d< globalIndex const > const axisHypercubeMults = m_axisHypercubeMults.toViewConst();
+  arrayView1d< real64 const > const pointData = m_pointData.toViewConst();
+  arrayView1d< real64 > const hypercubeData = m_hypercubeData.toView();
 
   // fill each hypercube directly on the device with corresponding data from m_pointData
-  for( auto i = 0; i < numTableHypercubes; i++ )
+  forAll< parallelDevicePolicy<> >( numTableHypercubes, [=] GEOS_HOST_DEVICE ( globalIndex const i )
   {
-    getHypercubePoints( i, points );
-
-    for( auto j = 0; j < m_numVerts; ++j )
+    // find the index of the first vertex of the hypercube (the one with the smallest coordinates)
+    globalIndex remainder = i;
+    globalIndex firstPoint = 0;
+    for( integer dim = 0; dim < numDims; ++dim )
     {
-      std::copy( m_pointData.begin() + points[j] * m_numOps,
-                 m_pointData.begin() + (points[j] + 1) * m_numOps,
-                 m_hypercubeData.begin() + m_numOps * (i * m_numVerts + j));
+      firstPoint += ( remainder / axisHypercubeMults[dim] ) * axisPointMults[dim];
+      remainder = remainder % axisHypercubeMults[dim];
     }
-  }
 
+    // vertex j is shifted by one point along the axes corresponding to its set bits, the first axis being the highest bit
+    for( integer j = 0; j < numVerts; ++j )
+    {
+      globalIndex point = firstPoint;
+      for( integer dim = 0; dim < numDims; ++dim )
+      {
+        point += ( ( j >> ( numDims - 1 - dim ) ) & 1 ) * axisPointMults[dim];
+      }
+      for( integer op = 0; op < numOps; ++op )
+      {
+        hypercubeData[numOps * ( i * numVerts + j ) + op] = pointData[point * numOps + op];
+      }
+    }
+  } );
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, MultivariableTableFunction, string const &, Group * const )
@@ -178,14 +178,6 @@ public:
 
 private:
 
-  /**
-   * @brief Get indexes of all vertices of a hypercube
-   *
-   * @param[in] hypercubeIndex index of a hypercube
-   * @param[out] hypercubePoints array of indexes of hypercube vertexes
-   */
-  void getHypercubePoints( globalIndex const hypercubeIndex, globalIndex_array & hypercubePoints ) const;
-
   /// Number of table dimensions (inputs)
   integer m_numDims;
 
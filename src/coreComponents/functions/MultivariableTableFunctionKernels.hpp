@@ -106,10 +106,8 @@ public:
       hypercubeIndex += axisIndex * m_axisHypercubeMults[i];
     }
 
-    interpolatePoint( coordinates,
-                      getHypercubeData( hypercubeIndex ),
-                      &axisLows[0],
-                      &m_axisStepInvs[0],
+    interpolatePoint( getHypercubeData( hypercubeIndex ),
+                      &axisMults[0],
                       values );
   }
 
@@ -220,48 +218,48 @@ protected:
   /**
    * @brief interpolate all operators values at a given point
    * The algoritm is based on http://dx.doi.org/10.1090/S0025-5718-1988-0917826-0
+   * All the loops have compile-time bounds and are unrolled
    *
-   * @param[in] axisCoordinates coordinates of a point
    * @param[in] hypercubeData data of target hypercube
-   * @param[in] axisLows array of left coordinates of target axis intervals
-   * @param[in] axisStepInvs array of inversions of axis steps
+   * @param[in] axisMults array of weights of right coordinates of target axis intervals
    * @param[out] values interpolated operator values
    */
-  template< typename IN_ARRAY, typename OUT_ARRAY >
+  template< typename OUT_ARRAY >
   GEOS_HOST_DEVICE
   inline
   void
-  interpolatePoint( IN_ARRAY const & axisCoordinates,
-                    real64 const * const hypercubeData,
-                    real64 const * const axisLows,
-                    real64 const * const axisStepInvs,
+  interpolatePoint( real64 const * const hypercubeData,
+                    real64 const * const axisMults,
                     OUT_ARRAY && values ) const
   {
-    integer pwr = numVerts / 2;   // distance between high and low values
     real64 workspace[numVerts][numOps];
 
     // copy operator values for all vertices
+    PRAGMA_UNROLL
     for( integer i = 0; i < numVerts; ++i )
     {
+      PRAGMA_UNROLL
       for( integer j = 0; j < numOps; ++j )
       {
         workspace[i][j] = hypercubeData[i * numOps + j];
       }
     }
 
+    PRAGMA_UNROLL
     for( integer i = 0; i < numDims; ++i )
     {
-
+      integer const pwr = numVerts >> ( i + 1 );   // distance between high and low values
+      PRAGMA_UNROLL
       for( integer j = 0; j < pwr; ++j )
       {
+        PRAGMA_UNROLL
         for( integer op = 0; op < numOps; ++op )
         {
-          // update own derivative
-          workspace[j][op] += (axisCoordinates[i] - axisLows[i]) * (workspace[j + pwr][op] - workspace[j][op]) * axisStepInvs[i];
+          workspace[j][op] += axisMults[i] * (workspace[j + pwr][op] - workspace[j][op]);
         }
       }
-      pwr /= 2;
     }
+    PRAGMA_UNROLL
     for( integer op = 0; op < numOps; ++op )
     {
       values[op] = workspace[0][op];
@@ -272,6 +270,7 @@ protected:
   /**
    * @brief interpolate all operators values and derivatives at a given point
    * The algoritm is based on http://dx.doi.org/10.1090/S0025-5718-1988-0917826-0
+   * All the loops have compile-time bounds and are unrolled
    *
    * @param[in] axisCoordinates coordinates of a point
    * @param[in] hypercubeData data of target hypercube
@@ -293,23 +292,27 @@ protected:
                                    OUT_ARRAY && values,
                                    OUT_2D_ARRAY && derivatives ) const
   {
-    integer pwr = numVerts / 2;   // distance between high and low values
     real64 workspace[2 * numVerts - 1][numOps];
 
     // copy operator values for all vertices
+    PRAGMA_UNROLL
     for( integer i = 0; i < numVerts; ++i )
     {
+      PRAGMA_UNROLL
       for( integer j = 0; j < numOps; ++j )
       {
         workspace[i][j] = hypercubeData[i * numOps + j];
       }
     }
 
+    PRAGMA_UNROLL
     for( integer i = 0; i < numDims; ++i )
     {
-
+      integer const pwr = numVerts >> ( i + 1 );   // distance between high and low values
+      PRAGMA_UNROLL
       for( integer j = 0; j < pwr; ++j )
       {
+        PRAGMA_UNROLL
         for( integer op = 0; op < numOps; ++op )
         {
           // update own derivative
@@ -317,8 +320,10 @@ protected:
         }
 
         // update all dependent derivatives
+        PRAGMA_UNROLL
         for( integer k = 0; k < i; k++ )
         {
+          PRAGMA_UNROLL
           for( integer op = 0; op < numOps; ++op )
           {
             workspace[2 * numVerts - (numVerts >> k) + j][op] = workspace[2 * numVerts - (numVerts >> k) + j][op] + axisMults[i] *
@@ -327,17 +332,19 @@ protected:
           }
         }
 
+        PRAGMA_UNROLL
         for( integer op = 0; op < numOps; ++op )
         {
           // interpolate value
           workspace[j][op] = workspace[j][op] + (axisCoordinates[i] - axisLows[i]) * workspace[2 * numVerts - (numVerts >> i) + j][op];
         }
       }
-      pwr /= 2;
     }
+    PRAGMA_UNROLL
     for( integer op = 0; op < numOps; ++op )
     {
       values[op] = workspace[0][op];
+      PRAGMA_UNROLL
       for( integer i = 0; i < numDims; ++i )
       {
         derivatives[op][i] = workspace[2 * numVerts - (numVerts >> i)][op];
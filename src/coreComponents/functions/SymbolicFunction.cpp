@@ -19,6 +19,11 @@
 #include "SymbolicFunction.hpp"
 #include "common/DataTypes.hpp"
 
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <map>
+
 namespace geos
 {
 
@@ -105,6 +110,316 @@ private:
 
 };
 
+namespace
+{
+
+/**
+ * @class ByteCodeCompiler
+ * @brief Recursive descent compiler of the arithmetic subset of the mathpresso syntax
+ *        into the instructions of symbolicFunctionKernels::SymbolicFunctionKernel
+ *
+ * The precedences follow mathpresso. Unsupported expressions (e.g. the ternary operator)
+ * are reported as failures, and the function is then only evaluated with the host JIT code.
+ */
+class ByteCodeCompiler
+{
+public:
+
+  using OpCode = symbolicFunctionKernels::OpCode;
+
+  ByteCodeCompiler( string const & expression,
+                    string_array const & variableNames ):
+    m_expression( expression ),
+    m_variableNames( variableNames ),
+    m_position( 0 ),
+    m_depth( 0 ),
+    m_maxDepth( 0 ),
+    m_success( true )
+  {}
+
+  /**
+   * @brief Compile the expression
+   * @return true if the whole expression has been compiled
+   */
+  bool compile()
+  {
+    parseOr();
+    skipSpaces();
+    return m_success && m_position == m_expression.size() &&
+           m_maxDepth <= symbolicFunctionKernels::SymbolicFunctionKernel::maxStackSize;
+  }
+
+  std::vector< integer > const & code() const { return m_code; }
+
+  std::vector< real64 > const & constants() const { return m_constants; }
+
+private:
+
+  void skipSpaces()
+  {
+    while( m_position < m_expression.size() && std::isspace( static_cast< unsigned char >( m_expression[m_position] ) ) )
+    {
+      ++m_position;
+    }
+  }
+
+  bool accept( char const * const token )
+  {
+    skipSpaces();
+    std::size_t const length = std::strlen( token );
+    if( m_expression.compare( m_position, length, token ) != 0 )
+    {
+      return false;
+    }
+    // do not split the two-character operators
+    if( length == 1 && m_position + 1 < m_expression.size() && m_expression[m_position + 1] == '=' &&
+        ( token[0] == '<' || token[0] == '>' || token[0] == '!' || token[0] == '=' ) )
+    {
+      return false;
+    }
+    m_position += length;
+    return true;
+  }
+
+  void emit( OpCode const op, integer const numPopped, integer const numPushed )
+  {
+    m_code.push_back( static_cast< integer >( op ) );
+    m_depth += numPushed - numPopped;
+    m_maxDepth = std::max( m_maxDepth, m_depth );
+  }
+
+  void emitOperand( OpCode const op, integer const operand )
+  {
+    emit( op, 0, 1 );
+    m_code.push_back( operand );
+  }
+
+  void emitConstant( real64 const value )
+  {
+    emitOperand( OpCode::CONSTANT, LvArray::integerConversion< integer >( m_constants.size() ) );
+    m_constants.push_back( value );
+  }
+
+  void parseOr()
+  {
+    parseAnd();
+    while( m_success && accept( "||" ) )
+    {
+      parseAnd();
+      emit( OpCode::OR, 2, 1 );
+    }
+  }
+
+  void parseAnd()
+  {
+    parseEquality();
+    while( m_success && accept( "&&" ) )
+    {
+      parseEquality();
+      emit( OpCode::AND, 2, 1 );
+    }
+  }
+
+  void parseEquality()
+  {
+    parseComparison();
+    while( m_success )
+    {
+      OpCode op;
+      if( accept( "==" ) ) { op = OpCode::EQUAL; }
+      else if( accept( "!=" ) ) { op = OpCode::NOT_EQUAL; }
+      else { break; }
+      parseComparison();
+      emit( op, 2, 1 );
+    }
+  }
+
+  void parseComparison()
+  {
+    parseAdditive();
+    while( m_success )
+    {
+      OpCode op;
+      if( accept( "<=" ) ) { op = OpCode::LESS_EQUAL; }
+      else if( accept( ">=" ) ) { op = OpCode::GREATER_EQUAL; }
+      else if( accept( "<" ) ) { op = OpCode::LESS; }
+      else if( accept( ">" ) ) { op = OpCode::GREATER; }
+      else { break; }
+      parseAdditive();
+      emit( op, 2, 1 );
+    }
+  }
+
+  void parseAdditive()
+  {
+    parseMultiplicative();
+    while( m_success )
+    {
+      OpCode op;
+      if( accept( "+" ) ) { op = OpCode::ADD; }
+      else if( accept( "-" ) ) { op = OpCode::SUBTRACT; }
+      else { break; }
+      parseMultiplicative();
+      emit( op, 2, 1 );
+    }
+  }
+
+  void parseMultiplicative()
+  {
+    parseUnary();
+    while( m_success )
+    {
+      OpCode op;
+      if( accept( "*" ) ) { op = OpCode::MULTIPLY; }
+      else if( accept( "/" ) ) { op = OpCode::DIVIDE; }
+      else if( accept( "%" ) ) { op = OpCode::MODULO; }
+      else { break; }
+      parseUnary();
+      emit( op, 2, 1 );
+    }
+  }
+
+  void parseUnary()
+  {
+    if( accept( "-" ) )
+    {
+      parseUnary();
+      emit( OpCode::NEGATE, 1, 1 );
+    }
+    else if( accept( "!" ) )
+    {
+      parseUnary();
+      emit( OpCode::NOT, 1, 1 );
+    }
+    else if( accept( "+" ) )
+    {
+      parseUnary();
+    }
+    else
+    {
+      parsePrimary();
+    }
+  }
+
+  void parsePrimary()
+  {
+    skipSpaces();
+    if( m_position >= m_expression.size() )
+    {
+      m_success = false;
+      return;
+    }
+
+    char const c = m_expression[m_position];
+    if( std::isdigit( static_cast< unsigned char >( c ) ) || c == '.' )
+    {
+      char * end = nullptr;
+      real64 const value = std::strtod( m_expression.c_str() + m_position, &end );
+      m_position = end - m_expression.c_str();
+      emitConstant( value );
+    }
+    else if( std::isalpha( static_cast< unsigned char >( c ) ) || c == '_' )
+    {
+      std::size_t const start = m_position;
+      while( m_position < m_expression.size() &&
+             ( std::isalnum( static_cast< unsigned char >( m_expression[m_position] ) ) || m_expression[m_position] == '_' ) )
+      {
+        ++m_position;
+      }
+      string const name = m_expression.substr( start, m_position - start );
+      if( accept( "(" ) )
+      {
+        parseFunctionCall( name );
+      }
+      else
+      {
+        parseIdentifier( name );
+      }
+    }
+    else if( accept( "(" ) )
+    {
+      parseOr();
+      m_success = m_success && accept( ")" );
+    }
+    else
+    {
+      m_success = false;
+    }
+  }
+
+  void parseIdentifier( string const & name )
+  {
+    for( localIndex i = 0; i < m_variableNames.size(); ++i )
+    {
+      if( m_variableNames[i] == name )
+      {
+        emitOperand( OpCode::VARIABLE, LvArray::integerConversion< integer >( i ) );
+        return;
+      }
+    }
+    if( name == "PI" )
+    {
+      emitConstant( M_PI );
+    }
+    else if( name == "E" )
+    {
+      emitConstant( M_E );
+    }
+    else
+    {
+      m_success = false;
+    }
+  }
+
+  void parseFunctionCall( string const & name )
+  {
+    static std::map< string, OpCode > const unaryFunctions =
+    {
+      { "abs", OpCode::ABS }, { "sqrt", OpCode::SQRT }, { "exp", OpCode::EXP }, { "log", OpCode::LOG },
+      { "log2", OpCode::LOG2 }, { "log10", OpCode::LOG10 }, { "sin", OpCode::SIN }, { "cos", OpCode::COS },
+      { "tan", OpCode::TAN }, { "asin", OpCode::ASIN }, { "acos", OpCode::ACOS }, { "atan", OpCode::ATAN },
+      { "sinh", OpCode::SINH }, { "cosh", OpCode::COSH }, { "tanh", OpCode::TANH }, { "floor", OpCode::FLOOR },
+      { "ceil", OpCode::CEIL }, { "round", OpCode::ROUND }, { "trunc", OpCode::TRUNC }
+    };
+    static std::map< string, OpCode > const binaryFunctions =
+    {
+      { "min", OpCode::MIN }, { "max", OpCode::MAX }, { "pow", OpCode::POW },
+      { "atan2", OpCode::ATAN2 }, { "hypot", OpCode::HYPOT }
+    };
+
+    auto const unary = unaryFunctions.find( name );
+    auto const binary = binaryFunctions.find( name );
+    if( unary != unaryFunctions.end() )
+    {
+      parseOr();
+      emit( unary->second, 1, 1 );
+    }
+    else if( binary != binaryFunctions.end() )
+    {
+      parseOr();
+      m_success = m_success && accept( "," );
+      parseOr();
+      emit( binary->second, 2, 1 );
+    }
+    else
+    {
+      m_success = false;
+    }
+    m_success = m_success && accept( ")" );
+  }
+
+  string const & m_expression;
+  string_array const & m_variableNames;
+  std::size_t m_position;
+  integer m_depth;
+  integer m_maxDepth;
+  bool m_success;
+  std::vector< integer > m_code;
+  std::vector< real64 > m_constants;
+};
+
+}
+
 void SymbolicFunction::initializeFunction()
 {
   // Register variables
@@ -122,6 +437,27 @@ void SymbolicFunction::initializeFunction()
     return parserExpression.compile( parserContext, m_expression.c_str(), mathpresso::kNoOptions, &outputLog );
   }();
   GEOS_ERROR_IF( err != mathpresso::kErrorOk, "MathPresso JIT Compiler Error" );
+
+  // compile the expression for the device as well, the JIT code being only callable on host
+  ByteCodeCompiler compiler( m_expression, m_variableNames );
+  m_byteCode.clear();
+  m_byteCodeConstants.clear();
+  if( compiler.compile() )
+  {
+    for( integer const instruction : compiler.code() )
+    {
+      m_byteCode.emplace_back( instruction );
+    }
+    for( real64 const constant : compiler.constants() )
+    {
+      m_byteCodeConstants.emplace_back( constant );
+    }
+  }
+  else
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "{} '{}': the expression cannot be evaluated on device, it will be evaluated on host",
+                               catalogName(), getName() ) );
+  }
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, SymbolicFunction, string const &, Group * const )
@@ -15,6 +15,7 @@
 #define GEOS_FUNCTIONS_SYMBOLICFUNCTION_HPP_
 
 #include "FunctionBase.hpp"
+#include "functions/SymbolicFunctionKernels.hpp"
 
 #include <mathpresso/mathpresso.h>
 
@@ -61,6 +62,13 @@ public:
                         SortedArrayView< localIndex const > const & set,
                         arrayView1d< real64 > const & result ) const override final
   {
+#if defined( GEOS_USE_DEVICE )
+    if( isDeviceCapable() )
+    {
+      FunctionBase::evaluateKernelT< parallelDevicePolicy<> >( group, time, set, result, createKernelWrapper() );
+      return;
+    }
+#endif
     FunctionBase::evaluateT< SymbolicFunction >( group, time, set, result );
   }
 
@@ -87,6 +95,23 @@ public:
    */
   void setSymbolicExpression( string expression ) { m_expression = std::move( expression ); }
 
+  /**
+   * @brief Create an instance of the kernel wrapper evaluating the expression on device
+   * @return the kernel wrapper
+   * @note The wrapper is only valid if the expression could be compiled for the device,
+   *       which is the case if isDeviceCapable() returns true
+   */
+  symbolicFunctionKernels::SymbolicFunctionKernel createKernelWrapper() const
+  {
+    return symbolicFunctionKernels::SymbolicFunctionKernel( m_byteCode.toViewConst(), m_byteCodeConstants.toViewConst() );
+  }
+
+  /**
+   * @brief Check whether the expression can be evaluated on device
+   * @return true if the expression has been compiled to the device instructions
+   */
+  bool isDeviceCapable() const { return !m_byteCode.empty(); }
+
 
 
 private:
@@ -99,6 +124,12 @@ private:
 
   /// Symbolic expression
   string m_expression;
+
+  /// Instructions evaluating the expression on device (empty if the expression is not supported)
+  array1d< integer > m_byteCode;
+
+  /// Constants referenced by the device instructions
+  array1d< real64 > m_byteCodeConstants;
 };
 
 
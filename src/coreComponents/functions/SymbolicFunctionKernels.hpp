@@ -0,0 +1,226 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SymbolicFunctionKernels.hpp
+ */
+
+#ifndef GEOS_FUNCTIONS_SYMBOLICFUNCTIONKERNELS_HPP_
+#define GEOS_FUNCTIONS_SYMBOLICFUNCTIONKERNELS_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+namespace geos
+{
+
+namespace symbolicFunctionKernels
+{
+
+/**
+ * @enum OpCode
+ * @brief Instructions of the stack machine evaluating a compiled symbolic expression
+ *
+ * The CONSTANT and VARIABLE instructions are followed in the code by the index of
+ * the constant or of the variable. All the other instructions operate on the top of the stack.
+ */
+enum class OpCode : integer
+{
+  CONSTANT,      ///< push a constant
+  VARIABLE,      ///< push an input variable
+  ADD,           ///< a + b
+  SUBTRACT,      ///< a - b
+  MULTIPLY,      ///< a * b
+  DIVIDE,        ///< a / b
+  MODULO,        ///< fmod( a, b )
+  NEGATE,        ///< -a
+  NOT,           ///< !a
+  LESS,          ///< a < b
+  LESS_EQUAL,    ///< a <= b
+  GREATER,       ///< a > b
+  GREATER_EQUAL, ///< a >= b
+  EQUAL,         ///< a == b
+  NOT_EQUAL,     ///< a != b
+  AND,           ///< a && b
+  OR,            ///< a || b
+  MIN,           ///< min( a, b )
+  MAX,           ///< max( a, b )
+  POW,           ///< pow( a, b )
+  ATAN2,         ///< atan2( a, b )
+  HYPOT,         ///< hypot( a, b )
+  ABS,           ///< abs( a )
+  SQRT,          ///< sqrt( a )
+  EXP,           ///< exp( a )
+  LOG,           ///< log( a )
+  LOG2,          ///< log2( a )
+  LOG10,         ///< log10( a )
+  SIN,           ///< sin( a )
+  COS,           ///< cos( a )
+  TAN,           ///< tan( a )
+  ASIN,          ///< asin( a )
+  ACOS,          ///< acos( a )
+  ATAN,          ///< atan( a )
+  SINH,          ///< sinh( a )
+  COSH,          ///< cosh( a )
+  TANH,          ///< tanh( a )
+  FLOOR,         ///< floor( a )
+  CEIL,          ///< ceil( a )
+  ROUND,         ///< round( a )
+  TRUNC          ///< trunc( a )
+};
+
+/**
+ * @class SymbolicFunctionKernel
+ * @brief Device-callable evaluation of a symbolic expression compiled to the instructions of a stack machine
+ */
+class SymbolicFunctionKernel
+{
+public:
+
+  /// Maximum depth of the evaluation stack, checked when the expression is compiled
+  static constexpr integer maxStackSize = 16;
+
+  /**
+   * @brief Constructor
+   * @param[in] code the instructions, in reverse polish order
+   * @param[in] constants the constants referenced by the instructions
+   */
+  SymbolicFunctionKernel( arrayView1d< integer const > const & code,
+                          arrayView1d< real64 const > const & constants ):
+    m_code( code ),
+    m_constants( constants )
+  {}
+
+  /**
+   * @brief Evaluate the expression
+   * @param[in] input the values of the variables, in the order of the variable names of the function
+   * @return the value of the expression
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 compute( real64 const * const input ) const
+  {
+    real64 stack[maxStackSize];
+    integer top = 0;
+    localIndex pc = 0;
+    while( pc < m_code.size() )
+    {
+      OpCode const op = static_cast< OpCode >( m_code[pc++] );
+      if( op == OpCode::CONSTANT )
+      {
+        stack[top++] = m_constants[m_code[pc++]];
+        continue;
+      }
+      if( op == OpCode::VARIABLE )
+      {
+        stack[top++] = input[m_code[pc++]];
+        continue;
+      }
+      if( op >= OpCode::ABS || op == OpCode::NEGATE || op == OpCode::NOT )
+      {
+        stack[top-1] = applyUnary( op, stack[top-1] );
+        continue;
+      }
+      --top;
+      stack[top-1] = applyBinary( op, stack[top-1], stack[top] );
+    }
+    return stack[0];
+  }
+
+private:
+
+  /**
+   * @brief Apply a unary instruction
+   * @param[in] op the instruction
+   * @param[in] a the operand
+   * @return the result
+   */
+  GEOS_HOST_DEVICE
+  static inline
+  real64 applyUnary( OpCode const op, real64 const a )
+  {
+    switch( op )
+    {
+      case OpCode::NEGATE: return -a;
+      case OpCode::NOT: return a == 0.0 ? 1.0 : 0.0;
+      case OpCode::ABS: return fabs( a );
+      case OpCode::SQRT: return sqrt( a );
+      case OpCode::EXP: return exp( a );
+      case OpCode::LOG: return log( a );
+      case OpCode::LOG2: return log2( a );
+      case OpCode::LOG10: return log10( a );
+      case OpCode::SIN: return sin( a );
+      case OpCode::COS: return cos( a );
+      case OpCode::TAN: return tan( a );
+      case OpCode::ASIN: return asin( a );
+      case OpCode::ACOS: return acos( a );
+      case OpCode::ATAN: return atan( a );
+      case OpCode::SINH: return sinh( a );
+      case OpCode::COSH: return cosh( a );
+      case OpCode::TANH: return tanh( a );
+      case OpCode::FLOOR: return floor( a );
+      case OpCode::CEIL: return ceil( a );
+      case OpCode::ROUND: return round( a );
+      case OpCode::TRUNC: return trunc( a );
+      default: return 0.0;
+    }
+  }
+
+  /**
+   * @brief Apply a binary instruction
+   * @param[in] op the instruction
+   * @param[in] a the first operand
+   * @param[in] b the second operand
+   * @return the result
+   */
+  GEOS_HOST_DEVICE
+  static inline
+  real64 applyBinary( OpCode const op, real64 const a, real64 const b )
+  {
+    switch( op )
+    {
+      case OpCode::ADD: return a + b;
+      case OpCode::SUBTRACT: return a - b;
+      case OpCode::MULTIPLY: return a * b;
+      case OpCode::DIVIDE: return a / b;
+      case OpCode::MODULO: return fmod( a, b );
+      case OpCode::LESS: return a < b ? 1.0 : 0.0;
+      case OpCode::LESS_EQUAL: return a <= b ? 1.0 : 0.0;
+      case OpCode::GREATER: return a > b ? 1.0 : 0.0;
+      case OpCode::GREATER_EQUAL: return a >= b ? 1.0 : 0.0;
+      case OpCode::EQUAL: return a == b ? 1.0 : 0.0;
+      case OpCode::NOT_EQUAL: return a != b ? 1.0 : 0.0;
+      case OpCode::AND: return ( a != 0.0 && b != 0.0 ) ? 1.0 : 0.0;
+      case OpCode::OR: return ( a != 0.0 || b != 0.0 ) ? 1.0 : 0.0;
+      case OpCode::MIN: return a < b ? a : b;
+      case OpCode::MAX: return a > b ? a : b;
+      case OpCode::POW: return pow( a, b );
+      case OpCode::ATAN2: return atan2( a, b );
+      case OpCode::HYPOT: return hypot( a, b );
+      default: return 0.0;
+    }
+  }
+
+  /// Instructions, in reverse polish order
+  arrayView1d< integer const > m_code;
+
+  /// Constants referenced by the instructions
+  arrayView1d< real64 const > m_constants;
+};
+
+} // namespace symbolicFunctionKernels
+
+} // namespace geos
+
+#endif // GEOS_FUNCTIONS_SYMBOLICFUNCTIONKERNELS_HPP_
@@ -17,10 +17,15 @@
  */
 
 #include "TableFunction.hpp"
+#include "FunctionManager.hpp"
 #include "codingUtilities/Parsing.hpp"
 #include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
 
 #include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <unordered_map>
 
 namespace geos
 {
@@ -31,6 +36,7 @@ TableFunction::TableFunction( const string & name,
                               Group * const parent ):
   FunctionBase( name, parent ),
   m_interpolationMethod( InterpolationType::Linear ),
+  m_voxelFileFormat( VoxelFileFormat::Text ),
   m_valueUnit( units::Unknown ),
   m_kernelWrapper( createKernelWrapper() )
 {
@@ -52,22 +58,115 @@ TableFunction::TableFunction( const string & name,
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "Voxel file name for ND Table" );
 
+  registerWrapper( viewKeyStruct::shareValuesOnNodeString(), &m_shareValuesOnNode ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to store the values read from the voxel file once per compute node, in memory shared by the ranks of the node, "
+                    "instead of once per rank. Only available in CPU builds." );
+
+  registerWrapper( viewKeyStruct::voxelFileFormatString(), &m_voxelFileFormat ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setApplyDefaultValue( m_voxelFileFormat ).
+    setDescription( "Format of the voxel file. Valid options:\n* " + EnumStrings< VoxelFileFormat >::concat( "\n* " ) + "\n"
+                    "A binary file holds the values as native doubles in Fortran order. It is mapped in memory, "
+                    "so that each rank only loads the parts of the file it reads. Only available in CPU builds." );
+
   registerWrapper( viewKeyStruct::interpolationString(), &m_interpolationMethod ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Interpolation method. Valid options:\n* " + EnumStrings< InterpolationType >::concat( "\n* " ) ).
     setApplyDefaultValue( m_interpolationMethod );
 }
 
-void TableFunction::readFile( string const & filename, array1d< real64 > & target )
+namespace
+{
+
+/**
+ * @struct ReusedFileValues
+ * @brief The values of a file read with reuseValues, along with the modification time of the file.
+ */
+struct ReusedFileValues
+{
+  /// The last modification time of the file when it was read
+  long long int modificationTime;
+  /// The values of the file
+  array1d< real64 > values;
+};
+
+/**
+ * @brief Get the values of the files read with reuseValues, shared by all the tables.
+ * @return the map from the file names to their values
+ */
+std::unordered_map< string, ReusedFileValues > & getReusedFileValues()
+{
+  static std::unordered_map< string, ReusedFileValues > fileValues;
+  return fileValues;
+}
+
+}
+
+array1d< real64 > TableFunction::parseFileOnFirstRank( string const & filename ) const
+{
+  // Only the first rank parses the file, so that large decks do not hit the file system from every rank.
+  array1d< real64 > values;
+  string errorMessage;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    auto const skipped = []( char const c ){ return std::isspace( c ) || c == ','; };
+    try
+    {
+      parseFile( filename, values, skipped );
+    }
+    catch( std::runtime_error const & e )
+    {
+      errorMessage = e.what();
+    }
+  }
+
+  MpiWrapper::broadcast( errorMessage );
+  GEOS_THROW_IF( !errorMessage.empty(),
+                 GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), errorMessage ),
+                 InputError );
+
+  return values;
+}
+
+void TableFunction::readFile( string const & filename, array1d< real64 > & target, bool const reuseValues )
 {
-  auto const skipped = []( char const c ){ return std::isspace( c ) || c == ','; };
-  try
+  std::unordered_map< string, ReusedFileValues > & reusedFileValues = getReusedFileValues();
+  long long int constexpr unknownTime = std::numeric_limits< long long int >::min();
+  long long int modificationTime = unknownTime;
+  if( reuseValues )
   {
-    parseFile( filename, target, skipped );
+    // The values are only reused if the file has not been modified since it was read.
+    if( MpiWrapper::commRank() == 0 )
+    {
+      std::error_code errorCode;
+      std::filesystem::file_time_type const time = std::filesystem::last_write_time( filename, errorCode );
+      modificationTime = errorCode ? unknownTime : static_cast< long long int >( time.time_since_epoch().count() );
+    }
+    MpiWrapper::broadcast( modificationTime );
+
+    auto const reused = reusedFileValues.find( filename );
+    if( modificationTime != unknownTime && reused != reusedFileValues.end() && reused->second.modificationTime == modificationTime )
+    {
+      target.insert( target.size(), reused->second.values.begin(), reused->second.values.end() );
+      return;
+    }
   }
-  catch( std::runtime_error const & e )
+
+  array1d< real64 > values = parseFileOnFirstRank( filename );
+
+  localIndex numValues = values.size();
+  MpiWrapper::broadcast( numValues );
+  values.resize( numValues );
+  MpiWrapper::bcast( values.data(), LvArray::integerConversion< int >( numValues ), 0, MPI_COMM_GEOSX );
+
+  target.insert( target.size(), values.begin(), values.end() );
+  if( reuseValues && modificationTime != unknownTime )
   {
-    GEOS_THROW( GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), e.what() ), InputError );
+    reusedFileValues[ filename ] = { modificationTime, std::move( values ) };
   }
 }
 
@@ -105,6 +204,25 @@ void TableFunction::setTableValues( real64_array values, units::Unit unit )
 
 void TableFunction::initializeFunction()
 {
+  GEOS_THROW_IF( m_shareValuesOnNode && m_voxelFile.empty(),
+                 GEOS_FMT( "{} {}: {} can only be used with a {}",
+                           catalogName(), getDataContext(), viewKeyStruct::shareValuesOnNodeString(), viewKeyStruct::voxelFileString() ),
+                 InputError );
+  GEOS_THROW_IF( m_shareValuesOnNode && m_voxelFileFormat == VoxelFileFormat::Binary,
+                 GEOS_FMT( "{} {}: {} cannot be used with a binary voxel file, whose pages are already shared by the ranks of the node",
+                           catalogName(), getDataContext(), viewKeyStruct::shareValuesOnNodeString() ),
+                 InputError );
+#if defined(GEOS_USE_DEVICE)
+  GEOS_THROW_IF( m_shareValuesOnNode,
+                 GEOS_FMT( "{} {}: {} is not available when the tables are evaluated on the device",
+                           catalogName(), getDataContext(), viewKeyStruct::shareValuesOnNodeString() ),
+                 InputError );
+  GEOS_THROW_IF( m_voxelFileFormat == VoxelFileFormat::Binary,
+                 GEOS_FMT( "{} {}: binary voxel files are not available when the tables are evaluated on the device",
+                           catalogName(), getDataContext() ),
+                 InputError );
+#endif
+
   // Read in data
   if( m_coordinates.size() > 0 )
   {
@@ -127,13 +245,36 @@ void TableFunction::initializeFunction()
     for( localIndex ii = 0; ii < m_coordinateFiles.size(); ++ii )
     {
       tmp.clear();
-      readFile( m_coordinateFiles[ii], tmp );
+      readFile( m_coordinateFiles[ii], tmp, true );
       m_coordinates.appendArray( tmp.begin(), tmp.end() );
       numValues *= tmp.size();
     }
     // ND Table
-    m_values.reserve( numValues );
-    readFile( m_voxelFile, m_values );
+    if( m_voxelFileFormat == VoxelFileFormat::Binary )
+    {
+      try
+      {
+        m_mappedVoxelFile.open( m_voxelFile );
+      }
+      catch( std::runtime_error const & e )
+      {
+        GEOS_THROW( GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), e.what() ), InputError );
+      }
+      GEOS_THROW_IF_NE_MSG( m_mappedVoxelFile.size(), numValues * sizeof( real64 ),
+                            GEOS_FMT( "{} {}: the size of the binary voxel file {} does not match the number of table coordinates",
+                                      catalogName(), getDataContext(), m_voxelFile ),
+                            InputError );
+    }
+    else if( m_shareValuesOnNode )
+    {
+      // the values are only held by the first rank while they are sent to the nodes
+      m_nodeSharedValues.allocate( parseFileOnFirstRank( m_voxelFile ).toViewConst() );
+    }
+    else
+    {
+      m_values.reserve( numValues );
+      readFile( m_voxelFile, m_values );
+    }
   }
 
   reInitializeFunction();
@@ -154,14 +295,49 @@ void TableFunction::reInitializeFunction()
                      InputError );
     }
   }
-  if( m_coordinates.size() > 0 && !m_values.empty() ) // coordinates and values have been set
+  localIndex numValues = m_values.size();
+  if( !m_nodeSharedValues.empty() )
   {
-    GEOS_THROW_IF_NE_MSG( increment, m_values.size(),
+    numValues = m_nodeSharedValues.size();
+  }
+  else if( !m_mappedVoxelFile.empty() )
+  {
+    numValues = LvArray::integerConversion< localIndex >( m_mappedVoxelFile.size() / sizeof( real64 ) );
+  }
+  if( m_coordinates.size() > 0 && numValues > 0 ) // coordinates and values have been set
+  {
+    GEOS_THROW_IF_NE_MSG( increment, numValues,
                           GEOS_FMT( "{} {}: number of values does not match total number of table coordinates",
                                     catalogName(), getDataContext() ),
                           InputError );
   }
 
+  // Detect the uniformly discretized axes, on which the interval search is replaced by a direct index computation
+  for( localIndex ii = 0; ii < maxDimensions; ++ii )
+  {
+    m_inverseSpacing[ii] = 0.0;
+    if( ii >= m_coordinates.size() || m_coordinates.sizeOfArray( ii ) < 2 )
+    {
+      continue;
+    }
+    arraySlice1d< real64 const > const coords = m_coordinates[ii];
+    localIndex const numCoords = coords.size();
+    real64 const spacing = ( coords[numCoords - 1] - coords[0] ) / ( numCoords - 1 );
+    bool isUniform = true;
+    for( localIndex j = 1; j < numCoords - 1; ++j )
+    {
+      if( std::abs( coords[j] - ( coords[0] + j * spacing ) ) > 1.0e-8 * spacing )
+      {
+        isUniform = false;
+        break;
+      }
+    }
+    if( isUniform )
+    {
+      m_inverseSpacing[ii] = 1.0 / spacing;
+    }
+  }
+
   // Create the kernel wrapper
   m_kernelWrapper = createKernelWrapper();
 }
@@ -184,7 +360,55 @@ TableFunction::KernelWrapper TableFunction::createKernelWrapper() const
 {
   return { m_interpolationMethod,
            m_coordinates.toViewConst(),
-           m_values.toViewConst() };
+           m_values.toViewConst(),
+           m_inverseSpacing,
+           m_mappedVoxelFile.empty() ? m_nodeSharedValues.data() : m_mappedVoxelFile.data< real64 >() };
+}
+
+TableFunction const & TableFunction::getUniformResampling( integer const numPoints ) const
+{
+  GEOS_THROW_IF_NE_MSG( numDimensions(), 1,
+                        GEOS_FMT( "{} {}: only single-axis tables can be resampled on a uniform grid",
+                                  catalogName(), getDataContext() ),
+                        InputError );
+  GEOS_THROW_IF_NE_MSG( m_interpolationMethod, InterpolationType::Linear,
+                        GEOS_FMT( "{} {}: only linear tables can be resampled on a uniform grid",
+                                  catalogName(), getDataContext() ),
+                        InputError );
+  GEOS_THROW_IF_LT_MSG( numPoints, 2,
+                        GEOS_FMT( "{} {}: the uniform grid must have at least two points",
+                                  catalogName(), getDataContext() ),
+                        InputError );
+
+  FunctionManager & functionManager = FunctionManager::getInstance();
+  string const tableName = GEOS_FMT( "{}_uniform{}", getName(), numPoints );
+  if( functionManager.hasGroup< TableFunction >( tableName ) )
+  {
+    return functionManager.getGroup< TableFunction >( tableName );
+  }
+
+  arraySlice1d< real64 const > const coords = m_coordinates[0];
+  real64 const minCoord = coords[0];
+  real64 const maxCoord = coords[coords.size() - 1];
+  real64 const spacing = ( maxCoord - minCoord ) / ( numPoints - 1 );
+
+  array1d< real64_array > uniformCoords( 1 );
+  uniformCoords[0].resize( numPoints );
+  array1d< real64 > uniformValues( numPoints );
+  for( integer i = 0; i < numPoints; ++i )
+  {
+    // the last node is set explicitly to avoid extending the range because of round-off
+    real64 const coord = ( i == numPoints - 1 ) ? maxCoord : minCoord + i * spacing;
+    uniformCoords[0][i] = coord;
+    uniformValues[i] = m_kernelWrapper.compute( &coord );
+  }
+
+  TableFunction * const uniformTable =
+    dynamicCast< TableFunction * >( functionManager.createChild( TableFunction::catalogName(), tableName ) );
+  uniformTable->setTableCoordinates( uniformCoords, m_dimUnits );
+  uniformTable->setTableValues( uniformValues, m_valueUnit );
+  uniformTable->setInterpolationMethod( InterpolationType::Linear );
+  return *uniformTable;
 }
 
 real64 TableFunction::evaluate( real64 const * const input ) const
@@ -194,12 +418,43 @@ real64 TableFunction::evaluate( real64 const * const input ) const
 
 TableFunction::KernelWrapper::KernelWrapper( InterpolationType const interpolationMethod,
                                              ArrayOfArraysView< real64 const > const & coordinates,
-                                             arrayView1d< real64 const > const & values )
+                                             arrayView1d< real64 const > const & values,
+                                             real64 const (&inverseSpacing)[maxDimensions],
+                                             real64 const * const externalValues )
   :
   m_interpolationMethod( interpolationMethod ),
   m_coordinates( coordinates ),
-  m_values( values )
-{}
+  m_values( values ),
+  m_externalValues( externalValues )
+{
+  for( integer dim = 0; dim < maxDimensions; ++dim )
+  {
+    m_inverseSpacing[dim] = inverseSpacing[dim];
+  }
+}
+
+bool TableFunction::KernelWrapper::hasSameCoordinates( KernelWrapper const & other ) const
+{
+  if( m_coordinates.size() != other.m_coordinates.size() )
+  {
+    return false;
+  }
+  for( localIndex dim = 0; dim < m_coordinates.size(); ++dim )
+  {
+    if( m_coordinates.sizeOfArray( dim ) != other.m_coordinates.sizeOfArray( dim ) )
+    {
+      return false;
+    }
+    for( localIndex i = 0; i < m_coordinates.sizeOfArray( dim ); ++i )
+    {
+      if( m_coordinates( dim, i ) != other.m_coordinates( dim, i ) )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
 
 REGISTER_CATALOG_ENTRY( FunctionBase, TableFunction, string const &, Group * const )
 
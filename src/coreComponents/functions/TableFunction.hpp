@@ -22,6 +22,8 @@
 #include "FunctionBase.hpp"
 
 #include "codingUtilities/EnumStrings.hpp"
+#include "common/MemoryMappedFile.hpp"
+#include "common/NodeSharedBuffer.hpp"
 #include "LvArray/src/tensorOps.hpp"
 #include "common/Units.hpp"
 
@@ -46,6 +48,13 @@ public:
     Lower
   };
 
+  /// Enumerator of the formats of the voxel files
+  enum class VoxelFileFormat : integer
+  {
+    Text,  ///< comma-delimited values, read by the first rank and sent to the others
+    Binary ///< native binary doubles, mapped in memory and loaded on demand
+  };
+
   /// maximum dimensions for the coordinates in the table
   static constexpr integer maxDimensions = 4;
 
@@ -73,7 +82,12 @@ public:
     {
       m_coordinates = std::move( other.m_coordinates );
       m_values = std::move( other.m_values );
+      m_externalValues = other.m_externalValues;
       m_interpolationMethod = other.m_interpolationMethod;
+      for( integer dim = 0; dim < maxDimensions; ++dim )
+      {
+        m_inverseSpacing[dim] = other.m_inverseSpacing[dim];
+      }
       return *this;
     }
 
@@ -99,6 +113,32 @@ public:
     GEOS_HOST_DEVICE
     real64 compute( IN_ARRAY const & input, OUT_ARRAY && derivatives ) const;
 
+    /**
+     * @brief Linearly interpolate in several tables sharing the same coordinates with a single search.
+     * @tparam NUM_TABLES number of tables
+     * @param[in] tables the kernel wrappers of the tables, all defined on the coordinates of the first one
+     * @param[in] input vector of input value
+     * @param[out] values the interpolated values of each table
+     * @param[out] derivatives the derivatives of the interpolated values of each table wrt the variables present in input
+     *
+     * The interval search and interpolation weights are computed once and reused for all the tables,
+     * which is useful when several properties are tabulated on the same grid (e.g. density, viscosity
+     * and enthalpy as a function of pressure and temperature).
+     */
+    template< integer NUM_TABLES, typename IN_ARRAY, typename OUT_ARRAY, typename OUT_2D_ARRAY >
+    GEOS_HOST_DEVICE
+    static void computeFused( KernelWrapper const * const (&tables)[NUM_TABLES],
+                              IN_ARRAY const & input,
+                              OUT_ARRAY && values,
+                              OUT_2D_ARRAY && derivatives );
+
+    /**
+     * @brief Check whether two tables are defined on the same coordinates and can be interpolated with computeFused
+     * @param[in] other the kernel wrapper of the other table
+     * @return true if the coordinates are the same
+     */
+    bool hasSameCoordinates( KernelWrapper const & other ) const;
+
     /**
      * @brief Move the KernelWrapper to the given execution space, optionally touching it.
      * @param space the space to move the KernelWrapper to
@@ -121,15 +161,49 @@ private:
      * @param[in] interpolationMethod table interpolation method
      * @param[in] coordinates array of table axes
      * @param[in] values table values (in fortran order)
-     * @param[in] dimensions number of active table dimensions
-     * @param[in] size size of the table
-     * @param[in] indexIncrement array used to locate values within ND tables
-     * @param[in] corners corners of the box that surround the value in N dimensions
-     * @param[in] numCorners number of active table corners
+     * @param[in] inverseSpacing inverse of the spacing of each uniformly discretized axis, zero for the other ones
+     * @param[in] externalValues table values stored outside of @p values (shared by the node or mapped from a file),
+     *                           used instead of @p values if not null
      */
     KernelWrapper( InterpolationType interpolationMethod,
                    ArrayOfArraysView< real64 const > const & coordinates,
-                   arrayView1d< real64 const > const & values );
+                   arrayView1d< real64 const > const & values,
+                   real64 const (&inverseSpacing)[maxDimensions],
+                   real64 const * const externalValues );
+
+    /**
+     * @brief Get a table value.
+     * @param[in] index the index of the value (in fortran order)
+     * @return the value
+     */
+    GEOS_HOST_DEVICE
+    real64 value( localIndex const index ) const
+    { return ( m_externalValues != nullptr ) ? m_externalValues[index] : m_values[index]; }
+
+    /**
+     * @brief Find the interval of an axis containing a coordinate strictly inside the axis bounds.
+     * @param[in] dim the axis
+     * @param[in] coord the coordinate
+     * @return the index of the upper vertex of the interval
+     *
+     * The index is computed directly on uniformly discretized axes, and by binary search on the other ones.
+     */
+    GEOS_HOST_DEVICE
+    localIndex findUpperIndex( integer const dim, real64 const coord ) const;
+
+    /**
+     * @brief Compute the bounds and linear interpolation weights of a point along each axis.
+     * @param[in] input vector of input value
+     * @param[out] bounds indices of the lower and upper vertices along each axis
+     * @param[out] weights weights of the lower and upper vertices along each axis
+     * @param[out] dWeights_dInput derivatives of the weights wrt the input along each axis
+     */
+    template< typename IN_ARRAY >
+    GEOS_HOST_DEVICE
+    void computeLinearWeights( IN_ARRAY const & input,
+                               localIndex (& bounds)[maxDimensions][2],
+                               real64 (& weights)[maxDimensions][2],
+                               real64 (& dWeights_dInput)[maxDimensions][2] ) const;
 
     /**
      * @brief Interpolate in the table using linear method.
@@ -181,6 +255,12 @@ private:
 
     /// Table values (in fortran order)
     arrayView1d< real64 const > m_values;
+
+    /// Table values stored outside of m_values (in fortran order), null if the values are stored in m_values
+    real64 const * m_externalValues = nullptr;
+
+    /// Inverse of the spacing of each uniformly discretized axis, zero for the other axes
+    real64 m_inverseSpacing[maxDimensions]{};
   };
 
   /**
@@ -257,6 +337,8 @@ private:
   /**
    * @brief Get the table values
    * @return a reference to the 1d array of table values.  For ND arrays, values are stored in Fortran order.
+   * @note The array is empty if the values are stored once per compute node (see shareValuesOnNode),
+   *       or mapped from a binary voxel file (see voxelFileFormat).
    */
   arrayView1d< real64 const > getValues() const { return m_values.toViewConst(); }
 
@@ -305,6 +387,27 @@ private:
    */
   KernelWrapper createKernelWrapper() const;
 
+  /**
+   * @brief Get the resampling of this single-axis linear table on a uniform grid
+   * @param[in] numPoints the number of points of the uniform grid
+   * @return the resampled table, registered in the FunctionManager on the first call and reused afterwards
+   *
+   * The lookups in the resampled table compute the interval index directly instead of doing a binary search.
+   * The resampled table only matches this one at the grid nodes: the kinks of this table that do not fall on
+   * a node are smoothed over one interval of the uniform grid.
+   */
+  TableFunction const & getUniformResampling( integer const numPoints ) const;
+
+  /**
+   * @brief Create an instance of the kernel wrapper, optionally on the uniform resampling of the table
+   * @param[in] numResamplingPoints the number of points of the uniform grid, or 0 to use this table
+   * @return the kernel wrapper
+   */
+  KernelWrapper createKernelWrapper( integer const numResamplingPoints ) const
+  {
+    return ( numResamplingPoints > 0 ) ? getUniformResampling( numResamplingPoints ).createKernelWrapper() : createKernelWrapper();
+  }
+
   /// Struct containing lookup keys for data repository wrappers
   struct viewKeyStruct
   {
@@ -318,17 +421,30 @@ private:
     static constexpr char const * coordinateFilesString() { return "coordinateFiles"; }
     /// @return Key for name of file containing table values
     static constexpr char const * voxelFileString() { return "voxelFile"; }
+    /// @return Key for the flag to store the voxel file values once per compute node
+    static constexpr char const * shareValuesOnNodeString() { return "shareValuesOnNode"; }
+    /// @return Key for the format of the voxel file
+    static constexpr char const * voxelFileFormatString() { return "voxelFileFormat"; }
   };
 
 private:
 
   /**
-   * @brief Parse a table file.
-   * @param[in] target The place to store values.
+   * @brief Parse a table file on the first rank and broadcast its values to the other ranks.
    * @param[in] filename The name of the file to read.
-   * @param[in] delimiter The delimiter used for file entries.
+   * @param[inout] target The place to append the values to.
+   * @param[in] reuseValues Whether the values may be kept and reused by the other tables reading the same file
+   *                        (used for the coordinate files, which are small and usually shared by many tables).
    */
-  void readFile( string const & filename, array1d< real64 > & target );
+  void readFile( string const & filename, array1d< real64 > & target, bool const reuseValues = false );
+
+  /**
+   * @brief Parse a table file on the first rank.
+   * @param[in] filename The name of the file to read.
+   * @return the values of the file on the first rank, and an empty array on the other ranks
+   * @note The parsing errors are thrown on all the ranks.
+   */
+  array1d< real64 > parseFileOnFirstRank( string const & filename ) const;
 
   /// Coordinates for 1D table
   array1d< real64 > m_tableCoordinates1D;
@@ -348,6 +464,21 @@ private:
   /// Table values (in fortran order)
   array1d< real64 > m_values;
 
+  /// Flag to store the values read from the voxel file once per compute node
+  integer m_shareValuesOnNode;
+
+  /// Table values stored once per compute node, used instead of m_values if shareValuesOnNode is set
+  NodeSharedBuffer m_nodeSharedValues;
+
+  /// Format of the voxel file
+  VoxelFileFormat m_voxelFileFormat;
+
+  /// Binary voxel file mapped in memory, used instead of m_values if the voxel file format is binary
+  MemoryMappedFile m_mappedVoxelFile;
+
+  /// Inverse of the spacing of each uniformly discretized axis, zero for the other axes
+  real64 m_inverseSpacing[maxDimensions]{};
+
   /// The units of each table coordinate axes
   std::vector< units::Unit > m_dimUnits;
 
@@ -375,6 +506,82 @@ TableFunction::KernelWrapper::compute( IN_ARRAY const & input ) const
   }
 }
 
+GEOS_HOST_DEVICE
+inline
+localIndex
+TableFunction::KernelWrapper::findUpperIndex( integer const dim, real64 const coord ) const
+{
+  arraySlice1d< real64 const > const coords = m_coordinates[dim];
+  if( m_inverseSpacing[dim] > 0.0 )
+  {
+    // Uniform axis: compute the index directly, then correct the round-off of the division
+    localIndex const numCoords = coords.size();
+    localIndex upper = LvArray::math::min( static_cast< localIndex >( ( coord - coords[0] ) * m_inverseSpacing[dim] ) + 1, numCoords - 1 );
+    if( coords[upper - 1] >= coord )
+    {
+      --upper;
+    }
+    else if( coords[upper] < coord )
+    {
+      ++upper;
+    }
+    return upper;
+  }
+  // Note: find uses a binary search
+  auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), coord );
+  return LvArray::integerConversion< localIndex >( lower );
+}
+
+template< typename IN_ARRAY >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+TableFunction::KernelWrapper::computeLinearWeights( IN_ARRAY const & input,
+                                                    localIndex (& bounds)[maxDimensions][2],
+                                                    real64 (& weights)[maxDimensions][2],
+                                                    real64 (& dWeights_dInput)[maxDimensions][2] ) const
+{
+  integer const numDimensions = LvArray::integerConversion< integer >( m_coordinates.size() );
+
+  // Determine position, weights
+  for( integer dim = 0; dim < numDimensions; ++dim )
+  {
+    arraySlice1d< real64 const > const coords = m_coordinates[dim];
+    if( input[dim] <= coords[0] )
+    {
+      // Coordinate is to the left of this axis
+      bounds[dim][0] = 0;
+      bounds[dim][1] = 0;
+      weights[dim][0] = 0;
+      weights[dim][1] = 1;
+      dWeights_dInput[dim][0] = 0;
+      dWeights_dInput[dim][1] = 0;
+    }
+    else if( input[dim] >= coords[coords.size() - 1] )
+    {
+      // Coordinate is to the right of this axis
+      bounds[dim][0] = coords.size() - 1;
+      bounds[dim][1] = bounds[dim][0];
+      weights[dim][0] = 1;
+      weights[dim][1] = 0;
+      dWeights_dInput[dim][0] = 0;
+      dWeights_dInput[dim][1] = 0;
+    }
+    else
+    {
+      // Find the coordinate index
+      bounds[dim][1] = findUpperIndex( dim, input[dim] );
+      bounds[dim][0] = bounds[dim][1] - 1;
+
+      real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
+      weights[dim][0] = 1.0 - ( input[dim] - coords[bounds[dim][0]]) / dx;
+      weights[dim][1] = 1.0 - weights[dim][0];
+      dWeights_dInput[dim][0] = -1.0 / dx;
+      dWeights_dInput[dim][1] = -dWeights_dInput[dim][0];
+    }
+  }
+}
+
 template< typename IN_ARRAY >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
@@ -408,11 +615,7 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input ) const
     else
     {
       // Find the coordinate index
-      ///TODO make this fast
-      // Note: find uses a binary search...  If we assume coordinates are
-      // evenly spaced, we can speed things up considerably
-      auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      bounds[dim][1] = LvArray::integerConversion< localIndex >( lower );
+      bounds[dim][1] = findUpperIndex( dim, input[dim] );
       bounds[dim][0] = bounds[dim][1] - 1;
 
       real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
@@ -437,7 +640,7 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input ) const
     }
 
     // Determine weighted value
-    real64 cornerValue = m_values[tableIndex];
+    real64 cornerValue = value( tableIndex );
     for( integer dim = 0; dim < numDimensions; ++dim )
     {
       integer const corner = (point >> dim) & 1;
@@ -477,9 +680,8 @@ TableFunction::KernelWrapper::interpolateRound( IN_ARRAY const & input ) const
     else
     {
       // Coordinate is within the table axis
-      // Note: find() will return the index of the upper table vertex
-      auto const lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      subIndex = LvArray::integerConversion< localIndex >( lower );
+      // Note: findUpperIndex() will return the index of the upper table vertex
+      subIndex = findUpperIndex( dim, input[dim] );
 
       // Interpolation types:
       //   - Nearest returns the value of the closest table vertex
@@ -507,7 +709,7 @@ TableFunction::KernelWrapper::interpolateRound( IN_ARRAY const & input ) const
   }
 
   // Retrieve the nearest value
-  return m_values[tableIndex];
+  return value( tableIndex );
 }
 
 template< typename IN_ARRAY, typename OUT_ARRAY >
@@ -539,48 +741,7 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
   localIndex bounds[maxDimensions][2]{};
   real64 weights[maxDimensions][2]{};
   real64 dWeights_dInput[maxDimensions][2]{};
-
-  // Determine position, weights
-  for( integer dim = 0; dim < numDimensions; ++dim )
-  {
-    arraySlice1d< real64 const > const coords = m_coordinates[dim];
-    if( input[dim] <= coords[0] )
-    {
-      // Coordinate is to the left of this axis
-      bounds[dim][0] = 0;
-      bounds[dim][1] = 0;
-      weights[dim][0] = 0;
-      weights[dim][1] = 1;
-      dWeights_dInput[dim][0] = 0;
-      dWeights_dInput[dim][1] = 0;
-    }
-    else if( input[dim] >= coords[coords.size() - 1] )
-    {
-      // Coordinate is to the right of this axis
-      bounds[dim][0] = coords.size() - 1;
-      bounds[dim][1] = bounds[dim][0];
-      weights[dim][0] = 1;
-      weights[dim][1] = 0;
-      dWeights_dInput[dim][0] = 0;
-      dWeights_dInput[dim][1] = 0;
-    }
-    else
-    {
-      // Find the coordinate index
-      ///TODO make this fast
-      // Note: find uses a binary search...  If we assume coordinates are
-      // evenly spaced, we can speed things up considerably
-      auto lower = LvArray::sortedArrayManipulation::find( coords.begin(), coords.size(), input[dim] );
-      bounds[dim][1] = LvArray::integerConversion< localIndex >( lower );
-      bounds[dim][0] = bounds[dim][1] - 1;
-
-      real64 const dx = coords[bounds[dim][1]] - coords[bounds[dim][0]];
-      weights[dim][0] = 1.0 - ( input[dim] - coords[bounds[dim][0]]) / dx;
-      weights[dim][1] = 1.0 - weights[dim][0];
-      dWeights_dInput[dim][0] = -1.0 / dx;
-      dWeights_dInput[dim][1] = -dWeights_dInput[dim][0];
-    }
-  }
+  computeLinearWeights( input, bounds, weights, dWeights_dInput );
 
   // Calculate the result
   real64 value = 0.0;
@@ -603,7 +764,7 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
     }
 
     // Determine weighted value
-    real64 cornerValue = m_values[tableIndex];
+    real64 cornerValue = value( tableIndex );
     real64 dCornerValue_dInput[maxDimensions]{};
     for( integer dim = 0; dim < numDimensions; ++dim )
     {
@@ -629,6 +790,68 @@ TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, OUT_ARR
   return value;
 }
 
+template< integer NUM_TABLES, typename IN_ARRAY, typename OUT_ARRAY, typename OUT_2D_ARRAY >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void
+TableFunction::KernelWrapper::computeFused( KernelWrapper const * const (&tables)[NUM_TABLES],
+                                            IN_ARRAY const & input,
+                                            OUT_ARRAY && values,
+                                            OUT_2D_ARRAY && derivatives )
+{
+  KernelWrapper const & grid = *tables[0];
+  integer const numDimensions = LvArray::integerConversion< integer >( grid.m_coordinates.size() );
+
+  localIndex bounds[maxDimensions][2]{};
+  real64 weights[maxDimensions][2]{};
+  real64 dWeights_dInput[maxDimensions][2]{};
+  grid.computeLinearWeights( input, bounds, weights, dWeights_dInput );
+
+  for( integer table = 0; table < NUM_TABLES; ++table )
+  {
+    values[table] = 0.0;
+    for( integer dim = 0; dim < numDimensions; ++dim )
+    {
+      derivatives[table][dim] = 0.0;
+    }
+  }
+
+  integer const numCorners = 1 << numDimensions;
+  for( integer point = 0; point < numCorners; ++point )
+  {
+    // Find array index and corner weights, shared by all the tables
+    localIndex tableIndex = 0;
+    localIndex stride = 1;
+    real64 cornerWeight = 1.0;
+    real64 dCornerWeight_dInput[maxDimensions]{};
+    for( integer dim = 0; dim < numDimensions; ++dim )
+    {
+      dCornerWeight_dInput[dim] = 1.0;
+    }
+    for( integer dim = 0; dim < numDimensions; ++dim )
+    {
+      integer const corner = (point >> dim) & 1;
+      tableIndex += bounds[dim][corner] * stride;
+      stride *= grid.m_coordinates.sizeOfArray( dim );
+      cornerWeight *= weights[dim][corner];
+      for( integer kk = 0; kk < numDimensions; ++kk )
+      {
+        dCornerWeight_dInput[kk] *= ( dim == kk ) ? dWeights_dInput[dim][corner] : weights[dim][corner];
+      }
+    }
+
+    for( integer table = 0; table < NUM_TABLES; ++table )
+    {
+      real64 const cornerValue = tables[table]->value( tableIndex );
+      values[table] += cornerWeight * cornerValue;
+      for( integer dim = 0; dim < numDimensions; ++dim )
+      {
+        derivatives[table][dim] += dCornerWeight_dInput[dim] * cornerValue;
+      }
+    }
+  }
+}
+
 template< typename IN_ARRAY, typename OUT_ARRAY >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
@@ -649,6 +872,11 @@ ENUM_STRINGS( TableFunction::InterpolationType,
               "upper",
               "lower" );
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( TableFunction::VoxelFileFormat,
+              "text",
+              "binary" );
+
 } /* namespace geos */
 
 #endif /* GEOS_FUNCTIONS_TABLEFUNCTION_HPP_ */
@@ -0,0 +1,143 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkTableFunction.cpp
+ * @brief Micro-benchmark of the evaluation of a TableFunction in a kernel, isolated from the solvers.
+ *
+ * The reported bytes per second only count the streamed traffic (the input coordinates and the output
+ * values), so they can be compared directly with the STREAM bandwidth of the target. The 100x100 table
+ * stays in cache, while the random lookups in the 1000x1000 table measure the cost of the gathers.
+ */
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "functions/FunctionManager.hpp"
+#include "functions/TableFunction.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace geos;
+
+namespace
+{
+
+/**
+ * @brief Get (and create if needed) a 2D table with @p numCoords coordinates along each axis
+ * @param numCoords the number of coordinates along each axis
+ * @param method the interpolation method
+ * @return the table
+ */
+TableFunction & getTable( localIndex const numCoords, TableFunction::InterpolationType const method )
+{
+  FunctionManager & functionManager = FunctionManager::getInstance();
+  string const name = GEOS_FMT( "table_{}_{}", numCoords, static_cast< int >( method ) );
+  if( functionManager.hasGroup< TableFunction >( name ) )
+  {
+    return functionManager.getGroup< TableFunction >( name );
+  }
+
+  TableFunction & table = dynamicCast< TableFunction & >( *functionManager.createChild( "TableFunction", name ) );
+
+  array1d< array1d< real64 > > coordinates;
+  coordinates.resize( 2 );
+  for( integer dim = 0; dim < 2; ++dim )
+  {
+    coordinates[dim].resize( numCoords );
+    for( localIndex i = 0; i < numCoords; ++i )
+    {
+      coordinates[dim][i] = i;
+    }
+  }
+
+  array1d< real64 > values( numCoords * numCoords );
+  for( localIndex j = 0; j < numCoords; ++j )
+  {
+    for( localIndex i = 0; i < numCoords; ++i )
+    {
+      values[j * numCoords + i] = sin( 0.1 * i ) + cos( 0.1 * j );
+    }
+  }
+
+  table.setTableCoordinates( coordinates, { units::Dimensionless, units::Dimensionless } );
+  table.setTableValues( values, units::Dimensionless );
+  table.setInterpolationMethod( method );
+  table.reInitializeFunction();
+  return table;
+}
+
+/**
+ * @brief Evaluate a 2D table at random points
+ * @param state the benchmark state, with the number of points and the number of table coordinates per axis as arguments
+ * @param method the interpolation method
+ */
+void tableLookup( benchmark::State & state, TableFunction::InterpolationType const method )
+{
+  localIndex const numPoints = state.range( 0 );
+  localIndex const numCoords = state.range( 1 );
+
+  TableFunction::KernelWrapper const kernelWrapper = getTable( numCoords, method ).createKernelWrapper();
+
+  array2d< real64 > points( numPoints, 2 );
+  std::mt19937 generator( 2023 );
+  std::uniform_real_distribution< real64 > distribution( 0.0, numCoords - 1.0 );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    points[i][0] = distribution( generator );
+    points[i][1] = distribution( generator );
+  }
+  array1d< real64 > results( numPoints );
+
+  arrayView2d< real64 const > const pointsView = points.toViewConst();
+  arrayView1d< real64 > const resultsView = results.toView();
+
+  for( auto _ : state )
+  {
+    forAll< parallelDevicePolicy<> >( numPoints, [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      resultsView[i] = kernelWrapper.compute( pointsView[i] );
+    } );
+  }
+
+  state.SetItemsProcessed( state.iterations() * numPoints );
+  state.SetBytesProcessed( state.iterations() * numPoints * 3 * sizeof( real64 ) );
+}
+
+}
+
+BENCHMARK_CAPTURE( tableLookup, linear, TableFunction::InterpolationType::Linear )
+  ->Args( { 1 << 20, 100 } )
+  ->Args( { 1 << 20, 1000 } );
+
+BENCHMARK_CAPTURE( tableLookup, nearest, TableFunction::InterpolationType::Nearest )
+  ->Args( { 1 << 20, 100 } )
+  ->Args( { 1 << 20, 1000 } );
+
+int main( int argc, char * * argv )
+{
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  conduit::Node conduitNode;
+  dataRepository::Group rootNode( "root", conduitNode );
+  FunctionManager functionManager( "FunctionManager", &rootNode );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -539,6 +539,149 @@ TEST( FunctionTests, 4DTable_derivatives )
   }
 }
 
+TEST( FunctionTests, 2DTable_uniformFused )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // Two 2D tables on the same uniform grid, interpolated separately and with a single fused lookup
+  // f(x, y) = 2*x - 3*y + x*y + 5 and g(x, y) = -x + 4*y - 2*x*y are exactly reproduced by bilinear interpolation
+  localIndex const Ndim = 2;
+  localIndex const Nx = 11;
+  localIndex const Ny = 7;
+  localIndex const Ntest = 100;
+
+  array1d< array1d< real64 > > coordinates;
+  coordinates.resize( Ndim );
+  coordinates[0].resize( Nx );
+  for( localIndex ii=0; ii<Nx; ++ii )
+  {
+    coordinates[0][ii] = -1.0 + 0.3 * ii;
+  }
+  coordinates[1].resize( Ny );
+  for( localIndex jj=0; jj<Ny; ++jj )
+  {
+    coordinates[1][jj] = 1.0e5 + 2.5e4 * jj;
+  }
+
+  auto const f = []( real64 const x, real64 const y ) { return 2.0*x - 3.0e-5*y + 1.0e-5*x*y + 5.0; };
+  auto const g = []( real64 const x, real64 const y ) { return -x + 4.0e-5*y - 2.0e-5*x*y; };
+
+  array1d< real64 > valuesF( Nx * Ny );
+  array1d< real64 > valuesG( Nx * Ny );
+  for( localIndex jj=0, tablePosition=0; jj<Ny; ++jj )
+  {
+    for( localIndex ii=0; ii<Nx; ++ii, ++tablePosition )
+    {
+      valuesF[tablePosition] = f( coordinates[0][ii], coordinates[1][jj] );
+      valuesG[tablePosition] = g( coordinates[0][ii], coordinates[1][jj] );
+    }
+  }
+
+  TableFunction & table_f = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_uniform_f" ) );
+  table_f.setTableCoordinates( coordinates, { units::Dimensionless, units::Pressure } );
+  table_f.setTableValues( valuesF, units::Dimensionless );
+  table_f.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+
+  TableFunction & table_g = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_uniform_g" ) );
+  table_g.setTableCoordinates( coordinates, { units::Dimensionless, units::Pressure } );
+  table_g.setTableValues( valuesG, units::Dimensionless );
+  table_g.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+
+  TableFunction::KernelWrapper const kernelWrapperF = table_f.createKernelWrapper();
+  TableFunction::KernelWrapper const kernelWrapperG = table_g.createKernelWrapper();
+  ASSERT_TRUE( kernelWrapperF.hasSameCoordinates( kernelWrapperG ) );
+  TableFunction::KernelWrapper const * const tables[2] = { &kernelWrapperF, &kernelWrapperG };
+
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distributionX( -1.0, 2.0 );
+  std::uniform_real_distribution< double > distributionY( 1.0e5, 2.5e5 );
+
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    real64 input[2] = { distributionX( generator ), distributionY( generator ) };
+    if( ii % 10 == 0 )
+    {
+      // exactly on a table vertex, where the index computation is most sensitive to round-off
+      input[0] = coordinates[0][ii % Nx];
+      input[1] = coordinates[1][ii % Ny];
+    }
+
+    real64 derivativesF[2]{};
+    real64 derivativesG[2]{};
+    real64 const valueF = kernelWrapperF.compute( input, derivativesF );
+    real64 const valueG = kernelWrapperG.compute( input, derivativesG );
+    ASSERT_NEAR( f( input[0], input[1] ), valueF, 1e-10 );
+    ASSERT_NEAR( g( input[0], input[1] ), valueG, 1e-10 );
+    ASSERT_NEAR( valueF, kernelWrapperF.compute( input ), 1e-12 );
+
+    real64 fusedValues[2]{};
+    real64 fusedDerivatives[2][2]{};
+    TableFunction::KernelWrapper::computeFused< 2 >( tables, input, fusedValues, fusedDerivatives );
+    ASSERT_NEAR( valueF, fusedValues[0], 1e-12 );
+    ASSERT_NEAR( valueG, fusedValues[1], 1e-12 );
+    for( integer dim=0; dim<Ndim; ++dim )
+    {
+      ASSERT_NEAR( derivativesF[dim], fusedDerivatives[0][dim], 1e-12 );
+      ASSERT_NEAR( derivativesG[dim], fusedDerivatives[1][dim], 1e-12 );
+    }
+  }
+}
+
+TEST( FunctionTests, 1DTable_uniformResampling )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // Relative permeability-like table on a non-uniform grid whose nodes all fall on a uniform grid of spacing 0.05,
+  // so that the resampled table reproduces it exactly
+  localIndex const Naxis = 5;
+  localIndex const Nresample = 21;
+  localIndex const Ntest = 101;
+
+  array1d< array1d< real64 > > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( Naxis );
+  coordinates[0][0] = 0.0;
+  coordinates[0][1] = 0.1;
+  coordinates[0][2] = 0.25;
+  coordinates[0][3] = 0.6;
+  coordinates[0][4] = 1.0;
+
+  array1d< real64 > values( Naxis );
+  values[0] = 0.0;
+  values[1] = 0.0;
+  values[2] = 0.05;
+  values[3] = 0.4;
+  values[4] = 1.0;
+
+  TableFunction & table_r = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_r" ) );
+  table_r.setTableCoordinates( coordinates, { units::Dimensionless } );
+  table_r.setTableValues( values, units::Dimensionless );
+  table_r.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+
+  TableFunction const & uniformTable = table_r.getUniformResampling( Nresample );
+  ASSERT_EQ( &uniformTable, &table_r.getUniformResampling( Nresample ) );
+  ASSERT_EQ( uniformTable.getCoordinates().sizeOfArray( 0 ), Nresample );
+  ASSERT_EQ( uniformTable.getCoordinates()[0][Nresample-1], coordinates[0][Naxis-1] );
+
+  TableFunction::KernelWrapper const kernelWrapper = table_r.createKernelWrapper();
+  TableFunction::KernelWrapper const uniformKernelWrapper = table_r.createKernelWrapper( Nresample );
+
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    real64 const input = 0.01 * ii;
+    real64 derivative = 0.0;
+    real64 uniformDerivative = 0.0;
+    real64 const value = kernelWrapper.compute( &input, &derivative );
+    real64 const uniformValue = uniformKernelWrapper.compute( &input, &uniformDerivative );
+    ASSERT_NEAR( value, uniformValue, 1e-12 );
+    // on the grid nodes, round-off may pick the interval on either side
+    if( ii % 5 != 0 )
+    {
+      ASSERT_NEAR( derivative, uniformDerivative, 1e-10 );
+    }
+  }
+}
+
 #ifdef GEOSX_USE_MATHPRESSO
 
 TEST( FunctionTests, 4DTable_symbolic )
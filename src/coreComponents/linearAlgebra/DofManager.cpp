@@ -28,6 +28,7 @@
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/MeshLevel.hpp"
 #include "mesh/NodeManager.hpp"
+#include "mesh/utilities/SpaceFillingCurve.hpp"
 
 #include "DofManagerHelpers.hpp"
 
@@ -182,6 +183,87 @@ void fillTrivialPermutation( arrayView1d< localIndex > const permutation )
   } );
 }
 
+/**
+ * @brief Helper to collect the coordinates of the mesh locations of a field, in the order of DoF numbering.
+ * @tparam LOC type of location (Node/Edge/Face/Elem)
+ */
+template< FieldLocation LOC >
+struct LocationCenters
+{};
+
+template<>
+struct LocationCenters< FieldLocation::Node >
+{
+  template< typename REGIONS_CONTAINER >
+  static void collect( MeshLevel const & mesh,
+                       REGIONS_CONTAINER const & regions,
+                       arrayView2d< real64 > const & centers,
+                       localIndex & index )
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = mesh.getNodeManager().referencePosition();
+    forMeshLocation< FieldLocation::Node, false, serialPolicy >( mesh, regions, [&]( localIndex const k )
+    {
+      LvArray::tensorOps::copy< 3 >( centers[index++], X[k] );
+    } );
+  }
+};
+
+template<>
+struct LocationCenters< FieldLocation::Edge >
+{
+  template< typename REGIONS_CONTAINER >
+  static void collect( MeshLevel const & mesh,
+                       REGIONS_CONTAINER const & regions,
+                       arrayView2d< real64 > const & centers,
+                       localIndex & index )
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = mesh.getNodeManager().referencePosition();
+    arrayView2d< localIndex const > const edgeToNodes = mesh.getEdgeManager().nodeList().toViewConst();
+    forMeshLocation< FieldLocation::Edge, false, serialPolicy >( mesh, regions, [&]( localIndex const k )
+    {
+      LvArray::tensorOps::copy< 3 >( centers[index], X[edgeToNodes( k, 0 )] );
+      LvArray::tensorOps::add< 3 >( centers[index], X[edgeToNodes( k, 1 )] );
+      LvArray::tensorOps::scale< 3 >( centers[index], 0.5 );
+      ++index;
+    } );
+  }
+};
+
+template<>
+struct LocationCenters< FieldLocation::Face >
+{
+  template< typename REGIONS_CONTAINER >
+  static void collect( MeshLevel const & mesh,
+                       REGIONS_CONTAINER const & regions,
+                       arrayView2d< real64 > const & centers,
+                       localIndex & index )
+  {
+    arrayView2d< real64 const > const faceCenter = mesh.getFaceManager().faceCenter();
+    forMeshLocation< FieldLocation::Face, false, serialPolicy >( mesh, regions, [&]( localIndex const k )
+    {
+      LvArray::tensorOps::copy< 3 >( centers[index++], faceCenter[k] );
+    } );
+  }
+};
+
+template<>
+struct LocationCenters< FieldLocation::Elem >
+{
+  template< typename REGIONS_CONTAINER >
+  static void collect( MeshLevel const & mesh,
+                       REGIONS_CONTAINER const & regions,
+                       arrayView2d< real64 > const & centers,
+                       localIndex & index )
+  {
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenter =
+      mesh.getElemManager().constructArrayViewAccessor< real64, 2 >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+    forMeshLocation< FieldLocation::Elem, false, serialPolicy >( mesh, regions, [&]( auto const k )
+    {
+      LvArray::tensorOps::copy< 3 >( centers[index++], elemCenter[k[0]][k[1]][k[2]] );
+    } );
+  }
+};
+
 } // namespace
 
 array1d< localIndex > DofManager::computePermutation( FieldDescription & field )
@@ -200,8 +282,16 @@ array1d< localIndex > DofManager::computePermutation( FieldDescription & field )
   // step 2: compute field dimensions (local dofs, global dofs, etc)
   //         this is needed to make sure that the sparsity pattern function work properly
   //         in particular, this function defines the rankOffset (computed with number of components = 1)
+  //         without reordering, only the number of local dofs is needed, and the collectives are skipped
 
-  computeFieldDimensions( fieldIndex );
+  if( field.reorderingType == LocalReorderingType::None )
+  {
+    field.numLocalDof = numLocalSupport( field );
+  }
+  else
+  {
+    computeFieldDimensions( fieldIndex );
+  }
 
   // the number of local dofs is available at this point, we allocate space for the permutation
   array1d< localIndex > permutation( numLocalDofs( field.name ) );
@@ -234,6 +324,14 @@ array1d< localIndex > DofManager::computePermutation( FieldDescription & field )
 void DofManager::computePermutation( FieldDescription const & field,
                                      arrayView1d< localIndex > const permutation )
 {
+  // space-filling curve orderings only depend on the coordinates of the mesh locations
+  if( field.reorderingType == LocalReorderingType::MortonCurve ||
+      field.reorderingType == LocalReorderingType::HilbertCurve )
+  {
+    computeSpaceFillingCurvePermutation( field, permutation );
+    return;
+  }
+
   localIndex const fieldIndex = getFieldIndex( field.name );
 
   // step 3: allocate and fill the dofNumber array
@@ -280,6 +378,34 @@ void DofManager::computePermutation( FieldDescription const & field,
   } );
 }
 
+void DofManager::computeSpaceFillingCurvePermutation( FieldDescription const & field,
+                                                      arrayView1d< localIndex > const permutation ) const
+{
+  // collect the coordinates of the locations in the order in which they are numbered
+  array2d< real64 > centers( permutation.size(), 3 );
+  LocationSwitch( field.location, [&]( auto const loc )
+  {
+    FieldLocation constexpr LOC = decltype(loc)::value;
+    localIndex index = 0;
+    forMeshSupport( field.support, *m_domain, [&]( MeshBody const &, MeshLevel const & mesh, auto const & regions )
+    {
+      LocationCenters< LOC >::collect( mesh, regions, centers.toView(), index );
+    } );
+    GEOS_ERROR_IF_NE( index, permutation.size() );
+  } );
+
+  spaceFillingCurve::CurveType const curveType = field.reorderingType == LocalReorderingType::MortonCurve
+                                               ? spaceFillingCurve::CurveType::morton
+                                               : spaceFillingCurve::CurveType::hilbert;
+  array1d< localIndex > reversePermutation( permutation.size() );
+  spaceFillingCurve::computeOrdering( centers.toViewConst(), curveType, reversePermutation.toView() );
+
+  forAll< parallelHostPolicy >( permutation.size(), [&]( localIndex const i )
+  {
+    permutation[reversePermutation[i]] = i;
+  } );
+}
+
 void DofManager::createIndexArray( FieldDescription const & field,
                                    arrayView1d< localIndex const > const permutation )
 {
@@ -330,17 +456,22 @@ void DofManager::removeIndexArray( FieldDescription const & field )
   } );
 }
 
+localIndex DofManager::numLocalSupport( FieldDescription const & field ) const
+{
+  localIndex numSupport = 0;
+  forMeshSupport( field.support, *m_domain, [&]( MeshBody &, MeshLevel & mesh, auto const & regions )
+  {
+    numSupport += countMeshObjects< false >( field.location, mesh, regions );
+  } );
+  return numSupport;
+}
+
 void DofManager::computeFieldDimensions( localIndex const fieldIndex )
 {
   FieldDescription & field = m_fields[fieldIndex];
 
   // determine number of local support points
-  localIndex numLocalSupport = 0;
-  forMeshSupport( field.support, *m_domain, [&]( MeshBody &, MeshLevel & mesh, auto const & regions )
-  {
-    numLocalSupport += countMeshObjects< false >( field.location, mesh, regions );
-  } );
-  field.numLocalDof = field.numComponents * numLocalSupport;
+  field.numLocalDof = field.numComponents * numLocalSupport( field );
 
   // gather dof counts across ranks
   field.rankOffset = MpiWrapper::prefixSum< globalIndex >( field.numLocalDof );
@@ -356,6 +487,42 @@ void DofManager::computeFieldDimensions( localIndex const fieldIndex )
   field.globalOffset = field.rankOffset; // actual value computed in reorderByRank()
 }
 
+void DofManager::computeFieldDimensions()
+{
+  int const numFields = LvArray::integerConversion< int >( m_fields.size() );
+
+  // determine number of local dofs of all fields
+  array1d< globalIndex > numLocalDof( numFields );
+  for( int i = 0; i < numFields; ++i )
+  {
+    FieldDescription & field = m_fields[i];
+    field.numLocalDof = field.numComponents * numLocalSupport( field );
+    numLocalDof[i] = field.numLocalDof;
+  }
+
+  // gather dof counts across ranks, with one prefix sum and one reduction for all the fields
+  array1d< globalIndex > rankOffset( numFields );
+  array1d< globalIndex > numGlobalDof( numFields );
+  MpiWrapper::exscan( numLocalDof.data(), rankOffset.data(), numFields,
+                      MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOSX );
+  if( MpiWrapper::commRank() == 0 )
+  {
+    rankOffset.zero(); // the result of the exclusive scan is undefined on the first rank
+  }
+  MpiWrapper::allReduce( numLocalDof.data(), numGlobalDof.data(), numFields,
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOSX );
+
+  // determine fields' offsets
+  for( int i = 0; i < numFields; ++i )
+  {
+    FieldDescription & field = m_fields[i];
+    field.rankOffset = rankOffset[i];
+    field.numGlobalDof = numGlobalDof[i];
+    field.blockOffset = ( i > 0 ) ? m_fields[i - 1].blockOffset + m_fields[i - 1].numGlobalDof : 0;
+    field.globalOffset = field.rankOffset; // actual value computed in reorderByRank()
+  }
+}
+
 namespace
 {
 
@@ -823,6 +990,54 @@ void makeConnLocPattern( MeshLevel const & mesh,
   }
 }
 
+/**
+ * @brief List the connectors adjacent to each locally owned row.
+ * @tparam FUNC type of the function visiting the global rows of a connector
+ * @param numLocalRows number of locally owned rows
+ * @param numConnectors number of connectors
+ * @param rankDofOffset global index of the first locally owned row
+ * @param forConnectorRows function called as forConnectorRows( iconn, visitor ), that must call visitor( globalRow )
+ *                         for each global row of connector iconn
+ * @return the map from local rows to connectors, which lets the rows of the pattern be filled concurrently
+ */
+template< typename FUNC >
+ArrayOfArrays< localIndex > makeRowToConnectorMap( localIndex const numLocalRows,
+                                                   localIndex const numConnectors,
+                                                   globalIndex const rankDofOffset,
+                                                   FUNC && forConnectorRows )
+{
+  array1d< localIndex > counts( numLocalRows );
+  forAll< parallelHostPolicy >( numConnectors, [&]( localIndex const iconn )
+  {
+    forConnectorRows( iconn, [&]( globalIndex const globalRow )
+    {
+      localIndex const localRow = globalRow - rankDofOffset;
+      if( localRow >= 0 && localRow < numLocalRows )
+      {
+        RAJA::atomicInc( parallelHostAtomic{}, &counts[localRow] );
+      }
+    } );
+  } );
+
+  ArrayOfArrays< localIndex > rowToConnector;
+  rowToConnector.resizeFromCapacities< parallelHostPolicy >( numLocalRows, counts.data() );
+
+  ArrayOfArraysView< localIndex > const rowToConnectorView = rowToConnector.toView();
+  forAll< parallelHostPolicy >( numConnectors, [&]( localIndex const iconn )
+  {
+    forConnectorRows( iconn, [&]( globalIndex const globalRow )
+    {
+      localIndex const localRow = globalRow - rankDofOffset;
+      if( localRow >= 0 && localRow < numLocalRows )
+      {
+        rowToConnectorView.emplaceBackAtomic< parallelHostAtomic >( localRow, iconn );
+      }
+    } );
+  } );
+
+  return rowToConnector;
+}
+
 } // namespace
 
 void DofManager::setSparsityPatternFromStencil( SparsityPatternView< globalIndex > const & pattern,
@@ -839,55 +1054,44 @@ void DofManager::setSparsityPatternFromStencil( SparsityPatternView< globalIndex
     ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const dofNumber =
       mesh.getElemManager().constructArrayViewAccessor< globalIndex, 1 >( field.key );
 
-    array1d< globalIndex > rowDofIndices;
-    array1d< globalIndex > colDofIndices;
-
     // 1. Assemble diagonal and off-diagonal blocks for elements in stencil
     coupling.stencils->forAllStencils( mesh, [&]( auto const & stencil )
     {
       using StenciType = typename std::decay< decltype( stencil ) >::type;
-      constexpr localIndex maxNumFluxElems = StenciType::maxNumPointsInFlux;
-      constexpr localIndex maxStencilSize = StenciType::maxStencilSize;
 
       typename StenciType::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
       typename StenciType::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
       typename StenciType::IndexContainerViewConstType const & sei = stencil.getElementIndices();
 
-      rowDofIndices.reserve( maxNumFluxElems );
-      colDofIndices.reserve( maxStencilSize * numComp );
-
-      forAll< serialPolicy >( stencil.size(), [&]( localIndex const iconn )
+      // the rows of an element only receive the contributions of its own connections,
+      // so looping over the elements instead of the connections avoids concurrent insertions into a row
+      ArrayOfArrays< localIndex > const elemToConn =
+        makeRowToConnectorMap( pattern.numRows(), stencil.size(), rankDofOffset,
+                               [&]( localIndex const iconn, auto && visitRow )
       {
         // This weirdness is because of fracture stencils, which don't have separate
         // getters for num flux elems vs stencil size... it won't work for MPFA though
         localIndex const numFluxElems = stencil.stencilSize( iconn );
-        localIndex const stencilSize = numFluxElems;
-
-        rowDofIndices.resize( numFluxElems );
         for( localIndex i = 0; i < numFluxElems; ++i )
         {
-          rowDofIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+          visitRow( dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] );
         }
+      } );
 
-        colDofIndices.resize( stencilSize * numComp );
-        for( localIndex i = 0; i < stencilSize; ++i )
-        {
-          for( localIndex c = 0; c < numComp; ++c )
-          {
-            colDofIndices[i * numComp + c] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] + c;
-          }
-        }
-
-        std::sort( colDofIndices.begin(), colDofIndices.end() );
-
-        for( localIndex i = 0; i < numFluxElems; ++i )
+      forAll< parallelHostPolicy >( elemToConn.size(), [&]( localIndex const localDofNumber )
+      {
+        for( localIndex const iconn : elemToConn[localDofNumber] )
         {
-          localIndex const localDofNumber = rowDofIndices[i] - rankDofOffset;
-          if( localDofNumber >= 0 && localDofNumber < pattern.numRows() )
+          localIndex const stencilSize = stencil.stencilSize( iconn );
+          for( localIndex i = 0; i < stencilSize; ++i )
           {
+            globalIndex const colDofNumber = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
             for( integer const c : globallyCoupledComps ) // add a non-zero for globally coupled components only
             {
-              pattern.insertNonZeros( localDofNumber + c, colDofIndices.begin(), colDofIndices.end() );
+              for( localIndex cc = 0; cc < numComp; ++cc )
+              {
+                pattern.insertNonZero( localDofNumber + c, colDofNumber + cc );
+              }
             }
           }
         }
@@ -897,7 +1101,7 @@ void DofManager::setSparsityPatternFromStencil( SparsityPatternView< globalIndex
     // 2. Insert diagonal blocks, in case there are elements not included in stencil
     // (e.g. a single fracture element not connected to any other)
     auto dofNumberView = dofNumber.toNestedViewConst();
-    colDofIndices.resize( numComp );
+    array1d< globalIndex > colDofIndices( numComp );
     forMeshLocation< FieldLocation::Elem, false, parallelHostPolicy >( mesh, regions, [=]( auto const & elemIdx )
     {
       globalIndex const elemDof = dofNumberView[elemIdx[0]][elemIdx[1]][elemIdx[2]];
@@ -990,18 +1194,24 @@ void DofManager::setSparsityPatternOneBlock( SparsityPatternView< globalIndex >
     GEOS_ASSERT_EQ( connLocRow.numRows(), connLocCol.numRows() );
 
     // First, we perform assembly/multiply patterns (at this step, locally coupled equations are excluded by construction)
+    // The connectors are grouped by row, so that each row is filled by a single thread
     globalIndex const globalDofOffset = rankOffset();
-    forAll< serialPolicy >( connLocRow.numRows(), [&]( localIndex const irow )
+    ArrayOfArrays< localIndex > const rowToConn =
+      makeRowToConnectorMap( pattern.numRows(), connLocRow.numRows(), globalDofOffset,
+                             [&]( localIndex const iconn, auto && visitRow )
     {
-      arraySlice1d< globalIndex const > const dofIndicesRow = connLocRow.getColumns( irow );
-      arraySlice1d< globalIndex const > const dofIndicesCol = connLocCol.getColumns( irow );
-      for( globalIndex const globalRow : dofIndicesRow )
+      for( globalIndex const globalRow : connLocRow.getColumns( iconn ) )
       {
-        localIndex const localRow = globalRow - globalDofOffset;
-        if( localRow >= 0 && localRow < pattern.numRows() )
-        {
-          pattern.insertNonZeros( localRow, dofIndicesCol.begin(), dofIndicesCol.end() );
-        }
+        visitRow( globalRow );
+      }
+    } );
+
+    forAll< parallelHostPolicy >( rowToConn.size(), [&]( localIndex const localRow )
+    {
+      for( localIndex const iconn : rowToConn[localRow] )
+      {
+        arraySlice1d< globalIndex const > const dofIndicesCol = connLocCol.getColumns( iconn );
+        pattern.insertNonZeros( localRow, dofIndicesCol.begin(), dofIndicesCol.end() );
       }
     } );
 
@@ -1230,6 +1440,44 @@ void DofManager::countRowLengthsOneBlock( arrayView1d< localIndex > const & rowL
   } );
 }
 
+void DofManager::getLocalDofCenters( arrayView2d< real64 > const & centers ) const
+{
+  GEOS_ERROR_IF( !m_reordered, "Cannot get the dof centers before reorderByRank() has been called." );
+  GEOS_ERROR_IF_NE( centers.size( 0 ), numLocalDofs() );
+  GEOS_ERROR_IF_NE( centers.size( 1 ), 3 );
+
+  globalIndex const rankDofOffset = rankOffset();
+  for( FieldDescription const & field : m_fields )
+  {
+    LocationSwitch( field.location, [&]( auto const loc )
+    {
+      FieldLocation constexpr LOC = decltype(loc)::value;
+      using helper = ArrayHelper< globalIndex const, LOC >;
+
+      // the centers and the dof indices are visited in the same order
+      array2d< real64 > supportCenters( field.numLocalDof / field.numComponents, 3 );
+      localIndex centerIndex = 0;
+      localIndex dofIndex = 0;
+      forMeshSupport( field.support, *m_domain, [&]( MeshBody const &, MeshLevel const & mesh, auto const & regions )
+      {
+        LocationCenters< LOC >::collect( mesh, regions, supportCenters.toView(), centerIndex );
+
+        typename helper::Accessor dofIndexArray = helper::get( mesh, field.key );
+        forMeshLocation< LOC, false, serialPolicy >( mesh, regions, [&]( auto const locIdx )
+        {
+          localIndex const firstRow = LvArray::integerConversion< localIndex >( helper::value( dofIndexArray, locIdx ) - rankDofOffset );
+          for( localIndex c = 0; c < field.numComponents; ++c )
+          {
+            LvArray::tensorOps::copy< 3 >( centers[firstRow + c], supportCenters[dofIndex] );
+          }
+          ++dofIndex;
+        } );
+      } );
+      GEOS_ERROR_IF_NE( centerIndex, supportCenters.size( 0 ) );
+    } );
+  }
+}
+
 // Create the sparsity pattern (location-location). Low level interface
 void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const
 {
@@ -1574,11 +1822,12 @@ void DofManager::reorderByRank()
     permutations[ field.name ] = computePermutation( field );
   }
 
+  // compute field dimensions (local dofs, global dofs, etc) of all fields at once
+  computeFieldDimensions();
+
   // Second loop: compute the dof number array
   for( FieldDescription & field : m_fields )
   {
-    // compute field dimensions (local dofs, global dofs, etc)
-    computeFieldDimensions( static_cast< localIndex >( getFieldIndex( field.name ) ) );
     // allocate and fill index array
     createIndexArray( field, permutations.at( field.name ).toViewConst() );
   }
@@ -116,6 +116,8 @@ public:
   {
     None,    ///< Do not reorder the variables
     ReverseCutHillMcKee, ///< Use reverve CutHill-McKee reordering algorithm.
+    MortonCurve, ///< Order the mesh locations along a Morton (Z-order) curve through their centers.
+    HilbertCurve, ///< Order the mesh locations along a Hilbert curve through their centers.
   };
 
   /**
@@ -377,6 +379,14 @@ public:
     }
   }
 
+  /**
+   * @brief Fill an array with the coordinates of the support point of each local dof.
+   * @param centers the array of size number of local dofs times 3 to fill
+   *
+   * The coordinates are repeated for each component of a field.
+   */
+  void getLocalDofCenters( arrayView2d< real64 > const & centers ) const;
+
   /**
    * @brief Populate sparsity pattern of the entire system matrix.
    * @param [out] pattern the target sparsity pattern
@@ -528,12 +538,25 @@ private:
    */
   localIndex getFieldIndex( string const & name ) const;
 
+  /**
+   * @brief Count the locally owned support points of a field
+   * @param field the field descriptor
+   * @return the number of locally owned mesh objects in the support of the field
+   */
+  localIndex numLocalSupport( FieldDescription const & field ) const;
+
   /**
    * @brief Compute and save dof offsets the field
    * @param fieldIndex index of the field
    */
   void computeFieldDimensions( localIndex fieldIndex );
 
+  /**
+   * @brief Compute and save dof offsets of all the fields
+   * @note The dof counts of all the fields are exchanged at once, instead of field by field
+   */
+  void computeFieldDimensions();
+
   /**
    * @brief Create index array for the field
    * @param field the field descriptor
@@ -564,6 +587,13 @@ private:
   void computePermutation( FieldDescription const & field,
                            arrayView1d< localIndex > const permutation );
 
+  /**
+   * @brief Compute a local reordering of the dofNumbers along a space-filling curve through the mesh locations
+   * @param field the field descriptor
+   * @param permutation the local permutation used to fill the index array for this field
+   */
+  void computeSpaceFillingCurvePermutation( FieldDescription const & field,
+                                            arrayView1d< localIndex > const permutation ) const;
 
   /**
    * @brief Calculate or estimate the number of nonzero entries in each local row
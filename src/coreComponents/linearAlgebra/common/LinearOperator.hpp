@@ -72,6 +72,18 @@ public:
     r.axpby( 1.0, b, -1.0 );
   }
 
+  /**
+   * @brief Relax the accuracy of the next applications of an inexact operator, such as an inner iterative solve.
+   * @param factor the factor by which the relative accuracy of the operator may be relaxed (1 for its nominal accuracy)
+   *
+   * Flexible Krylov methods call it before each application of their preconditioner, with a factor growing
+   * as the outer residual decreases. The default implementation ignores it.
+   */
+  virtual void relaxAccuracy( real64 const factor ) const
+  {
+    GEOS_UNUSED_VAR( factor );
+  }
+
   /**
    * @brief Get the number of global rows.
    * @return Number of global rows in the operator.
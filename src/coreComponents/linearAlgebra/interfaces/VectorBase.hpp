@@ -214,6 +214,26 @@ protected:
    */
   virtual real64 dot( Vector const & vec ) const = 0;
 
+  /**
+   * @brief Dot product with the vector vec restricted to the locally owned entries.
+   * @param vec vector to dot-product with
+   * @return the local contribution to the dot product (no global reduction is performed)
+   *
+   * Used by communication-avoiding algorithms that combine several dot products into a single reduction.
+   */
+  real64 localDot( Vector const & vec ) const
+  {
+    GEOS_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+    arrayView1d< real64 const > const x = values();
+    arrayView1d< real64 const > const y = vec.values();
+    RAJA::ReduceSum< parallelDeviceReduce, real64 > result( 0.0 );
+    forAll< parallelDevicePolicy<> >( x.size(), [x, y, result] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      result += x[i] * y[i];
+    } );
+    return result.get();
+  }
+
   /**
    * @brief Update vector <tt>y</tt> as <tt>y</tt> = <tt>x</tt>.
    * @param x vector to copy
@@ -120,26 +120,29 @@ void factorize( SuiteSparseData & data, LinearSolverParameters const & params )
   data.colIndices.move( hostMemorySpace, false );
   data.values.move( hostMemorySpace, false );
 
-  // symbolic factorization
-  status = umfpack_dl_symbolic( numRows,
-                                numRows,
-                                data.rowPtr.data(),
-                                data.colIndices.data(),
-                                data.values.data(),
-                                &data.symbolic,
-                                data.control,
-                                data.info );
-  if( status < 0 )
+  // symbolic factorization, unless the one of a matrix with the same sparsity pattern has been kept
+  if( !data.symbolic )
   {
-    umfpack_dl_report_info( data.control, data.info );
-    umfpack_dl_report_status( data.control, status );
-    GEOS_ERROR( "SuiteSparse: umfpack_dl_symbolic failed." );
-  }
+    status = umfpack_dl_symbolic( numRows,
+                                  numRows,
+                                  data.rowPtr.data(),
+                                  data.colIndices.data(),
+                                  data.values.data(),
+                                  &data.symbolic,
+                                  data.control,
+                                  data.info );
+    if( status < 0 )
+    {
+      umfpack_dl_report_info( data.control, data.info );
+      umfpack_dl_report_status( data.control, status );
+      GEOS_ERROR( "SuiteSparse: umfpack_dl_symbolic failed." );
+    }
 
-  // print the symbolic factorization
-  if( params.logLevel > 1 )
-  {
-    umfpack_dl_report_symbolic( data.symbolic, data.control );
+    // print the symbolic factorization
+    if( params.logLevel > 1 )
+    {
+      umfpack_dl_report_symbolic( data.symbolic, data.control );
+    }
   }
 
   // numeric factorization
@@ -165,6 +168,20 @@ void factorize( SuiteSparseData & data, LinearSolverParameters const & params )
   }
 }
 
+/**
+ * @brief Check whether two matrices exported in CSR format have the same sparsity pattern.
+ * @param lhs the first matrix
+ * @param rhs the second matrix
+ * @return true if the row pointers and the column indices are identical
+ */
+bool samePattern( SuiteSparseData const & lhs, SuiteSparseData const & rhs )
+{
+  return lhs.rowPtr.size() == rhs.rowPtr.size() &&
+         lhs.colIndices.size() == rhs.colIndices.size() &&
+         std::equal( lhs.rowPtr.begin(), lhs.rowPtr.end(), rhs.rowPtr.begin() ) &&
+         std::equal( lhs.colIndices.begin(), lhs.colIndices.end(), rhs.colIndices.begin() );
+}
+
 void setOptions( SuiteSparseData & data, LinearSolverParameters const & params )
 {
   // Get the default control parameters
@@ -178,6 +195,8 @@ void setOptions( SuiteSparseData & data, LinearSolverParameters const & params )
 template< typename LAI >
 void SuiteSparse< LAI >::setup( Matrix const & mat )
 {
+  // The previous factorization is kept aside, so that its symbolic analysis can be reused
+  std::unique_ptr< SuiteSparseData > previous = m_params.direct.reuseSymbolic ? std::move( m_data ) : nullptr;
   clear();
   PreconditionerBase< LAI >::setup( mat );
 
@@ -205,6 +224,11 @@ void SuiteSparse< LAI >::setup( Matrix const & mat )
   if( rank == m_workingRank )
   {
     Stopwatch timer( m_result.setupTime );
+    if( previous && previous->symbolic && samePattern( *previous, *m_data ) )
+    {
+      std::swap( m_data->symbolic, previous->symbolic );
+    }
+    previous.reset();
     factorize( *m_data, m_params );
   }
 
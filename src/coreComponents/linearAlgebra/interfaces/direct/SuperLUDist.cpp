@@ -113,6 +113,8 @@ struct SuperLUDistData
   array1d< int_t > colIndices{};      ///< column indices
   array1d< double > values{};         ///< values
   array1d< double > rhs{};            ///< rhs/solution vector values
+  array1d< int_t > patternRowPtr{};     ///< row pointers of the factorized matrix, kept for symbolic reuse
+  array1d< int_t > patternColIndices{}; ///< column indices of the factorized matrix, kept for symbolic reuse
   SuperMatrix mat{};                  ///< SuperLU_Dist matrix format
   dScalePermstruct_t scalePerm{};     ///< data structure to scale and permute the matrix
   dLUstruct_t lu{};                   ///< data structure to store the LU factorization
@@ -172,21 +174,59 @@ SuperLUDist< LAI >::~SuperLUDist() = default;
 template< typename LAI >
 void SuperLUDist< LAI >::setup( Matrix const & mat )
 {
-  clear();
-  Base::setup( mat );
-
   int_t const numGR = LvArray::integerConversion< int_t >( mat.numGlobalRows() );
   int_t const numLR = LvArray::integerConversion< int_t >( mat.numLocalRows() );
   int_t const numNZ = LvArray::integerConversion< int_t >( mat.numLocalNonzeros() );
 
-  m_data = std::make_unique< SuperLUDistData >( numGR, numLR, numNZ, mat.comm() );
-  setOptions();
-
+  array1d< int_t > rowPtr( numLR + 1 );
+  array1d< int_t > colIndices( numNZ );
+  array1d< double > values( numNZ );
   typename Matrix::Export matExport;
-  matExport.exportCRS( mat, m_data->rowPtr, m_data->colIndices, m_data->values );
-  m_data->rowPtr.move( hostMemorySpace, false );
-  m_data->colIndices.move( hostMemorySpace, false );
-  m_data->values.move( hostMemorySpace, false );
+  matExport.exportCRS( mat, rowPtr, colIndices, values );
+  rowPtr.move( hostMemorySpace, false );
+  colIndices.move( hostMemorySpace, false );
+  values.move( hostMemorySpace, false );
+
+  // The column permutation and the symbolic analysis are kept when all the ranks see the same sparsity pattern
+  bool samePattern = m_params.direct.reuseSymbolic && m_data &&
+                     m_data->mat.nrow == numGR &&
+                     m_data->patternRowPtr.size() == rowPtr.size() &&
+                     m_data->patternColIndices.size() == colIndices.size() &&
+                     std::equal( rowPtr.begin(), rowPtr.end(), m_data->patternRowPtr.begin() ) &&
+                     std::equal( colIndices.begin(), colIndices.end(), m_data->patternColIndices.begin() );
+  samePattern = MpiWrapper::min( samePattern ? 1 : 0, mat.comm() ) == 1;
+
+  if( samePattern )
+  {
+    Base::setup( mat );
+    m_condEst = -1.0;
+
+    // Release the previous numeric factors and matrix wrapper, the permutations being reused
+    SUPERLU_FREE( (NRformat_loc *)m_data->mat.Store );
+    m_data->mat.Store = nullptr;
+    dDestroy_LU( numGR, &m_data->grid, &m_data->lu );
+    if( m_data->options.SolveInitialized )
+    {
+      dSolveFinalize( &m_data->options, &m_data->solve );
+    }
+  }
+  else
+  {
+    clear();
+    Base::setup( mat );
+    m_data = std::make_unique< SuperLUDistData >( numGR, numLR, numNZ, mat.comm() );
+    setOptions();
+  }
+
+  if( m_params.direct.reuseSymbolic )
+  {
+    // the matrix arrays are modified by the factorization (e.g. scaling), so the pattern is kept separately
+    m_data->patternRowPtr = rowPtr;
+    m_data->patternColIndices = colIndices;
+  }
+  m_data->rowPtr = std::move( rowPtr );
+  m_data->colIndices = std::move( colIndices );
+  m_data->values = std::move( values );
 
   dCreate_CompRowLoc_Matrix_dist( &m_data->mat,
                                   numGR,
@@ -203,7 +243,7 @@ void SuperLUDist< LAI >::setup( Matrix const & mat )
 
   {
     Stopwatch timer( m_result.setupTime );
-    factorize();
+    factorize( samePattern );
   }
 }
 
@@ -335,14 +375,14 @@ void SuperLUDist< LAI >::setOptions()
 }
 
 template< typename LAI >
-void SuperLUDist< LAI >::factorize()
+void SuperLUDist< LAI >::factorize( bool const samePattern )
 {
   // To be able to use SuperLU_Dist solver we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
   // Call the linear equation solver to factorize the matrix.
   int info = 0;
-  m_data->options.Fact = DOFACT;
+  m_data->options.Fact = samePattern ? SamePattern : DOFACT;
   pdgssvx( &m_data->options,
            &m_data->mat,
            &m_data->scalePerm,
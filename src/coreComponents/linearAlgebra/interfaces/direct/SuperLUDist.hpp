@@ -104,8 +104,9 @@ private:
 
   /**
    * @brief Perform symbolic/numeric factorization of the matrix.
+   * @param samePattern whether the column permutation and the symbolic analysis of the previous factorization are reused
    */
-  void factorize();
+  void factorize( bool const samePattern );
 
   /**
    * @brief Estimates the condition number of the matrix using LU factors.
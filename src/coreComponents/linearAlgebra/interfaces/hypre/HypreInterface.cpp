@@ -23,6 +23,8 @@
 #include "linearAlgebra/interfaces/hypre/HyprePreconditioner.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreSolver.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreUtils.hpp"
+#include "linearAlgebra/solvers/CprPreconditioner.hpp"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
 
 #if defined(GEOSX_USE_SUPERLU_DIST)
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
@@ -92,6 +94,14 @@ HypreInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< HypreInterface > >
 geos::HypreInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    return std::make_unique< CprPreconditioner< HypreInterface > >( std::move( params ) );
+  }
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::gmg )
+  {
+    return std::make_unique< GeometricMultigridPreconditioner< HypreInterface > >( std::move( params ) );
+  }
   return std::make_unique< HyprePreconditioner >( std::move( params ) );
 }
 
@@ -180,6 +180,17 @@ void hypre::mgr::createMGR( LinearSolverParameters const & params,
     }
   }
 
+  if( params.logLevel >= 1 && params.mgr.configuration > 0 )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "        MGR preconditioner: configuration = {}", params.mgr.configuration ) );
+  }
+
+  // The agglomeration of the coarse levels applies to the AMG coarse solver of every strategy
+  if( mgrData.coarseSolver.setup == HYPRE_BoomerAMGSetup )
+  {
+    hypre::setAMGCoarseAgglomeration( params.amg, mgrData.coarseSolver.ptr );
+  }
+
   GEOS_LAI_CHECK_ERROR( HYPRE_MGRSetCoarseSolver( precond.ptr,
                                                   mgrData.coarseSolver.solve,
                                                   mgrData.coarseSolver.setup,
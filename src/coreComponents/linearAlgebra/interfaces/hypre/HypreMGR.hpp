@@ -62,6 +62,7 @@ void setStrategy( LinearSolverParameters::MGR const & params,
 {
   STRATEGY strategy( numComponentsPerField );
   strategy.setup( params, precond, mgrData );
+  strategy.setupConfiguration( params, precond );
 }
 
 /**
@@ -75,6 +76,52 @@ public:
 
   static constexpr HYPRE_Int numLevels = NLEVEL;       ///< Number of levels
 
+  /**
+   * @brief Apply the candidate configuration of the adaptive mode on top of the strategy setup.
+   * @param params MGR parameters
+   * @param precond the preconditioner wrapper
+   *
+   * Each configuration is more robust (and more expensive) than the previous one. The smoothers chosen
+   * by the strategy are kept: the second configuration adds a block Jacobi global smoothing sweep only
+   * to the strategies without smoothing, and adds a sweep to the smoothers of the other strategies.
+   */
+  void setupConfiguration( LinearSolverParameters::MGR const & params,
+                           HyprePrecWrapper & precond )
+  {
+    if( params.configuration >= 1 )
+    {
+      // Two F-relaxation sweeps on every level
+      GEOS_LAI_CHECK_ERROR( HYPRE_MGRSetNumRelaxSweeps( precond.ptr, 2 ) );
+    }
+    if( params.configuration >= 2 )
+    {
+      bool hasLevelSmoother = false;
+      for( HYPRE_Int i = 0; i < numLevels; ++i )
+      {
+        if( m_levelSmoothIters[i] > 0 )
+        {
+          hasLevelSmoother = true;
+          ++m_levelSmoothIters[i];
+        }
+      }
+
+      if( hasLevelSmoother )
+      {
+        GEOS_LAI_CHECK_ERROR( HYPRE_MGRSetLevelSmoothIters( precond.ptr, m_levelSmoothIters ) );
+      }
+      else if( m_numGlobalSmoothSweeps > 0 )
+      {
+        GEOS_LAI_CHECK_ERROR( HYPRE_MGRSetMaxGlobalSmoothIters( precond.ptr, m_numGlobalSmoothSweeps + 1 ) );
+      }
+      else
+      {
+        // One block Jacobi global smoothing sweep on the first level
+        GEOS_LAI_CHECK_ERROR( HYPRE_MGRSetGlobalSmoothType( precond.ptr, toUnderlying( MGRGlobalSmootherType::blockJacobi ) ) );
+        GEOS_LAI_CHECK_ERROR( HYPRE_MGRSetMaxGlobalSmoothIters( precond.ptr, 1 ) );
+      }
+    }
+  }
+
 protected:
 
   HYPRE_Int m_numBlocks{ 0 };                          ///< Number of different matrix blocks treated separately
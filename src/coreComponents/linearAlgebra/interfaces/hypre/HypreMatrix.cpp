@@ -97,6 +97,7 @@ HypreMatrix & HypreMatrix::operator=( HypreMatrix && src ) noexcept
   {
     std::swap( m_ij_mat, src.m_ij_mat );
     std::swap( m_parcsr_mat, src.m_parcsr_mat );
+    std::swap( m_valueMap, src.m_valueMap );
     MatrixBase::operator=( std::move( src ) );
   }
   return *this;
@@ -152,6 +153,16 @@ void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const
 {
   GEOS_MARK_FUNCTION;
 
+  // When the sparsity pattern is unchanged since the last creation, write the values in place,
+  // avoiding the reconstruction of the IJ matrix and its communication package
+  if( !m_valueMap.empty() && ready() &&
+      numLocalRows() == localMatrix.numRows() &&
+      numLocalCols() == numLocalColumns &&
+      updateValues( localMatrix ) )
+  {
+    return;
+  }
+
   RAJA::ReduceMax< ReducePolicy< hypre::execPolicy >, localIndex > maxRowEntries( 0 );
   forAll< hypre::execPolicy >( localMatrix.numRows(),
                                [localMatrix, maxRowEntries] GEOS_HYPRE_DEVICE ( localIndex const row )
@@ -195,6 +206,155 @@ void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const
                                                     localMatrix.getColumns(),
                                                     localMatrix.getEntries() ) );
   close();
+
+  computeValueMap( localMatrix );
+}
+
+void HypreMatrix::computeValueMap( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOS_MARK_FUNCTION;
+
+  RAJA::ReduceMax< ReducePolicy< hypre::execPolicy >, localIndex > storageSize( 0 );
+  forAll< hypre::execPolicy >( localMatrix.numRows(),
+                               [localMatrix, storageSize] GEOS_HYPRE_DEVICE ( localIndex const row )
+  {
+    storageSize.max( localMatrix.getOffsets()[row + 1] );
+  } );
+
+  m_valueMap.resizeWithoutInitializationOrDestruction( hypre::memorySpace, storageSize.get() );
+  m_valueMap.setValues< hypre::execPolicy >( -1 );
+
+  hypre::CSRData< true > const diag{ hypre_ParCSRMatrixDiag( m_parcsr_mat ) };
+  hypre::CSRData< true > const offd{ hypre_ParCSRMatrixOffd( m_parcsr_mat ) };
+  HYPRE_BigInt const * const colMap = hypre::getOffdColumnMap( m_parcsr_mat );
+  HYPRE_BigInt const firstLocalCol = hypre_ParCSRMatrixFirstColDiag( m_parcsr_mat );
+
+  RAJA::ReduceMax< ReducePolicy< hypre::execPolicy >, integer > missing( 0 );
+  forAll< hypre::execPolicy >( localMatrix.numRows(),
+                               [localMatrix, diag, offd, colMap, firstLocalCol, missing,
+                                valueMap = m_valueMap.toView()] GEOS_HYPRE_DEVICE ( localIndex const row )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+    localIndex const offset = localMatrix.getOffsets()[row];
+    for( localIndex k = 0; k < columns.size(); ++k )
+    {
+      localIndex pos = -1;
+      HYPRE_BigInt const col = LvArray::integerConversion< HYPRE_BigInt >( columns[k] );
+      if( col >= firstLocalCol && col < firstLocalCol + diag.ncol )
+      {
+        HYPRE_Int const localCol = LvArray::integerConversion< HYPRE_Int >( col - firstLocalCol );
+        for( HYPRE_Int j = diag.rowptr[row]; j < diag.rowptr[row + 1]; ++j )
+        {
+          if( diag.colind[j] == localCol )
+          {
+            pos = j;
+            break;
+          }
+        }
+      }
+      else if( offd.ncol > 0 )
+      {
+        // the offd column map is sorted
+        HYPRE_Int lo = 0;
+        HYPRE_Int hi = offd.ncol;
+        while( lo < hi )
+        {
+          HYPRE_Int const mid = lo + ( hi - lo ) / 2;
+          if( colMap[mid] < col )
+          {
+            lo = mid + 1;
+          }
+          else
+          {
+            hi = mid;
+          }
+        }
+        if( lo < offd.ncol && colMap[lo] == col )
+        {
+          for( HYPRE_Int j = offd.rowptr[row]; j < offd.rowptr[row + 1]; ++j )
+          {
+            if( offd.colind[j] == lo )
+            {
+              pos = diag.nnz + j;
+              break;
+            }
+          }
+        }
+      }
+      if( pos < 0 )
+      {
+        missing.max( 1 );
+      }
+      valueMap[offset + k] = pos;
+    }
+  } );
+
+  // Entries dropped by hypre cannot be updated in place
+  if( missing.get() )
+  {
+    m_valueMap.clear();
+  }
+}
+
+bool HypreMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOS_MARK_FUNCTION;
+
+  hypre::CSRData< false > const diag{ hypre_ParCSRMatrixDiag( m_parcsr_mat ) };
+  hypre::CSRData< false > const offd{ hypre_ParCSRMatrixOffd( m_parcsr_mat ) };
+  HYPRE_BigInt const * const colMap = hypre::getOffdColumnMap( m_parcsr_mat );
+  HYPRE_BigInt const firstLocalCol = hypre_ParCSRMatrixFirstColDiag( m_parcsr_mat );
+
+  // Entries of the ParCSR matrix absent from the local matrix (e.g. an explicit zero diagonal) must be zero
+  forAll< hypre::execPolicy >( diag.nnz, [diag] GEOS_HYPRE_DEVICE ( HYPRE_Int const j )
+  {
+    diag.values[j] = 0.0;
+  } );
+  forAll< hypre::execPolicy >( offd.nnz, [offd] GEOS_HYPRE_DEVICE ( HYPRE_Int const j )
+  {
+    offd.values[j] = 0.0;
+  } );
+
+  // Copy the values, checking that each entry lands in the expected column
+  RAJA::ReduceMax< ReducePolicy< hypre::execPolicy >, integer > mismatch( 0 );
+  forAll< hypre::execPolicy >( localMatrix.numRows(),
+                               [localMatrix, diag, offd, colMap, firstLocalCol, mismatch,
+                                valueMap = m_valueMap.toViewConst()] GEOS_HYPRE_DEVICE ( localIndex const row )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+    arraySlice1d< real64 const > const entries = localMatrix.getEntries( row );
+    localIndex const offset = localMatrix.getOffsets()[row];
+    for( localIndex k = 0; k < columns.size(); ++k )
+    {
+      localIndex const pos = offset + k < valueMap.size() ? valueMap[offset + k] : -1;
+      if( pos < 0 )
+      {
+        mismatch.max( 1 );
+      }
+      else if( pos < diag.nnz )
+      {
+        if( diag.colind[pos] + firstLocalCol != columns[k] )
+        {
+          mismatch.max( 1 );
+        }
+        diag.values[pos] = entries[k];
+      }
+      else
+      {
+        localIndex const j = pos - diag.nnz;
+        if( j >= offd.nnz || colMap[offd.colind[j]] != columns[k] )
+        {
+          mismatch.max( 1 );
+        }
+        else
+        {
+          offd.values[j] = entries[k];
+        }
+      }
+    }
+  } );
+
+  return mismatch.get() == 0;
 }
 
 void HypreMatrix::createWithLocalSize( localIndex const localRows,
@@ -237,6 +397,7 @@ void HypreMatrix::set( real64 const value )
 void HypreMatrix::reset()
 {
   MatrixBase::reset();
+  m_valueMap.clear();
   if( m_ij_mat )
   {
     GEOS_LAI_CHECK_ERROR( HYPRE_IJMatrixDestroy( m_ij_mat ) );
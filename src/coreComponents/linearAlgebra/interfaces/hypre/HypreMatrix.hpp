@@ -416,6 +416,19 @@ private:
    */
   void parCSRtoIJ( HYPRE_ParCSRMatrix const & parCSRMatrix );
 
+  /**
+   * @brief Compute the position of each entry of a local matrix in the diag/offd storage of the ParCSR matrix.
+   * @param localMatrix the local matrix from which this matrix has just been created
+   */
+  void computeValueMap( CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Copy the values of a local matrix directly into the diag/offd storage of the ParCSR matrix.
+   * @param localMatrix the local matrix, with the same sparsity pattern as the one used in the last full creation
+   * @return true if the pattern matched and the values were copied, false if a full creation is needed
+   */
+  bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
   /**
    * Pointer to underlying HYPRE_IJMatrix type.
    */
@@ -426,6 +439,12 @@ private:
    */
   HYPRE_ParCSRMatrix m_parcsr_mat{};
 
+  /**
+   * Position in the diag (or offd, shifted by the number of diag nonzeros) storage of each entry
+   * of the local matrix used in the last full creation, -1 for unused capacity.
+   */
+  array1d< localIndex > m_valueMap;
+
 };
 
 } // namespace geos
@@ -223,6 +223,9 @@ void createAMG( LinearSolverParameters const & params,
     GEOS_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetStrongThreshold( precond.ptr, params.amg.threshold ) );
   }
 
+  // Gather the coarse levels on fewer ranks
+  hypre::setAMGCoarseAgglomeration( params.amg, precond.ptr );
+
   precond.setup = HYPRE_BoomerAMGSetup;
   precond.solve = HYPRE_BoomerAMGSolve;
   precond.destroy = HYPRE_BoomerAMGDestroy;
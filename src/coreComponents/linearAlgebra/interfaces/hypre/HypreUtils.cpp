@@ -18,6 +18,7 @@
 
 #include "HypreUtils.hpp"
 
+#include "linearAlgebra/common/common.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreVector.hpp"
 
 #include <_hypre_parcsr_mv.h>
@@ -172,6 +173,28 @@ HYPRE_Int relaxationDestroy( HYPRE_Solver solver )
   return 0;
 }
 
+void setAMGCoarseAgglomeration( LinearSolverParameters::AMG const & params,
+                                HYPRE_Solver const solver )
+{
+  if( params.coarseAgglomerationSize > 0 )
+  {
+#if GEOS_USE_HYPRE_DEVICE == GEOS_USE_HYPRE_CPU
+    GEOS_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetSeqThreshold( solver, LvArray::integerConversion< HYPRE_Int >( params.coarseAgglomerationSize ) ) );
+    GEOS_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetRedundant( solver, params.coarseRedundant ) );
+#else
+    GEOS_ERROR( "Hypre/AMG: the agglomeration of the coarse levels is not supported by the device build of hypre" );
+#endif
+  }
+  if( params.coarseSuperLUDistSize > 0 )
+  {
+#if defined(HYPRE_USING_DSUPERLU)
+    GEOS_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetDSLUThreshold( solver, LvArray::integerConversion< HYPRE_Int >( params.coarseSuperLUDistSize ) ) );
+#else
+    GEOS_ERROR( "Hypre/AMG: the SuperLU_Dist coarse solver requires hypre built with SuperLU_Dist" );
+#endif
+  }
+}
+
 } // namespace hypre
 
 } // namespace geos
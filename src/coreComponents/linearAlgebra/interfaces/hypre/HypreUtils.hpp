@@ -283,6 +283,17 @@ HYPRE_Int relaxationSolve( HYPRE_Solver solver,
  */
 HYPRE_Int relaxationDestroy( HYPRE_Solver solver );
 
+/**
+ * @brief Set the agglomeration of the coarse levels of a BoomerAMG solver.
+ * @param params the AMG parameters
+ * @param solver the BoomerAMG solver
+ * @details Below the agglomeration size, the coarse levels are gathered on a single rank, or on all of them
+ *          if the coarse solve is redundant, so that the few rows left on each rank stop costing a message per level.
+ *          Below the SuperLU_Dist size, the coarsest level is solved with SuperLU_Dist.
+ */
+void setAMGCoarseAgglomeration( LinearSolverParameters::AMG const & params,
+                                HYPRE_Solver const solver );
+
 /**
  * @brief Returns hypre's identifier of the AMG cycle type.
  * @param type AMG cycle type
@@ -22,6 +22,8 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscPreconditioner.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscSolver.hpp"
+#include "linearAlgebra/solvers/CprPreconditioner.hpp"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
 
 #include <petscsys.h>
 
@@ -64,6 +66,14 @@ PetscInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< PetscInterface > >
 PetscInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    return std::make_unique< CprPreconditioner< PetscInterface > >( std::move( params ) );
+  }
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::gmg )
+  {
+    return std::make_unique< GeometricMultigridPreconditioner< PetscInterface > >( std::move( params ) );
+  }
   return std::make_unique< PetscPreconditioner >( params );
 }
 
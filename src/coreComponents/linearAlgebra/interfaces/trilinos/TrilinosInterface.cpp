@@ -22,6 +22,8 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosPreconditioner.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosSolver.hpp"
+#include "linearAlgebra/solvers/CprPreconditioner.hpp"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
 
 namespace geos
 {
@@ -55,6 +57,14 @@ TrilinosInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< TrilinosInterface > >
 TrilinosInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    return std::make_unique< CprPreconditioner< TrilinosInterface > >( std::move( params ) );
+  }
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::gmg )
+  {
+    return std::make_unique< GeometricMultigridPreconditioner< TrilinosInterface > >( std::move( params ) );
+  }
   return std::make_unique< TrilinosPreconditioner >( params );
 }
 
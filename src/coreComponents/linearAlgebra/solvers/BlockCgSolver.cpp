@@ -0,0 +1,280 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCgSolver.cpp
+ */
+
+#include "BlockCgSolver.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/Stopwatch.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "common/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geos
+{
+
+template< typename VECTOR >
+BlockCgSolver< VECTOR >::BlockCgSolver( LinearSolverParameters params,
+                                        LinearOperator< Vector > const & A,
+                                        LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M )
+{
+  GEOS_ERROR_IF( !m_params.isSymmetric, "Cannot use block CG solver with a non-symmetric system" );
+}
+
+template< typename VECTOR >
+void BlockCgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  solve( std::vector< Vector const * >{ &b }, std::vector< Vector * >{ &x } );
+}
+
+namespace
+{
+
+/**
+ * @brief Compute the local part of the s x s matrix of dot products D(i,j) = (u_i, v_j).
+ * @tparam VECTOR_ARRAY type of the arrays of vectors
+ * @param u the first set of vectors
+ * @param v the second set of vectors
+ * @param dots the buffer, whose entries [offset, offset + s*s) are filled row by row
+ * @param offset position of the matrix in the buffer
+ */
+template< typename VECTOR_ARRAY >
+void localDots( VECTOR_ARRAY const & u,
+                VECTOR_ARRAY const & v,
+                array1d< real64 > & dots,
+                localIndex const offset )
+{
+  localIndex const s = u.size();
+  for( localIndex i = 0; i < s; ++i )
+  {
+    for( localIndex j = 0; j < s; ++j )
+    {
+      dots[offset + i * s + j] = u[i].localDot( v[j] );
+    }
+  }
+}
+
+/**
+ * @brief Unpack an s x s matrix from a reduction buffer.
+ * @param dots the buffer
+ * @param offset position of the matrix in the buffer
+ * @param mat the matrix
+ */
+void unpack( array1d< real64 > const & dots,
+             localIndex const offset,
+             array2d< real64 > & mat )
+{
+  localIndex const s = mat.size( 0 );
+  for( localIndex i = 0; i < s; ++i )
+  {
+    for( localIndex j = 0; j < s; ++j )
+    {
+      mat( i, j ) = dots[offset + i * s + j];
+    }
+  }
+}
+
+/**
+ * @brief Compute C = A^{-1} B for small dense matrices.
+ * @param A the matrix to invert
+ * @param B the right-hand side matrix
+ * @param work workspace of the size of @p A
+ * @param C the result
+ */
+void solveDense( array2d< real64 > const & A,
+                 array2d< real64 > const & B,
+                 array2d< real64 > & work,
+                 array2d< real64 > & C )
+{
+  BlasLapackLA::matrixInverse( A, work );
+  BlasLapackLA::matrixMatrixMultiply( work, B, C );
+}
+
+}
+
+// ----------------------------
+// Block solve method
+// ----------------------------
+// With s right-hand sides gathered in the columns of X and B, and the
+// s x s dense coefficient matrices alpha and beta:
+//   R = B - AX, Z = MR, P = Z
+//   Q = AP, alpha = (P^T Q)^{-1} (Z^T R)
+//   X += P alpha, R -= Q alpha, Z = MR
+//   beta = (Z^T R)_old^{-1} (Z^T R), P = Z + P beta
+// The products of P^T Q on one hand, and of Z^T R together with the
+// residual norms on the other hand, are each reduced in a single call.
+template< typename VECTOR >
+void BlockCgSolver< VECTOR >::solve( std::vector< Vector const * > const & b,
+                                     std::vector< Vector * > const & x ) const
+{
+  GEOS_LAI_ASSERT_EQ( b.size(), x.size() );
+  GEOS_LAI_ASSERT( !b.empty() );
+
+  Stopwatch watch;
+
+  integer const s = LvArray::integerConversion< integer >( b.size() );
+  Vector const & b0 = *b[0];
+  MPI_Comm const comm = b0.comm();
+
+  array1d< VectorTemp > R( s );
+  array1d< VectorTemp > Z( s );
+  array1d< VectorTemp > P( s );
+  array1d< VectorTemp > Q( s );
+  array1d< VectorTemp > W( s );
+  for( integer j = 0; j < s; ++j )
+  {
+    R[j] = createTempVector( b0 );
+    Z[j] = createTempVector( b0 );
+    P[j] = createTempVector( b0 );
+    Q[j] = createTempVector( b0 );
+    W[j] = createTempVector( b0 );
+
+    // Compute initial R = B - AX and Z = MR
+    m_operator.residual( *x[j], *b[j], R[j] );
+    m_precond.apply( R[j], Z[j] );
+    P[j].copy( Z[j] );
+  }
+
+  // Reduction buffers: Z^T R followed by the squared residual norms, and P^T Q
+  array1d< real64 > dotsZR( s * s + s );
+  array1d< real64 > dotsPQ( s * s );
+
+  // Dense coefficient matrices
+  array2d< real64 > gamma( s, s );
+  array2d< real64 > gamma_old( s, s );
+  array2d< real64 > pAp( s, s );
+  array2d< real64 > alpha( s, s );
+  array2d< real64 > beta( s, s );
+  array2d< real64 > work( s, s );
+
+  array1d< real64 > rnorm0( s );
+
+  auto const reduceZR = [&]()
+  {
+    localDots( Z, R, dotsZR, 0 );
+    for( integer j = 0; j < s; ++j )
+    {
+      dotsZR[s * s + j] = R[j].localDot( R[j] );
+    }
+    MpiWrapper::allReduce( dotsZR.data(), dotsZR.data(), s * s + s, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), comm );
+    unpack( dotsZR, 0, gamma );
+  };
+
+  reduceZR();
+  for( integer j = 0; j < s; ++j )
+  {
+    rnorm0[j] = std::sqrt( dotsZR[s * s + j] );
+  }
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+  real64 maxReduction = 0.0;
+
+  integer & k = m_result.numIterations;
+  for( k = 0; k <= m_params.krylov.maxIterations; ++k )
+  {
+    // Convergence check on ||r_j||/||b_j|| for all columns
+    real64 rnorm2 = 0.0;
+    maxReduction = 0.0;
+    for( integer j = 0; j < s; ++j )
+    {
+      real64 const rnorm = std::sqrt( dotsZR[s * s + j] );
+      rnorm2 += rnorm * rnorm;
+      maxReduction = std::max( maxReduction, rnorm0[j] > 0.0 ? rnorm / rnorm0[j] : 0.0 );
+    }
+    m_residualNorms.emplace_back( std::sqrt( rnorm2 ) );
+    logProgress();
+
+    if( maxReduction <= m_params.krylov.relTolerance )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Compute Q = AP and alpha = (P^T Q)^{-1} (Z^T R)
+    for( integer j = 0; j < s; ++j )
+    {
+      m_operator.apply( P[j], Q[j] );
+    }
+    localDots( P, Q, dotsPQ, 0 );
+    MpiWrapper::allReduce( dotsPQ.data(), dotsPQ.data(), s * s, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), comm );
+    unpack( dotsPQ, 0, pAp );
+    real64 const detPAp = BlasLapackLA::determinant( pAp );
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( detPAp )
+    solveDense( pAp, gamma, work, alpha );
+
+    // Update X = X + P alpha and R = R - Q alpha
+    for( integer j = 0; j < s; ++j )
+    {
+      for( integer i = 0; i < s; ++i )
+      {
+        x[j]->axpy( alpha( i, j ), P[i] );
+        R[j].axpy( -alpha( i, j ), Q[i] );
+      }
+    }
+
+    // Update Z = MR and compute Z^T R along with the residual norms
+    for( integer j = 0; j < s; ++j )
+    {
+      m_precond.apply( R[j], Z[j] );
+    }
+    BlasLapackLA::matrixCopy( gamma, gamma_old );
+    reduceZR();
+
+    // Compute beta = (Z^T R)_old^{-1} (Z^T R) and P = Z + P beta
+    real64 const detGamma = BlasLapackLA::determinant( gamma_old );
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( detGamma )
+    solveDense( gamma_old, gamma, work, beta );
+    for( integer j = 0; j < s; ++j )
+    {
+      W[j].copy( Z[j] );
+      for( integer i = 0; i < s; ++i )
+      {
+        W[j].axpy( beta( i, j ), P[i] );
+      }
+    }
+    std::swap( P, W );
+  }
+
+  m_result.residualReduction = maxReduction;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class BlockCgSolver< TrilinosInterface::ParallelVector >;
+template class BlockCgSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class BlockCgSolver< HypreInterface::ParallelVector >;
+template class BlockCgSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class BlockCgSolver< PetscInterface::ParallelVector >;
+template class BlockCgSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} //namespace geos
@@ -0,0 +1,115 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCgSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_BLOCKCGSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_BLOCKCGSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+#include <vector>
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the block Conjugate Gradient method
+ *        for several right-hand sides sharing the same operator.
+ * @tparam VECTOR type of vectors this solver operates on.
+ * @note  The recurrences are those of "The block conjugate gradient algorithm
+ *        and related methods" from D. P. O'Leary (1980).
+ *
+ * The search space of each right-hand side is enriched with the directions of the other ones,
+ * and all the dot products of an iteration are packed in a single reduction of s x s values
+ * for s right-hand sides, instead of s separate reductions.
+ */
+template< typename VECTOR >
+class BlockCgSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for template parameter
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Constructor.
+   * @param [in] params parameters for the solver
+   * @param [in] A reference to the system matrix.
+   * @param [in] M reference to the preconditioning operator.
+   */
+  BlockCgSolver( LinearSolverParameters params,
+                 LinearOperator< Vector > const & A,
+                 LinearOperator< Vector > const & M );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "block CG";
+  };
+
+  ///@}
+
+  /**
+   * @brief Solve preconditioned system with several right-hand sides
+   * @param [in] b system right hand sides.
+   * @param [inout] x system solutions (input = initial guesses, output = solutions).
+   *
+   * The iterations stop when the relative residual of every right-hand side is below the tolerance.
+   * The residual norm recorded at each iteration is the Frobenius norm of the block residual.
+   */
+  void solve( std::vector< Vector const * > const & b, std::vector< Vector * > const & x ) const;
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_result;
+  using Base::m_residualNorms;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+};
+
+} // namespace geos
+
+#endif /*GEOS_LINEARALGEBRA_SOLVERS_BLOCKCGSOLVER_HPP_*/
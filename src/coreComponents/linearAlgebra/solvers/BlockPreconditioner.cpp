@@ -226,6 +226,18 @@ void BlockPreconditioner< LAI >::apply( Vector const & src,
   m_prolongators[1].gemv( 1.0, m_sol( 1 ), 1.0, dst );
 }
 
+template< typename LAI >
+void BlockPreconditioner< LAI >::relaxAccuracy( real64 const factor ) const
+{
+  for( localIndex i = 0; i < 2; ++i )
+  {
+    if( m_solvers[i] )
+    {
+      m_solvers[i]->relaxAccuracy( factor );
+    }
+  }
+}
+
 template< typename LAI >
 void BlockPreconditioner< LAI >::clear()
 {
@@ -165,6 +165,12 @@ public:
 
   virtual void clear() override;
 
+  /**
+   * @brief Relax the accuracy of the block solvers.
+   * @param factor the relaxation factor, passed on to both block solvers
+   */
+  virtual void relaxAccuracy( real64 const factor ) const override;
+
   ///@}
 
 private:
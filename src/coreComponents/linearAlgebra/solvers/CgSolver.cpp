@@ -20,6 +20,7 @@
 
 #include "CgSolver.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "common/Stopwatch.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "common/LinearOperator.hpp"
@@ -56,6 +57,19 @@ CgSolver< VECTOR >::CgSolver( LinearSolverParameters params,
 // ----------------------------
 template< typename VECTOR >
 void CgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  if( m_params.solverType == LinearSolverParameters::SolverType::pipecg )
+  {
+    solvePipelined( b, x );
+  }
+  else
+  {
+    solveClassical( b, x );
+  }
+}
+
+template< typename VECTOR >
+void CgSolver< VECTOR >::solveClassical( Vector const & b, Vector & x ) const
 {
   Stopwatch watch;
 
@@ -131,6 +145,117 @@ void CgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
   logResult();
 }
 
+// ----------------------------
+// Pipelined solve method
+// ----------------------------
+// The recurrences of Ghysels and Vanroose (2014) additionally carry u = Mr, w = Au
+// and their updates, so that the reduction of (r,r), (u,r) and (w,u) can proceed
+// while m = Mw and n = Am are computed.
+template< typename VECTOR >
+void CgSolver< VECTOR >::solvePipelined( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Define residual vector and compute initial rk =  b - Ax
+  VectorTemp r = createTempVector( b );
+  m_operator.residual( x, b, r );
+
+  // Preconditioned residual and its image by the operator
+  VectorTemp u = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  m_precond.apply( r, u );
+  m_operator.apply( u, w );
+
+  // Vectors overlapped with the reduction
+  VectorTemp m = createTempVector( b );
+  VectorTemp n = createTempVector( b );
+
+  // Search direction and its recurrences
+  VectorTemp p = createTempVector( b );
+  VectorTemp s = createTempVector( b );
+  VectorTemp q = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+  p.zero();
+  s.zero();
+  q.zero();
+  z.zero();
+
+  // Keep old values of the recurrence coefficients
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+  real64 absTol = 0.0;
+
+  real64 dots[3];
+  MPI_Comm const comm = b.comm();
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  for( k = 0; k <= m_params.krylov.maxIterations; ++k )
+  {
+    // Start the reduction of (r,r), (u,r) and (w,u)
+    dots[0] = r.localDot( r );
+    dots[1] = u.localDot( r );
+    dots[2] = w.localDot( u );
+    MPI_Request request;
+    MpiWrapper::iAllReduce( dots, dots, 3, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), comm, &request );
+
+    // Overlap the reduction with m = Mw and n = Am
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    MpiWrapper::wait( &request, MPI_STATUS_IGNORE );
+
+    real64 const rnorm = std::sqrt( dots[0] );
+    m_residualNorms.emplace_back( rnorm );
+    logProgress();
+
+    // Compute the target absolute tolerance
+    if( k == 0 )
+    {
+      absTol = rnorm * m_params.krylov.relTolerance;
+    }
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm <= absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Compute alpha and beta
+    real64 const gamma = dots[1];
+    real64 const delta = dots[2];
+    real64 const beta = k > 0 ? gamma / gamma_old : 0.0;
+    real64 const denom = k > 0 ? delta - beta * gamma / alpha_old : delta;
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom )
+    real64 const alpha = gamma / denom;
+
+    // Update the search direction and its images
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z
+    x.axpy( alpha, p );
+    r.axpy( -alpha, s );
+    u.axpy( -alpha, q );
+    w.axpy( -alpha, z );
+
+    // Keep the old values of gamma and alpha
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  real64 const rnorm0 = m_residualNorms.front();
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
 // END_RST_NARRATIVE
 
 // -----------------------
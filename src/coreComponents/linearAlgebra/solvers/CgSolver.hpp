@@ -32,6 +32,10 @@ namespace geos
  *        Linear and Non-Linear Equations" from C.T. Kelley (1995)
  *        and "Iterative Methods for Sparse Linear Systems"
  *        from Y. Saad (2003).
+ *
+ * With LinearSolverParameters::SolverType::pipecg, the pipelined variant of Ghysels and Vanroose (2014)
+ * is used: the three dot products of an iteration are combined in a single non-blocking reduction,
+ * overlapped with the preconditioner and operator applications.
  */
 template< typename VECTOR >
 class CgSolver : public KrylovSolver< VECTOR >
@@ -75,13 +79,27 @@ public:
 
   virtual string methodName() const override final
   {
-    return "CG";
+    return m_params.solverType == LinearSolverParameters::SolverType::pipecg ? "pipelined CG" : "CG";
   };
 
   ///@}
 
 protected:
 
+  /**
+   * @brief Solve with the standard recurrences (two blocking reductions per iteration).
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  void solveClassical( Vector const & b, Vector & x ) const;
+
+  /**
+   * @brief Solve with the pipelined recurrences (one non-blocking reduction per iteration).
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  void solvePipelined( Vector const & b, Vector & x ) const;
+
   /// Alias for vector type that can be used for temporaries
   using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
 
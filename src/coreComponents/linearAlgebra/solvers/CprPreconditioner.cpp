@@ -0,0 +1,219 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CprPreconditioner.cpp
+ */
+
+#include "CprPreconditioner.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockJacobi.hpp"
+
+namespace geos
+{
+
+template< typename LAI >
+CprPreconditioner< LAI >::CprPreconditioner( LinearSolverParameters params )
+  : Base(),
+  m_params( std::move( params ) ),
+  m_blockSize( m_params.dofsPerNode )
+{
+  GEOS_LAI_ASSERT_GT( m_blockSize, 1 );
+
+  LinearSolverParameters pressureParams = m_params;
+  pressureParams.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+  pressureParams.dofsPerNode = 1;
+  pressureParams.isSymmetric = false;
+  pressureParams.amg.separateComponents = false;
+  pressureParams.amg.nullSpaceType = LinearSolverParameters::AMG::NullSpaceType::constantModes;
+  if( m_params.cpr.pressureStageType == LinearSolverParameters::CPR::PressureStageType::gmg )
+  {
+    pressureParams.preconditionerType = LinearSolverParameters::PreconditionerType::gmg;
+    std::unique_ptr< GeometricMultigridPreconditioner< LAI > > pressureGmg =
+      std::make_unique< GeometricMultigridPreconditioner< LAI > >( pressureParams );
+    m_pressureGmg = pressureGmg.get();
+    m_pressurePrecond = std::move( pressureGmg );
+  }
+  else
+  {
+    m_pressurePrecond = LAI::createPreconditioner( pressureParams );
+  }
+
+  switch( m_params.cpr.secondStageType )
+  {
+    case LinearSolverParameters::CPR::SecondStageType::blockILU:
+    {
+      m_secondStage = std::make_unique< PreconditionerBlockILU< LAI > >( m_blockSize );
+      break;
+    }
+    case LinearSolverParameters::CPR::SecondStageType::blockJacobi:
+    {
+      m_secondStage = std::make_unique< PreconditionerBlockJacobi< LAI > >( m_blockSize,
+                                                                            m_params.preconditionerSinglePrecision );
+      break;
+    }
+  }
+}
+
+template< typename LAI >
+CprPreconditioner< LAI >::~CprPreconditioner() = default;
+
+template< typename LAI >
+void CprPreconditioner< LAI >::computeWeights( Matrix const & mat, array2d< real64 > & weights ) const
+{
+  localIndex const bs = m_blockSize;
+  localIndex const numBlockRows = mat.numLocalRows() / bs;
+  bool const rowSums = m_params.cpr.decouplingType == LinearSolverParameters::CPR::DecouplingType::trueIMPES;
+
+  weights.resize( numBlockRows, bs );
+  array2d< real64 > block( bs, bs );
+  array2d< real64 > blockInv( bs, bs );
+  array1d< globalIndex > cols;
+  array1d< real64 > vals;
+  for( localIndex iBlock = 0; iBlock < numBlockRows; ++iBlock )
+  {
+    // quasi-IMPES uses the diagonal block of the cell, true-IMPES the sum of the blocks of the row,
+    // in which the flux terms cancel out and the accumulation terms remain
+    globalIndex const firstRow = mat.ilower() + iBlock * bs;
+    block.zero();
+    for( localIndex j = 0; j < bs; ++j )
+    {
+      localIndex const rowLength = mat.rowLength( firstRow + j );
+      cols.resize( rowLength );
+      vals.resize( rowLength );
+      mat.getRowCopy( firstRow + j, cols, vals );
+      for( localIndex k = 0; k < rowLength; ++k )
+      {
+        if( rowSums || ( cols[k] >= firstRow && cols[k] < firstRow + bs ) )
+        {
+          block( j, LvArray::integerConversion< localIndex >( cols[k] % bs ) ) += vals[k];
+        }
+      }
+    }
+
+    // the weights are the first row of the inverse, so that the combined equation only depends on the pressure
+    BlasLapackLA::matrixInverse( block, blockInv );
+    for( localIndex j = 0; j < bs; ++j )
+    {
+      weights( iBlock, j ) = blockInv( 0, j );
+    }
+  }
+}
+
+template< typename LAI >
+void CprPreconditioner< LAI >::setup( Matrix const & mat )
+{
+  GEOS_LAI_ASSERT( mat.ready() );
+  GEOS_ERROR_IF( mat.numLocalRows() % m_blockSize != 0,
+                 "CPR: the number of local rows (" << mat.numLocalRows() << ") is not a multiple of the number of dofs per cell (" << m_blockSize << ")" );
+
+  Base::setup( mat );
+
+  localIndex const bs = m_blockSize;
+  localIndex const numBlockRows = mat.numLocalRows() / bs;
+  globalIndex const pressureLower = MpiWrapper::prefixSum< globalIndex >( numBlockRows, mat.comm() );
+
+  array2d< real64 > weights;
+  computeWeights( mat, weights );
+
+  // Restriction: one decoupled pressure equation per cell
+  m_restriction.createWithLocalSize( numBlockRows, mat.numLocalRows(), bs, mat.comm() );
+  m_restriction.open();
+  array1d< globalIndex > cols( bs );
+  for( localIndex iBlock = 0; iBlock < numBlockRows; ++iBlock )
+  {
+    for( localIndex j = 0; j < bs; ++j )
+    {
+      cols[j] = mat.ilower() + iBlock * bs + j;
+    }
+    m_restriction.insert( pressureLower + iBlock, cols.data(), &weights( iBlock, 0 ), bs );
+  }
+  m_restriction.close();
+
+  // Prolongation: injection of the pressure unknowns
+  m_prolongation.createWithLocalSize( mat.numLocalRows(), numBlockRows, 1, mat.comm() );
+  m_prolongation.open();
+  for( localIndex iBlock = 0; iBlock < numBlockRows; ++iBlock )
+  {
+    m_prolongation.insert( mat.ilower() + iBlock * bs, pressureLower + iBlock, 1.0 );
+  }
+  m_prolongation.close();
+
+  mat.multiplyRAP( m_restriction, m_prolongation, m_pressureMatrix );
+
+  // the pressure matrix has one row per cell, whose coordinates come from the full system
+  if( m_pressureGmg != nullptr )
+  {
+    array2d< real64 > cellCenters;
+    GeometricMultigridPreconditioner< LAI >::computeBlockCenters( mat, bs, cellCenters );
+    m_pressureGmg->setCellCenters( cellCenters.toViewConst() );
+  }
+  m_pressurePrecond->setup( m_pressureMatrix );
+  m_secondStage->setup( mat );
+
+  m_pressureRhs.create( numBlockRows, mat.comm() );
+  m_pressureSol.create( numBlockRows, mat.comm() );
+  m_residual.create( mat.numLocalRows(), mat.comm() );
+  m_correction.create( mat.numLocalRows(), mat.comm() );
+}
+
+template< typename LAI >
+void CprPreconditioner< LAI >::apply( Vector const & src,
+                                      Vector & dst ) const
+{
+  GEOS_LAI_ASSERT( Base::ready() );
+
+  // First stage: pressure correction
+  m_restriction.apply( src, m_pressureRhs );
+  m_pressurePrecond->apply( m_pressureRhs, m_pressureSol );
+  m_prolongation.apply( m_pressureSol, dst );
+
+  // Second stage: local smoothing of the remaining residual
+  this->matrix().residual( dst, src, m_residual );
+  m_secondStage->apply( m_residual, m_correction );
+  dst.axpy( 1.0, m_correction );
+}
+
+template< typename LAI >
+void CprPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_pressurePrecond->clear();
+  m_secondStage->clear();
+  m_restriction.reset();
+  m_prolongation.reset();
+  m_pressureMatrix.reset();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class CprPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class CprPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class CprPreconditioner< PetscInterface >;
+#endif
+
+}
@@ -0,0 +1,146 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CprPreconditioner.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
+
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+
+namespace geos
+{
+
+template< typename LAI >
+class GeometricMultigridPreconditioner;
+
+/**
+ * @brief Two-stage constrained pressure residual (CPR) preconditioner.
+ * @tparam LAI linear algebra interface to use
+ *
+ * The degrees of freedom are expected to be grouped by cell, in blocks of size @p dofsPerNode
+ * with the pressure first, as assembled by the compositional flow solvers. The pressure equation
+ * of each cell is decoupled from the other unknowns of the cell by a combination of the equations
+ * of the block row (quasi-IMPES or true-IMPES weights), and the setup builds the restriction R to
+ * the decoupled pressure equations, the prolongation P of the pressure unknowns and the pressure
+ * matrix Ap = R A P, on which an AMG preconditioner is set up (or a geometric multigrid one on structured
+ * meshes, with the cell coordinates of the DofManager of the matrix). The application reads
+ *
+ *   x = P Ap^{-1} R r,  x += M^{-1} ( r - A x ),
+ *
+ * where M is the second stage (block ILU(0) or block Jacobi) on the full system.
+ * All the operations of the application are matrix and vector operations of the backend,
+ * and run on device when the backend does, except for the block ILU(0) triangular solves.
+ */
+template< typename LAI >
+class CprPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param params the linear solver parameters (the AMG parameters are used for the pressure stage)
+   */
+  explicit CprPreconditioner( LinearSolverParameters params );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~CprPreconditioner() override;
+
+  virtual void setup( Matrix const & mat ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (r).
+   * @param dst Output vector (x).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  /**
+   * @brief @return reference to the decoupled pressure matrix
+   */
+  Matrix const & pressureMatrix() const
+  {
+    GEOS_LAI_ASSERT( Base::ready() );
+    return m_pressureMatrix;
+  }
+
+private:
+
+  /**
+   * @brief Compute the decoupling weights of the pressure equation of each local block row.
+   * @param mat the matrix to precondition
+   * @param weights the weights, of size number of local block rows times block size
+   */
+  void computeWeights( Matrix const & mat, array2d< real64 > & weights ) const;
+
+  /// Parameters of the preconditioner
+  LinearSolverParameters m_params;
+
+  /// Number of degrees of freedom per cell
+  localIndex m_blockSize;
+
+  /// Restriction to the decoupled pressure equations
+  Matrix m_restriction;
+
+  /// Prolongation of the pressure unknowns
+  Matrix m_prolongation;
+
+  /// Decoupled pressure matrix
+  Matrix m_pressureMatrix;
+
+  /// Preconditioner of the pressure matrix
+  std::unique_ptr< PreconditionerBase< LAI > > m_pressurePrecond;
+
+  /// Geometric multigrid pressure preconditioner, when selected (owned by m_pressurePrecond)
+  GeometricMultigridPreconditioner< LAI > * m_pressureGmg = nullptr;
+
+  /// Second stage preconditioner of the full matrix
+  std::unique_ptr< PreconditionerBase< LAI > > m_secondStage;
+
+  /// Pressure right-hand side
+  mutable Vector m_pressureRhs;
+
+  /// Pressure solution
+  mutable Vector m_pressureSol;
+
+  /// Residual after the pressure stage
+  mutable Vector m_residual;
+
+  /// Correction of the second stage
+  mutable Vector m_correction;
+};
+
+}
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
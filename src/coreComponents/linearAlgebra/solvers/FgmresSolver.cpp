@@ -0,0 +1,178 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FgmresSolver.cpp
+ */
+
+#include "FgmresSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+#include "denseLinearAlgebra/common/layouts.hpp"
+
+namespace geos
+{
+
+template< typename VECTOR >
+FgmresSolver< VECTOR >::FgmresSolver( LinearSolverParameters params,
+                                      LinearOperator< Vector > const & A,
+                                      LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_zspace( m_params.krylov.maxRestart ),
+  m_kspaceInitialized( false )
+{
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "FGMRES: max number of iterations until restart must be positive." );
+}
+
+template< typename VECTOR >
+void FgmresSolver< VECTOR >::solve( Vector const & b,
+                                    Vector & x ) const
+{
+  Stopwatch watch;
+
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // On repeated calls to solve() input vectors must have the same size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( VectorTemp & kv : m_kspace )
+    {
+      kv = createTempVector( b );
+    }
+    for( VectorTemp & zv : m_zspace )
+    {
+      zv = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  // Create upper Hessenberg matrix
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > s( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > g( m_params.krylov.maxRestart + 1 );
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    g[0] = k > 0 ? r.norm2() : rnorm0;
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+
+    integer j = 0;
+    for(; j < m_params.krylov.maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = std::fabs( g[j] );
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Compute the new vector, with a preconditioner whose accuracy may be relaxed as the residual decreases
+      m_precond.relaxAccuracy( rnorm > 0.0 ? rnorm0 / rnorm : 1.0 );
+      m_precond.apply( m_kspace[j], m_zspace[j] );
+      m_operator.apply( m_zspace[j], w );
+
+      // Orthogonalization
+      for( integer i = 0; i <= j; ++i )
+      {
+        H( i, j ) = w.dot( m_kspace[i] );
+        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+      }
+
+      H( j+1, j ) = w.norm2();
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j+1, j ) )
+      m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
+
+      // Apply all previous rotations to the new column
+      for( integer i = 0; i < j; ++i )
+      {
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H.
+    // The correction is Z y, since the preconditioner may have changed between the vectors.
+    krylov::Backsolve( j, H, g );
+    for( integer i = 0; i < j; ++i )
+    {
+      x.axpy( g[i], m_zspace[i] );
+    }
+
+    // Recompute the residual
+    m_operator.residual( x, b, r );
+  }
+
+  // Restore the nominal accuracy of the preconditioner for its other uses
+  m_precond.relaxAccuracy( 1.0 );
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class FgmresSolver< TrilinosInterface::ParallelVector >;
+template class FgmresSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class FgmresSolver< HypreInterface::ParallelVector >;
+template class FgmresSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class FgmresSolver< PetscInterface::ParallelVector >;
+template class FgmresSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
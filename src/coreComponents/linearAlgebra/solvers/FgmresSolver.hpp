@@ -0,0 +1,115 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FgmresSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_FGMRESSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_FGMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the Flexible Generalized Minimized RESidual method
+ *        (right-preconditioned) for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ * @note  The notation is consistent with "A flexible inner-outer preconditioned
+ *        GMRES algorithm" from Y. Saad (1993).
+ *
+ * The preconditioned Krylov vectors z_j = M_j v_j are stored alongside the Krylov vectors v_j,
+ * and the solution is updated with them, so that the preconditioner may change from one iteration
+ * to the next, e.g. when it involves inner iterative solves to loose tolerances. Before each application,
+ * the preconditioner is allowed to relax its accuracy (see LinearOperator::relaxAccuracy) by the ratio
+ * of the initial residual norm to the current one, following the relaxation strategies of inexact Krylov
+ * methods (Bouras and Fraysse, 2005; Simoncini and Szyld, 2003): the inner solves can be less accurate
+ * as the outer method converges.
+ */
+template< typename VECTOR >
+class FgmresSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   */
+  FgmresSolver( LinearSolverParameters params,
+                LinearOperator< Vector > const & matrix,
+                LinearOperator< Vector > const & precond );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "FGMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Storage for the preconditioned Krylov subspace vectors
+  array1d< VectorTemp > m_zspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  bool mutable m_kspaceInitialized;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_FGMRESSOLVER_HPP_
@@ -0,0 +1,392 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GeometricMultigridPreconditioner.cpp
+ */
+
+#include "GeometricMultigridPreconditioner.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+#include "LvArray/src/tensorOps.hpp"
+
+#include <algorithm>
+
+namespace geos
+{
+
+namespace
+{
+
+/**
+ * @brief Convert the AMG smoother type to the preconditioner applying one sweep of it.
+ * @param smootherType the AMG smoother type
+ * @return the preconditioner type
+ */
+LinearSolverParameters::PreconditionerType getSmootherType( LinearSolverParameters::AMG::SmootherType const smootherType )
+{
+  using SmootherType = LinearSolverParameters::AMG::SmootherType;
+  using PreconditionerType = LinearSolverParameters::PreconditionerType;
+  switch( smootherType )
+  {
+    case SmootherType::default_: return PreconditionerType::sgs;
+    case SmootherType::jacobi: return PreconditionerType::jacobi;
+    case SmootherType::l1jacobi: return PreconditionerType::l1jacobi;
+    case SmootherType::fgs: return PreconditionerType::fgs;
+    case SmootherType::bgs: return PreconditionerType::bgs;
+    case SmootherType::sgs: return PreconditionerType::sgs;
+    case SmootherType::l1sgs: return PreconditionerType::l1sgs;
+    case SmootherType::chebyshev: return PreconditionerType::chebyshev;
+    case SmootherType::ilu0: return PreconditionerType::iluk;
+    case SmootherType::ilut: return PreconditionerType::ilut;
+    case SmootherType::ic0: return PreconditionerType::ic;
+    case SmootherType::ict: return PreconditionerType::ict;
+  }
+  return PreconditionerType::sgs;
+}
+
+/**
+ * @brief Convert the AMG coarse solver type to the preconditioner of the coarsest level.
+ * @param coarseType the AMG coarse solver type
+ * @return the preconditioner type
+ */
+LinearSolverParameters::PreconditionerType getCoarseType( LinearSolverParameters::AMG::CoarseType const coarseType )
+{
+  using CoarseType = LinearSolverParameters::AMG::CoarseType;
+  using PreconditionerType = LinearSolverParameters::PreconditionerType;
+  switch( coarseType )
+  {
+    case CoarseType::default_: return PreconditionerType::direct;
+    case CoarseType::jacobi: return PreconditionerType::jacobi;
+    case CoarseType::l1jacobi: return PreconditionerType::l1jacobi;
+    case CoarseType::fgs: return PreconditionerType::fgs;
+    case CoarseType::sgs: return PreconditionerType::sgs;
+    case CoarseType::l1sgs: return PreconditionerType::l1sgs;
+    case CoarseType::chebyshev: return PreconditionerType::chebyshev;
+    case CoarseType::direct: return PreconditionerType::direct;
+    case CoarseType::bgs: return PreconditionerType::bgs;
+  }
+  return PreconditionerType::direct;
+}
+
+} // namespace
+
+template< typename LAI >
+GeometricMultigridPreconditioner< LAI >::GeometricMultigridPreconditioner( LinearSolverParameters params )
+  : Base(),
+  m_params( std::move( params ) ),
+  m_blockSize( m_params.dofsPerNode )
+{
+  GEOS_LAI_ASSERT_GT( m_blockSize, 0 );
+
+  m_smootherParams = m_params;
+  m_smootherParams.preconditionerType = getSmootherType( m_params.amg.smootherType );
+  m_smootherParams.ifact.fill = 0;
+
+  m_coarseParams = m_params;
+  m_coarseParams.preconditionerType = getCoarseType( m_params.amg.coarseType );
+}
+
+template< typename LAI >
+GeometricMultigridPreconditioner< LAI >::~GeometricMultigridPreconditioner() = default;
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::setCellCenters( arrayView2d< real64 const > const & centers )
+{
+  GEOS_ERROR_IF_NE( centers.size( 1 ), 3 );
+  m_cellCenters.resize( centers.size( 0 ), 3 );
+  for( localIndex i = 0; i < centers.size( 0 ); ++i )
+  {
+    LvArray::tensorOps::copy< 3 >( m_cellCenters[i], centers[i] );
+  }
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::computeBlockCenters( Matrix const & mat,
+                                                                   localIndex const blockSize,
+                                                                   array2d< real64 > & centers )
+{
+  GEOS_ERROR_IF( mat.dofManager() == nullptr,
+                 "GMG: the cell centers are needed, either set explicitly or from the DofManager attached to the matrix" );
+
+  array2d< real64 > dofCenters( mat.numLocalRows(), 3 );
+  mat.dofManager()->getLocalDofCenters( dofCenters.toView() );
+
+  centers.resize( mat.numLocalRows() / blockSize, 3 );
+  for( localIndex iBlock = 0; iBlock < centers.size( 0 ); ++iBlock )
+  {
+    LvArray::tensorOps::copy< 3 >( centers[iBlock], dofCenters[iBlock * blockSize] );
+  }
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::computeStructuredIndices( arrayView2d< real64 const > const & centers,
+                                                                        array2d< localIndex > & indices )
+{
+  localIndex const numCells = centers.size( 0 );
+  indices.resize( numCells, 3 );
+  if( numCells == 0 )
+  {
+    return;
+  }
+
+  // the coordinates closer than a fraction of the extent of the local cells belong to the same grid line
+  real64 extent = 0.0;
+  for( integer d = 0; d < 3; ++d )
+  {
+    real64 minCoord = centers( 0, d );
+    real64 maxCoord = centers( 0, d );
+    for( localIndex i = 1; i < numCells; ++i )
+    {
+      minCoord = std::min( minCoord, centers( i, d ) );
+      maxCoord = std::max( maxCoord, centers( i, d ) );
+    }
+    extent = std::max( extent, maxCoord - minCoord );
+  }
+  real64 const tolerance = 1.0e-8 * extent;
+
+  std::vector< real64 > coords( numCells );
+  std::vector< real64 > gridLines;
+  for( integer d = 0; d < 3; ++d )
+  {
+    for( localIndex i = 0; i < numCells; ++i )
+    {
+      coords[i] = centers( i, d );
+    }
+    std::sort( coords.begin(), coords.end() );
+
+    gridLines.clear();
+    for( real64 const coord : coords )
+    {
+      if( gridLines.empty() || coord - gridLines.back() > tolerance )
+      {
+        gridLines.push_back( coord );
+      }
+    }
+
+    for( localIndex i = 0; i < numCells; ++i )
+    {
+      indices( i, d ) = std::lower_bound( gridLines.begin(), gridLines.end(), centers( i, d ) - tolerance ) - gridLines.begin();
+    }
+  }
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::buildProlongation( Matrix const & fineMatrix,
+                                                                 Level & fine,
+                                                                 array2d< localIndex > & coarseIndices ) const
+{
+  localIndex const bs = m_blockSize;
+  arrayView2d< localIndex const > const indices = fine.indices.toViewConst();
+  localIndex const numCells = indices.size( 0 );
+
+  // the aggregate of each cell, numbered in the local box of the coarse indices
+  localIndex dims[3] = { 1, 1, 1 };
+  for( localIndex i = 0; i < numCells; ++i )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      dims[d] = std::max( dims[d], indices( i, d ) / 2 + 1 );
+    }
+  }
+  std::vector< localIndex > keys( numCells );
+  for( localIndex i = 0; i < numCells; ++i )
+  {
+    keys[i] = indices( i, 0 ) / 2 + dims[0] * ( indices( i, 1 ) / 2 + dims[1] * ( indices( i, 2 ) / 2 ) );
+  }
+
+  std::vector< localIndex > aggregateKeys( keys );
+  std::sort( aggregateKeys.begin(), aggregateKeys.end() );
+  aggregateKeys.erase( std::unique( aggregateKeys.begin(), aggregateKeys.end() ), aggregateKeys.end() );
+  localIndex const numAggregates = LvArray::integerConversion< localIndex >( aggregateKeys.size() );
+
+  coarseIndices.resize( numAggregates, 3 );
+  for( localIndex a = 0; a < numAggregates; ++a )
+  {
+    coarseIndices( a, 0 ) = aggregateKeys[a] % dims[0];
+    coarseIndices( a, 1 ) = ( aggregateKeys[a] / dims[0] ) % dims[1];
+    coarseIndices( a, 2 ) = aggregateKeys[a] / ( dims[0] * dims[1] );
+  }
+
+  // piecewise constant prolongation, separately for each component
+  globalIndex const coarseLower = MpiWrapper::prefixSum< globalIndex >( numAggregates * bs, fineMatrix.comm() );
+  fine.prolongation.createWithLocalSize( fineMatrix.numLocalRows(), numAggregates * bs, 1, fineMatrix.comm() );
+  fine.prolongation.open();
+  for( localIndex i = 0; i < numCells; ++i )
+  {
+    localIndex const a = std::lower_bound( aggregateKeys.begin(), aggregateKeys.end(), keys[i] ) - aggregateKeys.begin();
+    for( localIndex c = 0; c < bs; ++c )
+    {
+      fine.prolongation.insert( fineMatrix.ilower() + i * bs + c, coarseLower + a * bs + c, 1.0 );
+    }
+  }
+  fine.prolongation.close();
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::setup( Matrix const & mat )
+{
+  GEOS_LAI_ASSERT( mat.ready() );
+  GEOS_ERROR_IF( mat.numLocalRows() % m_blockSize != 0,
+                 "GMG: the number of local rows (" << mat.numLocalRows() << ") is not a multiple of the number of dofs per cell (" << m_blockSize << ")" );
+
+  Base::setup( mat );
+  m_levels.clear();
+
+  array2d< real64 > dofManagerCenters;
+  if( m_cellCenters.size( 0 ) == 0 )
+  {
+    computeBlockCenters( mat, m_blockSize, dofManagerCenters );
+  }
+  arrayView2d< real64 const > const centers = m_cellCenters.size( 0 ) > 0 ? m_cellCenters.toViewConst() : dofManagerCenters.toViewConst();
+  GEOS_ERROR_IF_NE_MSG( centers.size( 0 ), mat.numLocalRows() / m_blockSize,
+                        "GMG: the number of cell centers does not match the number of local block rows" );
+
+  m_levels.emplace_back( std::make_unique< Level >() );
+  computeStructuredIndices( centers, m_levels[0]->indices );
+
+  // coarsening: 2x2x2 aggregates of the structured cells, with Galerkin coarse operators
+  while( true )
+  {
+    size_t const l = m_levels.size() - 1;
+    Level & fine = *m_levels[l];
+    Matrix const & fineMatrix = levelMatrix( l );
+    if( LvArray::integerConversion< integer >( m_levels.size() ) >= m_params.amg.maxLevels ||
+        fineMatrix.numGlobalRows() <= m_params.gmg.maxCoarseSize )
+    {
+      break;
+    }
+
+    array2d< localIndex > coarseIndices;
+    buildProlongation( fineMatrix, fine, coarseIndices );
+
+    // the aggregates do not cross the rank boundaries, and stop reducing the size once each rank holds a few cells
+    if( fine.prolongation.numGlobalCols() > 0.9 * fineMatrix.numGlobalRows() )
+    {
+      fine.prolongation.reset();
+      break;
+    }
+
+    std::unique_ptr< Level > coarse = std::make_unique< Level >();
+    fineMatrix.multiplyPtAP( fine.prolongation, coarse->matrix );
+    coarse->indices = std::move( coarseIndices );
+    m_levels.emplace_back( std::move( coarse ) );
+  }
+
+  for( size_t l = 0; l < m_levels.size(); ++l )
+  {
+    Level & level = *m_levels[l];
+    Matrix const & levelMat = levelMatrix( l );
+    bool const coarsest = l + 1 == m_levels.size();
+
+    level.smoother = LAI::createPreconditioner( coarsest ? m_coarseParams : m_smootherParams );
+    level.smoother->setup( levelMat );
+
+    if( l > 0 )
+    {
+      level.rhs.create( levelMat.numLocalRows(), levelMat.comm() );
+      level.sol.create( levelMat.numLocalRows(), levelMat.comm() );
+    }
+    level.residual.create( levelMat.numLocalRows(), levelMat.comm() );
+    level.correction.create( levelMat.numLocalRows(), levelMat.comm() );
+  }
+
+  if( m_params.logLevel >= 1 )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "        GMG: {} levels, coarsest level of {} rows",
+                               m_levels.size(), levelMatrix( m_levels.size() - 1 ).numGlobalRows() ) );
+  }
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::applyCycle( size_t const l,
+                                                          Vector const & rhs,
+                                                          Vector & sol ) const
+{
+  Level const & level = *m_levels[l];
+  if( l + 1 == m_levels.size() )
+  {
+    level.smoother->apply( rhs, sol );
+    return;
+  }
+
+  Matrix const & mat = levelMatrix( l );
+  Level const & coarse = *m_levels[l + 1];
+
+  auto const smooth = [&]()
+  {
+    for( integer s = 0; s < m_params.amg.numSweeps; ++s )
+    {
+      mat.residual( sol, rhs, level.residual );
+      level.smoother->apply( level.residual, level.correction );
+      sol.axpy( 1.0, level.correction );
+    }
+  };
+
+  sol.zero();
+  if( m_params.amg.preOrPostSmoothing != LinearSolverParameters::AMG::PreOrPost::post )
+  {
+    smooth();
+  }
+
+  integer const numCoarseCycles = m_params.amg.cycleType == LinearSolverParameters::AMG::CycleType::W ? 2 : 1;
+  for( integer c = 0; c < numCoarseCycles; ++c )
+  {
+    mat.residual( sol, rhs, level.residual );
+    level.prolongation.applyTranspose( level.residual, coarse.rhs );
+    applyCycle( l + 1, coarse.rhs, coarse.sol );
+    level.prolongation.apply( coarse.sol, level.correction );
+    sol.axpy( 1.0, level.correction );
+  }
+
+  if( m_params.amg.preOrPostSmoothing != LinearSolverParameters::AMG::PreOrPost::pre )
+  {
+    smooth();
+  }
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::apply( Vector const & src,
+                                                     Vector & dst ) const
+{
+  GEOS_LAI_ASSERT( Base::ready() );
+  applyCycle( 0, src, dst );
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_levels.clear();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class GeometricMultigridPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class GeometricMultigridPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class GeometricMultigridPreconditioner< PetscInterface >;
+#endif
+
+}
@@ -0,0 +1,191 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GeometricMultigridPreconditioner.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace geos
+{
+
+/**
+ * @brief Geometric multigrid (GMG) preconditioner for structured meshes.
+ * @tparam LAI linear algebra interface to use
+ *
+ * The degrees of freedom are expected to be grouped by cell, in blocks of size @p dofsPerNode,
+ * on a Cartesian mesh such as the ones of the internal mesh generator. The structured (i,j,k) index
+ * of each local cell is recovered from the coordinates of the cell centers, and each coarse level
+ * aggregates the 2x2x2 cells (i/2,j/2,k/2) of the finer one on each rank, separately for each
+ * component. The prolongation is piecewise constant and the coarse operators are the Galerkin
+ * products P^T A P, so that the setup only involves matrix products and no strength-of-connection
+ * analysis. The coarsening stops at @p amg.maxLevels levels, when the coarse level has less than
+ * @p gmg.maxCoarseSize rows, or when the aggregation no longer reduces the size of the levels
+ * (since the aggregates do not cross the rank boundaries).
+ *
+ * The application is a V- or W-cycle, with the AMG smoother type, number of sweeps and pre/post smoothing
+ * parameters, and a direct solve of the coarsest level (unless another AMG coarse solver is selected).
+ */
+template< typename LAI >
+class GeometricMultigridPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param params the linear solver parameters (the AMG parameters are used for the smoothers and the cycle)
+   */
+  explicit GeometricMultigridPreconditioner( LinearSolverParameters params );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~GeometricMultigridPreconditioner() override;
+
+  /**
+   * @brief Set the coordinates of the cell of each local block row.
+   * @param centers the cell centers, of size number of local block rows times 3
+   *
+   * When no centers are set, they are taken from the DofManager attached to the matrix at setup.
+   */
+  void setCellCenters( arrayView2d< real64 const > const & centers );
+
+  virtual void setup( Matrix const & mat ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (r).
+   * @param dst Output vector (x).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  /**
+   * @brief @return the number of levels of the hierarchy, including the fine level
+   */
+  integer numLevels() const
+  {
+    return LvArray::integerConversion< integer >( m_levels.size() );
+  }
+
+  /**
+   * @brief Compute the coordinates of the support point of each local block row from the DofManager of a matrix.
+   * @param mat the matrix, with a DofManager attached
+   * @param blockSize the number of rows of each block row
+   * @param centers the centers, of size number of local block rows times 3
+   */
+  static void computeBlockCenters( Matrix const & mat,
+                                   localIndex const blockSize,
+                                   array2d< real64 > & centers );
+
+private:
+
+  /// A level of the hierarchy
+  struct Level
+  {
+    /// Operator of the level (unused on the fine level, which uses the input matrix)
+    Matrix matrix;
+    /// Prolongation from the next coarser level (unused on the coarsest level)
+    Matrix prolongation;
+    /// Smoother, or solver on the coarsest level
+    std::unique_ptr< PreconditionerBase< LAI > > smoother;
+    /// Structured (i,j,k) indices of the local cells of the level
+    array2d< localIndex > indices;
+    /// Right-hand side of the level (unused on the fine level)
+    mutable Vector rhs;
+    /// Solution of the level (unused on the fine level)
+    mutable Vector sol;
+    /// Residual of the level
+    mutable Vector residual;
+    /// Smoother correction of the level
+    mutable Vector correction;
+  };
+
+  /**
+   * @brief Compute the structured indices of the local cells from their centers.
+   * @param centers the cell centers, of size number of local cells times 3
+   * @param indices the (i,j,k) indices, of size number of local cells times 3
+   */
+  static void computeStructuredIndices( arrayView2d< real64 const > const & centers,
+                                        array2d< localIndex > & indices );
+
+  /**
+   * @brief Build the prolongation from the aggregates of a level, and the indices of the next coarser level.
+   * @param fineMatrix the operator of the level to coarsen
+   * @param fine the level to coarsen
+   * @param coarseIndices the structured indices of the aggregates
+   */
+  void buildProlongation( Matrix const & fineMatrix,
+                          Level & fine,
+                          array2d< localIndex > & coarseIndices ) const;
+
+  /**
+   * @brief Apply the cycle from a given level.
+   * @param level the index of the level
+   * @param rhs the right-hand side of the level
+   * @param sol the solution of the level
+   */
+  void applyCycle( size_t const level, Vector const & rhs, Vector & sol ) const;
+
+  /**
+   * @brief @return the operator of a level
+   * @param level the index of the level
+   */
+  Matrix const & levelMatrix( size_t const level ) const
+  {
+    return level == 0 ? this->matrix() : m_levels[level]->matrix;
+  }
+
+  /// Parameters of the preconditioner
+  LinearSolverParameters m_params;
+
+  /// Parameters of the smoothers
+  LinearSolverParameters m_smootherParams;
+
+  /// Parameters of the coarsest level solver
+  LinearSolverParameters m_coarseParams;
+
+  /// Number of degrees of freedom per cell
+  localIndex m_blockSize;
+
+  /// Coordinates of the cells of the local block rows
+  array2d< real64 > m_cellCenters;
+
+  /// Levels of the hierarchy, from the finest
+  std::vector< std::unique_ptr< Level > > m_levels;
+};
+
+}
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
@@ -18,10 +18,12 @@
 
 #include "GmresSolver.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "common/Stopwatch.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "linearAlgebra/solvers/KrylovUtils.hpp"
 #include "denseLinearAlgebra/common/layouts.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
 
 namespace geos
 {
@@ -32,74 +34,70 @@ GmresSolver< VECTOR >::GmresSolver( LinearSolverParameters params,
                                     LinearOperator< Vector > const & M )
   : KrylovSolver< VECTOR >( std::move( params ), A, M ),
   m_kspace( m_params.krylov.maxRestart + 1 ),
-  m_kspaceInitialized( false )
+  m_zspace( m_params.solverType == LinearSolverParameters::SolverType::pipegmres ? m_params.krylov.maxRestart + 1 : 0 ),
+  m_kspaceInitialized( false ),
+  m_recycleSpace( &m_ownRecycleSpace )
 {
   GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "GMRES: max number of iterations until restart must be positive." );
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.basisBlockSize, 0, "GMRES: basis block size must be positive." );
 }
 
 namespace
 {
 
-void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
-{
-  if( isZero( y ) )
-  {
-    c = 1.0;
-    s = 0.0;
-  }
-  else if( std::fabs( y ) > std::fabs( x ) )
-  {
-    real64 const nu = x / y;
-    s = 1.0 / std::sqrt( 1.0 + nu * nu );
-    c = nu * s;
-  }
-  else
-  {
-    real64 const nu = y / x;
-    c = 1.0 / std::sqrt( 1.0 + nu * nu );
-    s = nu * c;
-  }
-}
+/// Relative size below which a norm computed from the Pythagorean relation is considered lost to cancellation
+real64 constexpr cancellationTolerance = 1e-8;
 
-void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
-{
-  real64 const temp = c * dx + s * dy;
-  dy = -s * dx + c * dy;
-  dx = temp;
-}
+} // namespace
 
-void Backsolve( integer const k,
-                arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
-                arraySlice1d< real64 > const & g )
+template< typename VECTOR >
+void GmresSolver< VECTOR >::initializeKrylovSpace( Vector const & b ) const
 {
-  for( integer j = k - 1; j >= 0; --j )
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // On repeated calls to solve() input vectors must have the same size and partitioning.
+  if( !m_kspaceInitialized )
   {
-    g[j] /= H( j, j );
-    for( integer i = j - 1; i >= 0; --i )
+    for( VectorTemp & kv : m_kspace )
+    {
+      kv = createTempVector( b );
+    }
+    for( VectorTemp & zv : m_zspace )
     {
-      g[i] -= H( i, j ) * g[j];
+      zv = createTempVector( b );
     }
+    m_kspaceInitialized = true;
   }
-
 }
 
-} // namespace
-
 template< typename VECTOR >
 void GmresSolver< VECTOR >::solve( Vector const & b,
                                    Vector & x ) const
 {
-  // We create Krylov subspace vectors once using the size and partitioning of b.
-  // On repeated calls to solve() input vectors must have the same size and partitioning.
-  if( !m_kspaceInitialized )
+  initializeKrylovSpace( b );
+
+  switch( m_params.solverType )
   {
-    for( VectorTemp & kv : m_kspace )
+    case LinearSolverParameters::SolverType::pipegmres:
     {
-      kv = createTempVector( b );
+      solvePipelined( b, x );
+      break;
+    }
+    case LinearSolverParameters::SolverType::sstepgmres:
+    {
+      solveSStep( b, x );
+      break;
+    }
+    default:
+    {
+      solveClassical( b, x );
     }
-    m_kspaceInitialized = true;
   }
+}
 
+template< typename VECTOR >
+void GmresSolver< VECTOR >::solveClassical( Vector const & b,
+                                            Vector & x ) const
+{
   Stopwatch watch;
 
   // Define vectors
@@ -114,9 +112,62 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
   real64 const rnorm0 = r.norm2();
   real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
 
+  // Recycled subspace U, discarded if the system size has changed
+  integer const maxRecycle = m_params.krylov.recycleSize;
+  array1d< VectorTemp > & U = *m_recycleSpace;
+  if( maxRecycle == 0 || ( !U.empty() && U[0].localSize() != b.localSize() ) )
+  {
+    U.clear();
+  }
+  integer numRecycled = LvArray::integerConversion< integer >( U.size() );
+
+  // Compute C = A M U with orthonormal columns, applying the same transformation to U
+  array1d< VectorTemp > C( numRecycled );
+  for( integer i = 0; i < numRecycled; ++i )
+  {
+    C[i] = createTempVector( b );
+    m_precond.apply( U[i], z );
+    m_operator.apply( z, C[i] );
+    for( integer l = 0; l < i; ++l )
+    {
+      real64 const alpha = C[i].dot( C[l] );
+      C[i].axpy( -alpha, C[l] );
+      U[i].axpy( -alpha, U[l] );
+    }
+    real64 const cnorm = C[i].norm2();
+    if( !( cnorm > 0.0 ) )
+    {
+      // the recycled subspace has become rank deficient for the current operator
+      numRecycled = 0;
+      U.clear();
+      break;
+    }
+    C[i].scale( 1.0 / cnorm );
+    U[i].scale( 1.0 / cnorm );
+  }
+
+  // Project the initial residual: x += M U C^T r, r -= C C^T r
+  if( numRecycled > 0 )
+  {
+    w.zero();
+    for( integer i = 0; i < numRecycled; ++i )
+    {
+      real64 const alpha = C[i].dot( r );
+      w.axpy( alpha, U[i] );
+      r.axpy( -alpha, C[i] );
+    }
+    m_precond.apply( w, z );
+    x.axpy( 1.0, z );
+  }
+
   // Create upper Hessenberg matrix
   array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
 
+  // Projections of the new vectors on C, and Hessenberg matrix before the rotations (recycling only)
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > B( numRecycled, m_params.krylov.maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > Hbar( maxRecycle > 0 ? m_params.krylov.maxRestart + 1 : 0,
+                                                        maxRecycle > 0 ? m_params.krylov.maxRestart : 0 );
+
   // Create plane rotation storage
   array1d< real64 > c( m_params.krylov.maxRestart + 1 );
   array1d< real64 > s( m_params.krylov.maxRestart + 1 );
@@ -127,11 +178,12 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
   m_residualNorms.clear();
 
   integer & k = m_result.numIterations;
+  integer lastCycleSize = 0;
   while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
   {
     // Re-initialize Krylov subspace
     g.zero();
-    g[0] = k > 0 ? r.norm2() : rnorm0;
+    g[0] = ( k > 0 || numRecycled > 0 ) ? r.norm2() : rnorm0;
     m_kspace[0].copy( r );
     if( g[0] > 0 )
     {
@@ -157,6 +209,13 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
       m_precond.apply( m_kspace[j], z );
       m_operator.apply( z, w );
 
+      // Orthogonalization against the recycled subspace
+      for( integer i = 0; i < numRecycled; ++i )
+      {
+        B( i, j ) = w.dot( C[i] );
+        w.axpby( -B( i, j ), C[i], 1.0 );
+      }
+
       // Orthogonalization
       for( integer i = 0; i <= j; ++i )
       {
@@ -168,20 +227,457 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j+1, j ) )
       m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
+      if( maxRecycle > 0 )
+      {
+        for( integer i = 0; i <= j + 1; ++i )
+        {
+          Hbar( i, j ) = H( i, j );
+        }
+      }
+
+      // Apply all previous rotations to the new column
+      for( integer i = 0; i < j; ++i )
+      {
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::Backsolve( j, H, g );
+    w.zero();
+    for( integer i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    // The correction is (V - U B) y, since A M (V - U B) = V H
+    for( integer l = 0; l < numRecycled; ++l )
+    {
+      real64 beta = 0.0;
+      for( integer i = 0; i < j; ++i )
+      {
+        beta += B( l, i ) * g[i];
+      }
+      w.axpy( -beta, U[l] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+    lastCycleSize = j;
+  }
+
+  // Update the recycled subspace with the right singular vectors of the Hessenberg matrix of the last cycle
+  // associated with the smallest singular values: ||A M (V - U B) y|| = ||Hbar y|| is minimal for them
+  if( maxRecycle > 0 && lastCycleSize > 0 )
+  {
+    integer const m = lastCycleSize;
+    integer const numNew = LvArray::math::min( maxRecycle, m );
+
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > Hm( m + 1, m );
+    for( integer jj = 0; jj < m; ++jj )
+    {
+      for( integer i = 0; i <= m; ++i )
+      {
+        Hm( i, jj ) = Hbar( i, jj );
+      }
+    }
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > leftSV( m + 1, m );
+    array2d< real64, MatrixLayout::COL_MAJOR_PERM > rightSVT( m, m );
+    array1d< real64 > sigma( m );
+    BlasLapackLA::matrixSVD( Hm, leftSV, sigma, rightSVT );
+
+    array1d< VectorTemp > newU( numNew );
+    for( integer l = 0; l < numNew; ++l )
+    {
+      // singular values are sorted in decreasing order
+      integer const sv = m - 1 - l;
+      newU[l] = createTempVector( b );
+      newU[l].zero();
+      for( integer i = 0; i < m; ++i )
+      {
+        newU[l].axpy( rightSVT( sv, i ), m_kspace[i] );
+      }
+      for( integer p = 0; p < numRecycled; ++p )
+      {
+        real64 beta = 0.0;
+        for( integer i = 0; i < m; ++i )
+        {
+          beta += B( p, i ) * rightSVT( sv, i );
+        }
+        newU[l].axpy( -beta, U[p] );
+      }
+    }
+    U = std::move( newU );
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+template< typename VECTOR >
+void GmresSolver< VECTOR >::solvePipelined( Vector const & b,
+                                            Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  // Create upper Hessenberg matrix
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > s( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > g( m_params.krylov.maxRestart + 1 );
+
+  // Buffer for the projections reduced in a single global operation
+  array1d< real64 > dots( m_params.krylov.maxRestart + 2 );
+  MPI_Comm const comm = b.comm();
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    g[0] = k > 0 ? r.norm2() : rnorm0;
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+
+    // The auxiliary basis holds z_j = A M v_j, the first one has no reduction to overlap with
+    m_precond.apply( m_kspace[0], z );
+    m_operator.apply( z, m_zspace[0] );
+
+    integer j = 0;
+    for(; j < m_params.krylov.maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = std::fabs( g[j] );
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Start the reduction of the projections of z_j on the basis together with its norm
+      for( integer i = 0; i <= j; ++i )
+      {
+        dots[i] = m_zspace[j].localDot( m_kspace[i] );
+      }
+      dots[j+1] = m_zspace[j].localDot( m_zspace[j] );
+      MPI_Request request;
+      MpiWrapper::iAllReduce( dots.data(), dots.data(), j + 2, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), comm, &request );
+
+      // Overlap the reduction with the computation of A M z_j, needed for the next auxiliary vector
+      m_precond.apply( m_zspace[j], z );
+      m_operator.apply( z, w );
+
+      MpiWrapper::wait( &request, MPI_STATUS_IGNORE );
+
+      // Orthogonalization: v_{j+1} = z_j - sum_i H(i,j) v_i
+      real64 normSquared = dots[j+1];
+      m_kspace[j+1].copy( m_zspace[j] );
+      for( integer i = 0; i <= j; ++i )
+      {
+        H( i, j ) = dots[i];
+        normSquared -= dots[i] * dots[i];
+        m_kspace[j+1].axpy( -H( i, j ), m_kspace[i] );
+      }
+
+      // The norm is recomputed explicitly when the Pythagorean relation suffers from cancellation
+      H( j+1, j ) = normSquared > cancellationTolerance * dots[j+1] ? std::sqrt( normSquared ) : m_kspace[j+1].norm2();
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j+1, j ) )
+      m_kspace[j+1].scale( 1.0 / H( j+1, j ) );
+
+      // Next auxiliary vector: z_{j+1} = ( A M z_j - sum_i H(i,j) z_i ) / H(j+1,j)
+      m_zspace[j+1].copy( w );
+      for( integer i = 0; i <= j; ++i )
+      {
+        m_zspace[j+1].axpy( -H( i, j ), m_zspace[i] );
+      }
+      m_zspace[j+1].scale( 1.0 / H( j+1, j ) );
+
       // Apply all previous rotations to the new column
       for( integer i = 0; i < j; ++i )
       {
-        ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
       }
 
       // Compute and apply the new rotation to eliminate subdiagonal element
-      ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
-      ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
-      ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::Backsolve( j, H, g );
+    w.zero();
+    for( integer i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+template< typename VECTOR >
+void GmresSolver< VECTOR >::solveSStep( Vector const & b,
+                                        Vector & x ) const
+{
+  Stopwatch watch;
+
+  integer const maxRestart = m_params.krylov.maxRestart;
+  integer const blockSize = std::min( m_params.krylov.basisBlockSize, maxRestart );
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  // Create upper Hessenberg matrix, before (Hraw) and after (H) the plane rotations
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > Hraw( maxRestart + 1, maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( maxRestart + 1, maxRestart );
+
+  // Create plane rotation storage, with the residual norm estimate after each rotation
+  array1d< real64 > c( maxRestart + 1 );
+  array1d< real64 > s( maxRestart + 1 );
+  array1d< real64 > g( maxRestart + 1 );
+  array1d< real64 > rnorms( maxRestart + 1 );
+
+  // Gram matrix of a basis block against the whole basis, reduced in a single global operation
+  array2d< real64 > gram( maxRestart + 1, blockSize );
+  MPI_Comm const comm = b.comm();
+
+  // Cholesky factor of the orthogonalized block and change of basis from the monomial to the orthonormal basis
+  array2d< real64 > R( blockSize, blockSize );
+  array2d< real64 > K( maxRestart + 1, blockSize + 1 );
+  array2d< real64 > T( maxRestart + 1, blockSize );
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    Hraw.zero();
+    g[0] = k > 0 ? r.norm2() : rnorm0;
+    rnorms[0] = g[0];
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+
+    // Number of orthonormal basis vectors available
+    integer numBasis = 1;
+
+    integer j = 0;
+    for(; j < maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = rnorms[j];
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      if( j + 1 < numBasis )
+      {
+        // The column has already been computed with the current block
+        continue;
+      }
+
+      // Monomial basis: m_kspace[j+l] = (A M)^l v_j, computed without communication
+      integer numNew = std::min( blockSize, maxRestart - j );
+      for( integer l = 1; l <= numNew; ++l )
+      {
+        m_precond.apply( m_kspace[j+l-1], z );
+        m_operator.apply( z, m_kspace[j+l] );
+      }
+
+      // Projections of the block on the previous basis and Gram matrix of the block (upper part), in one reduction
+      gram.zero();
+      for( integer l = 0; l < numNew; ++l )
+      {
+        for( integer i = 0; i <= j + 1 + l; ++i )
+        {
+          gram( i, l ) = m_kspace[j+1+l].localDot( m_kspace[i] );
+        }
+      }
+      MpiWrapper::allReduce( gram.data(), gram.data(), LvArray::integerConversion< int >( gram.size() ),
+                             MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), comm );
+
+      // Cholesky factorization of the Gram matrix of the block orthogonalized against the previous basis,
+      // truncated at the first pivot lost to cancellation (numerical rank deficiency of the monomial basis)
+      R.zero();
+      for( integer l = 0; l < numNew; ++l )
+      {
+        for( integer m = 0; m <= l; ++m )
+        {
+          real64 value = gram( j + 1 + m, l );
+          for( integer i = 0; i <= j; ++i )
+          {
+            value -= gram( i, m ) * gram( i, l );
+          }
+          for( integer i = 0; i < m; ++i )
+          {
+            value -= R( i, m ) * R( i, l );
+          }
+          if( m < l )
+          {
+            R( m, l ) = value / R( m, m );
+          }
+          else if( value > cancellationTolerance * gram( j + 1 + l, l ) )
+          {
+            R( l, l ) = std::sqrt( value );
+          }
+          else
+          {
+            numNew = l;
+          }
+        }
+      }
+      if( numNew == 0 )
+      {
+        if( m_params.logLevel >= 1 )
+        {
+          GEOS_LOG_RANK_0( "Breakdown in " << methodName() << ": rank deficient basis block" );
+        }
+        m_result.status = LinearSolverResult::Status::Breakdown;
+        break;
+      }
+
+      // Orthonormal basis: Q = ( W - V C ) R^{-1}
+      for( integer l = 0; l < numNew; ++l )
+      {
+        VectorTemp & q = m_kspace[j+1+l];
+        for( integer i = 0; i <= j; ++i )
+        {
+          q.axpy( -gram( i, l ), m_kspace[i] );
+        }
+        for( integer m = 0; m < l; ++m )
+        {
+          q.axpy( -R( m, l ), m_kspace[j+1+m] );
+        }
+        q.scale( 1.0 / R( l, l ) );
+      }
+
+      // Coordinates of the monomial basis [v_j, (A M) v_j, ... ] in the orthonormal basis
+      K.zero();
+      K( j, 0 ) = 1.0;
+      for( integer l = 1; l <= numNew; ++l )
+      {
+        for( integer i = 0; i <= j; ++i )
+        {
+          K( i, l ) = gram( i, l-1 );
+        }
+        for( integer m = 0; m < l; ++m )
+        {
+          K( j + 1 + m, l ) = R( m, l-1 );
+        }
+      }
+
+      // The relation (A M) K(:,0:n-1) = K(:,1:n) gives the new Hessenberg columns:
+      // Hraw(:,j:j+n-1) = ( K(:,1:n) - Hraw(:,0:j-1) K(0:j-1,0:n-1) ) K(j:j+n-1,0:n-1)^{-1}
+      integer const numRows = j + numNew + 1;
+      for( integer l = 0; l < numNew; ++l )
+      {
+        for( integer i = 0; i < numRows; ++i )
+        {
+          real64 value = K( i, l+1 );
+          for( integer m = 0; m < j; ++m )
+          {
+            value -= Hraw( i, m ) * K( m, l );
+          }
+          T( i, l ) = value;
+        }
+      }
+      for( integer l = 0; l < numNew; ++l )
+      {
+        for( integer i = 0; i < numRows; ++i )
+        {
+          real64 value = T( i, l );
+          for( integer m = 0; m < l; ++m )
+          {
+            value -= Hraw( i, j + m ) * K( j + m, l );
+          }
+          // entries below the subdiagonal vanish in exact arithmetic
+          Hraw( i, j + l ) = i <= j + l + 1 ? value / K( j + l, l ) : 0.0;
+        }
+      }
+
+      // Apply the plane rotations to the new columns
+      for( integer l = 0; l < numNew; ++l )
+      {
+        integer const jj = j + l;
+        for( integer i = 0; i <= jj + 1; ++i )
+        {
+          H( i, jj ) = Hraw( i, jj );
+        }
+        for( integer i = 0; i < jj; ++i )
+        {
+          krylov::ApplyGivensRotation( c[i], s[i], H( i, jj ), H( i+1, jj ) );
+        }
+        krylov::ComputeGivensRotation( H( jj, jj ), H( jj+1, jj ), c[jj], s[jj] );
+        krylov::ApplyGivensRotation( c[jj], s[jj], H( jj, jj ), H( jj+1, jj ) );
+        krylov::ApplyGivensRotation( c[jj], s[jj], g[jj], g[jj+1] );
+        rnorms[jj+1] = std::fabs( g[jj+1] );
+      }
+      numBasis += numNew;
     }
 
     // Regardless of how we quit out of inner loop, j is the actual size of H
-    Backsolve( j, H, g );
+    krylov::Backsolve( j, H, g );
     w.zero();
     for( integer i = 0; i < j; ++i )
     {
@@ -32,6 +32,19 @@ namespace geos
  *        Linear and Non-Linear Equations" from C.T. Kelley (1995)
  *        and "Iterative Methods for Sparse Linear Systems"
  *        from Y. Saad (2003).
+ *
+ * Two communication-reducing variants are available through LinearSolverParameters::solverType:
+ *  - pipegmres: pipelined GMRES in the spirit of Ghysels et al. (2013), where the single global
+ *    reduction of each Arnoldi step is overlapped with the preconditioner and operator applications
+ *    of the next step, at the cost of a second set of Krylov vectors;
+ *  - sstepgmres: s-step GMRES (Hoemmen, 2010), where krylov.basisBlockSize monomial basis vectors
+ *    are generated without communication and orthogonalized together with a single global reduction.
+ *
+ * With krylov.recycleSize > 0, the classical variant recycles a subspace from one solve to the next, in the
+ * spirit of GCRO-DR (Parks et al., 2006): the new Krylov vectors are kept orthogonal to C = A M U, where U
+ * spans the directions of the last restart cycle of the previous solve associated with the smallest singular
+ * values of its Hessenberg matrix. This deflates the slowest converging components for sequences of similar
+ * systems. Since the operator usually changes between two solves, C is recomputed at the beginning of each solve.
  */
 template< typename VECTOR >
 class GmresSolver : public KrylovSolver< VECTOR >
@@ -75,13 +88,56 @@ public:
 
   virtual string methodName() const override final
   {
-    return "GMRES";
+    switch( m_params.solverType )
+    {
+      case LinearSolverParameters::SolverType::pipegmres: return "pipelined GMRES";
+      case LinearSolverParameters::SolverType::sstepgmres: return "s-step GMRES";
+      default: return "GMRES";
+    }
   };
 
   ///@}
 
+  /**
+   * @brief Set the storage of the recycled subspace.
+   * @param space the vectors of the recycled subspace, owned by the caller to keep them across solver objects
+   *
+   * By default the recycled subspace is stored in the solver object and is only kept across calls to solve().
+   */
+  void setRecycleSpace( array1d< typename KrylovSolver< VECTOR >::VectorTemp > & space )
+  {
+    m_recycleSpace = &space;
+  }
+
 protected:
 
+  /**
+   * @brief Solve with classical Gram-Schmidt orthogonalization (one reduction per basis vector).
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  void solveClassical( Vector const & b, Vector & x ) const;
+
+  /**
+   * @brief Solve with the pipelined variant (one non-blocking reduction per basis vector).
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  void solvePipelined( Vector const & b, Vector & x ) const;
+
+  /**
+   * @brief Solve with the s-step variant (one reduction per block of basis vectors).
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  void solveSStep( Vector const & b, Vector & x ) const;
+
+  /**
+   * @brief Create the Krylov subspace vectors on the first call.
+   * @param [in] b vector used for the size and partitioning of the Krylov vectors.
+   */
+  void initializeKrylovSpace( Vector const & b ) const;
+
   /// Alias for vector type that can be used for temporaries
   using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
 
@@ -97,8 +153,17 @@ protected:
   /// Storage for Krylov subspace vectors
   array1d< VectorTemp > m_kspace;
 
+  /// Storage for the preconditioned operator applied to the Krylov vectors (pipelined variant only)
+  array1d< VectorTemp > m_zspace;
+
   /// Flag indicating whether kspace vectors have been created
   bool mutable m_kspaceInitialized;
+
+  /// Default storage of the recycled subspace
+  array1d< VectorTemp > m_ownRecycleSpace;
+
+  /// Recycled subspace carried over from the previous solves
+  array1d< VectorTemp > * m_recycleSpace;
 };
 
 } // namespace geos
@@ -0,0 +1,96 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file KrylovPreconditioner.cpp
+ */
+
+#include "KrylovPreconditioner.hpp"
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+namespace geos
+{
+
+template< typename LAI >
+KrylovPreconditioner< LAI >::KrylovPreconditioner( LinearSolverParameters params,
+                                                   std::unique_ptr< PreconditionerBase< LAI > > precond )
+  : Base(),
+  m_params( std::move( params ) ),
+  m_precond( std::move( precond ) ),
+  m_relaxation( 1.0 ),
+  m_numInnerIterations( 0 )
+{
+  GEOS_LAI_ASSERT( m_precond );
+  GEOS_ERROR_IF( m_params.solverType == LinearSolverParameters::SolverType::direct ||
+                 m_params.solverType == LinearSolverParameters::SolverType::preconditioner,
+                 "KrylovPreconditioner: the inner solver must be a Krylov method, not " << m_params.solverType );
+}
+
+template< typename LAI >
+KrylovPreconditioner< LAI >::~KrylovPreconditioner() = default;
+
+template< typename LAI >
+void KrylovPreconditioner< LAI >::setup( Matrix const & mat )
+{
+  Base::setup( mat );
+  m_precond->setup( mat );
+  m_solver = KrylovSolver< Vector >::create( m_params, mat, *m_precond );
+  m_numInnerIterations = 0;
+}
+
+template< typename LAI >
+void KrylovPreconditioner< LAI >::apply( Vector const & src,
+                                         Vector & dst ) const
+{
+  GEOS_LAI_ASSERT( m_solver );
+
+  real64 relTolerance = m_params.krylov.relTolerance;
+  if( m_params.krylov.useAdaptiveTol )
+  {
+    relTolerance = LvArray::math::max( relTolerance,
+                                       LvArray::math::min( relTolerance * m_relaxation, m_params.krylov.weakestTol ) );
+  }
+  m_solver->setRelTolerance( relTolerance );
+
+  // an unconverged inner solve is still a valid (inexact) preconditioner application
+  dst.zero();
+  m_solver->solve( src, dst );
+  m_numInnerIterations += m_solver->result().numIterations;
+}
+
+template< typename LAI >
+void KrylovPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_solver.reset();
+  m_precond->clear();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class KrylovPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class KrylovPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class KrylovPreconditioner< PetscInterface >;
+#endif
+
+}
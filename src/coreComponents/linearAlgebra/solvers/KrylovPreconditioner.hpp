@@ -0,0 +1,116 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file KrylovPreconditioner.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_KRYLOVPRECONDITIONER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_KRYLOVPRECONDITIONER_HPP_
+
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+
+namespace geos
+{
+
+/**
+ * @brief Preconditioner applying an inner Krylov solve, e.g. to a block of a BlockPreconditioner.
+ * @tparam LAI linear algebra interface to use
+ *
+ * Each application solves the system from a zero initial guess with the native Krylov method of
+ * @p params.solverType, preconditioned by the inner preconditioner, to the relative tolerance
+ * @p params.krylov.relTolerance. When @p params.krylov.useAdaptiveTol is set, the tolerance is multiplied
+ * by the relaxation factor given by the outer flexible method (see LinearOperator::relaxAccuracy),
+ * up to @p params.krylov.weakestTol, so that the inner solves get cheaper as the outer method converges.
+ * Since the result of an application depends on its input through the iterations, the outer method
+ * must be flexible (LinearSolverParameters::SolverType::fgmres).
+ */
+template< typename LAI >
+class KrylovPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param params the parameters of the inner Krylov solve
+   * @param precond the preconditioner of the inner Krylov solve
+   */
+  KrylovPreconditioner( LinearSolverParameters params,
+                        std::unique_ptr< PreconditionerBase< LAI > > precond );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~KrylovPreconditioner() override;
+
+  virtual void setup( Matrix const & mat ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (x).
+   * @param dst Output vector (b).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  virtual void relaxAccuracy( real64 const factor ) const override
+  {
+    m_relaxation = factor;
+  }
+
+  /**
+   * @brief @return the total number of inner iterations since the last setup
+   */
+  integer numInnerIterations() const
+  {
+    return m_numInnerIterations;
+  }
+
+private:
+
+  /// Parameters of the inner solve
+  LinearSolverParameters m_params;
+
+  /// Preconditioner of the inner solve
+  std::unique_ptr< PreconditionerBase< LAI > > m_precond;
+
+  /// Inner Krylov solver
+  std::unique_ptr< KrylovSolver< Vector > > m_solver;
+
+  /// Relaxation factor of the inner tolerance given by the outer method
+  real64 mutable m_relaxation;
+
+  /// Total number of inner iterations since the last setup
+  integer mutable m_numInnerIterations;
+};
+
+}
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_KRYLOVPRECONDITIONER_HPP_
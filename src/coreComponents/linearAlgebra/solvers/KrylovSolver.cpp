@@ -19,6 +19,7 @@
 #include "KrylovSolver.hpp"
 #include "linearAlgebra/solvers/BicgstabSolver.hpp"
 #include "linearAlgebra/solvers/CgSolver.hpp"
+#include "linearAlgebra/solvers/FgmresSolver.hpp"
 #include "linearAlgebra/solvers/GmresSolver.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 
@@ -50,6 +51,7 @@ KrylovSolver< VECTOR >::create( LinearSolverParameters const & parameters,
   switch( parameters.solverType )
   {
     case LinearSolverParameters::SolverType::cg:
+    case LinearSolverParameters::SolverType::pipecg:
     {
       return std::make_unique< CgSolver< Vector > >( parameters,
                                                      matrix,
@@ -62,11 +64,19 @@ KrylovSolver< VECTOR >::create( LinearSolverParameters const & parameters,
                                                            precond );
     }
     case LinearSolverParameters::SolverType::gmres:
+    case LinearSolverParameters::SolverType::pipegmres:
+    case LinearSolverParameters::SolverType::sstepgmres:
     {
       return std::make_unique< GmresSolver< Vector > >( parameters,
                                                         matrix,
                                                         precond );
     }
+    case LinearSolverParameters::SolverType::fgmres:
+    {
+      return std::make_unique< FgmresSolver< Vector > >( parameters,
+                                                         matrix,
+                                                         precond );
+    }
     default:
     {
       GEOS_ERROR( "Unsupported linear solver type: " << parameters.solverType );
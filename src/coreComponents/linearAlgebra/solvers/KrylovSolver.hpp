@@ -117,6 +117,15 @@ public:
     return m_params;
   }
 
+  /**
+   * @brief Set the relative tolerance of the next solves.
+   * @param relTolerance the relative tolerance
+   */
+  void setRelTolerance( real64 const relTolerance )
+  {
+    m_params.krylov.relTolerance = relTolerance;
+  }
+
   /**
    * @brief @return the result of a linear solve.
    */
@@ -0,0 +1,277 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PreconditionerBlockILU.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERBLOCKILU_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERBLOCKILU_HPP_
+
+#include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/BlockCSRMatrix.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief Block incomplete LU factorization without fill-in, BILU(0), of the local diagonal part of the matrix.
+ * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * The factorization is computed on the block CSR representation of the locally owned rows and columns,
+ * the couplings with other ranks being ignored (additive Schwarz without overlap). The L factor has
+ * identity diagonal blocks, and the inverses of the diagonal blocks of U are stored.
+ */
+template< typename LAI >
+class PreconditionerBlockILU : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param blockSize the size of the dense blocks
+   */
+  explicit PreconditionerBlockILU( localIndex const blockSize )
+    : m_blockSize( blockSize )
+  {}
+
+  /**
+   * @brief Compute the preconditioner from a matrix.
+   * @param mat the matrix to precondition.
+   */
+  virtual void setup( Matrix const & mat ) override
+  {
+    Base::setup( mat );
+
+    m_factors.createFromLocalRows( mat, m_blockSize );
+
+    localIndex const numBlockRows = m_factors.numBlockRows();
+    arrayView1d< localIndex const > const rowOffsets = m_factors.rowOffsets();
+    arrayView1d< localIndex const > const columns = m_factors.columns();
+    arrayView1d< localIndex const > const diagIndices = m_factors.diagIndices();
+    arrayView3d< real64 > const values = m_factors.values();
+
+    m_diagInv.resize( numBlockRows, m_blockSize, m_blockSize );
+    array2d< real64 > block( m_blockSize, m_blockSize );
+    array2d< real64 > blockInv( m_blockSize, m_blockSize );
+    array2d< real64 > product( m_blockSize, m_blockSize );
+
+    for( localIndex i = 0; i < numBlockRows; ++i )
+    {
+      GEOS_ERROR_IF( diagIndices[i] < 0, "Block ILU: structurally zero diagonal block in local block row " << i );
+
+      // Eliminate the blocks of the strictly lower part, in increasing column order
+      for( localIndex p = rowOffsets[i]; p < diagIndices[i]; ++p )
+      {
+        localIndex const k = columns[p];
+
+        // L(i,k) = A(i,k) U(k,k)^{-1}
+        multiply( values[p], m_diagInv[k], product );
+        copy( product, values[p] );
+
+        // A(i,j) -= L(i,k) U(k,j) for the blocks (i,j) already in the pattern
+        localIndex q = rowOffsets[i];
+        for( localIndex r = diagIndices[k] + 1; r < rowOffsets[k + 1]; ++r )
+        {
+          while( q < rowOffsets[i + 1] && columns[q] < columns[r] )
+          {
+            ++q;
+          }
+          if( q == rowOffsets[i + 1] )
+          {
+            break;
+          }
+          if( columns[q] == columns[r] )
+          {
+            multiply( values[p], values[r], product );
+            for( localIndex a = 0; a < m_blockSize; ++a )
+            {
+              for( localIndex b = 0; b < m_blockSize; ++b )
+              {
+                values( q, a, b ) -= product( a, b );
+              }
+            }
+          }
+        }
+      }
+
+      // Invert the diagonal block of U
+      copy( values[diagIndices[i]], block );
+      BlasLapackLA::matrixInverse( block, blockInv );
+      copy( blockInv, m_diagInv[i] );
+    }
+  }
+
+  /**
+   * @brief Clean up the preconditioner setup.
+   */
+  virtual void clear() override
+  {
+    Base::clear();
+    m_factors = BlockCSRMatrix();
+    m_diagInv.clear();
+  }
+
+  /**
+   * @brief Apply operator to a vector.
+   *
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    GEOS_LAI_ASSERT( this->ready() );
+    GEOS_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+    GEOS_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+    localIndex const numBlockRows = m_factors.numBlockRows();
+    arrayView1d< localIndex const > const rowOffsets = m_factors.rowOffsets();
+    arrayView1d< localIndex const > const columns = m_factors.columns();
+    arrayView1d< localIndex const > const diagIndices = m_factors.diagIndices();
+    arrayView3d< real64 const > const values = m_factors.values();
+    arrayView3d< real64 const > const diagInv = m_diagInv.toViewConst();
+
+    // The triangular solves are sequential and performed on host
+    values.move( hostMemorySpace, false );
+    diagInv.move( hostMemorySpace, false );
+    arrayView1d< real64 const > const x = src.values();
+    x.move( hostMemorySpace, false );
+    arrayView1d< real64 > const y = dst.open();
+    y.move( hostMemorySpace, true );
+
+    localIndex const bs = m_blockSize;
+    array1d< real64 > work( bs );
+
+    // Forward solve with L (identity diagonal blocks)
+    for( localIndex i = 0; i < numBlockRows; ++i )
+    {
+      for( localIndex a = 0; a < bs; ++a )
+      {
+        y[i * bs + a] = x[i * bs + a];
+      }
+      for( localIndex p = rowOffsets[i]; p < diagIndices[i]; ++p )
+      {
+        localIndex const offset = columns[p] * bs;
+        for( localIndex a = 0; a < bs; ++a )
+        {
+          for( localIndex b = 0; b < bs; ++b )
+          {
+            y[i * bs + a] -= values( p, a, b ) * y[offset + b];
+          }
+        }
+      }
+    }
+
+    // Backward solve with U
+    for( localIndex i = numBlockRows - 1; i >= 0; --i )
+    {
+      for( localIndex a = 0; a < bs; ++a )
+      {
+        work[a] = y[i * bs + a];
+      }
+      for( localIndex p = diagIndices[i] + 1; p < rowOffsets[i + 1]; ++p )
+      {
+        localIndex const offset = columns[p] * bs;
+        for( localIndex a = 0; a < bs; ++a )
+        {
+          for( localIndex b = 0; b < bs; ++b )
+          {
+            work[a] -= values( p, a, b ) * y[offset + b];
+          }
+        }
+      }
+      for( localIndex a = 0; a < bs; ++a )
+      {
+        real64 sum = 0.0;
+        for( localIndex b = 0; b < bs; ++b )
+        {
+          sum += diagInv( i, a, b ) * work[b];
+        }
+        y[i * bs + a] = sum;
+      }
+    }
+
+    dst.close();
+  }
+
+private:
+
+  /**
+   * @brief Multiply two dense blocks, C = A B.
+   * @tparam A_TYPE type of the first block
+   * @tparam B_TYPE type of the second block
+   * @param A the first block
+   * @param B the second block
+   * @param C the product
+   */
+  template< typename A_TYPE, typename B_TYPE >
+  void multiply( A_TYPE const & A, B_TYPE const & B, array2d< real64 > & C ) const
+  {
+    for( localIndex a = 0; a < m_blockSize; ++a )
+    {
+      for( localIndex b = 0; b < m_blockSize; ++b )
+      {
+        real64 sum = 0.0;
+        for( localIndex c = 0; c < m_blockSize; ++c )
+        {
+          sum += A( a, c ) * B( c, b );
+        }
+        C( a, b ) = sum;
+      }
+    }
+  }
+
+  /**
+   * @brief Copy a dense block.
+   * @tparam SRC_TYPE type of the source block
+   * @tparam DST_TYPE type of the destination block
+   * @param src the source block
+   * @param dst the destination block
+   */
+  template< typename SRC_TYPE, typename DST_TYPE >
+  void copy( SRC_TYPE const & src, DST_TYPE && dst ) const
+  {
+    for( localIndex a = 0; a < m_blockSize; ++a )
+    {
+      for( localIndex b = 0; b < m_blockSize; ++b )
+      {
+        dst( a, b ) = src( a, b );
+      }
+    }
+  }
+
+  /// Size of the dense blocks
+  localIndex m_blockSize;
+
+  /// Block CSR storage of the L and U factors
+  BlockCSRMatrix m_factors;
+
+  /// Inverses of the diagonal blocks of U
+  array3d< real64 > m_diagInv;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_PRECONDITIONERBLOCKILU_HPP_
@@ -23,8 +23,14 @@ namespace geos
 {
 
 /**
- * @brief Common interface for identity preconditioning operator
+ * @brief Block Jacobi preconditioning operator.
  * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * The inverses of the diagonal blocks are either stored in a parallel matrix, or in single precision
+ * and applied with a local kernel accumulating in double precision, which halves the memory traffic
+ * of the application. In the latter case the Krylov iterations and residuals remain in double precision,
+ * the restarts of the Krylov solver acting as iterative refinement. In single precision, the preconditioner
+ * is only applied and is not available in matrix form.
  */
 template< typename LAI >
 class PreconditionerBlockJacobi : public PreconditionerBase< LAI >
@@ -43,9 +49,12 @@ public:
   /**
    * @brief Constructor.
    * @param blockSize the size of block diagonal matrices.
+   * @param singlePrecision whether the block inverses are stored and applied in single precision
    */
-  PreconditionerBlockJacobi( localIndex const & blockSize = 0 )
-    : m_blockDiag{}
+  PreconditionerBlockJacobi( localIndex const & blockSize = 0,
+                             bool const singlePrecision = false )
+    : m_blockDiag{},
+    m_singlePrecision( singlePrecision )
   {
     m_blockSize = blockSize;
   }
@@ -63,8 +72,17 @@ public:
 
     PreconditionerBase< LAI >::setup( mat );
 
-    m_blockDiag.createWithLocalSize( mat.numLocalRows(), mat.numLocalCols(), m_blockSize, mat.comm() );
-    m_blockDiag.open();
+    m_blockDiag.reset();
+    m_blockInv.clear();
+    if( m_singlePrecision )
+    {
+      m_blockInv.resize( mat.numLocalRows() / m_blockSize, m_blockSize, m_blockSize );
+    }
+    else
+    {
+      m_blockDiag.createWithLocalSize( mat.numLocalRows(), mat.numLocalCols(), m_blockSize, mat.comm() );
+      m_blockDiag.open();
+    }
 
     array1d< globalIndex > idxBlk( m_blockSize );
     array2d< real64 > values( m_blockSize, m_blockSize );
@@ -92,9 +110,26 @@ public:
         }
       }
       BlasLapackLA::matrixInverse( values, valuesInv );
-      m_blockDiag.insert( idxBlk, idxBlk, valuesInv );
+      if( m_singlePrecision )
+      {
+        localIndex const iBlock = LvArray::integerConversion< localIndex >( i - mat.ilower() ) / m_blockSize;
+        for( localIndex j = 0; j < m_blockSize; ++j )
+        {
+          for( localIndex k = 0; k < m_blockSize; ++k )
+          {
+            m_blockInv( iBlock, j, k ) = static_cast< float >( valuesInv( j, k ) );
+          }
+        }
+      }
+      else
+      {
+        m_blockDiag.insert( idxBlk, idxBlk, valuesInv );
+      }
+    }
+    if( !m_singlePrecision )
+    {
+      m_blockDiag.close();
     }
-    m_blockDiag.close();
   }
 
   /**
@@ -111,6 +146,7 @@ public:
   virtual void clear() override
   {
     m_blockDiag.reset();
+    m_blockInv.clear();
   }
 
   /**
@@ -122,21 +158,44 @@ public:
   virtual void apply( Vector const & src,
                       Vector & dst ) const override
   {
-    GEOS_LAI_ASSERT( m_blockDiag.ready() );
     GEOS_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
     GEOS_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
 
-    m_blockDiag.apply( src, dst );
+    if( !m_singlePrecision )
+    {
+      GEOS_LAI_ASSERT( m_blockDiag.ready() );
+      m_blockDiag.apply( src, dst );
+      return;
+    }
+
+    arrayView3d< float const > const blockInv = m_blockInv.toViewConst();
+    arrayView1d< real64 const > const x = src.values();
+    arrayView1d< real64 > const y = dst.open();
+    localIndex const blockSize = m_blockSize;
+    forAll< parallelDevicePolicy<> >( blockInv.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const iBlock )
+    {
+      localIndex const offset = iBlock * blockSize;
+      for( localIndex j = 0; j < blockSize; ++j )
+      {
+        real64 sum = 0.0;
+        for( localIndex k = 0; k < blockSize; ++k )
+        {
+          sum += blockInv( iBlock, j, k ) * x[offset + k];
+        }
+        y[offset + j] = sum;
+      }
+    } );
+    dst.close();
   }
 
   /**
    * @brief Whether the preconditioner is available in matrix form
-   * @return true: explicit form is available
+   * @return true if the block inverses are stored in double precision
    */
   virtual bool hasPreconditionerMatrix() const override
   {
-    GEOS_LAI_ASSERT( m_blockDiag.ready() );
-    return true;
+    GEOS_LAI_ASSERT( this->ready() );
+    return !m_singlePrecision;
   }
 
   /**
@@ -145,6 +204,7 @@ public:
    */
   virtual Matrix const & preconditionerMatrix() const override
   {
+    GEOS_ERROR_IF( m_singlePrecision, "PreconditionerBlockJacobi: no matrix form in single precision" );
     GEOS_LAI_ASSERT( m_blockDiag.ready() );
     return m_blockDiag;
   }
@@ -154,8 +214,14 @@ private:
   /// The preconditioner matrix
   Matrix m_blockDiag;
 
+  /// The block inverses stored in single precision
+  array3d< float > m_blockInv;
+
   /// Block size
   localIndex m_blockSize = 0;
+
+  /// Whether the block inverses are stored and applied in single precision
+  bool m_singlePrecision = false;
 };
 
 }
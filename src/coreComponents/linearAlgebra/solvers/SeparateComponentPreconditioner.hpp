@@ -70,6 +70,11 @@ public:
 
   virtual void clear() override;
 
+  virtual void relaxAccuracy( real64 const factor ) const override
+  {
+    m_precond->relaxAccuracy( factor );
+  }
+
   virtual bool hasPreconditionerMatrix() const override
   {
     return m_precond->hasPreconditionerMatrix();
@@ -17,7 +17,14 @@
  */
 
 #include "common/DataTypes.hpp"
+#include "linearAlgebra/solvers/BlockCgSolver.hpp"
+#include "linearAlgebra/solvers/CprPreconditioner.hpp"
+#include "linearAlgebra/solvers/FgmresSolver.hpp"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
+#include "linearAlgebra/solvers/GmresSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerBlockILU.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/KrylovPreconditioner.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
 #include "linearAlgebra/utilities/BlockOperatorWrapper.hpp"
@@ -54,6 +61,35 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_FGMRES()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.solverType = geos::LinearSolverParameters::SolverType::fgmres;
+  return parameters;
+}
+
+LinearSolverParameters params_PipeCG()
+{
+  LinearSolverParameters parameters = params_CG();
+  parameters.solverType = geos::LinearSolverParameters::SolverType::pipecg;
+  return parameters;
+}
+
+LinearSolverParameters params_PipeGMRES()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.solverType = geos::LinearSolverParameters::SolverType::pipegmres;
+  return parameters;
+}
+
+LinearSolverParameters params_SStepGMRES()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.solverType = geos::LinearSolverParameters::SolverType::sstepgmres;
+  parameters.krylov.basisBlockSize = 4;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -153,10 +189,131 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, FGMRES )
+{
+  this->test( params_FGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, InnerKrylovFGMRES )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  // Loose inner CG solves, relaxed as the outer residual decreases
+  LinearSolverParameters innerParams = params_CG();
+  innerParams.krylov.relTolerance = 1e-2;
+  innerParams.krylov.maxIterations = 20;
+  innerParams.krylov.useAdaptiveTol = true;
+  innerParams.krylov.weakestTol = 0.5;
+
+  KrylovPreconditioner< TypeParam > innerSolver( innerParams, std::make_unique< PreconditionerIdentity< TypeParam > >() );
+  innerSolver.setup( this->matrix );
+
+  LinearSolverParameters const params = params_FGMRES();
+  this->sol_true.rand( 1984 );
+  this->sol_comp.zero();
+  this->matrix.apply( this->sol_true, this->rhs_true );
+
+  FgmresSolver< Vector > const solver( params, this->matrix, innerSolver );
+  solver.solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( solver.result().success() );
+  EXPECT_GT( innerSolver.numInnerIterations(), solver.result().numIterations );
+
+  Vector sol_diff( this->sol_comp );
+  sol_diff.axpy( -1.0, this->sol_true );
+  EXPECT_LT( sol_diff.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipeCG )
+{
+  this->test( params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipeGMRES )
+{
+  this->test( params_PipeGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, RecycledGMRES )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  LinearSolverParameters params = params_GMRES();
+  params.krylov.recycleSize = 10;
+
+  // The same solver object keeps its recycled subspace from one solve to the next
+  GmresSolver< Vector > const solver( params, this->matrix, this->precond );
+  integer numIterations[2];
+  for( integer solve = 0; solve < 2; ++solve )
+  {
+    this->sol_true.rand( 1984 + solve );
+    this->sol_comp.zero();
+    this->matrix.apply( this->sol_true, this->rhs_true );
+
+    solver.solve( this->rhs_true, this->sol_comp );
+    EXPECT_TRUE( solver.result().success() );
+    numIterations[solve] = solver.result().numIterations;
+
+    Vector sol_diff( this->sol_comp );
+    sol_diff.axpy( -1.0, this->sol_true );
+    EXPECT_LT( sol_diff.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+  }
+
+  // Deflating the smallest singular directions of the first solve speeds up the second one
+  EXPECT_LE( numIterations[1], numIterations[0] );
+}
+
+TYPED_TEST_P( KrylovSolverTest, BlockCG )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  LinearSolverParameters const params = params_CG();
+  integer constexpr numRhs = 4;
+
+  array1d< Vector > solTrue( numRhs );
+  array1d< Vector > solComp( numRhs );
+  array1d< Vector > rhs( numRhs );
+  std::vector< Vector const * > rhsPtr;
+  std::vector< Vector * > solPtr;
+  for( integer j = 0; j < numRhs; ++j )
+  {
+    solTrue[j].create( this->matrix.numLocalCols(), MPI_COMM_GEOSX );
+    solComp[j].create( this->matrix.numLocalCols(), MPI_COMM_GEOSX );
+    rhs[j].create( this->matrix.numLocalRows(), MPI_COMM_GEOSX );
+    solTrue[j].rand( 1984 + j );
+    solComp[j].zero();
+    this->matrix.apply( solTrue[j], rhs[j] );
+    rhsPtr.push_back( &rhs[j] );
+    solPtr.push_back( &solComp[j] );
+  }
+
+  BlockCgSolver< Vector > const solver( params, this->matrix, this->precond );
+  solver.solve( rhsPtr, solPtr );
+  EXPECT_TRUE( solver.result().success() );
+
+  for( integer j = 0; j < numRhs; ++j )
+  {
+    Vector sol_diff( solComp[j] );
+    sol_diff.axpy( -1.0, solTrue[j] );
+    EXPECT_LT( sol_diff.norm2() / solTrue[j].norm2(), this->cond_est * params.krylov.relTolerance );
+  }
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             FGMRES,
+                             InnerKrylovFGMRES,
+                             PipeCG,
+                             PipeGMRES,
+                             SStepGMRES,
+                             RecycledGMRES,
+                             BlockCG );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -243,10 +400,34 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, FGMRES )
+{
+  this->test( params_FGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipeCG )
+{
+  this->test( params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipeGMRES )
+{
+  this->test( params_PipeGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             FGMRES,
+                             PipeCG,
+                             PipeGMRES,
+                             SStepGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
@@ -260,6 +441,219 @@ INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, KrylovSolverBlockTest, HypreInterface, );
 INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, KrylovSolverBlockTest, PetscInterface, );
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////
+
+template< typename LAI >
+class BlockILUTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( BlockILUTest );
+
+TYPED_TEST_P( BlockILUTest, BlockCSRApply )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  // Each rank holds the whole matrix, so that no coupling is dropped from the local block CSR matrix
+  Matrix matrix;
+  geos::testing::compute2DLaplaceOperator( MPI_COMM_SELF, 20, matrix );
+
+  BlockCSRMatrix blockMatrix;
+  blockMatrix.createFromLocalRows( matrix, 4 );
+  EXPECT_EQ( blockMatrix.numRows(), matrix.numLocalRows() );
+
+  Vector x, y, yBlock;
+  x.create( matrix.numLocalCols(), MPI_COMM_SELF );
+  y.create( matrix.numLocalRows(), MPI_COMM_SELF );
+  yBlock.create( matrix.numLocalRows(), MPI_COMM_SELF );
+  x.rand( 1984 );
+
+  matrix.apply( x, y );
+  blockMatrix.apply( x.values(), yBlock.open() );
+  yBlock.close();
+
+  yBlock.axpy( -1.0, y );
+  EXPECT_LT( yBlock.norm2(), 1e-12 * y.norm2() );
+}
+
+TYPED_TEST_P( BlockILUTest, GMRES )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  globalIndex constexpr n = 100;
+  Matrix matrix;
+  geos::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+  PreconditionerBlockILU< TypeParam > precond( 2 );
+  precond.setup( matrix );
+
+  Vector sol_true, sol_comp, rhs;
+  sol_true.create( matrix.numLocalCols(), MPI_COMM_GEOSX );
+  sol_comp.create( matrix.numLocalCols(), MPI_COMM_GEOSX );
+  rhs.create( matrix.numLocalRows(), MPI_COMM_GEOSX );
+  sol_true.rand( 1984 );
+  sol_comp.zero();
+  matrix.apply( sol_true, rhs );
+
+  LinearSolverParameters const params = params_GMRES();
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, precond );
+  solver->solve( rhs, sol_comp );
+  EXPECT_TRUE( solver->result().success() );
+
+  // Condition number for the Laplacian matrix estimate: 4 * n^2 / pi^2
+  real64 const cond_est = 1.5 * 4.0 * n * n / std::pow( M_PI, 2 );
+  sol_comp.axpy( -1.0, sol_true );
+  EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), cond_est * params.krylov.relTolerance );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( BlockILUTest,
+                             BlockCSRApply,
+                             GMRES );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, BlockILUTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, BlockILUTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, BlockILUTest, PetscInterface, );
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+
+template< typename LAI >
+class CprTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( CprTest );
+
+TYPED_TEST_P( CprTest, GMRES )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  globalIndex constexpr n = 100;
+  Matrix matrix;
+  geos::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+  // Pairs of consecutive rows play the role of the blocks of unknowns of a cell
+  for( LinearSolverParameters::CPR::DecouplingType const decoupling : { LinearSolverParameters::CPR::DecouplingType::quasiIMPES,
+                                                                        LinearSolverParameters::CPR::DecouplingType::trueIMPES } )
+  {
+    LinearSolverParameters precondParams;
+    precondParams.preconditionerType = LinearSolverParameters::PreconditionerType::cpr;
+    precondParams.dofsPerNode = 2;
+    precondParams.cpr.decouplingType = decoupling;
+    CprPreconditioner< TypeParam > precond( precondParams );
+    precond.setup( matrix );
+    EXPECT_EQ( precond.pressureMatrix().numGlobalRows(), matrix.numGlobalRows() / 2 );
+
+    Vector sol_true, sol_comp, rhs;
+    sol_true.create( matrix.numLocalCols(), MPI_COMM_GEOSX );
+    sol_comp.create( matrix.numLocalCols(), MPI_COMM_GEOSX );
+    rhs.create( matrix.numLocalRows(), MPI_COMM_GEOSX );
+    sol_true.rand( 1984 );
+    sol_comp.zero();
+    matrix.apply( sol_true, rhs );
+
+    LinearSolverParameters const params = params_GMRES();
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, precond );
+    solver->solve( rhs, sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+
+    // Condition number for the Laplacian matrix estimate: 4 * n^2 / pi^2
+    real64 const cond_est = 1.5 * 4.0 * n * n / std::pow( M_PI, 2 );
+    sol_comp.axpy( -1.0, sol_true );
+    EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), cond_est * params.krylov.relTolerance );
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P( CprTest,
+                             GMRES );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, CprTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, CprTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, CprTest, PetscInterface, );
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////
+
+template< typename LAI >
+class GmgTest : public ::testing::Test
+{};
+
+TYPED_TEST_SUITE_P( GmgTest );
+
+TYPED_TEST_P( GmgTest, GMRES )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  globalIndex constexpr n = 100;
+  Matrix matrix;
+  geos::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+  // The unknowns of the operator are numbered row by row on a n x n grid
+  array2d< real64 > centers( matrix.numLocalRows(), 3 );
+  for( localIndex i = 0; i < matrix.numLocalRows(); ++i )
+  {
+    globalIndex const row = matrix.ilower() + i;
+    centers( i, 0 ) = static_cast< real64 >( row % n );
+    centers( i, 1 ) = static_cast< real64 >( row / n );
+    centers( i, 2 ) = 0.0;
+  }
+
+  LinearSolverParameters precondParams;
+  precondParams.preconditionerType = LinearSolverParameters::PreconditionerType::gmg;
+  GeometricMultigridPreconditioner< TypeParam > precond( precondParams );
+  precond.setCellCenters( centers.toViewConst() );
+  precond.setup( matrix );
+  EXPECT_GT( precond.numLevels(), 1 );
+
+  Vector sol_true, sol_comp, rhs;
+  sol_true.create( matrix.numLocalCols(), MPI_COMM_GEOSX );
+  sol_comp.create( matrix.numLocalCols(), MPI_COMM_GEOSX );
+  rhs.create( matrix.numLocalRows(), MPI_COMM_GEOSX );
+  sol_true.rand( 1984 );
+  sol_comp.zero();
+  matrix.apply( sol_true, rhs );
+
+  LinearSolverParameters const params = params_GMRES();
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, precond );
+  solver->solve( rhs, sol_comp );
+  EXPECT_TRUE( solver->result().success() );
+
+  // Condition number for the Laplacian matrix estimate: 4 * n^2 / pi^2
+  real64 const cond_est = 1.5 * 4.0 * n * n / std::pow( M_PI, 2 );
+  sol_comp.axpy( -1.0, sol_true );
+  EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), cond_est * params.krylov.relTolerance );
+}
+
+REGISTER_TYPED_TEST_SUITE_P( GmgTest,
+                             GMRES );
+
+#ifdef GEOSX_USE_TRILINOS
+INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, GmgTest, TrilinosInterface, );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+INSTANTIATE_TYPED_TEST_SUITE_P( Hypre, GmgTest, HypreInterface, );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+INSTANTIATE_TYPED_TEST_SUITE_P( Petsc, GmgTest, PetscInterface, );
+#endif
 
 int main( int argc, char * * argv )
 {
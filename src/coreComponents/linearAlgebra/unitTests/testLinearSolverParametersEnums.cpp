@@ -34,6 +34,9 @@ TEST( LinearSolverParametersEnums, SolverType )
   ASSERT_EQ( "fgmres", toString( EnumType::fgmres ) );
   ASSERT_EQ( "bicgstab", toString( EnumType::bicgstab ) );
   ASSERT_EQ( "preconditioner", toString( EnumType::preconditioner ) );
+  ASSERT_EQ( "pipecg", toString( EnumType::pipecg ) );
+  ASSERT_EQ( "pipegmres", toString( EnumType::pipegmres ) );
+  ASSERT_EQ( "sstepgmres", toString( EnumType::sstepgmres ) );
 }
 
 
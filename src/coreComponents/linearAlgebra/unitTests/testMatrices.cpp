@@ -278,9 +278,66 @@ TYPED_TEST_P( MatrixTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( MatrixTest, RecreateFromLocalMatrix )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  int const mpiSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  int const mpiRank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+
+  // 1D Laplace operator, so that each rank couples with its neighbors
+  localIndex const numLocalRows = 10;
+  globalIndex const numGlobalRows = numLocalRows * mpiSize;
+  globalIndex const rankOffset = numLocalRows * mpiRank;
+
+  CRSMatrix< real64, globalIndex > localMatrix( numLocalRows, numGlobalRows, 3 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    globalIndex const row = rankOffset + i;
+    if( row > 0 )
+    {
+      localMatrix.insertNonZero( i, row - 1, -1.0 );
+    }
+    localMatrix.insertNonZero( i, row, 2.0 );
+    if( row + 1 < numGlobalRows )
+    {
+      localMatrix.insertNonZero( i, row + 1, -1.0 );
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), numLocalRows, MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Same pattern, new values
+  localMatrix.move( hostMemorySpace, true );
+  forAll< serialPolicy >( numLocalRows, [&]( localIndex const i )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      entries[k] *= 3.0;
+    }
+  } );
+  A.create( localMatrix.toViewConst(), numLocalRows, MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_DOUBLE_EQ( A.normMax(), 6.0 );
+
+  // New pattern, only the diagonal is kept
+  CRSMatrix< real64, globalIndex > diagMatrix( numLocalRows, numGlobalRows, 1 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    diagMatrix.insertNonZero( i, rankOffset + i, 5.0 );
+  }
+  A.create( diagMatrix.toViewConst(), numLocalRows, MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 5.0 );
+  EXPECT_DOUBLE_EQ( A.normFrobenius(), 5.0 * std::sqrt( static_cast< real64 >( numGlobalRows ) ) );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( MatrixTest,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             RecreateFromLocalMatrix );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, MatrixTest, TrilinosInterface, );
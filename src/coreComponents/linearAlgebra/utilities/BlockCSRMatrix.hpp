@@ -0,0 +1,242 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockCSRMatrix.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_UTILITIES_BLOCKCSRMATRIX_HPP_
+#define GEOS_LINEARALGEBRA_UTILITIES_BLOCKCSRMATRIX_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "linearAlgebra/common/common.hpp"
+
+#include <algorithm>
+
+namespace geos
+{
+
+/**
+ * @class BlockCSRMatrix
+ * @brief Local sparse matrix in block compressed sparse row (BSR) format with square dense blocks.
+ *
+ * Multi-component discretizations produce dense blocks coupling all the dofs of two mesh objects.
+ * Storing one column index per block instead of one per entry divides the index memory by the square
+ * of the block size, and the dense blocks are applied with contiguous accesses.
+ *
+ * The matrix holds the locally owned rows and columns of a distributed matrix (its diagonal part),
+ * which is what local preconditioners such as block ILU consume.
+ */
+class BlockCSRMatrix
+{
+public:
+
+  /**
+   * @brief Build the matrix from the locally owned rows of a parallel matrix.
+   * @tparam MATRIX type of parallel matrix
+   * @param matrix the parallel matrix
+   * @param blockSize size of the dense blocks
+   *
+   * Entries in columns owned by other ranks are dropped. The local number of rows must be a multiple of
+   * the block size, and consecutive rows are grouped in blocks.
+   */
+  template< typename MATRIX >
+  void createFromLocalRows( MATRIX const & matrix, localIndex const blockSize )
+  {
+    GEOS_LAI_ASSERT( matrix.ready() );
+    GEOS_LAI_ASSERT_GT( blockSize, 0 );
+    GEOS_LAI_ASSERT_EQ( matrix.numLocalRows() % blockSize, 0 );
+
+    m_blockSize = blockSize;
+    globalIndex const ilower = matrix.ilower();
+    globalIndex const iupper = matrix.iupper();
+    localIndex const numBlockRows = matrix.numLocalRows() / blockSize;
+
+    // First pass: sparsity pattern of the blocks
+    m_rowOffsets.resize( numBlockRows + 1 );
+    m_rowOffsets[0] = 0;
+    array1d< globalIndex > cols;
+    array1d< real64 > vals;
+    std::vector< localIndex > blockCols;
+    std::vector< localIndex > allBlockCols;
+    for( localIndex iBlock = 0; iBlock < numBlockRows; ++iBlock )
+    {
+      blockCols.clear();
+      for( localIndex j = 0; j < blockSize; ++j )
+      {
+        globalIndex const iRow = ilower + iBlock * blockSize + j;
+        localIndex const rowLength = matrix.rowLength( iRow );
+        cols.resize( rowLength );
+        vals.resize( rowLength );
+        matrix.getRowCopy( iRow, cols, vals );
+        for( localIndex k = 0; k < rowLength; ++k )
+        {
+          if( cols[k] >= ilower && cols[k] < iupper )
+          {
+            blockCols.push_back( LvArray::integerConversion< localIndex >( cols[k] - ilower ) / blockSize );
+          }
+        }
+      }
+      std::sort( blockCols.begin(), blockCols.end() );
+      blockCols.erase( std::unique( blockCols.begin(), blockCols.end() ), blockCols.end() );
+      allBlockCols.insert( allBlockCols.end(), blockCols.begin(), blockCols.end() );
+      m_rowOffsets[iBlock + 1] = LvArray::integerConversion< localIndex >( allBlockCols.size() );
+    }
+
+    m_columns.resize( allBlockCols.size() );
+    m_diagIndices.resize( numBlockRows );
+    m_diagIndices.setValues< serialPolicy >( -1 );
+    for( localIndex iBlock = 0; iBlock < numBlockRows; ++iBlock )
+    {
+      for( localIndex p = m_rowOffsets[iBlock]; p < m_rowOffsets[iBlock + 1]; ++p )
+      {
+        m_columns[p] = allBlockCols[p];
+        if( m_columns[p] == iBlock )
+        {
+          m_diagIndices[iBlock] = p;
+        }
+      }
+    }
+
+    // Second pass: values of the blocks
+    m_values.resize( m_columns.size(), blockSize, blockSize );
+    m_values.zero();
+    for( localIndex iBlock = 0; iBlock < numBlockRows; ++iBlock )
+    {
+      localIndex const * const rowColsBegin = m_columns.data() + m_rowOffsets[iBlock];
+      localIndex const * const rowColsEnd = m_columns.data() + m_rowOffsets[iBlock + 1];
+      for( localIndex j = 0; j < blockSize; ++j )
+      {
+        globalIndex const iRow = ilower + iBlock * blockSize + j;
+        localIndex const rowLength = matrix.rowLength( iRow );
+        cols.resize( rowLength );
+        vals.resize( rowLength );
+        matrix.getRowCopy( iRow, cols, vals );
+        for( localIndex k = 0; k < rowLength; ++k )
+        {
+          if( cols[k] >= ilower && cols[k] < iupper )
+          {
+            localIndex const localCol = LvArray::integerConversion< localIndex >( cols[k] - ilower );
+            localIndex const p = std::lower_bound( rowColsBegin, rowColsEnd, localCol / blockSize ) - m_columns.data();
+            m_values( p, j, localCol % blockSize ) += vals[k];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Compute the product with a local vector, y = A x.
+   * @param x the input vector (local entries)
+   * @param y the output vector (local entries)
+   */
+  void apply( arrayView1d< real64 const > const & x,
+              arrayView1d< real64 > const & y ) const
+  {
+    GEOS_LAI_ASSERT_EQ( x.size(), numRows() );
+    GEOS_LAI_ASSERT_EQ( y.size(), numRows() );
+
+    arrayView1d< localIndex const > const rowOffsets = m_rowOffsets.toViewConst();
+    arrayView1d< localIndex const > const columns = m_columns.toViewConst();
+    arrayView3d< real64 const > const values = m_values.toViewConst();
+    localIndex const blockSize = m_blockSize;
+    forAll< parallelDevicePolicy<> >( numBlockRows(), [=] GEOS_HOST_DEVICE ( localIndex const iBlock )
+    {
+      for( localIndex j = 0; j < blockSize; ++j )
+      {
+        y[iBlock * blockSize + j] = 0.0;
+      }
+      for( localIndex p = rowOffsets[iBlock]; p < rowOffsets[iBlock + 1]; ++p )
+      {
+        localIndex const offset = columns[p] * blockSize;
+        for( localIndex j = 0; j < blockSize; ++j )
+        {
+          real64 sum = 0.0;
+          for( localIndex k = 0; k < blockSize; ++k )
+          {
+            sum += values( p, j, k ) * x[offset + k];
+          }
+          y[iBlock * blockSize + j] += sum;
+        }
+      }
+    } );
+  }
+
+  /**
+   * @return the size of the dense blocks
+   */
+  localIndex blockSize() const { return m_blockSize; }
+
+  /**
+   * @return the number of block rows (and block columns)
+   */
+  localIndex numBlockRows() const { return m_diagIndices.size(); }
+
+  /**
+   * @return the number of scalar rows (and columns)
+   */
+  localIndex numRows() const { return numBlockRows() * m_blockSize; }
+
+  /**
+   * @return the number of nonzero blocks
+   */
+  localIndex numBlocks() const { return m_columns.size(); }
+
+  /**
+   * @return the offsets of the block rows in the column and value arrays
+   */
+  arrayView1d< localIndex const > rowOffsets() const { return m_rowOffsets.toViewConst(); }
+
+  /**
+   * @return the block column indices, sorted within each block row
+   */
+  arrayView1d< localIndex const > columns() const { return m_columns.toViewConst(); }
+
+  /**
+   * @return the position of the diagonal block of each block row, or -1 if it is structurally zero
+   */
+  arrayView1d< localIndex const > diagIndices() const { return m_diagIndices.toViewConst(); }
+
+  /**
+   * @return the dense blocks, indexed by (block, row in block, column in block)
+   */
+  arrayView3d< real64 const > values() const { return m_values.toViewConst(); }
+
+  /**
+   * @return modifiable dense blocks, indexed by (block, row in block, column in block)
+   */
+  arrayView3d< real64 > values() { return m_values.toView(); }
+
+private:
+
+  /// Size of the dense blocks
+  localIndex m_blockSize = 1;
+
+  /// Offsets of the block rows
+  array1d< localIndex > m_rowOffsets;
+
+  /// Block column indices
+  array1d< localIndex > m_columns;
+
+  /// Position of the diagonal blocks
+  array1d< localIndex > m_diagIndices;
+
+  /// Values of the dense blocks
+  array3d< real64 > m_values;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_UTILITIES_BLOCKCSRMATRIX_HPP_
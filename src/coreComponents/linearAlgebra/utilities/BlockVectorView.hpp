@@ -102,6 +102,13 @@ public:
    */
   real64 dot( BlockVectorView const & x ) const;
 
+  /**
+   * @brief Dot product restricted to the locally owned entries.
+   * @param x the block vector to compute product with
+   * @return the local contribution to the dot product (no global reduction is performed)
+   */
+  real64 localDot( BlockVectorView const & x ) const;
+
   /**
    * @brief 2-norm of the block vector.
    * @return 2-norm of the block vector
@@ -158,6 +165,12 @@ public:
    */
   localIndex localSize() const;
 
+  /**
+   * @brief Get the communicator used by the blocks.
+   * @return the MPI communicator
+   */
+  MPI_Comm comm() const;
+
   /**
    * @brief Print the block vector.
    * @param os the stream to print to
@@ -306,6 +319,18 @@ real64 BlockVectorView< VECTOR >::dot( BlockVectorView const & src ) const
   return accum;
 }
 
+template< typename VECTOR >
+real64 BlockVectorView< VECTOR >::localDot( BlockVectorView const & src ) const
+{
+  GEOS_LAI_ASSERT_EQ( blockSize(), src.blockSize() );
+  real64 accum = 0;
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    accum += block( i ).localDot( src.block( i ) );
+  }
+  return accum;
+}
+
 template< typename VECTOR >
 real64 BlockVectorView< VECTOR >::norm2() const
 {
@@ -380,6 +405,13 @@ localIndex BlockVectorView< VECTOR >::localSize() const
   return size;
 }
 
+template< typename VECTOR >
+MPI_Comm BlockVectorView< VECTOR >::comm() const
+{
+  GEOS_LAI_ASSERT_GT( blockSize(), 0 );
+  return block( 0 ).comm();
+}
+
 template< typename VECTOR >
 void BlockVectorView< VECTOR >::print( std::ostream & os ) const
 {
@@ -204,6 +204,7 @@ MATRIX permuteMatrix( MATRIX const & matrix,
 
 /**
  * @brief Computes rigid body modes
+ * @details The entries of the modes are filled on device from the node coordinates.
  * @tparam VECTOR output vector type
  * @param mesh the mesh
  * @param dofManager the degree-of-freedom manager
@@ -251,7 +252,7 @@ void computeRigidBodyModes( MeshLevel const & mesh,
   {
     rigidBodyModes[k].create( numNodes * numComponents, MPI_COMM_GEOSX );
     arrayView1d< real64 > const values = rigidBodyModes[k].open();
-    forAll< parallelHostPolicy >( numNodes, [=]( localIndex const i )
+    forAll< parallelDevicePolicy<> >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
     {
       values[numComponents * i + k] = 1.0;
     } );
@@ -266,7 +267,7 @@ void computeRigidBodyModes( MeshLevel const & mesh,
       rigidBodyModes[k].create( numNodes*numComponents, MPI_COMM_GEOSX );
       {
         arrayView1d< real64 > const values = rigidBodyModes[k].open();
-        forAll< parallelHostPolicy >( numNodes, [=]( localIndex const i )
+        forAll< parallelDevicePolicy<> >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
         {
           values[numComponents * i + 0] = -nodePosition[globalNodeListView[i]][1];
           values[numComponents * i + 1] = +nodePosition[globalNodeListView[i]][0];
@@ -287,7 +288,7 @@ void computeRigidBodyModes( MeshLevel const & mesh,
       rigidBodyModes[k].create( numNodes*numComponents, MPI_COMM_GEOSX );
       {
         arrayView1d< real64 > const values = rigidBodyModes[k].open();
-        forAll< parallelHostPolicy >( numNodes, [=]( localIndex const i )
+        forAll< parallelDevicePolicy<> >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
         {
           values[numComponents * i + 0] = +nodePosition[globalNodeListView[i]][1];
           values[numComponents * i + 1] = -nodePosition[globalNodeListView[i]][0];
@@ -305,7 +306,7 @@ void computeRigidBodyModes( MeshLevel const & mesh,
       rigidBodyModes[k].create( numNodes*numComponents, MPI_COMM_GEOSX );
       {
         arrayView1d< real64 > const values = rigidBodyModes[k].open();
-        forAll< parallelHostPolicy >( numNodes, [=]( localIndex const i )
+        forAll< parallelDevicePolicy<> >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
         {
           values[numComponents * i + 1] = -nodePosition[globalNodeListView[i]][2];
           values[numComponents * i + 2] = +nodePosition[globalNodeListView[i]][1];
@@ -323,7 +324,7 @@ void computeRigidBodyModes( MeshLevel const & mesh,
       rigidBodyModes[k].create( numNodes*numComponents, MPI_COMM_GEOSX );
       {
         arrayView1d< real64 > const values = rigidBodyModes[k].open();
-        forAll< parallelHostPolicy >( numNodes, [=]( localIndex const i )
+        forAll< parallelDevicePolicy<> >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
         {
           values[numComponents * i + 0] = +nodePosition[globalNodeListView[i]][2];
           values[numComponents * i + 2] = -nodePosition[globalNodeListView[i]][0];
@@ -42,7 +42,10 @@ struct LinearSolverParameters
     gmres,         ///< GMRES
     fgmres,        ///< Flexible GMRES
     bicgstab,      ///< BiCGStab
-    preconditioner ///< Preconditioner only
+    preconditioner, ///< Preconditioner only
+    pipecg,        ///< Pipelined CG
+    pipegmres,     ///< Pipelined GMRES
+    sstepgmres     ///< s-step (communication-avoiding) GMRES
   };
 
   /**
@@ -66,6 +69,8 @@ struct LinearSolverParameters
     block,     ///< Block preconditioner
     direct,    ///< Direct solver as preconditioner
     bgs,       ///< Gauss-Seidel smoothing (backward sweep)
+    cpr,       ///< Constrained pressure residual (two-stage)
+    gmg,       ///< Geometric multigrid (structured meshes)
   };
 
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
@@ -75,6 +80,7 @@ struct LinearSolverParameters
 
   SolverType solverType = SolverType::direct;          ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
+  integer preconditionerSinglePrecision = 0; ///< Whether the leading block of the block preconditioner is applied in single precision
 
   /// Direct solver parameters: used for SuperLU_Dist interface through hypre and PETSc
   struct Direct
@@ -108,6 +114,7 @@ struct LinearSolverParameters
     integer replaceTinyPivot = 1;     ///< Whether to replace tiny pivots by sqrt(epsilon)*norm(A)
     integer iterativeRefine = 1;      ///< Whether to perform iterative refinement
     integer parallel = 1;             ///< Whether to use a parallel solver (instead of a serial one)
+    integer reuseSymbolic = 0;        ///< Whether to reuse the ordering and symbolic analysis when the sparsity pattern is unchanged
   }
   direct;                             ///< direct solver parameter struct
 
@@ -119,6 +126,9 @@ struct LinearSolverParameters
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    integer basisBlockSize = 4;       ///< Number of basis vectors computed between two orthogonalizations (s-step GMRES)
+    integer recycleSize = 0;          ///< Number of vectors of the subspace recycled from one solve to the next (GMRES)
+    integer innerSolve = false;       ///< Solve a block of a block preconditioner with the Krylov method instead of applying its preconditioner once
   }
   krylov;                             ///< Krylov-method parameter struct
 
@@ -130,6 +140,16 @@ struct LinearSolverParameters
   }
   scaling;                            ///< Matrix-scaling parameter struct
 
+  /// Preconditioner reuse parameters
+  struct Reuse
+  {
+    integer maxSolves = 0;            ///< Max number of linear solves sharing one preconditioner setup or direct factorization (0 to rebuild at every solve)
+    integer acrossTimeSteps = 0;      ///< Whether a preconditioner setup can be kept from one time step to the next
+    real64 iterationGrowth = 2.0;     ///< Rebuild once the Krylov iteration count exceeds this factor times the count after setup
+    integer constantMatrix = 0;       ///< Whether the setup is kept for as long as the assembled matrix does not change
+  }
+  reuse;                              ///< Preconditioner reuse parameter struct
+
   /// Algebraic multigrid parameters
   struct AMG
   {
@@ -251,6 +271,11 @@ struct LinearSolverParameters
                                                                     ///< and smoothed-aggregation AMG)
     integer separateComponents = false;                             ///< Apply a separate component filter before AMG construction
     NullSpaceType nullSpaceType = NullSpaceType::constantModes;     ///< Null space type [constantModes,rigidBodyModes]
+    integer coarseAgglomerationSize = 0;                            ///< Global number of rows below which the coarse levels
+                                                                    ///< are gathered (0 to disable, CPU hypre only)
+    integer coarseRedundant = 0;                                    ///< Solve the gathered coarse levels on all ranks instead of one
+    integer coarseSuperLUDistSize = 0;                              ///< Global number of rows below which the coarsest level
+                                                                    ///< is solved with SuperLU_Dist (0 to disable)
   }
   amg;                                                              ///< Algebraic Multigrid (AMG) parameters
 
@@ -285,14 +310,63 @@ struct LinearSolverParameters
       solidMechanicsEmbeddedFractures            ///< Embedded fractures mechanics
     };
 
+    /// Number of candidate configurations of the recipes used by the adaptive mode
+    static constexpr integer numConfigurations = 3;
+
     StrategyType strategy = StrategyType::invalid; ///< Predefined MGR solution strategy (solver specific)
     integer separateComponents = false;            ///< Apply a separate displacement component (SDC) filter before AMG construction
     string displacementFieldName;                  ///< Displacement field name need for SDC filter
     integer areWellsShut = false;                   ///< Flag to let MGR know that wells are shut, and that jacobi can be applied to the
                                                     ///< well block
+    integer adaptive = false;                       ///< Switch to a more robust configuration of the recipe when convergence degrades
+    integer adaptiveMaxIterations = 100;            ///< Number of Krylov iterations above which the adaptive mode switches configuration
+    integer configuration = 0;                      ///< Candidate configuration of the recipe (set by the adaptive mode, 0 is the default recipe)
   }
   mgr;                                             ///< Multigrid reduction (MGR) parameters
 
+  /// Constrained pressure residual (CPR) parameters
+  struct CPR
+  {
+    /**
+     * @brief Decoupling of the pressure equation
+     */
+    enum class DecouplingType : integer
+    {
+      quasiIMPES, ///< Weights from the diagonal block of each cell
+      trueIMPES   ///< Weights from the sum of the blocks of each block row
+    };
+
+    /**
+     * @brief Second stage preconditioner
+     */
+    enum class SecondStageType : integer
+    {
+      blockILU,   ///< Block ILU(0) of the local rows (triangular solves on host)
+      blockJacobi ///< Block Jacobi (applied on device)
+    };
+
+    /**
+     * @brief Preconditioner of the pressure stage
+     */
+    enum class PressureStageType : integer
+    {
+      amg, ///< Algebraic multigrid
+      gmg  ///< Geometric multigrid (structured meshes)
+    };
+
+    DecouplingType decouplingType = DecouplingType::quasiIMPES;  ///< Decoupling of the pressure equation
+    SecondStageType secondStageType = SecondStageType::blockILU; ///< Second stage preconditioner
+    PressureStageType pressureStageType = PressureStageType::amg; ///< Preconditioner of the pressure stage
+  }
+  cpr;                                             ///< Constrained pressure residual (CPR) parameters
+
+  /// Geometric multigrid parameters (the smoothing and cycle parameters are those of AMG)
+  struct GMG
+  {
+    integer maxCoarseSize = 1000; ///< Global number of rows below which the coarsening stops
+  }
+  gmg;                            ///< Geometric multigrid (GMG) parameters
+
   /// Incomplete factorization parameters
   struct IFact
   {
@@ -316,7 +390,10 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
-              "preconditioner" );
+              "preconditioner",
+              "pipecg",
+              "pipegmres",
+              "sstepgmres" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
@@ -335,7 +412,24 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "mgr",
               "block",
               "direct",
-              "bgs" );
+              "bgs",
+              "cpr",
+              "gmg" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::CPR::DecouplingType,
+              "quasiIMPES",
+              "trueIMPES" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::CPR::SecondStageType,
+              "blockILU",
+              "blockJacobi" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::CPR::PressureStageType,
+              "amg",
+              "gmg" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
@@ -20,6 +20,10 @@
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "common/Timer.hpp"
 
+#if defined( GEOS_USE_PAPI )
+  #include "common/HardwareCounters.hpp"
+#endif
+
 // TPL includes
 #include <conduit.hpp>
 
@@ -95,6 +99,15 @@ GeosxState::GeosxState( std::unique_ptr< CommandLineOptions > && commandLineOpti
   setupCaliper( *m_caliperManager, getCommandLineOptions() );
 #endif
 
+  if( !getCommandLineOptions().hardwareCounters.empty() )
+  {
+#if defined( GEOS_USE_PAPI )
+    hardwareCounters::initialize( getCommandLineOptions().hardwareCounters );
+#else
+    GEOS_ERROR( "The hardware counters require GEOS to be built with PAPI (set PAPI_DIR)" );
+#endif
+  }
+
   string restartFileName;
   if( ProblemManager::parseRestart( restartFileName, getCommandLineOptions() ) )
   {
@@ -176,12 +189,32 @@ void GeosxState::run()
 
   GEOS_THROW_IF_NE( m_state, State::READY_TO_RUN, std::logic_error );
 
+  if( getCommandLineOptions().dryRunCycles >= 0 )
+  {
+    getProblemManager().runDryRun( getCommandLineOptions().dryRunCycles );
+    m_state = State::COMPLETED;
+    return;
+  }
+
   if( !getProblemManager().runSimulation() )
   {
     m_state = State::COMPLETED;
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void GeosxState::resetSimulation()
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_THROW_IF( m_state != State::READY_TO_RUN && m_state != State::COMPLETED,
+                 "The simulation can only be reset once the initial conditions have been applied",
+                 std::logic_error );
+
+  getProblemManager().resetSimulation();
+  m_state = State::INITIALIZED;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 dataRepository::Group & GeosxState::getProblemManagerAsGroup()
 { return getProblemManager(); }
@@ -136,6 +136,14 @@ public:
    */
   void run();
 
+  /**
+   * @brief Rewind the simulation to its start to run another realization on the same mesh.
+   * @pre This must be called when @c getState() is @c State::READY_TO_RUN or @c State::COMPLETED.
+   * @post After this call @c getState() is @c State::INITIALIZED, and the (new) initial conditions
+   *   have to be applied with @c applyInitialConditions().
+   */
+  void resetSimulation();
+
   /**
    * @brief Return the current State.
    * @return The current state.
@@ -26,6 +26,7 @@
 #include "dataRepository/ConduitRestart.hpp"
 #include "dataRepository/RestartFlags.hpp"
 #include "dataRepository/KeyNames.hpp"
+#include "dataRepository/Utilities.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "events/tasks/TasksManager.hpp"
 #include "events/EventManager.hpp"
@@ -47,7 +48,12 @@
 #include "physicsSolvers/SolverBase.hpp"
 #include "schema/schemaUtilities.hpp"
 
+// TPL includes
+#include <umpire/ResourceManager.hpp>
+
 // System includes
+#include <chrono>
+#include <map>
 #include <vector>
 #include <regex>
 
@@ -137,6 +143,11 @@ ProblemManager::ProblemManager( conduit::Node & root ):
     setRestartFlags( RestartFlags::WRITE ).
     setDescription( "Whether to disallow using pinned memory allocations for MPI communication buffers." );
 
+  commandLine.registerWrapper< integer >( viewKeys.useUnifiedBuffers.key( ) ).
+    setApplyDefaultValue( 0 ).
+    setRestartFlags( RestartFlags::WRITE ).
+    setDescription( "Whether to allocate MPI communication buffers in unified memory, so that they can be handed to a device-aware MPI." );
+
 }
 
 ProblemManager::~ProblemManager()
@@ -180,6 +191,7 @@ void ProblemManager::parseCommandLineInput()
   commandLine.getReference< integer >( viewKeys.overridePartitionNumbers ) = opts.overridePartitionNumbers;
   commandLine.getReference< integer >( viewKeys.useNonblockingMPI ) = opts.useNonblockingMPI;
   commandLine.getReference< integer >( viewKeys.suppressPinned ) = opts.suppressPinned;
+  commandLine.getReference< integer >( viewKeys.useUnifiedBuffers ) = opts.useUnifiedBuffers;
 
   string & outputDirectory = commandLine.getReference< string >( viewKeys.outputDirectory );
   outputDirectory = opts.outputDirectory;
@@ -481,6 +493,8 @@ void ProblemManager::postProcessInput()
 
   integer const & suppressPinned = commandLine.getReference< integer >( viewKeys.suppressPinned );
   setPreferPinned((suppressPinned == 0));
+  integer const & useUnifiedBuffers = commandLine.getReference< integer >( viewKeys.useUnifiedBuffers );
+  setPreferUnified((useUnifiedBuffers != 0));
 
   PartitionBase & partition = domain.getReference< PartitionBase >( keys::partitionManager );
   bool repartition = false;
@@ -645,6 +659,36 @@ void ProblemManager::generateMesh()
     }
   }
 
+  // the ghost layer of each mesh body is the union of the needs of the solvers targeting it
+  std::map< string, GhostConnectivity > ghostConnectivities;
+  m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    GhostConnectivity const connectivity = solver.getGhostConnectivity( domain );
+    for( auto const & target : solver.getMeshTargets() )
+    {
+      auto const it = ghostConnectivities.find( target.first.first );
+      ghostConnectivities[target.first.first] = ( it == ghostConnectivities.end() ) ? connectivity : std::max( it->second, connectivity );
+    }
+  } );
+  domain.forMeshBodies( [&]( MeshBody & meshBody )
+  {
+    auto const it = ghostConnectivities.find( meshBody.getName() );
+    GhostConnectivity connectivity = ( it == ghostConnectivities.end() ) ? GhostConnectivity::Nodes : it->second;
+
+    // the fracture, embedded surface and well elements rely on the cells sharing their nodes
+    meshBody.getBaseDiscretization().getElemManager().forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+    {
+      if( dynamic_cast< CellElementSubRegion const * >( &subRegion ) == nullptr )
+      {
+        connectivity = GhostConnectivity::Nodes;
+      }
+    } );
+
+    meshBody.setGhostConnectivity( connectivity );
+    GEOS_LOG_RANK_0( GEOS_FMT( "{}: ghost cells reached through the {} of the partition boundary",
+                               meshBody.getName(), EnumStrings< GhostConnectivity >::toString( connectivity ) ) );
+  } );
+
   domain.setupCommunications( useNonblockingMPI );
 
   domain.forMeshBodies( [&]( MeshBody & meshBody )
@@ -937,9 +981,8 @@ map< std::tuple< string, string, string, string >, localIndex > ProblemManager::
 
                   localIndex const numQuadraturePoints = FE_TYPE::numQuadraturePoints;
 
-//#if ! defined( CALC_FEM_SHAPE_IN_KERNEL )
                   feDiscretization->calculateShapeFunctionGradients< SUBREGION_TYPE, FE_TYPE >( X, &subRegion, meshData, finiteElement );
-//#endif
+                  feDiscretization->storeVirtualElementProjectors< SUBREGION_TYPE, FE_TYPE >( subRegion, meshData, finiteElement );
 
                   localIndex & numQuadraturePointsInList = regionQuadrature[ std::make_tuple( meshBodyName,
                                                                                               meshLevel.getName(),
@@ -1074,6 +1117,151 @@ bool ProblemManager::runSimulation()
   return m_eventManager->run( getDomainPartition() );
 }
 
+namespace
+{
+
+/**
+ * @brief Format a number of bytes with a metric prefix.
+ * @param[in] bytes the number of bytes
+ * @return the formatted size
+ */
+string formatBytes( size_t const bytes )
+{
+  return stringutilities::toMetricPrefixString( bytes ) + 'B';
+}
+
+/**
+ * @brief Log the memory allocated by the data repository in each memory space, and by the Umpire allocators.
+ * @param[in] group the root of the data repository
+ * @param[in] stage the stage of the dry run, used in the message
+ */
+void logMemoryEstimate( Group const & group, string const & stage )
+{
+  std::vector< WrapperAllocation > allocations;
+  collectMemoryAllocations( group, allocations );
+
+  size_t hostBytes = 0;
+  size_t deviceBytes = 0;
+  for( WrapperAllocation const & allocation : allocations )
+  {
+    ( allocation.space == hostMemorySpace ? hostBytes : deviceBytes ) += allocation.bytes;
+  }
+
+  // the Umpire allocators also account for the memory allocated outside of the data repository (e.g. the linear systems)
+  size_t umpireHighWaterMark = 0;
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+  for( string const & allocatorName : rm.getAllocatorNames() )
+  {
+    if( allocatorName.rfind( "__umpire_internal", 0 ) != 0 )
+    {
+      umpireHighWaterMark += rm.getAllocator( allocatorName ).getHighWatermark();
+    }
+  }
+
+  GEOS_LOG_RANK_0( GEOS_FMT( "  Memory {}: data repository per rank max = {} (host {}, device {}), sum over ranks = {}; "
+                             "Umpire high-water mark per rank max = {}",
+                             stage,
+                             formatBytes( MpiWrapper::max( hostBytes + deviceBytes ) ),
+                             formatBytes( MpiWrapper::max( hostBytes ) ),
+                             formatBytes( MpiWrapper::max( deviceBytes ) ),
+                             formatBytes( MpiWrapper::sum( hostBytes + deviceBytes ) ),
+                             formatBytes( MpiWrapper::max( umpireHighWaterMark ) ) ) );
+}
+
+}
+
+void ProblemManager::runDryRun( integer const numCycles )
+{
+  GEOS_MARK_FUNCTION;
+
+  DomainPartition & domain = getDomainPartition();
+  EventManager & eventManager = getEventManager();
+
+  GEOS_LOG_RANK_0( GEOS_FMT( "Dry run on {} ranks, sampling {} cycles", MpiWrapper::commSize(), numCycles ) );
+  logMemoryEstimate( *this, "after initialization" );
+  if( numCycles == 0 )
+  {
+    return;
+  }
+
+  // snapshot of the counters of the solvers and of the events before the sampled cycles
+  std::map< SolverBase const *, integer > nonlinearIterations;
+  std::map< SolverBase const *, real64 > linearSolverTimes;
+  getPhysicsSolverManager().forSubGroups< SolverBase >( [&]( SolverBase & solver )
+  {
+    nonlinearIterations[&solver] = solver.getSolverStatistics().getNumNonlinearIterations();
+    linearSolverTimes[&solver] = solver.getSolverStatistics().getLinearSolverTime();
+  } );
+  std::vector< real64 > eventWallTimes = eventManager.getEventWallTimes();
+  std::vector< integer > eventExecutionCounts = eventManager.getEventExecutionCounts();
+  eventWallTimes.resize( eventManager.numSubGroups(), 0.0 );
+  eventExecutionCounts.resize( eventManager.numSubGroups(), 0 );
+
+  real64 const startTime = eventManager.getTime();
+  integer const startCycle = eventManager.getCycle();
+  integer const maxCycle = eventManager.getMaxCycle();
+
+  // run the sampled cycles, as in a regular run (the events executed in these cycles write their outputs)
+  eventManager.setMaxCycle( startCycle + std::min( numCycles, maxCycle - startCycle ) );
+  std::chrono::steady_clock::time_point const startWallTime = std::chrono::steady_clock::now();
+  while( runSimulation() )
+  {}
+  real64 const sampleWallTime =
+    MpiWrapper::max( std::chrono::duration< real64 >( std::chrono::steady_clock::now() - startWallTime ).count() );
+  eventManager.setMaxCycle( maxCycle );
+
+  integer const sampledCycles = eventManager.getCycle() - startCycle;
+  real64 const sampledTime = eventManager.getTime() - startTime;
+  GEOS_LOG_RANK_0( GEOS_FMT( "  Sampled {} cycles from time {} s to time {} s in {:.4g} s",
+                             sampledCycles, startTime, eventManager.getTime(), sampleWallTime ) );
+  if( sampledCycles == 0 )
+  {
+    return;
+  }
+
+  // cost of each event over the sampled cycles
+  for( localIndex i = 0; i < eventManager.numSubGroups(); ++i )
+  {
+    EventBase const & event = *static_cast< EventBase const * >( eventManager.getSubGroups()[i] );
+    integer const numExecutions = eventManager.getEventExecutionCounts()[i] - eventExecutionCounts[i];
+    real64 const wallTime = MpiWrapper::max( eventManager.getEventWallTimes()[i] - eventWallTimes[i] );
+    if( numExecutions == 0 )
+    {
+      continue;
+    }
+
+    string details = GEOS_FMT( "{:.4g} s per execution", wallTime / numExecutions );
+    if( SolverBase const * const solver = dynamic_cast< SolverBase const * >( event.getEventTarget() ) )
+    {
+      integer const numIterations = solver->getSolverStatistics().getNumNonlinearIterations() - nonlinearIterations[solver];
+      real64 const linearSolverTime = solver->getSolverStatistics().getLinearSolverTime() - linearSolverTimes[solver];
+      if( numIterations > 0 )
+      {
+        details += GEOS_FMT( ", {} nonlinear iterations, {:.4g} s per iteration ({:.1f}% in the linear solver)",
+                             numIterations, wallTime / numIterations, wallTime > 0.0 ? 100.0 * linearSolverTime / wallTime : 0.0 );
+      }
+    }
+    else if( dynamic_cast< OutputBase const * >( event.getEventTarget() ) != nullptr )
+    {
+      details += " (output)";
+    }
+    GEOS_LOG_RANK_0( GEOS_FMT( "  Event {} ({}): {} executions, {:.4g} s, {}",
+                               event.getName(), event.getEventName(), numExecutions, wallTime, details ) );
+  }
+
+  // extrapolation to the remaining cycles, using the mean time step of the sample
+  real64 remainingCycles = static_cast< real64 >( maxCycle - eventManager.getCycle() );
+  if( sampledTime > 0.0 )
+  {
+    remainingCycles = std::min( remainingCycles, std::ceil( ( eventManager.getMaxTime() - eventManager.getTime() ) * sampledCycles / sampledTime ) );
+  }
+  remainingCycles = std::max( remainingCycles, 0.0 );
+  GEOS_LOG_RANK_0( GEOS_FMT( "  Estimated cost of the remaining run: {:.0f} cycles, {:.4g} s ({:.4g} s per cycle)",
+                             remainingCycles, remainingCycles * sampleWallTime / sampledCycles, sampleWallTime / sampledCycles ) );
+
+  logMemoryEstimate( *this, "after the sampled cycles" );
+}
+
 DomainPartition & ProblemManager::getDomainPartition()
 {
   return getGroup< DomainPartition >( groupKeys.domain );
@@ -1106,9 +1294,19 @@ void ProblemManager::applyInitialConditions()
   initializePostInitialConditions();
 }
 
+void ProblemManager::resetSimulation()
+{
+  getEventManager().reinit();
+  getPhysicsSolverManager().forSubGroups< SolverBase >( []( SolverBase & solver )
+  {
+    solver.resetTimestepRequest();
+  } );
+}
+
 void ProblemManager::readRestartOverwrite()
 {
   this->loadFromConduit();
+  dataRepository::finishLoadingTree();
   this->postRestartInitializationRecursive();
 }
 
@@ -159,6 +159,15 @@ public:
    */
   bool runSimulation();
 
+  /**
+   * @brief Estimate the resources of the run without running it to completion.
+   * @param[in] numCycles the number of cycles of the event loop to sample
+   * @details The memory allocated per rank in each memory space is reported after the initialization,
+   * then the first @p numCycles cycles are run and their cost is reported per event (per nonlinear
+   * iteration for the solvers, per execution for the outputs) and extrapolated to the remaining cycles.
+   */
+  void runDryRun( integer const numCycles );
+
   /**
    * @brief After initialization, overwrites data using a restart file
    */
@@ -169,6 +178,13 @@ public:
    */
   void applyInitialConditions();
 
+  /**
+   * @brief Rewind the event loop and the time steps of the solvers to the start of the simulation,
+   *        keeping the mesh and the data of the domain.
+   * @note The initial conditions have to be applied again before running the simulation.
+   */
+  void resetSimulation();
+
   /**
    * @brief Returns a pointer to the DomainPartition
    * @return Pointer to the DomainPartition
@@ -229,6 +245,8 @@ public:
     dataRepository::ViewKey useNonblockingMPI        = {"useNonblockingMPI"};        ///< Flag to use non-block MPI key
     dataRepository::ViewKey suppressPinned           = {"suppressPinned"};           ///< Flag to suppress use of pinned
                                                                                      ///< memory key
+    dataRepository::ViewKey useUnifiedBuffers        = {"useUnifiedBuffers"};        ///< Flag to use unified memory
+                                                                                     ///< for communication buffers key
   } viewKeys; ///< Command line input viewKeys
 
   /// Child group viewKeys
@@ -97,12 +97,17 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     SCHEMA,
     NONBLOCKING_MPI,
     SUPPRESS_PINNED,
+    UNIFIED_BUFFERS,
+    MEMORY_POOLS,
     PROBLEMNAME,
     OUTPUTDIR,
     TIMERS,
+    HARDWARE_COUNTERS,
     TRACE_DATA_MIGRATION,
     MEMORY_USAGE,
     PAUSE_FOR,
+    BUFFER_RANK_OUTPUT,
+    DRY_RUN,
   };
 
   const option::Descriptor usage[] =
@@ -118,11 +123,17 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
     { NONBLOCKING_MPI, 0, "b", "use-nonblocking", Arg::None, "\t-b, --use-nonblocking, \t Use non-blocking MPI communication" },
     { PROBLEMNAME, 0, "n", "name", Arg::nonEmpty, "\t-n, --name, \t Name of the problem, used for output" },
     { SUPPRESS_PINNED, 0, "s", "suppress-pinned", Arg::None, "\t-s, --suppress-pinned, \t Suppress usage of pinned memory for MPI communication buffers" },
+    { UNIFIED_BUFFERS, 0, "", "unified-buffers", Arg::None, "\t--unified-buffers, \t Allocate MPI communication buffers in unified memory (for use with a device-aware MPI)" },
+    { MEMORY_POOLS, 0, "", "memory-pools", Arg::None, "\t--memory-pools, \t Allocate the device arrays and the MPI communication buffers from Umpire memory pools" },
     { OUTPUTDIR, 0, "o", "output", Arg::nonEmpty, "\t-o, --output, \t Directory to put the output files" },
     { TIMERS, 0, "t", "timers", Arg::nonEmpty, "\t-t, --timers, \t String specifying the type of timer output" },
+    { HARDWARE_COUNTERS, 0, "", "hardware-counters", Arg::nonEmpty, "\t--hardware-counters, \t Comma-separated list of PAPI counters (or the presets cache and vectorization) to read in the marked scopes" },
     { TRACE_DATA_MIGRATION, 0, "", "trace-data-migration", Arg::None, "\t--trace-data-migration, \t Trace host-device data migration" },
     { MEMORY_USAGE, 0, "m", "memory-usage", Arg::nonEmpty, "\t-m, --memory-usage, \t Minimum threshold for printing out memory allocations in a member of the data repository." },
     { PAUSE_FOR, 0, "", "pause-for", Arg::numeric, "\t--pause-for, \t Pause geosx for a given number of seconds before starting execution" },
+    { BUFFER_RANK_OUTPUT, 0, "", "buffer-rank-output", Arg::None, "\t--buffer-rank-output, \t Buffer the rank messages in memory and write them in rank order once per cycle" },
+    { DRY_RUN, 0, "", "dry-run", Arg::numeric, "\t--dry-run, \t Estimate the resources of the run: initialize the problem, report the memory per rank and memory space, "
+      "run the given number of cycles and extrapolate their cost to the whole run" },
     { 0, 0, nullptr, nullptr, nullptr, nullptr }
   };
 
@@ -199,6 +210,16 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         commandLineOptions->suppressPinned = true;
       }
       break;
+      case UNIFIED_BUFFERS:
+      {
+        commandLineOptions->useUnifiedBuffers = true;
+      }
+      break;
+      case MEMORY_POOLS:
+      {
+        commandLineOptions->useMemoryPools = true;
+      }
+      break;
       case SCHEMA:
       {
         commandLineOptions->schemaName = opt.arg;
@@ -219,6 +240,11 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         commandLineOptions->timerOutput = opt.arg;
       }
       break;
+      case HARDWARE_COUNTERS:
+      {
+        commandLineOptions->hardwareCounters = opt.arg;
+      }
+      break;
       case TRACE_DATA_MIGRATION:
       {
         commandLineOptions->traceDataMigration = true;
@@ -237,6 +263,17 @@ std::unique_ptr< CommandLineOptions > parseCommandLineOptions( int argc, char *
         std::this_thread::sleep_for( std::chrono::seconds( duration ) );
       }
       break;
+      case BUFFER_RANK_OUTPUT:
+      {
+        commandLineOptions->bufferRankOutput = true;
+      }
+      break;
+      case DRY_RUN:
+      {
+        commandLineOptions->dryRunCycles = std::stoi( opt.arg );
+        GEOS_THROW_IF_LT_MSG( commandLineOptions->dryRunCycles, 0, "The number of cycles of the dry run must be non-negative", InputError );
+      }
+      break;
     }
   }
 
@@ -274,7 +311,16 @@ std::unique_ptr< CommandLineOptions > basicSetup( int argc, char * argv[], bool
 
   if( parseCommandLine )
   {
-    return parseCommandLineOptions( argc, argv );
+    std::unique_ptr< CommandLineOptions > commandLineOptions = parseCommandLineOptions( argc, argv );
+    if( commandLineOptions->useMemoryPools )
+    {
+      setupMemoryPools();
+    }
+    if( commandLineOptions->bufferRankOutput )
+    {
+      logger::BufferRankOutput();
+    }
+    return commandLineOptions;
   }
   else
   {
@@ -243,7 +243,7 @@ void DomainPartition::setupCommunications( bool use_nonblocking )
           NodeManager & nodeManager = meshLevel.getNodeManager();
           FaceManager & faceManager = meshLevel.getFaceManager();
 
-          CommunicationTools::getInstance().setupGhosts( meshLevel, m_neighbors, use_nonblocking );
+          CommunicationTools::getInstance().setupGhosts( meshLevel, m_neighbors, use_nonblocking, meshBody.getGhostConnectivity() );
           faceManager.sortAllFaceNodes( nodeManager, meshLevel.getElemManager() );
           faceManager.computeGeometry( nodeManager );
         }
@@ -258,7 +258,7 @@ void DomainPartition::setupCommunications( bool use_nonblocking )
 
           CommunicationTools::getInstance().findMatchedPartitionBoundaryObjects( faceManager, m_neighbors );
           CommunicationTools::getInstance().findMatchedPartitionBoundaryObjects( nodeManager, m_neighbors );
-          CommunicationTools::getInstance().setupGhosts( meshLevel, m_neighbors, use_nonblocking );
+          CommunicationTools::getInstance().setupGhosts( meshLevel, m_neighbors, use_nonblocking, meshBody.getGhostConnectivity() );
         }
         else
         {
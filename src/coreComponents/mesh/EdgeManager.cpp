@@ -25,6 +25,7 @@
 #include "common/GEOS_RAJA_Interface.hpp"
 
 #include "mesh/generators/CellBlockUtilities.hpp"
+#include "mesh/utilities/MeshMapUtilities.hpp"
 
 namespace geos
 {
@@ -286,7 +287,11 @@ void EdgeManager::fixUpDownMaps( bool const clearIfUnmapped )
 
 void EdgeManager::compressRelationMaps()
 {
+  GEOS_MARK_FUNCTION;
+
   m_toFacesRelation.compress();
+
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toFacesRelation.base() );
 }
 
 void EdgeManager::depopulateUpMaps( std::set< localIndex > const & receivedEdges,
@@ -198,6 +198,7 @@ public:
   /**
    * @brief Compress all nodes-to-faces relation maps
    * so that the values of each array are contiguous with no extra capacity in between.
+   * @note The capacity released by the compression is freed by reallocating the value buffers with their exact size.
    */
   void compressRelationMaps();
 
@@ -44,6 +44,12 @@ ElementRegionManager::~ElementRegionManager()
   // TODO Auto-generated destructor stub
 }
 
+Timestamp ElementRegionManager::getMeshModificationTimestamp() const
+{
+  MeshLevel const * const meshLevel = dynamicCast< MeshLevel const * >( &getParent() );
+  return meshLevel != nullptr ? meshLevel->getModificationTimestamp() : 0;
+}
+
 void ElementRegionManager::resize( integer_array const & numElements,
                                    string_array const & regionNames,
                                    string_array const & GEOS_UNUSED_PARAM( elementTypes ) )
@@ -28,6 +28,10 @@
 #include "SurfaceElementRegion.hpp"
 #include "WellElementRegion.hpp"
 
+#include <map>
+#include <memory>
+#include <typeindex>
+
 namespace geos
 {
 
@@ -752,6 +756,71 @@ public:
     } );
   }
 
+  /**
+   * @brief Launch a single kernel over the elements of the specified target element subregions that can be casted to
+   * one of the specified subregion types.
+   * @tparam POLICY execution policy of the kernel
+   * @tparam LOOKUP_CONTAINER type of container of names or indices
+   * @tparam LAMBDA type of the user-provided function
+   * @param targetRegions target element region names or indices
+   * @param lambda kernel function, called with the region index, the subregion index and the element index
+   *
+   * @details The elements of the subregions are concatenated through an offset table, which replaces the launch
+   *   of one (small) kernel per subregion by a single launch on the meshes made of many subregions. The data of
+   *   the subregions is accessed in the kernel through ElementViewAccessor views.
+   */
+  template< typename POLICY, typename SUBREGIONTYPE, typename ... SUBREGIONTYPES, typename LOOKUP_CONTAINER, typename LAMBDA >
+  void forElementsInSubRegionsBatched( LOOKUP_CONTAINER const & targetRegions, LAMBDA && lambda ) const
+  {
+    array1d< localIndex > offsets( 1 );
+    array1d< localIndex > regionIndices;
+    array1d< localIndex > subRegionIndices;
+    forElementSubRegionsComplete< SUBREGIONTYPE, SUBREGIONTYPES... >( targetRegions,
+                                                                      [&]( localIndex const,
+                                                                           localIndex const er,
+                                                                           localIndex const esr,
+                                                                           ElementRegionBase const &,
+                                                                           auto const & subRegion )
+    {
+      if( subRegion.size() > 0 )
+      {
+        offsets.emplace_back( offsets.back() + subRegion.size() );
+        regionIndices.emplace_back( er );
+        subRegionIndices.emplace_back( esr );
+      }
+    } );
+
+    localIndex const numSubRegions = regionIndices.size();
+    localIndex const numElems = offsets.back();
+    if( numSubRegions == 0 )
+    {
+      return;
+    }
+
+    arrayView1d< localIndex const > const offsetsView = offsets.toViewConst();
+    arrayView1d< localIndex const > const regionIndicesView = regionIndices.toViewConst();
+    arrayView1d< localIndex const > const subRegionIndicesView = subRegionIndices.toViewConst();
+    forAll< POLICY >( numElems, [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      // binary search of the subregion containing the concatenated index i
+      localIndex first = 0;
+      localIndex last = numSubRegions;
+      while( last - first > 1 )
+      {
+        localIndex const middle = ( first + last ) / 2;
+        if( offsetsView[middle] <= i )
+        {
+          first = middle;
+        }
+        else
+        {
+          last = middle;
+        }
+      }
+      lambda( regionIndicesView[first], subRegionIndicesView[first], i - offsetsView[first] );
+    } );
+  }
+
 
   /**
    * @brief This is a const function to construct a ElementViewAccessor to access the data registered on the mesh.
@@ -873,6 +942,26 @@ public:
   ElementViewAccessor< traits::ViewTypeConst< typename FIELD_TRAIT::type > >
   constructMaterialFieldAccessor( bool const allowMissingViews = false ) const;
 
+  /**
+   * @brief Get a set of accessors built from this manager, reusing the set built by a previous call
+   *        for the same type and name as long as the mesh level has not been modified.
+   * @tparam ACCESSORS type of the set of accessors (e.g. StencilAccessors), constructible from
+   *         ( ElementRegionManager const &, string const & )
+   * @param name the name used to build the accessors (usually the name of the solver)
+   * @return a reference to the cached accessors
+   * @note The accessors hold views to the arrays of the sub-regions, so they are rebuilt when the modification
+   *       timestamp of the parent MeshLevel changes, i.e. after a topology change resized these arrays.
+   */
+  template< typename ACCESSORS >
+  ACCESSORS const & getCachedAccessors( string const & name ) const;
+
+  /**
+   * @brief Clear the accessors cached by getCachedAccessors, e.g. after arrays have been reallocated
+   *        without a modification of the mesh level.
+   */
+  void clearCachedAccessors() const
+  { m_cachedAccessors.clear(); }
+
 
   /**
    * @brief This is a const function to construct a MaterialViewAccessor to access the material data for specified
@@ -1175,6 +1264,27 @@ private:
                                  ElementViewAccessor< arrayView1d< localIndex > > const & packList,
                                  string const fractureRegionName ) const;
 
+  /**
+   * @brief Get the modification timestamp of the parent mesh level.
+   * @return the timestamp, or 0 if the parent is not a MeshLevel
+   */
+  Timestamp getMeshModificationTimestamp() const;
+
+  /**
+   * @struct CachedAccessors
+   * @brief A set of accessors cached by getCachedAccessors, along with the timestamp of the mesh it was built for.
+   */
+  struct CachedAccessors
+  {
+    /// The modification timestamp of the mesh level when the accessors were built
+    Timestamp meshTimestamp = 0;
+    /// The type-erased accessors
+    std::shared_ptr< void > accessors;
+  };
+
+  /// The accessors cached by getCachedAccessors, for each type and name
+  mutable std::map< std::pair< std::type_index, string >, CachedAccessors > m_cachedAccessors;
+
   /**
    * @brief Copy constructor.
    */
@@ -1190,6 +1300,20 @@ private:
 };
 
 
+template< typename ACCESSORS >
+ACCESSORS const &
+ElementRegionManager::getCachedAccessors( string const & name ) const
+{
+  Timestamp const meshTimestamp = getMeshModificationTimestamp();
+  CachedAccessors & cached = m_cachedAccessors[ { std::type_index( typeid( ACCESSORS ) ), name } ];
+  if( cached.accessors == nullptr || cached.meshTimestamp != meshTimestamp )
+  {
+    cached.accessors = std::make_shared< ACCESSORS >( *this, name );
+    cached.meshTimestamp = meshTimestamp;
+  }
+  return *std::static_pointer_cast< ACCESSORS const >( cached.accessors );
+}
+
 template< typename VIEWTYPE, typename LHS >
 ElementRegionManager::ElementViewAccessor< LHS >
 ElementRegionManager::constructViewAccessor( string const & viewName, string const & neighborName ) const
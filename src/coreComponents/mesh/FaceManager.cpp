@@ -222,10 +222,17 @@ void FaceManager::computeGeometry( NodeManager const & nodeManager )
   // loop over faces and calculate faceArea, faceNormal and faceCenter
   forAll< parallelHostPolicy >( this->size(), [&]( localIndex const faceIndex )
   {
-    m_faceArea[ faceIndex ] = computationalGeometry::centroid_3DPolygon( m_toNodesRelation[ faceIndex ],
-                                                                         X,
-                                                                         m_faceCenter[ faceIndex ],
-                                                                         m_faceNormal[ faceIndex ] );
+    if( !computationalGeometry::centroid_axisAlignedRectangle( m_toNodesRelation[ faceIndex ],
+                                                               X,
+                                                               m_faceCenter[ faceIndex ],
+                                                               m_faceNormal[ faceIndex ],
+                                                               m_faceArea[ faceIndex ] ) )
+    {
+      m_faceArea[ faceIndex ] = computationalGeometry::centroid_3DPolygon( m_toNodesRelation[ faceIndex ],
+                                                                           X,
+                                                                           m_faceCenter[ faceIndex ],
+                                                                           m_faceNormal[ faceIndex ] );
+    }
 
   } );
 }
@@ -234,14 +241,11 @@ void FaceManager::setIsExternal()
 {
   arrayView1d< integer const > const isDomainBoundary = this->getDomainBoundaryIndicator();
 
-  m_isExternal.zero();
-  for( localIndex k=0; k<size(); ++k )
+  arrayView1d< integer > const isExternal = m_isExternal.toView();
+  forAll< parallelHostPolicy >( size(), [=]( localIndex const k )
   {
-    if( isDomainBoundary[k]==1 )
-    {
-      m_isExternal[k] = 1;
-    }
-  }
+    isExternal[k] = isDomainBoundary[k] == 1 ? 1 : 0;
+  } );
 }
 
 void FaceManager::sortAllFaceNodes( NodeManager const & nodeManager,
@@ -519,8 +523,13 @@ void FaceManager::fixUpDownMaps( bool const clearIfUnmapped )
 
 void FaceManager::compressRelationMaps()
 {
+  GEOS_MARK_FUNCTION;
+
   m_toNodesRelation.compress();
   m_toEdgesRelation.compress();
+
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toNodesRelation.base() );
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toEdgesRelation.base() );
 }
 
 void FaceManager::enforceStateFieldConsistencyPostTopologyChange( std::set< localIndex > const & targetIndices )
@@ -227,7 +227,7 @@ public:
   /**
    * @brief Compress FaceManager face-to-node and face-to-edge containers so that the values of
    * each array are contiguous with no extra capacity in between.
-   * @note The method used here on each arrays (compress) does not free any memory.
+   * @note The capacity released by the compression is freed by reallocating the value buffers with their exact size.
    */
   void compressRelationMaps();
 
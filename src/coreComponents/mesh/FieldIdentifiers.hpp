@@ -22,6 +22,8 @@
 #include "common/DataTypes.hpp"
 #include "codingUtilities/StringUtilities.hpp"
 
+#include <set>
+
 namespace geos
 {
 /**
@@ -71,6 +73,73 @@ public:
     }
   }
 
+/**
+ * @brief adds fields to the fields map, to be transported in single precision.
+ *
+ * @param location location where the fields provided have been registered.
+ * @param fieldNames vector of names of the fields to be added to the map.
+ *
+ * The arrays of real64 are converted to real32 in the synchronization buffers only, which halves
+ * the volume of the exchange; this suits fields that do not need to be bitwise identical on the ghosts.
+ */
+  void addSinglePrecisionFields( FieldLocation const location, std::vector< string > const & fieldNames )
+  {
+    addFields( location, fieldNames );
+    setSinglePrecision( fieldNames );
+  }
+
+/**
+ * @brief adds element-based fields to the fields map, to be transported in single precision.
+ *
+ * @param fieldNames vector of names of the  element-based fields to be added to the map.
+ * @param regionNames vector of the regions on which these fields exist.
+ */
+  template< typename T = std::vector< string > >
+  void addSinglePrecisionElementFields( std::vector< string > const & fieldNames, T const & regionNames )
+  {
+    addElementFields( fieldNames, regionNames );
+    setSinglePrecision( fieldNames );
+  }
+
+/**
+ * @brief tag fields to be transported in single precision.
+ *
+ * @param fieldNames vector of names of the fields.
+ */
+  void setSinglePrecision( std::vector< string > const & fieldNames )
+  {
+    m_singlePrecisionFields.insert( fieldNames.begin(), fieldNames.end() );
+  }
+
+/**
+ * @brief Check whether a field is transported in single precision.
+ *
+ * @param fieldName name of the field.
+ * @return true if the field has been tagged for a single precision transport.
+ */
+  bool isSinglePrecision( string const & fieldName ) const
+  {
+    return m_singlePrecisionFields.count( fieldName ) > 0;
+  }
+
+/**
+ * @brief adds fields to the fields map using a key generated by another FieldIdentifiers object.
+ *
+ * @param key key of the fields, as stored in the map returned by getFields().
+ * @param fieldNames vector of names of the fields to be added to the map.
+ *
+ * The key is registered even if @p fieldNames is empty, so that the packing and unpacking
+ * of the synchronization still visit the corresponding mesh objects in the same order.
+ */
+  void addFieldsWithKey( string const & key, std::vector< string > const & fieldNames )
+  {
+    array1d< string > & fields = m_fields[key];
+    for( string const & field : fieldNames )
+    {
+      fields.emplace_back( field );
+    }
+  }
+
 /**
  * @brief Get the Fields object which is the map containing the fields existing for each location.
  *
@@ -127,6 +196,9 @@ private:
   ///
   std::map< string, array1d< string > > m_fields;
 
+  /// names of the fields transported in single precision
+  std::set< string > m_singlePrecisionFields;
+
   struct keysStruct
   {
     /// @return String key for
@@ -29,7 +29,8 @@ MeshBody::MeshBody( string const & name,
   Group( name, parent ),
   m_meshLevels( registerGroup( groupStructKeys::meshLevelsString() ) ),
   m_globalLengthScale( 0 ),
-  m_hasParticles( false )
+  m_hasParticles( false ),
+  m_ghostConnectivity( GhostConnectivity::Nodes )
 {}
 
 MeshLevel & MeshBody::createMeshLevel( localIndex const newLevel )
@@ -181,6 +181,24 @@ public:
    */
   void setHasParticles( bool hasParticles );
 
+  /**
+   * @brief Get the connectivity through which the ghost cells of the mesh body are reached
+   * @return the ghost connectivity
+   */
+  GhostConnectivity getGhostConnectivity() const
+  {
+    return m_ghostConnectivity;
+  }
+
+  /**
+   * @brief Set the connectivity through which the ghost cells of the mesh body are reached
+   * @param connectivity the ghost connectivity, union of the needs of the solvers targeting the mesh body
+   */
+  void setGhostConnectivity( GhostConnectivity const connectivity )
+  {
+    m_ghostConnectivity = connectivity;
+  }
+
   /**
    * @brief Get the Abstract representation of the CellBlockManager attached to the MeshBody.
    * @return The CellBlockManager.
@@ -228,6 +246,9 @@ private:
   /// flag for whether MeshBody has particles
   bool m_hasParticles;
 
+  /// Connectivity through which the ghost cells are reached from the partition boundary
+  GhostConnectivity m_ghostConnectivity;
+
   static string intToMeshLevelString( localIndex const meshLevel );
 
 };
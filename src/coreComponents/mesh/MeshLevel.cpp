@@ -288,7 +288,9 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
                                         localIndex_array & edgeAdjacencyList,
                                         localIndex_array & faceAdjacencyList,
                                         ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > & elementAdjacencyList,
-                                        integer const depth )
+                                        integer const depth,
+                                        GhostConnectivity const connectivity,
+                                        arrayView1d< localIndex const > const & seedFaceList )
 {
   NodeManager const & nodeManager = getNodeManager();
 
@@ -298,6 +300,9 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
 
   FaceManager const & faceManager = this->getFaceManager();
   ArrayOfArraysView< localIndex const > const & faceToEdges = faceManager.edgeList().toViewConst();
+  arrayView2d< localIndex const > const faceToElementRegion = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const faceToElementSubRegion = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const faceToElement = faceManager.elementList();
 
   ElementRegionManager const & elemManager = this->getElemManager();
 
@@ -401,12 +406,23 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
     nodeAdjacencySet.insert( newNodes.cbegin(), newNodes.cend() );
   };
 
+  // With the faces connectivity, the cells are only reached through the faces.
+  bool const cellsThroughFaces = connectivity == GhostConnectivity::Faces;
+  std::vector< std::vector< bool > > isCellSubRegion( elemManager.numRegions() );
+
   for( localIndex a = 0; a < elemManager.numRegions(); ++a )
   {
-    elementAdjacencySet[a].resize( elemManager.getRegion( a ).numSubRegions() );
+    ElementRegionBase const & elemRegion = elemManager.getRegion( a );
+    elementAdjacencySet[a].resize( elemRegion.numSubRegions() );
+    isCellSubRegion[a].resize( elemRegion.numSubRegions() );
+    for( localIndex b = 0; b < elemRegion.numSubRegions(); ++b )
+    {
+      isCellSubRegion[a][b] = dynamic_cast< CellElementSubRegion const * >( &elemRegion.getSubRegion( b ) ) != nullptr;
+    }
   }
 
   nodeAdjacencySet.insert( seedNodeList.begin(), seedNodeList.end() );
+  std::set< localIndex > faceSeedSet( seedFaceList.begin(), seedFaceList.end() );
 
   for( integer d = 0; d < depth; ++d )
   {
@@ -417,7 +433,26 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
         localIndex const er = nodeToElementRegionList[nodeIndex][b];
         localIndex const esr = nodeToElementSubRegionList[nodeIndex][b];
         localIndex const ei = nodeToElementList[nodeIndex][b];
-        elementAdjacencySet[er][esr].insert( ei );
+        if( !cellsThroughFaces || !isCellSubRegion[er][esr] )
+        {
+          elementAdjacencySet[er][esr].insert( ei );
+        }
+      }
+    }
+
+    if( cellsThroughFaces )
+    {
+      for( localIndex const faceIndex: faceSeedSet )
+      {
+        for( localIndex b = 0; b < faceToElementRegion.size( 1 ); ++b )
+        {
+          localIndex const er = faceToElementRegion( faceIndex, b );
+          localIndex const esr = faceToElementSubRegion( faceIndex, b );
+          if( er >= 0 && esr >= 0 && isCellSubRegion[er][esr] )
+          {
+            elementAdjacencySet[er][esr].insert( faceToElement( faceIndex, b ) );
+          }
+        }
       }
     }
 
@@ -442,6 +477,9 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
         addWellSupport( er, esr, subRegion );
       } );
     }
+
+    // the next layer of cells is reached through the faces of the current one
+    faceSeedSet = faceAdjacencySet;
   }
 
   // Convert the `std::set` containers to `LvArray` containers.
@@ -470,6 +508,57 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
   }
 }
 
+std::size_t MeshLevel::moveFields( FieldIdentifiers const & fields,
+                                  LvArray::MemorySpace const space,
+                                  bool const touch ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  std::size_t numBytes = 0;
+  auto moveWrappers = [&]( ObjectManagerBase const & manager, array1d< string > const & fieldNames )
+  {
+    for( string const & fieldName : fieldNames )
+    {
+      dataRepository::WrapperBase const & wrapper = manager.getWrapperBase( fieldName );
+      wrapper.move( space, touch );
+      numBytes += wrapper.bytesAllocated();
+    }
+  };
+
+  for( auto const & iter : fields.getFields() )
+  {
+    FieldLocation location{};
+    fields.getLocation( iter.first, location );
+    switch( location )
+    {
+      case FieldLocation::Node:
+      {
+        moveWrappers( getNodeManager(), iter.second );
+        break;
+      }
+      case FieldLocation::Edge:
+      {
+        moveWrappers( getEdgeManager(), iter.second );
+        break;
+      }
+      case FieldLocation::Face:
+      {
+        moveWrappers( getFaceManager(), iter.second );
+        break;
+      }
+      case FieldLocation::Elem:
+      {
+        getElemManager().getRegion( fields.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+        {
+          moveWrappers( subRegion, iter.second );
+        } );
+        break;
+      }
+    }
+  }
+  return numBytes;
+}
+
 void MeshLevel::generateSets()
 {
   GEOS_MARK_FUNCTION;
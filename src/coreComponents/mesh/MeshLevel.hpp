@@ -25,11 +25,30 @@
 #include "EdgeManager.hpp"
 #include "ElementRegionManager.hpp"
 #include "FaceManager.hpp"
+#include "FieldIdentifiers.hpp"
+#include "codingUtilities/EnumStrings.hpp"
 
 namespace geos
 {
 class ElementRegionManager;
 
+/**
+ * @enum GhostConnectivity
+ * @brief Connectivity through which the ghost cells are reached from the partition boundary.
+ * @details The values are ordered by increasing ghost layer, so that the layer needed by
+ *          several solvers is the maximum of their connectivities.
+ */
+enum class GhostConnectivity : integer
+{
+  Faces, ///< the cells sharing a face with the partition boundary (two-point flux stencils)
+  Nodes  ///< the cells sharing a node with the partition boundary (finite elements, general stencils)
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( GhostConnectivity,
+              "faces",
+              "nodes" );
+
 /**
  * @class MeshLevel
  * @brief Class facilitating the representation of a multi-level discretization of a MeshBody.
@@ -89,6 +108,11 @@ public:
    * @param[out] faceAdjacencyList the faces adjacent to the input nodes of seedNodeList
    * @param[out] elementAdjacencyList the elements adjacent to the input nodes of seedNodeList
    * @param[in] depth the depth of the search for adjacent quantities (first-order neighbors, neighbors of neighbors, etc)
+   * @param[in] connectivity the connectivity through which the cells are collected
+   * @param[in] seedFaceList the input faces, from which the cells are collected with the faces connectivity
+   * @details With the faces connectivity, the cells of the CellElementSubRegions are only collected through the
+   * faces of @p seedFaceList (and the faces of the collected cells for a larger depth), the other element types
+   * still being collected through the nodes.
    * @details All the additional information (nodes, edges, faces) connected to
    * the edges, faces, elements that touch the @p seedNodeList is also collected.
    * For instance, all the nodes, edges and faces that touch an element that relies on a node of the @p seedNodeList, will be considered.
@@ -100,7 +124,22 @@ public:
                                localIndex_array & edgeAdjacencyList,
                                localIndex_array & faceAdjacencyList,
                                ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > & elementAdjacencyList,
-                               integer const depth );
+                               integer const depth,
+                               GhostConnectivity const connectivity,
+                               arrayView1d< localIndex const > const & seedFaceList );
+
+  /**
+   * @brief Move the data of a set of fields to a memory space, before the group of kernels using them is launched.
+   * @param[in] fields the fields to move, identified by their location as for the synchronization of fields
+   * @param[in] space the memory space to move the data to
+   * @param[in] touch whether the data will be modified in the memory space
+   * @return the number of bytes allocated by the fields that have been moved
+   * @details The transfers are done once for all the fields, inside a timed scope, instead of being
+   * triggered one field at a time when the views are captured by the kernels.
+   */
+  std::size_t moveFields( FieldIdentifiers const & fields,
+                          LvArray::MemorySpace const space,
+                          bool const touch ) const;
 
 
   virtual void initializePostInitialConditionsPostSubGroups() override;
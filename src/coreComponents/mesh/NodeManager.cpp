@@ -206,11 +206,19 @@ void NodeManager::setupRelatedObjectsInRelations( EdgeManager const & edgeManage
 
 void NodeManager::compressRelationMaps()
 {
+  GEOS_MARK_FUNCTION;
+
   m_toEdgesRelation.compress();
   m_toFacesRelation.compress();
   m_toElements.m_toElementRegion.compress();
   m_toElements.m_toElementSubRegion.compress();
   m_toElements.m_toElementIndex.compress();
+
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toEdgesRelation.base() );
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toFacesRelation.base() );
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toElements.m_toElementRegion );
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toElements.m_toElementSubRegion );
+  meshMapUtilities::shrinkToFit< parallelHostPolicy >( m_toElements.m_toElementIndex );
 }
 
 
@@ -177,7 +177,7 @@ public:
 
   /**
    * @brief Compress all NodeManager member arrays so that the values of each array are contiguous with no extra capacity inbetween.
-   * @note The method used here on each arrays (compress) does not free any memory.
+   * @note The capacity released by the compression is freed by reallocating the value buffers with their exact size.
    */
   void compressRelationMaps();
 
@@ -17,6 +17,7 @@
 #include "mesh/generators/CellBlockUtilities.hpp"
 #include "mesh/generators/LineBlock.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
+#include "LvArray/src/tensorOps.hpp"
 
 #include <algorithm>
 
@@ -132,7 +133,7 @@ void CellBlockManager::buildToCellMap( localIndex const numObjects,
 {
   // Calculate the number of entries in each sub-array
   array1d< localIndex > counts( numObjects );
-  counts.setValues< serialPolicy >( overAlloc );
+  counts.setValues< parallelHostPolicy >( overAlloc );
 
   for( localIndex blockIndex = 0; blockIndex < numCellBlocks(); ++blockIndex )
   {
@@ -633,6 +634,8 @@ void CellBlockManager::buildFaceMaps()
 
 void CellBlockManager::buildNodeToEdges()
 {
+  GEOS_MARK_FUNCTION;
+
   m_nodeToEdges = meshMapUtilities::transposeIndexMap< parallelHostPolicy >( m_edgeToNodes.toViewConst(),
                                                                              m_numNodes,
                                                                              edgeMapExtraSpacePerNode() );
@@ -653,6 +656,77 @@ void CellBlockManager::buildMaps()
   fillElementToEdgesOfCellBlocks( m_faceToEdges.toViewConst(), this->getCellBlocks() );
 }
 
+void CellBlockManager::renumberNodesByElementTraversal()
+{
+  GEOS_MARK_FUNCTION;
+
+  // Nodes are numbered in the order in which the cells first visit them,
+  // so that the cells close in memory share nodes close in memory as well.
+  array1d< localIndex > oldToNew( m_numNodes );
+  oldToNew.setValues< serialPolicy >( -1 );
+  localIndex numVisitedNodes = 0;
+  this->getCellBlocks().forSubGroups< CellBlock >( [&]( CellBlock const & cellBlock )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = cellBlock.getElemToNode();
+    for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        localIndex const nodeIndex = elemToNodes( k, a );
+        if( oldToNew[nodeIndex] < 0 )
+        {
+          oldToNew[nodeIndex] = numVisitedNodes++;
+        }
+      }
+    }
+  } );
+  for( localIndex i = 0; i < m_numNodes; ++i )
+  {
+    if( oldToNew[i] < 0 )
+    {
+      oldToNew[i] = numVisitedNodes++;
+    }
+  }
+
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > const oldPositions = m_nodesPositions;
+  array1d< globalIndex > const oldLocalToGlobal = m_nodeLocalToGlobal;
+  forAll< parallelHostPolicy >( m_numNodes, [oldToNew = oldToNew.toViewConst(),
+                                              oldPositions = oldPositions.toViewConst(),
+                                              oldLocalToGlobal = oldLocalToGlobal.toViewConst(),
+                                              positions = m_nodesPositions.toView(),
+                                              localToGlobal = m_nodeLocalToGlobal.toView()]( localIndex const i )
+  {
+    LvArray::tensorOps::copy< 3 >( positions[oldToNew[i]], oldPositions[i] );
+    localToGlobal[oldToNew[i]] = oldLocalToGlobal[i];
+  } );
+
+  this->getCellBlocks().forSubGroups< CellBlock >( [&]( CellBlock & cellBlock )
+  {
+    arrayView2d< localIndex, cells::NODE_MAP_USD > const elemToNodes = cellBlock.getElemToNode();
+    forAll< parallelHostPolicy >( elemToNodes.size( 0 ), [=, oldToNew = oldToNew.toViewConst()]( localIndex const k )
+    {
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        elemToNodes( k, a ) = oldToNew[elemToNodes( k, a )];
+      }
+    } );
+  } );
+
+  for( auto & [name, nodeSet] : m_nodeSets )
+  {
+    GEOS_UNUSED_VAR( name );
+    array1d< localIndex > newIndices;
+    newIndices.reserve( nodeSet.size() );
+    for( localIndex const i : nodeSet )
+    {
+      newIndices.emplace_back( oldToNew[i] );
+    }
+    std::sort( newIndices.begin(), newIndices.end() );
+    nodeSet.clear();
+    nodeSet.insert( newIndices.begin(), newIndices.end() );
+  }
+}
+
 ArrayOfArrays< localIndex > CellBlockManager::getFaceToNodes() const
 {
   return m_faceToNodes;
@@ -737,9 +811,7 @@ ArrayOfArrays< localIndex > CellBlockManager::getFaceToEdges() const
 
 ArrayOfArrays< localIndex > CellBlockManager::getNodeToEdges() const
 {
-  return meshMapUtilities::transposeIndexMap< parallelHostPolicy >( m_edgeToNodes.toViewConst(),
-                                                                    m_numNodes,
-                                                                    edgeMapExtraSpacePerNode() );
+  return m_nodeToEdges;
 }
 
 localIndex CellBlockManager::numEdges() const
@@ -1136,6 +1208,9 @@ void CellBlockManager::generateHighOrderMaps( localIndex const order,
       }
     }
   } );
+
+  // Edges now hold their internal nodes as well
+  buildNodeToEdges();
 }
 
 }
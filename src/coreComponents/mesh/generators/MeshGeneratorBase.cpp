@@ -64,6 +64,12 @@ void MeshGeneratorBase::generateMesh( Group & parent, SpatialPartition & partiti
   {
     CellBlockManager & cellBlockManager = parent.registerGroup< CellBlockManager >( keys::cellManager );
 
+    // the well geometry only depends on the input, and is generated first so that the partitioners can use it
+    forSubGroups< WellGeneratorBase >( []( WellGeneratorBase & wellGen )
+    {
+      wellGen.generateWellGeometry();
+    } );
+
     fillCellBlockManager( cellBlockManager, partition );
 
     this->attachWellInfo( cellBlockManager );
@@ -73,7 +79,6 @@ void MeshGeneratorBase::generateMesh( Group & parent, SpatialPartition & partiti
 void MeshGeneratorBase::attachWellInfo( CellBlockManager & cellBlockManager )
 {
   forSubGroups< WellGeneratorBase >( [&]( WellGeneratorBase & wellGen ) {
-    wellGen.generateWellGeometry( );
     LineBlock & lb = cellBlockManager.registerLineBlock( wellGen.getWellRegionName() );
     lb.setNumElements( wellGen.numElements() );
     lb.setElemCoords( wellGen.getElemCoords() );
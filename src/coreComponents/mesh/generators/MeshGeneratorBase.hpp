@@ -143,6 +143,7 @@ private:
    * @brief Fill the cellBlockManager object .
    * @param[inout] cellBlockManager the CellBlockManager that will receive the meshing information
    * @param[in] partition The reference to spatial partition
+   * @note The geometry of the wells is generated before this call, so that it can guide the partitioning.
    */
   virtual void fillCellBlockManager( CellBlockManager & cellBlockManager, SpatialPartition & partition )
   {
@@ -0,0 +1,354 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshValidation.cpp
+ */
+
+#include "MeshValidation.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/TimingMacros.hpp"
+#include "mesh/generators/CellBlockManager.hpp"
+#include "mesh/utilities/ComputationalGeometry.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace geos
+{
+
+namespace meshValidation
+{
+
+namespace
+{
+
+/**
+ * @brief Compute the volume of an element from the transformed weights of its quadrature points.
+ * @tparam FE_TYPE the finite element type of the element
+ * @param[in] X the coordinates of the nodes of the element
+ * @param[out] volume the volume of the element
+ * @param[out] tangled true if the jacobian is non-positive at one of the quadrature points
+ */
+template< typename FE_TYPE >
+void quadratureVolume( real64 const (&X)[FE_TYPE::numNodes][3], real64 & volume, bool & tangled )
+{
+  volume = 0.0;
+  tangled = false;
+  for( localIndex q = 0; q < FE_TYPE::numQuadraturePoints; ++q )
+  {
+    real64 const weight = FE_TYPE::transformedQuadratureWeight( q, X );
+    volume += weight;
+    tangled = tangled || weight <= 0.0;
+  }
+}
+
+/**
+ * @brief Compute the volume of an element.
+ * @param[in] elementType the type of the element
+ * @param[in] elemToNodes the nodes of the element
+ * @param[in] X the coordinates of the nodes
+ * @param[out] volume the volume of the element
+ * @param[out] tangled true if the element is inverted or tangled (only assessed for the elements with a finite element formulation)
+ * @return false if the volume of this type of element cannot be computed
+ */
+bool elementVolume( ElementType const elementType,
+                    arraySlice1d< localIndex const, cells::NODE_MAP_USD - 1 > const & elemToNodes,
+                    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
+                    real64 & volume,
+                    bool & tangled )
+{
+  auto getCoordinates = [&]( auto & XLocal )
+  {
+    for( localIndex a = 0; a < elemToNodes.size(); ++a )
+    {
+      LvArray::tensorOps::copy< 3 >( XLocal[a], X[elemToNodes[a]] );
+    }
+  };
+
+  tangled = false;
+  switch( elementType )
+  {
+    case ElementType::Hexahedron:
+    {
+      real64 Xlocal[8][3];
+      getCoordinates( Xlocal );
+      quadratureVolume< finiteElement::H1_Hexahedron_Lagrange1_GaussLegendre2 >( Xlocal, volume, tangled );
+      return true;
+    }
+    case ElementType::Tetrahedron:
+    {
+      real64 Xlocal[4][3];
+      getCoordinates( Xlocal );
+      quadratureVolume< finiteElement::H1_Tetrahedron_Lagrange1_Gauss1 >( Xlocal, volume, tangled );
+      return true;
+    }
+    case ElementType::Wedge:
+    {
+      real64 Xlocal[6][3];
+      getCoordinates( Xlocal );
+      quadratureVolume< finiteElement::H1_Wedge_Lagrange1_Gauss6 >( Xlocal, volume, tangled );
+      return true;
+    }
+    case ElementType::Pyramid:
+    {
+      real64 Xlocal[5][3];
+      getCoordinates( Xlocal );
+      quadratureVolume< finiteElement::H1_Pyramid_Lagrange1_Gauss5 >( Xlocal, volume, tangled );
+      return true;
+    }
+    case ElementType::Prism5:
+    {
+      real64 Xlocal[10][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 5 >( Xlocal );
+      return true;
+    }
+    case ElementType::Prism6:
+    {
+      real64 Xlocal[12][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 6 >( Xlocal );
+      return true;
+    }
+    case ElementType::Prism7:
+    {
+      real64 Xlocal[14][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 7 >( Xlocal );
+      return true;
+    }
+    case ElementType::Prism8:
+    {
+      real64 Xlocal[16][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 8 >( Xlocal );
+      return true;
+    }
+    case ElementType::Prism9:
+    {
+      real64 Xlocal[18][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 9 >( Xlocal );
+      return true;
+    }
+    case ElementType::Prism10:
+    {
+      real64 Xlocal[20][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 10 >( Xlocal );
+      return true;
+    }
+    case ElementType::Prism11:
+    {
+      real64 Xlocal[22][3];
+      getCoordinates( Xlocal );
+      volume = computationalGeometry::prismVolume< 11 >( Xlocal );
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/// Elements of a cell block, as used by the point location
+struct BlockGeometry
+{
+  /// Spatial index of the elements
+  ElementSpatialIndex::KernelWrapper index;
+  /// Faces of the elements
+  arrayView2d< localIndex const > elemToFaces;
+  /// Centers of the elements
+  arrayView2d< real64 const > centers;
+};
+
+} // namespace
+
+Report validate( CellBlockManager const & cellBlockManager,
+                 real64 const relativeTolerance,
+                 bool const checkCollocatedNodes,
+                 MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > const nodePositions = cellBlockManager.getNodePositions();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodePositions.toViewConst();
+  ArrayOfArrays< localIndex > const faceToNodes = cellBlockManager.getFaceToNodes();
+  ArrayOfArraysView< localIndex const > const faceToNodesView = faceToNodes.toViewConst();
+  ToCellRelation< array2d< localIndex > > const faceToElements = cellBlockManager.getFaceToElements();
+  arrayView2d< localIndex const > const faceToBlocks = faceToElements.toBlockIndex.toViewConst();
+  arrayView2d< localIndex const > const faceToCells = faceToElements.toCellIndex.toViewConst();
+  real64 const tolerance = relativeTolerance * cellBlockManager.getGlobalLength();
+  localIndex const numBlocks = cellBlockManager.getCellBlocks().numSubGroups();
+
+  RAJA::ReduceSum< parallelHostReduce, localIndex > numNonPositiveVolumes( 0 );
+  RAJA::ReduceSum< parallelHostReduce, localIndex > numTangledElements( 0 );
+  RAJA::ReduceMin< parallelHostReduce, real64 > minVolume( LvArray::NumericLimits< real64 >::max );
+
+  // Step 1: volumes and centers of the elements, and spatial index of each block
+  std::vector< array2d< real64 > > centers( numBlocks );
+  std::vector< ElementSpatialIndex > indices( numBlocks );
+  std::vector< BlockGeometry > blocks( numBlocks );
+  for( localIndex b = 0; b < numBlocks; ++b )
+  {
+    CellBlock const & cellBlock = cellBlockManager.getCellBlock( b );
+    ElementType const elementType = cellBlock.getElementType();
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = cellBlock.getElemToNode();
+    localIndex const numNodesPerElem = elemToNodes.size( 1 );
+
+    centers[b].resize( cellBlock.size(), 3 );
+    arrayView2d< real64 > const blockCenters = centers[b].toView();
+    forAll< parallelHostPolicy >( cellBlock.size(), [=]( localIndex const k )
+    {
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        LvArray::tensorOps::add< 3 >( blockCenters[k], X[elemToNodes( k, a )] );
+      }
+      LvArray::tensorOps::scale< 3 >( blockCenters[k], 1.0 / numNodesPerElem );
+
+      real64 volume = 0.0;
+      bool tangled = false;
+      if( elementVolume( elementType, elemToNodes[k], X, volume, tangled ) )
+      {
+        minVolume.min( volume );
+        numNonPositiveVolumes += volume <= 0.0 ? 1 : 0;
+        numTangledElements += ( volume > 0.0 && tangled ) ? 1 : 0;
+      }
+    } );
+
+    indices[b].build< parallelHostPolicy >( elemToNodes, X );
+    blocks[b] = { indices[b].createKernelWrapper(), cellBlock.getElemToFacesConstView(), centers[b].toViewConst() };
+  }
+
+  BlockGeometry const * const blockGeometries = blocks.data();
+
+  // returns true if the point lies inside an element, other than the given one
+  auto isInsideOtherElement = [=]( real64 const (&point)[3], localIndex const block, localIndex const elem )
+  {
+    for( localIndex b = 0; b < numBlocks; ++b )
+    {
+      BlockGeometry const & geometry = blockGeometries[b];
+      bool const found = geometry.index.forCandidates( point, [&]( localIndex const k )
+      {
+        if( b == block && k == elem )
+        {
+          return false;
+        }
+        real64 const center[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( geometry.centers[k] );
+        return computationalGeometry::isPointInsidePolyhedron( X, geometry.elemToFaces[k], faceToNodesView, center, point );
+      } );
+      if( found )
+      {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Step 2: elements whose center lies inside another element
+  RAJA::ReduceSum< parallelHostReduce, localIndex > numOverlappingElements( 0 );
+  for( localIndex b = 0; b < numBlocks; ++b )
+  {
+    arrayView2d< real64 const > const blockCenters = centers[b].toViewConst();
+    forAll< parallelHostPolicy >( blockCenters.size( 0 ), [=]( localIndex const k )
+    {
+      real64 const center[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( blockCenters[k] );
+      numOverlappingElements += isInsideOtherElement( center, b, k ) ? 1 : 0;
+    } );
+  }
+
+  // Step 3: boundary faces of an element lying against another element: slightly moved outwards,
+  // the center of a conformal boundary face lies outside of all the elements
+  RAJA::ReduceSum< parallelHostReduce, localIndex > numNonConformalFaces( 0 );
+  forAll< parallelHostPolicy >( faceToNodesView.size(), [=]( localIndex const f )
+  {
+    localIndex const block = faceToBlocks( f, 0 );
+    localIndex const elem = faceToCells( f, 0 );
+    if( faceToCells( f, 1 ) >= 0 || block < 0 || elem < 0 )
+    {
+      return;
+    }
+    real64 faceCenter[3], normal[3];
+    real64 const area = computationalGeometry::centroid_3DPolygon( faceToNodesView[f], X, faceCenter, normal );
+    if( area <= 0.0 )
+    {
+      return;
+    }
+    real64 outwards[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( faceCenter );
+    LvArray::tensorOps::subtract< 3 >( outwards, blockGeometries[block].centers[elem] );
+    if( LvArray::tensorOps::AiBi< 3 >( outwards, normal ) < 0.0 )
+    {
+      LvArray::tensorOps::scale< 3 >( normal, -1.0 );
+    }
+    LvArray::tensorOps::scaledAdd< 3 >( faceCenter, normal, 1.0e-2 * LvArray::math::sqrt( area ) );
+    numNonConformalFaces += isInsideOtherElement( faceCenter, block, elem ) ? 1 : 0;
+  } );
+
+  // Step 4: pairs of distinct nodes closer than the tolerance, found among the nodes sorted along the first axis
+  RAJA::ReduceSum< parallelHostReduce, localIndex > numCollocatedNodePairs( 0 );
+  if( checkCollocatedNodes )
+  {
+    localIndex const numNodes = X.size( 0 );
+    std::vector< localIndex > sortedNodes( numNodes );
+    std::iota( sortedNodes.begin(), sortedNodes.end(), 0 );
+    std::sort( sortedNodes.begin(), sortedNodes.end(), [&]( localIndex const a, localIndex const b )
+    {
+      return X( a, 0 ) < X( b, 0 );
+    } );
+    localIndex const * const sorted = sortedNodes.data();
+    forAll< parallelHostPolicy >( numNodes, [=]( localIndex const i )
+    {
+      localIndex const a = sorted[i];
+      for( localIndex j = i + 1; j < numNodes && X( sorted[j], 0 ) - X( a, 0 ) <= tolerance; ++j )
+      {
+        real64 distance[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[sorted[j]] );
+        LvArray::tensorOps::subtract< 3 >( distance, X[a] );
+        numCollocatedNodePairs += LvArray::tensorOps::l2Norm< 3 >( distance ) <= tolerance ? 1 : 0;
+      }
+    } );
+  }
+
+  Report report;
+  report.numNonPositiveVolumes = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numNonPositiveVolumes.get() ), comm );
+  report.numTangledElements = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numTangledElements.get() ), comm );
+  report.numCollocatedNodePairs = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numCollocatedNodePairs.get() ), comm );
+  report.numNonConformalFaces = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numNonConformalFaces.get() ), comm );
+  report.numOverlappingElements = MpiWrapper::sum( LvArray::integerConversion< globalIndex >( numOverlappingElements.get() ), comm );
+  report.minVolume = MpiWrapper::min( minVolume.get(), comm );
+  return report;
+}
+
+void printReport( Report const & report, string const & meshName )
+{
+  if( report.numIssues() == 0 )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "Mesh validation of '{}': no issue found, smallest element volume {:.3e}", meshName, report.minVolume ) );
+    return;
+  }
+  GEOS_LOG_RANK_0( GEOS_FMT( "Mesh validation of '{}': {} issues found, smallest element volume {:.3e}", meshName, report.numIssues(), report.minVolume ) );
+  GEOS_LOG_RANK_0( GEOS_FMT( "  elements with a non-positive volume: {}", report.numNonPositiveVolumes ) );
+  GEOS_LOG_RANK_0( GEOS_FMT( "  inverted or tangled elements (non-positive jacobian at a quadrature point): {}", report.numTangledElements ) );
+  GEOS_LOG_RANK_0( GEOS_FMT( "  overlapping elements: {}", report.numOverlappingElements ) );
+  GEOS_LOG_RANK_0( GEOS_FMT( "  non-conformal faces: {}", report.numNonConformalFaces ) );
+  GEOS_LOG_RANK_0( GEOS_FMT( "  pairs of collocated nodes: {}", report.numCollocatedNodePairs ) );
+}
+
+} // namespace meshValidation
+
+} // namespace geos
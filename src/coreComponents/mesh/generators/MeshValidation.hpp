@@ -0,0 +1,88 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshValidation.hpp
+ */
+
+#ifndef GEOS_MESH_GENERATORS_MESHVALIDATION_HPP_
+#define GEOS_MESH_GENERATORS_MESHVALIDATION_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+
+namespace geos
+{
+
+class CellBlockManager;
+
+/// Namespace containing the quality checks of the generated meshes.
+namespace meshValidation
+{
+
+/**
+ * @brief Number of issues found by each check, summed over all the ranks.
+ */
+struct Report
+{
+  /// Number of elements with a non-positive volume
+  globalIndex numNonPositiveVolumes = 0;
+  /// Number of elements with a non-positive jacobian at one of their quadrature points (inverted or tangled elements)
+  globalIndex numTangledElements = 0;
+  /// Number of pairs of distinct nodes closer than the tolerance
+  globalIndex numCollocatedNodePairs = 0;
+  /// Number of boundary faces lying against the interior of another element (hanging nodes, non-matching interfaces)
+  globalIndex numNonConformalFaces = 0;
+  /// Number of elements whose center lies inside another element (overlapping elements)
+  globalIndex numOverlappingElements = 0;
+  /// Smallest element volume
+  real64 minVolume = 0.0;
+
+  /**
+   * @return the total number of issues
+   */
+  globalIndex numIssues() const
+  {
+    return numNonPositiveVolumes + numTangledElements + numCollocatedNodePairs + numNonConformalFaces + numOverlappingElements;
+  }
+};
+
+/**
+ * @brief Check the quality of the cell blocks of the ranks, once their maps are built.
+ * @param[in] cellBlockManager the cell block manager, after buildMaps
+ * @param[in] relativeTolerance distance under which two nodes are collocated, relative to the global length of the mesh
+ * @param[in] checkCollocatedNodes whether the collocated nodes are searched (false when the nodes are split on purpose, e.g. along fractures)
+ * @param[in] comm the MPI communicator
+ * @return the report of the checks, summed over all the ranks
+ *
+ * @note The checks are local to each rank: collocated nodes, non-conformal faces and overlaps
+ *       between elements of different ranks are not detected.
+ */
+Report validate( CellBlockManager const & cellBlockManager,
+                 real64 const relativeTolerance,
+                 bool const checkCollocatedNodes,
+                 MPI_Comm const comm );
+
+/**
+ * @brief Print a report on rank 0.
+ * @param[in] report the report of the checks
+ * @param[in] meshName the name of the mesh, used in the messages
+ */
+void printReport( Report const & report, string const & meshName );
+
+} // namespace meshValidation
+
+} // namespace geos
+
+#endif // GEOS_MESH_GENERATORS_MESHVALIDATION_HPP_
@@ -38,9 +38,12 @@ namespace ptscotch
 
 array1d< int64_t >
 partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+           arrayView2d< int64_t const > const & vertWeights,
+           arrayView1d< int64_t const > const & edgeWeights,
            int64_t const numParts,
            MPI_Comm comm )
 {
+  GEOS_ERROR_IF_GT_MSG( vertWeights.size( 1 ), 1, "Multi-constraint partitioning is not supported by Scotch" );
   SCOTCH_Num const numVerts = graph.size();
 
   array1d< int64_t > part( numVerts ); // all 0 by default
@@ -57,6 +60,9 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
   // Technical UB if Scotch writes into these arrays; in practice we discard them right after
   SCOTCH_Num * const offsets = const_cast< SCOTCH_Num * >( graph.getOffsets() );
   SCOTCH_Num * const edges = const_cast< SCOTCH_Num * >( graph.getValues() );
+  SCOTCH_Num * const weights = vertWeights.size( 1 ) > 0 ? const_cast< SCOTCH_Num * >( vertWeights.data() ) : nullptr;
+  GEOS_ERROR_IF( !edgeWeights.empty() && edgeWeights.size() != numEdges, "Edge weights do not match the graph size" );
+  SCOTCH_Num * const edgeLoads = edgeWeights.empty() ? nullptr : const_cast< SCOTCH_Num * >( edgeWeights.data() );
 
   GEOS_SCOTCH_CHECK( SCOTCH_dgraphBuild( gr,          // graphptr
                                          0,            // baseval
@@ -64,13 +70,13 @@ partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
                                          numVerts,     // vertlocmax
                                          offsets,      // vertloctab
                                          offsets + 1,  // vendloctab
-                                         nullptr,      // veloloctab
+                                         weights,      // veloloctab
                                          nullptr,      // vlblloctab
                                          numEdges,     // edgelocnbr
                                          numEdges,     // edgelocsiz
                                          edges,        // edgeloctab
                                          nullptr,      // edgegsttab
-                                         nullptr       // edloloctab,
+                                         edgeLoads     // edloloctab
                                          ) );
 
   // TODO: maybe remove?
@@ -30,12 +30,19 @@ namespace ptscotch
 /**
  * @brief Partition a mesh according to its dual graph.
  * @param graph the input graph (edges of locally owned nodes)
+ * @param vertWeights the weights of locally owned vertices, in a single column;
+ *                    if it has no column, all vertices have a unit weight
+ * @param edgeWeights the weights of the edges, in the order of the values of @p graph;
+ *                    if it is empty, all edges have a unit weight
  * @param numParts target number of partitions
  * @param comm the MPI communicator of processes to partition over
  * @return an array of target partitions for each element in local mesh
+ * @note Scotch only balances a single constraint.
  */
 array1d< int64_t >
 partition( ArrayOfArraysView< int64_t const, int64_t > const & graph,
+           arrayView2d< int64_t const > const & vertWeights,
+           arrayView1d< int64_t const > const & edgeWeights,
            int64_t const numParts,
            MPI_Comm comm );
 
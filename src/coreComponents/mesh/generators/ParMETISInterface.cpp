@@ -80,6 +80,8 @@ meshToDual( ArrayOfArraysView< idx_t const, idx_t > const & elemToNodes,
 
 array1d< idx_t >
 partition( ArrayOfArraysView< idx_t const, idx_t > const & graph,
+           arrayView2d< idx_t const > const & vertWeights,
+           arrayView1d< idx_t const > const & edgeWeights,
            arrayView1d< idx_t const > const & vertDist,
            idx_t const numParts,
            MPI_Comm comm,
@@ -91,35 +93,46 @@ partition( ArrayOfArraysView< idx_t const, idx_t > const & graph,
     return part;
   }
 
-  // Compute tpwgts parameters (target partition weights)
-  array1d< real_t > tpwgts( numParts );
-  tpwgts.setValues< serialPolicy >( 1.0f / static_cast< real_t >( numParts ) );
+  // Vertex weights are stored vertex by vertex, as interleaved constraints
+  bool const hasWeights = vertWeights.size( 1 ) > 0;
+  GEOS_ERROR_IF( hasWeights && vertWeights.size( 0 ) != graph.size(), "Vertex weights do not match the graph size" );
+  idx_t * const vwgt = hasWeights ? const_cast< idx_t * >( vertWeights.data() ) : nullptr;
+
+  // Edge weights are stored in the order of the graph values
+  bool const hasEdgeWeights = !edgeWeights.empty();
+  GEOS_ERROR_IF( hasEdgeWeights && edgeWeights.size() != graph.getOffsets()[graph.size()], "Edge weights do not match the graph size" );
+  idx_t * const adjwgt = hasEdgeWeights ? const_cast< idx_t * >( edgeWeights.data() ) : nullptr;
 
   // Set other ParMETIS parameters
-  idx_t wgtflag = 0;
+  idx_t wgtflag = ( hasWeights ? 2 : 0 ) + ( hasEdgeWeights ? 1 : 0 );
   idx_t numflag = 0;
-  idx_t ncon = 1;
+  idx_t ncon = hasWeights ? LvArray::integerConversion< idx_t >( vertWeights.size( 1 ) ) : 1;
   idx_t npart = numParts;
   idx_t options[4] = { 1, 0, 2022, PARMETIS_PSR_UNCOUPLED };
   idx_t edgecut = 0;
-  real_t ubvec = 1.05;
+
+  // Compute tpwgts parameters (target partition weights) and imbalance tolerances for each constraint
+  array1d< real_t > tpwgts( numParts * ncon );
+  tpwgts.setValues< serialPolicy >( 1.0f / static_cast< real_t >( numParts ) );
+  array1d< real_t > ubvec( ncon );
+  ubvec.setValues< serialPolicy >( 1.05 );
 
   // Technical UB if ParMETIS writes into these arrays; in practice we discard them right after
   GEOS_PARMETIS_CHECK( ParMETIS_V3_PartKway( const_cast< idx_t * >( vertDist.data() ),
                                              const_cast< idx_t * >( graph.getOffsets() ),
                                              const_cast< idx_t * >( graph.getValues() ),
-                                             nullptr, nullptr, &wgtflag,
+                                             vwgt, adjwgt, &wgtflag,
                                              &numflag, &ncon, &npart, tpwgts.data(),
-                                             &ubvec, options, &edgecut, part.data(), &comm ) );
+                                             ubvec.data(), options, &edgecut, part.data(), &comm ) );
 
   for( int iter = 0; iter < numRefinements; ++iter )
   {
     GEOS_PARMETIS_CHECK( ParMETIS_V3_RefineKway( const_cast< idx_t * >( vertDist.data() ),
                                                  const_cast< idx_t * >( graph.getOffsets() ),
                                                  const_cast< idx_t * >( graph.getValues() ),
-                                                 nullptr, nullptr, &wgtflag,
+                                                 vwgt, adjwgt, &wgtflag,
                                                  &numflag, &ncon, &npart, tpwgts.data(),
-                                                 &ubvec, options, &edgecut, part.data(), &comm ) );
+                                                 ubvec.data(), options, &edgecut, part.data(), &comm ) );
   }
 
   return part;
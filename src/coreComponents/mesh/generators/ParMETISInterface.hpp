@@ -56,6 +56,10 @@ meshToDual( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & elemToNode
 /**
  * @brief Partition a mesh according to its dual graph.
  * @param graph the input graph (edges of locally owned nodes)
+ * @param vertWeights the weights of locally owned vertices, one column per balance constraint;
+ *                    if it has no column, all vertices have a unit weight
+ * @param edgeWeights the weights of the edges, in the order of the values of @p graph;
+ *                    if it is empty, all edges have a unit weight
  * @param vertDist the parallel distribution of vertices: vertex index offset on each rank
  * @param numParts target number of partitions
  * @param comm the MPI communicator of processes to partition over
@@ -64,6 +68,8 @@ meshToDual( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & elemToNode
  */
 array1d< pmet_idx_t >
 partition( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & graph,
+           arrayView2d< pmet_idx_t const > const & vertWeights,
+           arrayView1d< pmet_idx_t const > const & edgeWeights,
            arrayView1d< pmet_idx_t const > const & vertDist,
            pmet_idx_t const numParts,
            MPI_Comm comm,
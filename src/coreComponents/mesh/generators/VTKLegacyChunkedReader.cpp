@@ -0,0 +1,684 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VTKLegacyChunkedReader.cpp
+ */
+
+#include "VTKLegacyChunkedReader.hpp"
+
+#include "codingUtilities/StringUtilities.hpp"
+#include "common/TimingMacros.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+namespace geos
+{
+
+namespace vtk
+{
+
+namespace
+{
+
+/**
+ * @brief Description of a binary array stored in a legacy file
+ */
+struct LegacyArray
+{
+  /// Name of the array
+  string name;
+  /// VTK type of the values
+  int vtkType = VTK_VOID;
+  /// Kind of the values: 'i' for signed integers, 'u' for unsigned integers, 'f' for floating point
+  char kind = 'f';
+  /// Size in bytes of a value
+  int valueSize = 0;
+  /// Number of components
+  integer numComponents = 1;
+  /// Number of tuples
+  vtkIdType numTuples = 0;
+  /// Position of the first value in the file
+  std::streamoff offset = 0;
+  /// Whether the array holds the global ids of the points or cells
+  bool isGlobalIds = false;
+};
+
+/**
+ * @brief Position of the sections of a legacy unstructured grid file
+ */
+struct LegacyLayout
+{
+  /// Whether the file can be read by chunks
+  bool supported = false;
+  /// Point coordinates
+  LegacyArray points;
+  /// Position of the first point of each cell in the connectivity, plus the total size
+  LegacyArray offsets;
+  /// Points of the cells
+  LegacyArray connectivity;
+  /// VTK types of the cells
+  LegacyArray cellTypes;
+  /// Cell data arrays
+  std::vector< LegacyArray > cellArrays;
+  /// Point data arrays
+  std::vector< LegacyArray > pointArrays;
+};
+
+/**
+ * @brief Set the type of an array from its name in a legacy file.
+ * @param[in] typeName the name of the type
+ * @param[out] array the array
+ * @return false if the type is not supported
+ */
+bool setLegacyType( string const & typeName, LegacyArray & array )
+{
+  struct TypeInfo
+  {
+    int vtkType;
+    char kind;
+    int valueSize;
+  };
+
+  // Legacy files store "long" values on 8 bytes, as written on LP64 platforms
+  static std::map< string, TypeInfo > const types =
+  {
+    { "char", { VTK_CHAR, 'i', 1 } },
+    { "unsigned_char", { VTK_UNSIGNED_CHAR, 'u', 1 } },
+    { "short", { VTK_SHORT, 'i', 2 } },
+    { "unsigned_short", { VTK_UNSIGNED_SHORT, 'u', 2 } },
+    { "int", { VTK_INT, 'i', 4 } },
+    { "unsigned_int", { VTK_UNSIGNED_INT, 'u', 4 } },
+    { "long", { VTK_LONG, 'i', 8 } },
+    { "unsigned_long", { VTK_UNSIGNED_LONG, 'u', 8 } },
+    { "vtktypeint64", { VTK_TYPE_INT64, 'i', 8 } },
+    { "vtktypeuint64", { VTK_TYPE_UINT64, 'u', 8 } },
+    { "vtkIdType", { VTK_ID_TYPE, 'i', 8 } },
+    { "float", { VTK_FLOAT, 'f', 4 } },
+    { "double", { VTK_DOUBLE, 'f', 8 } },
+  };
+
+  auto const it = types.find( typeName );
+  if( it == types.end() )
+  {
+    return false;
+  }
+  array.vtkType = it->second.vtkType;
+  array.kind = it->second.kind;
+  array.valueSize = it->second.valueSize;
+  return true;
+}
+
+/**
+ * @brief Record the position of the binary data following the current header line, and skip it.
+ * @param[inout] file the file stream, positioned right after the header line
+ * @param[inout] array the array
+ */
+void skipArrayData( std::ifstream & file, LegacyArray & array )
+{
+  array.offset = file.tellg();
+  file.seekg( array.offset + std::streamoff( array.numTuples ) * array.numComponents * array.valueSize );
+}
+
+/**
+ * @brief Skip a METADATA block, which ends with an empty line.
+ * @param[inout] file the file stream, positioned right after the METADATA keyword
+ */
+void skipMetadata( std::ifstream & file )
+{
+  string line;
+  std::getline( file, line );
+  while( std::getline( file, line ) && !stringutilities::trim( line, " \r\t" ).empty() )
+  {}
+}
+
+/**
+ * @brief Parse the header of a named array of the CELLS section (OFFSETS or CONNECTIVITY).
+ * @param[inout] file the file stream
+ * @param[in] expectedName the expected name of the array
+ * @param[in] numValues the number of values of the array
+ * @param[out] array the array
+ * @return false if the header is not the expected one
+ */
+bool parseCellsArray( std::ifstream & file,
+                      string const & expectedName,
+                      vtkIdType const numValues,
+                      LegacyArray & array )
+{
+  string name, typeName, line;
+  file >> name >> typeName;
+  std::getline( file, line );
+  if( name != expectedName || !setLegacyType( typeName, array ) )
+  {
+    return false;
+  }
+  array.name = name;
+  array.numTuples = numValues;
+  skipArrayData( file, array );
+  return true;
+}
+
+/**
+ * @brief Parse the headers of a legacy file and find the position of all the binary arrays.
+ * @param[in] filePath the path of the file
+ * @return the layout of the file, flagged as not supported if any unexpected section is found
+ */
+LegacyLayout parseLayout( Path const & filePath )
+{
+  LegacyLayout layout;
+  std::ifstream file( filePath, std::ios::binary );
+  if( !file )
+  {
+    return layout;
+  }
+
+  // Version, title and format lines
+  string line;
+  std::getline( file, line );
+  std::size_t const versionPos = line.find( "Version" );
+  if( versionPos == string::npos || std::atof( line.c_str() + versionPos + 7 ) < 5.0 )
+  {
+    return layout;
+  }
+  std::getline( file, line );
+  std::getline( file, line );
+  if( stringutilities::trim( line, " \r\t" ) != "BINARY" )
+  {
+    return layout;
+  }
+
+  string keyword, datasetType;
+  file >> keyword >> datasetType;
+  std::getline( file, line );
+  if( keyword != "DATASET" || datasetType != "UNSTRUCTURED_GRID" )
+  {
+    return layout;
+  }
+
+  std::vector< LegacyArray > * attributeArrays = nullptr;
+  vtkIdType attributeSize = 0;
+
+  while( file >> keyword )
+  {
+    if( keyword == "METADATA" )
+    {
+      skipMetadata( file );
+      continue;
+    }
+
+    std::getline( file, line );
+    std::istringstream header( line );
+
+    if( keyword == "POINTS" )
+    {
+      string typeName;
+      header >> layout.points.numTuples >> typeName;
+      layout.points.name = "Points";
+      layout.points.numComponents = 3;
+      if( !setLegacyType( typeName, layout.points ) )
+      {
+        return layout;
+      }
+      skipArrayData( file, layout.points );
+    }
+    else if( keyword == "CELLS" )
+    {
+      vtkIdType numOffsets = 0, numConnectivity = 0;
+      header >> numOffsets >> numConnectivity;
+      if( !parseCellsArray( file, "OFFSETS", numOffsets, layout.offsets ) ||
+          !parseCellsArray( file, "CONNECTIVITY", numConnectivity, layout.connectivity ) )
+      {
+        return layout;
+      }
+    }
+    else if( keyword == "CELL_TYPES" )
+    {
+      header >> layout.cellTypes.numTuples;
+      setLegacyType( "int", layout.cellTypes );
+      skipArrayData( file, layout.cellTypes );
+    }
+    else if( keyword == "CELL_DATA" || keyword == "POINT_DATA" )
+    {
+      header >> attributeSize;
+      attributeArrays = keyword == "CELL_DATA" ? &layout.cellArrays : &layout.pointArrays;
+    }
+    else if( keyword == "FIELD" )
+    {
+      string fieldName;
+      integer numArrays = 0;
+      header >> fieldName >> numArrays;
+      for( integer a = 0; a < numArrays; ++a )
+      {
+        LegacyArray array;
+        string typeName;
+        file >> array.name;
+        if( array.name == "METADATA" )
+        {
+          skipMetadata( file );
+          file >> array.name;
+        }
+        file >> array.numComponents >> array.numTuples >> typeName;
+        std::getline( file, line );
+        if( !setLegacyType( typeName, array ) )
+        {
+          return layout;
+        }
+        skipArrayData( file, array );
+        // Field data attached to the dataset itself is not needed
+        if( attributeArrays != nullptr )
+        {
+          attributeArrays->push_back( array );
+        }
+      }
+    }
+    else if( keyword == "SCALARS" || keyword == "VECTORS" || keyword == "NORMALS" ||
+             keyword == "TENSORS" || keyword == "GLOBAL_IDS" || keyword == "PEDIGREE_IDS" )
+    {
+      if( attributeArrays == nullptr )
+      {
+        return layout;
+      }
+      LegacyArray array;
+      string typeName;
+      header >> array.name >> typeName;
+      if( !setLegacyType( typeName, array ) )
+      {
+        return layout;
+      }
+      array.numTuples = attributeSize;
+      array.isGlobalIds = keyword == "GLOBAL_IDS";
+      if( keyword == "SCALARS" )
+      {
+        header >> array.numComponents;
+        if( !header )
+        {
+          array.numComponents = 1;
+        }
+        // The lookup table line always follows the scalars header
+        string lookupTable;
+        file >> lookupTable;
+        std::getline( file, line );
+        if( lookupTable != "LOOKUP_TABLE" )
+        {
+          return layout;
+        }
+      }
+      else if( keyword == "VECTORS" || keyword == "NORMALS" )
+      {
+        array.numComponents = 3;
+      }
+      else if( keyword == "TENSORS" )
+      {
+        array.numComponents = 9;
+      }
+      skipArrayData( file, array );
+      attributeArrays->push_back( array );
+    }
+    else
+    {
+      // Polyhedral faces, color scalars, texture coordinates, ...
+      return layout;
+    }
+  }
+
+  layout.supported = layout.points.numTuples > 0 &&
+                     layout.cellTypes.numTuples > 0 &&
+                     layout.offsets.numTuples == layout.cellTypes.numTuples + 1;
+  for( LegacyArray const & array : layout.cellArrays )
+  {
+    layout.supported = layout.supported && array.numTuples == layout.cellTypes.numTuples;
+  }
+  for( LegacyArray const & array : layout.pointArrays )
+  {
+    layout.supported = layout.supported && array.numTuples == layout.points.numTuples;
+  }
+  return layout;
+}
+
+/**
+ * @brief Convert a value stored in big-endian order.
+ * @tparam T the type of the converted value
+ * @tparam STORAGE the type of the stored value
+ * @param[in] bytes the bytes of the value
+ * @return the converted value
+ */
+template< typename T, typename STORAGE >
+T convertValue( char const * const bytes )
+{
+  char swapped[sizeof( STORAGE )];
+  std::reverse_copy( bytes, bytes + sizeof( STORAGE ), swapped );
+  STORAGE value;
+  std::memcpy( &value, swapped, sizeof( STORAGE ) );
+  return static_cast< T >( value );
+}
+
+/**
+ * @brief Read a range of consecutive values of a binary array.
+ * @tparam T the type of the output values
+ * @param[inout] file the file stream
+ * @param[in] array the array
+ * @param[in] first the position of the first value (counting each component)
+ * @param[in] count the number of values
+ * @param[out] values the values, converted to @p T
+ *
+ * Binary legacy files are big-endian, the platform is assumed to be little-endian.
+ */
+template< typename T >
+void readValues( std::ifstream & file,
+                 LegacyArray const & array,
+                 vtkIdType const first,
+                 vtkIdType const count,
+                 T * const values )
+{
+  std::vector< char > buffer( count * array.valueSize );
+  file.seekg( array.offset + std::streamoff( first ) * array.valueSize );
+  file.read( buffer.data(), buffer.size() );
+  GEOS_ERROR_IF( !file, "Error while reading array \"" << array.name << "\" by chunks" );
+
+  for( vtkIdType i = 0; i < count; ++i )
+  {
+    char const * const bytes = buffer.data() + i * array.valueSize;
+    switch( array.valueSize + ( array.kind == 'f' ? 0 : ( array.kind == 'i' ? 16 : 32 ) ) )
+    {
+      case 4: values[i] = convertValue< T, float >( bytes ); break;
+      case 8: values[i] = convertValue< T, double >( bytes ); break;
+      case 16 + 1: values[i] = convertValue< T, std::int8_t >( bytes ); break;
+      case 16 + 2: values[i] = convertValue< T, std::int16_t >( bytes ); break;
+      case 16 + 4: values[i] = convertValue< T, std::int32_t >( bytes ); break;
+      case 16 + 8: values[i] = convertValue< T, std::int64_t >( bytes ); break;
+      case 32 + 1: values[i] = convertValue< T, std::uint8_t >( bytes ); break;
+      case 32 + 2: values[i] = convertValue< T, std::uint16_t >( bytes ); break;
+      case 32 + 4: values[i] = convertValue< T, std::uint32_t >( bytes ); break;
+      case 32 + 8: values[i] = convertValue< T, std::uint64_t >( bytes ); break;
+      default: GEOS_ERROR( "Unsupported value type of array \"" << array.name << "\"" );
+    }
+  }
+}
+
+/**
+ * @brief Compute the first entry of the contiguous chunk of a rank.
+ * @param[in] size the total number of entries
+ * @param[in] rank the rank
+ * @param[in] numRanks the number of ranks
+ * @return the first entry of the chunk
+ */
+vtkIdType chunkBegin( vtkIdType const size, int const rank, int const numRanks )
+{
+  return size * rank / numRanks;
+}
+
+/**
+ * @brief Create a VTK data array matching a legacy array.
+ * @param[in] array the legacy array
+ * @param[in] numTuples the number of tuples
+ * @return the new array
+ */
+vtkSmartPointer< vtkDataArray > createDataArray( LegacyArray const & array, vtkIdType const numTuples )
+{
+  vtkSmartPointer< vtkDataArray > data = vtkSmartPointer< vtkDataArray >::Take( vtkDataArray::CreateDataArray( array.vtkType ) );
+  data->SetName( array.name.c_str() );
+  data->SetNumberOfComponents( array.numComponents );
+  data->SetNumberOfTuples( numTuples );
+  return data;
+}
+
+/**
+ * @brief Create a global ids array.
+ * @param[in] ids the ids
+ * @return the new array
+ */
+vtkSmartPointer< vtkIdTypeArray > createGlobalIds( std::vector< vtkIdType > const & ids )
+{
+  vtkSmartPointer< vtkIdTypeArray > globalIds = vtkSmartPointer< vtkIdTypeArray >::New();
+  globalIds->SetName( "GlobalIds" );
+  globalIds->SetNumberOfValues( LvArray::integerConversion< vtkIdType >( ids.size() ) );
+  std::copy( ids.begin(), ids.end(), globalIds->GetPointer( 0 ) );
+  return globalIds;
+}
+
+/**
+ * @brief Compute exclusive prefix sums of counts.
+ * @param[in] counts the counts
+ * @param[in] factor factor applied to all counts
+ * @param[out] scaledCounts the scaled counts
+ * @param[out] displacements the displacements
+ */
+void computeDisplacements( std::vector< int > const & counts,
+                           int const factor,
+                           std::vector< int > & scaledCounts,
+                           std::vector< int > & displacements )
+{
+  scaledCounts.resize( counts.size() );
+  displacements.resize( counts.size() );
+  int displacement = 0;
+  for( std::size_t r = 0; r < counts.size(); ++r )
+  {
+    scaledCounts[r] = counts[r] * factor;
+    displacements[r] = displacement;
+    displacement += scaledCounts[r];
+  }
+}
+
+} // namespace
+
+bool isLegacyChunkReadable( Path const & filePath )
+{
+  return parseLayout( filePath ).supported;
+}
+
+vtkSmartPointer< vtkUnstructuredGrid >
+readLegacyByChunks( Path const & filePath, MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  LegacyLayout const layout = parseLayout( filePath );
+  GEOS_ERROR_IF( !layout.supported, "File \"" << filePath << "\" cannot be read by chunks" );
+
+  int const rank = MpiWrapper::commRank( comm );
+  int const numRanks = MpiWrapper::commSize( comm );
+  std::ifstream file( filePath, std::ios::binary );
+
+  // Contiguous range of cells of the current rank
+  vtkIdType const numCells = layout.cellTypes.numTuples;
+  vtkIdType const firstCell = chunkBegin( numCells, rank, numRanks );
+  vtkIdType const numLocalCells = chunkBegin( numCells, rank + 1, numRanks ) - firstCell;
+
+  std::vector< vtkIdType > offsets( numLocalCells + 1 );
+  readValues( file, layout.offsets, firstCell, numLocalCells + 1, offsets.data() );
+  vtkIdType const firstConnectivity = offsets.front();
+  std::vector< vtkIdType > connectivity( offsets.back() - firstConnectivity );
+  readValues( file, layout.connectivity, firstConnectivity, connectivity.size(), connectivity.data() );
+  vtkNew< vtkUnsignedCharArray > cellTypes;
+  cellTypes->SetNumberOfValues( numLocalCells );
+  readValues( file, layout.cellTypes, firstCell, numLocalCells, cellTypes->GetPointer( 0 ) );
+
+  // Points used by the local cells, sorted by position in the file
+  std::vector< vtkIdType > localPoints( connectivity );
+  std::sort( localPoints.begin(), localPoints.end() );
+  localPoints.erase( std::unique( localPoints.begin(), localPoints.end() ), localPoints.end() );
+
+  // The point section is split in contiguous ranges as well: request the needed points from their owners
+  vtkIdType const numPoints = layout.points.numTuples;
+  std::vector< int > requestCounts( numRanks ), replyCounts( numRanks );
+  {
+    auto begin = localPoints.begin();
+    for( int r = 0; r < numRanks; ++r )
+    {
+      auto const end = std::lower_bound( begin, localPoints.end(), chunkBegin( numPoints, r + 1, numRanks ) );
+      requestCounts[r] = LvArray::integerConversion< int >( end - begin );
+      begin = end;
+    }
+  }
+  MpiWrapper::allToAll( requestCounts.data(), 1, replyCounts.data(), comm );
+
+  std::vector< int > counts, displacements, replyDisplacements;
+  computeDisplacements( requestCounts, 1, counts, displacements );
+  computeDisplacements( replyCounts, 1, counts, replyDisplacements );
+  std::vector< globalIndex > const requests( localPoints.begin(), localPoints.end() );
+  std::vector< globalIndex > requested( std::accumulate( replyCounts.begin(), replyCounts.end(), 0 ) );
+  MpiWrapper::allToAllv( requests.data(), requestCounts.data(), displacements.data(),
+                         requested.data(), replyCounts.data(), replyDisplacements.data(), comm );
+
+  // Read the owned range of points, storing the coordinates and all point data components side by side
+  vtkIdType const firstOwnedPoint = chunkBegin( numPoints, rank, numRanks );
+  vtkIdType const numOwnedPoints = chunkBegin( numPoints, rank + 1, numRanks ) - firstOwnedPoint;
+  int stride = 3;
+  for( LegacyArray const & array : layout.pointArrays )
+  {
+    stride += array.numComponents;
+  }
+
+  std::vector< double > ownedValues( numOwnedPoints * stride );
+  {
+    std::vector< double > values;
+    int column = 0;
+    auto const readColumns = [&]( LegacyArray const & array )
+    {
+      values.resize( numOwnedPoints * array.numComponents );
+      readValues( file, array, firstOwnedPoint * array.numComponents, values.size(), values.data() );
+      for( vtkIdType i = 0; i < numOwnedPoints; ++i )
+      {
+        for( integer c = 0; c < array.numComponents; ++c )
+        {
+          ownedValues[i * stride + column + c] = values[i * array.numComponents + c];
+        }
+      }
+      column += array.numComponents;
+    };
+    readColumns( layout.points );
+    for( LegacyArray const & array : layout.pointArrays )
+    {
+      readColumns( array );
+    }
+  }
+
+  // Send back the requested points
+  std::vector< double > replies( requested.size() * stride );
+  for( std::size_t k = 0; k < requested.size(); ++k )
+  {
+    std::copy_n( &ownedValues[( requested[k] - firstOwnedPoint ) * stride ], stride, &replies[k * stride] );
+  }
+  std::vector< double > received( localPoints.size() * stride );
+  std::vector< int > scaledReplyCounts, scaledRequestCounts;
+  computeDisplacements( replyCounts, stride, scaledReplyCounts, replyDisplacements );
+  computeDisplacements( requestCounts, stride, scaledRequestCounts, displacements );
+  MpiWrapper::allToAllv( replies.data(), scaledReplyCounts.data(), replyDisplacements.data(),
+                         received.data(), scaledRequestCounts.data(), displacements.data(), comm );
+
+  // Build the local grid
+  vtkSmartPointer< vtkUnstructuredGrid > grid = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  vtkIdType const numLocalPoints = LvArray::integerConversion< vtkIdType >( localPoints.size() );
+
+  vtkNew< vtkPoints > points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints( numLocalPoints );
+  for( vtkIdType i = 0; i < numLocalPoints; ++i )
+  {
+    points->SetPoint( i, &received[i * stride] );
+  }
+  grid->SetPoints( points );
+
+  vtkNew< vtkIdTypeArray > localOffsets;
+  localOffsets->SetNumberOfValues( numLocalCells + 1 );
+  for( vtkIdType i = 0; i <= numLocalCells; ++i )
+  {
+    localOffsets->SetValue( i, offsets[i] - firstConnectivity );
+  }
+  vtkNew< vtkIdTypeArray > localConnectivity;
+  localConnectivity->SetNumberOfValues( LvArray::integerConversion< vtkIdType >( connectivity.size() ) );
+  for( std::size_t i = 0; i < connectivity.size(); ++i )
+  {
+    auto const it = std::lower_bound( localPoints.begin(), localPoints.end(), connectivity[i] );
+    localConnectivity->SetValue( LvArray::integerConversion< vtkIdType >( i ), it - localPoints.begin() );
+  }
+  vtkNew< vtkCellArray > cells;
+  cells->SetData( localOffsets, localConnectivity );
+  grid->SetCells( cellTypes, cells );
+
+  // Point data, the global ids being the positions in the file unless provided
+  vtkSmartPointer< vtkIdTypeArray > pointGlobalIds = createGlobalIds( localPoints );
+  {
+    int column = 3;
+    for( LegacyArray const & array : layout.pointArrays )
+    {
+      if( array.isGlobalIds )
+      {
+        for( vtkIdType i = 0; i < numLocalPoints; ++i )
+        {
+          pointGlobalIds->SetValue( i, static_cast< vtkIdType >( received[i * stride + column] ) );
+        }
+      }
+      else
+      {
+        vtkSmartPointer< vtkDataArray > data = createDataArray( array, numLocalPoints );
+        for( vtkIdType i = 0; i < numLocalPoints; ++i )
+        {
+          for( integer c = 0; c < array.numComponents; ++c )
+          {
+            data->SetComponent( i, c, received[i * stride + column + c] );
+          }
+        }
+        grid->GetPointData()->AddArray( data );
+      }
+      column += array.numComponents;
+    }
+  }
+  grid->GetPointData()->SetGlobalIds( pointGlobalIds );
+
+  // Cell data
+  std::vector< vtkIdType > cellIds( numLocalCells );
+  std::iota( cellIds.begin(), cellIds.end(), firstCell );
+  vtkSmartPointer< vtkIdTypeArray > cellGlobalIds = createGlobalIds( cellIds );
+  for( LegacyArray const & array : layout.cellArrays )
+  {
+    if( array.isGlobalIds )
+    {
+      readValues( file, array, firstCell, numLocalCells, cellGlobalIds->GetPointer( 0 ) );
+    }
+    else
+    {
+      std::vector< double > values( numLocalCells * array.numComponents );
+      readValues( file, array, firstCell * array.numComponents, values.size(), values.data() );
+      vtkSmartPointer< vtkDataArray > data = createDataArray( array, numLocalCells );
+      for( vtkIdType i = 0; i < numLocalCells; ++i )
+      {
+        for( integer c = 0; c < array.numComponents; ++c )
+        {
+          data->SetComponent( i, c, values[i * array.numComponents + c] );
+        }
+      }
+      grid->GetCellData()->AddArray( data );
+    }
+  }
+  grid->GetCellData()->SetGlobalIds( cellGlobalIds );
+
+  return grid;
+}
+
+} // namespace vtk
+
+} // namespace geos
@@ -0,0 +1,65 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VTKLegacyChunkedReader.hpp
+ */
+
+#ifndef GEOS_MESH_GENERATORS_VTKLEGACYCHUNKEDREADER_HPP_
+#define GEOS_MESH_GENERATORS_VTKLEGACYCHUNKEDREADER_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+namespace geos
+{
+
+namespace vtk
+{
+
+/**
+ * @brief Check whether a legacy VTK file can be read by chunks on all ranks.
+ * @param[in] filePath the path of the file
+ * @return true for binary unstructured grids of format version 5 and above (separate offsets and connectivity arrays)
+ *
+ * Older versions interleave the number of points of each cell with the connectivity, so that the position of a cell
+ * in the file cannot be computed without reading all the previous ones. Polyhedral cells and ASCII files are not
+ * supported either.
+ */
+bool isLegacyChunkReadable( Path const & filePath );
+
+/**
+ * @brief Read a legacy VTK unstructured grid by chunks, each rank reading a contiguous range of cells.
+ * @param[in] filePath the path of the file
+ * @param[in] comm the MPI communicator
+ * @return the cells of the current rank, along with the points they use and the point and cell data arrays
+ *
+ * The cell range of every rank is read directly from the file at the offset computed from the section headers.
+ * The point section is split in the same way, and each rank reads its own range of points (coordinates and
+ * point data) and sends the entries requested by the ranks whose cells use them, so that every byte of the file
+ * is read once. The positions of the cells and points in the file are stored as global ids, unless the file
+ * provides GLOBAL_IDS arrays.
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+readLegacyByChunks( Path const & filePath, MPI_Comm const comm );
+
+} // namespace vtk
+
+} // namespace geos
+
+#endif /* GEOS_MESH_GENERATORS_VTKLEGACYCHUNKEDREADER_HPP_ */
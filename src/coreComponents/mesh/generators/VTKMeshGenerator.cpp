@@ -21,6 +21,9 @@
 #include "mesh/generators/VTKFaceBlockUtilities.hpp"
 #include "mesh/generators/VTKMeshGeneratorTools.hpp"
 #include "mesh/generators/CellBlockManager.hpp"
+#include "mesh/generators/MeshValidation.hpp"
+#include "mesh/generators/WellGeneratorBase.hpp"
+#include "codingUtilities/StringUtilities.hpp"
 #include "common/DataTypes.hpp"
 #include "common/DataLayouts.hpp"
 #include "common/MpiWrapper.hpp"
@@ -65,6 +68,21 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Method (library) used to partition the mesh" );
 
+  registerWrapper( viewKeyStruct::partitionWeightsString(), &m_partitionWeights ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Names of the VTK cell data arrays used as cell weights by the graph partitioner, rounded to the nearest integer. "
+                    "Each array defines a balance constraint, so that giving several arrays (e.g. flow and mechanics costs) "
+                    "balances all of them at once (multi-constraint partitioning requires 'parmetis'). "
+                    "Face block cells have a unit weight for every constraint. If empty (default value), all cells have the same weight." );
+
+  registerWrapper( viewKeyStruct::partitionWellWeightString(), &m_partitionWellWeight ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Weight of the graph edges tying together the cells perforated by a same well, "
+                    "so that the graph partitioner keeps the cells of each well on few ranks and the well equations involve few ranks. "
+                    "Large values (e.g. 1000) favor keeping each well on a single rank over the quality of the reservoir partition. "
+                    "If 0 (default value), the wells are ignored by the partitioner." );
+
   registerWrapper( viewKeyStruct::useGlobalIdsString(), &m_useGlobalIds ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
@@ -72,6 +90,43 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
                     " If set to 0 (default value), the GlobalId arrays in the input mesh are used if available, and generated otherwise."
                     " If set to a negative value, the GlobalId arrays in the input mesh are not used, and generated global Ids are automatically generated."
                     " If set to a positive value, the GlobalId arrays in the input mesh are used and required, and the simulation aborts if they are not available" );
+
+  registerWrapper( viewKeyStruct::cellOrderingString(), &m_cellOrdering ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( spaceFillingCurve::CurveType::none ).
+    setDescription( "Space-filling curve through the cell centers used to order the cells of each cell block on each rank, "
+                    "in order to improve memory locality when the input cells are not spatially ordered. "
+                    "Valid options: {" + EnumStrings< spaceFillingCurve::CurveType >::concat( ", " ) + "}." );
+
+  registerWrapper( viewKeyStruct::renumberNodesString(), &m_renumberNodes ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to renumber the nodes of each rank in the order in which the cells visit them (after the cell ordering, if any), "
+                    "so that the faces and edges, which are numbered after their nodes, follow as well. "
+                    "This improves the memory locality of the nodal gathers of the element kernels when the input nodes are not ordered "
+                    "consistently with the cells. Not supported with face blocks." );
+
+  registerWrapper( viewKeyStruct::partitionCacheDirectoryString(), &m_partitionCacheDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Directory where the partitioned mesh of each rank is cached. "
+                    "When a run with the same mesh file, partitioning settings and number of ranks already filled the cache, "
+                    "each rank reads its own partition directly, skipping the loading and partitioning of the whole mesh. "
+                    "If empty (default value), no cache is used." );
+
+  registerWrapper( viewKeyStruct::validateMeshString(), &m_validateMesh ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Level of the quality checks run on the partitioned mesh, before any physics: "
+                    "non-positive volumes, inverted or tangled elements, overlapping elements, non-conformal faces and collocated nodes. "
+                    "If set to 0 (default value), the mesh is not checked. If set to 1, the issues are reported. "
+                    "If set to 2, the issues are reported and the simulation stops if any is found. "
+                    "The checks are local to each rank, and the collocated nodes are not searched when face blocks are imported." );
+
+  registerWrapper( viewKeyStruct::validationToleranceString(), &m_validationTolerance ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1.0e-8 ).
+    setDescription( "Distance under which two nodes are reported as collocated by the mesh validation, relative to the global length of the mesh." );
 }
 
 void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager, SpatialPartition & partition )
@@ -85,11 +140,42 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
 
   GEOS_LOG_RANK_0( GEOS_FMT( "{} '{}': reading mesh from {}", catalogName(), getName(), m_filePath ) );
   {
-    GEOS_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
-    vtk::AllMeshes allMeshes = vtk::loadAllMeshes( m_filePath, m_mainBlockName, m_faceBlockNames );
-    GEOS_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
-    vtk::AllMeshes redistributedMeshes =
-      vtk::redistributeMeshes( getLogLevel(), allMeshes.getMainMesh(), allMeshes.getFaceBlocks(), comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds );
+    string cacheKey;
+    vtk::AllMeshes redistributedMeshes;
+    if( !m_partitionCacheDirectory.empty() )
+    {
+      string const settings = GEOS_FMT( "{}|{}|{}|{}|{}|{}|{}",
+                                        m_mainBlockName,
+                                        stringutilities::join( m_faceBlockNames, "," ),
+                                        EnumStrings< vtk::PartitionMethod >::toString( m_partitionMethod ),
+                                        m_partitionRefinement,
+                                        m_useGlobalIds,
+                                        stringutilities::join( m_partitionWeights, "," ),
+                                        m_partitionWellWeight );
+      cacheKey = vtk::computePartitionCacheKey( m_filePath, settings, comm );
+      redistributedMeshes = vtk::readPartitionCache( m_partitionCacheDirectory, cacheKey, m_faceBlockNames, comm );
+      GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "  partition cache entry {} {}", cacheKey, redistributedMeshes.getMainMesh() ? "found" : "not found" ) );
+    }
+
+    if( !redistributedMeshes.getMainMesh() )
+    {
+      GEOS_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
+      vtk::AllMeshes allMeshes = vtk::loadAllMeshes( m_filePath, m_mainBlockName, m_faceBlockNames );
+      std::vector< arrayView2d< real64 const > > wellPerfCoords;
+      forSubGroups< WellGeneratorBase >( [&]( WellGeneratorBase const & wellGen )
+      {
+        wellPerfCoords.emplace_back( wellGen.getPerfCoords() );
+      } );
+      GEOS_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
+      redistributedMeshes =
+        vtk::redistributeMeshes( getLogLevel(), allMeshes.getMainMesh(), allMeshes.getFaceBlocks(), comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds, m_partitionWeights,
+                                 wellPerfCoords, m_partitionWellWeight );
+      if( !m_partitionCacheDirectory.empty() )
+      {
+        GEOS_LOG_LEVEL_RANK_0( 2, "  writing partition cache..." );
+        vtk::writePartitionCache( m_partitionCacheDirectory, cacheKey, redistributedMeshes, comm );
+      }
+    }
     m_vtkMesh = redistributedMeshes.getMainMesh();
     m_faceBlockMeshes = redistributedMeshes.getFaceBlocks();
     GEOS_LOG_LEVEL_RANK_0( 2, "  finding neighbor ranks..." );
@@ -103,6 +189,7 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
 
   GEOS_LOG_LEVEL_RANK_0( 2, "  preprocessing..." );
   m_cellMap = vtk::buildCellMap( *m_vtkMesh, m_attributeName );
+  vtk::reorderCellMap( *m_vtkMesh, m_cellMap, m_cellOrdering );
 
   GEOS_LOG_LEVEL_RANK_0( 2, "  writing nodes..." );
   cellBlockManager.setGlobalLength( writeNodes( getLogLevel(), *m_vtkMesh, m_nodesetNames, cellBlockManager, this->m_translate, this->m_scale ) );
@@ -113,9 +200,29 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
   GEOS_LOG_LEVEL_RANK_0( 2, "  writing surfaces..." );
   writeSurfaces( getLogLevel(), *m_vtkMesh, m_cellMap, cellBlockManager );
 
+  if( m_renumberNodes )
+  {
+    // the import of the fracture networks relies on the local node indices being the vtk point indices
+    GEOS_THROW_IF( !m_faceBlockMeshes.empty(),
+                   getDataContext() << ": the nodes cannot be renumbered when face blocks are imported.",
+                   InputError );
+    GEOS_LOG_LEVEL_RANK_0( 2, "  renumbering nodes..." );
+    cellBlockManager.renumberNodesByElementTraversal();
+  }
+
   GEOS_LOG_LEVEL_RANK_0( 2, "  building connectivity maps..." );
   cellBlockManager.buildMaps();
 
+  if( m_validateMesh > 0 )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 2, "  validating mesh..." );
+    meshValidation::Report const report = meshValidation::validate( cellBlockManager, m_validationTolerance, m_faceBlockMeshes.empty(), comm );
+    meshValidation::printReport( report, getName() );
+    GEOS_THROW_IF( m_validateMesh > 1 && report.numIssues() > 0,
+                   getDataContext() << ": the mesh validation found " << report.numIssues() << " issues.",
+                   InputError );
+  }
+
   for( auto const & [name, mesh]: m_faceBlockMeshes )
   {
     vtk::importFractureNetwork( name, mesh, m_vtkMesh, cellBlockManager );
@@ -107,7 +107,14 @@ private:
     constexpr static char const * nodesetNamesString() { return "nodesetNames"; }
     constexpr static char const * partitionRefinementString() { return "partitionRefinement"; }
     constexpr static char const * partitionMethodString() { return "partitionMethod"; }
+    constexpr static char const * partitionWeightsString() { return "partitionWeights"; }
+    constexpr static char const * partitionWellWeightString() { return "partitionWellWeight"; }
     constexpr static char const * useGlobalIdsString() { return "useGlobalIds"; }
+    constexpr static char const * cellOrderingString() { return "cellOrdering"; }
+    constexpr static char const * renumberNodesString() { return "renumberNodes"; }
+    constexpr static char const * partitionCacheDirectoryString() { return "partitionCacheDirectory"; }
+    constexpr static char const * validateMeshString() { return "validateMesh"; }
+    constexpr static char const * validationToleranceString() { return "validationTolerance"; }
   };
   /// @endcond
 
@@ -151,6 +158,27 @@ private:
   /// Method (library) used to partition the mesh
   vtk::PartitionMethod m_partitionMethod = vtk::PartitionMethod::parmetis;
 
+  /// Names of the cell data arrays used as partitioning weights
+  string_array m_partitionWeights;
+
+  /// Weight of the graph edges tying together the cells perforated by a same well (0 to ignore the wells)
+  integer m_partitionWellWeight = 0;
+
+  /// Space-filling curve used to order the cells of each cell block
+  spaceFillingCurve::CurveType m_cellOrdering = spaceFillingCurve::CurveType::none;
+
+  /// Whether the nodes are renumbered in the order in which the cells visit them
+  integer m_renumberNodes = 0;
+
+  /// Directory storing the partitioned meshes of previous runs, if any
+  Path m_partitionCacheDirectory;
+
+  /// Level of the mesh validation (0: none, 1: report, 2: report and stop if issues are found)
+  integer m_validateMesh = 0;
+
+  /// Distance under which two nodes are collocated, relative to the global length of the mesh
+  real64 m_validationTolerance = 0.0;
+
   /// Lists of VTK cell ids, organized by element type, then by region
   vtk::CellMapType m_cellMap;
 };
@@ -14,6 +14,7 @@
 
 
 #include "mesh/generators/CollocatedNodes.hpp"
+#include "mesh/generators/VTKLegacyChunkedReader.hpp"
 #include "mesh/generators/VTKMeshGeneratorTools.hpp"
 #include "mesh/generators/VTKUtilities.hpp"
 
@@ -31,6 +32,7 @@
 #include <vtkDataSetReader.h>
 #include <vtkExtractCells.h>
 #include <vtkGenerateGlobalIds.h>
+#include <vtkIdList.h>
 #include <vtkImageData.h>
 #include <vtkInformation.h>
 #include <vtkInformationStringKey.h>
@@ -40,6 +42,7 @@
 #include <vtkRectilinearGrid.h>
 #include <vtkRectilinearGridReader.h>
 #include <vtkRedistributeDataSetFilter.h>
+#include <vtkStaticCellLocator.h>
 #include <vtkStructuredGrid.h>
 #include <vtkStructuredGridReader.h>
 #include <vtkStructuredPoints.h>
@@ -54,6 +57,7 @@
 #include <vtkXMLRectilinearGridReader.h>
 #include <vtkXMLStructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLUnstructuredGridWriter.h>
 
 #ifdef GEOSX_USE_MPI
 #include <vtkMPIController.h>
@@ -62,6 +66,8 @@
 #include <vtkDummyController.h>
 #endif
 
+#include <filesystem>
+#include <fstream>
 #include <numeric>
 
 namespace geos
@@ -430,6 +436,107 @@ VTKLegacyDatasetType getVTKLegacyDatasetType( vtkSmartPointer< vtkDataSetReader
   return {};
 }
 
+/**
+ * @brief Compute the centers of a list of cells, as the average of their points.
+ * @param[in] mesh a vtk grid
+ * @param[in] cellIds the ids of the cells
+ * @return the coordinates of the cell centers
+ */
+array2d< real64 > computeCellCenters( vtkDataSet & mesh, std::vector< vtkIdType > const & cellIds )
+{
+  localIndex const numCells = LvArray::integerConversion< localIndex >( cellIds.size() );
+  array2d< real64 > centers( numCells, 3 );
+  centers.zero();
+
+  vtkNew< vtkIdList > pointIds;
+  for( localIndex i = 0; i < numCells; ++i )
+  {
+    mesh.GetCellPoints( cellIds[i], pointIds );
+    vtkIdType const numPoints = pointIds->GetNumberOfIds();
+    for( vtkIdType a = 0; a < numPoints; ++a )
+    {
+      double point[3];
+      mesh.GetPoint( pointIds->GetId( a ), point );
+      for( integer d = 0; d < 3; ++d )
+      {
+        centers( i, d ) += point[d] / numPoints;
+      }
+    }
+  }
+  return centers;
+}
+
+/**
+ * @brief Redistributes the mesh along a Morton curve covering the global bounding box
+ *
+ * @param[in] mesh a vtk grid, with cells on all ranks
+ * @param[in] comm the MPI communicator
+ * @return the vtk grid redistributed
+ *
+ * Cells are assigned to ranks by splitting the range of their keys at regularly sampled values, so that each rank
+ * receives a compact set of cells of nearly the same size. This only costs a few collective calls and serves as
+ * the initial partition before the graph partitioner.
+ */
+vtkSmartPointer< vtkDataSet >
+redistributeBySpaceFillingCurve( vtkSmartPointer< vtkDataSet > mesh, MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  int const numRanks = MpiWrapper::commSize( comm );
+  localIndex const numCells = mesh->GetNumberOfCells();
+
+  std::vector< vtkIdType > cellIds( numCells );
+  std::iota( cellIds.begin(), cellIds.end(), 0 );
+  array2d< real64 > const centers = computeCellCenters( *mesh, cellIds );
+
+  // Keys are computed on the global bounding box, to be consistent across ranks
+  real64 xMin[3] = { LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max };
+  real64 xMax[3] = { -LvArray::NumericLimits< real64 >::max, -LvArray::NumericLimits< real64 >::max, -LvArray::NumericLimits< real64 >::max };
+  for( localIndex i = 0; i < numCells; ++i )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      xMin[d] = LvArray::math::min( xMin[d], centers( i, d ) );
+      xMax[d] = LvArray::math::max( xMax[d], centers( i, d ) );
+    }
+  }
+  MpiWrapper::allReduce( xMin, xMin, 3, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Min ), comm );
+  MpiWrapper::allReduce( xMax, xMax, 3, MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ), comm );
+
+  array1d< std::uint64_t > keys( numCells );
+  spaceFillingCurve::computeKeys( centers.toViewConst(), spaceFillingCurve::CurveType::morton, xMin, xMax, keys.toView() );
+
+  // Regular sampling of the local sorted keys, ranks without cells sending invalid samples
+  std::uint64_t const invalidKey = std::numeric_limits< std::uint64_t >::max();
+  localIndex const numSamples = std::min( numRanks, 64 );
+  array1d< std::uint64_t > sortedKeys( keys );
+  std::sort( sortedKeys.begin(), sortedKeys.end() );
+  array1d< std::uint64_t > samples( numSamples );
+  for( localIndex s = 0; s < numSamples; ++s )
+  {
+    samples[s] = numCells > 0 ? sortedKeys[s * numCells / numSamples] : invalidKey;
+  }
+  array1d< std::uint64_t > allSamples;
+  MpiWrapper::allGather( samples.toViewConst(), allSamples, comm );
+  std::sort( allSamples.begin(), allSamples.end() );
+  localIndex const numValidSamples = std::lower_bound( allSamples.begin(), allSamples.end(), invalidKey ) - allSamples.begin();
+
+  // Split the key range in numRanks parts with the same number of samples
+  array1d< std::uint64_t > splitters( numRanks - 1 );
+  for( int r = 1; r < numRanks; ++r )
+  {
+    splitters[r - 1] = numValidSamples > 0 ? allSamples[r * numValidSamples / numRanks] : 0;
+  }
+  array1d< int > parts( numCells );
+  for( localIndex i = 0; i < numCells; ++i )
+  {
+    parts[i] = LvArray::integerConversion< int >( std::upper_bound( splitters.begin(), splitters.end(), keys[i] ) - splitters.begin() );
+  }
+
+  vtkSmartPointer< vtkPartitionedDataSet > const splitMesh = splitMeshByPartition( mesh, numRanks, parts.toViewConst() );
+  return vtk::redistribute( *splitMesh, comm );
+}
+
 vtkSmartPointer< vtkDataSet >
 loadMesh( Path const & filePath,
           string const & blockName,
@@ -510,7 +617,16 @@ loadMesh( Path const & filePath,
       {
         case VTKLegacyDatasetType::structuredPoints: return serialRead( vtkSmartPointer< vtkStructuredPointsReader >::New() );
         case VTKLegacyDatasetType::structuredGrid:   return serialRead( vtkSmartPointer< vtkStructuredGridReader >::New() );
-        case VTKLegacyDatasetType::unstructuredGrid: return serialRead( vtkSmartPointer< vtkUnstructuredGridReader >::New() );
+        case VTKLegacyDatasetType::unstructuredGrid:
+        {
+          // Face blocks are expected on the reader rank only, so that only the main mesh is read by chunks
+          if( MpiWrapper::commSize() > 1 && readerRank == 0 && isLegacyChunkReadable( filePath ) )
+          {
+            GEOS_LOG_RANK_0( "Reading " << filePath << " by chunks on all ranks" );
+            return redistributeBySpaceFillingCurve( readLegacyByChunks( filePath, MPI_COMM_GEOSX ), MPI_COMM_GEOSX );
+          }
+          return serialRead( vtkSmartPointer< vtkUnstructuredGridReader >::New() );
+        }
         case VTKLegacyDatasetType::rectilinearGrid:  return serialRead( vtkSmartPointer< vtkRectilinearGridReader >::New() );
       }
       break;
@@ -557,6 +673,175 @@ AllMeshes loadAllMeshes( Path const & filePath,
 }
 
 
+/**
+ * @brief Build the vertex weights of the cell graph from cell data arrays of the main mesh.
+ * @param[in] mesh the main mesh
+ * @param[in] weightArrayNames the names of the cell data arrays, one per balance constraint
+ * @param[in] numFracCells the number of face block cells appended to the graph vertices of the current rank
+ * @return the weights, with one row per graph vertex and one column per constraint
+ *
+ * Weights are rounded to the nearest integer. Face block cells, which carry no weight array, get a unit
+ * weight for every constraint.
+ */
+array2d< pmet_idx_t > buildCellGraphWeights( vtkDataSet & mesh,
+                                             string_array const & weightArrayNames,
+                                             vtkIdType const numFracCells )
+{
+  vtkIdType const numCells = mesh.GetNumberOfCells();
+  localIndex const numConstraints = weightArrayNames.size();
+
+  array2d< pmet_idx_t > weights( numCells + numFracCells, numConstraints );
+  weights.setValues< serialPolicy >( 1 );
+  for( localIndex c = 0; c < numConstraints; ++c )
+  {
+    if( numCells == 0 )
+    {
+      break;
+    }
+    vtkDataArray * const array = mesh.GetCellData()->GetArray( weightArrayNames[c].c_str() );
+    GEOS_THROW_IF( array == nullptr,
+                   GEOS_FMT( "Partition weight array '{}' not found in the cell data of the mesh", weightArrayNames[c] ),
+                   InputError );
+    for( vtkIdType i = 0; i < numCells; ++i )
+    {
+      double const weight = array->GetComponent( i, 0 );
+      GEOS_THROW_IF_LT_MSG( weight, 0.0,
+                            GEOS_FMT( "Negative value in partition weight array '{}'", weightArrayNames[c] ),
+                            InputError );
+      weights( i, c ) = static_cast< pmet_idx_t >( std::lround( weight ) );
+    }
+  }
+  return weights;
+}
+
+/**
+ * @brief Find the graph vertices of the cells containing the perforations of the wells.
+ * @param[in] mesh the main mesh of the current rank
+ * @param[in] wellPerfCoords the coordinates of the perforations of each well
+ * @param[in] vertexOffset the index of the first graph vertex of the current rank
+ * @param[in] comm the MPI communicator
+ * @return for each well, the graph vertices of its perforated cells in the order of the perforations
+ *         (-1 for the perforations outside of the mesh), identical on all the ranks
+ */
+std::vector< array1d< pmet_idx_t > > findPerforatedCells( vtkDataSet & mesh,
+                                                          std::vector< arrayView2d< real64 const > > const & wellPerfCoords,
+                                                          pmet_idx_t const vertexOffset,
+                                                          MPI_Comm const comm )
+{
+  bool const hasCells = mesh.GetNumberOfCells() > 0;
+  vtkNew< vtkStaticCellLocator > locator;
+  if( hasCells )
+  {
+    locator->SetDataSet( &mesh );
+    locator->BuildLocator();
+  }
+
+  std::vector< array1d< pmet_idx_t > > perforatedCells;
+  for( arrayView2d< real64 const > const & perfCoords : wellPerfCoords )
+  {
+    localIndex const numPerfs = perfCoords.size( 0 );
+    array1d< pmet_idx_t > localCells( numPerfs );
+    localCells.setValues< serialPolicy >( -1 );
+    for( localIndex iperf = 0; iperf < numPerfs && hasCells; ++iperf )
+    {
+      double x[3] = { perfCoords( iperf, 0 ), perfCoords( iperf, 1 ), perfCoords( iperf, 2 ) };
+      vtkIdType const cellId = locator->FindCell( x );
+      if( cellId >= 0 )
+      {
+        localCells[iperf] = vertexOffset + cellId;
+      }
+    }
+
+    // a perforation on the boundary between two ranks is attached to any of its cells
+    array1d< pmet_idx_t > & cells = perforatedCells.emplace_back( numPerfs );
+    MpiWrapper::allReduce( localCells.data(), cells.data(), LvArray::integerConversion< int >( numPerfs ), MPI_MAX, comm );
+  }
+  return perforatedCells;
+}
+
+/**
+ * @brief Add to the cell graph the edges tying together the perforated cells of each well.
+ * @param[in] graph the cell graph (edges of the graph vertices of the current rank)
+ * @param[in] perforatedCells for each well, the graph vertices of its perforated cells, as returned by findPerforatedCells
+ * @param[in] vertexOffset the index of the first graph vertex of the current rank
+ * @param[in] wellEdgeWeight the weight of the edges between the perforated cells of a well
+ * @param[out] edgeWeights the weights of the edges of the returned graph, in the order of its values
+ * @return the graph with the edges of the wells
+ *
+ * The perforated cells of a well are chained in the order of the perforations, which ties them together
+ * while keeping the graph sparse. The edges of the input graph have a unit weight, unless they are also a well edge.
+ */
+ArrayOfArrays< pmet_idx_t, pmet_idx_t > addWellEdges( ArrayOfArraysView< pmet_idx_t const, pmet_idx_t > const & graph,
+                                                      std::vector< array1d< pmet_idx_t > > const & perforatedCells,
+                                                      pmet_idx_t const vertexOffset,
+                                                      pmet_idx_t const wellEdgeWeight,
+                                                      array1d< pmet_idx_t > & edgeWeights )
+{
+  localIndex const numVertices = graph.size();
+
+  // well neighbors of each local vertex; the edges are added on both sides since all the ranks know all the wells
+  std::vector< std::map< pmet_idx_t, pmet_idx_t > > wellNeighbors( numVertices );
+  auto const addEdge = [&]( pmet_idx_t const from, pmet_idx_t const to )
+  {
+    if( from >= vertexOffset && from < vertexOffset + numVertices )
+    {
+      wellNeighbors[from - vertexOffset][to] = wellEdgeWeight;
+    }
+  };
+  for( array1d< pmet_idx_t > const & cells : perforatedCells )
+  {
+    pmet_idx_t previous = -1;
+    for( pmet_idx_t const cell : cells )
+    {
+      if( cell < 0 || cell == previous )
+      {
+        continue;
+      }
+      if( previous >= 0 )
+      {
+        addEdge( previous, cell );
+        addEdge( cell, previous );
+      }
+      previous = cell;
+    }
+  }
+
+  // merge the well edges into the edges of the graph
+  array1d< pmet_idx_t > offsets( numVertices + 1 );
+  std::vector< pmet_idx_t > neighbors;
+  std::vector< pmet_idx_t > weights;
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    std::map< pmet_idx_t, pmet_idx_t > & extraNeighbors = wellNeighbors[v];
+    for( pmet_idx_t const neighbor : graph[v] )
+    {
+      auto const it = extraNeighbors.find( neighbor );
+      neighbors.push_back( neighbor );
+      weights.push_back( it == extraNeighbors.end() ? 1 : it->second );
+      if( it != extraNeighbors.end() )
+      {
+        extraNeighbors.erase( it );
+      }
+    }
+    for( auto const & [neighbor, weight] : extraNeighbors )
+    {
+      neighbors.push_back( neighbor );
+      weights.push_back( weight );
+    }
+    offsets[v + 1] = LvArray::integerConversion< pmet_idx_t >( neighbors.size() );
+  }
+
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > result;
+  result.resizeFromOffsets( numVertices, offsets.data() );
+  for( localIndex v = 0; v < numVertices; ++v )
+  {
+    result.appendToArray( v, neighbors.begin() + offsets[v], neighbors.begin() + offsets[v + 1] );
+  }
+  edgeWeights.resize( LvArray::integerConversion< localIndex >( weights.size() ) );
+  std::copy( weights.begin(), weights.end(), edgeWeights.begin() );
+  return result;
+}
+
 /**
  * @brief Redistributes the mesh using cell graphds methods (ParMETIS or PTScotch)
  *
@@ -564,12 +849,18 @@ AllMeshes loadAllMeshes( Path const & filePath,
  * @param[in] method the partitionning method
  * @param[in] comm the MPI communicator
  * @param[in] numRefinements the number of refinements for PTScotch
+ * @param[in] weightArrayNames the names of the cell data arrays used as weights, one per balance constraint
+ * @param[in] wellPerfCoords the coordinates of the perforations of each well
+ * @param[in] wellEdgeWeight the weight of the edges tying the perforated cells of each well, 0 to ignore the wells
  * @return the vtk grid redistributed
  */
 AllMeshes redistributeByCellGraph( AllMeshes & input,
                                    PartitionMethod const method,
                                    MPI_Comm const comm,
-                                   int const numRefinements )
+                                   int const numRefinements,
+                                   string_array const & weightArrayNames,
+                                   std::vector< arrayView2d< real64 const > > const & wellPerfCoords,
+                                   integer const wellEdgeWeight )
 {
   GEOS_MARK_FUNCTION;
 
@@ -607,7 +898,17 @@ AllMeshes redistributeByCellGraph( AllMeshes & input,
   // Use pmet_idx_t here to match ParMETIS' pmet_idx_t
   // The `elemToNodes` mapping binds element indices (local to the rank) to the global indices of their support nodes.
   ArrayOfArrays< pmet_idx_t, pmet_idx_t > const elemToNodes = buildElemToNodes< pmet_idx_t >( input );
-  ArrayOfArrays< pmet_idx_t, pmet_idx_t > const graph = parmetis::meshToDual( elemToNodes.toViewConst(), elemDist, comm, 3 );
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > graph = parmetis::meshToDual( elemToNodes.toViewConst(), elemDist, comm, 3 );
+  array2d< pmet_idx_t > const weights = buildCellGraphWeights( *input.getMainMesh(), weightArrayNames, localNumFracCells );
+
+  // Tie together the perforated cells of each well, so that the well equations involve few ranks.
+  array1d< pmet_idx_t > edgeWeights;
+  if( wellEdgeWeight > 0 && !wellPerfCoords.empty() )
+  {
+    std::vector< array1d< pmet_idx_t > > const perforatedCells =
+      findPerforatedCells( *input.getMainMesh(), wellPerfCoords, elemDist[rank], comm );
+    graph = addWellEdges( graph.toViewConst(), perforatedCells, elemDist[rank], wellEdgeWeight, edgeWeights );
+  }
 
   // `newParts` will contain the target rank (i.e. partition) for each of the elements of the current rank.
   array1d< pmet_idx_t > newPartitions = [&]()
@@ -616,13 +917,14 @@ AllMeshes redistributeByCellGraph( AllMeshes & input,
     {
       case PartitionMethod::parmetis:
       {
-        return parmetis::partition( graph.toViewConst(), elemDist, numRanks, comm, numRefinements );
+        return parmetis::partition( graph.toViewConst(), weights.toViewConst(), edgeWeights.toViewConst(), elemDist, numRanks, comm, numRefinements );
       }
       case PartitionMethod::ptscotch:
       {
 #ifdef GEOSX_USE_SCOTCH
         GEOS_WARNING_IF( numRefinements > 0, "Partition refinement is not supported by 'ptscotch' partitioning method" );
-        return ptscotch::partition( graph.toViewConst(), numRanks, comm );
+        GEOS_THROW_IF( weightArrayNames.size() > 1, "Multi-constraint partitioning is not supported by 'ptscotch' partitioning method", InputError );
+        return ptscotch::partition( graph.toViewConst(), weights.toViewConst(), edgeWeights.toViewConst(), numRanks, comm );
 #else
         GEOS_THROW( "GEOSX must be built with Scotch support (ENABLE_SCOTCH=ON) to use 'ptscotch' partitioning method", InputError );
 #endif
@@ -876,7 +1178,10 @@ redistributeMeshes( integer const logLevel,
                     MPI_Comm const comm,
                     PartitionMethod const method,
                     int const partitionRefinement,
-                    int const useGlobalIds )
+                    int const useGlobalIds,
+                    string_array const & partitionWeights,
+                    std::vector< arrayView2d< real64 const > > const & wellPerfCoords,
+                    integer const wellEdgeWeight )
 {
   GEOS_MARK_FUNCTION;
 
@@ -918,7 +1223,7 @@ redistributeMeshes( integer const logLevel,
   if( partitionRefinement > 0 )
   {
     AllMeshes input( mesh, namesToFractures );
-    result = redistributeByCellGraph( input, method, comm, partitionRefinement - 1 );
+    result = redistributeByCellGraph( input, method, comm, partitionRefinement - 1, partitionWeights, wellPerfCoords, wellEdgeWeight );
   }
   else
   {
@@ -944,6 +1249,126 @@ redistributeMeshes( integer const logLevel,
   return result;
 }
 
+/**
+ * @brief Build the path of a partitioned mesh in a partition cache.
+ * @param[in] entryDirectory the directory of the cache entry
+ * @param[in] rank the rank owning the mesh
+ * @param[in] blockName the name of the face block, or empty for the main mesh
+ * @return the path of the file
+ */
+string partitionCacheFile( string const & entryDirectory, int const rank, string const & blockName )
+{
+  string const fileName = blockName.empty() ? GEOS_FMT( "rank_{:05}.vtu", rank ) : GEOS_FMT( "rank_{:05}_{}.vtu", rank, blockName );
+  return joinPath( entryDirectory, fileName );
+}
+
+/// Name of the file flagging a complete partition cache entry
+constexpr char const * partitionCacheCompleteFile = "complete";
+
+string computePartitionCacheKey( Path const & filePath,
+                                 string const & settings,
+                                 MPI_Comm const comm )
+{
+  string key;
+  if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    std::error_code ec;
+    std::uintmax_t const fileSize = std::filesystem::file_size( filePath, ec );
+    auto const fileTime = std::filesystem::last_write_time( filePath, ec ).time_since_epoch().count();
+    string const description = GEOS_FMT( "{}|{}|{}|{}|{}", string( filePath ), fileSize, fileTime, settings, MpiWrapper::commSize( comm ) );
+    key = GEOS_FMT( "{:016x}", std::hash< string >{}( description ) );
+  }
+  MpiWrapper::broadcast( key, 0, comm );
+  return key;
+}
+
+AllMeshes readPartitionCache( Path const & cacheDirectory,
+                              string const & key,
+                              array1d< string > const & faceBlockNames,
+                              MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  string const entryDirectory = joinPath( cacheDirectory, key );
+  int complete = 0;
+  if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    complete = std::ifstream( joinPath( entryDirectory, partitionCacheCompleteFile ) ).good();
+  }
+  MpiWrapper::broadcast( complete, 0, comm );
+  if( !complete )
+  {
+    return {};
+  }
+
+  int const rank = MpiWrapper::commRank( comm );
+  auto const readFile = [&]( string const & blockName ) -> vtkSmartPointer< vtkDataSet >
+  {
+    vtkNew< vtkXMLUnstructuredGridReader > reader;
+    reader->SetFileName( partitionCacheFile( entryDirectory, rank, blockName ).c_str() );
+    reader->Update();
+    return vtkSmartPointer< vtkUnstructuredGrid >( reader->GetOutput() );
+  };
+
+  vtkSmartPointer< vtkDataSet > main = readFile( "" );
+  std::map< string, vtkSmartPointer< vtkDataSet > > faceBlocks;
+  for( string const & faceBlockName : faceBlockNames )
+  {
+    faceBlocks[faceBlockName] = readFile( faceBlockName );
+  }
+  return AllMeshes( main, faceBlocks );
+}
+
+void writePartitionCache( Path const & cacheDirectory,
+                          string const & key,
+                          AllMeshes & meshes,
+                          MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  // Meshes are only written once redistributed, which always produces unstructured grids
+  int const isUnstructured = vtkUnstructuredGrid::SafeDownCast( meshes.getMainMesh() ) != nullptr;
+  if( MpiWrapper::min( isUnstructured, comm ) == 0 )
+  {
+    GEOS_LOG_RANK_0( "Partitioned mesh is not an unstructured grid on all ranks, skipping partition cache" );
+    return;
+  }
+
+  string const entryDirectory = joinPath( cacheDirectory, key );
+  if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    makeDirsForPath( entryDirectory );
+  }
+  MpiWrapper::barrier( comm );
+
+  int const rank = MpiWrapper::commRank( comm );
+  auto const writeFile = [&]( vtkDataSet * const mesh, string const & blockName )
+  {
+    vtkNew< vtkXMLUnstructuredGridWriter > writer;
+    writer->SetFileName( partitionCacheFile( entryDirectory, rank, blockName ).c_str() );
+    writer->SetInputData( mesh );
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    writer->SetCompressorTypeToNone();
+    return writer->Write();
+  };
+
+  int success = writeFile( meshes.getMainMesh(), "" );
+  for( auto const & [faceBlockName, faceBlockMesh] : meshes.getFaceBlocks() )
+  {
+    success = success && writeFile( faceBlockMesh, faceBlockName );
+  }
+
+  if( MpiWrapper::min( success, comm ) == 0 )
+  {
+    GEOS_LOG_RANK_0( "Could not write partition cache entry " << entryDirectory );
+  }
+  else if( MpiWrapper::commRank( comm ) == 0 )
+  {
+    std::ofstream( joinPath( entryDirectory, partitionCacheCompleteFile ) ) << key << std::endl;
+  }
+}
+
 /**
  * @brief Identify the GEOSX type of the polyhedron
  *
@@ -1632,6 +2057,35 @@ CellMapType buildCellMap( vtkDataSet & mesh, string const & attributeName )
   return cellMap;
 }
 
+void reorderCellMap( vtkDataSet & mesh,
+                     CellMapType & cellMap,
+                     spaceFillingCurve::CurveType const curveType )
+{
+  if( curveType == spaceFillingCurve::CurveType::none )
+  {
+    return;
+  }
+
+  for( auto & typeCells : cellMap )
+  {
+    for( auto & attributeCells : typeCells.second )
+    {
+      std::vector< vtkIdType > & cellIds = attributeCells.second;
+      localIndex const numCells = LvArray::integerConversion< localIndex >( cellIds.size() );
+      array2d< real64 > const centers = computeCellCenters( mesh, cellIds );
+
+      array1d< localIndex > order( numCells );
+      spaceFillingCurve::computeOrdering( centers.toViewConst(), curveType, order.toView() );
+
+      std::vector< vtkIdType > const originalCellIds = cellIds;
+      for( localIndex i = 0; i < numCells; ++i )
+      {
+        cellIds[i] = originalCellIds[order[i]];
+      }
+    }
+  }
+}
+
 bool vtkToGeosxNodeOrderingExists( ElementType const elemType )
 {
   switch( elemType )
@@ -24,6 +24,7 @@
 #include "common/MpiWrapper.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "mesh/generators/CellBlockManager.hpp"
+#include "mesh/utilities/SpaceFillingCurve.hpp"
 
 #include <vtkSmartPointer.h>
 #include <vtkDataSet.h>
@@ -157,6 +158,11 @@ findNeighborRanks( std::vector< vtkBoundingBox > boundingBoxes );
  * @param[in] method the partitionning method
  * @param[in] partitionRefinement number of graph partitioning refinement cycles
  * @param[in] useGlobalIds controls whether global id arrays from the vtk input should be used
+ * @param[in] partitionWeights names of the cell data arrays used as weights by the graph partitioner,
+ *                             one per balance constraint; cells have a unit weight if empty
+ * @param[in] wellPerfCoords the coordinates of the perforations of each well of the mesh
+ * @param[in] wellEdgeWeight weight of the graph edges tying together the cells perforated by a same well,
+ *                           so that the graph partitioner keeps each well on few ranks; the wells are ignored if 0
  * @return the vtk grid redistributed
  */
 AllMeshes
@@ -166,7 +172,50 @@ redistributeMeshes( integer const logLevel,
                     MPI_Comm const comm,
                     PartitionMethod const method,
                     int const partitionRefinement,
-                    int const useGlobalIds );
+                    int const useGlobalIds,
+                    string_array const & partitionWeights,
+                    std::vector< arrayView2d< real64 const > > const & wellPerfCoords,
+                    integer const wellEdgeWeight );
+
+/**
+ * @brief Compute the key identifying a partitioned mesh in a partition cache.
+ * @param[in] filePath the path of the input mesh file
+ * @param[in] settings a string gathering all the settings affecting the partitioned meshes
+ * @param[in] comm the MPI communicator
+ * @return the key, built from the path, size and modification time of the file, the settings and the number of ranks
+ * @note Only the file given as input is checked: pieces referenced by a .vtm or a .pvtu file are not.
+ */
+string computePartitionCacheKey( Path const & filePath,
+                                 string const & settings,
+                                 MPI_Comm const comm );
+
+/**
+ * @brief Read the partitioned meshes of the current rank from a partition cache.
+ * @param[in] cacheDirectory the directory of the cache
+ * @param[in] key the key of the partitioned meshes
+ * @param[in] faceBlockNames the names of the face blocks
+ * @param[in] comm the MPI communicator
+ * @return the meshes of the current rank, or an empty main mesh if the cache contains no complete entry for @p key
+ */
+AllMeshes readPartitionCache( Path const & cacheDirectory,
+                              string const & key,
+                              array1d< string > const & faceBlockNames,
+                              MPI_Comm const comm );
+
+/**
+ * @brief Write the partitioned meshes of all ranks to a partition cache.
+ * @param[in] cacheDirectory the directory of the cache
+ * @param[in] key the key of the partitioned meshes
+ * @param[in] meshes the meshes of the current rank
+ * @param[in] comm the MPI communicator
+ *
+ * Each rank writes its own meshes as raw binary vtu files, and the entry is flagged as complete once all ranks are done,
+ * so that an interrupted run never leaves a partial entry behind.
+ */
+void writePartitionCache( Path const & cacheDirectory,
+                          string const & key,
+                          AllMeshes & meshes,
+                          MPI_Comm const comm );
 
 /**
  * @brief Collect lists of VTK cell indices organized by type and attribute value.
@@ -179,6 +228,19 @@ redistributeMeshes( integer const logLevel,
 CellMapType buildCellMap( vtkDataSet & mesh,
                           string const & attributeName );
 
+/**
+ * @brief Reorder each list of VTK cell indices along a space-filling curve through the cell centers.
+ * @param[in] mesh the vtkUnstructuredGrid or vtkStructuredGrid that is loaded
+ * @param[in,out] cellMap the cell lists organized by type and attribute value
+ * @param[in] curveType the type of space-filling curve
+ *
+ * The cell lists define the storage order of the elements in the cell blocks, so that neighboring cells
+ * end up close in memory, and so are their DoFs when numbered in element order.
+ */
+void reorderCellMap( vtkDataSet & mesh,
+                     CellMapType & cellMap,
+                     spaceFillingCurve::CurveType const curveType );
+
 /**
  * @brief Print statistics for a vtk mesh
  *
@@ -22,6 +22,7 @@
 #include "common/GEOS_RAJA_Interface.hpp"
 
 #include <algorithm>
+#include <chrono>
 
 namespace geos
 {
@@ -44,10 +45,35 @@ CommunicationTools::CommunicationTools()
 
 CommunicationTools::~CommunicationTools()
 {
+  // the channels release their CommID into m_freeCommIDs, so clear them first
+  m_persistentSyncChannels.clear();
   GEOS_ERROR_IF( m_instance != this, "m_instance != this should not be possible." );
   m_instance = nullptr;
 }
 
+CommunicationTools::PersistentSyncChannel::~PersistentSyncChannel()
+{
+  freeRequests();
+}
+
+void CommunicationTools::PersistentSyncChannel::freeRequests()
+{
+  for( localIndex i = 0; i < sendRequests.size(); ++i )
+  {
+    if( sendRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::requestFree( &sendRequests[i] );
+    }
+    if( recvRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::requestFree( &recvRequests[i] );
+    }
+  }
+  sendRequests.clear();
+  recvRequests.clear();
+  initialized = false;
+}
+
 CommunicationTools & CommunicationTools::getInstance()
 {
   GEOS_ERROR_IF( m_instance == nullptr,
@@ -800,7 +826,8 @@ void waitOrderedOrWaitAll( int const n,
 
 void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
                                       std::vector< NeighborCommunicator > & neighbors,
-                                      bool const unorderedComms )
+                                      bool const unorderedComms,
+                                      GhostConnectivity const connectivity )
 {
   GEOS_MARK_FUNCTION;
   MPI_iCommData commData( getCommID() );
@@ -815,6 +842,7 @@ void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
   {
     neighbors[idx].prepareAndSendGhosts( false,
                                          1,
+                                         connectivity,
                                          meshLevel,
                                          commData.commID(),
                                          commData.mpiRecvBufferSizeRequest( idx ),
@@ -978,6 +1006,9 @@ void CommunicationTools::asyncSendRecv( std::vector< NeighborCommunicator > & ne
   // could swap this to test and make this function call async as well, only launch the sends/recvs for
   // those we've already recv'd sizing for, go back to some usefule compute / launch some other compute, then
   // check this again
+  // the size messages are sent as soon as the neighbors reach the synchronization, so the time until
+  // their arrival measures how late each neighbor is
+  std::chrono::steady_clock::time_point const waitStart = std::chrono::steady_clock::now();
   for( std::size_t count = 0; count < neighbors.size(); ++count )
   {
     int neighborIndex;
@@ -987,6 +1018,7 @@ void CommunicationTools::asyncSendRecv( std::vector< NeighborCommunicator > & ne
                          icomm.mpiRecvBufferSizeStatus() );
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    neighbor.logWaitTime( std::chrono::duration< real64 >( std::chrono::steady_clock::now() - waitStart ).count() );
 
     neighbor.mpiISendReceiveBuffers( icomm.commID(),
                                      icomm.mpiSendBufferRequest( neighborIndex ),
@@ -1086,16 +1118,216 @@ void CommunicationTools::synchronizeUnpack( MeshLevel & mesh,
   finalizeUnpack( mesh, neighbors, icomm, onDevice, events );
 }
 
+template< typename LAMBDA >
+void forFieldsManagers( FieldIdentifiers const & fields,
+                        string const & key,
+                        MeshLevel & mesh,
+                        LAMBDA && lambda )
+{
+  FieldLocation location{};
+  fields.getLocation( key, location );
+  switch( location )
+  {
+    case FieldLocation::Node:
+    {
+      lambda( mesh.getNodeManager() );
+      break;
+    }
+    case FieldLocation::Edge:
+    {
+      lambda( mesh.getEdgeManager() );
+      break;
+    }
+    case FieldLocation::Face:
+    {
+      lambda( mesh.getFaceManager() );
+      break;
+    }
+    case FieldLocation::Elem:
+    {
+      mesh.getElemManager().getRegion( fields.getRegionName( key ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+      {
+        lambda( subRegion );
+      } );
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Remove the fields whose ghost copies are up to date from a list of fields to synchronize.
+ * @param fieldsToBeSync the fields to synchronize
+ * @param mesh the mesh level holding the fields
+ * @return the fields to pack, with the same keys as @p fieldsToBeSync
+ *
+ * A field is only removed when its modifications are tracked on all the managers of its key.
+ * The keys are kept, even without any field left, so that the packing and unpacking of the
+ * buffers still visit the same managers.
+ */
+FieldIdentifiers filterSynchronizedFields( FieldIdentifiers const & fieldsToBeSync,
+                                           MeshLevel & mesh )
+{
+  Timestamp const meshTimestamp = mesh.getModificationTimestamp();
+  FieldIdentifiers modifiedFields;
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    std::vector< string > fieldNames;
+    for( string const & fieldName : iter.second )
+    {
+      bool isSynchronized = true;
+      forFieldsManagers( fieldsToBeSync, iter.first, mesh, [&]( ObjectManagerBase const & manager )
+      {
+        isSynchronized = isSynchronized && manager.getWrapperBase( fieldName ).isSynchronized( meshTimestamp );
+      } );
+      if( !isSynchronized )
+      {
+        fieldNames.emplace_back( fieldName );
+        if( fieldsToBeSync.isSinglePrecision( fieldName ) )
+        {
+          modifiedFields.setSinglePrecision( { fieldName } );
+        }
+      }
+    }
+    modifiedFields.addFieldsWithKey( iter.first, fieldNames );
+  }
+  return modifiedFields;
+}
+
+void CommunicationTools::beginSynchronizeFields( FieldIdentifiers const & fieldsToBeSync,
+                                                 MeshLevel & mesh,
+                                                 std::vector< NeighborCommunicator > & neighbors,
+                                                 MPI_iCommData & icomm,
+                                                 bool onDevice )
+{
+  GEOS_MARK_FUNCTION;
+  icomm.resize( neighbors.size() );
+
+  // the buffers are self-describing, so each rank only packs the fields modified since their last synchronization
+  FieldIdentifiers const modifiedFields = filterSynchronizedFields( fieldsToBeSync, mesh );
+  synchronizePackSendRecvSizes( modifiedFields, mesh, neighbors, icomm, onDevice );
+  synchronizePackSendRecv( modifiedFields, mesh, neighbors, icomm, onDevice );
+
+  Timestamp const meshTimestamp = mesh.getModificationTimestamp();
+  for( auto const & iter : modifiedFields.getFields() )
+  {
+    forFieldsManagers( modifiedFields, iter.first, mesh, [&]( ObjectManagerBase & manager )
+    {
+      for( string const & fieldName : iter.second )
+      {
+        WrapperBase & wrapper = manager.getWrapperBase( fieldName );
+        if( wrapper.tracksModifications() )
+        {
+          wrapper.markSynchronized( meshTimestamp );
+        }
+      }
+    } );
+  }
+}
+
+void CommunicationTools::finalizeSynchronizeFields( MeshLevel & mesh,
+                                                    std::vector< NeighborCommunicator > & neighbors,
+                                                    MPI_iCommData & icomm,
+                                                    bool onDevice )
+{
+  GEOS_MARK_FUNCTION;
+  synchronizeUnpack( mesh, neighbors, icomm, onDevice );
+}
+
+void CommunicationTools::synchronizeFieldsPersistent( FieldIdentifiers const & fieldsToBeSync,
+                                                      MeshLevel & mesh,
+                                                      std::vector< NeighborCommunicator > & neighbors,
+                                                      bool onDevice )
+{
+  GEOS_MARK_FUNCTION;
+
+  string key = GEOS_FMT( "{}", static_cast< void const * >( &mesh ) );
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    key += "|" + iter.first + ":" + stringutilities::join( iter.second.begin(), iter.second.end(), ',' );
+  }
+
+  std::unique_ptr< PersistentSyncChannel > & channel = m_persistentSyncChannels[key];
+  if( !channel )
+  {
+    channel = std::make_unique< PersistentSyncChannel >( m_freeCommIDs );
+  }
+
+  int const commID = channel->commID;
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( neighbors.size() );
+  int const numRequests = LvArray::integerConversion< int >( neighbors.size() );
+
+  if( !channel->initialized ||
+      channel->meshTimestamp != mesh.getModificationTimestamp() ||
+      channel->sendRequests.size() != numNeighbors )
+  {
+    channel->freeRequests();
+
+    // one regular size exchange, the buffer sizes are then fixed for the lifetime of the requests
+    MPI_iCommData icomm( commID );
+    synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
+    MpiWrapper::waitAll( icomm.size(), icomm.mpiRecvBufferSizeRequest(), icomm.mpiRecvBufferSizeStatus() );
+    MpiWrapper::waitAll( icomm.size(), icomm.mpiSendBufferSizeRequest(), icomm.mpiSendBufferSizeStatus() );
+
+    channel->sendRequests.resize( numNeighbors );
+    channel->recvRequests.resize( numNeighbors );
+    channel->sendStatus.resize( numNeighbors );
+    channel->recvStatus.resize( numNeighbors );
+    for( localIndex i = 0; i < numNeighbors; ++i )
+    {
+      channel->sendRequests[i] = MPI_REQUEST_NULL;
+      channel->recvRequests[i] = MPI_REQUEST_NULL;
+      neighbors[i].mpiSendReceiveBuffersInit( commID,
+                                              channel->sendRequests[i],
+                                              channel->recvRequests[i],
+                                              MPI_COMM_GEOSX );
+    }
+    channel->meshTimestamp = mesh.getModificationTimestamp();
+    channel->initialized = true;
+  }
+
+  parallelDeviceEvents events;
+  for( NeighborCommunicator & neighbor : neighbors )
+  {
+    neighbor.packCommBufferForSync( fieldsToBeSync, mesh, commID, onDevice, events );
+  }
+  waitAllDeviceEvents( events );
+
+  MpiWrapper::startAll( numRequests, channel->recvRequests.data() );
+  MpiWrapper::startAll( numRequests, channel->sendRequests.data() );
+  for( NeighborCommunicator & neighbor : neighbors )
+  {
+    neighbor.logExchange( neighbor.sendBuffer( commID ).size(), neighbor.receiveBuffer( commID ).size() );
+  }
+
+  // persistent requests are only made inactive on completion, hence the explicit loop instead of testSome
+  std::chrono::steady_clock::time_point const waitStart = std::chrono::steady_clock::now();
+  for( localIndex count = 0; count < numNeighbors; ++count )
+  {
+    int neighborIndex = MPI_UNDEFINED;
+    MpiWrapper::waitAny( numRequests,
+                         channel->recvRequests.data(),
+                         &neighborIndex,
+                         channel->recvStatus.data() );
+    if( neighborIndex == MPI_UNDEFINED )
+    {
+      break;
+    }
+    neighbors[neighborIndex].logWaitTime( std::chrono::duration< real64 >( std::chrono::steady_clock::now() - waitStart ).count() );
+    neighbors[neighborIndex].unpackBufferForSync( fieldsToBeSync, mesh, commID, onDevice, events );
+  }
+  waitAllDeviceEvents( events );
+
+  MpiWrapper::waitAll( numRequests, channel->sendRequests.data(), channel->sendStatus.data() );
+}
+
 void CommunicationTools::synchronizeFields( FieldIdentifiers const & fieldsToBeSync,
                                             MeshLevel & mesh,
                                             std::vector< NeighborCommunicator > & neighbors,
                                             bool onDevice )
 {
   MPI_iCommData icomm( getCommID() );
-  icomm.resize( neighbors.size() );
-  synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
-  synchronizePackSendRecv( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
-  synchronizeUnpack( mesh, neighbors, icomm, onDevice );
+  beginSynchronizeFields( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
+  finalizeSynchronizeFields( mesh, neighbors, icomm, onDevice );
 }
 
 } /* namespace geos */
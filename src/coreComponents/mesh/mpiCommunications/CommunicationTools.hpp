@@ -26,6 +26,8 @@
 
 #include "mesh/FieldIdentifiers.hpp"
 
+#include <map>
+#include <memory>
 #include <set>
 
 namespace geos
@@ -36,6 +38,7 @@ class ObjectManagerBase;
 class NodeManager;
 class NeighborCommunicator;
 class MeshLevel;
+enum class GhostConnectivity : integer;
 class ElementRegionManager;
 
 class MPI_iCommData;
@@ -74,9 +77,17 @@ public:
   static void assignNewGlobalIndices( ElementRegionManager & elementManager,
                                       std::map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & newElems );
 
+  /**
+   * @brief Build the ghost layer of a mesh level and the associated communication lists.
+   * @param meshLevel the mesh level to ghost
+   * @param neighbors the neighbors to exchange with
+   * @param use_nonblocking whether the ghosts are unpacked in the order of arrival
+   * @param connectivity the connectivity through which the ghost cells are reached from the partition boundary
+   */
   void setupGhosts( MeshLevel & meshLevel,
                     std::vector< NeighborCommunicator > & neighbors,
-                    bool use_nonblocking );
+                    bool use_nonblocking,
+                    GhostConnectivity const connectivity );
 
   CommID getCommID()
   { return CommID( m_freeCommIDs ); }
@@ -94,6 +105,56 @@ public:
                           std::vector< NeighborCommunicator > & allNeighbors,
                           bool onDevice );
 
+  /**
+   * @brief Start a split-phase synchronization of @p fieldsToBeSync.
+   * @param fieldsToBeSync The fields to synchronize.
+   * @param mesh The mesh level holding the fields.
+   * @param neighbors The neighbors to exchange with.
+   * @param icomm The communication data, which must outlive the exchange.
+   * @param onDevice Whether the packing/unpacking happens on device.
+   *
+   * Sizes are exchanged, buffers are packed and the non-blocking sends/receives are posted.
+   * Ghost values of the fields are not up to date until @p finalizeSynchronizeFields is called
+   * with the same @p icomm, so the caller may overlap work that only reads locally owned values.
+   * The fields that track their modifications (see WrapperBase::setTrackModifications) and have not
+   * been modified since their last synchronization are not packed.
+   */
+  void beginSynchronizeFields( FieldIdentifiers const & fieldsToBeSync,
+                               MeshLevel & mesh,
+                               std::vector< NeighborCommunicator > & neighbors,
+                               MPI_iCommData & icomm,
+                               bool onDevice );
+
+  /**
+   * @brief Complete a synchronization started with @p beginSynchronizeFields.
+   * @param mesh The mesh level holding the fields.
+   * @param neighbors The neighbors to exchange with.
+   * @param icomm The communication data used to start the exchange.
+   * @param onDevice Whether the packing/unpacking happens on device.
+   */
+  void finalizeSynchronizeFields( MeshLevel & mesh,
+                                  std::vector< NeighborCommunicator > & neighbors,
+                                  MPI_iCommData & icomm,
+                                  bool onDevice );
+
+  /**
+   * @brief Synchronize @p fieldsToBeSync through cached persistent MPI requests.
+   * @param fieldsToBeSync The fields to synchronize.
+   * @param mesh The mesh level holding the fields.
+   * @param neighbors The neighbors to exchange with.
+   * @param onDevice Whether the packing/unpacking happens on device.
+   *
+   * The first call for a given mesh level and set of fields exchanges the buffer sizes and creates
+   * persistent send/receive requests (MPI_Send_init/MPI_Recv_init) on a dedicated CommID.
+   * Subsequent calls only pack, start the requests, and unpack. The requests are rebuilt when the
+   * modification timestamp of @p mesh changes, i.e. after a topology change.
+   * @note This is meant for exchanges repeated every time step on fields of fixed size per object.
+   */
+  void synchronizeFieldsPersistent( FieldIdentifiers const & fieldsToBeSync,
+                                    MeshLevel & mesh,
+                                    std::vector< NeighborCommunicator > & neighbors,
+                                    bool onDevice );
+
   void synchronizePackSendRecvSizes( FieldIdentifiers const & fieldsToBeSync,
                                      MeshLevel & mesh,
                                      std::vector< NeighborCommunicator > & neighbors,
@@ -138,9 +199,49 @@ public:
                        MPI_Op op=MPI_REPLACE );
 
 private:
+
+  /**
+   * @struct PersistentSyncChannel
+   * @brief Persistent requests and the CommID they are bound to, for one set of synchronized fields.
+   */
+  struct PersistentSyncChannel
+  {
+    /**
+     * @brief Constructor
+     * @param freeIDs The set of free CommIDs to take the channel id from.
+     */
+    explicit PersistentSyncChannel( std::set< int > & freeIDs ):
+      commID( freeIDs )
+    {}
+
+    /// Destructor, releasing the persistent requests
+    ~PersistentSyncChannel();
+
+    /// Release the persistent requests
+    void freeRequests();
+
+    /// The CommID reserved for the channel
+    CommID commID;
+    /// The modification timestamp of the mesh when the requests were created
+    Timestamp meshTimestamp = 0;
+    /// Whether the requests have been created
+    bool initialized = false;
+    /// The persistent send requests, one per neighbor
+    array1d< MPI_Request > sendRequests;
+    /// The persistent receive requests, one per neighbor
+    array1d< MPI_Request > recvRequests;
+    /// The statuses of the send requests
+    array1d< MPI_Status > sendStatus;
+    /// The statuses of the receive requests
+    array1d< MPI_Status > recvStatus;
+  };
+
   std::set< int > m_freeCommIDs;
   static CommunicationTools * m_instance;
 
+  /// The persistent channels, keyed on the mesh level and the synchronized fields
+  std::map< string, std::unique_ptr< PersistentSyncChannel > > m_persistentSyncChannels;
+
   /**
    * @brief Exchange the boundary objects managed by the @p manager and
    * find the objects that are equivalent in order to assign them a unique global id.
@@ -24,6 +24,8 @@
 #include "mesh/ObjectManagerBase.hpp"
 #include "mesh/MeshLevel.hpp"
 
+#include <chrono>
+
 namespace geos
 {
 
@@ -34,7 +36,11 @@ NeighborCommunicator::NeighborCommunicator( int rank ):
   m_sendBufferSize(),
   m_receiveBufferSize(),
   m_sendBuffer{ maxComm },
-  m_receiveBuffer{ maxComm }
+  m_receiveBuffer{ maxComm },
+  m_numBytesSent( 0 ),
+  m_numBytesReceived( 0 ),
+  m_numExchanges( 0 ),
+  m_waitTime( 0.0 )
 { }
 
 void NeighborCommunicator::mpiISendReceive( buffer_unit_type const * const sendBuffer,
@@ -63,6 +69,8 @@ void NeighborCommunicator::mpiISendReceive( buffer_unit_type const * const sendB
                      receiveTag,
                      mpiComm,
                      &receiveRequest );
+
+  logExchange( sendSize, receiveSize );
 }
 
 
@@ -98,6 +106,29 @@ void NeighborCommunicator::mpiISendReceiveBuffers( int const commID,
 }
 
 
+void NeighborCommunicator::mpiSendReceiveBuffersInit( int const commID,
+                                                      MPI_Request & mpiSendRequest,
+                                                      MPI_Request & mpiRecvRequest,
+                                                      MPI_Comm mpiComm )
+{
+  m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
+
+  MpiWrapper::sendInit( m_sendBuffer[commID].data(),
+                        LvArray::integerConversion< int >( m_sendBuffer[commID].size() ),
+                        m_neighborRank,
+                        CommTag( MpiWrapper::commRank(), m_neighborRank, commID ),
+                        mpiComm,
+                        &mpiSendRequest );
+
+  MpiWrapper::recvInit( m_receiveBuffer[commID].data(),
+                        LvArray::integerConversion< int >( m_receiveBuffer[commID].size() ),
+                        m_neighborRank,
+                        CommTag( m_neighborRank, MpiWrapper::commRank(), commID ),
+                        mpiComm,
+                        &mpiRecvRequest );
+}
+
+
 void NeighborCommunicator::mpiWaitAll( int const GEOS_UNUSED_PARAM( commID ),
                                        MPI_Request & mpiSendRequest,
                                        MPI_Status & mpiSendStatus,
@@ -105,7 +136,9 @@ void NeighborCommunicator::mpiWaitAll( int const GEOS_UNUSED_PARAM( commID ),
                                        MPI_Status & mpiReceiveStatus )
 
 {
+  std::chrono::steady_clock::time_point const waitStart = std::chrono::steady_clock::now();
   MpiWrapper::waitAll( 1, &mpiRecvRequest, &mpiReceiveStatus );
+  logWaitTime( std::chrono::duration< real64 >( std::chrono::steady_clock::now() - waitStart ).count() );
   MpiWrapper::waitAll( 1, &mpiSendRequest, &mpiSendStatus );
 }
 
@@ -232,6 +265,7 @@ inline int PackGhosts( buffer_unit_type * sendBufferPtr,
 
 void NeighborCommunicator::prepareAndSendGhosts( bool const GEOS_UNUSED_PARAM( contactActive ),
                                                  integer const depth,
+                                                 GhostConnectivity const connectivity,
                                                  MeshLevel & mesh,
                                                  int const commID,
                                                  MPI_Request & mpiRecvSizeRequest,
@@ -261,7 +295,9 @@ void NeighborCommunicator::prepareAndSendGhosts( bool const GEOS_UNUSED_PARAM( c
                                  edgeAdjacencyList,
                                  faceAdjacencyList,
                                  elementAdjacencyList,
-                                 depth );
+                                 depth,
+                                 connectivity,
+                                 faceManager.getNeighborData( m_neighborRank ).matchedPartitionBoundary() );
   }
 
   ElemAdjListViewType const elemAdjacencyList =
@@ -480,6 +516,95 @@ void NeighborCommunicator::unpackAndRebuildSyncLists( MeshLevel & mesh,
 }
 
 
+namespace
+{
+
+/**
+ * @brief Split the names of the fields of a key by transport precision.
+ * @param fields the fields to synchronize
+ * @param fieldNames the names of the fields of the key
+ * @param fullPrecision the names of the fields packed by their manager
+ * @param singlePrecision the names of the fields packed in single precision
+ */
+void splitByPrecision( FieldIdentifiers const & fields,
+                       array1d< string > const & fieldNames,
+                       array1d< string > & fullPrecision,
+                       array1d< string > & singlePrecision )
+{
+  for( string const & fieldName : fieldNames )
+  {
+    if( fields.isSinglePrecision( fieldName ) )
+    {
+      singlePrecision.emplace_back( fieldName );
+    }
+    else
+    {
+      fullPrecision.emplace_back( fieldName );
+    }
+  }
+}
+
+/**
+ * @brief Pack the fields transported in single precision, after the fields packed by their manager.
+ * @tparam DO_PACKING whether to pack or only compute the packed size
+ * @param buffer the buffer, advanced upon completion
+ * @param manager the manager of the fields
+ * @param fieldNames the names of the fields transported in single precision
+ * @param packList the indices to pack
+ * @param onDevice whether to use device-based packing functions
+ * @param events the events of the device packing kernels
+ * @return the packed size
+ *
+ * The number of fields and their names are packed, so that the receiver does not need to know
+ * which fields have been tagged.
+ */
+template< bool DO_PACKING >
+localIndex packSinglePrecisionFields( buffer_unit_type * & buffer,
+                                      ObjectManagerBase const & manager,
+                                      array1d< string > const & fieldNames,
+                                      arrayView1d< localIndex const > const & packList,
+                                      bool onDevice,
+                                      parallelDeviceEvents & events )
+{
+  localIndex packedSize = bufferOps::Pack< DO_PACKING >( buffer, fieldNames.size() );
+  for( string const & fieldName : fieldNames )
+  {
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, fieldName );
+    packedSize += manager.getWrapperBase( fieldName ).packByIndexSinglePrecision< DO_PACKING >( buffer, packList, onDevice, events );
+  }
+  return packedSize;
+}
+
+/**
+ * @brief Unpack the fields packed by packSinglePrecisionFields.
+ * @param buffer the buffer, advanced upon completion
+ * @param manager the manager of the fields
+ * @param unpackList the indices to unpack
+ * @param onDevice whether to use device-based packing functions
+ * @param events the events of the device unpacking kernels
+ * @param op the operation to perform while unpacking
+ * @return the unpacked size
+ */
+localIndex unpackSinglePrecisionFields( buffer_unit_type const * & buffer,
+                                        ObjectManagerBase & manager,
+                                        arrayView1d< localIndex const > const & unpackList,
+                                        bool onDevice,
+                                        parallelDeviceEvents & events,
+                                        MPI_Op op = MPI_REPLACE )
+{
+  localIndex numFields = 0;
+  localIndex unpackedSize = bufferOps::Unpack( buffer, numFields );
+  for( localIndex i = 0; i < numFields; ++i )
+  {
+    string fieldName;
+    unpackedSize += bufferOps::Unpack( buffer, fieldName );
+    unpackedSize += manager.getWrapperBase( fieldName ).unpackByIndexSinglePrecision( buffer, unpackList, onDevice, events, op );
+  }
+  return unpackedSize;
+}
+
+}
+
 int NeighborCommunicator::packCommSizeForSync( FieldIdentifiers const & fieldsToBeSync,
                                                MeshLevel const & mesh,
                                                int const commID,
@@ -498,33 +623,43 @@ int NeighborCommunicator::packCommSizeForSync( FieldIdentifiers const & fieldsTo
   arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
 
   int bufferSize = 0;
+  buffer_unit_type * dummy;
 
   for( auto const & iter : fieldsToBeSync.getFields() )
   {
+    array1d< string > fullPrecision;
+    array1d< string > singlePrecision;
+    splitByPrecision( fieldsToBeSync, iter.second, fullPrecision, singlePrecision );
+
     FieldLocation location{};
     fieldsToBeSync.getLocation( iter.first, location );
     switch( location )
     {
       case FieldLocation::Node:
       {
-        bufferSize += nodeManager.packSize( iter.second, nodeGhostsToSend, 0, onDevice, events );
+        bufferSize += nodeManager.packSize( fullPrecision, nodeGhostsToSend, 0, onDevice, events );
+        bufferSize += packSinglePrecisionFields< false >( dummy, nodeManager, singlePrecision, nodeGhostsToSend, onDevice, events );
         break;
       }
       case FieldLocation::Edge:
       {
-        bufferSize += edgeManager.packSize( iter.second, edgeGhostsToSend, 0, onDevice, events );
+        bufferSize += edgeManager.packSize( fullPrecision, edgeGhostsToSend, 0, onDevice, events );
+        bufferSize += packSinglePrecisionFields< false >( dummy, edgeManager, singlePrecision, edgeGhostsToSend, onDevice, events );
         break;
       }
       case FieldLocation::Face:
       {
-        bufferSize += faceManager.packSize( iter.second, faceGhostsToSend, 0, onDevice, events );
+        bufferSize += faceManager.packSize( fullPrecision, faceGhostsToSend, 0, onDevice, events );
+        bufferSize += packSinglePrecisionFields< false >( dummy, faceManager, singlePrecision, faceGhostsToSend, onDevice, events );
         break;
       }
       case FieldLocation::Elem:
       {
         elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
         {
-          bufferSize += subRegion.packSize( iter.second, subRegion.getNeighborData( m_neighborRank ).ghostsToSend(), 0, onDevice, events );
+          arrayView1d< localIndex const > const ghostsToSend = subRegion.getNeighborData( m_neighborRank ).ghostsToSend();
+          bufferSize += subRegion.packSize( fullPrecision, ghostsToSend, 0, onDevice, events );
+          bufferSize += packSinglePrecisionFields< false >( dummy, subRegion, singlePrecision, ghostsToSend, onDevice, events );
         } );
         break;
       }
@@ -559,30 +694,39 @@ void NeighborCommunicator::packCommBufferForSync( FieldIdentifiers const & field
 
   for( auto const & iter : fieldsToBeSync.getFields() )
   {
+    array1d< string > fullPrecision;
+    array1d< string > singlePrecision;
+    splitByPrecision( fieldsToBeSync, iter.second, fullPrecision, singlePrecision );
+
     FieldLocation location{};
     fieldsToBeSync.getLocation( iter.first, location );
     switch( location )
     {
       case FieldLocation::Node:
       {
-        packedSize += nodeManager.pack( sendBufferPtr, iter.second, nodeGhostsToSend, 0, onDevice, events );
+        packedSize += nodeManager.pack( sendBufferPtr, fullPrecision, nodeGhostsToSend, 0, onDevice, events );
+        packedSize += packSinglePrecisionFields< true >( sendBufferPtr, nodeManager, singlePrecision, nodeGhostsToSend, onDevice, events );
         break;
       }
       case FieldLocation::Edge:
       {
-        packedSize += edgeManager.pack( sendBufferPtr, iter.second, edgeGhostsToSend, 0, onDevice, events );
+        packedSize += edgeManager.pack( sendBufferPtr, fullPrecision, edgeGhostsToSend, 0, onDevice, events );
+        packedSize += packSinglePrecisionFields< true >( sendBufferPtr, edgeManager, singlePrecision, edgeGhostsToSend, onDevice, events );
         break;
       }
       case FieldLocation::Face:
       {
-        packedSize += faceManager.pack( sendBufferPtr, iter.second, faceGhostsToSend, 0, onDevice, events );
+        packedSize += faceManager.pack( sendBufferPtr, fullPrecision, faceGhostsToSend, 0, onDevice, events );
+        packedSize += packSinglePrecisionFields< true >( sendBufferPtr, faceManager, singlePrecision, faceGhostsToSend, onDevice, events );
         break;
       }
       case FieldLocation::Elem:
       {
         elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
         {
-          packedSize += subRegion.pack( sendBufferPtr, iter.second, subRegion.getNeighborData( m_neighborRank ).ghostsToSend(), 0, onDevice, events );
+          arrayView1d< localIndex const > const ghostsToSend = subRegion.getNeighborData( m_neighborRank ).ghostsToSend();
+          packedSize += subRegion.pack( sendBufferPtr, fullPrecision, ghostsToSend, 0, onDevice, events );
+          packedSize += packSinglePrecisionFields< true >( sendBufferPtr, subRegion, singlePrecision, ghostsToSend, onDevice, events );
         } );
         break;
       }
@@ -625,23 +769,28 @@ void NeighborCommunicator::unpackBufferForSync( FieldIdentifiers const & fieldsT
       case FieldLocation::Node:
       {
         unpackedSize += nodeManager.unpack( receiveBufferPtr, nodeGhostsToReceive, 0, onDevice, events, op );
+        unpackedSize += unpackSinglePrecisionFields( receiveBufferPtr, nodeManager, nodeGhostsToReceive.toViewConst(), onDevice, events, op );
         break;
       }
       case FieldLocation::Edge:
       {
         unpackedSize += edgeManager.unpack( receiveBufferPtr, edgeGhostsToReceive, 0, onDevice, events );
+        unpackedSize += unpackSinglePrecisionFields( receiveBufferPtr, edgeManager, edgeGhostsToReceive.toViewConst(), onDevice, events );
         break;
       }
       case FieldLocation::Face:
       {
         unpackedSize += faceManager.unpack( receiveBufferPtr, faceGhostsToReceive, 0, onDevice, events );
+        unpackedSize += unpackSinglePrecisionFields( receiveBufferPtr, faceManager, faceGhostsToReceive.toViewConst(), onDevice, events );
         break;
       }
       case FieldLocation::Elem:
       {
         elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
         {
-          unpackedSize += subRegion.unpack( receiveBufferPtr, subRegion.getNeighborData( m_neighborRank ).ghostsToReceive(), 0, onDevice, events );
+          array1d< localIndex > & ghostsToReceive = subRegion.getNeighborData( m_neighborRank ).ghostsToReceive();
+          unpackedSize += subRegion.unpack( receiveBufferPtr, ghostsToReceive, 0, onDevice, events );
+          unpackedSize += unpackSinglePrecisionFields( receiveBufferPtr, subRegion, ghostsToReceive.toViewConst(), onDevice, events );
         } );
         break;
       }
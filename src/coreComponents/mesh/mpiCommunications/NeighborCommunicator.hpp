@@ -35,6 +35,7 @@ inline int CommTag( int const GEOS_UNUSED_PARAM( senderRank ),
 }
 
 class MeshLevel;
+enum class GhostConnectivity : integer;
 class MPI_iCommData;
 
 class NeighborCommunicator
@@ -67,6 +68,20 @@ public:
                                MPI_Request & mpiRecvRequest,
                                MPI_Comm mpiComm );
 
+  /**
+   * @brief Create persistent send/receive requests on the buffers of @p commID.
+   * @param commID The identifier for the pseudo-comm the communication is taking place in.
+   * @param mpiSendRequest The persistent send request.
+   * @param mpiRecvRequest The persistent receive request.
+   * @param mpiComm The MPI communicator.
+   * @note The receive buffer is resized to the last received buffer size. Neither buffer may be
+   *       resized while the requests are alive, since the requests capture their addresses.
+   */
+  void mpiSendReceiveBuffersInit( int const commID,
+                                  MPI_Request & mpiSendRequest,
+                                  MPI_Request & mpiRecvRequest,
+                                  MPI_Comm mpiComm );
+
   template< typename T >
   void mpiISendReceive( T const * const sendBuffer,
                         int const sendSize,
@@ -173,9 +188,12 @@ public:
    *  information from m_neighborRank, this size recv
    *  must be completed before PostRecv is called in order
    *  to correctly resize the receive buffer.
+   *  The ghosted cells are the ones reached from the matched
+   *  partition boundary through @p connectivity.
    */
   void prepareAndSendGhosts( bool const contactActive,
                              integer const depth,
+                             GhostConnectivity const connectivity,
                              MeshLevel & mesh,
                              int const commID,
                              MPI_Request & mpiRecvSizeRequest,
@@ -283,6 +301,45 @@ public:
 
   void addNeighborGroupToMesh( MeshLevel & mesh ) const;
 
+  /**
+   * @brief Record the sizes of a message exchange with the neighbor in the communication statistics
+   * @param numBytesSent number of bytes sent to the neighbor
+   * @param numBytesReceived number of bytes received from the neighbor
+   */
+  void logExchange( std::size_t const numBytesSent, std::size_t const numBytesReceived )
+  {
+    m_numBytesSent += numBytesSent;
+    m_numBytesReceived += numBytesReceived;
+    ++m_numExchanges;
+  }
+
+  /**
+   * @brief Record the time spent waiting for a message of the neighbor in the communication statistics
+   * @param waitTime the wait time, in seconds
+   */
+  void logWaitTime( real64 const waitTime ) { m_waitTime += waitTime; }
+
+  /// @return the number of bytes sent to the neighbor since the last reset of the statistics
+  std::size_t numBytesSent() const { return m_numBytesSent; }
+
+  /// @return the number of bytes received from the neighbor since the last reset of the statistics
+  std::size_t numBytesReceived() const { return m_numBytesReceived; }
+
+  /// @return the number of exchanges with the neighbor since the last reset of the statistics
+  std::size_t numExchanges() const { return m_numExchanges; }
+
+  /// @return the time spent waiting for the messages of the neighbor since the last reset of the statistics, in seconds
+  real64 waitTime() const { return m_waitTime; }
+
+  /// Reset the communication statistics
+  void resetStatistics()
+  {
+    m_numBytesSent = 0;
+    m_numBytesReceived = 0;
+    m_numExchanges = 0;
+    m_waitTime = 0.0;
+  }
+
 private:
 
   int m_neighborRank;
@@ -293,6 +350,11 @@ private:
   std::vector< buffer_type > m_sendBuffer;
   std::vector< buffer_type > m_receiveBuffer;
 
+  std::size_t m_numBytesSent;
+  std::size_t m_numBytesReceived;
+  std::size_t m_numExchanges;
+  real64 m_waitTime;
+
 };
 
 template< typename T >
@@ -17,7 +17,9 @@
 #include "LvArray/src/genericTensorOps.hpp"
 #include "mesh/mpiCommunications/MPI_iCommData.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <unordered_map>
 
 namespace geos
 {
@@ -109,7 +111,8 @@ int SpatialPartition::getColor()
 
 void SpatialPartition::addNeighbors( const unsigned int idim,
                                      MPI_Comm & cartcomm,
-                                     int * ncoords )
+                                     int * ncoords,
+                                     int * noffsets )
 {
 
   if( idim == nsdof )
@@ -127,6 +130,7 @@ void SpatialPartition::addNeighbors( const unsigned int idim,
     {
       int const rank = MpiWrapper::cartRank( cartcomm, ncoords );
       m_neighbors.push_back( NeighborCommunicator( rank ) );
+      m_neighborOffsets.push_back( { noffsets[0], noffsets[1], noffsets[2] } );
     }
   }
   else
@@ -136,6 +140,7 @@ void SpatialPartition::addNeighbors( const unsigned int idim,
     for( int i = -1; i < 2; i++ )
     {
       ncoords[idim] = this->m_coords( LvArray::integerConversion< localIndex >( idim ) ) + i;
+      noffsets[idim] = i;
       bool ok = true;
       if( periodic )
       {
@@ -150,7 +155,7 @@ void SpatialPartition::addNeighbors( const unsigned int idim,
       }
       if( ok )
       {
-        addNeighbors( idim + 1, cartcomm, ncoords );
+        addNeighbors( idim + 1, cartcomm, ncoords, noffsets );
       }
     }
   }
@@ -204,8 +209,10 @@ void SpatialPartition::setSizes( real64 const ( &min )[ 3 ],
     //add neighbors
     {
       int ncoords[nsdof];
+      int noffsets[nsdof];
       m_neighbors.clear();
-      addNeighbors( 0, cartcomm, ncoords );
+      m_neighborOffsets.clear();
+      addNeighbors( 0, cartcomm, ncoords, noffsets );
     }
 
     MpiWrapper::commFree( cartcomm );
@@ -327,196 +334,106 @@ void SpatialPartition::setContactGhostRange( const real64 bufferSize )
   LvArray::tensorOps::addScalar< 3 >( m_contactGhostMax, bufferSize );
 }
 
+
+real64 SpatialPartition::getClosestPeriodicImage( real64 const coord, int const dir ) const
+{
+  if( !m_Periodic( dir ) )
+  {
+    return coord;
+  }
+  real64 const center = 0.5 * ( m_min[ dir ] + m_max[ dir ] );
+  return MapValueToRange( coord, center - 0.5 * m_gridSize[ dir ], center + 0.5 * m_gridSize[ dir ] );
+}
+
+int SpatialPartition::getNeighborOffset( real64 const coord, int const dir ) const
+{
+  if( m_Partitions( dir ) == 1 )
+  {
+    return 0;
+  }
+  real64 const x = getClosestPeriodicImage( coord, dir );
+  if( x < m_min[ dir ] )
+  {
+    return -1;
+  }
+  return x >= m_max[ dir ] ? 1 : 0;
+}
+
 void SpatialPartition::repartitionMasterParticles( ParticleSubRegion & subRegion,
                                                    MPI_iCommData & commData )
 {
 
   /*
    * Search for any particles owned by this partition, which are no longer in the
-   * partition domain.  Send a copy of these particles to their new partition, but
-   * keep them as ghosts on the current partition.
+   * partition domain, and send them to their new partition.
    *
-   * This assumes that particles have already been partitioned consistent with the background
-   * grid, but does not assume any specific partition topology, only that the neighbor list
-   * is complete, and each partition can evaluate its own isCoordinateInPartition() function.
-   *
-   * After this function, each particle should be in its correct partition, and the
-   * Rank of particles that were moved from the current partition will be correct,
-   * but the master-ghost map in the neighbor list still needs to updated.  Particles that
-   * were ghosts of an object that has been repartitioned will need to have their ghost
-   * rank updated, and may need to be deleted/added elsewhere.
+   * A particle cannot move by more than one partition per step, so its new partition is the
+   * neighbor lying on the same side of the partition domain as the particle in each direction,
+   * and the sender can pick it without asking the neighbors, in a single exchange per neighbor.
    *
+   * After this function, each particle should be in its correct partition, and the ghosts
+   * have been removed. They are recreated by getGhostParticlesFromNeighboringPartitions.
    */
 
   // (1) Identify any particles that are master on the current partition, but whose center lies
-  // outside of the partition domain.  Rank() for particles is defined such that it always
-  // equals the rank of the owning process. Thus a particle is master iff Rank==partition.rank
-  //
-  // Temporarily set the ghost rank of any particle to be moved to "-1".  If the particle is
-  // requested by another partition, its ghost rank will be updated.  Any particle that still
-  // has a Rank=-1 at the end of this function is lost and needs to be deleted.  This
-  // should only happen if it has left the global domain (hopefully at an outflow b.c.).
-
-  arrayView2d< real64 > const particleCenter = subRegion.getParticleCenter();
-  arrayView1d< localIndex > const particleRank = subRegion.getParticleRank();
-  array1d< R1Tensor > outOfDomainParticleCoordinates;
-  std::vector< localIndex > outOfDomainParticleLocalIndices;
-  unsigned int nn = m_neighbors.size();   // Number of partition neighbors.
-
-  forAll< serialPolicy >( subRegion.size(), [&, particleCenter, particleRank] GEOS_HOST ( localIndex const pp )
+  //     outside of the partition domain, and give them to the neighbor on the side they left by.
+  //     Particles with no such neighbor have left the global domain (hopefully at an outflow b.c.),
+  //     are given a rank of -1 and are deleted.
+
+  arrayView2d< real64 const > const particleCenter = subRegion.getParticleCenter();
+  arrayView1d< int > const particleRank = subRegion.getParticleRank();
+  size_t const nn = m_neighbors.size();   // Number of partition neighbors.
+  std::vector< array1d< localIndex > > particlesSentToNeighbors( nn );
+
+  forAll< serialPolicy >( subRegion.size(), [&, particleCenter, particleRank] GEOS_HOST ( localIndex const p )
     {
-      bool inPartition = true;
-      R1Tensor p_x;
-      for( int i=0; i<3; i++ )
-      {
-        p_x[i] = particleCenter[pp][i];
-        inPartition = inPartition && isCoordInPartition( p_x[i], i );
-      }
-      if( particleRank[pp]==this->m_rank && !inPartition )
+      if( particleRank[p] != m_rank )
       {
-        outOfDomainParticleCoordinates.emplace_back( p_x ); // Store the coordinate of the out-of-domain particle
-        outOfDomainParticleLocalIndices.push_back( pp );   // Store the local index "pp" for the current coordinate.
-        particleRank[pp] = -1;                             // Temporarily set particleRank of out-of-domain particle to -1 until it is
-                                                           // requested by someone.
+        return;
       }
-    } );
-
-
-  // (2) Pack the list of particle center coordinates to each neighbor, and send/receive the list to neighbors.
-
-  std::vector< array1d< R1Tensor > > particleCoordinatesReceivedFromNeighbors( nn );
-
-  sendCoordinateListToNeighbors( outOfDomainParticleCoordinates.toView(),       // input: Single list of coordinates sent to all neighbors
-                                 commData,                                      // input: Solver MPI communicator
-                                 particleCoordinatesReceivedFromNeighbors );    // output: List of lists of coordinates received from each
-                                                                                // neighbor.
 
-
-
-  // (3) check the received lists for particles that are in the domain of the
-  //     current partition.  make a list of the locations in the coordinate list
-  //     of the particles that are to be owned by the current partition.
-
-  std::vector< array1d< localIndex > > particleListIndicesRequestingFromNeighbors( nn );
-  for( size_t n=0; n<nn; n++ )
-  {
-    // Loop through the unpacked list and make a list of the index of any point in partition interior domain
-    for( int pp=0; pp<particleCoordinatesReceivedFromNeighbors[n].toView().size(); pp++ )
-    {
+      std::array< int, nsdof > offset;
       bool inPartition = true;
-      for( int j=0; j<3; j++ )
+      for( int i=0; i<nsdof; i++ )
       {
-        inPartition = inPartition && isCoordInPartition( particleCoordinatesReceivedFromNeighbors[n].toView()[pp][j], j );
+        offset[i] = getNeighborOffset( particleCenter[p][i], i );
+        inPartition = inPartition && offset[i] == 0;
       }
       if( inPartition )
       {
-        // Request particle to be transferred, and take ownership
-        particleListIndicesRequestingFromNeighbors[n].emplace_back( pp );
+        return;
       }
-    }
-  }
-
-
-  // (4) Pack and send/receive list of requested indices to each neighbor.  These are the indices
-  //     in the list of coordinates, not the LocalIndices on the sending processor. Unpack it
-  //     and store the request list.
-
-  std::vector< array1d< localIndex > > particleListIndicesRequestedFromNeighbors( nn );
-
-  sendListOfIndicesToNeighbors< localIndex >( particleListIndicesRequestingFromNeighbors,
-                                              commData,
-                                              particleListIndicesRequestedFromNeighbors );
-
-
-  // (5) Update the ghost rank of the out-of-domain particles to be equal to the rank
-  //     of the partition requesting to own the particle.
-
-  std::vector< array1d< localIndex > > particleLocalIndicesRequestedFromNeighbors( nn );
-  {
-    unsigned int numberOfRequestedParticles = 0;
-    std::vector< int > outOfDomainParticleRequests( outOfDomainParticleLocalIndices.size(), 0 );
-
-    for( size_t n=0; n<nn; n++ )
-    {
-      int ni = particleListIndicesRequestedFromNeighbors[n].size();
-      numberOfRequestedParticles += ni;
 
-      // The corresponding local index for each item in the request list is stored here:
-      particleLocalIndicesRequestedFromNeighbors[n].resize( ni );
-
-      forAll< serialPolicy >( ni, [&, particleRank] GEOS_HOST ( localIndex const k )
+      particleRank[p] = -1;
+      for( size_t n=0; n<nn; n++ )
+      {
+        if( m_neighborOffsets[n] == offset )
         {
-          int const i = particleListIndicesRequestedFromNeighbors[n][k];
-          outOfDomainParticleRequests[i] += 1;
-          localIndex pp = outOfDomainParticleLocalIndices[i];
-
-          particleLocalIndicesRequestedFromNeighbors[n][k] = pp;
-          // Set ghost rank of the particle equal to neighbor rank.
-          particleRank[pp] = m_neighbors[n].neighborRank();
-        } );
-    }
-
-    // Check that there is exactly one processor requesting each out-of-domain particle.
-    if( numberOfRequestedParticles != outOfDomainParticleLocalIndices.size())
-    {
-      std::cout << "Rank " << m_rank << " has requests for " << numberOfRequestedParticles << " out of " << outOfDomainParticleLocalIndices.size() << " out-of-domain particles" << std::endl;
-    }
-    for( size_t i=0; i<outOfDomainParticleRequests.size(); i++ )
-    {
-      if( outOfDomainParticleRequests[i] != 1 )
+          particlesSentToNeighbors[n].emplace_back( p );
+          particleRank[p] = m_neighbors[n].neighborRank();
+          break;
+        }
+      }
+      if( particleRank[p] == -1 )
       {
-        std::cout << "Rank " << m_rank << " particle as " << outOfDomainParticleRequests[i] << " != 1 requests!" << std::endl;
+        GEOS_LOG_RANK( "Deleting orphan out-of-domain particle during repartition at p_x = " << particleCenter[p] );
       }
-    }
-  }
-
-
-  // (5.1) Resize particle subRegion to accommodate incoming particles.
-  //       Keep track of the starting indices and number of particles coming from each neighbor.
-
-  int oldSize = subRegion.size();
-  int newSize = subRegion.size();
-  std::vector< int > newParticleStartingIndices( nn );
-  std::vector< int > numberOfIncomingParticles( nn );
-  for( size_t n=0; n<nn; n++ )
-  {
-    numberOfIncomingParticles[n] = particleListIndicesRequestingFromNeighbors[n].size();
-    newParticleStartingIndices[n] = newSize;
-    newSize += numberOfIncomingParticles[n];
-  }
-  if( newSize > oldSize )
-  {
-    subRegion.resize( newSize ); // TODO: Does this handle constitutive fields owned by the subRegion?
-  }
+    } );
 
 
-  // (6) Pack a buffer for the particles to be sent to each neighbor, and send/receive
+  // (2) Send the particles to their new partition, and receive the particles entering the partition.
+  //     A received particle that was a ghost on the current partition takes the place of the ghost.
 
-  //int sizeBeforeParticleSend = subRegion.size(); // subregion size changes after this, so we need this here to use to size the deletion
-  // loop
-  sendParticlesToNeighbor( subRegion,
-                           newParticleStartingIndices,
-                           numberOfIncomingParticles,
-                           commData,
-                           particleLocalIndicesRequestedFromNeighbors );
+  exchangeParticlesWithNeighbors( subRegion, particlesSentToNeighbors, commData );
 
 
-  // (7) Delete any out-of-domain particles that were not requested by a neighbor.  These particles
-  //     will still have Rank=-1. This should only happen if the particle has left the global domain.
-  //     which will hopefully only occur at outflow boundary conditions.  If it happens for a particle in
-  //     the global domain, print a warning.
+  // (3) Delete the particles that left the partition and the ghosts, in place.
 
-  arrayView2d< real64 > const particleCenterAfter = subRegion.getParticleCenter();
-  arrayView1d< int > const particleRankAfter = subRegion.getParticleRank();
+  arrayView1d< int const > const particleRankAfter = subRegion.getParticleRank();
   std::set< localIndex > indicesToErase;
-  forAll< serialPolicy >( subRegion.size(), [&, particleRankAfter, particleCenterAfter] GEOS_HOST ( localIndex const p )
+  forAll< serialPolicy >( subRegion.size(), [&, particleRankAfter] GEOS_HOST ( localIndex const p )
     {
-      if( particleRankAfter[p] == -1 )
-      {
-        GEOS_LOG_RANK( "Deleting orphan out-of-domain particle during repartition at p_x = " << particleCenterAfter[p] );
-        indicesToErase.insert( p );
-      }
-      else if( particleRankAfter[p] != m_rank )
+      if( particleRankAfter[p] != m_rank )
       {
         indicesToErase.insert( p );
       }
@@ -536,13 +453,11 @@ void SpatialPartition::getGhostParticlesFromNeighboringPartitions( DomainPartiti
 {
 
   /*
-   * Make a list of the coordinates and global IDs of all non-ghost objects on the current
-   * partition.  These should all be interior to the partition domain (excluding the ghost
-   * region).  Send this list to each neighbor.  Have each neighbor check the list for
-   * objects within its bounding box (including ghost radius) that do not already exist
-   * on the processor.  Send a request list for those objects.  Mark all ghost objects as
-   * potentially abandoned.
-   *
+   * Send each non-ghost object of the current partition to the neighbors whose bounding box
+   * (including ghost radius) contains it. Since the objects are interior to the partition domain,
+   * these are the neighbors on the sides of the partition the object is within the ghost radius of,
+   * so that the sender picks them without asking the neighbors, in a single exchange per neighbor.
+   * Mark all ghost objects as potentially abandoned beforehand.
    */
 
   // MPM-specific code where we assume there are 2 mesh bodies and only one of them has particles
@@ -554,119 +469,55 @@ void SpatialPartition::getGhostParticlesFromNeighboringPartitions( DomainPartiti
 
   particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
   {
-    // (1) Identify any particles that are master on the current partition, but whose center lies
-    // outside of the partition domain.  Rank() for particles is defined such that it always
-    // equals the rank of the owning process. Thus a particle is master iff Rank==partition.rank
-    //
-    // Temporarily set the ghost rank of any particle to be moved to "-1".  If the particle is
-    // requested by another partition, its ghost rank will be updated.  Any particle that still
-    // has a Rank=-1 at the end of this function is lost and needs to be deleted.  This
-    // should only happen if it has left the global domain (hopefully at an outflow b.c.).
-
-    arrayView2d< real64 > const particleCenter = subRegion.getParticleCenter();
-    arrayView1d< localIndex > const particleRank = subRegion.getParticleRank();
-    arrayView1d< globalIndex > const particleGlobalID = subRegion.getParticleID();
-    array1d< R1Tensor > inDomainMasterParticleCoordinates;   // Theoretically the same as particle position evaluated at
-                                                             // subRegion.nonGhostIndices()?
-    std::vector< globalIndex > inDomainMasterParticleGlobalIndices;
-    unsigned int nn = m_neighbors.size();   // Number of partition neighbors.
-
-    forAll< serialPolicy >( subRegion.size(), [&, particleCenter, particleRank, particleGlobalID] GEOS_HOST ( localIndex const p )
+    // (1) Identify the neighbors each in-domain master particle should be a ghost on. Along a direction
+    //     with a single partition, the neighbors with a non-zero offset are periodic images of the
+    //     neighbors with a zero offset, and are skipped.
+
+    arrayView2d< real64 const > const particleCenter = subRegion.getParticleCenter();
+    arrayView1d< int > const particleRank = subRegion.getParticleRank();
+    size_t const nn = m_neighbors.size();   // Number of partition neighbors.
+    std::vector< array1d< localIndex > > particlesSentToNeighbors( nn );
+
+    forAll< serialPolicy >( subRegion.size(), [&, particleCenter, particleRank] GEOS_HOST ( localIndex const p )
       {
+        if( particleRank[p] != m_rank )
+        {
+          return;
+        }
+
+        real64 p_x[nsdof];
         bool inPartition = true;
-        R1Tensor p_x;
-        for( int i=0; i<3; i++ )
+        for( int i=0; i<nsdof; i++ )
         {
-          p_x[i] = particleCenter[p][i];
-          inPartition = inPartition && isCoordInPartition( p_x[i], i );
+          p_x[i] = getClosestPeriodicImage( particleCenter[p][i], i );
+          inPartition = inPartition && isCoordInPartition( particleCenter[p][i], i );
         }
-        if( particleRank[p]==this->m_rank && inPartition )
+        if( !inPartition )
         {
-          inDomainMasterParticleCoordinates.emplace_back( p_x );  // Store the coordinate of the out-of-domain particle
-          inDomainMasterParticleGlobalIndices.push_back( particleGlobalID[p] );     // Store the local index "pp" for the current
-                                                                                    // coordinate.
+          return;
         }
-      } );
-
-
-    // (2) Pack the list of particle center coordinates to each neighbor, and send/receive the list to neighbors.
-
-    std::vector< array1d< R1Tensor > > particleCoordinatesReceivedFromNeighbors( nn );
-
-    sendCoordinateListToNeighbors( inDomainMasterParticleCoordinates.toView(),          // input: Single list of coordinates sent to all
-                                                                                        // neighbors
-                                   commData,                                      // input: Solver MPI communicator
-                                   particleCoordinatesReceivedFromNeighbors    // output: List of lists of coordinates received from each
-                                                                               // neighbor.
-                                   );
-
 
-    // (3) Pack the list of particle global indices to each neighbor, and send the list to neighbors.
-
-    std::vector< array1d< globalIndex > > particleGlobalIndicesSendingToNeighbors( nn );
-    std::vector< array1d< globalIndex > > particleGlobalIndicesReceivedFromNeighbors( nn );
-
-    for( size_t n=0; n<nn; ++n )
-    {
-      particleGlobalIndicesSendingToNeighbors[n].resize( inDomainMasterParticleGlobalIndices.size() );
-      for( size_t i=0; i<inDomainMasterParticleGlobalIndices.size(); ++i )
-      {
-        particleGlobalIndicesSendingToNeighbors[n][i] = inDomainMasterParticleGlobalIndices[i];
-      }
-    }
-    sendListOfIndicesToNeighbors< globalIndex >( particleGlobalIndicesSendingToNeighbors,
-                                                 commData,
-                                                 particleGlobalIndicesReceivedFromNeighbors );
-
-
-    // (4) Look through the received coordinates and make a list of the particles that are within
-    //     the bounding box (including ghost region) and for which the globalID does not already
-    //     exist on the current partition.  Make a request list of the index (order in the list)
-    //     of the particle.  This will be sent from the master as a new ghost on the current
-    //     partition.
-
-    std::vector< array1d< globalIndex > > particleGlobalIndicesRequestingFromNeighbors( nn );
-
-    for( size_t n=0; n<nn; ++n )
-    {
-      for( localIndex i=0; i<particleCoordinatesReceivedFromNeighbors[n].size(); ++i )
-      {
-        if( isCoordInPartitionBoundingBox( particleCoordinatesReceivedFromNeighbors[n][i], boundaryRadius ) )
+        for( size_t n=0; n<nn; n++ )
         {
-          globalIndex gI = particleGlobalIndicesReceivedFromNeighbors[n][i];
-
-          // This particle should be a ghost on the current processor. See if it already exists here.
-          bool alreadyHere = false;
-          forAll< serialPolicy >( subRegion.size(), [&, particleGlobalID, particleRank] GEOS_HOST ( localIndex const p )
+          bool isGhost = true;
+          for( int i=0; i<nsdof && isGhost; i++ )
+          {
+            int const offset = m_neighborOffsets[n][i];
+            if( offset != 0 )
             {
-              if( gI == particleGlobalID[p] )
-              {
-                // The particle already exists as a ghost on this partition, so we should update its rank.
-                particleRank[p] = m_neighbors[n].neighborRank();
-                alreadyHere = true;
-              }
-            } );
-          if( !alreadyHere )
+              isGhost = m_Partitions( i ) > 1 &&
+                        ( offset > 0 ? p_x[i] >= m_max[i] - boundaryRadius : p_x[i] <= m_min[i] + boundaryRadius );
+            }
+          }
+          if( isGhost )
           {
-            // The global index is not represented on this partition, so we should add the particle.
-            particleGlobalIndicesRequestingFromNeighbors[n].emplace_back( gI );
+            particlesSentToNeighbors[n].emplace_back( p );
           }
         }
-      }
-    }
-
-
-    // (5) Pack and send request list of Global Indices to each neighbor, receive and unpack
-    //     this into a list requested from each neighbor.
-
-    std::vector< array1d< globalIndex > > particleGlobalIndicesRequestedFromNeighbors( nn );
-
-    sendListOfIndicesToNeighbors< globalIndex >( particleGlobalIndicesRequestingFromNeighbors,
-                                                 commData,
-                                                 particleGlobalIndicesRequestedFromNeighbors );
+      } );
 
 
-    // (6) Temporarily set the ghost rank of all ghosts to "-1".  After ghosts are unpacked from the
+    // (2) Temporarily set the ghost rank of all ghosts to "-1".  After ghosts are unpacked from the
     //     masters, the ghost rank will be overwritten.  At the end of this function, any ghosts that
     //     still have ghostRank=-1 are orphans and need to be deleted.
 
@@ -680,49 +531,12 @@ void SpatialPartition::getGhostParticlesFromNeighboringPartitions( DomainPartiti
       } );
 
 
-    // (6.1) Resize particle subRegion to accommodate incoming particles.
-    //       Keep track of the starting indices and number of particles coming from each neighbor.
-
-    int oldSize = subRegion.size();
-    int newSize = subRegion.size();
-    std::vector< int > newParticleStartingIndices( nn );
-    std::vector< int > numberOfIncomingParticles( nn );
-    for( size_t n=0; n<nn; n++ )
-    {
-      numberOfIncomingParticles[n] = particleGlobalIndicesRequestingFromNeighbors[n].size();
-      newParticleStartingIndices[n] = newSize;
-      newSize += numberOfIncomingParticles[n];
-    }
-    if( newSize > oldSize )
-    {
-      subRegion.resize( newSize );   // TODO: Does this handle constitutive fields owned by the subregion's parent region?
-    }
-
+    // (3) Send/receive the particles, which will refresh the existing ghosts and add the missing ones.
 
-    // (7) Pack/Send/Receive/Unpack particles to be sent to each neighbor.
+    exchangeParticlesWithNeighbors( subRegion, particlesSentToNeighbors, commData );
 
-    {
-      std::vector< array1d< localIndex > > particleLocalIndicesRequestedFromNeighbors( nn );
 
-      for( size_t n=0; n<nn; n++ )
-      {
-        // make a list of the local indices corresponding to the global indices in the request list for the current neighbor.
-        particleLocalIndicesRequestedFromNeighbors[n].resize( particleGlobalIndicesRequestedFromNeighbors[n].size() );
-        for( localIndex i=0; i<particleLocalIndicesRequestedFromNeighbors[n].size(); ++i )
-        {
-          particleLocalIndicesRequestedFromNeighbors[n][i] = subRegion.globalToLocalMap( particleGlobalIndicesRequestedFromNeighbors[n][i] );
-        }
-      }
-      // Send/receive the particles, which will add missing ghosts on the partition.
-      sendParticlesToNeighbor( subRegion,
-                               newParticleStartingIndices,
-                               numberOfIncomingParticles,
-                               commData,
-                               particleLocalIndicesRequestedFromNeighbors );
-    }
-
-
-    // (8) Delete any particles that have ghostRank=-1.  These will be ghosts from
+    // (4) Delete any particles that have ghostRank=-1.  These will be ghosts from
     //     a previous step for which the master is no longer in the ghost domain,
     // std::set< localIndex > indicesToErase;
     // arrayView1d< localIndex > const particleRankNew = subRegion.getParticleRank();
@@ -738,292 +552,120 @@ void SpatialPartition::getGhostParticlesFromNeighboringPartitions( DomainPartiti
   } );
 }
 
-/**
- * @brief Send coordinates to neighbors as part of repartition.
- * @param[in] particleCoordinatesSendingToNeighbors Single list of coordinates sent to all neighbors
- * @param[in] commData Solver's MPI communicator
- * @param[in] particleCoordinatesReceivedFromNeighbors List of lists of coordinates received from each neighbor
- */
-void SpatialPartition::sendCoordinateListToNeighbors( arrayView1d< R1Tensor > const & particleCoordinatesSendingToNeighbors,
-                                                      MPI_iCommData & commData,
-                                                      std::vector< array1d< R1Tensor > > & particleCoordinatesReceivedFromNeighbors
-                                                      )
+void SpatialPartition::exchangeParticlesWithNeighbors( ParticleSubRegion & subRegion,
+                                                       std::vector< array1d< localIndex > > const & particlesSentToNeighbors,
+                                                       MPI_iCommData & commData )
 {
-  // Number of neighboring partitions
-  unsigned int nn = m_neighbors.size();
-
-  // The send buffer is identical for each neighbor, and contains the packed coordinate list.
-  unsigned int sizeToBePacked = 0;                                                        // size of the outgoing data with packing=false
-                                                                                          // (we need to run through it first without
-                                                                                          // packing so we can size the buffer)
-  unsigned int sizeOfPacked = 0;                                                          // size of the outgoing data with packing=true
-  buffer_unit_type * junk;                                                                // junk buffer, stores nothing since we're just
-                                                                                          // getting the buffer size on the first pass
-  sizeToBePacked += bufferOps::Pack< false >( junk,
-                                              particleCoordinatesSendingToNeighbors );    // get the size of the coordinate list
-  buffer_type sendBuffer( sizeToBePacked );                                               // the actual sized buffer that we pack into
-  buffer_unit_type * sendBufferPtr = sendBuffer.data();                                   // get a pointer to the buffer
-  sizeOfPacked += bufferOps::Pack< true >( sendBufferPtr,
-                                           particleCoordinatesSendingToNeighbors );       // pack the coordinate list into the buffer
-  GEOS_ERROR_IF_NE( sizeToBePacked, sizeOfPacked );                                       // make sure the packer is self-consistent
-
-  // Declare the receive buffers
-  std::vector< unsigned int > sizeOfReceived( nn );
-  std::vector< buffer_type > receiveBuffer( nn );
-
-  // send the coordinate list to each neighbor.  Using an asynchronous send,
-  // the mpi request will be different for each send, but the buffer is the same
+  // A rank can appear several times in m_neighbors with periodic boundaries, and
+  // is sent a single message holding the particles of all its entries.
+  std::vector< int > neighborRanks;
+  std::vector< std::vector< localIndex > > sendLists;
+  for( size_t n=0; n<m_neighbors.size(); n++ )
   {
-    array1d< MPI_Request > sendRequest( nn );
-    array1d< MPI_Status >  sendStatus( nn );
-    array1d< MPI_Request > receiveRequest( nn );
-    array1d< MPI_Status >  receiveStatus( nn );
-
-    // Send/receive the size of the packed buffer
-    for( size_t n=0; n<nn; n++ )
+    int const neighborRank = m_neighbors[n].neighborRank();
+    size_t const k = std::find( neighborRanks.begin(), neighborRanks.end(), neighborRank ) - neighborRanks.begin();
+    if( k == neighborRanks.size() )
     {
-      // Initialize to null
-      sendRequest[n] = MPI_REQUEST_NULL;
-      receiveRequest[n] = MPI_REQUEST_NULL;
-
-      // Perform comms
-      m_neighbors[n].mpiISendReceive( &sizeOfPacked,
-                                      1,
-                                      sendRequest[n],
-                                      &(sizeOfReceived[n]),
-                                      1,
-                                      receiveRequest[n],
-                                      commData.commID(),
-                                      MPI_COMM_GEOSX );
+      neighborRanks.push_back( neighborRank );
+      sendLists.emplace_back();
     }
-    MPI_Waitall( nn, sendRequest.data(), sendStatus.data());
-    MPI_Waitall( nn, receiveRequest.data(), receiveStatus.data());
+    sendLists[k].insert( sendLists[k].end(), particlesSentToNeighbors[n].begin(), particlesSentToNeighbors[n].end() );
   }
+  size_t const nr = neighborRanks.size();
 
-  // Send/receive the buffer containing the list of coordinates
+  // Pack the global indices and all the fields of the particles sent to each neighbor
+  arrayView1d< globalIndex const > const particleID = subRegion.getParticleID();
+  parallelDeviceEvents events;
+  std::vector< buffer_type > sendBuffer( nr );
+  for( size_t k=0; k<nr; k++ )
   {
-    array1d< MPI_Request > sendRequest( nn );
-    array1d< MPI_Status >  sendStatus( nn );
-    array1d< MPI_Request > receiveRequest( nn );
-    array1d< MPI_Status >  receiveStatus( nn );
+    std::sort( sendLists[k].begin(), sendLists[k].end() );
+    sendLists[k].erase( std::unique( sendLists[k].begin(), sendLists[k].end() ), sendLists[k].end() );
 
-    for( size_t n=0; n<nn; n++ )
+    array1d< localIndex > sendList( LvArray::integerConversion< localIndex >( sendLists[k].size() ) );
+    array1d< globalIndex > sendGlobalIndices( sendList.size() );
+    for( localIndex i=0; i<sendList.size(); i++ )
     {
-      // Initialize to null
-      sendRequest[n] = MPI_REQUEST_NULL;
-      receiveRequest[n] = MPI_REQUEST_NULL;
-
-      // Perform comms
-      receiveBuffer[n].resize( sizeOfReceived[n] );
-      m_neighbors[n].mpiISendReceive( sendBuffer.data(),   // TODO: This can't be sendBufferPtr, why not? I guess cuz sendBufferPtr gets
-                                                           // incremented (moved) during packing.
-                                      sizeOfPacked,
-                                      sendRequest[n],
-                                      receiveBuffer[n].data(),
-                                      sizeOfReceived[n],
-                                      receiveRequest[n],
-                                      commData.commID(),
-                                      MPI_COMM_GEOSX );
+      sendList[i] = sendLists[k][i];
+      sendGlobalIndices[i] = particleID[sendList[i]];
     }
-    MPI_Waitall( nn, sendRequest.data(), sendStatus.data());
-    MPI_Waitall( nn, receiveRequest.data(), receiveStatus.data());
-  }
 
-  // Unpack the received coordinate list from each neighbor
-  for( size_t n=0; n<nn; n++ )
-  {
-    // Unpack the buffer to an array of coordinates.
-    const buffer_unit_type * receiveBufferPtr = receiveBuffer[n].data();  // needed for const cast
-    bufferOps::Unpack( receiveBufferPtr, particleCoordinatesReceivedFromNeighbors[n] );
+    buffer_unit_type * junk;
+    localIndex const sizeToBePacked = bufferOps::Pack< false >( junk, sendGlobalIndices ) +
+                                      subRegion.packSize( sendList.toViewConst(), 0, false, events );
+    sendBuffer[k].resize( sizeToBePacked );
+    buffer_unit_type * sendBufferPtr = sendBuffer[k].data();
+    localIndex sizeOfPacked = bufferOps::Pack< true >( sendBufferPtr, sendGlobalIndices );
+    sizeOfPacked += subRegion.pack( sendBufferPtr, sendList.toViewConst(), 0, false, events );
+    GEOS_ERROR_IF_NE( sizeToBePacked, sizeOfPacked );
   }
-}
-
-template< typename indexType >
-void SpatialPartition::sendListOfIndicesToNeighbors( std::vector< array1d< indexType > > & listSendingToEachNeighbor,
-                                                     MPI_iCommData & commData,
-                                                     std::vector< array1d< indexType > > & listReceivedFromEachNeighbor )
-{
-  // Number of neighboring partitions
-  unsigned int nn = m_neighbors.size();
 
-  // Pack the outgoing lists of local indices
-  std::vector< unsigned int > sizeOfPacked( nn );
-  std::vector< buffer_type > sendBuffer( nn );
-  for( size_t n=0; n<nn; n++ )
+  // Send the size and the buffer together, and post the receive of each buffer as soon as its size arrives.
+  // Both messages use the same tag, and MPI delivers them in order.
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const tag = CommTag( rank, rank, commData.commID() );
+  std::vector< int > sizeOfPacked( nr );
+  std::vector< int > sizeOfReceived( nr );
+  std::vector< buffer_type > receiveBuffer( nr );
+  array1d< MPI_Request > sendRequest( 2 * nr );
+  array1d< MPI_Status >  sendStatus( 2 * nr );
+  array1d< MPI_Request > sizeRequest( nr );
+  array1d< MPI_Status >  sizeStatus( nr );
+  array1d< MPI_Request > receiveRequest( nr );
+  array1d< MPI_Status >  receiveStatus( nr );
+  for( size_t k=0; k<nr; k++ )
   {
-    unsigned int sizeToBePacked = 0;                                                  // size of the outgoing data with packing=false (we
-                                                                                      // need to run through it first without packing so we
-                                                                                      // can size the buffer)
-    sizeOfPacked[n] = 0;                                                              // size of the outgoing data with packing=true
-    buffer_unit_type * junk;                                                          // junk buffer, stores nothing since we're just
-                                                                                      // getting the buffer size on the first pass
-    sizeToBePacked += bufferOps::Pack< false >( junk,
-                                                listSendingToEachNeighbor[n] );       // get the size of the list of local indices
-    sendBuffer[n].resize( sizeToBePacked );                                           // the actual sized buffer that we pack into
-    buffer_unit_type * sendBufferPtr = sendBuffer[n].data();                          // get a pointer to the buffer
-    sizeOfPacked[n] += bufferOps::Pack< true >( sendBufferPtr,
-                                                listSendingToEachNeighbor[n] );       // pack the list of local indices into the buffer
-    GEOS_ERROR_IF_NE( sizeToBePacked, sizeOfPacked[n] );                             // make sure the packer is self-consistent
+    sizeOfPacked[k] = LvArray::integerConversion< int >( sendBuffer[k].size() );
+    MpiWrapper::iRecv( &sizeOfReceived[k], 1, neighborRanks[k], tag, MPI_COMM_GEOSX, &sizeRequest[k] );
+    MpiWrapper::iSend( &sizeOfPacked[k], 1, neighborRanks[k], tag, MPI_COMM_GEOSX, &sendRequest[2*k] );
+    MpiWrapper::iSend( sendBuffer[k].data(), sizeOfPacked[k], neighborRanks[k], tag, MPI_COMM_GEOSX, &sendRequest[2*k+1] );
   }
-
-  // Declare the receive buffers
-  std::vector< unsigned int > sizeOfReceived( nn ); // TODO: decide if these number-of-neighbor-sized arrays should be array1d, std::vector
-                                                    // or std::array
-  std::vector< buffer_type > receiveBuffer( nn );
-
-  // send the list of local indices to each neighbor using an asynchronous send
+  for( size_t count=0; count<nr; count++ )
   {
-    array1d< MPI_Request > sendRequest( nn );
-    array1d< MPI_Status >  sendStatus( nn );
-    array1d< MPI_Request > receiveRequest( nn );
-    array1d< MPI_Status >  receiveStatus( nn );
-
-    // Send/receive the size of the packed buffer
-    for( size_t n=0; n<nn; n++ )
-    {
-      // Initialize to null
-      sendRequest[n] = MPI_REQUEST_NULL;
-      receiveRequest[n] = MPI_REQUEST_NULL;
-
-      // Perform comms
-      m_neighbors[n].mpiISendReceive( &(sizeOfPacked[n]),
-                                      1,
-                                      sendRequest[n],
-                                      &(sizeOfReceived[n]),
-                                      1,
-                                      receiveRequest[n],
-                                      commData.commID(),
-                                      MPI_COMM_GEOSX );
-    }
-    MPI_Waitall( nn, sendRequest.data(), sendStatus.data());
-    MPI_Waitall( nn, receiveRequest.data(), receiveStatus.data());
+    int k = -1;
+    MpiWrapper::waitAny( LvArray::integerConversion< int >( nr ), sizeRequest.data(), &k, sizeStatus.data() );
+    receiveBuffer[k].resize( sizeOfReceived[k] );
+    MpiWrapper::iRecv( receiveBuffer[k].data(), sizeOfReceived[k], neighborRanks[k], tag, MPI_COMM_GEOSX, &receiveRequest[k] );
   }
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( nr ), receiveRequest.data(), receiveStatus.data() );
 
-  // Send/receive the buffer containing the list of local indices
+  // Unpack the received particles over the particles with the same global index, or at the end of the subregion.
+  std::unordered_map< globalIndex, localIndex > globalToLocal;
+  for( localIndex p=0; p<subRegion.size(); p++ )
   {
-    array1d< MPI_Request > sendRequest( nn );
-    array1d< MPI_Status >  sendStatus( nn );
-    array1d< MPI_Request > receiveRequest( nn );
-    array1d< MPI_Status >  receiveStatus( nn );
-
-    for( size_t n=0; n<nn; n++ )
-    {
-      // Initialize to null
-      sendRequest[n] = MPI_REQUEST_NULL;
-      receiveRequest[n] = MPI_REQUEST_NULL;
-
-      // Perform comms
-      receiveBuffer[n].resize( sizeOfReceived[n] );
-      m_neighbors[n].mpiISendReceive( sendBuffer[n].data(),   // TODO: This can't be sendBufferPtr, why not? I guess cuz sendBufferPtr gets
-                                                              // incremented (moved) during packing.
-                                      sizeOfPacked[n],
-                                      sendRequest[n],
-                                      receiveBuffer[n].data(),
-                                      sizeOfReceived[n],
-                                      receiveRequest[n],
-                                      commData.commID(),
-                                      MPI_COMM_GEOSX );
-    }
-    MPI_Waitall( nn, sendRequest.data(), sendStatus.data());
-    MPI_Waitall( nn, receiveRequest.data(), receiveStatus.data());
+    globalToLocal[ particleID[p] ] = p;
   }
-
-  // Unpack the received list of local indices from each neighbor
-  for( size_t n=0; n<nn; n++ )
+  for( size_t k=0; k<nr; k++ )
   {
-    // Unpack the buffer to an array of coordinates.
-    const buffer_unit_type * receiveBufferPtr = receiveBuffer[n].data();  // needed for const cast
-    bufferOps::Unpack( receiveBufferPtr, listReceivedFromEachNeighbor[n] );
-  }
-}
-
-void SpatialPartition::sendParticlesToNeighbor( ParticleSubRegionBase & subRegion,
-                                                std::vector< int > const & newParticleStartingIndices,
-                                                std::vector< int > const & numberOfIncomingParticles,
-                                                MPI_iCommData & commData,
-                                                std::vector< array1d< localIndex > > const & particleLocalIndicesToSendToEachNeighbor )
-{
-  unsigned int nn = m_neighbors.size();
+    buffer_unit_type const * receiveBufferPtr = receiveBuffer[k].data();
+    array1d< globalIndex > receivedGlobalIndices;
+    bufferOps::Unpack( receiveBufferPtr, receivedGlobalIndices );
 
-  // Pack the send buffer for the particles being sent to each neighbor
-  std::vector< buffer_type > sendBuffer( nn );
-  std::vector< unsigned int > sizeOfPacked( nn );
-
-  for( size_t n=0; n<nn; n++ )
-  {
-    sizeOfPacked[n] = subRegion.particlePack( sendBuffer[n], particleLocalIndicesToSendToEachNeighbor[n].toView(), false );
-    sendBuffer[n].resize( sizeOfPacked[n] );
-    unsigned int sizeCheck = subRegion.particlePack( sendBuffer[n], particleLocalIndicesToSendToEachNeighbor[n].toView(), true );
-    GEOS_ERROR_IF_NE( sizeCheck, sizeOfPacked[n] );
-  }
-
-  // Declare the receive buffers
-  std::vector< unsigned int > sizeOfReceived( nn ); // TODO: decide if these number-of-neighbor-sized arrays should be array1d, std::vector
-                                                    // or std::array
-  std::vector< buffer_type > receiveBuffer( nn );
-
-  // send/receive the size of the packed particle data to each neighbor using an asynchronous send
-  {
-    array1d< MPI_Request > sendRequest( nn );
-    array1d< MPI_Status >  sendStatus( nn );
-    array1d< MPI_Request > receiveRequest( nn );
-    array1d< MPI_Status >  receiveStatus( nn );
-
-    for( size_t n=0; n<nn; n++ )
+    localIndex newSize = subRegion.size();
+    array1d< localIndex > unpackList( receivedGlobalIndices.size() );
+    for( localIndex i=0; i<receivedGlobalIndices.size(); i++ )
     {
-      // Initialize to null
-      sendRequest[n] = MPI_REQUEST_NULL;
-      receiveRequest[n] = MPI_REQUEST_NULL;
-
-      // Perform comms
-      m_neighbors[n].mpiISendReceive( &(sizeOfPacked[n]),
-                                      1,
-                                      sendRequest[n],
-                                      &(sizeOfReceived[n]),
-                                      1,
-                                      receiveRequest[n],
-                                      commData.commID(),
-                                      MPI_COMM_GEOSX );
+      auto const iter = globalToLocal.find( receivedGlobalIndices[i] );
+      if( iter != globalToLocal.end() )
+      {
+        unpackList[i] = iter->second;
+      }
+      else
+      {
+        unpackList[i] = newSize;
+        globalToLocal[ receivedGlobalIndices[i] ] = newSize++;
+      }
     }
-    MPI_Waitall( nn, sendRequest.data(), sendStatus.data() );
-    MPI_Waitall( nn, receiveRequest.data(), receiveStatus.data() );
-  }
-
-  // Send/receive the buffer containing the list of local indices
-  {
-    array1d< MPI_Request > sendRequest( nn );
-    array1d< MPI_Status >  sendStatus( nn );
-    array1d< MPI_Request > receiveRequest( nn );
-    array1d< MPI_Status >  receiveStatus( nn );
-
-    for( size_t n=0; n<nn; n++ )
+    if( newSize > subRegion.size() )
     {
-      // Initialize to null
-      sendRequest[n] = MPI_REQUEST_NULL;
-      receiveRequest[n] = MPI_REQUEST_NULL;
-
-      // Perform comms
-      receiveBuffer[n].resize( sizeOfReceived[n] );
-      m_neighbors[n].mpiISendReceive( sendBuffer[n].data(),
-                                      sizeOfPacked[n],
-                                      sendRequest[n],
-                                      receiveBuffer[n].data(),
-                                      sizeOfReceived[n],
-                                      receiveRequest[n],
-                                      commData.commID(),
-                                      MPI_COMM_GEOSX );
+      subRegion.resize( newSize ); // TODO: Does this handle constitutive fields owned by the subRegion?
     }
-    MPI_Waitall( nn, sendRequest.data(), sendStatus.data());
-    MPI_Waitall( nn, receiveRequest.data(), receiveStatus.data());
-  }
 
-  // Unpack the received particle data.
-  for( size_t n=0; n<nn; n++ )
-  {
-    // Unpack the buffer to an array of coordinates.
-    subRegion.particleUnpack( receiveBuffer[n], newParticleStartingIndices[n], numberOfIncomingParticles[n] );
+    arrayView1d< localIndex > unpackListView = unpackList.toView();
+    subRegion.unpack( receiveBufferPtr, unpackListView, 0, false, events );
   }
 
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( 2 * nr ), sendRequest.data(), sendStatus.data() );
 }
 
 }
@@ -20,6 +20,7 @@
 #include "mesh/DomainPartition.hpp"
 
 
+#include <array>
 #include <map>
 
 constexpr int nsdof = 3;
@@ -80,28 +81,6 @@ public:
                                                    MPI_iCommData & commData,
                                                    const real64 & boundaryRadius );
 
-  /**
-   * @brief Send coordinates to neighbors as part of repartition.
-   * @param[in] particleCoordinatesSendingToNeighbors Single list of coordinates sent to all neighbors
-   * @param[in] commData Solver's MPI communicator
-   * @param[in] particleCoordinatesReceivedFromNeighbors List of lists of coordinates received from each neighbor
-   */
-  void sendCoordinateListToNeighbors( arrayView1d< R1Tensor > const & particleCoordinatesSendingToNeighbors,
-                                      MPI_iCommData & commData,
-                                      std::vector< array1d< R1Tensor > > & particleCoordinatesReceivedFromNeighbors
-                                      );
-
-  template< typename indexType >
-  void sendListOfIndicesToNeighbors( std::vector< array1d< indexType > > & listSendingToEachNeighbor,
-                                     MPI_iCommData & commData,
-                                     std::vector< array1d< indexType > > & listReceivedFromEachNeighbor );
-
-  void sendParticlesToNeighbor( ParticleSubRegionBase & subRegion,
-                                std::vector< int > const & newParticleStartingIndices,
-                                std::vector< int > const & numberOfIncomingParticles,
-                                MPI_iCommData & commData,
-                                std::vector< array1d< localIndex > > const & particleLocalIndicesToSendToEachNeighbor );
-
   /**
    * @brief Get the metis neighbors indices, const version. @see DomainPartition#m_metisNeighborList
    * @return Container of global indices.
@@ -146,12 +125,45 @@ private:
    * @param idim Dimension index in the cartesian.
    * @param cartcomm Communicator with cartesian structure.
    * @param ncoords Cartesian coordinates of a process (assumed to be of length 3).
+   * @param noffsets Offsets of the process in the cartesian, before the periodic wrapping (assumed to be of length 3).
    *
    * @note Rough copy/paste of DomainPartition::AddNeighbors
    */
   void addNeighbors( const unsigned int idim,
                      MPI_Comm & cartcomm,
-                     int * ncoords );
+                     int * ncoords,
+                     int * noffsets );
+
+  /**
+   * @brief Get the periodic image of a coordinate closest to the partition.
+   * @param coord The coordinate.
+   * @param dir The direction.
+   * @return The coordinate itself in a non-periodic direction, its image closest to the partition otherwise.
+   */
+  real64 getClosestPeriodicImage( real64 const coord, int const dir ) const;
+
+  /**
+   * @brief Get the side of the partition a coordinate lies on.
+   * @param coord The coordinate.
+   * @param dir The direction.
+   * @return -1 below the partition, 1 above the partition, 0 within the partition or if the direction is not partitioned.
+   */
+  int getNeighborOffset( real64 const coord, int const dir ) const;
+
+  /**
+   * @brief Send particles to the neighbors and receive the particles they send.
+   * @param subRegion The particle subregion.
+   * @param particlesSentToNeighbors The local indices of the particles sent to each entry of m_neighbors.
+   * @param commData Solver's MPI communicator.
+   *
+   * All the fields of the particles sent to a neighbor rank are packed in a single buffer, preceded by
+   * their global indices, and the size and the buffer are sent together without waiting for the neighbor.
+   * A received particle overwrites the particle with the same global index if it exists on the partition,
+   * and is appended to the subregion otherwise.
+   */
+  void exchangeParticlesWithNeighbors( ParticleSubRegion & subRegion,
+                                       std::vector< array1d< localIndex > > const & particlesSentToNeighbors,
+                                       MPI_iCommData & commData );
 
   /**
    * @brief Defines a distance/buffer below which we are considered in the contact zone ghosts.
@@ -190,6 +202,9 @@ private:
   /// number of partitions
   array1d< int > m_Partitions;
 
+  /// Offsets of each entry of m_neighbors in the cartesian (-1, 0 or 1 in each direction)
+  std::vector< std::array< int, nsdof > > m_neighborOffsets;
+
   /**
    * @brief Contains the global indices of the metis neighbors in case `metis` is used. Empty otherwise.
    */
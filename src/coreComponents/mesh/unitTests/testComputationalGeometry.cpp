@@ -69,4 +69,63 @@ TEST( testComputationalGeometry, checkCentroid3DPolygon )
   }
 }
 
+TEST( testComputationalGeometry, checkCentroidAxisAlignedRectangle )
+{
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > points( 6, 3 );
+  real64 const coords[6][3] = { { 1.0, 2.0, 3.0 },
+                                { 1.0, 2.5, 3.0 },
+                                { 1.0, 2.5, 4.5 },
+                                { 1.0, 2.0, 4.5 },
+                                { 1.2, 2.5, 4.5 },
+                                { 1.0, 2.0, 3.1 } };
+  for( localIndex i = 0; i < 6; ++i )
+  {
+    LvArray::tensorOps::copy< 3 >( points[i], coords[i] );
+  }
+
+  // Both orientations of the same rectangle must give the result of the generic polygon computation
+  localIndex const loops[2][4] = { { 0, 1, 2, 3 }, { 0, 3, 2, 1 } };
+  for( localIndex l = 0; l < 2; ++l )
+  {
+    array1d< localIndex > indices;
+    for( localIndex a = 0; a < 4; ++a )
+    {
+      indices.emplace_back( loops[l][a] );
+    }
+
+    real64 center[ 3 ], normal[ 3 ], area;
+    EXPECT_TRUE( computationalGeometry::centroid_axisAlignedRectangle( indices.toSliceConst(), points.toViewConst(), center, normal, area ) );
+
+    real64 refCenter[ 3 ], refNormal[ 3 ];
+    real64 const refArea = computationalGeometry::centroid_3DPolygon( indices.toSliceConst(), points.toViewConst(), refCenter, refNormal );
+
+    EXPECT_DOUBLE_EQ( area, refArea );
+    for( integer d = 0; d < 3; ++d )
+    {
+      EXPECT_NEAR( center[d], refCenter[d], 1.0e-14 );
+      EXPECT_NEAR( normal[d], refNormal[d], 1.0e-14 );
+    }
+  }
+
+  // Non-planar and non-rectangular quadrilaterals, and triangles, are rejected
+  localIndex const rejected[3][4] = { { 0, 1, 4, 3 }, { 5, 1, 2, 3 }, { 0, 1, 2, 0 } };
+  for( localIndex l = 0; l < 3; ++l )
+  {
+    array1d< localIndex > indices;
+    for( localIndex a = 0; a < 4; ++a )
+    {
+      indices.emplace_back( rejected[l][a] );
+    }
+    real64 center[ 3 ], normal[ 3 ], area;
+    EXPECT_FALSE( computationalGeometry::centroid_axisAlignedRectangle( indices.toSliceConst(), points.toViewConst(), center, normal, area ) );
+  }
+
+  array1d< localIndex > triangle;
+  triangle.emplace_back( 0 );
+  triangle.emplace_back( 1 );
+  triangle.emplace_back( 2 );
+  real64 center[ 3 ], normal[ 3 ], area;
+  EXPECT_FALSE( computationalGeometry::centroid_axisAlignedRectangle( triangle.toSliceConst(), points.toViewConst(), center, normal, area ) );
+}
+
 } /* namespace geos */
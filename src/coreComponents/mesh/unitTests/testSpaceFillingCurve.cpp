@@ -0,0 +1,95 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testSpaceFillingCurve.cpp
+ */
+#include "mesh/utilities/SpaceFillingCurve.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace geos
+{
+
+TEST( testSpaceFillingCurve, mortonKey )
+{
+  // the bits of x are the most significant ones at each level
+  EXPECT_EQ( spaceFillingCurve::mortonKey( { 0, 0, 1 } ), 1u );
+  EXPECT_EQ( spaceFillingCurve::mortonKey( { 0, 1, 0 } ), 2u );
+  EXPECT_EQ( spaceFillingCurve::mortonKey( { 1, 0, 0 } ), 4u );
+  EXPECT_EQ( spaceFillingCurve::mortonKey( { 1, 1, 1 } ), 7u );
+  EXPECT_EQ( spaceFillingCurve::mortonKey( { 2, 0, 0 } ), 32u );
+}
+
+TEST( testSpaceFillingCurve, hilbertKeyAdjacency )
+{
+  // the 8x8x8 cube at the origin is traversed first, and two consecutive cells along the curve are neighbors
+  std::uint32_t constexpr n = 8;
+  std::vector< std::pair< std::uint64_t, std::array< std::uint32_t, 3 > > > cells;
+  for( std::uint32_t i = 0; i < n; ++i )
+  {
+    for( std::uint32_t j = 0; j < n; ++j )
+    {
+      for( std::uint32_t k = 0; k < n; ++k )
+      {
+        cells.push_back( { spaceFillingCurve::hilbertKey( { i, j, k } ), { i, j, k } } );
+      }
+    }
+  }
+  std::sort( cells.begin(), cells.end() );
+
+  for( std::size_t c = 0; c < cells.size(); ++c )
+  {
+    EXPECT_EQ( cells[c].first, c );
+    if( c > 0 )
+    {
+      integer distance = 0;
+      for( integer d = 0; d < 3; ++d )
+      {
+        distance += std::abs( static_cast< integer >( cells[c].second[d] ) - static_cast< integer >( cells[c-1].second[d] ) );
+      }
+      EXPECT_EQ( distance, 1 );
+    }
+  }
+}
+
+TEST( testSpaceFillingCurve, computeOrdering )
+{
+  // points along the x axis, in reverse order
+  localIndex constexpr numPoints = 10;
+  array2d< real64 > points( numPoints, 3 );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    points( i, 0 ) = static_cast< real64 >( numPoints - i );
+    points( i, 1 ) = 1.0;
+    points( i, 2 ) = -1.0;
+  }
+
+  array1d< localIndex > order( numPoints );
+  spaceFillingCurve::computeOrdering( points.toViewConst(), spaceFillingCurve::CurveType::morton, order.toView() );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    EXPECT_EQ( order[i], numPoints - 1 - i );
+  }
+
+  spaceFillingCurve::computeOrdering( points.toViewConst(), spaceFillingCurve::CurveType::none, order.toView() );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    EXPECT_EQ( order[i], i );
+  }
+}
+
+} /* namespace geos */
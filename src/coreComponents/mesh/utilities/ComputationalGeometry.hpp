@@ -249,6 +249,93 @@ real64 centroid_3DPolygon( arraySlice1d< localIndex const > const pointsIndices,
   return area;
 }
 
+/**
+ * @brief Calculate the centroid, normal and area of a quadrilateral face whose edges are parallel to the coordinate axes.
+ * @tparam CENTER_TYPE The type of @p center.
+ * @tparam NORMAL_TYPE The type of @p normal.
+ * @param[in] pointsIndices list of index references for the points array in
+ *   order (CW or CCW) about the polygon loop
+ * @param[in] points 3D point list
+ * @param[out] center 3D center of the face
+ * @param[out] normal normal to the face, oriented as in centroid_3DPolygon
+ * @param[out] area area of the face
+ * @return true if the face is an axis-aligned rectangle and the outputs have been set, false otherwise
+ * @details The faces of the Cartesian meshes produced by the internal mesh generator share their coordinates exactly,
+ *          so that they are detected with exact comparisons and their geometry is computed analytically. The result
+ *          is the one of centroid_3DPolygon, without the cross products and the normalization.
+ */
+template< typename CENTER_TYPE, typename NORMAL_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+bool centroid_axisAlignedRectangle( arraySlice1d< localIndex const > const pointsIndices,
+                                    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & points,
+                                    CENTER_TYPE && center,
+                                    NORMAL_TYPE && normal,
+                                    real64 & area )
+{
+  if( pointsIndices.size() != 4 )
+  {
+    return false;
+  }
+
+  // Find the axis normal to the face
+  integer axis = -1;
+  for( integer d = 0; d < 3; ++d )
+  {
+    real64 const x0 = points( pointsIndices[0], d );
+    if( points( pointsIndices[1], d ) == x0 && points( pointsIndices[2], d ) == x0 && points( pointsIndices[3], d ) == x0 )
+    {
+      axis = d;
+      break;
+    }
+  }
+  if( axis < 0 )
+  {
+    return false;
+  }
+  integer const b = ( axis + 1 ) % 3;
+  integer const c = ( axis + 2 ) % 3;
+
+  // Consecutive edges must be non-degenerate and alternate between the two in-plane directions
+  bool alongB[4];
+  for( integer k = 0; k < 4; ++k )
+  {
+    localIndex const curr = pointsIndices[k];
+    localIndex const next = pointsIndices[( k + 1 ) % 4];
+    bool const sameB = points( curr, b ) == points( next, b );
+    bool const sameC = points( curr, c ) == points( next, c );
+    if( sameB == sameC )
+    {
+      return false;
+    }
+    alongB[k] = sameC;
+  }
+  if( alongB[0] == alongB[1] || alongB[1] == alongB[2] || alongB[2] == alongB[3] )
+  {
+    return false;
+  }
+
+  for( integer d = 0; d < 3; ++d )
+  {
+    center[d] = 0.25 * ( points( pointsIndices[0], d ) + points( pointsIndices[1], d ) +
+                         points( pointsIndices[2], d ) + points( pointsIndices[3], d ) );
+  }
+
+  // Cross product of the first two edges, the only non-zero component being along the axis
+  real64 edge0[3], edge1[3];
+  for( integer d = 0; d < 3; ++d )
+  {
+    edge0[d] = points( pointsIndices[1], d ) - points( pointsIndices[0], d );
+    edge1[d] = points( pointsIndices[2], d ) - points( pointsIndices[1], d );
+  }
+  real64 const signedArea = edge0[b] * edge1[c] - edge0[c] * edge1[b];
+
+  LvArray::tensorOps::fill< 3 >( normal, 0 );
+  normal[axis] = signedArea > 0.0 ? 1.0 : -1.0;
+  area = LvArray::math::abs( signedArea );
+  return true;
+}
+
 /**
  * @brief Change the orientation of the input vector to be consistent in a global sense.
  * @tparam NORMAL_TYPE type of @p normal
@@ -0,0 +1,282 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ElementSpatialIndex.hpp
+ */
+
+#ifndef GEOS_MESH_UTILITIES_ELEMENTSPATIALINDEX_HPP
+#define GEOS_MESH_UTILITIES_ELEMENTSPATIALINDEX_HPP
+
+#include "common/DataLayouts.hpp"
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+
+#include <cmath>
+
+namespace geos
+{
+
+/**
+ * @class ElementSpatialIndex
+ * @brief Uniform grid of bins over the bounding boxes of a set of elements.
+ *
+ * Each bin lists the elements whose bounding box overlaps it, so that the elements that may contain a point
+ * are found by visiting a single bin instead of all the elements. The bounding boxes are computed with the execution
+ * policy of the caller, the bins are filled on the host, and the kernel wrapper can be queried from device kernels.
+ */
+class ElementSpatialIndex
+{
+public:
+
+  /**
+   * @class KernelWrapper
+   * @brief Read-only view of the index, to be captured by value in kernels.
+   */
+  class KernelWrapper
+  {
+public:
+
+    /**
+     * @brief Call a function on the elements whose bounding box may contain a point, until it returns true.
+     * @tparam POINT type of the coordinates of the point
+     * @tparam FUNC type of the function, called as func( elemIndex ) and returning true to stop the search
+     * @param[in] point the coordinates of the point
+     * @param[in] func the function, typically an exact point-in-element test
+     * @return true if the function returned true for one of the elements
+     */
+    template< typename POINT, typename FUNC >
+    GEOS_HOST_DEVICE
+    bool forCandidates( POINT const & point, FUNC && func ) const
+    {
+      if( m_binToElems.size() == 0 )
+      {
+        return false;
+      }
+      localIndex bin = 0;
+      localIndex stride = 1;
+      for( integer d = 0; d < 3; ++d )
+      {
+        real64 const x = ( point[d] - m_min[d] ) * m_invBinSize[d];
+        if( x < 0.0 || x > m_numBins[d] )
+        {
+          return false; // the point is outside of the bounding box of all the elements
+        }
+        bin += binIndex( point[d], d ) * stride;
+        stride *= m_numBins[d];
+      }
+      for( localIndex const k : m_binToElems[bin] )
+      {
+        if( func( k ) )
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+private:
+
+    friend class ElementSpatialIndex;
+
+    /**
+     * @brief Get the index of the bin containing a coordinate along an axis.
+     * @param[in] x the coordinate
+     * @param[in] d the axis
+     * @return the index of the bin, clamped to the bounds of the grid
+     */
+    GEOS_HOST_DEVICE
+    localIndex binIndex( real64 const x, integer const d ) const
+    {
+      real64 const i = ( x - m_min[d] ) * m_invBinSize[d];
+      return LvArray::math::min( LvArray::math::max( static_cast< localIndex >( i ), localIndex( 0 ) ), m_numBins[d] - 1 );
+    }
+
+    /// Lower corner of the grid
+    real64 m_min[3]{};
+
+    /// Inverse of the size of the bins along each axis, zero along a flat axis
+    real64 m_invBinSize[3]{};
+
+    /// Number of bins along each axis
+    localIndex m_numBins[3]{ 1, 1, 1 };
+
+    /// List of the elements overlapping each bin, the bins being numbered with the first axis changing the fastest
+    ArrayOfArraysView< localIndex const > m_binToElems;
+  };
+
+  /**
+   * @brief Build the index over the elements of a subregion.
+   * @tparam POLICY execution policy
+   * @tparam COORD_TYPE type of the node coordinates
+   * @param[in] elemsToNodes map from elements to nodes
+   * @param[in] nodeCoords coordinates of the nodes
+   */
+  template< typename POLICY, typename COORD_TYPE >
+  void build( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
+              arrayView2d< COORD_TYPE const, nodes::REFERENCE_POSITION_USD > const & nodeCoords );
+
+  /**
+   * @return the kernel wrapper used to query the index
+   */
+  KernelWrapper createKernelWrapper() const
+  {
+    KernelWrapper wrapper = m_grid;
+    wrapper.m_binToElems = m_binToElems.toViewConst();
+    return wrapper;
+  }
+
+private:
+
+  /// Dimensions of the grid
+  KernelWrapper m_grid;
+
+  /// List of the elements overlapping each bin
+  ArrayOfArrays< localIndex > m_binToElems;
+};
+
+template< typename POLICY, typename COORD_TYPE >
+void ElementSpatialIndex::build( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
+                                 arrayView2d< COORD_TYPE const, nodes::REFERENCE_POSITION_USD > const & nodeCoords )
+{
+  localIndex const numElems = elemsToNodes.size( 0 );
+  localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+  m_grid = KernelWrapper();
+  m_binToElems = ArrayOfArrays< localIndex >();
+  if( numElems == 0 )
+  {
+    return;
+  }
+
+  // Step 1: compute the bounding boxes of the elements, and of the whole set
+  array2d< real64 > boxes( numElems, 6 );
+  arrayView2d< real64 > const boxesView = boxes.toView();
+  RAJA::ReduceMin< ReducePolicy< POLICY >, real64 > minX( LvArray::NumericLimits< real64 >::max );
+  RAJA::ReduceMin< ReducePolicy< POLICY >, real64 > minY( LvArray::NumericLimits< real64 >::max );
+  RAJA::ReduceMin< ReducePolicy< POLICY >, real64 > minZ( LvArray::NumericLimits< real64 >::max );
+  RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxX( LvArray::NumericLimits< real64 >::lowest );
+  RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxY( LvArray::NumericLimits< real64 >::lowest );
+  RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxZ( LvArray::NumericLimits< real64 >::lowest );
+  forAll< POLICY >( numElems, [=] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    real64 boxMin[3] = { LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max };
+    real64 boxMax[3] = { LvArray::NumericLimits< real64 >::lowest, LvArray::NumericLimits< real64 >::lowest, LvArray::NumericLimits< real64 >::lowest };
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      localIndex const node = elemsToNodes( k, a );
+      for( integer d = 0; d < 3; ++d )
+      {
+        boxMin[d] = LvArray::math::min( boxMin[d], static_cast< real64 >( nodeCoords( node, d ) ) );
+        boxMax[d] = LvArray::math::max( boxMax[d], static_cast< real64 >( nodeCoords( node, d ) ) );
+      }
+    }
+    for( integer d = 0; d < 3; ++d )
+    {
+      boxesView( k, d ) = boxMin[d];
+      boxesView( k, 3 + d ) = boxMax[d];
+    }
+    minX.min( boxMin[0] );
+    minY.min( boxMin[1] );
+    minZ.min( boxMin[2] );
+    maxX.max( boxMax[0] );
+    maxY.max( boxMax[1] );
+    maxZ.max( boxMax[2] );
+  } );
+
+  // Step 2: choose bins of about the size of an element, ignoring the flat axes
+  real64 const lower[3] = { minX.get(), minY.get(), minZ.get() };
+  real64 const extent[3] = { maxX.get() - lower[0], maxY.get() - lower[1], maxZ.get() - lower[2] };
+  real64 const maxExtent = LvArray::math::max( extent[0], LvArray::math::max( extent[1], extent[2] ) );
+  real64 measure = 1.0;
+  integer numActiveAxes = 0;
+  for( integer d = 0; d < 3; ++d )
+  {
+    if( extent[d] > 1.0e-12 * maxExtent )
+    {
+      measure *= extent[d];
+      ++numActiveAxes;
+    }
+  }
+  real64 const binSize = ( numActiveAxes > 0 ) ? std::pow( measure / numElems, 1.0 / numActiveAxes ) : 0.0;
+
+  // the boxes are slightly enlarged, so that the points on the boundary of an element are not missed
+  real64 const tolerance = 1.0e-8 * maxExtent;
+  localIndex numBinsTotal = 1;
+  for( integer d = 0; d < 3; ++d )
+  {
+    m_grid.m_min[d] = lower[d] - tolerance;
+    if( extent[d] > 1.0e-12 * maxExtent )
+    {
+      m_grid.m_numBins[d] = LvArray::math::min( LvArray::math::max( static_cast< localIndex >( std::ceil( extent[d] / binSize ) ),
+                                                                    localIndex( 1 ) ),
+                                                numElems );
+      m_grid.m_invBinSize[d] = m_grid.m_numBins[d] / ( extent[d] + 2.0 * tolerance );
+    }
+    numBinsTotal *= m_grid.m_numBins[d];
+  }
+
+  // Step 3: count the elements overlapping each bin, then fill the lists of the bins
+  // (on the host, since the capacities of the lists are allocated from the host counts)
+  KernelWrapper const grid = m_grid;
+  array1d< localIndex > counts( numBinsTotal );
+  forAll< parallelHostPolicy >( numElems, [=, counts = counts.toView()] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    localIndex first[3];
+    localIndex last[3];
+    for( integer d = 0; d < 3; ++d )
+    {
+      first[d] = grid.binIndex( boxesView( k, d ) - tolerance, d );
+      last[d] = grid.binIndex( boxesView( k, 3 + d ) + tolerance, d );
+    }
+    for( localIndex i2 = first[2]; i2 <= last[2]; ++i2 )
+    {
+      for( localIndex i1 = first[1]; i1 <= last[1]; ++i1 )
+      {
+        for( localIndex i0 = first[0]; i0 <= last[0]; ++i0 )
+        {
+          localIndex const bin = i0 + grid.m_numBins[0] * ( i1 + grid.m_numBins[1] * i2 );
+          RAJA::atomicInc< parallelHostAtomic >( &counts[bin] );
+        }
+      }
+    }
+  } );
+
+  m_binToElems.resizeFromCapacities< parallelHostPolicy >( numBinsTotal, counts.data() );
+
+  forAll< parallelHostPolicy >( numElems, [=, binToElems = m_binToElems.toView()] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    localIndex first[3];
+    localIndex last[3];
+    for( integer d = 0; d < 3; ++d )
+    {
+      first[d] = grid.binIndex( boxesView( k, d ) - tolerance, d );
+      last[d] = grid.binIndex( boxesView( k, 3 + d ) + tolerance, d );
+    }
+    for( localIndex i2 = first[2]; i2 <= last[2]; ++i2 )
+    {
+      for( localIndex i1 = first[1]; i1 <= last[1]; ++i1 )
+      {
+        for( localIndex i0 = first[0]; i0 <= last[0]; ++i0 )
+        {
+          localIndex const bin = i0 + grid.m_numBins[0] * ( i1 + grid.m_numBins[1] * i2 );
+          binToElems.emplaceBackAtomic< parallelHostAtomic >( bin, k );
+        }
+      }
+    }
+  } );
+}
+
+} // namespace geos
+
+#endif //GEOS_MESH_UTILITIES_ELEMENTSPATIALINDEX_HPP
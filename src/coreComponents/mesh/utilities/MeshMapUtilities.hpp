@@ -116,6 +116,59 @@ transposeIndexMap( VIEW_TYPE const & srcMap,
   return dstMap;
 }
 
+/**
+ * @brief Copy a compressed map into a new map allocated with the exact capacity.
+ * @tparam POLICY execution policy
+ * @tparam T type of map element
+ * @param map the compressed map (the capacity of each sub-array equals its size)
+ * @return the copy of @p map, whose value buffer holds no capacity beyond the last sub-array
+ */
+template< typename POLICY, typename T >
+ArrayOfArrays< T > compactCopy( ArrayOfArraysView< T const > const & map )
+{
+  localIndex const numArrays = map.size();
+
+  ArrayOfArrays< T > compact;
+  compact.resizeFromOffsets( numArrays, map.getOffsets() );
+
+  forAll< POLICY >( numArrays, [map, compact = compact.toView()] ( localIndex const i )
+  {
+    compact.appendToArray( i, map[ i ].begin(), map[ i ].end() );
+  } );
+
+  return compact;
+}
+
+/**
+ * @brief Release the memory a map holds beyond its values.
+ * @tparam POLICY execution policy
+ * @tparam T type of map element
+ * @param map the map to shrink, compressed beforehand
+ * @note Compression makes the sub-arrays contiguous, but keeps the freed capacity at the end of the buffer.
+ */
+template< typename POLICY, typename T >
+void shrinkToFit( ArrayOfArrays< T > & map )
+{
+  if( map.valueCapacity() > map.toViewConst().getOffsets()[ map.size() ] )
+  {
+    map = compactCopy< POLICY >( map.toViewConst() );
+  }
+}
+
+/**
+ * @copydoc shrinkToFit( ArrayOfArrays< T > & )
+ */
+template< typename POLICY, typename T >
+void shrinkToFit( ArrayOfSets< T > & map )
+{
+  ArrayOfArraysView< T const > const arrays = map.toArrayOfArraysView();
+  if( map.valueCapacity() > arrays.getOffsets()[ map.size() ] )
+  {
+    map.template assimilate< POLICY >( compactCopy< POLICY >( arrays ),
+                                       LvArray::sortedArrayManipulation::SORTED_UNIQUE );
+  }
+}
+
 /**
  * @brief Convert ToCellRelation into ToElementRelation.
  * @tparam POLICY execution policy
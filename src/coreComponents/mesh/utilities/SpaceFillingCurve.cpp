@@ -0,0 +1,149 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SpaceFillingCurve.cpp
+ */
+
+#include "SpaceFillingCurve.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace geos
+{
+
+namespace spaceFillingCurve
+{
+
+std::uint64_t mortonKey( std::uint32_t const ( &coords )[3] )
+{
+  std::uint64_t key = 0;
+  for( integer b = numBitsPerDim - 1; b >= 0; --b )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      key = ( key << 1 ) | ( ( coords[d] >> b ) & 1u );
+    }
+  }
+  return key;
+}
+
+std::uint64_t hilbertKey( std::uint32_t const ( &coords )[3] )
+{
+  std::uint32_t x[3] = { coords[0], coords[1], coords[2] };
+  std::uint32_t const m = 1u << ( numBitsPerDim - 1 );
+
+  // Inverse undo excess work
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    std::uint32_t const p = q - 1;
+    for( integer d = 0; d < 3; ++d )
+    {
+      if( x[d] & q )
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        std::uint32_t const t = ( x[0] ^ x[d] ) & p;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for( integer d = 1; d < 3; ++d )
+  {
+    x[d] ^= x[d-1];
+  }
+  std::uint32_t t = 0;
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    if( x[2] & q )
+    {
+      t ^= q - 1;
+    }
+  }
+  for( integer d = 0; d < 3; ++d )
+  {
+    x[d] ^= t;
+  }
+
+  // The transposed representation is interleaved like a Morton key
+  return mortonKey( x );
+}
+
+void computeKeys( arrayView2d< real64 const > const & points,
+                  CurveType const curveType,
+                  real64 const ( &xMin )[3],
+                  real64 const ( &xMax )[3],
+                  arrayView1d< std::uint64_t > const & keys )
+{
+  GEOS_ERROR_IF_NE( points.size( 0 ), keys.size() );
+  GEOS_ERROR_IF( curveType == CurveType::none, "A curve type is required to compute keys" );
+
+  real64 const maxCoord = static_cast< real64 >( ( 1u << numBitsPerDim ) - 1 );
+  for( localIndex i = 0; i < points.size( 0 ); ++i )
+  {
+    std::uint32_t coords[3];
+    for( integer d = 0; d < 3; ++d )
+    {
+      real64 const extent = xMax[d] - xMin[d];
+      real64 const scaled = extent > 0.0 ? ( points( i, d ) - xMin[d] ) / extent * maxCoord : 0.0;
+      coords[d] = static_cast< std::uint32_t >( LvArray::math::min( LvArray::math::max( scaled, 0.0 ), maxCoord ) );
+    }
+    keys[i] = curveType == CurveType::morton ? mortonKey( coords ) : hilbertKey( coords );
+  }
+}
+
+void computeOrdering( arrayView2d< real64 const > const & points,
+                      CurveType const curveType,
+                      arrayView1d< localIndex > const & order )
+{
+  GEOS_ERROR_IF_NE( points.size( 0 ), order.size() );
+  GEOS_ERROR_IF_NE( points.size( 1 ), 3 );
+
+  localIndex const numPoints = points.size( 0 );
+  std::iota( order.begin(), order.end(), 0 );
+  if( curveType == CurveType::none || numPoints == 0 )
+  {
+    return;
+  }
+
+  // Bounding box of the points
+  real64 xMin[3] = { LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max, LvArray::NumericLimits< real64 >::max };
+  real64 xMax[3] = { -LvArray::NumericLimits< real64 >::max, -LvArray::NumericLimits< real64 >::max, -LvArray::NumericLimits< real64 >::max };
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      xMin[d] = LvArray::math::min( xMin[d], points( i, d ) );
+      xMax[d] = LvArray::math::max( xMax[d], points( i, d ) );
+    }
+  }
+
+  array1d< std::uint64_t > keys( numPoints );
+  computeKeys( points, curveType, xMin, xMax, keys.toView() );
+
+  std::stable_sort( order.begin(), order.end(), [&]( localIndex const a, localIndex const b )
+  {
+    return keys[a] < keys[b];
+  } );
+}
+
+} // namespace spaceFillingCurve
+
+} // namespace geos
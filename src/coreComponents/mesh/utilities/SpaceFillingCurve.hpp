@@ -0,0 +1,100 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SpaceFillingCurve.hpp
+ */
+
+#ifndef GEOS_MESH_UTILITIES_SPACEFILLINGCURVE_HPP_
+#define GEOS_MESH_UTILITIES_SPACEFILLINGCURVE_HPP_
+
+#include "common/DataTypes.hpp"
+#include "codingUtilities/EnumStrings.hpp"
+
+namespace geos
+{
+
+namespace spaceFillingCurve
+{
+
+/**
+ * @brief Type of space-filling curve used to order points
+ */
+enum class CurveType : integer
+{
+  none,    ///< Keep the original order
+  morton,  ///< Morton (Z-order) curve
+  hilbert, ///< Hilbert curve
+};
+
+/// Strings for CurveType enumeration
+ENUM_STRINGS( CurveType,
+              "none",
+              "morton",
+              "hilbert" );
+
+/// Number of bits per coordinate in the keys
+constexpr integer numBitsPerDim = 21;
+
+/**
+ * @brief Compute the Morton key of a point with integer coordinates.
+ * @param[in] coords the coordinates, in [0, 2^numBitsPerDim)
+ * @return the key obtained by interleaving the bits of the coordinates
+ */
+std::uint64_t mortonKey( std::uint32_t const ( &coords )[3] );
+
+/**
+ * @brief Compute the Hilbert key of a point with integer coordinates.
+ * @param[in] coords the coordinates, in [0, 2^numBitsPerDim)
+ * @return the position of the point along the Hilbert curve
+ *
+ * The key is computed with the transpose algorithm of J. Skilling, "Programming the Hilbert curve" (2004).
+ */
+std::uint64_t hilbertKey( std::uint32_t const ( &coords )[3] );
+
+/**
+ * @brief Compute the keys of a set of points along a space-filling curve.
+ * @param[in] points the point coordinates
+ * @param[in] curveType the type of curve (morton or hilbert)
+ * @param[in] xMin lower corner of the box covered by the curve
+ * @param[in] xMax upper corner of the box covered by the curve
+ * @param[out] keys the keys of the points
+ *
+ * The box is mapped to a uniform grid of 2^numBitsPerDim cells in each direction, points outside being clamped.
+ * Providing the box allows to compute consistent keys on all ranks for a distributed point set.
+ */
+void computeKeys( arrayView2d< real64 const > const & points,
+                  CurveType const curveType,
+                  real64 const ( &xMin )[3],
+                  real64 const ( &xMax )[3],
+                  arrayView1d< std::uint64_t > const & keys );
+
+/**
+ * @brief Compute the order of a set of points along a space-filling curve.
+ * @param[in] points the point coordinates
+ * @param[in] curveType the type of curve
+ * @param[out] order the index of the point at each position along the curve
+ *
+ * The points are first mapped to a uniform grid of 2^numBitsPerDim cells in each direction covering their bounding box.
+ * Points sharing a key keep their original relative order.
+ */
+void computeOrdering( arrayView2d< real64 const > const & points,
+                      CurveType const curveType,
+                      arrayView1d< localIndex > const & order );
+
+} // namespace spaceFillingCurve
+
+} // namespace geos
+
+#endif // GEOS_MESH_UTILITIES_SPACEFILLINGCURVE_HPP_
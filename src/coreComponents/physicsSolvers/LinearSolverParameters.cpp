@@ -42,6 +42,14 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setDescription( "Preconditioner type. Available options are: "
                     "``" + EnumStrings< LinearSolverParameters::PreconditionerType >::concat( "|" ) + "``" );
 
+  registerWrapper( viewKeyStruct::preconditionerSinglePrecisionString(), &m_parameters.preconditionerSinglePrecision ).
+    setApplyDefaultValue( m_parameters.preconditionerSinglePrecision ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether the block Jacobi preconditioner of the leading block of the block preconditioner (LagrangianContactSolver) "
+                    "is stored and applied in single precision, the Krylov iterations and residuals remaining in double precision. "
+                    "The Schur complement is then approximated with the diagonal of the leading block. "
+                    "Only supported with the ``block`` preconditioner type" );
+
   registerWrapper( viewKeyStruct::stopIfErrorString(), &m_parameters.stopIfError ).
     setApplyDefaultValue( m_parameters.stopIfError ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -84,6 +92,12 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Whether to use a parallel solver (instead of a serial one)" );
 
+  registerWrapper( viewKeyStruct::directReuseSymbolicString(), &m_parameters.direct.reuseSymbolic ).
+    setApplyDefaultValue( m_parameters.direct.reuseSymbolic ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether the direct solver keeps the fill-reducing ordering and the symbolic analysis of its previous factorization "
+                    "and only recomputes the numeric factorization when the sparsity pattern of the matrix is unchanged" );
+
   registerWrapper( viewKeyStruct::krylovMaxIterString(), &m_parameters.krylov.maxIterations ).
     setApplyDefaultValue( m_parameters.krylov.maxIterations ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -113,6 +127,90 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::krylovBasisBlockSizeString(), &m_parameters.krylov.basisBlockSize ).
+    setApplyDefaultValue( m_parameters.krylov.basisBlockSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Krylov basis vectors computed between two orthogonalizations (s-step GMRES only)" );
+
+  registerWrapper( viewKeyStruct::krylovRecycleSizeString(), &m_parameters.krylov.recycleSize ).
+    setApplyDefaultValue( m_parameters.krylov.recycleSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of vectors of the Krylov subspace recycled from one linear solve to the next "
+                    "to deflate the slowest converging components (GMRES only, 0 disables recycling)" );
+
+  registerWrapper( viewKeyStruct::krylovInnerSolveString(), &m_parameters.krylov.innerSolve ).
+    setApplyDefaultValue( m_parameters.krylov.innerSolve ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "When these parameters describe a block of a block preconditioner, whether the block is solved with the "
+                    "native Krylov method given by ``solverType`` to the tolerance ``krylovTol`` instead of a single application "
+                    "of the preconditioner. With ``krylovAdaptiveTol``, the inner tolerance is relaxed up to ``krylovWeakestTol`` "
+                    "as the outer solve converges. The outer solver must be ``fgmres``" );
+
+  registerWrapper( viewKeyStruct::precondReuseMaxSolvesString(), &m_parameters.reuse.maxSolves ).
+    setApplyDefaultValue( m_parameters.reuse.maxSolves ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of linear solves sharing one preconditioner setup, or one factorization for the direct solver. "
+                    "The setup is kept across Newton iterations and rebuilt after this number of solves, "
+                    "0 rebuilds the preconditioner at every solve" );
+
+  registerWrapper( viewKeyStruct::precondReuseAcrossStepsString(), &m_parameters.reuse.acrossTimeSteps ).
+    setApplyDefaultValue( m_parameters.reuse.acrossTimeSteps ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether a reused preconditioner setup can be kept from one time step to the next" );
+
+  registerWrapper( viewKeyStruct::precondReuseIterGrowthString(), &m_parameters.reuse.iterationGrowth ).
+    setApplyDefaultValue( m_parameters.reuse.iterationGrowth ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "A reused preconditioner is rebuilt once the number of Krylov iterations exceeds "
+                    "this factor times the number of iterations of the first solve after the setup" );
+
+  registerWrapper( viewKeyStruct::precondReuseConstantMatrixString(), &m_parameters.reuse.constantMatrix ).
+    setApplyDefaultValue( m_parameters.reuse.constantMatrix ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether the assembled matrix is compared with the previously assembled one, "
+                    "and the preconditioner setup or factorization kept, across Newton iterations and time steps, for as long as the matrix does not change. "
+                    "For linear problems with a constant time step (e.g. incompressible flow, Laplace), "
+                    "the setup is done once and each step only pays for the assembly and the solve" );
+
+  registerWrapper( viewKeyStruct::mgrAdaptiveString(), &m_parameters.mgr.adaptive ).
+    setApplyDefaultValue( m_parameters.mgr.adaptive ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether the MGR preconditioner switches among candidate configurations of its recipe during the run: "
+                    "a more robust configuration is used when a solve fails or exceeds " +
+                    string( viewKeyStruct::mgrAdaptiveMaxIterString() ) + " iterations, "
+                    "and a cheaper one again after a series of fast solves" );
+
+  registerWrapper( viewKeyStruct::mgrAdaptiveMaxIterString(), &m_parameters.mgr.adaptiveMaxIterations ).
+    setApplyDefaultValue( m_parameters.mgr.adaptiveMaxIterations ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Krylov iterations above which the adaptive MGR mode switches to a more robust configuration" );
+
+  registerWrapper( viewKeyStruct::cprDecouplingString(), &m_parameters.cpr.decouplingType ).
+    setApplyDefaultValue( m_parameters.cpr.decouplingType ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "CPR decoupling of the pressure equation of each cell, with weights computed from the diagonal block (quasiIMPES) "
+                    "or from the sum of the blocks of the block row (trueIMPES). Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::CPR::DecouplingType >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::cprSecondStageString(), &m_parameters.cpr.secondStageType ).
+    setApplyDefaultValue( m_parameters.cpr.secondStageType ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "CPR second stage preconditioner applied to the full system, blockJacobi being the choice for device runs. "
+                    "Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::CPR::SecondStageType >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::cprPressureStageString(), &m_parameters.cpr.pressureStageType ).
+    setApplyDefaultValue( m_parameters.cpr.pressureStageType ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "CPR preconditioner of the pressure stage, gmg being meant for the structured meshes of the internal mesh generator. "
+                    "Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::CPR::PressureStageType >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::gmgMaxCoarseSizeString(), &m_parameters.gmg.maxCoarseSize ).
+    setApplyDefaultValue( m_parameters.gmg.maxCoarseSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Global number of rows below which the geometric multigrid stops coarsening and solves the coarsest level directly" );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString(), &m_parameters.amg.numSweeps ).
     setApplyDefaultValue( m_parameters.amg.numSweeps ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -189,6 +287,25 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setDescription( "AMG near null space approximation. Available options are:"
                     "``" + EnumStrings< LinearSolverParameters::AMG::NullSpaceType >::concat( "|" ) + "``" );
 
+  registerWrapper( viewKeyStruct::amgCoarseAgglomerationSizeString(), &m_parameters.amg.coarseAgglomerationSize ).
+    setApplyDefaultValue( m_parameters.amg.coarseAgglomerationSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "AMG global number of rows below which the coarse levels are gathered on fewer ranks, "
+                    "to cut the communication latency of the coarse levels at large scale (0 to disable, CPU builds of hypre only). "
+                    "Applies to the AMG preconditioner and to the AMG coarse solver of the MGR strategies" );
+
+  registerWrapper( viewKeyStruct::amgCoarseRedundantString(), &m_parameters.amg.coarseRedundant ).
+    setApplyDefaultValue( m_parameters.amg.coarseRedundant ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "AMG flag to solve the gathered coarse levels redundantly on all the ranks (1) instead of on a single rank (0)" );
+
+  registerWrapper( viewKeyStruct::amgCoarseSuperLUDistSizeString(), &m_parameters.amg.coarseSuperLUDistSize ).
+    setApplyDefaultValue( m_parameters.amg.coarseSuperLUDistSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "AMG global number of rows below which the coarsest level is solved with SuperLU_Dist "
+                    "(0 to disable, requires hypre built with SuperLU_Dist). "
+                    "Applies to the AMG preconditioner and to the AMG coarse solver of the MGR strategies" );
+
   registerWrapper( viewKeyStruct::iluFillString(), &m_parameters.ifact.fill ).
     setApplyDefaultValue( m_parameters.ifact.fill ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -209,6 +326,13 @@ void LinearSolverParametersInput::postProcessInput()
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.stopIfError ) == 0,
                  getWrapperDataContext( viewKeyStruct::stopIfErrorString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.preconditionerSinglePrecision ) == 0,
+                 getWrapperDataContext( viewKeyStruct::preconditionerSinglePrecisionString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( m_parameters.preconditionerSinglePrecision &&
+                 m_parameters.preconditionerType != LinearSolverParameters::PreconditionerType::block,
+                 getWrapperDataContext( viewKeyStruct::preconditionerSinglePrecisionString() ) <<
+                 ": single precision is only supported with the block preconditioner" );
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.direct.checkResidual ) == 0,
                  getWrapperDataContext( viewKeyStruct::directCheckResidualString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
@@ -224,6 +348,12 @@ void LinearSolverParametersInput::postProcessInput()
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.direct.parallel ) == 0,
                  getWrapperDataContext( viewKeyStruct::directParallelString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.direct.reuseSymbolic ) == 0,
+                 getWrapperDataContext( viewKeyStruct::directReuseSymbolicString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.krylov.innerSolve ) == 0,
+                 getWrapperDataContext( viewKeyStruct::krylovInnerSolveString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
 
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.maxIterations, 0,
                         getWrapperDataContext( viewKeyStruct::krylovMaxIterString() ) <<
@@ -231,6 +361,12 @@ void LinearSolverParametersInput::postProcessInput()
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.maxRestart, 0,
                         getWrapperDataContext( viewKeyStruct::krylovMaxRestartString() ) <<
                         ": Invalid value." );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.basisBlockSize, 1,
+                        getWrapperDataContext( viewKeyStruct::krylovBasisBlockSizeString() ) <<
+                        ": Invalid value." );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.recycleSize, 0,
+                        getWrapperDataContext( viewKeyStruct::krylovRecycleSizeString() ) <<
+                        ": Invalid value." );
 
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0,
                         getWrapperDataContext( viewKeyStruct::krylovTolString() ) <<
@@ -239,6 +375,29 @@ void LinearSolverParametersInput::postProcessInput()
                         getWrapperDataContext( viewKeyStruct::krylovTolString() ) <<
                         ": Invalid value." );
 
+  GEOS_ERROR_IF_LT_MSG( m_parameters.reuse.maxSolves, 0,
+                        getWrapperDataContext( viewKeyStruct::precondReuseMaxSolvesString() ) <<
+                        ": Invalid value." );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.reuse.acrossTimeSteps ) == 0,
+                 getWrapperDataContext( viewKeyStruct::precondReuseAcrossStepsString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.reuse.iterationGrowth, 1.0,
+                        getWrapperDataContext( viewKeyStruct::precondReuseIterGrowthString() ) <<
+                        ": Invalid value." );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.reuse.constantMatrix ) == 0,
+                 getWrapperDataContext( viewKeyStruct::precondReuseConstantMatrixString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.mgr.adaptive ) == 0,
+                 getWrapperDataContext( viewKeyStruct::mgrAdaptiveString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.mgr.adaptiveMaxIterations, 1,
+                        getWrapperDataContext( viewKeyStruct::mgrAdaptiveMaxIterString() ) <<
+                        ": Invalid value." );
+
+  GEOS_ERROR_IF_LT_MSG( m_parameters.gmg.maxCoarseSize, 1,
+                        getWrapperDataContext( viewKeyStruct::gmgMaxCoarseSizeString() ) <<
+                        ": Invalid value." );
+
   GEOS_ERROR_IF_LT_MSG( m_parameters.ifact.fill, 0,
                         getWrapperDataContext( viewKeyStruct::iluFillString() ) <<
                         ": Invalid value." );
@@ -256,6 +415,16 @@ void LinearSolverParametersInput::postProcessInput()
                         getWrapperDataContext( viewKeyStruct::amgThresholdString() ) <<
                         ": Invalid value." );
 
+  GEOS_ERROR_IF_LT_MSG( m_parameters.amg.coarseAgglomerationSize, 0,
+                        getWrapperDataContext( viewKeyStruct::amgCoarseAgglomerationSizeString() ) <<
+                        ": Invalid value." );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.amg.coarseRedundant ) == 0,
+                 getWrapperDataContext( viewKeyStruct::amgCoarseRedundantString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.amg.coarseSuperLUDistSize, 0,
+                        getWrapperDataContext( viewKeyStruct::amgCoarseSuperLUDistSizeString() ) <<
+                        ": Invalid value." );
+
   // TODO input validation for other AMG parameters ?
 }
 
@@ -72,6 +72,8 @@ public:
     static constexpr char const * solverTypeString() { return "solverType"; }
     /// Preconditioner type key
     static constexpr char const * preconditionerTypeString() { return "preconditionerType"; }
+    /// Preconditioner precision key
+    static constexpr char const * preconditionerSinglePrecisionString() { return "preconditionerSinglePrecision"; }
     /// stop if error key
     static constexpr char const * stopIfErrorString() { return "stopIfError"; }
 
@@ -89,6 +91,8 @@ public:
     static constexpr char const * directIterRefString() { return "directIterRef"; }
     /// direct solver parallelism key
     static constexpr char const * directParallelString() { return "directParallel"; }
+    /// direct solver symbolic factorization reuse key
+    static constexpr char const * directReuseSymbolicString() { return "directReuseSymbolic"; }
 
     /// Krylov max iterations key
     static constexpr char const * krylovMaxIterString() { return "krylovMaxIter"; }
@@ -100,6 +104,36 @@ public:
     static constexpr char const * krylovAdaptiveTolString() { return "krylovAdaptiveTol"; }
     /// Krylov weakest tolerance key
     static constexpr char const * krylovWeakTolString() { return "krylovWeakestTol"; }
+    /// Krylov basis block size key
+    static constexpr char const * krylovBasisBlockSizeString() { return "krylovBasisBlockSize"; }
+    /// Krylov recycled subspace size key
+    static constexpr char const * krylovRecycleSizeString() { return "krylovRecycleSize"; }
+    /// Krylov inner solve key
+    static constexpr char const * krylovInnerSolveString() { return "krylovInnerSolve"; }
+
+    /// Preconditioner reuse max number of solves key
+    static constexpr char const * precondReuseMaxSolvesString() { return "preconditionerReuseMaxSolves"; }
+    /// Preconditioner reuse across time steps key
+    static constexpr char const * precondReuseAcrossStepsString() { return "preconditionerReuseAcrossTimeSteps"; }
+    /// Preconditioner reuse iteration growth key
+    static constexpr char const * precondReuseIterGrowthString() { return "preconditionerReuseIterationGrowth"; }
+    /// Preconditioner reuse for a constant matrix key
+    static constexpr char const * precondReuseConstantMatrixString() { return "preconditionerReuseConstantMatrix"; }
+
+    /// MGR adaptive configuration key
+    static constexpr char const * mgrAdaptiveString() { return "mgrAdaptive"; }
+    /// MGR adaptive configuration max iterations key
+    static constexpr char const * mgrAdaptiveMaxIterString() { return "mgrAdaptiveMaxIter"; }
+
+    /// CPR decoupling type key
+    static constexpr char const * cprDecouplingString() { return "cprDecouplingType"; }
+    /// CPR second stage type key
+    static constexpr char const * cprSecondStageString() { return "cprSecondStageType"; }
+    /// CPR pressure stage type key
+    static constexpr char const * cprPressureStageString() { return "cprPressureStageType"; }
+
+    /// GMG maximum coarse size key
+    static constexpr char const * gmgMaxCoarseSizeString() { return "gmgMaxCoarseSize"; }
 
     /// AMG number of sweeps key
     static constexpr char const * amgNumSweepsString() { return "amgNumSweeps"; }
@@ -129,6 +163,12 @@ public:
     static constexpr char const * amgAggressiveInterpTypeString() { return "amgAggressiveInterpType"; }
     /// AMG separate components flag
     static constexpr char const * amgSeparateComponentsString() { return "amgSeparateComponents"; }
+    /// AMG coarse levels agglomeration size key
+    static constexpr char const * amgCoarseAgglomerationSizeString() { return "amgCoarseAgglomerationSize"; }
+    /// AMG redundant coarse solve flag
+    static constexpr char const * amgCoarseRedundantString() { return "amgCoarseRedundant"; }
+    /// AMG SuperLU_Dist coarse solver size key
+    static constexpr char const * amgCoarseSuperLUDistSizeString() { return "amgCoarseSuperLUDistSize"; }
 
     /// ILU fill key
     static constexpr char const * iluFillString() { return "iluFill"; }
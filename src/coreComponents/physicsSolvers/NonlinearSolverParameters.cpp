@@ -121,6 +121,20 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Factor by which the time step will be cut if a timestep cut is required." );
 
+  registerWrapper( viewKeysStruct::timeStepControlString(), &m_timeStepControl ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( TimeStepControl::Heuristic ).
+    setDescription( "Strategy used to choose the size of the next time step. With PID, the state change estimate of the solver "
+                    "is used as an error estimate, and the ratio between two time steps is bounded by "
+                    "timeStepCutFactor and timeStepIncreaseFactor. "
+                    "Valid options:\n* " + EnumStrings< TimeStepControl >::concat( "\n* " ) );
+
+  registerWrapper( viewKeysStruct::initialGuessString(), &m_initialGuess ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( InitialGuess::PreviousStep ).
+    setDescription( "Initial guess of the Newton loop at the beginning of a time step. "
+                    "Valid options:\n* " + EnumStrings< InitialGuess >::concat( "\n* " ) );
+
   registerWrapper( viewKeysStruct::maxTimeStepCutsString(), &m_maxTimeStepCuts ).
     setApplyDefaultValue( 2 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -154,6 +168,30 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setApplyDefaultValue( 0 ).
     setDescription( "Flag to decide whether to iterate between sequentially coupled solvers or not." );
 
+  registerWrapper( viewKeysStruct::sequentialAccelerationString(), &m_sequentialAcceleration ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( SequentialAcceleration::None ).
+    setDescription( "Acceleration of the outer loop of sequential schemes. "
+                    "Valid options:\n* " + EnumStrings< SequentialAcceleration >::concat( "\n* " ) );
+
+  registerWrapper( viewKeysStruct::sequentialAccelerationDepthString(), &m_sequentialAccelerationDepth ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 5 ).
+    setDescription( "Number of previous iterations used by the Anderson acceleration of sequential schemes." );
+
+  registerWrapper( viewKeysStruct::jacobianFreeString(), &m_jacobianFree ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to use a Jacobian-free Newton-Krylov method. "
+                    "The Jacobian assembled at the first Newton iteration of the time step is only used as the preconditioner, "
+                    "and the Jacobian-vector products are approximated by finite differences of the residual." );
+
+  registerWrapper( viewKeysStruct::jacobianFreePerturbationString(), &m_jacobianFreePerturbation ).
+    setInputFlag( dataRepository::InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1e-4 ).
+    setDescription( "Largest change of the primary variables used in the finite-difference approximation "
+                    "of the Jacobian-vector products of the Jacobian-free Newton-Krylov method." );
+
 }
 
 void NonlinearSolverParameters::postProcessInput()
@@ -161,6 +199,14 @@ void NonlinearSolverParameters::postProcessInput()
   GEOS_ERROR_IF_LE_MSG( m_timeStepDecreaseIterLimit, m_timeStepIncreaseIterLimit,
                         getWrapperDataContext( viewKeysStruct::timeStepIncreaseIterLimString() ) <<
                         ": should be smaller than " << viewKeysStruct::timeStepDecreaseIterLimString() );
+
+  GEOS_ERROR_IF_LE_MSG( m_sequentialAccelerationDepth, 0,
+                        getWrapperDataContext( viewKeysStruct::sequentialAccelerationDepthString() ) <<
+                        ": should be positive" );
+
+  GEOS_ERROR_IF_LE_MSG( m_jacobianFreePerturbation, 0.0,
+                        getWrapperDataContext( viewKeysStruct::jacobianFreePerturbationString() ) <<
+                        ": should be positive" );
 }
 
 
@@ -89,6 +89,10 @@ public:
     static constexpr char const * maxTimeStepCutsString()         { return "maxTimeStepCuts"; }
     static constexpr char const * minNumNewtonIterationsString()  { return "minNumberOfNewtonIterations"; }
     static constexpr char const * timeStepCutFactorString()       { return "timeStepCutFactor"; }
+    static constexpr char const * timeStepControlString()         { return "timeStepControl"; }
+    static constexpr char const * initialGuessString()            { return "initialGuess"; }
+    static constexpr char const * jacobianFreeString()            { return "jacobianFree"; }
+    static constexpr char const * jacobianFreePerturbationString() { return "jacobianFreePerturbation"; }
     static constexpr char const * maxAllowedResidualNormString()  { return "maxAllowedResidualNorm"; }
 
     static constexpr char const * numConfigurationAttemptsString()    { return "numConfigurationAttempts"; }
@@ -97,6 +101,8 @@ public:
     static constexpr char const * couplingTypeString()                   { return "couplingType"; }
     static constexpr char const * sequentialConvergenceCriterionString() { return "sequentialConvergenceCriterion"; }
     static constexpr char const * subcyclingOptionString()               { return "subcycling"; }
+    static constexpr char const * sequentialAccelerationString()         { return "sequentialAcceleration"; }
+    static constexpr char const * sequentialAccelerationDepthString()    { return "sequentialAccelerationDepth"; }
   } viewKeys;
 
   /**
@@ -136,6 +142,34 @@ public:
     NumberOfNonlinearIterations ///< convergence achieved when the subproblems convergence is achieved in less than minNewtonIteration
   };
 
+  /**
+   * @brief Acceleration of the outer loop of sequential schemes
+   */
+  enum class SequentialAcceleration : integer
+  {
+    None,     ///< plain fixed-point iteration
+    Aitken,   ///< dynamic relaxation with the Aitken factor
+    Anderson, ///< Anderson acceleration over the last iterations
+  };
+
+  /**
+   * @brief Strategy used to choose the size of the next time step
+   */
+  enum class TimeStepControl : integer
+  {
+    Heuristic, ///< increase or decrease the time step by fixed factors based on the Newton iterations and the state change
+    PID,       ///< proportional-integral-derivative controller on the history of the state change error estimates
+  };
+
+  /**
+   * @brief Initial guess of the Newton loop at the beginning of a time step
+   */
+  enum class InitialGuess : integer
+  {
+    PreviousStep,  ///< start from the solution of the previous time step
+    Extrapolation, ///< linear extrapolation in time of the solutions of the two previous time steps
+  };
+
   /**
    * @brief Calculates the upper limit for the number of iterations to allow a
    * decrease to the next time step.
@@ -175,6 +209,33 @@ public:
     return m_timeStepIncreaseFactor;
   }
 
+  /**
+   * @brief Getter for the acceleration of the outer loop of sequential schemes
+   * @return the acceleration of the outer loop of sequential schemes
+   */
+  SequentialAcceleration sequentialAcceleration() const
+  {
+    return m_sequentialAcceleration;
+  }
+
+  /**
+   * @brief Getter for the time step control strategy
+   * @return the time step control strategy
+   */
+  TimeStepControl timeStepControl() const
+  {
+    return m_timeStepControl;
+  }
+
+  /**
+   * @brief Getter for the initial guess of the Newton loop
+   * @return the initial guess of the Newton loop
+   */
+  InitialGuess initialGuess() const
+  {
+    return m_initialGuess;
+  }
+
   /**
    * @brief Getter for the norm type used to check convergence in the flow/well solvers
    * @return the norm type
@@ -256,6 +317,18 @@ public:
   /// Factor by which the time step will be cut if a timestep cut is required.
   real64 m_timeStepCutFactor;
 
+  /// Strategy used to choose the size of the next time step
+  TimeStepControl m_timeStepControl;
+
+  /// Initial guess of the Newton loop at the beginning of a time step
+  InitialGuess m_initialGuess;
+
+  /// Flag to approximate the Jacobian-vector products by finite differences of the residual
+  integer m_jacobianFree;
+
+  /// Largest change of the primary variables used in the finite-difference Jacobian-vector products
+  real64 m_jacobianFreePerturbation;
+
   /// Number of times that the time-step had to be cut
   integer m_numTimeStepAttempts;
 
@@ -274,6 +347,12 @@ public:
   /// Flag to specify whether subcycling is allowed or not in sequential schemes
   integer m_subcyclingOption;
 
+  /// Acceleration of the outer loop of sequential schemes
+  SequentialAcceleration m_sequentialAcceleration;
+
+  /// Number of previous iterations used by the Anderson acceleration
+  integer m_sequentialAccelerationDepth;
+
   /// Value used to make sure that residual normalizers are not too small when computing residual norm
   real64 m_minNormalizer = 1e-12;
 };
@@ -291,6 +370,19 @@ ENUM_STRINGS( NonlinearSolverParameters::CouplingType,
               "FullyImplicit",
               "Sequential" );
 
+ENUM_STRINGS( NonlinearSolverParameters::SequentialAcceleration,
+              "None",
+              "Aitken",
+              "Anderson" );
+
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControl,
+              "Heuristic",
+              "PID" );
+
+ENUM_STRINGS( NonlinearSolverParameters::InitialGuess,
+              "PreviousStep",
+              "Extrapolation" );
+
 ENUM_STRINGS( NonlinearSolverParameters::SequentialConvergenceCriterion,
               "ResidualNorm",
               "NumberOfNonlinearIterations" );
@@ -17,6 +17,7 @@
 
 #include "common/TimingMacros.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+#include "linearAlgebra/solvers/GmresSolver.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "math/interpolation/Interpolation.hpp"
@@ -38,6 +39,9 @@ SolverBase::SolverBase( string const & name,
   m_cflFactor(),
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
+  m_initialDt( 1e99 ),
+  m_previousDt( 0.0 ),
+  m_previousErrors{ 1.0, 1.0 },
   m_dofManager( name ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString(), this ),
   m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString(), this ),
@@ -88,6 +92,14 @@ SolverBase::SolverBase( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "Initial time-step value required by the solver to the event manager." );
 
+  registerWrapper( viewKeyStruct::performanceLogFileString(), &m_performanceLogFile ).
+    setApplyDefaultValue( "" ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Name of the file in which a performance record (wall time per phase, iterations, time step cuts, "
+                    "memory high-water mark) is written by rank 0 at each time step, in the JSON lines format. "
+                    "If empty, no record is written." );
+
   registerGroup( groupKeyStruct::linearSolverParametersString(), &m_linearSolverParameters );
   registerGroup( groupKeyStruct::nonlinearSolverParametersString(), &m_nonlinearSolverParameters );
   registerGroup( groupKeyStruct::solverStatisticsString(), &m_solverStatistics );
@@ -101,6 +113,7 @@ SolverBase::~SolverBase() = default;
 void SolverBase::initialize_postMeshGeneration()
 {
   ExecutableGroup::initialize_postMeshGeneration();
+  m_initialDt = m_nextDt;
   DomainPartition const & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
   generateMeshTargetsFromTargetRegions( domain.getMeshBodies());
 }
@@ -223,6 +236,7 @@ real64 SolverBase::solverStep( real64 const & time_n,
 
   // currently the only method is implicit time integration
   real64 const dt_return = nonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  m_previousDt = dt_return;
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   implicitStepComplete( time_n, dt_return, domain );
@@ -248,6 +262,10 @@ bool SolverBase::execute( real64 const time_n,
     // reset number of nonlinear and linear iterations
     m_solverStatistics.initializeTimeStepStatistics();
 
+    bool const logPerformance = !m_performanceLogFile.empty();
+    std::map< std::string, std::chrono::system_clock::duration > const timersBefore = logPerformance ? m_timers : decltype( m_timers ){};
+    std::chrono::system_clock::time_point const stepStart = std::chrono::system_clock::now();
+
     real64 const dtAccepted = solverStep( time_n + (dt - dtRemaining),
                                           nextDt,
                                           cycleNumber,
@@ -256,6 +274,24 @@ bool SolverBase::execute( real64 const time_n,
     // increment the cumulative number of nonlinear and linear iterations
     m_solverStatistics.saveTimeStepStatistics();
 
+    if( logPerformance )
+    {
+      std::map< string, real64 > phaseTimes;
+      for( auto const & timer : m_timers )
+      {
+        auto const before = timersBefore.find( timer.first );
+        std::chrono::system_clock::duration const elapsed =
+          before == timersBefore.end() ? timer.second : timer.second - before->second;
+        phaseTimes[timer.first] = std::chrono::duration< real64 >( elapsed ).count();
+      }
+      m_solverStatistics.logTimeStepRecord( m_performanceLogFile,
+                                            time_n + (dt - dtRemaining),
+                                            dtAccepted,
+                                            cycleNumber,
+                                            std::chrono::duration< real64 >( std::chrono::system_clock::now() - stepStart ).count(),
+                                            phaseTimes );
+    }
+
     /*
      * Let us check convergence history of previous solve:
      * - number of nonlinear iter.
@@ -290,6 +326,14 @@ real64 SolverBase::setNextDt( real64 const & currentDt,
   real64 const nextDtNewton = setNextDtBasedOnNewtonIter( currentDt );
   real64 const nextDtStateChange = setNextDtBasedOnStateChange( currentDt, domain );
 
+  if( m_nonlinearSolverParameters.timeStepControl() == NonlinearSolverParameters::TimeStepControl::PID &&
+      nextDtStateChange < LvArray::NumericLimits< real64 >::max )
+  {
+    real64 const nextDtErrorHistory = setNextDtBasedOnErrorHistory( currentDt, nextDtStateChange );
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: Time-step required by the PID controller: {}", getName(), nextDtErrorHistory ) );
+    return std::min( nextDtNewton, nextDtErrorHistory );
+  }
+
   if( nextDtNewton < nextDtStateChange ) // time step size decided based on convergence
   {
     integer const iterDecreaseLimit = m_nonlinearSolverParameters.timeStepDecreaseIterLimit();
@@ -329,6 +373,34 @@ real64 SolverBase::setNextDtBasedOnStateChange( real64 const & currentDt,
   return LvArray::NumericLimits< real64 >::max; // i.e., not implemented
 }
 
+real64 SolverBase::setNextDtBasedOnErrorHistory( real64 const & currentDt,
+                                                 real64 const & nextDtStateChange )
+{
+  // gains of the PID controller
+  real64 constexpr kP = 0.075;
+  real64 constexpr kI = 0.175;
+  real64 constexpr kD = 0.01;
+
+  // a time step cut means that the error history no longer describes the solution, restart it
+  if( m_nonlinearSolverParameters.m_numTimeStepAttempts > 0 )
+  {
+    m_previousErrors[0] = 1.0;
+    m_previousErrors[1] = 1.0;
+  }
+
+  real64 const error = std::max( currentDt / nextDtStateChange, LvArray::NumericLimits< real64 >::epsilon );
+  real64 const factor = std::pow( m_previousErrors[0] / error, kP ) *
+                        std::pow( 1.0 / error, kI ) *
+                        std::pow( m_previousErrors[0] * m_previousErrors[0] / ( error * m_previousErrors[1] ), kD );
+
+  m_previousErrors[1] = m_previousErrors[0];
+  m_previousErrors[0] = error;
+
+  real64 const minFactor = m_nonlinearSolverParameters.m_timeStepCutFactor;
+  real64 const maxFactor = m_nonlinearSolverParameters.timeStepIncreaseFactor();
+  return currentDt * std::min( maxFactor, std::max( minFactor, factor ) );
+}
+
 real64 SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt )
 {
   integer & newtonIter = m_nonlinearSolverParameters.m_numNewtonIterations;
@@ -353,6 +425,16 @@ real64 SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt )
   return nextDt;
 }
 
+real64 SolverBase::initialGuessExtrapolationFactor( real64 const & dt ) const
+{
+  if( m_nonlinearSolverParameters.initialGuess() == NonlinearSolverParameters::InitialGuess::Extrapolation &&
+      m_previousDt > 0.0 )
+  {
+    return dt / m_previousDt;
+  }
+  return 0.0;
+}
+
 real64 SolverBase::linearImplicitStep( real64 const & time_n,
                                        real64 const & dt,
                                        integer const GEOS_UNUSED_PARAM( cycleNumber ),
@@ -401,8 +483,10 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   {
     Timer timer( m_timers["linear solver total"] );
 
+    checkMatrixChange();
+
     // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-    if( m_precond )
+    if( m_precond && m_matrixChanged )
     {
       m_precond->clear();
     }
@@ -509,7 +593,7 @@ bool SolverBase::lineSearch( real64 const & time_n,
       rhs.zero();
 
       arrayView1d< real64 > const localRhs = rhs.open();
-      assembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
+      assembleResidual( time_n, dt, domain, dofManager, localMatrix, localRhs );
       applyBoundaryConditions( time_n, dt, domain, dofManager, localMatrix, localRhs );
       rhs.close();
     }
@@ -615,12 +699,11 @@ bool SolverBase::lineSearchWithParabolicInterpolation( real64 const & time_n,
       Timer timer( m_timers["assemble"] );
 
       // re-assemble system
-      // TODO: add a flag to avoid a completely useless Jacobian computation: rhs is enough
       localMatrix.zero();
       rhs.zero();
 
       arrayView1d< real64 > const localRhs = rhs.open();
-      assembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
+      assembleResidual( time_n, dt, domain, dofManager, localMatrix, localRhs );
       applyBoundaryConditions( time_n, dt, domain, dofManager, localMatrix, localRhs );
       rhs.close();
     }
@@ -717,6 +800,17 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
 
   integer & dtAttempt = m_nonlinearSolverParameters.m_numTimeStepAttempts;
 
+  // a reused preconditioner is rebuilt at the beginning of the time step unless requested otherwise;
+  // the solvers of a sequential coupling call this function at every coupling iteration of the same
+  // step, in which case the preconditioner is kept (and only rebuilt by the iteration growth criterion)
+  if( !m_linearSolverParameters.get().reuse.acrossTimeSteps &&
+      ( time_n != m_reusedPrecondTime || dt != m_reusedPrecondDt ) )
+  {
+    m_reusedPrecondExpired = true;
+  }
+  m_reusedPrecondTime = time_n;
+  m_reusedPrecondDt = dt;
+
   integer const & maxConfigurationIter = m_nonlinearSolverParameters.m_maxNumConfigurationAttempts;
 
   integer & configurationLoopIter = m_nonlinearSolverParameters.m_numConfigurationAttempts;
@@ -825,6 +919,7 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
   integer & configurationLoopIter = m_nonlinearSolverParameters.m_numConfigurationAttempts;
   integer const minNewtonIter = m_nonlinearSolverParameters.m_minIterNewton;
   real64 const newtonTol = m_nonlinearSolverParameters.m_newtonTol;
+  bool const jacobianFree = m_nonlinearSolverParameters.m_jacobianFree;
 
   // keep residual from previous iteration in case we need to do a line search
   real64 lastResidual = 1e99;
@@ -846,13 +941,26 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
 
       arrayView1d< real64 > const localRhs = m_rhs.open();
 
-      // call assemble to fill the matrix and the rhs
-      assembleSystem( time_n,
-                      stepDt,
-                      domain,
-                      m_dofManager,
-                      m_localMatrix.toViewConstSizes(),
-                      localRhs );
+      // in Jacobian-free mode, the matrix is only needed at the first iteration to set up the preconditioner
+      if( jacobianFree && newtonIter > 0 )
+      {
+        assembleResidual( time_n,
+                          stepDt,
+                          domain,
+                          m_dofManager,
+                          m_localMatrix.toViewConstSizes(),
+                          localRhs );
+      }
+      else
+      {
+        // call assemble to fill the matrix and the rhs
+        assembleSystem( time_n,
+                        stepDt,
+                        domain,
+                        m_dofManager,
+                        m_localMatrix.toViewConstSizes(),
+                        localRhs );
+      }
 
       // apply boundary conditions to system
       applyBoundaryConditions( time_n,
@@ -943,6 +1051,21 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
                                                                   residualNorm );
       }
 
+      // the line search only assembled the residual, but the linear solve needs the Jacobian at the accepted solution
+      if( !jacobianFree && hasResidualOnlyAssembly() &&
+          ( lineSearchSuccess || m_nonlinearSolverParameters.m_lineSearchAction == NonlinearSolverParameters::LineSearchAction::Attempt ) )
+      {
+        Timer timer( m_timers["assemble"] );
+
+        m_localMatrix.zero();
+        m_rhs.zero();
+
+        arrayView1d< real64 > const localRhs = m_rhs.open();
+        assembleSystem( time_n, stepDt, domain, m_dofManager, m_localMatrix.toViewConstSizes(), localRhs );
+        applyBoundaryConditions( time_n, stepDt, domain, m_dofManager, m_localMatrix.toViewConstSizes(), localRhs );
+        m_rhs.close();
+      }
+
       if( !lineSearchSuccess )
       {
         if( m_nonlinearSolverParameters.m_lineSearchAction == NonlinearSolverParameters::LineSearchAction::Attempt )
@@ -968,13 +1091,24 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
     {
       Timer timer( m_timers["linear solver total"] );
 
-      // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-      if( m_precond )
+      // in Jacobian-free mode, the matrix assembled at the first iteration is kept for the preconditioner
+      if( !jacobianFree || newtonIter == 0 )
       {
-        m_precond->clear();
-      }
+        if( !jacobianFree )
+        {
+          checkMatrixChange();
+        }
+
+        // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
+        if( m_precond && ( jacobianFree || m_matrixChanged ) )
+        {
+          m_precond->clear();
+        }
+        if( jacobianFree && m_reusedPrecond )
+        {
+          m_reusedPrecond->clear();
+        }
 
-      {
         Timer timer_setup( m_timers["linear solver create"] );
 
         // Compose parallel LA matrix/rhs out of local LA matrix/rhs
@@ -986,7 +1120,14 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
       debugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
 
       // Solve the linear system
-      solveLinearSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+      if( jacobianFree )
+      {
+        solveJacobianFreeSystem( time_n, stepDt, newtonIter == 0, domain );
+      }
+      else
+      {
+        solveLinearSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+      }
     }
 
     // Increment the solver statistics for reporting purposes
@@ -1091,6 +1232,16 @@ void SolverBase::assembleSystem( real64 const GEOS_UNUSED_PARAM( time ),
   GEOS_ERROR( "SolverBase::Assemble called!. Should be overridden." );
 }
 
+void SolverBase::assembleResidual( real64 const time,
+                                   real64 const dt,
+                                   DomainPartition & domain,
+                                   DofManager const & dofManager,
+                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                   arrayView1d< real64 > const & localRhs )
+{
+  assembleSystem( time, dt, domain, dofManager, localMatrix, localRhs );
+}
+
 void SolverBase::applyBoundaryConditions( real64 const GEOS_UNUSED_PARAM( time ),
                                           real64 const GEOS_UNUSED_PARAM( dt ),
                                           DomainPartition & GEOS_UNUSED_PARAM( domain ),
@@ -1206,7 +1357,66 @@ void SolverBase::solveLinearSystem( DofManager const & dofManager,
   LinearSolverParameters const & params = m_linearSolverParameters.get();
   matrix.setDofManager( &dofManager );
 
-  if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
+  std::chrono::system_clock::duration const setupTimeBefore = m_timers["linear solver setup"];
+  std::chrono::system_clock::duration const solveTimeBefore = m_timers["linear solver solve"];
+
+  // with a constant matrix, the setup is kept for as long as the assembled matrix does not change,
+  // regardless of the time steps and of the other reuse criteria
+  bool const constantMatrix = params.reuse.constantMatrix > 0;
+  if( constantMatrix )
+  {
+    m_reusedPrecondExpired = m_matrixChanged && ( params.reuse.maxSolves == 0 || m_reusedPrecondExpired );
+    m_matrixChanged = true;
+  }
+
+  bool const reusePrecond = ( params.reuse.maxSolves > 0 || constantMatrix ) &&
+                            params.solverType != LinearSolverParameters::SolverType::direct &&
+                            params.solverType != LinearSolverParameters::SolverType::preconditioner;
+
+  // the communication-avoiding Krylov methods, the subspace recycling and the native preconditioners (CPR, GMG)
+  // are only provided by the native solvers
+  bool const nativeKrylov = params.solverType == LinearSolverParameters::SolverType::pipecg ||
+                            params.solverType == LinearSolverParameters::SolverType::pipegmres ||
+                            params.solverType == LinearSolverParameters::SolverType::sstepgmres ||
+                            ( params.solverType == LinearSolverParameters::SolverType::gmres && params.krylov.recycleSize > 0 ) ||
+                            params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr ||
+                            params.preconditionerType == LinearSolverParameters::PreconditionerType::gmg;
+
+  // a direct solver can keep its factorization for several solves, e.g. when the matrix does not change between iterations,
+  // or only its symbolic analysis, which requires the solver to persist across the solves
+  bool const reuseFactorization = ( params.reuse.maxSolves > 0 || constantMatrix || params.direct.reuseSymbolic ) &&
+                                  params.solverType == LinearSolverParameters::SolverType::direct;
+
+  if( reuseFactorization )
+  {
+    if( !m_reusedDirectSolver ||
+        m_reusedPrecondExpired ||
+        m_reusedPrecondMatrix.numGlobalRows() != matrix.numGlobalRows() ||
+        m_reusedPrecondMatrix.numLocalRows() != matrix.numLocalRows() )
+    {
+      Timer timer_setup( m_timers["linear solver setup"] );
+      m_reusedPrecondMatrix = matrix;
+      m_reusedPrecondMatrix.setDofManager( &dofManager );
+      if( !m_reusedDirectSolver )
+      {
+        m_reusedDirectSolver = LAInterface::createSolver( params );
+      }
+      m_reusedDirectSolver->setup( m_reusedPrecondMatrix );
+      m_reusedPrecondNumSolves = 0;
+      m_reusedPrecondExpired = false;
+      GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "        {}: direct solver factorization", getName() ) );
+    }
+    {
+      Timer timer_setup( m_timers["linear solver solve"] );
+      m_reusedDirectSolver->solve( rhs, solution );
+    }
+    m_linearSolverResult = m_reusedDirectSolver->result();
+
+    ++m_reusedPrecondNumSolves;
+    m_reusedPrecondExpired = !m_linearSolverResult.success() ||
+                             m_reusedPrecondNumSolves >= params.reuse.maxSolves;
+  }
+  else if( params.solverType == LinearSolverParameters::SolverType::direct || ( !m_precond && !reusePrecond && !nativeKrylov ) )
   {
     std::unique_ptr< LinearSolverBase< LAInterface > > solver = LAInterface::createSolver( params );
     {
@@ -1219,18 +1429,79 @@ void SolverBase::solveLinearSystem( DofManager const & dofManager,
     }
     m_linearSolverResult = solver->result();
   }
-  else
+  else if( m_precond && !reusePrecond )
   {
     {
       Timer timer_setup( m_timers["linear solver setup"] );
       m_precond->setup( matrix );
     }
     std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
+    setKrylovRecycleSpace( *solver );
+    {
+      Timer timer_setup( m_timers["linear solver solve"] );
+      solver->solve( rhs, solution );
+    }
+    m_linearSolverResult = solver->result();
+  }
+  else
+  {
+    if( !m_precond && !m_reusedPrecond )
+    {
+      m_reusedPrecond = LAInterface::createPreconditioner( params );
+    }
+    PreconditionerBase< LAInterface > & precond = m_precond ? *m_precond : *m_reusedPrecond;
+
+    if( !reusePrecond )
+    {
+      Timer timer_setup( m_timers["linear solver setup"] );
+      precond.setup( matrix );
+    }
+    // the preconditioner is set up on a copy of the matrix, since the system matrix is recreated at every Newton iteration
+    else if( m_reusedPrecondExpired ||
+             m_reusedPrecondMatrix.numGlobalRows() != matrix.numGlobalRows() ||
+             m_reusedPrecondMatrix.numLocalRows() != matrix.numLocalRows() )
+    {
+      Timer timer_setup( m_timers["linear solver setup"] );
+      m_reusedPrecondMatrix = matrix;
+      m_reusedPrecondMatrix.setDofManager( &dofManager );
+      precond.setup( m_reusedPrecondMatrix );
+      m_reusedPrecondNumSolves = 0;
+      m_reusedPrecondExpired = false;
+      GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "        {}: preconditioner setup", getName() ) );
+    }
+
+    // the preconditioner built from the parameters does not change between two setups, so flexible GMRES is not needed,
+    // unlike for the custom preconditioners of the physics solvers, which may involve inner Krylov solves
+    LinearSolverParameters krylovParams = params;
+    if( !m_precond && krylovParams.solverType == LinearSolverParameters::SolverType::fgmres )
+    {
+      krylovParams.solverType = LinearSolverParameters::SolverType::gmres;
+    }
+    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( krylovParams, matrix, precond );
+    setKrylovRecycleSpace( *solver );
     {
       Timer timer_setup( m_timers["linear solver solve"] );
       solver->solve( rhs, solution );
     }
     m_linearSolverResult = solver->result();
+
+    // decide whether the next solve can still use the current setup
+    if( m_reusedPrecondNumSolves == 0 )
+    {
+      m_reusedPrecondSetupIterations = LvArray::math::max( m_linearSolverResult.numIterations, 1 );
+    }
+    ++m_reusedPrecondNumSolves;
+    m_reusedPrecondExpired = !m_linearSolverResult.success() ||
+                             m_reusedPrecondNumSolves >= params.reuse.maxSolves ||
+                             m_linearSolverResult.numIterations > params.reuse.iterationGrowth * m_reusedPrecondSetupIterations;
+  }
+
+  m_solverStatistics.logLinearSolve( std::chrono::duration< real64 >( m_timers["linear solver setup"] - setupTimeBefore ).count(),
+                                     std::chrono::duration< real64 >( m_timers["linear solver solve"] - solveTimeBefore ).count() );
+
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::mgr && params.mgr.adaptive )
+  {
+    updateMGRConfiguration();
   }
 
   if( params.stopIfError )
@@ -1243,6 +1514,269 @@ void SolverBase::solveLinearSystem( DofManager const & dofManager,
   }
 }
 
+void SolverBase::checkMatrixChange()
+{
+  m_matrixChanged = true;
+  if( !m_linearSolverParameters.get().reuse.constantMatrix )
+  {
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  CRSMatrixView< real64 const, globalIndex const > const current = m_localMatrix.toViewConst();
+  CRSMatrixView< real64 const, globalIndex const > const previous = m_constantMatrixCopy.toViewConst();
+
+  integer changed = current.numRows() != previous.numRows() || current.numNonZeros() != previous.numNonZeros();
+  if( !changed )
+  {
+    // the entries assembled with atomics may differ by round-off from one assembly to the next
+    real64 constexpr relTol = 1.0e-12;
+    RAJA::ReduceMax< parallelDeviceReduce, integer > rowChanged( 0 );
+    forAll< parallelDevicePolicy<> >( current.numRows(), [current, previous, rowChanged] GEOS_HOST_DEVICE ( localIndex const row )
+    {
+      localIndex const numEntries = current.numNonZeros( row );
+      if( numEntries != previous.numNonZeros( row ) )
+      {
+        rowChanged.max( 1 );
+        return;
+      }
+      arraySlice1d< globalIndex const > const currentCols = current.getColumns( row );
+      arraySlice1d< globalIndex const > const previousCols = previous.getColumns( row );
+      arraySlice1d< real64 const > const currentVals = current.getEntries( row );
+      arraySlice1d< real64 const > const previousVals = previous.getEntries( row );
+      for( localIndex k = 0; k < numEntries; ++k )
+      {
+        if( currentCols[k] != previousCols[k] ||
+            LvArray::math::abs( currentVals[k] - previousVals[k] ) >
+            relTol * ( LvArray::math::abs( currentVals[k] ) + LvArray::math::abs( previousVals[k] ) ) )
+        {
+          rowChanged.max( 1 );
+          return;
+        }
+      }
+    } );
+    changed = rowChanged.get();
+  }
+
+  // the preconditioner setup is collective, so all the ranks must take the same decision
+  m_matrixChanged = MpiWrapper::max( changed, MPI_COMM_GEOSX ) > 0;
+  if( m_matrixChanged )
+  {
+    m_constantMatrixCopy = m_localMatrix;
+  }
+  GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "        {}: the matrix {}", getName(), m_matrixChanged ? "changed" : "is unchanged" ) );
+}
+
+void SolverBase::setKrylovRecycleSpace( KrylovSolver< ParallelVector > & solver )
+{
+  // the recycled subspace must outlive the solver object, which is recreated at every linear solve
+  if( GmresSolver< ParallelVector > * const gmres = dynamic_cast< GmresSolver< ParallelVector > * >( &solver ) )
+  {
+    gmres->setRecycleSpace( m_krylovRecycleSpace );
+  }
+}
+
+namespace
+{
+
+/**
+ * @class JacobianFreeOperator
+ * @brief Jacobian of the residual assembled by a physics solver, applied without being assembled
+ *
+ * The product with a vector v is approximated by ( R( x + h v ) - R( x ) ) / h, where h is chosen so that
+ * the largest change of the primary variables equals the perturbation. As in the line search, the
+ * perturbation is applied to the fields of the solver and removed after each product.
+ */
+class JacobianFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  JacobianFreeOperator( SolverBase & solver,
+                        real64 const time_n,
+                        real64 const dt,
+                        real64 const perturbation,
+                        DomainPartition & domain,
+                        DofManager const & dofManager,
+                        CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                        ParallelMatrix const & matrix,
+                        ParallelVector const & residual ):
+    m_solver( solver ),
+    m_time_n( time_n ),
+    m_dt( dt ),
+    m_perturbation( perturbation ),
+    m_domain( domain ),
+    m_dofManager( dofManager ),
+    m_localMatrix( localMatrix ),
+    m_matrix( matrix ),
+    m_residual( residual )
+  {
+    m_perturbedResidual.create( residual.localSize(), residual.comm() );
+  }
+
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override
+  {
+    real64 const srcNorm = src.normInf();
+    if( srcNorm <= 0.0 )
+    {
+      dst.zero();
+      return;
+    }
+    real64 const h = m_perturbation / srcNorm;
+
+    m_solver.applySystemSolution( m_dofManager, src.values(), h, m_dt, m_domain );
+    m_solver.updateState( m_domain );
+
+    // the matrix assembled here is discarded, the preconditioner uses the parallel matrix
+    m_localMatrix.zero();
+    m_perturbedResidual.zero();
+    arrayView1d< real64 > const localRhs = m_perturbedResidual.open();
+    m_solver.assembleResidual( m_time_n, m_dt, m_domain, m_dofManager, m_localMatrix, localRhs );
+    m_solver.applyBoundaryConditions( m_time_n, m_dt, m_domain, m_dofManager, m_localMatrix, localRhs );
+    m_perturbedResidual.close();
+
+    m_solver.applySystemSolution( m_dofManager, src.values(), -h, m_dt, m_domain );
+    m_solver.updateState( m_domain );
+
+    dst.copy( m_perturbedResidual );
+    dst.axpy( -1.0, m_residual );
+    dst.scale( 1.0 / h );
+  }
+
+  virtual globalIndex numGlobalRows() const override { return m_matrix.numGlobalRows(); }
+
+  virtual globalIndex numGlobalCols() const override { return m_matrix.numGlobalCols(); }
+
+  virtual localIndex numLocalRows() const override { return m_matrix.numLocalRows(); }
+
+  virtual localIndex numLocalCols() const override { return m_matrix.numLocalCols(); }
+
+  virtual MPI_Comm comm() const override { return m_matrix.comm(); }
+
+private:
+
+  SolverBase & m_solver;
+  real64 const m_time_n;
+  real64 const m_dt;
+  real64 const m_perturbation;
+  DomainPartition & m_domain;
+  DofManager const & m_dofManager;
+  CRSMatrixView< real64, globalIndex const > const m_localMatrix;
+  ParallelMatrix const & m_matrix;
+  ParallelVector const & m_residual;
+  mutable ParallelVector m_perturbedResidual;
+};
+
+} // namespace
+
+void SolverBase::solveJacobianFreeSystem( real64 const & time_n,
+                                          real64 const & dt,
+                                          bool const setupPreconditioner,
+                                          DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  GEOS_ERROR_IF( params.solverType == LinearSolverParameters::SolverType::direct ||
+                 params.solverType == LinearSolverParameters::SolverType::preconditioner,
+                 getDataContext() << ": the Jacobian-free Newton-Krylov method requires a Krylov linear solver" );
+
+  std::chrono::system_clock::duration const setupTimeBefore = m_timers["linear solver setup"];
+  std::chrono::system_clock::duration const solveTimeBefore = m_timers["linear solver solve"];
+
+  if( !m_precond && !m_reusedPrecond )
+  {
+    m_reusedPrecond = LAInterface::createPreconditioner( params );
+  }
+  PreconditionerBase< LAInterface > & precond = m_precond ? *m_precond : *m_reusedPrecond;
+
+  if( setupPreconditioner )
+  {
+    Timer timer_setup( m_timers["linear solver setup"] );
+    m_matrix.setDofManager( &m_dofManager );
+    precond.setup( m_matrix );
+  }
+
+  // the finite differences need the residual itself, and the right-hand side of the Newton system is its opposite
+  ParallelVector const residual( m_rhs );
+  m_rhs.scale( -1.0 );
+  m_solution.zero();
+
+  JacobianFreeOperator const jacobian( *this,
+                                       time_n,
+                                       dt,
+                                       m_nonlinearSolverParameters.m_jacobianFreePerturbation,
+                                       domain,
+                                       m_dofManager,
+                                       m_localMatrix.toViewConstSizes(),
+                                       m_matrix,
+                                       residual );
+
+  // the preconditioner does not change during the solve, so flexible GMRES is not needed
+  LinearSolverParameters krylovParams = params;
+  if( krylovParams.solverType == LinearSolverParameters::SolverType::fgmres )
+  {
+    krylovParams.solverType = LinearSolverParameters::SolverType::gmres;
+  }
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( krylovParams, jacobian, precond );
+  {
+    Timer timer_setup( m_timers["linear solver solve"] );
+    solver->solve( m_rhs, m_solution );
+  }
+  m_linearSolverResult = solver->result();
+
+  m_solverStatistics.logLinearSolve( std::chrono::duration< real64 >( m_timers["linear solver setup"] - setupTimeBefore ).count(),
+                                     std::chrono::duration< real64 >( m_timers["linear solver solve"] - solveTimeBefore ).count() );
+
+  if( params.stopIfError )
+  {
+    GEOS_ERROR_IF( m_linearSolverResult.breakdown(), getDataContext() << ": Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOS_WARNING_IF( !m_linearSolverResult.success(), getDataContext() << ": Linear solution failed" );
+  }
+}
+
+void SolverBase::updateMGRConfiguration()
+{
+  LinearSolverParameters::MGR & mgrParams = m_linearSolverParameters.get().mgr;
+  integer const previousConfiguration = mgrParams.configuration;
+
+  // number of consecutive fast solves after which a cheaper configuration is tried again
+  integer constexpr numFastSolvesBeforeRelax = 10;
+
+  if( !m_linearSolverResult.success() || m_linearSolverResult.numIterations > mgrParams.adaptiveMaxIterations )
+  {
+    mgrParams.configuration = LvArray::math::min( mgrParams.configuration + 1,
+                                                  LinearSolverParameters::MGR::numConfigurations - 1 );
+    m_mgrNumFastSolves = 0;
+  }
+  else if( 4 * m_linearSolverResult.numIterations < mgrParams.adaptiveMaxIterations )
+  {
+    ++m_mgrNumFastSolves;
+    if( m_mgrNumFastSolves >= numFastSolvesBeforeRelax && mgrParams.configuration > 0 )
+    {
+      --mgrParams.configuration;
+      m_mgrNumFastSolves = 0;
+    }
+  }
+  else
+  {
+    m_mgrNumFastSolves = 0;
+  }
+
+  if( mgrParams.configuration != previousConfiguration )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "        {}: switching MGR configuration from {} to {} after {} linear iterations",
+                                        getName(), previousConfiguration, mgrParams.configuration,
+                                        m_linearSolverResult.numIterations ) );
+    // a preconditioner kept across solves must be recreated with the new configuration
+    m_reusedPrecond.reset();
+    m_reusedPrecondExpired = true;
+  }
+}
+
 bool SolverBase::checkSystemSolution( DomainPartition & GEOS_UNUSED_PARAM( domain ),
                                       DofManager const & GEOS_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOS_UNUSED_PARAM( localSolution ),
@@ -35,6 +35,9 @@ namespace geos
 
 class DomainPartition;
 
+template< typename VECTOR >
+class KrylovSolver;
+
 class SolverBase : public ExecutableGroup
 {
 public:
@@ -159,6 +162,18 @@ public:
   virtual real64 setNextDtBasedOnStateChange( real64 const & currentDt,
                                               DomainPartition & domain );
 
+  /**
+   * @brief function to set the next dt with a PID controller on the state change error estimates
+   * @param[in] currentDt the current time step size
+   * @param[in] nextDtStateChange the time step size prescribed by the state change
+   * @return the prescribed time step size
+   *
+   * The ratio between the current time step and the one prescribed by the state change is used as
+   * the (normalized) error estimate of the step, with the gains of Valli et al. (2002).
+   */
+  real64 setNextDtBasedOnErrorHistory( real64 const & currentDt,
+                                       real64 const & nextDtStateChange );
+
   /**
    * @brief Entry function for an explicit time integration step
    * @param time_n time at the beginning of the step
@@ -337,6 +352,32 @@ public:
                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
                   arrayView1d< real64 > const & localRhs );
 
+  /**
+   * @brief function to assemble the residual only, used to evaluate the trial solutions of the line search
+   * @param time the time at the beginning of the step
+   * @param dt the desired timestep
+   * @param domain the domain partition
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix, whose values are unspecified on exit if hasResidualOnlyAssembly() is true
+   * @param localRhs the system right-hand side vector
+   *
+   * The default implementation assembles the full system. Solvers overriding it to skip the
+   * derivatives must also override hasResidualOnlyAssembly(), so that the Jacobian is assembled
+   * again at the solution accepted by the line search.
+   */
+  virtual void
+  assembleResidual( real64 const time,
+                    real64 const dt,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                    arrayView1d< real64 > const & localRhs );
+
+  /**
+   * @brief @return true if assembleResidual skips the assembly of the Jacobian
+   */
+  virtual bool hasResidualOnlyAssembly() const { return false; }
+
   /**
    * @brief apply boundary condition to system
    * @param time the time at the beginning of the step
@@ -559,6 +600,17 @@ public:
   real64 getTimestepRequest()
   {return m_nextDt;};
 
+  /**
+   * @brief Reset the time step requested by the solver to the initial time step given in input
+   */
+  void resetTimestepRequest()
+  {
+    m_nextDt = m_initialDt;
+    m_previousDt = 0.0;
+    m_previousErrors[0] = 1.0;
+    m_previousErrors[1] = 1.0;
+  }
+
   virtual Group * createChild( string const & childKey, string const & childName ) override;
 
   using CatalogInterface = dataRepository::CatalogInterface< SolverBase, string const &, Group * const >;
@@ -572,6 +624,7 @@ public:
     static constexpr char const * discretizationString() { return "discretization"; }
     static constexpr char const * targetRegionsString() { return "targetRegions"; }
     static constexpr char const * meshTargetsString() { return "meshTargets"; }
+    static constexpr char const * performanceLogFileString() { return "performanceLogFile"; }
 
   };
 
@@ -647,6 +700,16 @@ public:
     return m_nonlinearSolverParameters;
   }
 
+  /**
+   * @brief Request the setup of the reused preconditioner at the next linear solve.
+   * @details Used by the coupled solvers when the data entering the Jacobian of this solver
+   *          changed within a time step, e.g. after a coupling iteration.
+   */
+  void expireReusedPreconditioner()
+  {
+    m_reusedPrecondExpired = true;
+  }
+
   /**
    * @brief Get position of a given region within solver's target region list
    * @param regionName the region name to find
@@ -668,8 +731,8 @@ public:
   {
     for( auto const & target: m_meshTargets )
     {
-      string const meshBodyName = target.first.first;
-      string const meshLevelName = target.first.second;
+      string const & meshBodyName = target.first.first;
+      string const & meshLevelName = target.first.second;
       arrayView1d< string const > const & regionNames = target.second.toViewConst();
       MeshBody const & meshBody = meshBodies.getGroup< MeshBody >( meshBodyName );
 
@@ -694,8 +757,8 @@ public:
   {
     for( auto const & target: m_meshTargets )
     {
-      string const meshBodyName = target.first.first;
-      string const meshLevelName = target.first.second;
+      string const & meshBodyName = target.first.first;
+      string const & meshLevelName = target.first.second;
       arrayView1d< string const > const & regionNames = target.second.toViewConst();
       MeshBody & meshBody = meshBodies.getGroup< MeshBody >( meshBodyName );
 
@@ -711,6 +774,18 @@ public:
 
   string getDiscretizationName() const {return m_discretizationName;}
 
+  /**
+   * @brief Get the ghost layer needed by the discretization of the solver.
+   * @param domain the domain partition, holding the numerical methods
+   * @return the connectivity through which the ghost cells must be reached from the partition boundary
+   * @details The ghost layer of a mesh body is built as the union of the needs of the solvers targeting it.
+   */
+  virtual GhostConnectivity getGhostConnectivity( DomainPartition const & domain ) const
+  {
+    GEOS_UNUSED_VAR( domain );
+    return GhostConnectivity::Nodes;
+  }
+
   virtual bool registerCallback( void * func, const std::type_info & funcType ) final override;
 
   SolverStatistics & getSolverStatistics() { return m_solverStatistics; }
@@ -729,6 +804,48 @@ public:
   }
 protected:
 
+  /**
+   * @brief Select the MGR configuration of the next linear solve from the convergence of the last one (adaptive MGR mode)
+   */
+  void updateMGRConfiguration();
+
+  /**
+   * @brief Attach the recycled Krylov subspace kept by the physics solver to a native Krylov solver
+   * @param solver the Krylov solver
+   */
+  void setKrylovRecycleSpace( KrylovSolver< ParallelVector > & solver );
+
+  /**
+   * @brief Compare the assembled local matrix with the previously assembled one, when the reuse for a constant matrix is enabled
+   * @details The result, identical on all the ranks, is stored in m_matrixChanged and used by the next linear solve.
+   */
+  void checkMatrixChange();
+
+  /**
+   * @brief Solve the Newton system with Jacobian-vector products approximated by finite differences of the residual
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step size
+   * @param setupPreconditioner flag to set up the preconditioner with the current system matrix
+   * @param domain the domain partition
+   *
+   * The system matrix is only used to set up the preconditioner, and the right-hand side must
+   * hold the residual at the current Newton iterate, as for solveLinearSystem().
+   */
+  void solveJacobianFreeSystem( real64 const & time_n,
+                                real64 const & dt,
+                                bool const setupPreconditioner,
+                                DomainPartition & domain );
+
+  /**
+   * @brief Get the factor of the extrapolation in time of the initial guess of the Newton loop
+   * @param dt the size of the time step about to be solved
+   * @return the ratio between @p dt and the last accepted time step if the initial guess is extrapolated, zero otherwise
+   *
+   * Solvers supporting the extrapolated initial guess set their primary variables to
+   * x + factor * ( x - x_n ) once the state of the previous time step is saved.
+   */
+  real64 initialGuessExtrapolationFactor( real64 const & dt ) const;
+
   static real64 eisenstatWalker( real64 const newNewtonNorm,
                                  real64 const oldNewtonNorm,
                                  real64 const weakestTol );
@@ -766,6 +883,15 @@ protected:
   real64 m_maxStableDt;
   real64 m_nextDt;
 
+  /// Initial time step given in input, kept to run the simulation again from the start
+  real64 m_initialDt;
+
+  /// Size of the last accepted time step, zero before the first one
+  real64 m_previousDt;
+
+  /// Error estimates of the last two accepted time steps, used by the PID time step control
+  real64 m_previousErrors[2];
+
   /// name of the FV discretization object in the data repository
   string m_discretizationName;
 
@@ -783,6 +909,42 @@ protected:
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Preconditioner owned by the solver when the native Krylov solvers are used (reuse, communication-avoiding or Jacobian-free methods)
+  std::unique_ptr< PreconditionerBase< LAInterface > > m_reusedPrecond;
+
+  /// Direct solver whose factorization is kept across linear solves when reuse is enabled
+  std::unique_ptr< LinearSolverBase< LAInterface > > m_reusedDirectSolver;
+
+  /// Copy of the matrix the reused preconditioner was set up with (the system matrix is recreated at every Newton iteration)
+  ParallelMatrix m_reusedPrecondMatrix;
+
+  /// Number of linear solves performed with the current preconditioner setup
+  integer m_reusedPrecondNumSolves = 0;
+
+  /// Number of Krylov iterations of the first solve after the current preconditioner setup
+  integer m_reusedPrecondSetupIterations = 0;
+
+  /// Flag indicating whether the preconditioner must be set up again at the next linear solve
+  bool m_reusedPrecondExpired = true;
+
+  /// Beginning of the time step of the last call to nonlinearImplicitStep, used to detect a new step
+  real64 m_reusedPrecondTime = -1.0;
+
+  /// Time step size of the last call to nonlinearImplicitStep, used to detect a new step
+  real64 m_reusedPrecondDt = -1.0;
+
+  /// Copy of the previously assembled local matrix, compared with the assembled one when the matrix is expected to be constant
+  CRSMatrix< real64, globalIndex > m_constantMatrixCopy;
+
+  /// Flag indicating whether the assembled matrix differs from the previously assembled one
+  bool m_matrixChanged = true;
+
+  /// Number of consecutive linear solves well below the iteration threshold of the adaptive MGR mode
+  integer m_mgrNumFastSolves = 0;
+
+  /// Krylov subspace recycled from one linear solve to the next
+  array1d< ParallelVector > m_krylovRecycleSpace;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
@@ -802,6 +964,9 @@ protected:
 
   std::map< std::string, std::chrono::system_clock::duration > m_timers;
 
+  /// Name of the file in which a performance record is written at each time step (no record if empty)
+  string m_performanceLogFile;
+
 private:
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
@@ -299,28 +299,37 @@ public:
                                  real64 const & localResidualNormalizer,
                                  real64 & globalResidualNorm )
   {
-    globalResidualNorm = sqrt( MpiWrapper::sum( localResidualNorm ) ) / sqrt( MpiWrapper::sum( localResidualNormalizer ) );
+    // the norm and the normalizer are summed in a single reduction
+    real64 const localSums[2] = { localResidualNorm, localResidualNormalizer };
+    real64 globalSums[2]{};
+    MpiWrapper::allReduce( localSums,
+                           globalSums,
+                           2,
+                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
+                           MPI_COMM_GEOSX );
+    globalResidualNorm = sqrt( globalSums[0] ) / sqrt( globalSums[1] );
   }
 
   static void computeGlobalNorm( array1d< real64 > const & localResidualNorm,
                                  array1d< real64 > const & localResidualNormalizer,
                                  array1d< real64 > & globalResidualNorm )
   {
-    array1d< real64 > sumLocalResidualNorm( localResidualNorm.size() );
-    array1d< real64 > sumLocalResidualNormalizer( localResidualNormalizer.size() );
-    MpiWrapper::allReduce( localResidualNorm.data(),
-                           sumLocalResidualNorm.data(),
-                           localResidualNorm.size(),
-                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
-                           MPI_COMM_GEOSX );
-    MpiWrapper::allReduce( localResidualNormalizer.data(),
-                           sumLocalResidualNormalizer.data(),
-                           localResidualNormalizer.size(),
+    integer const numNorms = LvArray::integerConversion< integer >( localResidualNorm.size() );
+    array1d< real64 > localSums( 2 * numNorms );
+    array1d< real64 > globalSums( 2 * numNorms );
+    for( integer i = 0; i < numNorms; ++i )
+    {
+      localSums[i] = localResidualNorm[i];
+      localSums[numNorms + i] = localResidualNormalizer[i];
+    }
+    MpiWrapper::allReduce( localSums.data(),
+                           globalSums.data(),
+                           2 * numNorms,
                            MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ),
                            MPI_COMM_GEOSX );
-    for( integer i = 0; i < localResidualNorm.size(); ++i )
+    for( integer i = 0; i < numNorms; ++i )
     {
-      globalResidualNorm[i] = sqrt( sumLocalResidualNorm[i] ) / sqrt( sumLocalResidualNormalizer[i] );
+      globalResidualNorm[i] = sqrt( globalSums[i] ) / sqrt( globalSums[numNorms + i] );
     }
   }
 
@@ -18,6 +18,10 @@
 
 #include "SolverStatistics.hpp"
 
+#include "common/MpiWrapper.hpp"
+
+#include <sys/resource.h>
+
 namespace geos
 {
 
@@ -27,7 +31,11 @@ SolverStatistics::SolverStatistics( string const & name, Group * const parent )
   : Group( name, parent ),
   m_currentNumOuterLoopIterations( 0 ),
   m_currentNumNonlinearIterations( 0 ),
-  m_currentNumLinearIterations( 0 )
+  m_currentNumLinearIterations( 0 ),
+  m_numTimeStepCutsAtLastRecord( 0 ),
+  m_numLinearSolvesAtLastRecord( 0 ),
+  m_linearSolverSetupTimeAtLastRecord( 0.0 ),
+  m_linearSolverSolveTimeAtLastRecord( 0.0 )
 {
   registerWrapper( viewKeyStruct::numTimeStepsString(), &m_numTimeSteps ).
     setApplyDefaultValue( 0 ).
@@ -62,6 +70,19 @@ SolverStatistics::SolverStatistics( string const & name, Group * const parent )
   registerWrapper( viewKeyStruct::numDiscardedLinearIterationsString(), &m_numDiscardedLinearIterations ).
     setApplyDefaultValue( 0 ).
     setDescription( "Cumulative number of discarded linear iterations" );
+
+
+  registerWrapper( viewKeyStruct::numLinearSolvesString(), &m_numLinearSolves ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Cumulative number of linear solves" );
+
+  registerWrapper( viewKeyStruct::linearSolverSetupTimeString(), &m_linearSolverSetupTime ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Cumulative linear solver setup time" );
+
+  registerWrapper( viewKeyStruct::linearSolverSolveTimeString(), &m_linearSolverSolveTime ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Cumulative linear solver solve time" );
 }
 
 void SolverStatistics::initializeTimeStepStatistics()
@@ -85,6 +106,14 @@ void SolverStatistics::logNonlinearIteration()
   m_currentNumNonlinearIterations++;
 }
 
+void SolverStatistics::logLinearSolve( real64 const setupTime, real64 const solveTime )
+{
+  // the times are cumulated over all the solves, including those of the discarded time steps
+  m_numLinearSolves++;
+  m_linearSolverSetupTime += setupTime;
+  m_linearSolverSolveTime += solveTime;
+}
+
 void SolverStatistics::logOuterLoopIteration()
 {
   // we have just performed an outer loop iteration, so we increment the individual-timestep counter for outer loop iterations
@@ -113,6 +142,65 @@ void SolverStatistics::saveTimeStepStatistics()
   m_numTimeSteps++;
 }
 
+void SolverStatistics::logTimeStepRecord( string const & fileName,
+                                          real64 const time_n,
+                                          real64 const dt,
+                                          integer const cycleNumber,
+                                          real64 const wallTime,
+                                          std::map< string, real64 > const & phaseTimes )
+{
+  // the differences since the last record include the attempts discarded by the time step cuts
+  integer const numTimeStepCuts = m_numTimeStepCuts - m_numTimeStepCutsAtLastRecord;
+  integer const numLinearSolves = m_numLinearSolves - m_numLinearSolvesAtLastRecord;
+  real64 const linearSolverSetupTime = m_linearSolverSetupTime - m_linearSolverSetupTimeAtLastRecord;
+  real64 const linearSolverSolveTime = m_linearSolverSolveTime - m_linearSolverSolveTimeAtLastRecord;
+  m_numTimeStepCutsAtLastRecord = m_numTimeStepCuts;
+  m_numLinearSolvesAtLastRecord = m_numLinearSolves;
+  m_linearSolverSetupTimeAtLastRecord = m_linearSolverSetupTime;
+  m_linearSolverSolveTimeAtLastRecord = m_linearSolverSolveTime;
+
+  // only rank 0 writes, and no communication is done, so that the log can be left on in production runs
+  if( MpiWrapper::commRank() != 0 )
+  {
+    return;
+  }
+
+  if( !m_performanceLog.is_open() )
+  {
+    m_performanceLog.open( fileName );
+    GEOS_ERROR_IF( !m_performanceLog.is_open(),
+                   GEOS_FMT( "{}: cannot open the performance log file {}", getParent().getName(), fileName ) );
+  }
+
+  string phases;
+  for( auto const & phase : phaseTimes )
+  {
+    phases += GEOS_FMT( "{}\"{}\": {}", phases.empty() ? "" : ", ", phase.first, phase.second );
+  }
+
+  // maximum resident set size of rank 0, in kilobytes on Linux and in bytes on macOS
+  struct rusage usage;
+  getrusage( RUSAGE_SELF, &usage );
+#if defined(__APPLE__)
+  long long const maxResidentMemory = usage.ru_maxrss;
+#else
+  long long const maxResidentMemory = 1024LL * usage.ru_maxrss;
+#endif
+
+  m_performanceLog << GEOS_FMT( "{{\"solver\": \"{}\", \"cycle\": {}, \"time\": {}, \"dt\": {}, \"wallTime\": {}, "
+                                "\"phases\": {{{}}}, "
+                                "\"outerLoopIterations\": {}, \"nonlinearIterations\": {}, \"linearIterations\": {}, "
+                                "\"timeStepCuts\": {}, \"linearSolves\": {}, "
+                                "\"linearSolverSetupTime\": {}, \"linearSolverSolveTime\": {}, "
+                                "\"maxResidentMemory\": {}}}",
+                                getParent().getName(), cycleNumber, time_n, dt, wallTime,
+                                phases,
+                                m_currentNumOuterLoopIterations, m_currentNumNonlinearIterations, m_currentNumLinearIterations,
+                                numTimeStepCuts, numLinearSolves,
+                                linearSolverSetupTime, linearSolverSolveTime,
+                                maxResidentMemory ) << std::endl;
+}
+
 void SolverStatistics::outputStatistics() const
 {
   bool const printOuterLoopIterations = !(m_numSuccessfulOuterLoopIterations == 0 && m_numDiscardedOuterLoopIterations == 0);
@@ -154,6 +242,12 @@ void SolverStatistics::outputStatistics() const
     {
       logStat( "discarded linear iterations", m_numDiscardedLinearIterations );
     }
+    if( m_numLinearSolves > 0 )
+    {
+      logStat( "linear solves", m_numLinearSolves );
+      GEOS_LOG_RANK_0( GEOS_FMT( "{}, linear solver setup time: {} s, solve time: {} s",
+                                 getParent().getName(), m_linearSolverSetupTime, m_linearSolverSolveTime ) );
+    }
   }
 }
 } // namespace geos
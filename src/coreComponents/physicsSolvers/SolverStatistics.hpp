@@ -22,6 +22,8 @@
 
 #include "dataRepository/Group.hpp"
 
+#include <fstream>
+
 namespace geos
 {
 
@@ -59,6 +61,13 @@ public:
    */
   void logNonlinearIteration();
 
+  /**
+   * @brief Tell the solverStatistics that we have done a linear solve
+   * @param[in] setupTime the setup time of the linear solver (preconditioner or factorization), in seconds
+   * @param[in] solveTime the solve time of the linear solver, in seconds
+   */
+  void logLinearSolve( real64 const setupTime, real64 const solveTime );
+
   /**
    * @brief Tell the solverStatistics that we are doing an outer loop iteration
    */
@@ -74,11 +83,43 @@ public:
    */
   void saveTimeStepStatistics();
 
+  /**
+   * @brief Append a record of the time step that has just been saved to the performance log (rank 0 only)
+   * @param[in] fileName name of the performance log file, truncated at the first record
+   * @param[in] time_n the time at the beginning of the time step
+   * @param[in] dt the accepted time step size
+   * @param[in] cycleNumber the current cycle number
+   * @param[in] wallTime the wall time of the time step, in seconds
+   * @param[in] phaseTimes the wall time spent in each phase of the time step, in seconds
+   * @detail The records are written in the JSON lines format (one JSON object per line)
+   */
+  void logTimeStepRecord( string const & fileName,
+                          real64 const time_n,
+                          real64 const dt,
+                          integer const cycleNumber,
+                          real64 const wallTime,
+                          std::map< string, real64 > const & phaseTimes );
+
   /**
    * @brief Output the cumulative statistics to the terminal
    */
   void outputStatistics() const;
 
+  /**
+   * @return the number of time steps
+   */
+  integer getNumTimeSteps() const { return m_numTimeSteps; }
+
+  /**
+   * @return the cumulative number of nonlinear iterations, successful or discarded
+   */
+  integer getNumNonlinearIterations() const { return m_numSuccessfulNonlinearIterations + m_numDiscardedNonlinearIterations; }
+
+  /**
+   * @return the cumulative setup and solve time of the linear solver, in seconds
+   */
+  real64 getLinearSolverTime() const { return m_linearSolverSetupTime + m_linearSolverSolveTime; }
+
 private:
 
   /**
@@ -105,6 +146,13 @@ private:
     static constexpr char const * numDiscardedNonlinearIterationsString() { return "numDiscardedNonlinearIterations"; }
     /// String key for the discarded number of linear iterations
     static constexpr char const * numDiscardedLinearIterationsString() { return "numDiscardedLinearIterations"; }
+
+    /// String key for the number of linear solves
+    static constexpr char const * numLinearSolvesString() { return "numLinearSolves"; }
+    /// String key for the cumulative linear solver setup time
+    static constexpr char const * linearSolverSetupTimeString() { return "linearSolverSetupTime"; }
+    /// String key for the cumulative linear solver solve time
+    static constexpr char const * linearSolverSolveTimeString() { return "linearSolverSolveTime"; }
   };
 
   /// Number of time steps
@@ -143,6 +191,32 @@ private:
   /// Cumulative number of discarded linear iterations
   integer m_numDiscardedLinearIterations;
 
+
+  /// Cumulative number of linear solves
+  integer m_numLinearSolves;
+
+  /// Cumulative linear solver setup time, in seconds
+  real64 m_linearSolverSetupTime;
+
+  /// Cumulative linear solver solve time, in seconds
+  real64 m_linearSolverSolveTime;
+
+
+  /// Number of time step cuts at the last performance record
+  integer m_numTimeStepCutsAtLastRecord;
+
+  /// Number of linear solves at the last performance record
+  integer m_numLinearSolvesAtLastRecord;
+
+  /// Cumulative linear solver setup time at the last performance record, in seconds
+  real64 m_linearSolverSetupTimeAtLastRecord;
+
+  /// Cumulative linear solver solve time at the last performance record, in seconds
+  real64 m_linearSolverSolveTimeAtLastRecord;
+
+  /// Stream of the performance log, opened at the first record
+  std::ofstream m_performanceLog;
+
 };
 
 } //namespace geos
@@ -36,7 +36,6 @@
 #include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
 #include "physicsSolvers/contact/ContactFields.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
-#include "linearAlgebra/utilities/LAIHelperFunctions.hpp"
 #include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 #include "linearAlgebra/solvers/PreconditionerBlockJacobi.hpp"
 #include "linearAlgebra/solvers/BlockPreconditioner.hpp"
@@ -58,12 +57,20 @@ using namespace finiteElement;
 
 LagrangianContactSolver::LagrangianContactSolver( const string & name,
                                                   Group * const parent ):
-  ContactSolverBase( name, parent )
+  ContactSolverBase( name, parent ),
+  m_activeSetNewtonMaxIter( 0 )
 {
   registerWrapper( viewKeyStruct::stabilizationNameString(), &m_stabilizationName ).
     setInputFlag( InputFlags::REQUIRED ).
     setDescription( "Name of the stabilization to use in the lagrangian contact solver" );
 
+  registerWrapper( viewKeyStruct::activeSetNewtonMaxIterString(), &m_activeSetNewtonMaxIter ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Newton iterations of each configuration attempt during which the fracture states are updated "
+                    "after each Newton update (semi-smooth Newton). The fracture states are frozen afterwards to prevent the "
+                    "active set from cycling. If 0, the fracture states are only updated once Newton has converged" );
+
   m_linearSolverParameters.get().mgr.strategy = LinearSolverParameters::MGR::StrategyType::lagrangianContactMechanics;
   m_linearSolverParameters.get().mgr.separateComponents = true;
   m_linearSolverParameters.get().mgr.displacementFieldName = solidMechanics::totalDisplacement::key();
@@ -84,12 +91,22 @@ void LagrangianContactSolver::registerDataOnMesh( Group & meshBodies )
     elemManager.forElementSubRegions< FaceElementSubRegion >( regionNames, [&] ( localIndex const,
                                                                                  SurfaceElementSubRegion & subRegion )
     {
+      // the fracture state only changes when the active set does, so that most of its synchronizations can be skipped
+      subRegion.getWrapperBase( fractureState::key() ).setTrackModifications();
+
       subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::rotationMatrixString() ).
         setPlotLevel( PlotLevel::NOPLOT ).
         setRegisteringObjects( this->getName()).
         setDescription( "An array that holds the rotation matrices on the fracture." ).
         reference().resizeDimension< 1, 2 >( 3, 3 );
 
+      subRegion.registerWrapper< array1d< integer > >( viewKeyStruct::rotationMatrixIsComputedString() ).
+        setApplyDefaultValue( 0 ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setRegisteringObjects( this->getName()).
+        setDescription( "Flag set once the rotation matrix of the fracture element is computed." );
+
       subRegion.registerField< deltaTraction >( getName() ).
         reference().resizeDimension< 1 >( 3 );
 
@@ -198,9 +215,17 @@ void LagrangianContactSolver::setupSystem( DomainPartition & domain,
   // setup monolithic coupled system
   SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
 
+  // the block preconditioner keeps pointers to the rigid body modes, hence it is rebuilt when they are recomputed
+  if( m_linearSolverParameters.get().preconditionerType == LinearSolverParameters::PreconditionerType::block &&
+      m_solidSolver->getLinearSolverParameters().amg.nullSpaceType == LinearSolverParameters::AMG::NullSpaceType::rigidBodyModes &&
+      m_solidSolver->updateRigidBodyModes( domain.getMeshBody( 0 ).getBaseDiscretization(), m_dofManager ) )
+  {
+    m_precond.reset();
+  }
+
   if( !m_precond && m_linearSolverParameters.get().solverType != LinearSolverParameters::SolverType::direct )
   {
-    createPreconditioner( domain );
+    createPreconditioner();
   }
 }
 
@@ -264,6 +289,10 @@ void LagrangianContactSolver::postProcessInput()
 {
   m_solidSolver = &this->getParent().getGroup< SolidMechanicsLagrangianFEM >( m_solidSolverName );
   SolverBase::postProcessInput();
+
+  GEOS_ERROR_IF_LT_MSG( m_activeSetNewtonMaxIter, 0,
+                        getWrapperDataContext( viewKeyStruct::activeSetNewtonMaxIterString() ) <<
+                        ": Invalid value." );
 }
 
 LagrangianContactSolver::~LagrangianContactSolver()
@@ -449,6 +478,7 @@ void LagrangianContactSolver::resetStateToBeginningOfStep( DomainPartition & dom
         }
         fractureState[kfe] = oldFractureState[kfe];
       } );
+      subRegion.getWrapperBase( contact::fractureState::key() ).markModified();
     } );
   } );
 }
@@ -717,7 +747,7 @@ real64 LagrangianContactSolver::calculateResidualNorm( real64 const & GEOS_UNUSE
   return globalResidualNorm[2];
 }
 
-void LagrangianContactSolver::createPreconditioner( DomainPartition const & domain )
+void LagrangianContactSolver::createPreconditioner()
 {
   if( m_linearSolverParameters.get().preconditionerType == LinearSolverParameters::PreconditionerType::block )
   {
@@ -746,10 +776,15 @@ void LagrangianContactSolver::createPreconditioner( DomainPartition const & doma
     }
     else if( leadingBlockApproximation == "blockJacobi" )
     {
+      // In single precision, the block inverses are only applied: the Schur complement is approximated
+      // with the diagonal of the leading block instead of the explicit (double precision) block inverses
+      bool const singlePrecision = m_linearSolverParameters.get().preconditionerSinglePrecision;
       precond = std::make_unique< BlockPreconditioner< LAInterface > >( BlockShapeOption::LowerUpperTriangular,
-                                                                        SchurComplementOption::FirstBlockUserDefined,
+                                                                        singlePrecision ? SchurComplementOption::FirstBlockDiagonal
+                                                                                        : SchurComplementOption::FirstBlockUserDefined,
                                                                         BlockScalingOption::UserProvided );
-      tracPrecond = std::make_unique< PreconditionerBlockJacobi< LAInterface > >( mechParams.dofsPerNode );
+      tracPrecond = std::make_unique< PreconditionerBlockJacobi< LAInterface > >( mechParams.dofsPerNode,
+                                                                                  singlePrecision );
     }
     else
     {
@@ -761,19 +796,7 @@ void LagrangianContactSolver::createPreconditioner( DomainPartition const & doma
                          { { contact::traction::key(), { 3, true } } },
                          std::move( tracPrecond ) );
 
-    if( mechParams.amg.nullSpaceType == LinearSolverParameters::AMG::NullSpaceType::rigidBodyModes )
-    {
-      if( m_solidSolver->getRigidBodyModes().empty() )
-      {
-        MeshLevel const & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
-        LAIHelperFunctions::computeRigidBodyModes( mesh,
-                                                   m_dofManager,
-                                                   { solidMechanics::totalDisplacement::key() },
-                                                   m_solidSolver->getRigidBodyModes() );
-      }
-    }
-
-    // Preconditioner for the Schur complement: mechPrecond
+    // Preconditioner for the Schur complement: mechPrecond, using the rigid body modes computed in setupSystem
     std::unique_ptr< PreconditionerBase< LAInterface > > mechPrecond = LAInterface::createPreconditioner( mechParams, m_solidSolver->getRigidBodyModes() );
     precond->setupBlock( 1,
                          { { solidMechanics::totalDisplacement::key(), { 3, true } } },
@@ -808,10 +831,14 @@ void LagrangianContactSolver::computeRotationMatrices( DomainPartition & domain
 
       arrayView3d< real64 > const &
       rotationMatrix = subRegion.getReference< array3d< real64 > >( viewKeyStruct::rotationMatrixString() );
+      arrayView1d< integer > const &
+      rotationMatrixIsComputed = subRegion.getReference< array1d< integer > >( viewKeyStruct::rotationMatrixIsComputedString() );
 
+      // the normals of the fracture faces do not change once the faces are split, so that only the
+      // matrices of the elements added since the last call (e.g. by the surface generator) are computed
       forAll< parallelHostPolicy >( subRegion.size(), [=]( localIndex const kfe )
       {
-        if( elemsToFaces.sizeOfArray( kfe ) != 2 )
+        if( rotationMatrixIsComputed[kfe] || elemsToFaces.sizeOfArray( kfe ) != 2 )
         {
           return;
         }
@@ -824,6 +851,7 @@ void LagrangianContactSolver::computeRotationMatrices( DomainPartition & domain
         LvArray::tensorOps::normalize< 3 >( Nbar );
 
         computationalGeometry::RotationMatrix_3D( Nbar.toSliceConst(), rotationMatrix[kfe] );
+        rotationMatrixIsComputed[kfe] = 1;
       } );
     } );
   } );
@@ -1741,6 +1769,13 @@ void LagrangianContactSolver::applySystemSolution( DofManager const & dofManager
 void LagrangianContactSolver::updateState( DomainPartition & domain )
 {
   computeFaceDisplacementJump( domain );
+
+  // during the first Newton iterations, the fracture states follow the current iterate, so that
+  // the configuration loop only has to confirm the active set once Newton has converged
+  if( m_nonlinearSolverParameters.m_numNewtonIterations < m_activeSetNewtonMaxIter )
+  {
+    updateConfiguration( domain );
+  }
 }
 
 bool LagrangianContactSolver::resetConfigurationToDefault( DomainPartition & domain ) const
@@ -1768,6 +1803,7 @@ bool LagrangianContactSolver::resetConfigurationToDefault( DomainPartition & dom
             fractureState[kfe] = FractureState::Stick;
           }
         } );
+        subRegion.getWrapperBase( contact::fractureState::key() ).markModified();
       }
     } );
   } );
@@ -1804,6 +1840,7 @@ bool LagrangianContactSolver::updateConfiguration( DomainPartition & domain )
         subRegion.getReference< array1d< real64 > >( viewKeyStruct::normalDisplacementToleranceString() );
 
       RAJA::ReduceMin< parallelHostReduce, integer > checkActiveSetSub( 1 );
+      RAJA::ReduceMax< parallelHostReduce, integer > hasStateChanged( 0 );
 
       constitutiveUpdatePassThru( contact, [&] ( auto & castedContact )
       {
@@ -1864,10 +1901,16 @@ bool LagrangianContactSolver::updateConfiguration( DomainPartition & domain )
               }
             }
             checkActiveSetSub.min( compareFractureStates( originalFractureState, fractureState[kfe] ) );
+            hasStateChanged.max( originalFractureState != fractureState[kfe] );
           }
         } );
       } );
 
+      if( hasStateChanged.get() )
+      {
+        subRegion.getWrapperBase( contact::fractureState::key() ).markModified();
+      }
+
       hasConfigurationConverged &= checkActiveSetSub.get();
     } );
   } );
@@ -1882,6 +1925,12 @@ bool LagrangianContactSolver::updateConfiguration( DomainPartition & domain )
                          MPI_LAND,
                          MPI_COMM_GEOSX );
 
+  // a reused preconditioner setup (see LinearSolverParameters) is only kept as long as the active set does not change
+  if( !hasConfigurationConvergedGlobally )
+  {
+    m_reusedPrecondExpired = true;
+  }
+
   return hasConfigurationConvergedGlobally;
 }
 
@@ -154,22 +154,28 @@ private:
 
   real64 const m_slidingCheckTolerance = 0.05;
 
+  /// Number of Newton iterations during which the fracture states are updated after each Newton update
+  integer m_activeSetNewtonMaxIter;
+
   real64 m_initialResidual[3] = {0.0, 0.0, 0.0};
 
-  void createPreconditioner( DomainPartition const & domain );
+  void createPreconditioner();
 
   void computeFaceDisplacementJump( DomainPartition & domain );
 
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
 
+public:
 
   struct viewKeyStruct : ContactSolverBase::viewKeyStruct
   {
     constexpr static char const * stabilizationNameString() { return "stabilizationName"; }
     constexpr static char const * contactRelationNameString() { return "contactRelationName"; }
     constexpr static char const * activeSetMaxIterString() { return "activeSetMaxIter"; } // TODO: remove
+    constexpr static char const * activeSetNewtonMaxIterString() { return "activeSetNewtonMaxIter"; }
 
     constexpr static char const * rotationMatrixString() { return "rotationMatrix"; }
+    constexpr static char const * rotationMatrixIsComputedString() { return "rotationMatrixIsComputed"; }
 
     constexpr static char const * slidingCheckToleranceString() { return "slidingCheckTolerance"; }
     constexpr static char const * normalDisplacementToleranceString() { return "normalDisplacementTolerance"; }
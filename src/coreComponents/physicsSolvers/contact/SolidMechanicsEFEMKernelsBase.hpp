@@ -190,6 +190,12 @@ public:
 
     /// Stack storage for the constitutive stiffness at a quadrature point.
     real64 constitutiveStiffness[ 6 ][ 6 ];
+
+    /// Stack storage for the Heaviside function of the nodes (same at all quadrature points)
+    int Heaviside[ numNodesPerElem ];
+
+    /// Stack storage for the equilibrium operator (same at all quadrature points)
+    real64 eqMatrix[ 3 ][ 6 ];
   };
   //***************************************************************************
 
@@ -248,35 +254,36 @@ public:
     // Gauss contribution to Kww, Kwu and Kuw blocks
     real64 Kww_gauss[3][3], Kwu_gauss[3][nUdof], Kuw_gauss[nUdof][3];
 
-    //  Compatibility, equilibrium and strain operators. The compatibility operator is constructed as
+    //  Compatibility and strain operators. The compatibility operator is constructed as
     //  a 3 x 6 because it is more convenient for construction purposes (reduces number of local var).
-    real64 compMatrix[3][6], strainMatrix[6][nUdof], eqMatrix[3][6];
+    real64 compMatrix[3][6], strainMatrix[6][nUdof];
     real64 matBD[nUdof][6], matED[3][6];
 
-    int Heaviside[ numNodesPerElem ];
-
     // TODO: asking for the stiffness here will only work for elastic models.  most other models
     //       need to know the strain increment to compute the current stiffness value.
 
     m_constitutiveUpdate.getElasticStiffness( k, q, stack.constitutiveStiffness );
 
-    solidMechanicsEFEMKernelsHelper::computeHeavisideFunction< numNodesPerElem >( Heaviside,
-                                                                                  stack.X,
-                                                                                  m_nVec[embSurfIndex],
-                                                                                  m_surfaceCenter[embSurfIndex] );
-
-
-    solidMechanicsEFEMKernelsHelper::assembleEquilibriumOperator( eqMatrix,
-                                                                  m_nVec[embSurfIndex],
-                                                                  m_tVec1[embSurfIndex],
-                                                                  m_tVec2[embSurfIndex],
-                                                                  stack.hInv );
+    // the Heaviside function and the equilibrium operator only depend on the element and its embedded surface
+    if( q == 0 )
+    {
+      solidMechanicsEFEMKernelsHelper::computeHeavisideFunction< numNodesPerElem >( stack.Heaviside,
+                                                                                    stack.X,
+                                                                                    m_nVec[embSurfIndex],
+                                                                                    m_surfaceCenter[embSurfIndex] );
+
+      solidMechanicsEFEMKernelsHelper::assembleEquilibriumOperator( stack.eqMatrix,
+                                                                    m_nVec[embSurfIndex],
+                                                                    m_tVec1[embSurfIndex],
+                                                                    m_tVec2[embSurfIndex],
+                                                                    stack.hInv );
+    }
 
     solidMechanicsEFEMKernelsHelper::assembleCompatibilityOperator< numNodesPerElem >( compMatrix,
                                                                                        m_nVec[embSurfIndex],
                                                                                        m_tVec1[embSurfIndex],
                                                                                        m_tVec2[embSurfIndex],
-                                                                                       Heaviside,
+                                                                                       stack.Heaviside,
                                                                                        dNdX );
 
     solidMechanicsEFEMKernelsHelper::assembleStrainOperator< 6, nUdof, numNodesPerElem >( strainMatrix, dNdX );
@@ -284,7 +291,7 @@ public:
     // transp(B)D
     LvArray::tensorOps::Rij_eq_AkiBkj< nUdof, 6, 6 >( matBD, strainMatrix, stack.constitutiveStiffness );
     // ED
-    LvArray::tensorOps::Rij_eq_AikBkj< 3, 6, 6 >( matED, eqMatrix, stack.constitutiveStiffness );
+    LvArray::tensorOps::Rij_eq_AikBkj< 3, 6, 6 >( matED, stack.eqMatrix, stack.constitutiveStiffness );
     // EDC
     LvArray::tensorOps::Rij_eq_AikBjk< 3, 3, 6 >( Kww_gauss, matED, compMatrix );
     // EDB
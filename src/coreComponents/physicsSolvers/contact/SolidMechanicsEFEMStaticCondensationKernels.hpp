@@ -204,10 +204,10 @@ public:
     real64 InvKww[3][3];
     LvArray::tensorOps::invert< 3 >( InvKww, stack.localKww );
 
-    // Residual (Ru -= Kuw * Inv(Kww)Rw)
-    real64 KuwInvKww[nUdof][3], Ruw[nUdof];
-    LvArray::tensorOps::Rij_eq_AikBkj< nUdof, 3, 3 >( KuwInvKww, stack.localKuw, InvKww );
-    LvArray::tensorOps::Ri_eq_AijBj< nUdof, 3 >( Ruw, KuwInvKww, stack.localRw );
+    // Residual (Ru -= Kuw * Inv(Kww)Rw), applying Inv(Kww) to the 3-vector Rw rather than to the nUdof x 3 matrix Kuw
+    real64 InvKwwRw[3], Ruw[nUdof];
+    LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( InvKwwRw, InvKww, stack.localRw );
+    LvArray::tensorOps::Ri_eq_AijBj< nUdof, 3 >( Ruw, stack.localKuw, InvKwwRw );
     LvArray::tensorOps::scaledAdd< nUdof >( stack.localRu, Ruw, -1 );
 
     // Jacobian to add to Kuu block  ( Kuu -= Kuw * Inv(Kww) * Kwu )
@@ -0,0 +1,644 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CoarseModelUpscaling.cpp
+ */
+
+#include "CoarseModelUpscaling.hpp"
+
+#include "constitutive/permeability/PermeabilityBase.hpp"
+#include "constitutive/solid/CoupledSolidBase.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/generators/ParMETISInterface.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBase.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+
+#include "LvArray/src/tensorOps.hpp"
+
+#include <array>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <set>
+
+namespace geos
+{
+
+using namespace constitutive;
+using namespace dataRepository;
+
+namespace
+{
+
+/// Number of values of the contribution of a face to the interface between two coarse cells:
+/// the two coarse cells, the area vector, the area, and the area-weighted center
+constexpr integer interfaceRecordSize = 9;
+
+/// Permeability below which a cell is considered impermeable in the harmonic average
+constexpr real64 minPermeability = 1.0e-30;
+
+} // namespace
+
+CoarseModelUpscaling::CoarseModelUpscaling( const string & name,
+                                            Group * const parent ):
+  Base( name, parent ),
+  m_numCoarseCells( 0 ),
+  m_dynamicCoarsening( 0 ),
+  m_frontPressureChange( 1.0e5 ),
+  m_frontPhaseIndex( -1 ),
+  m_frontPhaseVolumeFraction( 1.0e-3 ),
+  m_frontHaloLayers( 1 ),
+  m_isAgglomerated( false )
+{
+  registerWrapper( viewKeyStruct::numCoarseCellsString(), &m_numCoarseCells ).
+    setInputFlag( InputFlags::REQUIRED ).
+    setDescription( "Number of coarse cells of the coarse model" );
+
+  registerWrapper( viewKeyStruct::outputFileString(), &m_outputFile ).
+    setApplyDefaultValue( "coarseModel.txt" ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of the text file the coarse cells and their connections are written to" );
+
+  registerWrapper( viewKeyStruct::dynamicCoarseningString(), &m_dynamicCoarsening ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag enabling the dynamic coarsening: the cells are agglomerated at the first execution only, "
+                    "and each execution flags the coarse cells near the front of the plume as refined" );
+
+  registerWrapper( viewKeyStruct::frontPressureChangeString(), &m_frontPressureChange ).
+    setApplyDefaultValue( 1.0e5 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Change of pressure from the initial pressure above which a cell is in the front of the plume" );
+
+  registerWrapper( viewKeyStruct::frontPhaseIndexString(), &m_frontPhaseIndex ).
+    setApplyDefaultValue( -1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Index of the phase whose volume fraction defines the front of the plume (not used if negative)" );
+
+  registerWrapper( viewKeyStruct::frontPhaseVolumeFractionString(), &m_frontPhaseVolumeFraction ).
+    setApplyDefaultValue( 1.0e-3 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Volume fraction of the front phase above which a cell is in the front of the plume" );
+
+  registerWrapper( viewKeyStruct::frontHaloLayersString(), &m_frontHaloLayers ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of layers of coarse cells around the coarse cells of the front that are refined" );
+}
+
+void CoarseModelUpscaling::postProcessInput()
+{
+  Base::postProcessInput();
+
+  GEOS_THROW_IF_LT_MSG( m_numCoarseCells, 1,
+                        getWrapperDataContext( viewKeyStruct::numCoarseCellsString() ) << ": Invalid value.",
+                        InputError );
+
+  GEOS_THROW_IF_LT_MSG( m_frontPressureChange, 0.0,
+                        getWrapperDataContext( viewKeyStruct::frontPressureChangeString() ) << ": Invalid value.",
+                        InputError );
+
+  GEOS_THROW_IF_LT_MSG( m_frontHaloLayers, 0,
+                        getWrapperDataContext( viewKeyStruct::frontHaloLayersString() ) << ": Invalid value.",
+                        InputError );
+}
+
+void CoarseModelUpscaling::registerDataOnMesh( Group & meshBodies )
+{
+  // for now, this guard is needed to avoid breaking the xml schema generation
+  if( m_solver == nullptr )
+  {
+    return;
+  }
+
+  m_solver->forDiscretizationOnMeshTargets( meshBodies, [&] ( string const &,
+                                                              MeshLevel & mesh,
+                                                              arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                           CellElementSubRegion & subRegion )
+    {
+      subRegion.registerWrapper< array1d< globalIndex > >( viewKeyStruct::coarseCellIndexString() ).
+        setApplyDefaultValue( -1 ).
+        setPlotLevel( PlotLevel::LEVEL_0 ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setDescription( "Index of the coarse cell of the cell in the coarse model of " + getName() );
+
+      if( m_dynamicCoarsening != 0 )
+      {
+        subRegion.registerWrapper< array1d< integer > >( viewKeyStruct::refinedCoarseCellString() ).
+          setApplyDefaultValue( 0 ).
+          setPlotLevel( PlotLevel::LEVEL_0 ).
+          setRestartFlags( RestartFlags::NO_WRITE ).
+          setDescription( "Flag indicating whether the coarse cell of the cell is refined by the dynamic coarsening of " + getName() );
+      }
+    } );
+  } );
+}
+
+bool CoarseModelUpscaling::execute( real64 const GEOS_UNUSED_PARAM( time_n ),
+                                    real64 const GEOS_UNUSED_PARAM( dt ),
+                                    integer const GEOS_UNUSED_PARAM( cycleNumber ),
+                                    integer const GEOS_UNUSED_PARAM( eventCounter ),
+                                    real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                                    DomainPartition & domain )
+{
+  m_solver->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                          MeshLevel & mesh,
+                                                                          arrayView1d< string const > const & regionNames )
+  {
+    if( m_dynamicCoarsening == 0 || !m_isAgglomerated )
+    {
+      agglomerateCells( domain, mesh, regionNames );
+      computeCoarseModel( mesh, regionNames );
+      m_refinedCoarseCells.resize( m_numCoarseCells );
+      m_refinedCoarseCells.setValues< serialPolicy >( 0 );
+    }
+    if( m_dynamicCoarsening != 0 )
+    {
+      updateRefinedCoarseCells( mesh, regionNames );
+    }
+  } );
+  m_isAgglomerated = true;
+  return false;
+}
+
+void CoarseModelUpscaling::agglomerateCells( DomainPartition & domain,
+                                             MeshLevel & mesh,
+                                             arrayView1d< string const > const & regionNames ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  MPI_Comm const comm = MPI_COMM_GEOSX;
+  int const rank = MpiWrapper::commRank( comm );
+  ElementRegionManager & elemManager = mesh.getElemManager();
+
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addElementFields( { viewKeyStruct::coarseCellIndexString() }, regionNames );
+
+  // Step 1: number the locally owned cells contiguously across the ranks, these are the vertices of the graph
+  pmet_idx_t numOwnedCells = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      numOwnedCells += ghostRank[ei] < 0 ? 1 : 0;
+    }
+  } );
+
+  array1d< pmet_idx_t > vertDist( MpiWrapper::commSize( comm ) + 1 );
+  {
+    array1d< pmet_idx_t > vertCounts;
+    MpiWrapper::allGather( numOwnedCells, vertCounts, comm );
+    std::partial_sum( vertCounts.begin(), vertCounts.end(), vertDist.begin() + 1 );
+  }
+  pmet_idx_t const vertOffset = vertDist[rank];
+
+  {
+    pmet_idx_t vertIndex = vertOffset;
+    elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                 CellElementSubRegion & subRegion )
+    {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex > const coarseCellIndex = subRegion.getReference< array1d< globalIndex > >( viewKeyStruct::coarseCellIndexString() );
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        coarseCellIndex[ei] = ghostRank[ei] < 0 ? vertIndex++ : -1;
+      }
+    } );
+  }
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), false );
+
+  // Step 2: build the graph of the cells connected by a face
+  FaceManager const & faceManager = mesh.getFaceManager();
+  arrayView2d< localIndex const > const elemRegionList = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const elemSubRegionList = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const elemList = faceManager.elementList();
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const vertIndices =
+    elemManager.constructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( viewKeyStruct::coarseCellIndexString() );
+
+  auto const faceCellVertex = [&]( localIndex const kf, integer const side ) -> globalIndex
+  {
+    localIndex const er = elemRegionList( kf, side );
+    localIndex const esr = elemSubRegionList( kf, side );
+    localIndex const ei = elemList( kf, side );
+    if( er < 0 || esr < 0 || ei < 0 || vertIndices[er][esr].size() == 0 )
+    {
+      return -1;
+    }
+    return vertIndices[er][esr][ei];
+  };
+
+  std::vector< std::vector< pmet_idx_t > > neighbors( numOwnedCells );
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    globalIndex const vert[2] = { faceCellVertex( kf, 0 ), faceCellVertex( kf, 1 ) };
+    if( vert[0] < 0 || vert[1] < 0 )
+    {
+      continue;
+    }
+    for( integer side = 0; side < 2; ++side )
+    {
+      if( vert[side] >= vertOffset && vert[side] < vertOffset + numOwnedCells )
+      {
+        neighbors[vert[side] - vertOffset].push_back( vert[1 - side] );
+      }
+    }
+  }
+
+  array1d< pmet_idx_t > numNeighbors( numOwnedCells );
+  for( pmet_idx_t iv = 0; iv < numOwnedCells; ++iv )
+  {
+    // cells sharing several faces are connected once
+    std::sort( neighbors[iv].begin(), neighbors[iv].end() );
+    neighbors[iv].erase( std::unique( neighbors[iv].begin(), neighbors[iv].end() ), neighbors[iv].end() );
+    numNeighbors[iv] = LvArray::integerConversion< pmet_idx_t >( neighbors[iv].size() );
+  }
+  ArrayOfArrays< pmet_idx_t, pmet_idx_t > graph;
+  graph.resizeFromCapacities< serialPolicy >( numOwnedCells, numNeighbors.data() );
+  for( pmet_idx_t iv = 0; iv < numOwnedCells; ++iv )
+  {
+    graph.appendToArray( iv, neighbors[iv].begin(), neighbors[iv].end() );
+  }
+
+  // Step 3: partition the graph, each part being a coarse cell
+  array2d< pmet_idx_t > const vertWeights;
+  array1d< pmet_idx_t > const edgeWeights;
+  array1d< pmet_idx_t > const parts = parmetis::partition( graph.toViewConst(),
+                                                           vertWeights.toViewConst(),
+                                                           edgeWeights.toViewConst(),
+                                                           vertDist.toViewConst(),
+                                                           m_numCoarseCells,
+                                                           comm,
+                                                           1 );
+
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< globalIndex > const coarseCellIndex = subRegion.getReference< array1d< globalIndex > >( viewKeyStruct::coarseCellIndexString() );
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        coarseCellIndex[ei] = parts[coarseCellIndex[ei] - vertOffset];
+      }
+    }
+  } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), false );
+}
+
+void CoarseModelUpscaling::computeCoarseModel( MeshLevel const & mesh,
+                                               arrayView1d< string const > const & regionNames ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  MPI_Comm const comm = MPI_COMM_GEOSX;
+  int const rank = MpiWrapper::commRank( comm );
+  localIndex const numCoarseCells = m_numCoarseCells;
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+
+  // Step 1: sum the volumes, centers and permeability averages of the cells of each coarse cell over all the ranks
+  array1d< real64 > volume( numCoarseCells );
+  array1d< real64 > poreVolume( numCoarseCells );
+  array2d< real64 > center( numCoarseCells, 3 );
+  array2d< real64 > arithmeticPerm( numCoarseCells, 3 );
+  array2d< real64 > harmonicPerm( numCoarseCells, 3 );
+
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< globalIndex const > const coarseCellIndex = subRegion.getReference< array1d< globalIndex > >( viewKeyStruct::coarseCellIndexString() );
+    arrayView1d< real64 const > const elemVolume = subRegion.getElementVolume();
+    arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+
+    string const & solidName = subRegion.getReference< string >( FlowSolverBase::viewKeyStruct::solidNamesString() );
+    arrayView1d< real64 const > const refPorosity = subRegion.getConstitutiveModel< CoupledSolidBase >( solidName ).getReferencePorosity();
+    string const & permName = subRegion.getReference< string >( FlowSolverBase::viewKeyStruct::permeabilityNamesString() );
+    arrayView3d< real64 const > const permeability = subRegion.getConstitutiveModel< PermeabilityBase >( permName ).permeability();
+
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] >= 0 )
+      {
+        continue;
+      }
+      localIndex const ic = LvArray::integerConversion< localIndex >( coarseCellIndex[ei] );
+      real64 const v = elemVolume[ei];
+      volume[ic] += v;
+      poreVolume[ic] += refPorosity[ei] * v;
+      for( integer d = 0; d < 3; ++d )
+      {
+        center( ic, d ) += v * elemCenter( ei, d );
+        arithmeticPerm( ic, d ) += v * permeability( ei, 0, d );
+        harmonicPerm( ic, d ) += v / std::max( permeability( ei, 0, d ), minPermeability );
+      }
+    }
+  } );
+
+  int const numCoarseValues = LvArray::integerConversion< int >( numCoarseCells );
+  MpiWrapper::allReduce( volume.data(), volume.data(), numCoarseValues, MPI_SUM, comm );
+  MpiWrapper::allReduce( poreVolume.data(), poreVolume.data(), numCoarseValues, MPI_SUM, comm );
+  MpiWrapper::allReduce( center.data(), center.data(), 3 * numCoarseValues, MPI_SUM, comm );
+  MpiWrapper::allReduce( arithmeticPerm.data(), arithmeticPerm.data(), 3 * numCoarseValues, MPI_SUM, comm );
+  MpiWrapper::allReduce( harmonicPerm.data(), harmonicPerm.data(), 3 * numCoarseValues, MPI_SUM, comm );
+
+  // Step 2: collect the faces between two coarse cells, oriented from the lowest coarse cell index to the highest
+  FaceManager const & faceManager = mesh.getFaceManager();
+  arrayView1d< integer const > const faceGhostRank = faceManager.ghostRank();
+  arrayView2d< localIndex const > const elemRegionList = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const elemSubRegionList = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const elemList = faceManager.elementList();
+  arrayView1d< real64 const > const faceArea = faceManager.faceArea();
+  arrayView2d< real64 const > const faceCenter = faceManager.faceCenter();
+  arrayView2d< real64 const > const faceNormal = faceManager.faceNormal();
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const coarseCellIndex =
+    elemManager.constructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( viewKeyStruct::coarseCellIndexString() );
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenter =
+    elemManager.constructArrayViewAccessor< real64, 2 >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
+
+  std::vector< real64 > localInterfaces;
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    // each face is counted once, by its owner
+    if( faceGhostRank[kf] >= 0 )
+    {
+      continue;
+    }
+
+    globalIndex coarse[2] = { -1, -1 };
+    for( integer side = 0; side < 2; ++side )
+    {
+      localIndex const er = elemRegionList( kf, side );
+      localIndex const esr = elemSubRegionList( kf, side );
+      localIndex const ei = elemList( kf, side );
+      if( er >= 0 && esr >= 0 && ei >= 0 && coarseCellIndex[er][esr].size() > 0 )
+      {
+        coarse[side] = coarseCellIndex[er][esr][ei];
+      }
+    }
+    if( coarse[0] < 0 || coarse[1] < 0 || coarse[0] == coarse[1] )
+    {
+      continue;
+    }
+
+    // orient the area vector from the cell of the lowest coarse index to the other one
+    real64 cellToCell[3];
+    LvArray::tensorOps::copy< 3 >( cellToCell, elemCenter[elemRegionList( kf, 1 )][elemSubRegionList( kf, 1 )][elemList( kf, 1 )] );
+    LvArray::tensorOps::subtract< 3 >( cellToCell, elemCenter[elemRegionList( kf, 0 )][elemSubRegionList( kf, 0 )][elemList( kf, 0 )] );
+    real64 sign = LvArray::tensorOps::AiBi< 3 >( faceNormal[kf], cellToCell ) >= 0.0 ? 1.0 : -1.0;
+    if( coarse[0] > coarse[1] )
+    {
+      std::swap( coarse[0], coarse[1] );
+      sign = -sign;
+    }
+
+    localInterfaces.push_back( static_cast< real64 >( coarse[0] ) );
+    localInterfaces.push_back( static_cast< real64 >( coarse[1] ) );
+    for( integer d = 0; d < 3; ++d )
+    {
+      localInterfaces.push_back( sign * faceArea[kf] * faceNormal( kf, d ) );
+    }
+    localInterfaces.push_back( faceArea[kf] );
+    for( integer d = 0; d < 3; ++d )
+    {
+      localInterfaces.push_back( faceArea[kf] * faceCenter( kf, d ) );
+    }
+  }
+
+  int const localSize = LvArray::integerConversion< int >( localInterfaces.size() );
+  int const numRanks = MpiWrapper::commSize( comm );
+  std::vector< int > sizes( numRanks );
+  MpiWrapper::gather( &localSize, 1, sizes.data(), 1, 0, comm );
+  std::vector< int > offsets( numRanks, 0 );
+  std::partial_sum( sizes.begin(), sizes.end() - 1, offsets.begin() + 1 );
+  std::vector< real64 > allInterfaces( rank == 0 ? offsets.back() + sizes.back() : 0 );
+  MpiWrapper::gatherv( localInterfaces.data(), localSize, allInterfaces.data(), sizes.data(), offsets.data(), 0, comm );
+
+  if( rank != 0 )
+  {
+    return;
+  }
+
+  // Step 3: upscaled properties of the coarse cells
+  array2d< real64 > coarsePerm( numCoarseCells, 3 );
+  for( localIndex ic = 0; ic < numCoarseCells; ++ic )
+  {
+    real64 const v = volume[ic];
+    for( integer d = 0; d < 3; ++d )
+    {
+      center( ic, d ) = v > 0.0 ? center( ic, d ) / v : 0.0;
+      // geometric mean of the arithmetic and harmonic averages, which bound the effective permeability
+      coarsePerm( ic, d ) = v > 0.0 ? std::sqrt( arithmeticPerm( ic, d ) / harmonicPerm( ic, d ) ) : 0.0;
+    }
+  }
+
+  // Step 4: TPFA transmissibilities between the coarse cells, from the merged interfaces
+  std::map< std::pair< globalIndex, globalIndex >, std::array< real64, interfaceRecordSize - 2 > > interfaces;
+  for( size_t r = 0; r < allInterfaces.size(); r += interfaceRecordSize )
+  {
+    std::array< real64, interfaceRecordSize - 2 > & sums =
+      interfaces[{ static_cast< globalIndex >( allInterfaces[r] ), static_cast< globalIndex >( allInterfaces[r + 1] ) }];
+    for( integer k = 0; k < interfaceRecordSize - 2; ++k )
+    {
+      sums[k] += allInterfaces[r + 2 + k];
+    }
+  }
+
+  auto const halfTransmissibility = [&]( localIndex const ic, real64 const (&areaVector)[3], real64 const (&interfaceCenter)[3] )
+  {
+    real64 cellToFace[3];
+    LvArray::tensorOps::copy< 3 >( cellToFace, interfaceCenter );
+    LvArray::tensorOps::subtract< 3 >( cellToFace, center[ic] );
+    real64 const distance2 = LvArray::tensorOps::l2NormSquared< 3 >( cellToFace );
+    real64 flux = 0.0;
+    for( integer d = 0; d < 3; ++d )
+    {
+      flux += areaVector[d] * coarsePerm( ic, d ) * cellToFace[d];
+    }
+    return distance2 > 0.0 ? std::fabs( flux ) / distance2 : 0.0;
+  };
+
+  std::ofstream output( m_outputFile );
+  GEOS_THROW_IF( !output, GEOS_FMT( "{}: could not open the file {}", getDataContext(), m_outputFile ), InputError );
+  output << std::scientific;
+  output << "# coarseCells " << numCoarseCells << "\n";
+  output << "# index volume poreVolume porosity centerX centerY centerZ permeabilityX permeabilityY permeabilityZ\n";
+  for( localIndex ic = 0; ic < numCoarseCells; ++ic )
+  {
+    output << ic << " " << volume[ic] << " " << poreVolume[ic] << " " << ( volume[ic] > 0.0 ? poreVolume[ic] / volume[ic] : 0.0 );
+    for( integer d = 0; d < 3; ++d )
+    {
+      output << " " << center( ic, d );
+    }
+    for( integer d = 0; d < 3; ++d )
+    {
+      output << " " << coarsePerm( ic, d );
+    }
+    output << "\n";
+  }
+
+  output << "# connections " << interfaces.size() << "\n";
+  output << "# index1 index2 transmissibility\n";
+  for( auto const & [cells, sums] : interfaces )
+  {
+    real64 const areaVector[3] = { sums[0], sums[1], sums[2] };
+    real64 const interfaceCenter[3] = { sums[4] / sums[3], sums[5] / sums[3], sums[6] / sums[3] };
+    real64 const t1 = halfTransmissibility( cells.first, areaVector, interfaceCenter );
+    real64 const t2 = halfTransmissibility( cells.second, areaVector, interfaceCenter );
+    output << cells.first << " " << cells.second << " " << ( t1 + t2 > 0.0 ? t1 * t2 / ( t1 + t2 ) : 0.0 ) << "\n";
+  }
+
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: coarse model of {} cells and {} connections written to {}",
+                                      getName(), numCoarseCells, interfaces.size(), m_outputFile ) );
+}
+
+void CoarseModelUpscaling::updateRefinedCoarseCells( MeshLevel & mesh,
+                                                     arrayView1d< string const > const & regionNames )
+{
+  GEOS_MARK_FUNCTION;
+
+  MPI_Comm const comm = MPI_COMM_GEOSX;
+  int const numCoarseValues = LvArray::integerConversion< int >( m_numCoarseCells );
+  ElementRegionManager & elemManager = mesh.getElemManager();
+
+  // Step 1: flag the coarse cells containing a cell of the front
+  arrayView1d< integer > const refined = m_refinedCoarseCells.toView();
+  real64 const frontPressureChange = m_frontPressureChange;
+  integer const frontPhaseIndex = m_frontPhaseIndex;
+  real64 const frontPhaseVolumeFraction = m_frontPhaseVolumeFraction;
+
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion const & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< globalIndex const > const coarseCellIndex = subRegion.getReference< array1d< globalIndex > >( viewKeyStruct::coarseCellIndexString() );
+    arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+    arrayView1d< real64 const > const initPres = subRegion.hasField< fields::flow::initialPressure >()
+                                                ? subRegion.getField< fields::flow::initialPressure >().toViewConst()
+                                                : pres;
+    bool const usePhaseVolFrac = frontPhaseIndex >= 0 && subRegion.hasField< fields::flow::phaseVolumeFraction >();
+    arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac = usePhaseVolFrac
+                                                                        ? subRegion.getField< fields::flow::phaseVolumeFraction >().toViewConst()
+                                                                        : arrayView2d< real64 const, compflow::USD_PHASE >();
+    GEOS_THROW_IF( usePhaseVolFrac && frontPhaseIndex >= phaseVolFrac.size( 1 ),
+                   getWrapperDataContext( viewKeyStruct::frontPhaseIndexString() ) << ": Invalid value.",
+                   InputError );
+
+    forAll< serialPolicy >( subRegion.size(), [=] ( localIndex const ei )
+    {
+      if( ghostRank[ei] >= 0 )
+      {
+        return;
+      }
+      bool const isFront = LvArray::math::abs( pres[ei] - initPres[ei] ) > frontPressureChange
+                           || ( usePhaseVolFrac && phaseVolFrac[ei][frontPhaseIndex] > frontPhaseVolumeFraction );
+      if( isFront )
+      {
+        refined[coarseCellIndex[ei]] = 1;
+      }
+    } );
+  } );
+  MpiWrapper::allReduce( refined.data(), refined.data(), numCoarseValues, MPI_MAX, comm );
+
+  // Step 2: add the layers of coarse cells around the refined ones, from the pairs of coarse cells sharing a face
+  FaceManager const & faceManager = mesh.getFaceManager();
+  arrayView2d< localIndex const > const elemRegionList = faceManager.elementRegionList();
+  arrayView2d< localIndex const > const elemSubRegionList = faceManager.elementSubRegionList();
+  arrayView2d< localIndex const > const elemList = faceManager.elementList();
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const coarseCellIndex =
+    elemManager.constructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( viewKeyStruct::coarseCellIndexString() );
+
+  std::set< std::pair< globalIndex, globalIndex > > coarsePairs;
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    globalIndex coarse[2] = { -1, -1 };
+    for( integer side = 0; side < 2; ++side )
+    {
+      localIndex const er = elemRegionList( kf, side );
+      localIndex const esr = elemSubRegionList( kf, side );
+      localIndex const ei = elemList( kf, side );
+      if( er >= 0 && esr >= 0 && ei >= 0 && coarseCellIndex[er][esr].size() > 0 )
+      {
+        coarse[side] = coarseCellIndex[er][esr][ei];
+      }
+    }
+    if( coarse[0] >= 0 && coarse[1] >= 0 && coarse[0] != coarse[1] )
+    {
+      coarsePairs.insert( { std::min( coarse[0], coarse[1] ), std::max( coarse[0], coarse[1] ) } );
+    }
+  }
+
+  array1d< integer > nextRefined( m_numCoarseCells );
+  for( integer layer = 0; layer < m_frontHaloLayers; ++layer )
+  {
+    for( localIndex ic = 0; ic < m_numCoarseCells; ++ic )
+    {
+      nextRefined[ic] = refined[ic];
+    }
+    for( auto const & [first, second] : coarsePairs )
+    {
+      if( refined[first] != 0 || refined[second] != 0 )
+      {
+        nextRefined[first] = 1;
+        nextRefined[second] = 1;
+      }
+    }
+    MpiWrapper::allReduce( nextRefined.data(), refined.data(), numCoarseValues, MPI_MAX, comm );
+  }
+
+  // Step 3: store the refinement flag of the cells, and count the unknowns of the mixed-resolution system
+  globalIndex numFineCells = 0;
+  globalIndex numRefinedFineCells = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< globalIndex const > const cellCoarseIndex = subRegion.getReference< array1d< globalIndex > >( viewKeyStruct::coarseCellIndexString() );
+    arrayView1d< integer > const refinedCoarseCell = subRegion.getReference< array1d< integer > >( viewKeyStruct::refinedCoarseCellString() );
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      refinedCoarseCell[ei] = cellCoarseIndex[ei] >= 0 ? refined[cellCoarseIndex[ei]] : 0;
+      if( ghostRank[ei] < 0 )
+      {
+        ++numFineCells;
+        numRefinedFineCells += refinedCoarseCell[ei];
+      }
+    }
+  } );
+  numFineCells = MpiWrapper::sum( numFineCells, comm );
+  numRefinedFineCells = MpiWrapper::sum( numRefinedFineCells, comm );
+
+  globalIndex const numRefinedCoarseCells = std::accumulate( refined.begin(), refined.end(), globalIndex( 0 ) );
+  globalIndex const numActiveCells = numRefinedFineCells + m_numCoarseCells - numRefinedCoarseCells;
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: {} of {} coarse cells refined, {} active cells instead of {} ({:.1f}%)",
+                                      getName(), numRefinedCoarseCells, m_numCoarseCells, numActiveCells, numFineCells,
+                                      numFineCells > 0 ? 100.0 * static_cast< real64 >( numActiveCells ) / static_cast< real64 >( numFineCells ) : 0.0 ) );
+}
+
+REGISTER_CATALOG_ENTRY( TaskBase,
+                        CoarseModelUpscaling,
+                        string const &, dataRepository::Group * const )
+
+} /* namespace geos */
@@ -0,0 +1,169 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CoarseModelUpscaling.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_FLUIDFLOW_COARSEMODELUPSCALING_HPP_
+#define GEOS_PHYSICSSOLVERS_FLUIDFLOW_COARSEMODELUPSCALING_HPP_
+
+#include "physicsSolvers/FieldStatisticsBase.hpp"
+
+namespace geos
+{
+
+class FlowSolverBase;
+
+/**
+ * @class CoarseModelUpscaling
+ *
+ * Task class building a coarse flow model of the target regions of a flow solver, for the screening of ensembles.
+ *
+ * The cells are agglomerated into coarse cells by a partitioning of their face-connectivity graph with ParMETIS,
+ * and the coarse index of each cell is stored in a field of the cell subregions (used to downscale coarse results).
+ * The porosity of the coarse cells is the ratio of their pore volume to their bulk volume, and their permeability,
+ * in each direction, is the geometric mean of the volume-weighted arithmetic and harmonic averages of the permeability
+ * of their cells. The transmissibility between two coarse cells is the TPFA transmissibility computed with the
+ * upscaled permeabilities, the volume-weighted centers of the coarse cells and the area-weighted center and the sum of
+ * the area vectors of the faces on their interface. The coarse model is written to a text file by the first rank.
+ *
+ * With dynamic coarsening, the cells are agglomerated at the first execution only, and each execution then tracks the
+ * front of the plume: a cell is in the front when its pressure has changed from the initial pressure, or when the volume
+ * fraction of the front phase exceeds a threshold. The coarse cells containing a cell of the front, and a few layers of
+ * coarse cells around them, are flagged as refined (once refined, a coarse cell stays refined), so that only the
+ * remaining coarse cells are treated at the coarse resolution.
+ */
+class CoarseModelUpscaling : public FieldStatisticsBase< FlowSolverBase >
+{
+public:
+
+  /**
+   * @brief Constructor for the upscaling class
+   * @param[in] name the name of the task coming from the xml
+   * @param[in] parent the parent group of the task
+   */
+  CoarseModelUpscaling( const string & name,
+                        Group * const parent );
+
+  /// Accessor for the catalog name
+  static string catalogName() { return "CoarseModelUpscaling"; }
+
+  /**
+   * @defgroup Tasks Interface Functions
+   *
+   * This function implements the interface defined by the abstract TaskBase class
+   */
+  /**@{*/
+
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**@}*/
+
+  /**
+   * @struct viewKeyStruct holds char strings and viewKeys for fast lookup
+   */
+  struct viewKeyStruct
+  {
+    /// String for the number of coarse cells
+    constexpr static char const * numCoarseCellsString() { return "numCoarseCells"; }
+    /// String for the output file
+    constexpr static char const * outputFileString() { return "outputFile"; }
+    /// String for the coarse cell index of the cells
+    constexpr static char const * coarseCellIndexString() { return "coarseCellIndex"; }
+    /// String for the flag enabling the dynamic coarsening
+    constexpr static char const * dynamicCoarseningString() { return "dynamicCoarsening"; }
+    /// String for the pressure change threshold of the front
+    constexpr static char const * frontPressureChangeString() { return "frontPressureChange"; }
+    /// String for the index of the front phase
+    constexpr static char const * frontPhaseIndexString() { return "frontPhaseIndex"; }
+    /// String for the phase volume fraction threshold of the front
+    constexpr static char const * frontPhaseVolumeFractionString() { return "frontPhaseVolumeFraction"; }
+    /// String for the number of layers of refined coarse cells around the front
+    constexpr static char const * frontHaloLayersString() { return "frontHaloLayers"; }
+    /// String for the refinement flag of the cells
+    constexpr static char const * refinedCoarseCellString() { return "refinedCoarseCell"; }
+  };
+
+private:
+
+  using Base = FieldStatisticsBase< FlowSolverBase >;
+
+  /**
+   * @brief Agglomerate the cells of the target regions and store their coarse cell index.
+   * @param[in] domain the domain partition
+   * @param[in] mesh the mesh level object
+   * @param[in] regionNames the array of target region names
+   */
+  void agglomerateCells( DomainPartition & domain,
+                         MeshLevel & mesh,
+                         arrayView1d< string const > const & regionNames ) const;
+
+  /**
+   * @brief Compute the coarse model from the agglomerates, and write it to the output file.
+   * @param[in] mesh the mesh level object
+   * @param[in] regionNames the array of target region names
+   */
+  void computeCoarseModel( MeshLevel const & mesh,
+                           arrayView1d< string const > const & regionNames ) const;
+
+  /**
+   * @brief Flag the coarse cells near the front of the plume as refined, and report the size of the active system.
+   * @param[in] mesh the mesh level object
+   * @param[in] regionNames the array of target region names
+   */
+  void updateRefinedCoarseCells( MeshLevel & mesh,
+                                 arrayView1d< string const > const & regionNames );
+
+  void postProcessInput() override;
+
+  void registerDataOnMesh( Group & meshBodies ) override;
+
+  /// Number of coarse cells
+  integer m_numCoarseCells;
+
+  /// Name of the file of the coarse model
+  string m_outputFile;
+
+  /// Flag enabling the dynamic coarsening
+  integer m_dynamicCoarsening;
+
+  /// Pressure change from the initial pressure above which a cell is in the front
+  real64 m_frontPressureChange;
+
+  /// Index of the phase whose volume fraction defines the front (negative if unused)
+  integer m_frontPhaseIndex;
+
+  /// Volume fraction of the front phase above which a cell is in the front
+  real64 m_frontPhaseVolumeFraction;
+
+  /// Number of layers of refined coarse cells around the coarse cells of the front
+  integer m_frontHaloLayers;
+
+  /// Flag indicating whether the cells have been agglomerated, with dynamic coarsening
+  bool m_isAgglomerated;
+
+  /// Refinement flag of each coarse cell
+  array1d< integer > m_refinedCoarseCells;
+
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_PHYSICSSOLVERS_FLUIDFLOW_COARSEMODELUPSCALING_HPP_ */
@@ -66,8 +66,12 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
   m_hasDiffusion( 0 ),
   m_hasDispersion( 0 ),
   m_keepFlowVariablesConstantDuringInitStep( 0 ),
+  m_residualOnlyAssembly( 0 ),
   m_minScalingFactor( 0.01 ),
-  m_allowCompDensChopping( 1 )
+  m_allowCompDensChopping( 1 ),
+  m_fluidUpdateTolerance( 0.0 ),
+  m_usePhaseStateOrdering( 0 ),
+  m_hasPhaseStateOrdering( false )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::inputTemperatureString(), &m_inputTemperature ).
@@ -122,6 +126,21 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setApplyDefaultValue( 1 ).
     setDescription( "Flag indicating whether local (cell-wise) chopping of negative compositions is allowed" );
 
+  this->registerWrapper( viewKeyStruct::fluidUpdateToleranceString(), &m_fluidUpdateTolerance ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Tolerance on the (relative) change in pressure and temperature and on the (absolute) change in component fractions "
+                    "since the last evaluation of the fluid properties of a cell, below which these properties are not re-evaluated. "
+                    "Cells close to convergence are then skipped in the fluid updates of the Newton iterations (0 disables this option)" );
+
+  this->registerWrapper( viewKeyStruct::usePhaseStateOrderingString(), &m_usePhaseStateOrdering ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag indicating whether the fluid, relative permeability and capillary pressure updates visit the cells grouped by phase state. "
+                    "The grouping is computed at the beginning of each time step, and reduces the divergence of the constitutive kernels on GPUs" );
+
 }
 
 void CompositionalMultiphaseBase::postProcessInput()
@@ -140,6 +159,13 @@ void CompositionalMultiphaseBase::postProcessInput()
   GEOS_ERROR_IF_LE_MSG( m_maxRelativePresChange, 0.0,
                         getWrapperDataContext( viewKeyStruct::maxRelativePresChangeString() ) <<
                         ": The maximum relative change in pressure in a Newton iteration must be larger than 0.0" );
+  GEOS_ERROR_IF_LT_MSG( m_fluidUpdateTolerance, 0.0,
+                        getWrapperDataContext( viewKeyStruct::fluidUpdateToleranceString() ) <<
+                        ": The tolerance on the change of state for the fluid updates must be non-negative" );
+  GEOS_ERROR_IF_GE_MSG( m_fluidUpdateTolerance, 1.0,
+                        getWrapperDataContext( viewKeyStruct::fluidUpdateToleranceString() ) <<
+                        ": The tolerance on the change of state for the fluid updates must be smaller than 1.0" );
+
   GEOS_ERROR_IF_GT_MSG( m_maxRelativeTempChange, 1.0,
                         getWrapperDataContext( viewKeyStruct::maxRelativeTempChangeString() ) <<
                         ": The maximum relative change in temperature in a Newton iteration must be smaller or equal to 1.0 (i.e., 100 percent change)" );
@@ -221,6 +247,11 @@ void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
     MultiFluidBase const & referenceFluid = cm.getConstitutiveRelation< MultiFluidBase >( m_referenceFluidModelName );
     m_numPhases = referenceFluid.numFluidPhases();
     m_numComponents = referenceFluid.numFluidComponents();
+    GEOS_THROW_IF( !isothermalCompositionalMultiphaseBaseKernels::internal::isNumCompSupported( m_numComponents ),
+                   GEOS_FMT( "{}: the compositional kernels are not compiled for {} components, "
+                             "add this number to the GEOS_COMPOSITIONAL_NUM_COMPONENTS build option",
+                             getDataContext(), m_numComponents ),
+                   InputError );
   }
   // n_c components + one pressure ( + one temperature if needed )
   m_numDofPerCell = m_isThermal ? m_numComponents + 2 : m_numComponents + 1;
@@ -304,6 +335,20 @@ void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
         subRegion.registerField< temperature_k >( getName() ); // needed for the fixed-stress porosity update
       }
 
+      if( m_usePhaseStateOrdering )
+      {
+        subRegion.registerField< phaseStateOrdering >( getName() );
+      }
+
+      if( m_fluidUpdateTolerance > 0.0 )
+      {
+        // state at the last evaluation of the fluid properties, used to skip the cells whose state has not changed
+        subRegion.registerField< fluidUpdatePressure >( getName() );
+        subRegion.registerField< fluidUpdateTemperature >( getName() );
+        subRegion.registerField< fluidUpdateGlobalCompFraction >( getName() ).
+          reference().resizeDimension< 1 >( m_numComponents );
+      }
+
       subRegion.registerField< pressureScalingFactor >( getName() );
       subRegion.registerField< temperatureScalingFactor >( getName() );
       subRegion.registerField< globalCompDensityScalingFactor >( getName() );
@@ -346,10 +391,13 @@ void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
       // We make the assumption that component names are uniform across the fluid models used in the simulation
       MultiFluidBase const & fluid0 = cm.getConstitutiveRelation< MultiFluidBase >( m_referenceFluidModelName );
 
-      // TODO: add conditional registration later, this is only needed when there is a face-based Dirichlet BC
-      faceManager.registerField< facePressure >( getName() );
-      faceManager.registerField< faceTemperature >( getName() );
+      // only needed when there is a face-based Dirichlet BC, hence allocated when first retrieved
+      faceManager.registerField< facePressure >( getName() ).
+        setLazyAllocation();
+      faceManager.registerField< faceTemperature >( getName() ).
+        setLazyAllocation();
       faceManager.registerField< faceGlobalCompFraction >( getName() ).
+        setLazyAllocation().
         setDimLabels( 1, fluid0.componentNames() ).
         reference().resizeDimension< 1 >( m_numComponents );
     }
@@ -612,6 +660,76 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
   string const & fluidName = dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() );
   MultiFluidBase & fluid = getConstitutiveModel< MultiFluidBase >( dataGroup, fluidName );
 
+  constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    using FluidType = TYPEOFREF( castedFluid );
+    using ExecPolicy = typename FluidType::exec_policy;
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    if( m_fluidUpdateTolerance > 0.0 )
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( dataGroup.size(),
+                              m_fluidUpdateTolerance,
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac,
+                              dataGroup.getField< fields::flow::fluidUpdatePressure >(),
+                              dataGroup.getField< fields::flow::fluidUpdateTemperature >(),
+                              dataGroup.getField< fields::flow::fluidUpdateGlobalCompFraction >() );
+    }
+    else if( !getPhaseStateOrdering( dataGroup ).empty() )
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( getPhaseStateOrdering( dataGroup ),
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
+    else
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( dataGroup.size(),
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
+  } );
+}
+
+void CompositionalMultiphaseBase::updateComponentFractionAndFluidModel( ObjectManagerBase & dataGroup ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const pres = dataGroup.getField< fields::flow::pressure >();
+  arrayView1d< real64 const > const temp = dataGroup.getField< fields::flow::temperature >();
+  arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+    dataGroup.getField< fields::flow::globalCompDensity >();
+  arrayView2d< real64, compflow::USD_COMP > const compFrac =
+    dataGroup.getField< fields::flow::globalCompFraction >();
+  arrayView3d< real64, compflow::USD_COMP_DC > const dCompFrac_dCompDens =
+    dataGroup.getField< fields::flow::dGlobalCompFraction_dGlobalCompDensity >();
+
+  // the state at the last fluid update is only registered if the fluid updates are localized
+  arrayView1d< real64 > lastPres;
+  arrayView1d< real64 > lastTemp;
+  arrayView2d< real64, compflow::USD_COMP > lastCompFrac;
+  if( m_fluidUpdateTolerance > 0.0 )
+  {
+    lastPres = dataGroup.getField< fields::flow::fluidUpdatePressure >();
+    lastTemp = dataGroup.getField< fields::flow::fluidUpdateTemperature >();
+    lastCompFrac = dataGroup.getField< fields::flow::fluidUpdateGlobalCompFraction >();
+  }
+
+  string const & fluidName = dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() );
+  MultiFluidBase & fluid = getConstitutiveModel< MultiFluidBase >( dataGroup, fluidName );
+
   constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
   {
     using FluidType = TYPEOFREF( castedFluid );
@@ -619,12 +737,19 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
     typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
     thermalCompositionalMultiphaseBaseKernels::
-      FluidUpdateKernel::
+      FluidStateUpdateKernel::
       launch< ExecPolicy >( dataGroup.size(),
+                            m_fluidUpdateTolerance,
                             fluidWrapper,
                             pres,
                             temp,
-                            compFrac );
+                            compDens,
+                            compFrac,
+                            dCompFrac_dCompDens,
+                            lastPres,
+                            lastTemp,
+                            lastCompFrac,
+                            getPhaseStateOrdering( dataGroup ) );
   } );
 }
 
@@ -642,11 +767,23 @@ void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGr
   {
     typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
 
-    isothermalCompositionalMultiphaseBaseKernels::
-      RelativePermeabilityUpdateKernel::
-      launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                        relPermWrapper,
-                                        phaseVolFrac );
+    arrayView1d< localIndex const > const ordering = getPhaseStateOrdering( dataGroup );
+    if( !ordering.empty() )
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( ordering,
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
+    else
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
   } );
 }
 
@@ -666,15 +803,37 @@ void CompositionalMultiphaseBase::updateCapPressureModel( ObjectManagerBase & da
     {
       typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
 
-      isothermalCompositionalMultiphaseBaseKernels::
-        CapillaryPressureUpdateKernel::
-        launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                          capPresWrapper,
-                                          phaseVolFrac );
+      arrayView1d< localIndex const > const ordering = getPhaseStateOrdering( dataGroup );
+      if( !ordering.empty() )
+      {
+        isothermalCompositionalMultiphaseBaseKernels::
+          CapillaryPressureUpdateKernel::
+          launch< parallelDevicePolicy<> >( ordering,
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
+      else
+      {
+        isothermalCompositionalMultiphaseBaseKernels::
+          CapillaryPressureUpdateKernel::
+          launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                            capPresWrapper,
+                                            phaseVolFrac );
+      }
     } );
   }
 }
 
+arrayView1d< localIndex const > CompositionalMultiphaseBase::getPhaseStateOrdering( ObjectManagerBase const & dataGroup ) const
+{
+  // the permutations are only valid once computed for the cells of the current time step
+  if( !m_hasPhaseStateOrdering || !dataGroup.hasField< fields::flow::phaseStateOrdering >() )
+  {
+    return arrayView1d< localIndex const >();
+  }
+  return dataGroup.getField< fields::flow::phaseStateOrdering >();
+}
+
 void CompositionalMultiphaseBase::updateSolidInternalEnergyModel( ObjectManagerBase & dataGroup ) const
 {
   arrayView1d< real64 const > const temp = dataGroup.getField< fields::flow::temperature >();
@@ -697,8 +856,7 @@ real64 CompositionalMultiphaseBase::updateFluidState( ObjectManagerBase & subReg
 {
   GEOS_MARK_FUNCTION;
 
-  updateComponentFraction( subRegion );
-  updateFluidModel( subRegion );
+  updateComponentFractionAndFluidModel( subRegion );
   real64 const maxDeltaPhaseVolFrac = updatePhaseVolumeFraction( subRegion );
   updateRelPermModel( subRegion );
   updatePhaseMobility( subRegion );
@@ -940,9 +1098,32 @@ void CompositionalMultiphaseBase::computeHydrostaticEquilibrium()
                                           globalMaxElevation,
                                           globalMinElevation );
 
-  // Step 3: for each equil, compute a fine table with hydrostatic pressure vs elevation if the region is a target region
+  // Step 3: for each equil, compute a fine table with hydrostatic pressure vs elevation for each fluid model of the target regions
+  // the table only depends on the equil and on the fluid model, so it is computed once for all the subregions sharing them,
+  // and the (sequential) integration of the tables is distributed over the ranks holding these subregions
+
+  std::map< string, localIndex > fluidNameToFluidId;
+  domain.getConstitutiveManager().forSubGroups< MultiFluidBase >( [&] ( MultiFluidBase const & fluid )
+  {
+    localIndex const fluidId = fluidNameToFluidId.size();
+    fluidNameToFluidId[fluid.getName()] = fluidId;
+  } );
+  localIndex const numFluids = fluidNameToFluidId.size();
+  localIndex const numTables = equilCounter * numFluids;
+
+  // data of the table of an (equil, fluid) pair, only filled on the ranks holding a subregion using it
+  struct HydrostaticTableData
+  {
+    MultiFluidBase * fluid = nullptr;
+    integer ipInit = -1;
+    TableFunction const * presTable = nullptr;
+  };
+  std::vector< HydrostaticTableData > tableData( numTables );
+  array1d< integer > isTableNeeded( numTables );
+  isTableNeeded.zero();
+
+  // Step 3.1: find the (equil, fluid) pairs used on this rank and check the consistency of the fluid models
 
-  // first compute the region filter
   std::set< string > regionFilter;
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
@@ -959,59 +1140,11 @@ void CompositionalMultiphaseBase::computeHydrostaticEquilibrium()
                                                     EquilibriumInitialCondition::catalogName(),
                                                     [&] ( EquilibriumInitialCondition const & fs,
                                                           string const &,
-                                                          SortedArrayView< localIndex const > const & targetSet,
+                                                          SortedArrayView< localIndex const > const &,
                                                           ElementSubRegionBase & subRegion,
                                                           string const & )
     {
-      // Step 3.1: retrieve the data necessary to construct the pressure table in this subregion
-
-      integer const maxNumEquilIterations = fs.getMaxNumEquilibrationIterations();
-      real64 const equilTolerance = fs.getEquilibrationTolerance();
-      real64 const datumElevation = fs.getDatumElevation();
-      real64 const datumPressure = fs.getDatumPressure();
-      string const initPhaseName = fs.getInitPhaseName(); // will go away when GOC/WOC are implemented
-
-      localIndex const equilIndex = equilNameToEquilId.at( fs.getName() );
-      real64 const minElevation = LvArray::math::min( globalMinElevation[equilIndex], datumElevation );
-      real64 const maxElevation = LvArray::math::max( globalMaxElevation[equilIndex], datumElevation );
-      real64 const elevationIncrement = LvArray::math::min( fs.getElevationIncrement(), maxElevation - minElevation );
-      localIndex const numPointsInTable = ( elevationIncrement > 0 ) ? std::ceil( (maxElevation - minElevation) / elevationIncrement ) + 1 : 1;
-
-      real64 const eps = 0.1 * (maxElevation - minElevation); // we add a small buffer to only log in the pathological cases
-      GEOS_LOG_RANK_0_IF( ( (datumElevation > globalMaxElevation[equilIndex]+eps)  || (datumElevation < globalMinElevation[equilIndex]-eps) ),
-                          CompositionalMultiphaseBase::catalogName() << " " << getDataContext() <<
-                          ": By looking at the elevation of the cell centers in this model, GEOS found that " <<
-                          "the min elevation is " << globalMinElevation[equilIndex] << " and the max elevation is " <<
-                          globalMaxElevation[equilIndex] << "\nBut, a datum elevation of " << datumElevation <<
-                          " was specified in the input file to equilibrate the model.\n " <<
-                          "The simulation is going to proceed with this out-of-bound datum elevation," <<
-                          " but the initial condition may be inaccurate." );
-
-      array1d< array1d< real64 > > elevationValues;
-      array1d< real64 > pressureValues;
-      elevationValues.resize( 1 );
-      elevationValues[0].resize( numPointsInTable );
-      pressureValues.resize( numPointsInTable );
-
-      // Step 3.2: retrieve the user-defined tables (temperature and comp fraction)
-
-      FunctionManager & functionManager = FunctionManager::getInstance();
-
-      array1d< TableFunction::KernelWrapper > compFracTableWrappers;
-      arrayView1d< string const > compFracTableNames = fs.getComponentFractionVsElevationTableNames();
-      for( integer ic = 0; ic < numComps; ++ic )
-      {
-        TableFunction const & compFracTable = functionManager.getGroup< TableFunction >( compFracTableNames[ic] );
-        compFracTableWrappers.emplace_back( compFracTable.createKernelWrapper() );
-      }
-
-      string const tempTableName = fs.getTemperatureVsElevationTableName();
-      TableFunction const & tempTable = functionManager.getGroup< TableFunction >( tempTableName );
-      TableFunction::KernelWrapper tempTableWrapper = tempTable.createKernelWrapper();
-
-      // Step 3.3: retrieve the fluid model to compute densities
       // we end up with the same issue as in applyDirichletBC: there is not a clean way to retrieve the fluid info
-
       Group const & region = subRegion.getParent().getParent();
       auto itRegionFilter = regionFilter.find( region.getName() );
       if( itRegionFilter == regionFilter.end() )
@@ -1035,70 +1168,212 @@ void CompositionalMultiphaseBase::computeHydrostaticEquilibrium()
       }
 
       // Note: for now, we assume that the reservoir is in a single-phase state at initialization
+      string const initPhaseName = fs.getInitPhaseName(); // will go away when GOC/WOC are implemented
       arrayView1d< string const > phaseNames = fluid.phaseNames();
       auto const itPhaseNames = std::find( std::begin( phaseNames ), std::end( phaseNames ), initPhaseName );
       GEOS_THROW_IF( itPhaseNames == std::end( phaseNames ),
                      CompositionalMultiphaseBase::catalogName() << " " << getDataContext() << ": phase name " <<
                      initPhaseName << " not found in the phases of " << fluid.getDataContext(),
                      InputError );
-      integer const ipInit = std::distance( std::begin( phaseNames ), itPhaseNames );
 
-      // Step 3.4: compute the hydrostatic pressure values
+      localIndex const tableIndex = equilNameToEquilId.at( fs.getName() ) * numFluids + fluidNameToFluidId.at( fluidName );
+      isTableNeeded[tableIndex] = 1;
+      tableData[tableIndex].fluid = &fluid;
+      tableData[tableIndex].ipInit = std::distance( std::begin( phaseNames ), itPhaseNames );
+    } );
+  } );
 
-      constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  // Step 3.2: assign each table to the least loaded rank among the ranks using it
+
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const numRanks = MpiWrapper::commSize( MPI_COMM_GEOSX );
+
+  array1d< integer > isTableNeededOnRank;
+  MpiWrapper::allGather( isTableNeeded.toViewConst(), isTableNeededOnRank, MPI_COMM_GEOSX );
+
+  array1d< int > tableOwner( numTables );
+  array1d< localIndex > numOwnedTables( numRanks );
+  numOwnedTables.zero();
+  for( localIndex iTable = 0; iTable < numTables; ++iTable )
+  {
+    tableOwner[iTable] = -1;
+    for( int r = 0; r < numRanks; ++r )
+    {
+      if( isTableNeededOnRank[r * numTables + iTable] &&
+          ( tableOwner[iTable] < 0 || numOwnedTables[r] < numOwnedTables[tableOwner[iTable]] ) )
       {
-        using FluidType = TYPEOFREF( castedFluid );
-        typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+        tableOwner[iTable] = r;
+      }
+    }
+    if( tableOwner[iTable] >= 0 )
+    {
+      numOwnedTables[tableOwner[iTable]]++;
+    }
+  }
 
-        // note: inside this kernel, serialPolicy is used, and elevation/pressure values don't go to the GPU
-        isothermalCompositionalMultiphaseBaseKernels::
-          HydrostaticPressureKernel::ReturnType const returnValue =
-          isothermalCompositionalMultiphaseBaseKernels::
-            HydrostaticPressureKernel::launch( numPointsInTable,
-                                               numComps,
-                                               numPhases,
-                                               ipInit,
-                                               maxNumEquilIterations,
-                                               equilTolerance,
-                                               gravVector,
-                                               minElevation,
-                                               elevationIncrement,
-                                               datumElevation,
-                                               datumPressure,
-                                               fluidWrapper,
-                                               compFracTableWrappers.toViewConst(),
-                                               tempTableWrapper,
-                                               elevationValues.toNestedView(),
-                                               pressureValues.toView() );
-
-        GEOS_THROW_IF( returnValue ==  isothermalCompositionalMultiphaseBaseKernels::HydrostaticPressureKernel::ReturnType::FAILED_TO_CONVERGE,
-                       CompositionalMultiphaseBase::catalogName() << " " << getDataContext() <<
-                       ": hydrostatic pressure initialization failed to converge in region " << region.getName() << "! \n" <<
-                       "Try to loosen the equilibration tolerance, or increase the number of equilibration iterations. \n" <<
-                       "If nothing works, something may be wrong in the fluid model, see <Constitutive> ",
-                       std::runtime_error );
-
-        GEOS_LOG_RANK_0_IF( returnValue == isothermalCompositionalMultiphaseBaseKernels::HydrostaticPressureKernel::ReturnType::DETECTED_MULTIPHASE_FLOW,
-                            CompositionalMultiphaseBase::catalogName() << " " << getDataContext() <<
-                            ": currently, GEOS assumes that there is only one mobile phase when computing the hydrostatic pressure. \n" <<
-                            "We detected multiple phases using the provided datum pressure, temperature, and component fractions. \n" <<
-                            "Please make sure that only one phase is mobile at the beginning of the simulation. \n" <<
-                            "If this is not the case, the problem will not be at equilibrium when the simulation starts" );
+  // Step 3.3: compute the hydrostatic pressure values on the owning rank and share them with the ranks using the table
 
-      } );
+  FunctionManager & functionManager = FunctionManager::getInstance();
+
+  for( auto const & [equilName, equilIndex] : equilNameToEquilId )
+  {
+    EquilibriumInitialCondition const & fs = fsManager.getGroup< EquilibriumInitialCondition >( equilName );
+
+    // retrieve the data necessary to construct the pressure tables of this equil
+
+    integer const maxNumEquilIterations = fs.getMaxNumEquilibrationIterations();
+    real64 const equilTolerance = fs.getEquilibrationTolerance();
+    real64 const datumElevation = fs.getDatumElevation();
+    real64 const datumPressure = fs.getDatumPressure();
+
+    real64 const minElevation = LvArray::math::min( globalMinElevation[equilIndex], datumElevation );
+    real64 const maxElevation = LvArray::math::max( globalMaxElevation[equilIndex], datumElevation );
+    real64 const elevationIncrement = LvArray::math::min( fs.getElevationIncrement(), maxElevation - minElevation );
+    localIndex const numPointsInTable = ( elevationIncrement > 0 ) ? std::ceil( (maxElevation - minElevation) / elevationIncrement ) + 1 : 1;
+
+    real64 const eps = 0.1 * (maxElevation - minElevation); // we add a small buffer to only log in the pathological cases
+    GEOS_LOG_RANK_0_IF( ( (datumElevation > globalMaxElevation[equilIndex]+eps)  || (datumElevation < globalMinElevation[equilIndex]-eps) ),
+                        CompositionalMultiphaseBase::catalogName() << " " << getDataContext() <<
+                        ": By looking at the elevation of the cell centers in this model, GEOS found that " <<
+                        "the min elevation is " << globalMinElevation[equilIndex] << " and the max elevation is " <<
+                        globalMaxElevation[equilIndex] << "\nBut, a datum elevation of " << datumElevation <<
+                        " was specified in the input file to equilibrate the model.\n " <<
+                        "The simulation is going to proceed with this out-of-bound datum elevation," <<
+                        " but the initial condition may be inaccurate." );
+
+    // retrieve the user-defined tables (temperature and comp fraction)
+
+    array1d< TableFunction::KernelWrapper > compFracTableWrappers;
+    arrayView1d< string const > compFracTableNames = fs.getComponentFractionVsElevationTableNames();
+    for( integer ic = 0; ic < numComps; ++ic )
+    {
+      TableFunction const & compFracTable = functionManager.getGroup< TableFunction >( compFracTableNames[ic] );
+      compFracTableWrappers.emplace_back( compFracTable.createKernelWrapper() );
+    }
+
+    string const tempTableName = fs.getTemperatureVsElevationTableName();
+    TableFunction const & tempTable = functionManager.getGroup< TableFunction >( tempTableName );
+    TableFunction::KernelWrapper tempTableWrapper = tempTable.createKernelWrapper();
+
+    for( auto const & [fluidName, fluidIndex] : fluidNameToFluidId )
+    {
+      localIndex const tableIndex = equilIndex * numFluids + fluidIndex;
+      int const owner = tableOwner[tableIndex];
+      if( owner < 0 )
+      {
+        continue; // this fluid model is not used in the target regions of the equil
+      }
+      HydrostaticTableData & data = tableData[tableIndex];
+
+      array1d< array1d< real64 > > elevationValues;
+      array1d< real64 > pressureValues;
+      elevationValues.resize( 1 );
+      elevationValues[0].resize( numPointsInTable );
+      pressureValues.resize( numPointsInTable );
+
+      integer returnValue = static_cast< integer >( isothermalCompositionalMultiphaseBaseKernels::HydrostaticPressureKernel::ReturnType::SUCCESS );
+
+      if( rank == owner )
+      {
+        constitutiveUpdatePassThru( *data.fluid, [&] ( auto & castedFluid )
+        {
+          using FluidType = TYPEOFREF( castedFluid );
+          typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+          // note: inside this kernel, serialPolicy is used, and elevation/pressure values don't go to the GPU
+          returnValue = static_cast< integer >( isothermalCompositionalMultiphaseBaseKernels::
+                                                  HydrostaticPressureKernel::launch( numPointsInTable,
+                                                                                     numComps,
+                                                                                     numPhases,
+                                                                                     data.ipInit,
+                                                                                     maxNumEquilIterations,
+                                                                                     equilTolerance,
+                                                                                     gravVector,
+                                                                                     minElevation,
+                                                                                     elevationIncrement,
+                                                                                     datumElevation,
+                                                                                     datumPressure,
+                                                                                     fluidWrapper,
+                                                                                     compFracTableWrappers.toViewConst(),
+                                                                                     tempTableWrapper,
+                                                                                     elevationValues.toNestedView(),
+                                                                                     pressureValues.toView() ) );
+        } );
+      }
+
+      int const numValues = LvArray::integerConversion< int >( numPointsInTable );
+      MpiWrapper::bcast( elevationValues[0].data(), numValues, owner, MPI_COMM_GEOSX );
+      MpiWrapper::bcast( pressureValues.data(), numValues, owner, MPI_COMM_GEOSX );
+      MpiWrapper::broadcast( returnValue, owner );
+
+      GEOS_THROW_IF( returnValue == static_cast< integer >( isothermalCompositionalMultiphaseBaseKernels::HydrostaticPressureKernel::ReturnType::FAILED_TO_CONVERGE ),
+                     CompositionalMultiphaseBase::catalogName() << " " << getDataContext() <<
+                     ": hydrostatic pressure initialization failed to converge for fluid " << fluidName << "! \n" <<
+                     "Try to loosen the equilibration tolerance, or increase the number of equilibration iterations. \n" <<
+                     "If nothing works, something may be wrong in the fluid model, see <Constitutive> ",
+                     std::runtime_error );
+
+      GEOS_LOG_RANK_0_IF( returnValue == static_cast< integer >( isothermalCompositionalMultiphaseBaseKernels::HydrostaticPressureKernel::ReturnType::DETECTED_MULTIPHASE_FLOW ),
+                          CompositionalMultiphaseBase::catalogName() << " " << getDataContext() <<
+                          ": currently, GEOS assumes that there is only one mobile phase when computing the hydrostatic pressure. \n" <<
+                          "We detected multiple phases using the provided datum pressure, temperature, and component fractions. \n" <<
+                          "Please make sure that only one phase is mobile at the beginning of the simulation. \n" <<
+                          "If this is not the case, the problem will not be at equilibrium when the simulation starts" );
+
+      // create hydrostatic pressure table on the ranks using it
+
+      if( isTableNeeded[tableIndex] )
+      {
+        string const tableName = fs.getName() + "_" + fluidName + "_" + data.fluid->phaseNames()[data.ipInit] + "_table";
+        TableFunction * const presTable = dynamicCast< TableFunction * >( functionManager.createChild( TableFunction::catalogName(), tableName ) );
+        presTable->setTableCoordinates( elevationValues, { units::Distance } );
+        presTable->setTableValues( pressureValues, units::Pressure );
+        presTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
+        data.presTable = presTable;
+      }
+    }
+  }
+
+  // Step 4: assign pressure, temperature, and component fraction as a function of elevation
+  // TODO: this last step should probably be delayed to wait for the creation of FaceElements
+  // TODO: this last step should be modified to account for GOC and WOC
 
-      // Step 3.5: create hydrostatic pressure table
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    fsManager.apply< ElementSubRegionBase,
+                     EquilibriumInitialCondition >( 0.0,
+                                                    mesh,
+                                                    EquilibriumInitialCondition::catalogName(),
+                                                    [&] ( EquilibriumInitialCondition const & fs,
+                                                          string const &,
+                                                          SortedArrayView< localIndex const > const & targetSet,
+                                                          ElementSubRegionBase & subRegion,
+                                                          string const & )
+    {
+      Group const & region = subRegion.getParent().getParent();
+      auto itRegionFilter = regionFilter.find( region.getName() );
+      if( itRegionFilter == regionFilter.end() )
+      {
+        return; // the region is not in target, there is nothing to do
+      }
+      string const & fluidName = subRegion.getReference< string >( viewKeyStruct::fluidNamesString() );
+      HydrostaticTableData const & data =
+        tableData[ equilNameToEquilId.at( fs.getName() ) * numFluids + fluidNameToFluidId.at( fluidName ) ];
+      TableFunction::KernelWrapper presTableWrapper = data.presTable->createKernelWrapper();
 
-      string const tableName = fs.getName() + "_" + subRegion.getName() + "_" + phaseNames[ipInit] + "_table";
-      TableFunction * const presTable = dynamicCast< TableFunction * >( functionManager.createChild( TableFunction::catalogName(), tableName ) );
-      presTable->setTableCoordinates( elevationValues, { units::Distance } );
-      presTable->setTableValues( pressureValues, units::Pressure );
-      presTable->setInterpolationMethod( TableFunction::InterpolationType::Linear );
-      TableFunction::KernelWrapper presTableWrapper = presTable->createKernelWrapper();
+      array1d< TableFunction::KernelWrapper > compFracTableWrappers;
+      arrayView1d< string const > compFracTableNames = fs.getComponentFractionVsElevationTableNames();
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        TableFunction const & compFracTable = functionManager.getGroup< TableFunction >( compFracTableNames[ic] );
+        compFracTableWrappers.emplace_back( compFracTable.createKernelWrapper() );
+      }
+
+      TableFunction const & tempTable = functionManager.getGroup< TableFunction >( fs.getTemperatureVsElevationTableName() );
+      TableFunction::KernelWrapper tempTableWrapper = tempTable.createKernelWrapper();
 
-      // Step 4: assign pressure, temperature, and component fraction as a function of elevation
-      // TODO: this last step should probably be delayed to wait for the creation of FaceElements
-      // TODO: this last step should be modified to account for GOC and WOC
       arrayView2d< real64 const > const elemCenter =
         subRegion.getReference< array2d< real64 > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
 
@@ -1204,6 +1479,9 @@ CompositionalMultiphaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM
                                                 real64 const & GEOS_UNUSED_PARAM( dt ),
                                                 DomainPartition & domain )
 {
+  // the permutations are computed below for each subregion, before its first constitutive update of the time step
+  m_hasPhaseStateOrdering = ( m_usePhaseStateOrdering != 0 );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1223,6 +1501,16 @@ CompositionalMultiphaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM
         saveDeltaPressure< parallelDevicePolicy<> >( subRegion.size(), pres, initPres, deltaPres );
       saveConvergedState( subRegion );
 
+      if( m_usePhaseStateOrdering )
+      {
+        // group the cells by phase state of the converged solution, for the constitutive updates of this time step
+        isothermalCompositionalMultiphaseBaseKernels::PhaseStateOrderingKernel::
+          launch< parallelDevicePolicy<> >( subRegion.size(),
+                                            m_numPhases,
+                                            subRegion.template getField< fields::flow::phaseVolumeFraction >(),
+                                            subRegion.template getField< fields::flow::phaseStateOrdering >() );
+      }
+
       // update porosity, permeability
       updatePorosityAndPermeability( subRegion );
       // update all fluid properties
@@ -1248,6 +1536,9 @@ CompositionalMultiphaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM
 
     } );
   } );
+
+  // the face multipliers may have been changed since the last step (e.g., fault seal updates)
+  updateStencilTransMultipliers( domain );
 }
 
 void CompositionalMultiphaseBase::assembleSystem( real64 const GEOS_UNUSED_PARAM( time_n ),
@@ -1315,6 +1606,7 @@ void CompositionalMultiphaseBase::assembleAccumulationAndVolumeBalanceTerms( Dom
                                                      m_numPhases,
                                                      dofManager.rankOffset(),
                                                      dofKey,
+                                                     m_residualOnlyAssembly,
                                                      subRegion,
                                                      fluid,
                                                      solid,
@@ -1824,6 +2116,8 @@ void CompositionalMultiphaseBase::keepFlowVariablesConstantDuringInitStep( real6
 
   GEOS_UNUSED_VAR( time, dt );
 
+  // the subregions write to different rows, so their kernels can run concurrently
+  ConcurrentDeviceKernels kernels;
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel const & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1844,7 +2138,7 @@ void CompositionalMultiphaseBase::keepFlowVariablesConstantDuringInitStep( real6
 
       integer const numComp = m_numComponents;
       integer const isThermal = m_isThermal;
-      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+      kernels.forAll( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
       {
         if( ghostRank[ei] >= 0 )
         {
@@ -1900,6 +2194,7 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
 
   integer const numComp = m_numComponents;
 
+  ConcurrentDeviceKernels kernels;
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1913,7 +2208,7 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
       arrayView2d< real64, compflow::USD_COMP > const compDens =
         subRegion.getField< fields::flow::globalCompDensity >();
 
-      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+      kernels.forAll( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
       {
         if( ghostRank[ei] < 0 )
         {
@@ -2026,32 +2321,56 @@ void CompositionalMultiphaseBase::resetStateToBeginningOfStep( DomainPartition &
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
   {
-    mesh.getElemManager().forElementSubRegions< CellElementSubRegion,
+    ElementRegionManager & elemManager = mesh.getElemManager();
+
+    // the primary variables are reset with a single launch over the (possibly many) subregions
+    ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > presAccessor =
+      elemManager.constructViewAccessor< array1d< real64 >, arrayView1d< real64 > >( fields::flow::pressure::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > pres_nAccessor =
+      elemManager.constructFieldAccessor< fields::flow::pressure_n >();
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64, compflow::USD_COMP > > compDensAccessor =
+      elemManager.constructViewAccessor< array2d< real64, compflow::LAYOUT_COMP >,
+                                         arrayView2d< real64, compflow::USD_COMP > >( fields::flow::globalCompDensity::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const, compflow::USD_COMP > > compDens_nAccessor =
+      elemManager.constructFieldAccessor< fields::flow::globalCompDensity_n >();
+    ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > tempAccessor =
+      elemManager.constructViewAccessor< array1d< real64 >, arrayView1d< real64 > >( fields::flow::temperature::key() );
+    ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > temp_nAccessor =
+      elemManager.constructFieldAccessor< fields::flow::temperature_n >();
+
+    ElementRegionManager::ElementView< arrayView1d< real64 > > const pres = presAccessor.toNestedView();
+    ElementRegionManager::ElementViewConst< arrayView1d< real64 const > > const pres_n = pres_nAccessor.toNestedViewConst();
+    ElementRegionManager::ElementView< arrayView2d< real64, compflow::USD_COMP > > const compDens = compDensAccessor.toNestedView();
+    ElementRegionManager::ElementViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const compDens_n =
+      compDens_nAccessor.toNestedViewConst();
+    ElementRegionManager::ElementView< arrayView1d< real64 > > const temp = tempAccessor.toNestedView();
+    ElementRegionManager::ElementViewConst< arrayView1d< real64 const > > const temp_n = temp_nAccessor.toNestedViewConst();
+    integer const numComp = m_numComponents;
+    bool const isThermal = m_isThermal;
+
+    elemManager.forElementsInSubRegionsBatched< parallelDevicePolicy<>,
+                                                CellElementSubRegion,
                                                 SurfaceElementSubRegion >( regionNames,
-                                                                           [&]( localIndex const,
-                                                                                auto & subRegion )
+                                                                           [=] GEOS_HOST_DEVICE ( localIndex const er,
+                                                                                                  localIndex const esr,
+                                                                                                  localIndex const ei )
     {
-      arrayView1d< real64 > const & pres =
-        subRegion.template getField< fields::flow::pressure >();
-      arrayView1d< real64 const > const & pres_n =
-        subRegion.template getField< fields::flow::pressure_n >();
-      pres.setValues< parallelDevicePolicy<> >( pres_n );
-
-      arrayView2d< real64, compflow::USD_COMP > const & compDens =
-        subRegion.template getField< fields::flow::globalCompDensity >();
-      arrayView2d< real64 const, compflow::USD_COMP > const & compDens_n =
-        subRegion.template getField< fields::flow::globalCompDensity_n >();
-      compDens.setValues< parallelDevicePolicy<> >( compDens_n );
-
-      if( m_isThermal )
+      pres[er][esr][ei] = pres_n[er][esr][ei];
+      for( integer ic = 0; ic < numComp; ++ic )
+      {
+        compDens[er][esr][ei][ic] = compDens_n[er][esr][ei][ic];
+      }
+      if( isThermal )
       {
-        arrayView1d< real64 > const & temp =
-          subRegion.template getField< fields::flow::temperature >();
-        arrayView1d< real64 const > const & temp_n =
-          subRegion.template getField< fields::flow::temperature_n >();
-        temp.setValues< parallelDevicePolicy<> >( temp_n );
+        temp[er][esr][ei] = temp_n[er][esr][ei];
       }
+    } );
 
+    elemManager.forElementSubRegions< CellElementSubRegion,
+                                      SurfaceElementSubRegion >( regionNames,
+                                                                 [&]( localIndex const,
+                                                                      auto & subRegion )
+    {
       // update porosity, permeability
       updatePorosityAndPermeability( subRegion );
       // update all fluid properties
@@ -2070,6 +2389,9 @@ void CompositionalMultiphaseBase::implicitStepComplete( real64 const & time,
                                                         real64 const & dt,
                                                         DomainPartition & domain )
 {
+  // the cells may change between time steps (e.g., new fracture elements), the permutations are recomputed at the next step
+  m_hasPhaseStateOrdering = false;
+
   // Step 1: save the converged aquifer state
   // note: we have to save the aquifer state **before** updating the pressure,
   // otherwise the aquifer flux is saved with the wrong pressure time level
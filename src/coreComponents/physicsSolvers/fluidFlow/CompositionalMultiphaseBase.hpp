@@ -125,6 +125,12 @@ public:
    */
   void updateFluidModel( ObjectManagerBase & dataGroup ) const;
 
+  /**
+   * @brief Recompute the global component fractions and update all relevant fluid models in a single pass over the cells
+   * @param dataGroup the group storing the required fields
+   */
+  void updateComponentFractionAndFluidModel( ObjectManagerBase & dataGroup ) const;
+
   /**
    * @brief Update all relevant relperm models using current values of phase volume fraction
    * @param dataGroup the group storing the required fields
@@ -137,6 +143,13 @@ public:
    */
   void updateCapPressureModel( ObjectManagerBase & dataGroup ) const;
 
+  /**
+   * @brief Get the permutation of the cells grouping them by phase state, used to order the constitutive updates
+   * @param dataGroup group that contains the fields
+   * @return the permutation, or an empty view if the cells are updated in their natural order
+   */
+  arrayView1d< localIndex const > getPhaseStateOrdering( ObjectManagerBase const & dataGroup ) const;
+
   /**
    * @brief Update all relevant solid internal energy models using current values of temperature
    * @param dataGroup the group storing the required fields
@@ -253,6 +266,8 @@ public:
     static constexpr char const * maxRelativePresChangeString() { return "maxRelativePressureChange"; }
     static constexpr char const * maxRelativeTempChangeString() { return "maxRelativeTemperatureChange"; }
     static constexpr char const * allowLocalCompDensChoppingString() { return "allowLocalCompDensityChopping"; }
+    static constexpr char const * fluidUpdateToleranceString() { return "fluidUpdateTolerance"; }
+    static constexpr char const * usePhaseStateOrderingString() { return "usePhaseStateOrdering"; }
 
   };
 
@@ -418,6 +433,9 @@ protected:
   /// flag to freeze the initial state during initialization in coupled problems
   integer m_keepFlowVariablesConstantDuringInitStep;
 
+  /// flag set while only the residual is assembled, to skip the derivatives in the kernels that support it
+  integer m_residualOnlyAssembly;
+
   /// maximum (absolute) change in a component fraction in a Newton iteration
   real64 m_maxCompFracChange;
 
@@ -445,6 +463,15 @@ protected:
   /// flag indicating whether local (cell-wise) chopping of negative compositions is allowed
   integer m_allowCompDensChopping;
 
+  /// tolerance on the change of state below which the fluid properties of a cell are not re-evaluated
+  real64 m_fluidUpdateTolerance;
+
+  /// flag indicating whether the constitutive updates visit the cells grouped by phase state
+  integer m_usePhaseStateOrdering;
+
+  /// flag indicating whether the permutations grouping the cells by phase state have been computed for the current time step
+  bool m_hasPhaseStateOrdering;
+
   /// name of the fluid constitutive model used as a reference for component/phase description
   string m_referenceFluidModelName;
 
@@ -167,6 +167,38 @@ DECLARE_FIELD( componentCFLNumber,
                NO_WRITE,
                "Component CFL number" );
 
+DECLARE_FIELD( phaseStateOrdering,
+               "phaseStateOrdering",
+               array1d< localIndex >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Permutation of the cells grouping them by phase state, used to order the constitutive updates" );
+
+DECLARE_FIELD( fluidUpdatePressure,
+               "fluidUpdatePressure",
+               array1d< real64 >,
+               LvArray::NumericLimits< real64 >::max,
+               NOPLOT,
+               NO_WRITE,
+               "Pressure at the last evaluation of the fluid properties" );
+
+DECLARE_FIELD( fluidUpdateTemperature,
+               "fluidUpdateTemperature",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Temperature at the last evaluation of the fluid properties" );
+
+DECLARE_FIELD( fluidUpdateGlobalCompFraction,
+               "fluidUpdateGlobalCompFraction",
+               array2dLayoutComp,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Global component fraction at the last evaluation of the fluid properties" );
+
 DECLARE_FIELD( globalCompDensityScalingFactor,
                "globalCompDensityScalingFactor",
                array1d< real64 >,
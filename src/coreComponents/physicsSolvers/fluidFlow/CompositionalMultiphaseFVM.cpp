@@ -77,6 +77,14 @@ void CompositionalMultiphaseFVM::initializePreSubGroups()
     ? LinearSolverParameters::MGR::StrategyType::thermalCompositionalMultiphaseFVM
     : LinearSolverParameters::MGR::StrategyType::compositionalMultiphaseFVM;
 
+  // the CPR preconditioner decouples the pressure equation within the blocks of unknowns of each cell,
+  // and the geometric multigrid aggregates the cells separately for each of these unknowns
+  if( m_linearSolverParameters.get().preconditionerType == LinearSolverParameters::PreconditionerType::cpr ||
+      m_linearSolverParameters.get().preconditionerType == LinearSolverParameters::PreconditionerType::gmg )
+  {
+    m_linearSolverParameters.get().dofsPerNode = m_numDofPerCell;
+  }
+
   DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
   NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
   FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
@@ -113,6 +121,21 @@ void CompositionalMultiphaseFVM::setupDofs( DomainPartition const & domain,
 }
 
 
+void CompositionalMultiphaseFVM::assembleResidual( real64 const time_n,
+                                                   real64 const dt,
+                                                   DomainPartition & domain,
+                                                   DofManager const & dofManager,
+                                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                   arrayView1d< real64 > const & localRhs )
+{
+  GEOS_MARK_FUNCTION;
+
+  // the thermal kernels always assemble the Jacobian
+  m_residualOnlyAssembly = !m_isThermal;
+  assembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
+  m_residualOnlyAssembly = 0;
+}
+
 void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
                                                     DomainPartition const & domain,
                                                     DofManager const & dofManager,
@@ -161,6 +184,7 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
                                                      dofManager.rankOffset(),
                                                      elemDofKey,
                                                      m_hasCapPressure,
+                                                     m_residualOnlyAssembly,
                                                      fluxApprox.upwindingParams(),
                                                      getName(),
                                                      mesh.getElemManager(),
@@ -980,7 +1004,7 @@ void CompositionalMultiphaseFVM::applyAquiferBC( real64 const time,
         return;
       }
 
-      AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = bc.createKernelWrapper();
+      AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = bc.createKernelWrapper( time, dt );
       bool const allowAllPhasesIntoAquifer = bc.allowAllPhasesIntoAquifer();
       localIndex const waterPhaseIndex = bc.getWaterPhaseIndex();
       real64 const & aquiferWaterPhaseDens = bc.getWaterPhaseDensity();
@@ -1009,7 +1033,6 @@ void CompositionalMultiphaseFVM::applyAquiferBC( real64 const time,
                                                                         multiFluidAccessors.get( fields::multifluid::dPhaseDensity{} ),
                                                                         multiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
                                                                         multiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
-                                                                        time,
                                                                         dt,
                                                                         localMatrix.toViewConstSizes(),
                                                                         localRhs.toView() );
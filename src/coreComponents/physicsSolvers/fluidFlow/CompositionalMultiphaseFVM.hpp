@@ -84,6 +84,17 @@ public:
   setupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
 
+  virtual void
+  assembleResidual( real64 const time_n,
+                    real64 const dt,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                    arrayView1d< real64 > const & localRhs ) override;
+
+  virtual bool
+  hasResidualOnlyAssembly() const override { return !m_isThermal; }
+
   virtual void
   applyBoundaryConditions( real64 const time_n,
                            real64 const dt,
@@ -21,6 +21,7 @@
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutivePassThru.hpp"
 #include "constitutive/fluid/multifluid/MultiFluidBase.hpp"
+#include "constitutive/permeability/ConstantPermeability.hpp"
 #include "constitutive/relativePermeability/RelativePermeabilityBase.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
@@ -74,6 +75,19 @@ void CompositionalMultiphaseHybridFVM::registerDataOnMesh( Group & meshBodies )
     // auxiliary data for the buoyancy coefficient
     faceManager.registerField< fields::flow::mimGravityCoefficient >( getName() );
   } );
+
+  // 3) Register the transmissibility matrices precomputed in the cells
+  forDiscretizationOnMeshTargets( meshBodies, [&] ( string const &,
+                                                    MeshLevel & mesh,
+                                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      subRegion.registerField< fields::flow::transMatrix >( getName() );
+      subRegion.registerField< fields::flow::transMatrixSinglePrecision >( getName() );
+    } );
+  } );
 }
 
 void CompositionalMultiphaseHybridFVM::initializePreSubGroups()
@@ -162,6 +176,13 @@ void CompositionalMultiphaseHybridFVM::precomputeData( MeshLevel & mesh, arrayVi
 {
   FlowSolverBase::precomputeData( mesh, regionNames );
 
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
   NodeManager const & nodeManager = mesh.getNodeManager();
   FaceManager & faceManager = mesh.getFaceManager();
 
@@ -221,6 +242,39 @@ void CompositionalMultiphaseHybridFVM::precomputeData( MeshLevel & mesh, arrayVi
                                                                            mimFaceGravCoefDenominator.toView(),
                                                                            mimFaceGravCoef );
 
+    // the transmissibility matrices can only be reused if the permeability does not change during the simulation
+    PermeabilityBase const & permeability = getConstitutiveModel< PermeabilityBase >( subRegion, permModelName );
+    if( dynamicCast< ConstantPermeability const * >( &permeability ) == nullptr )
+    {
+      return;
+    }
+
+    // the diagonal of the TPFA transmissibility used for the gravity term is stored after the transmissibility matrix
+    hybridFVMKernels::TransMatrixPrecomputeKernel::allocate( subRegion.numFacesPerElement(),
+                                                             true,
+                                                             hmDiscretization.useSinglePrecisionTransMatrix(),
+                                                             subRegion );
+
+    mimeticInnerProductReducedDispatch( mimeticInnerProductBase,
+                                        [&] ( auto const mimeticInnerProduct )
+    {
+      using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+      compositionalMultiphaseHybridFVMKernels::
+        simpleKernelLaunchSelector< hybridFVMKernels::TransMatrixPrecomputeKernel,
+                                    IP_TYPE >( subRegion.numFacesPerElement(),
+                                               subRegion.size(),
+                                               nodePosition,
+                                               transMultiplier,
+                                               faceToNodes,
+                                               elemToFaces,
+                                               elemCenter,
+                                               elemVolume,
+                                               elemPerm,
+                                               lengthTolerance,
+                                               true,
+                                               subRegion.getField< fields::flow::transMatrix >(),
+                                               subRegion.getField< fields::flow::transMatrixSinglePrecision >() );
+    } );
   } );
 
 }
@@ -166,7 +166,7 @@ public:
 
 protected:
 
-  /// precompute the minGravityCoefficient for the buoyancy term
+  /// precompute the minGravityCoefficient for the buoyancy term and the transmissibility matrices of the elements
   void precomputeData( MeshLevel & mesh, arrayView1d< string const > const & regionNames ) override;
 
 private:
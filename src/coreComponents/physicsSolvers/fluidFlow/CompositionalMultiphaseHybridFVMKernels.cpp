@@ -1526,6 +1526,9 @@ FluxKernel::
   arrayView1d< real64 const > const & elemGravCoef =
     subRegion.getReference< array1d< real64 > >( fields::flow::gravityCoefficient::key() );
 
+  // get the transmissibility matrices, if they do not change during the simulation
+  hybridFVMKernels::TransMatrixCache const transMatrixCache( subRegion );
+
   // assemble the residual and Jacobian element by element
   // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
   forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_DEVICE ( localIndex const ei )
@@ -1534,32 +1537,40 @@ FluxKernel::
     stackArray2d< real64, NF *NF > transMatrix( NF, NF );
     stackArray2d< real64, NF *NF > transMatrixGrav( NF, NF );
 
-    real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
-
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    IP_TYPE::template compute< NF >( nodePosition,
-                                     transMultiplier,
-                                     faceToNodes,
-                                     elemToFaces[ei],
-                                     elemCenter[ei],
-                                     elemVolume[ei],
-                                     perm,
-                                     lengthTolerance,
-                                     transMatrix );
-
-    // currently the gravity term in the transport scheme is treated as in MRST, that is, always with TPFA
-    // this is why below we have to recompute the TPFA transmissibility in addition to the transmissibility matrix above
-    // TODO: treat the gravity term with a consistent inner product
-    mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition,
-                                                          transMultiplier,
-                                                          faceToNodes,
-                                                          elemToFaces[ei],
-                                                          elemCenter[ei],
-                                                          elemVolume[ei],
-                                                          perm,
-                                                          lengthTolerance,
-                                                          transMatrixGrav );
+    // the local transmissibility matrices are only recomputed at each iteration if the permeability changes
+    if( transMatrixCache.isEmpty() )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       transMatrix );
+
+      // currently the gravity term in the transport scheme is treated as in MRST, that is, always with TPFA
+      // this is why below we have to recompute the TPFA transmissibility in addition to the transmissibility matrix above
+      // TODO: treat the gravity term with a consistent inner product
+      mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition,
+                                                            transMultiplier,
+                                                            faceToNodes,
+                                                            elemToFaces[ei],
+                                                            elemCenter[ei],
+                                                            elemVolume[ei],
+                                                            perm,
+                                                            lengthTolerance,
+                                                            transMatrixGrav );
+    }
+    else
+    {
+      // the TPFA transmissibility used for the gravity term is diagonal, so only its diagonal is stored
+      transMatrixCache.load< NF >( ei, 0, transMatrix );
+      transMatrixCache.loadDiagonal< NF >( ei, NF * NF, transMatrixGrav );
+    }
 
     // perform flux assembly in this element
     compositionalMultiphaseHybridFVMKernels::AssemblerKernel::compute< NF, NC, NP >( er, esr, ei,
@@ -1017,9 +1017,9 @@ public:
     arrayView1d< integer const > const ghostRank = faceManager.ghostRank();
 
     using kernelType = ResidualNormKernel;
-    typename kernelType::CompFlowAccessors flowAccessors( elemManager, solverName );
-    typename kernelType::MultiFluidAccessors fluidAccessors( elemManager, solverName );
-    typename kernelType::PorosityAccessors poroAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::CompFlowAccessors >( solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename kernelType::MultiFluidAccessors >( solverName );
+    auto const & poroAccessors = elemManager.getCachedAccessors< typename kernelType::PorosityAccessors >( solverName );
 
     ResidualNormKernel kernel( rankOffset, localResidual, dofNumber, ghostRank,
                                regionFilter, faceManager, flowAccessors, fluidAccessors, poroAccessors, dt, minNormalizer );
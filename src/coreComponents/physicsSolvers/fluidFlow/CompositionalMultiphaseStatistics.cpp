@@ -43,7 +43,8 @@ CompositionalMultiphaseStatistics::CompositionalMultiphaseStatistics( const stri
                                                                       Group * const parent ):
   Base( name, parent ),
   m_computeCFLNumbers( 0 ),
-  m_computeRegionStatistics( 1 )
+  m_computeRegionStatistics( 1 ),
+  m_explicitCFLThreshold( 0.0 )
 {
   registerWrapper( viewKeyStruct::computeCFLNumbersString(), &m_computeCFLNumbers ).
     setApplyDefaultValue( 0 ).
@@ -59,6 +60,13 @@ CompositionalMultiphaseStatistics::CompositionalMultiphaseStatistics( const stri
     setApplyDefaultValue( 1e-6 ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Flag to decide whether a phase is considered mobile (when the relperm is above the threshold) or immobile (when the relperm is below the threshold) in metric 2" );
+
+  registerWrapper( viewKeyStruct::explicitCFLThresholdString(), &m_explicitCFLThreshold ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Component CFL number below which a cell is counted as a candidate for an explicit treatment of its "
+                    "compositions by an adaptive-implicit scheme (only used if the CFL numbers are computed). "
+                    "Set to 0 to skip the count" );
 }
 
 void CompositionalMultiphaseStatistics::postProcessInput()
@@ -71,6 +79,10 @@ void CompositionalMultiphaseStatistics::postProcessInput()
                           catalogName(), getDataContext() ),
                 InputError );
   }
+
+  GEOS_THROW_IF_LT_MSG( m_explicitCFLThreshold, 0.0,
+                        GEOS_FMT( "{} {}: the explicit CFL threshold must be non-negative", catalogName(), getDataContext() ),
+                        InputError );
 }
 
 void CompositionalMultiphaseStatistics::registerDataOnMesh( Group & meshBodies )
@@ -320,37 +332,84 @@ void CompositionalMultiphaseStatistics::computeRegionStatistics( MeshLevel & mes
 
   } );
 
-  // Step 3: synchronize the results over the MPI ranks
+  // Step 3: synchronize the results over the MPI ranks, with one sum and one max reduction for all the regions
+  // (the minima are reduced as the maxima of their opposites)
+  integer const numSumsPerRegion = 3 + ( 4 + numComps ) * numPhases;
+  integer constexpr numMaxsPerRegion = 6;
+  array1d< real64 > localSums( regionNames.size() * numSumsPerRegion );
+  array1d< real64 > localMaxs( regionNames.size() * numMaxsPerRegion );
+  for( integer i = 0; i < regionNames.size(); ++i )
+  {
+    ElementRegionBase const & region = elemManager.getRegion( regionNames[i] );
+    RegionStatistics const & regionStatistics = region.getReference< RegionStatistics >( viewKeyStruct::regionStatisticsString() );
+
+    real64 * const sums = &localSums[i * numSumsPerRegion];
+    integer k = 0;
+    sums[k++] = regionStatistics.averagePressure;
+    sums[k++] = regionStatistics.averageTemperature;
+    sums[k++] = regionStatistics.totalUncompactedPoreVolume;
+    for( integer ip = 0; ip < numPhases; ++ip )
+    {
+      sums[k++] = regionStatistics.phasePoreVolume[ip];
+      sums[k++] = regionStatistics.phaseMass[ip];
+      sums[k++] = regionStatistics.trappedPhaseMass[ip];
+      sums[k++] = regionStatistics.immobilePhaseMass[ip];
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        sums[k++] = regionStatistics.dissolvedComponentMass[ip][ic];
+      }
+    }
+
+    real64 * const maxs = &localMaxs[i * numMaxsPerRegion];
+    maxs[0] = -regionStatistics.minPressure;
+    maxs[1] = regionStatistics.maxPressure;
+    maxs[2] = -regionStatistics.minDeltaPressure;
+    maxs[3] = regionStatistics.maxDeltaPressure;
+    maxs[4] = -regionStatistics.minTemperature;
+    maxs[5] = regionStatistics.maxTemperature;
+  }
+
+  array1d< real64 > globalSums( localSums.size() );
+  array1d< real64 > globalMaxs( localMaxs.size() );
+  MpiWrapper::allReduce( localSums.data(), globalSums.data(), LvArray::integerConversion< int >( localSums.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( localMaxs.data(), globalMaxs.data(), LvArray::integerConversion< int >( localMaxs.size() ),
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ), MPI_COMM_GEOSX );
+
   for( integer i = 0; i < regionNames.size(); ++i )
   {
     ElementRegionBase & region = elemManager.getRegion( regionNames[i] );
     RegionStatistics & regionStatistics = region.getReference< RegionStatistics >( viewKeyStruct::regionStatisticsString() );
 
-    regionStatistics.minPressure = MpiWrapper::min( regionStatistics.minPressure );
-    regionStatistics.maxPressure = MpiWrapper::max( regionStatistics.maxPressure );
-    regionStatistics.minDeltaPressure = MpiWrapper::min( regionStatistics.minDeltaPressure );
-    regionStatistics.maxDeltaPressure = MpiWrapper::max( regionStatistics.maxDeltaPressure );
-    regionStatistics.minTemperature = MpiWrapper::min( regionStatistics.minTemperature );
-    regionStatistics.maxTemperature = MpiWrapper::max( regionStatistics.maxTemperature );
-    regionStatistics.totalUncompactedPoreVolume = MpiWrapper::sum( regionStatistics.totalUncompactedPoreVolume );
+    real64 const * const sums = &globalSums[i * numSumsPerRegion];
+    integer k = 0;
+    regionStatistics.averagePressure = sums[k++];
+    regionStatistics.averageTemperature = sums[k++];
+    regionStatistics.totalUncompactedPoreVolume = sums[k++];
     regionStatistics.totalPoreVolume = 0.0;
     for( integer ip = 0; ip < numPhases; ++ip )
     {
-      regionStatistics.phasePoreVolume[ip] = MpiWrapper::sum( regionStatistics.phasePoreVolume[ip] );
-      regionStatistics.phaseMass[ip] = MpiWrapper::sum( regionStatistics.phaseMass[ip] );
-      regionStatistics.trappedPhaseMass[ip] = MpiWrapper::sum( regionStatistics.trappedPhaseMass[ip] );
-      regionStatistics.immobilePhaseMass[ip] = MpiWrapper::sum( regionStatistics.immobilePhaseMass[ip] );
+      regionStatistics.phasePoreVolume[ip] = sums[k++];
+      regionStatistics.phaseMass[ip] = sums[k++];
+      regionStatistics.trappedPhaseMass[ip] = sums[k++];
+      regionStatistics.immobilePhaseMass[ip] = sums[k++];
       regionStatistics.totalPoreVolume += regionStatistics.phasePoreVolume[ip];
       for( integer ic = 0; ic < numComps; ++ic )
       {
-        regionStatistics.dissolvedComponentMass[ip][ic] = MpiWrapper::sum( regionStatistics.dissolvedComponentMass[ip][ic] );
+        regionStatistics.dissolvedComponentMass[ip][ic] = sums[k++];
       }
     }
-    regionStatistics.averagePressure = MpiWrapper::sum( regionStatistics.averagePressure );
     regionStatistics.averagePressure /= regionStatistics.totalUncompactedPoreVolume;
-    regionStatistics.averageTemperature = MpiWrapper::sum( regionStatistics.averageTemperature );
     regionStatistics.averageTemperature /= regionStatistics.totalUncompactedPoreVolume;
 
+    real64 const * const maxs = &globalMaxs[i * numMaxsPerRegion];
+    regionStatistics.minPressure = -maxs[0];
+    regionStatistics.maxPressure = maxs[1];
+    regionStatistics.minDeltaPressure = -maxs[2];
+    regionStatistics.maxDeltaPressure = maxs[3];
+    regionStatistics.minTemperature = -maxs[4];
+    regionStatistics.maxTemperature = maxs[5];
+
     // helpers to report statistics
     array1d< real64 > nonTrappedPhaseMass( numPhases );
     array1d< real64 > mobilePhaseMass( numPhases );
@@ -475,6 +534,8 @@ void CompositionalMultiphaseStatistics::computeCFLNumbers( real64 const & dt,
   // Step 3: finalize the (cell-based) computation of the CFL numbers
   real64 localMaxPhaseCFLNumber = 0.0;
   real64 localMaxCompCFLNumber = 0.0;
+  localIndex localNumCells = 0;
+  localIndex localNumExplicitCells = 0;
 
   m_solver->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                          MeshLevel & mesh,
@@ -518,7 +579,11 @@ void CompositionalMultiphaseStatistics::computeCFLNumbers( real64 const & dt,
 
       real64 subRegionMaxPhaseCFLNumber = 0.0;
       real64 subRegionMaxCompCFLNumber = 0.0;
+      localIndex subRegionNumCells = 0;
+      localIndex subRegionNumExplicitCells = 0;
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
+      // the owned cells whose compositions could be treated explicitly are counted in the same pass
       isothermalCompositionalMultiphaseBaseKernels::KernelLaunchSelector2
       < isothermalCompositionalMultiphaseFVMKernels::CFLKernel >( numComps, numPhases,
                                                                   subRegion.size(),
@@ -534,20 +599,41 @@ void CompositionalMultiphaseStatistics::computeCFLNumbers( real64 const & dt,
                                                                   compOutflux,
                                                                   phaseCFLNumber,
                                                                   compCFLNumber,
+                                                                  ghostRank,
+                                                                  m_explicitCFLThreshold,
                                                                   subRegionMaxPhaseCFLNumber,
-                                                                  subRegionMaxCompCFLNumber );
+                                                                  subRegionMaxCompCFLNumber,
+                                                                  subRegionNumCells,
+                                                                  subRegionNumExplicitCells );
 
       localMaxPhaseCFLNumber = LvArray::math::max( localMaxPhaseCFLNumber, subRegionMaxPhaseCFLNumber );
       localMaxCompCFLNumber = LvArray::math::max( localMaxCompCFLNumber, subRegionMaxCompCFLNumber );
-
+      localNumCells += subRegionNumCells;
+      localNumExplicitCells += subRegionNumExplicitCells;
     } );
   } );
 
-  real64 const globalMaxPhaseCFLNumber = MpiWrapper::max( localMaxPhaseCFLNumber );
-  real64 const globalMaxCompCFLNumber = MpiWrapper::max( localMaxCompCFLNumber );
+  real64 const localMaxCFLNumbers[2] = { localMaxPhaseCFLNumber, localMaxCompCFLNumber };
+  real64 globalMaxCFLNumbers[2]{};
+  MpiWrapper::allReduce( localMaxCFLNumbers, globalMaxCFLNumbers, 2,
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Max ), MPI_COMM_GEOSX );
+
+  GEOS_LOG_LEVEL_RANK_0( 1, getName() << ": Max phase CFL number: " << globalMaxCFLNumbers[0] );
+  GEOS_LOG_LEVEL_RANK_0( 1, getName() << ": Max component CFL number: " << globalMaxCFLNumbers[1] );
 
-  GEOS_LOG_LEVEL_RANK_0( 1, getName() << ": Max phase CFL number: " << globalMaxPhaseCFLNumber );
-  GEOS_LOG_LEVEL_RANK_0( 1, getName() << ": Max component CFL number: " << globalMaxCompCFLNumber );
+  if( m_explicitCFLThreshold > 0.0 )
+  {
+    globalIndex const localCounts[2] = { localNumCells, localNumExplicitCells };
+    globalIndex globalCounts[2]{};
+    MpiWrapper::allReduce( localCounts, globalCounts, 2,
+                           MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOSX );
+    globalIndex const globalNumCells = globalCounts[0];
+    globalIndex const globalNumExplicitCells = globalCounts[1];
+    real64 const explicitFraction = globalNumCells > 0 ? static_cast< real64 >( globalNumExplicitCells ) / globalNumCells : 0.0;
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: Cells with a component CFL number below {}: {} out of {} ({:.1f}%)",
+                                        getName(), m_explicitCFLThreshold, globalNumExplicitCells, globalNumCells,
+                                        100.0 * explicitFraction ) );
+  }
 }
 
 
@@ -79,6 +79,8 @@ private:
     constexpr static char const * regionStatisticsString() { return "regionStatistics"; }
     /// String for the relperm threshold
     constexpr static char const * relpermThresholdString() { return "relpermThreshold"; }
+    /// String for the CFL threshold of the explicit cells of an adaptive-implicit scheme
+    constexpr static char const * explicitCFLThresholdString() { return "explicitCFLThreshold"; }
   };
 
   struct RegionStatistics
@@ -150,6 +152,9 @@ private:
   /// Threshold to decide whether a phase is considered "mobile" or not
   real64 m_relpermThreshold;
 
+  /// Component CFL number below which a cell could have its compositions treated explicitly
+  real64 m_explicitCFLThreshold;
+
 };
 
 
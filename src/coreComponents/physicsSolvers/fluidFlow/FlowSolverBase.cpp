@@ -26,8 +26,10 @@
 #include "fieldSpecification/EquilibriumInitialCondition.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/SourceFluxBoundaryCondition.hpp"
+#include "finiteVolume/BoundaryStencil.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "finiteVolume/TwoPointFluxApproximation.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "physicsSolvers/fluidFlow/FluxKernelsHelper.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
@@ -109,18 +111,67 @@ void updatePorosityAndPermeabilityFromPressureAndAperture( POROUSWRAPPER_TYPE po
   } );
 }
 
+template< typename POROUSWRAPPER_TYPE >
+void updatePorosityAndPermeabilityFromPressureAndTemperatureChanges( POROUSWRAPPER_TYPE porousWrapper,
+                                                                     CellElementSubRegion & subRegion,
+                                                                     arrayView1d< real64 const > const & pressure,
+                                                                     arrayView1d< real64 const > const & temperature,
+                                                                     arrayView1d< real64 > const & pressureAtUpdate,
+                                                                     arrayView1d< real64 > const & temperatureAtUpdate,
+                                                                     real64 const pressureTolerance,
+                                                                     real64 const temperatureTolerance )
+{
+  forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_DEVICE ( localIndex const k )
+  {
+    // the models of the cell are reevaluated only if its pressure or temperature changed since their last evaluation
+    bool const needsUpdate = LvArray::math::abs( pressure[k] - pressureAtUpdate[k] ) > pressureTolerance ||
+                             LvArray::math::abs( temperature[k] - temperatureAtUpdate[k] ) > temperatureTolerance;
+    if( !needsUpdate )
+    {
+      return;
+    }
+    for( localIndex q = 0; q < porousWrapper.numGauss(); ++q )
+    {
+      porousWrapper.updateStateFromPressureAndTemperature( k, q,
+                                                           pressure[k],
+                                                           pressure[k], // will not be used
+                                                           pressure[k], // will not be used
+                                                           temperature[k],
+                                                           temperature[k], // will not be used
+                                                           temperature[k] ); // will not be used
+    }
+    pressureAtUpdate[k] = pressure[k];
+    temperatureAtUpdate[k] = temperature[k];
+  } );
+}
+
 FlowSolverBase::FlowSolverBase( string const & name,
                                 Group * const parent ):
   SolverBase( name, parent ),
   m_numDofPerCell( 0 ),
   m_isThermal( 0 ),
-  m_isFixedStressPoromechanicsUpdate( false )
+  m_isFixedStressPoromechanicsUpdate( false ),
+  m_porosityUpdatePressureTolerance( 0.0 ),
+  m_porosityUpdateTemperatureTolerance( 0.0 )
 {
   this->registerWrapper( viewKeyStruct::isThermalString(), &m_isThermal ).
     setApplyDefaultValue( 0 ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Flag indicating whether the problem is thermal or not." );
 
+  this->registerWrapper( viewKeyStruct::porosityUpdatePressureToleranceString(), &m_porosityUpdatePressureTolerance ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Pressure change (in Pa) since the last evaluation of the porosity and permeability models of a cell "
+                    "under which these models are not evaluated again. If set to 0 (default value), the models are evaluated in all the cells "
+                    "at each update. Ignored in the sequential (fixed-stress) poromechanics updates, which also depend on the stress." );
+
+  this->registerWrapper( viewKeyStruct::porosityUpdateTemperatureToleranceString(), &m_porosityUpdateTemperatureTolerance ).
+    setApplyDefaultValue( 0.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Temperature change (in K) since the last evaluation of the porosity and permeability models of a cell "
+                    "under which these models are not evaluated again, when porosityUpdatePressureTolerance is positive." );
+
   // allow the user to select a norm
   getNonlinearSolverParameters().getWrapper< solverBaseKernels::NormType >( NonlinearSolverParameters::viewKeysStruct::normTypeString() ).setInputFlag( InputFlags::OPTIONAL );
 }
@@ -145,6 +196,20 @@ void FlowSolverBase::registerDataOnMesh( Group & meshBodies )
       subRegion.registerField< fields::flow::netToGross >( getName() );
     } );
 
+    if( m_porosityUpdatePressureTolerance > 0.0 )
+    {
+      // initialized far from any pressure and temperature, so that the first update evaluates the models in all the cells
+      elemManager.forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                [&]( localIndex const,
+                                                                     CellElementSubRegion & subRegion )
+      {
+        subRegion.registerField< fields::flow::pressureAtPorosityUpdate >( getName() ).
+          setApplyDefaultValue( LvArray::NumericLimits< real64 >::max );
+        subRegion.registerField< fields::flow::temperatureAtPorosityUpdate >( getName() ).
+          setApplyDefaultValue( LvArray::NumericLimits< real64 >::max );
+      } );
+    }
+
     elemManager.forElementSubRegionsComplete< SurfaceElementSubRegion >( [&]( localIndex const,
                                                                               localIndex const,
                                                                               ElementRegionBase & region,
@@ -195,11 +260,8 @@ void FlowSolverBase::saveConvergedState( ElementSubRegionBase & subRegion ) cons
 {
   arrayView1d< real64 const > const pres = subRegion.template getField< fields::flow::pressure >();
   arrayView1d< real64 > const pres_n = subRegion.template getField< fields::flow::pressure_n >();
-  pres_n.setValues< parallelDevicePolicy<> >( pres );
-
   arrayView1d< real64 const > const temp = subRegion.template getField< fields::flow::temperature >();
   arrayView1d< real64 > const temp_n = subRegion.template getField< fields::flow::temperature_n >();
-  temp_n.setValues< parallelDevicePolicy<> >( temp );
 
   GEOS_THROW_IF( subRegion.hasField< fields::flow::pressure_k >() !=
                  subRegion.hasField< fields::flow::temperature_k >(),
@@ -207,13 +269,27 @@ void FlowSolverBase::saveConvergedState( ElementSubRegionBase & subRegion ) cons
                            fields::flow::pressure_k::key(), fields::flow::temperature_k::key(), subRegion.getName() ),
                  std::runtime_error );
 
+  // the time levels are saved in a single pass over the state, reading the current values once
   if( subRegion.hasField< fields::flow::pressure_k >() &&
       subRegion.hasField< fields::flow::temperature_k >() )
   {
     arrayView1d< real64 > const pres_k = subRegion.template getField< fields::flow::pressure_k >();
     arrayView1d< real64 > const temp_k = subRegion.template getField< fields::flow::temperature_k >();
-    pres_k.setValues< parallelDevicePolicy<> >( pres );
-    temp_k.setValues< parallelDevicePolicy<> >( temp );
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_DEVICE ( localIndex const ei )
+    {
+      pres_n[ei] = pres[ei];
+      pres_k[ei] = pres[ei];
+      temp_n[ei] = temp[ei];
+      temp_k[ei] = temp[ei];
+    } );
+  }
+  else
+  {
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_DEVICE ( localIndex const ei )
+    {
+      pres_n[ei] = pres[ei];
+      temp_n[ei] = temp[ei];
+    } );
   }
 }
 
@@ -481,6 +557,17 @@ void FlowSolverBase::updatePorosityAndPermeability( CellElementSubRegion & subRe
                                                                pressure, pressure_k, pressure_n,
                                                                temperature, temperature_k, temperature_n );
     }
+    else if( subRegion.hasField< fields::flow::pressureAtPorosityUpdate >() ) // for fully implicit simulations, updating the changed cells
+    {
+      arrayView1d< real64 > const & pressureAtUpdate = subRegion.getField< fields::flow::pressureAtPorosityUpdate >();
+      arrayView1d< real64 > const & temperatureAtUpdate = subRegion.getField< fields::flow::temperatureAtPorosityUpdate >();
+
+      updatePorosityAndPermeabilityFromPressureAndTemperatureChanges( porousWrapper, subRegion,
+                                                                      pressure, temperature,
+                                                                      pressureAtUpdate, temperatureAtUpdate,
+                                                                      m_porosityUpdatePressureTolerance,
+                                                                      m_porosityUpdateTemperatureTolerance );
+    }
     else // for fully implicit simulations
     {
       updatePorosityAndPermeabilityFromPressureAndTemperature( porousWrapper, subRegion,
@@ -666,7 +753,7 @@ void FlowSolverBase::saveAquiferConvergedState( real64 const & time,
       return;
     }
 
-    AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = bc.createKernelWrapper();
+    AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = bc.createKernelWrapper( time, dt );
 
     ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > pressure =
       elemManager.constructFieldAccessor< fields::flow::pressure >();
@@ -685,9 +772,7 @@ void FlowSolverBase::saveAquiferConvergedState( real64 const & time,
                                                      aquiferBCWrapper,
                                                      pressure.toNestedViewConst(),
                                                      pressure_n.toNestedViewConst(),
-                                                     gravCoef.toNestedViewConst(),
-                                                     time,
-                                                     dt );
+                                                     gravCoef.toNestedViewConst() );
 
     localIndex const aquiferIndex = aquiferNameToAquiferId.at( bc.getName() );
     localSumFluxes[aquiferIndex] += targetSetSumFluxes;
@@ -761,4 +846,41 @@ void FlowSolverBase::updateStencilWeights( DomainPartition & domain ) const
   } );
 }
 
+GhostConnectivity FlowSolverBase::getGhostConnectivity( DomainPartition const & domain ) const
+{
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  // the two-point flux stencils only connect the cells sharing a face
+  return fvManager.hasGroup< TwoPointFluxApproximation >( getDiscretizationName() ) ? GhostConnectivity::Faces : GhostConnectivity::Nodes;
+}
+
+void FlowSolverBase::updateStencilTransMultipliers( DomainPartition & domain ) const
+{
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  // the hybrid FVM discretizations read the face multipliers directly
+  if( !fvManager.hasGroup< FluxApproximationBase >( getDiscretizationName() ) )
+  {
+    return;
+  }
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( getDiscretizationName() );
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & )
+  {
+    arrayView1d< real64 const > const transMultiplier =
+      mesh.getFaceManager().getField< fields::flow::transMultiplier >();
+
+    fluxApprox.forStencils< CellElementStencilTPFA, BoundaryStencil >( mesh, [&]( auto & stencil )
+    {
+      using STENCILWRAPPER_TYPE =  typename TYPEOFREF( stencil ) ::KernelWrapper;
+
+      STENCILWRAPPER_TYPE stencilWrapper = stencil.createKernelWrapper();
+
+      flowSolverBaseKernels::stencilWeightsUpdateKernel< STENCILWRAPPER_TYPE >::updateTransMultipliers( stencilWrapper, transMultiplier );
+    } );
+  } );
+}
+
 } // namespace geos
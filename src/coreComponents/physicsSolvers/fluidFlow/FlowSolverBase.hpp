@@ -63,6 +63,8 @@ public:
 
   virtual void registerDataOnMesh( Group & MeshBodies ) override;
 
+  virtual GhostConnectivity getGhostConnectivity( DomainPartition const & domain ) const override;
+
   localIndex numDofPerCell() const { return m_numDofPerCell; }
 
   struct viewKeyStruct : SolverBase::viewKeyStruct
@@ -73,6 +75,8 @@ public:
     static constexpr char const * permeabilityNamesString() { return "permeabilityNames"; }
     static constexpr char const * isThermalString() { return "isThermal"; }
     static constexpr char const * solidInternalEnergyNamesString() { return "solidInternalEnergyNames"; }
+    static constexpr char const * porosityUpdatePressureToleranceString() { return "porosityUpdatePressureTolerance"; }
+    static constexpr char const * porosityUpdateTemperatureToleranceString() { return "porosityUpdateTemperatureTolerance"; }
   };
 
   /**
@@ -89,6 +93,13 @@ public:
    */
   void updateStencilWeights( DomainPartition & domain ) const;
 
+  /**
+   * @brief Update the transmissibility multipliers stored in the cell and boundary stencils
+   * after the face transmissibility multiplier field has changed, without rebuilding the stencils
+   * @param[in] domain the domain partition
+   */
+  void updateStencilTransMultipliers( DomainPartition & domain ) const;
+
   void enableFixedStressPoromechanicsUpdate();
 
   void updatePorosityAndPermeability( CellElementSubRegion & subRegion ) const;
@@ -179,6 +190,12 @@ protected:
   /// enable the fixed stress poromechanics update of porosity
   bool m_isFixedStressPoromechanicsUpdate;
 
+  /// pressure change under which the porosity and permeability of a cell are not reevaluated (0 reevaluates all the cells)
+  real64 m_porosityUpdatePressureTolerance;
+
+  /// temperature change under which the porosity and permeability of a cell are not reevaluated
+  real64 m_porosityUpdateTemperatureTolerance;
+
 private:
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
 
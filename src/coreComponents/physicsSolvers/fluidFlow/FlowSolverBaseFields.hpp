@@ -120,6 +120,22 @@ DECLARE_FIELD( temperature_k,
                NO_WRITE,
                "Temperature at the previous sequential iteration" );
 
+DECLARE_FIELD( pressureAtPorosityUpdate,
+               "pressureAtPorosityUpdate",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Pressure at the last evaluation of the porosity and permeability models" );
+
+DECLARE_FIELD( temperatureAtPorosityUpdate,
+               "temperatureAtPorosityUpdate",
+               array1d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Temperature at the last evaluation of the porosity and permeability models" );
+
 DECLARE_FIELD( initialTemperature,
                "initialTemperature",
                array1d< real64 >,
@@ -184,6 +200,22 @@ DECLARE_FIELD( mimGravityCoefficient,
                WRITE_AND_READ,
                "Mimetic gravity coefficient" );
 
+DECLARE_FIELD( transMatrix,
+               "transMatrix",
+               array2d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Transmissibility matrix of the hybrid FVM scheme in each element, stored row by row" );
+
+DECLARE_FIELD( transMatrixSinglePrecision,
+               "transMatrixSinglePrecision",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Transmissibility matrix of the hybrid FVM scheme in each element, stored row by row in single precision" );
+
 DECLARE_FIELD( macroElementIndex,
                "macroElementIndex",
                array1d< integer >,
@@ -142,6 +142,21 @@ struct stencilWeightsUpdateKernel
       stencilWrapper.addHydraulicApertureContribution( iconn, hydraulicAperture );
     } );
   }
+
+  /**
+   * @brief Refresh the transmissibility multipliers stored in the stencil from the face field
+   *
+   * @param stencilWrapper the stencil wrapper
+   * @param faceTransMultiplier the transmissibility multiplier of the faces
+   */
+  inline static void updateTransMultipliers( STENCILWRAPPER & stencilWrapper,
+                                             arrayView1d< real64 const > const faceTransMultiplier )
+  {
+    forAll< parallelDevicePolicy<> >( stencilWrapper.size(), [=] GEOS_HOST_DEVICE ( localIndex const iconn )
+    {
+      stencilWrapper.updateTransMultiplier( iconn, faceTransMultiplier );
+    } );
+  }
 };
 
 } // namespace flowSolverBaseKernels
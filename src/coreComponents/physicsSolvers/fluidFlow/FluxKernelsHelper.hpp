@@ -305,9 +305,7 @@ struct AquiferBCKernel
              AquiferBoundaryCondition::KernelWrapper const & aquiferBCWrapper,
              ElementViewConst< arrayView1d< real64 const > > const & pres,
              ElementViewConst< arrayView1d< real64 const > > const & presOld,
-             ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
-             real64 const & timeAtBeginningOfStep,
-             real64 const & dt )
+             ElementViewConst< arrayView1d< real64 const > > const & gravCoef )
   {
     using Order = BoundaryStencil::Order;
 
@@ -327,9 +325,7 @@ struct AquiferBCKernel
 
       // compute the aquifer influx rate using the pressure influence function and the aquifer props
       real64 dAquiferVolFlux_dPres = 0.0;
-      real64 const aquiferVolFlux = aquiferBCWrapper.compute( timeAtBeginningOfStep,
-                                                              dt,
-                                                              pres[er][esr][ei],
+      real64 const aquiferVolFlux = aquiferBCWrapper.compute( pres[er][esr][ei],
                                                               presOld[er][esr][ei],
                                                               gravCoef[er][esr][ei],
                                                               areaFraction,
@@ -20,8 +20,11 @@
 #define GEOS_PHYSICSSOLVERS_FLUIDFLOW_HYBRIDFVMUPWINDINGHELPERKERNELS_HPP
 
 #include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "finiteVolume/mimeticInnerProducts/TPFAInnerProduct.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mesh/MeshLevel.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
 
 namespace geos
 {
@@ -85,6 +88,219 @@ struct CellConnectivity
 
 };
 
+/******************************** TransMatrixCache ********************************/
+
+/**
+ * @class TransMatrixCache
+ * @brief Read-only access to the transmissibility matrices precomputed in the elements of a subregion
+ *
+ * The matrices are stored row by row, either in double or in single precision. When both fields
+ * are empty (i.e., when the permeability changes during the simulation), the kernels must
+ * recompute the transmissibility matrices on the fly.
+ */
+class TransMatrixCache
+{
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] subRegion the element subregion
+   */
+  explicit TransMatrixCache( CellElementSubRegion const & subRegion )
+    : m_values( subRegion.getField< fields::flow::transMatrix >() ),
+    m_valuesSinglePrecision( subRegion.getField< fields::flow::transMatrixSinglePrecision >() )
+  {}
+
+  /**
+   * @brief @return true if the transmissibility matrices have not been precomputed
+   */
+  GEOS_HOST_DEVICE
+  inline
+  bool isEmpty() const
+  {
+    return m_values.size( 1 ) == 0 && m_valuesSinglePrecision.size( 1 ) == 0;
+  }
+
+  /**
+   * @brief Load the transmissibility matrix of an element
+   * @tparam NF number of faces in the element
+   * @param[in] ei the element index
+   * @param[in] offset the position of the first entry of the matrix in the stored values of the element
+   * @param[out] transMatrix the transmissibility matrix
+   */
+  template< integer NF >
+  GEOS_HOST_DEVICE
+  inline
+  void load( localIndex const ei,
+             integer const offset,
+             arraySlice2d< real64 > const & transMatrix ) const
+  {
+    for( integer ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+    {
+      for( integer jfaceLoc = 0; jfaceLoc < NF; ++jfaceLoc )
+      {
+        transMatrix[ifaceLoc][jfaceLoc] = value( ei, offset + ifaceLoc * NF + jfaceLoc );
+      }
+    }
+  }
+
+  /**
+   * @brief Load a diagonal transmissibility matrix of an element, of which only the diagonal is stored
+   * @tparam NF number of faces in the element
+   * @param[in] ei the element index
+   * @param[in] offset the position of the first diagonal entry in the stored values of the element
+   * @param[out] transMatrix the transmissibility matrix
+   */
+  template< integer NF >
+  GEOS_HOST_DEVICE
+  inline
+  void loadDiagonal( localIndex const ei,
+                     integer const offset,
+                     arraySlice2d< real64 > const & transMatrix ) const
+  {
+    for( integer ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+    {
+      for( integer jfaceLoc = 0; jfaceLoc < NF; ++jfaceLoc )
+      {
+        transMatrix[ifaceLoc][jfaceLoc] = 0.0;
+      }
+      transMatrix[ifaceLoc][ifaceLoc] = value( ei, offset + ifaceLoc );
+    }
+  }
+
+private:
+
+  GEOS_HOST_DEVICE
+  inline
+  real64 value( localIndex const ei, integer const i ) const
+  {
+    return ( m_values.size( 1 ) > 0 ) ? m_values[ei][i] : m_valuesSinglePrecision[ei][i];
+  }
+
+  /// Transmissibility matrices stored in double precision
+  arrayView2d< real64 const > const m_values;
+
+  /// Transmissibility matrices stored in single precision
+  arrayView2d< real32 const > const m_valuesSinglePrecision;
+};
+
+/******************************** TransMatrixPrecomputeKernel ********************************/
+
+struct TransMatrixPrecomputeKernel
+{
+
+  /**
+   * @brief Allocate the storage of the transmissibility matrices of a subregion
+   * @param[in] numFacesPerElement number of faces in each element of the subregion
+   * @param[in] withGravityTransMatrix flag to also store the diagonal of the TPFA transmissibility used for gravity
+   * @param[in] useSinglePrecision flag to store the matrices in single precision
+   * @param[inout] subRegion the element subregion
+   */
+  static void
+  allocate( localIndex const numFacesPerElement,
+            integer const withGravityTransMatrix,
+            integer const useSinglePrecision,
+            CellElementSubRegion & subRegion )
+  {
+    localIndex const numValues = numFacesPerElement * numFacesPerElement + ( withGravityTransMatrix ? numFacesPerElement : 0 );
+    subRegion.getReference< array2d< real64 > >( fields::flow::transMatrix::key() ).
+      resizeDimension< 1 >( useSinglePrecision ? 0 : numValues );
+    subRegion.getReference< array2d< real32 > >( fields::flow::transMatrixSinglePrecision::key() ).
+      resizeDimension< 1 >( useSinglePrecision ? numValues : 0 );
+  }
+
+  /**
+   * @brief Compute and store the transmissibility matrices of the elements of a subregion
+   * @tparam IP_TYPE type of the inner product
+   * @tparam NF number of faces in the elements
+   * @param[in] numElems number of elements in the subregion
+   * @param[in] nodePosition position of the nodes
+   * @param[in] transMultiplier the transmissibility multipliers at the mesh faces
+   * @param[in] faceToNodes map from face to nodes
+   * @param[in] elemToFaces map from element to faces
+   * @param[in] elemCenter the center of the elements
+   * @param[in] elemVolume the volume of the elements
+   * @param[in] elemPerm the permeability in the elements
+   * @param[in] lengthTolerance tolerance used in the transmissibility matrix computation
+   * @param[in] withGravityTransMatrix flag to also store the diagonal of the TPFA transmissibility used for gravity
+   * @param[out] values the transmissibility matrices in double precision (if allocated)
+   * @param[out] valuesSinglePrecision the transmissibility matrices in single precision (if allocated)
+   */
+  template< typename IP_TYPE, integer NF >
+  static void
+  launch( localIndex const numElems,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          arrayView1d< real64 const > const & transMultiplier,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          arrayView2d< localIndex const > const & elemToFaces,
+          arrayView2d< real64 const > const & elemCenter,
+          arrayView1d< real64 const > const & elemVolume,
+          arrayView3d< real64 const > const & elemPerm,
+          real64 const & lengthTolerance,
+          integer const withGravityTransMatrix,
+          arrayView2d< real64 > const & values,
+          arrayView2d< real32 > const & valuesSinglePrecision )
+  {
+    bool const useSinglePrecision = valuesSinglePrecision.size( 1 ) > 0;
+
+    forAll< parallelDevicePolicy<> >( numElems, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+    {
+      stackArray2d< real64, NF *NF > transMatrix( NF, NF );
+      real64 const perm[ 3 ] = { elemPerm[ei][0][0], elemPerm[ei][0][1], elemPerm[ei][0][2] };
+
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       transMatrix );
+
+      for( integer ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+      {
+        for( integer jfaceLoc = 0; jfaceLoc < NF; ++jfaceLoc )
+        {
+          if( useSinglePrecision )
+          {
+            valuesSinglePrecision[ei][ifaceLoc * NF + jfaceLoc] = static_cast< real32 >( transMatrix[ifaceLoc][jfaceLoc] );
+          }
+          else
+          {
+            values[ei][ifaceLoc * NF + jfaceLoc] = transMatrix[ifaceLoc][jfaceLoc];
+          }
+        }
+      }
+
+      if( withGravityTransMatrix )
+      {
+        mimeticInnerProduct::TPFAInnerProduct::compute< NF >( nodePosition,
+                                                              transMultiplier,
+                                                              faceToNodes,
+                                                              elemToFaces[ei],
+                                                              elemCenter[ei],
+                                                              elemVolume[ei],
+                                                              perm,
+                                                              lengthTolerance,
+                                                              transMatrix );
+        for( integer ifaceLoc = 0; ifaceLoc < NF; ++ifaceLoc )
+        {
+          if( useSinglePrecision )
+          {
+            valuesSinglePrecision[ei][NF * NF + ifaceLoc] = static_cast< real32 >( transMatrix[ifaceLoc][ifaceLoc] );
+          }
+          else
+          {
+            values[ei][NF * NF + ifaceLoc] = transMatrix[ifaceLoc][ifaceLoc];
+          }
+        }
+      }
+    } );
+  }
+
+};
+
 
 } // namespace hybridFVMUpwindingKernels
 
@@ -101,6 +101,30 @@ public:
 namespace internal
 {
 
+/**
+ * @brief Check whether the kernels are compiled for a given number of components
+ * @param[in] numComps the number of components
+ * @return true if numComps is listed in the GEOS_COMPOSITIONAL_NUM_COMPONENTS build option
+ */
+constexpr bool isNumCompSupported( integer const numComps )
+{
+  return numComps >= 1 && numComps <= 16 && ( ( GEOS_COMPOSITIONAL_NUM_COMPONENTS_MASK >> numComps ) & 1 ) != 0;
+}
+
+template< integer NC, typename T, typename LAMBDA >
+void kernelLaunchNumComp( LAMBDA && lambda )
+{
+  // the lambda is only instantiated for the numbers of components declared at build time
+  if constexpr ( isNumCompSupported( NC ) )
+  {
+    lambda( std::integral_constant< T, NC >() );
+  }
+  else
+  {
+    GEOS_ERROR( "Unsupported number of components: " << NC << ", add it to the GEOS_COMPOSITIONAL_NUM_COMPONENTS build option" );
+  }
+}
+
 template< typename T, typename LAMBDA >
 void kernelLaunchSelectorCompSwitch( T value, LAMBDA && lambda )
 {
@@ -109,15 +133,37 @@ void kernelLaunchSelectorCompSwitch( T value, LAMBDA && lambda )
   switch( value )
   {
     case 1:
-    { lambda( std::integral_constant< T, 1 >() ); return; }
+    { kernelLaunchNumComp< 1, T >( lambda ); return; }
     case 2:
-    { lambda( std::integral_constant< T, 2 >() ); return; }
+    { kernelLaunchNumComp< 2, T >( lambda ); return; }
     case 3:
-    { lambda( std::integral_constant< T, 3 >() ); return; }
+    { kernelLaunchNumComp< 3, T >( lambda ); return; }
     case 4:
-    { lambda( std::integral_constant< T, 4 >() ); return; }
+    { kernelLaunchNumComp< 4, T >( lambda ); return; }
     case 5:
-    { lambda( std::integral_constant< T, 5 >() ); return; }
+    { kernelLaunchNumComp< 5, T >( lambda ); return; }
+    case 6:
+    { kernelLaunchNumComp< 6, T >( lambda ); return; }
+    case 7:
+    { kernelLaunchNumComp< 7, T >( lambda ); return; }
+    case 8:
+    { kernelLaunchNumComp< 8, T >( lambda ); return; }
+    case 9:
+    { kernelLaunchNumComp< 9, T >( lambda ); return; }
+    case 10:
+    { kernelLaunchNumComp< 10, T >( lambda ); return; }
+    case 11:
+    { kernelLaunchNumComp< 11, T >( lambda ); return; }
+    case 12:
+    { kernelLaunchNumComp< 12, T >( lambda ); return; }
+    case 13:
+    { kernelLaunchNumComp< 13, T >( lambda ); return; }
+    case 14:
+    { kernelLaunchNumComp< 14, T >( lambda ); return; }
+    case 15:
+    { kernelLaunchNumComp< 15, T >( lambda ); return; }
+    case 16:
+    { kernelLaunchNumComp< 16, T >( lambda ); return; }
     default:
     { GEOS_ERROR( "Unsupported number of components: " << value ); }
   }
@@ -455,6 +501,60 @@ public:
 };
 
 
+/******************************** PhaseStateOrderingKernel ********************************/
+
+struct PhaseStateOrderingKernel
+{
+  /**
+   * @brief Compute a permutation of the cells grouping them by phase state, i.e. by the set of phases present in the cell
+   * @tparam POLICY the execution policy of the evaluation of the phase states
+   * @param[in] size the number of cells in the subRegion
+   * @param[in] numPhases the number of fluid phases
+   * @param[in] phaseVolFrac the phase volume fractions
+   * @param[out] ordering the cells grouped by phase state, in increasing order within each group
+   */
+  template< typename POLICY >
+  static void
+  launch( localIndex const size,
+          integer const numPhases,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac,
+          arrayView1d< localIndex > const & ordering )
+  {
+    // phase state of each cell, as the bitmask of the phases present in the cell
+    array1d< integer > phaseState( size );
+    arrayView1d< integer > const phaseStateView = phaseState.toView();
+    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      integer state = 0;
+      for( integer ip = 0; ip < numPhases; ++ip )
+      {
+        if( phaseVolFrac[k][ip] > 0.0 )
+        {
+          state |= 1 << ip;
+        }
+      }
+      phaseStateView[k] = state;
+    } );
+
+    // stable counting sort of the cells by phase state, on host since there are only a few states
+    phaseState.move( hostMemorySpace, false );
+    ordering.move( hostMemorySpace, true );
+    std::vector< localIndex > offsets( ( 1 << numPhases ) + 1, 0 );
+    for( localIndex k = 0; k < size; ++k )
+    {
+      ++offsets[phaseState[k] + 1];
+    }
+    for( size_t state = 1; state < offsets.size(); ++state )
+    {
+      offsets[state] += offsets[state - 1];
+    }
+    for( localIndex k = 0; k < size; ++k )
+    {
+      ordering[offsets[phaseState[k]]++] = k;
+    }
+  }
+};
+
 /******************************** RelativePermeabilityUpdateKernel ********************************/
 
 struct RelativePermeabilityUpdateKernel
@@ -489,6 +589,29 @@ struct RelativePermeabilityUpdateKernel
       }
     } );
   }
+
+  /**
+   * @brief Launch the update over the cells in the order of a permutation grouping them by phase state,
+   *   so that neighboring threads evaluate the same branches of the constitutive model
+   * @param[in] ordering the permutation of the cells computed by PhaseStateOrderingKernel
+   * @param[in] relPermWrapper the kernel wrapper of the constitutive model
+   * @param[in] phaseVolFrac the phase volume fractions
+   */
+  template< typename POLICY, typename RELPERM_WRAPPER >
+  static void
+  launch( arrayView1d< localIndex const > const & ordering,
+          RELPERM_WRAPPER const & relPermWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( ordering.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const k = ordering[a];
+      for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+      {
+        relPermWrapper.update( k, q, phaseVolFrac[k] );
+      }
+    } );
+  }
 };
 
 /******************************** CapillaryPressureUpdateKernel ********************************/
@@ -525,6 +648,29 @@ struct CapillaryPressureUpdateKernel
       }
     } );
   }
+
+  /**
+   * @brief Launch the update over the cells in the order of a permutation grouping them by phase state,
+   *   so that neighboring threads evaluate the same branches of the constitutive model
+   * @param[in] ordering the permutation of the cells computed by PhaseStateOrderingKernel
+   * @param[in] capPresWrapper the kernel wrapper of the constitutive model
+   * @param[in] phaseVolFrac the phase volume fractions
+   */
+  template< typename POLICY, typename CAPPRES_WRAPPER >
+  static void
+  launch( arrayView1d< localIndex const > const & ordering,
+          CAPPRES_WRAPPER const & capPresWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( ordering.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const k = ordering[a];
+      for( localIndex q = 0; q < capPresWrapper.numGauss(); ++q )
+      {
+        capPresWrapper.update( k, q, phaseVolFrac[k] );
+      }
+    } );
+  }
 };
 
 /******************************** ElementBasedAssemblyKernel ********************************/
@@ -590,6 +736,13 @@ public:
     m_localRhs( localRhs )
   {}
 
+  /**
+   * @brief Skip the computation of the local Jacobian and its scatter into the matrix
+   * @param[in] residualOnly flag to assemble the residual only
+   */
+  void setResidualOnly( integer const residualOnly )
+  { m_residualOnly = residualOnly; }
+
   /**
    * @struct StackVariables
    * @brief Kernel variables (dof numbers, jacobian and residual) located on the stack
@@ -702,12 +855,15 @@ public:
                                                             + phaseVolFrac[ip] * dPhaseDens[ip][Deriv::dP] );
 
       // assemble density dependence
-      applyChainRule( numComp, dCompFrac_dCompDens, dPhaseDens[ip], dPhaseAmount_dC, Deriv::dC );
-      for( integer jc = 0; jc < numComp; ++jc )
+      if( !m_residualOnly )
       {
-        dPhaseAmount_dC[jc] = dPhaseAmount_dC[jc] * phaseVolFrac[ip]
-                              + phaseDens[ip] * dPhaseVolFrac[ip][Deriv::dC+jc];
-        dPhaseAmount_dC[jc] *= stack.poreVolume;
+        applyChainRule( numComp, dCompFrac_dCompDens, dPhaseDens[ip], dPhaseAmount_dC, Deriv::dC );
+        for( integer jc = 0; jc < numComp; ++jc )
+        {
+          dPhaseAmount_dC[jc] = dPhaseAmount_dC[jc] * phaseVolFrac[ip]
+                                + phaseDens[ip] * dPhaseVolFrac[ip][Deriv::dC+jc];
+          dPhaseAmount_dC[jc] *= stack.poreVolume;
+        }
       }
 
       // ic - index of component whose conservation equation is assembled
@@ -721,6 +877,10 @@ public:
                                            + phaseAmount * dPhaseCompFrac[ip][ic][Deriv::dP];
 
         stack.localResidual[ic] += phaseCompAmount - phaseCompAmount_n;
+        if( m_residualOnly )
+        {
+          continue;
+        }
         stack.localJacobian[ic][0] += dPhaseCompAmount_dP;
 
         // jc - index of component w.r.t. whose compositional var the derivative is being taken
@@ -801,8 +961,11 @@ public:
     using namespace compositionalMultiphaseUtilities;
 
     // apply equation/variable change transformation to the component mass balance equations
-    real64 work[numDof]{};
-    shiftRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numDof, stack.localJacobian, work );
+    if( !m_residualOnly )
+    {
+      real64 work[numDof]{};
+      shiftRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numDof, stack.localJacobian, work );
+    }
     shiftElementsAheadByOneAndReplaceFirstElementWithSum( numComp, stack.localResidual );
 
     // add contribution to residual and jacobian into:
@@ -812,10 +975,13 @@ public:
     for( integer i = 0; i < numComp+1; ++i )
     {
       m_localRhs[stack.localRow + i] += stack.localResidual[i];
-      m_localMatrix.addToRow< serialAtomic >( stack.localRow + i,
-                                              stack.dofIndices,
-                                              stack.localJacobian[i],
-                                              numDof );
+      if( !m_residualOnly )
+      {
+        m_localMatrix.addToRow< serialAtomic >( stack.localRow + i,
+                                                stack.dofIndices,
+                                                stack.localJacobian[i],
+                                                numDof );
+      }
     }
   }
 
@@ -894,6 +1060,9 @@ protected:
   /// View on the local RHS
   arrayView1d< real64 > const m_localRhs;
 
+  /// Flag to assemble the residual only
+  integer m_residualOnly = 0;
+
 };
 
 /**
@@ -910,6 +1079,7 @@ public:
    * @param[in] numPhases the number of fluid phases
    * @param[in] rankOffset the offset of my MPI rank
    * @param[in] dofKey the string key to retrieve the degress of freedom numbers
+   * @param[in] residualOnly flag to skip the assembly of the Jacobian
    * @param[in] subRegion the element subregion
    * @param[in] fluid the fluid model
    * @param[in] solid the solid model
@@ -922,6 +1092,7 @@ public:
                    integer const numPhases,
                    globalIndex const rankOffset,
                    string const dofKey,
+                   integer const residualOnly,
                    ElementSubRegionBase const & subRegion,
                    MultiFluidBase const & fluid,
                    CoupledSolidBase const & solid,
@@ -934,6 +1105,7 @@ public:
       integer constexpr NUM_DOF = NC()+1;
       ElementBasedAssemblyKernel< NUM_COMP, NUM_DOF >
       kernel( numPhases, rankOffset, dofKey, subRegion, fluid, solid, localMatrix, localRhs );
+      kernel.setResidualOnly( residualOnly );
       ElementBasedAssemblyKernel< NUM_COMP, NUM_DOF >::template launch< POLICY >( subRegion.size(), kernel );
     } );
   }
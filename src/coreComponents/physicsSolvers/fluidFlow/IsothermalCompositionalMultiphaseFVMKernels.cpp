@@ -384,11 +384,17 @@ CFLKernel::
           arrayView2d< real64 const, compflow::USD_COMP > const & compOutflux,
           arrayView1d< real64 > const & phaseCFLNumber,
           arrayView1d< real64 > const & compCFLNumber,
+          arrayView1d< integer const > const & ghostRank,
+          real64 const explicitCFLThreshold,
           real64 & maxPhaseCFLNumber,
-          real64 & maxCompCFLNumber )
+          real64 & maxCompCFLNumber,
+          localIndex & numCells,
+          localIndex & numExplicitCells )
 {
   RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionPhaseCFLNumber( 0.0 );
   RAJA::ReduceMax< parallelDeviceReduce, real64 > subRegionCompCFLNumber( 0.0 );
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > subRegionNumCells( 0 );
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > subRegionNumExplicitCells( 0 );
 
   forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const ei )
   {
@@ -415,10 +421,22 @@ CFLKernel::
                           cellCompCFLNumber );
     subRegionCompCFLNumber.max( cellCompCFLNumber );
     compCFLNumber[ei] = cellCompCFLNumber;
+
+    // owned cells whose compositions could be treated explicitly by an adaptive-implicit scheme
+    if( explicitCFLThreshold > 0.0 && ghostRank[ei] < 0 )
+    {
+      subRegionNumCells += 1;
+      if( cellCompCFLNumber < explicitCFLThreshold )
+      {
+        subRegionNumExplicitCells += 1;
+      }
+    }
   } );
 
   maxPhaseCFLNumber = subRegionPhaseCFLNumber.get();
   maxCompCFLNumber = subRegionCompCFLNumber.get();
+  numCells = subRegionNumCells.get();
+  numExplicitCells = subRegionNumExplicitCells.get();
 }
 
 #define INST_CFLKernel( NC, NP ) \
@@ -437,8 +455,12 @@ CFLKernel::
                       arrayView2d< real64 const, compflow::USD_COMP > const & compOutflux, \
                       arrayView1d< real64 > const & phaseCFLNumber, \
                       arrayView1d< real64 > const & compCFLNumber, \
+                      arrayView1d< integer const > const & ghostRank, \
+                      real64 const explicitCFLThreshold, \
                       real64 & maxPhaseCFLNumber, \
-                      real64 & maxCompCFLNumber )
+                      real64 & maxCompCFLNumber, \
+                      localIndex & numCells, \
+                      localIndex & numExplicitCells )
 INST_CFLKernel( 1, 2 );
 INST_CFLKernel( 2, 2 );
 INST_CFLKernel( 3, 2 );
@@ -558,7 +580,6 @@ AquiferBCKernel::
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac,
           ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac,
-          real64 const & timeAtBeginningOfStep,
           real64 const & dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
@@ -588,9 +609,7 @@ AquiferBCKernel::
 
     // compute the aquifer influx rate using the pressure influence function and the aquifer props
     real64 dAquiferVolFlux_dPres = 0.0;
-    real64 const aquiferVolFlux = aquiferBCWrapper.compute( timeAtBeginningOfStep,
-                                                            dt,
-                                                            pres[er][esr][ei],
+    real64 const aquiferVolFlux = aquiferBCWrapper.compute( pres[er][esr][ei],
                                                             presOld[er][esr][ei],
                                                             gravCoef[er][esr][ei],
                                                             areaFraction,
@@ -671,7 +690,6 @@ AquiferBCKernel::
                   ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens, \
                   ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac, \
                   ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac, \
-                  real64 const & timeAtBeginningOfStep, \
                   real64 const & dt, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                   arrayView1d< real64 > const & localRhs )
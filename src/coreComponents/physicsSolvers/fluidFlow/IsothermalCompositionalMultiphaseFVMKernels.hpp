@@ -332,8 +332,18 @@ public:
                                CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                arrayView1d< real64 > const & localRhs );
 
+  /**
+   * @brief Skip the computation of the flux Jacobian and its scatter into the matrix
+   * @param[in] residualOnly flag to assemble the residual only
+   */
+  void setResidualOnly( integer const residualOnly )
+  { m_residualOnly = residualOnly; }
+
 protected:
 
+  /// Flag to assemble the residual only
+  integer m_residualOnly = 0;
+
   /// Number of fluid phases
   integer const m_numPhases;
 
@@ -649,6 +659,11 @@ public:
           stack.localFlux[eqIndex0]  +=  m_dt * compFlux[ic];
           stack.localFlux[eqIndex1]  -=  m_dt * compFlux[ic];
 
+          if( m_residualOnly )
+          {
+            continue;
+          }
+
           for( integer ke = 0; ke < numFluxSupportPoints; ++ke )
           {
             localIndex const localDofIndexPres = k[ke] * numDof;
@@ -684,9 +699,12 @@ public:
     using namespace compositionalMultiphaseUtilities;
 
     // Apply equation/variable change transformation(s)
-    stackArray1d< real64, maxStencilSize * numDof > work( stack.stencilSize * numDof );
-    shiftBlockRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numEqn, numDof*stack.stencilSize, stack.numConnectedElems,
-                                                             stack.localFluxJacobian, work );
+    if( !m_residualOnly )
+    {
+      stackArray1d< real64, maxStencilSize * numDof > work( stack.stencilSize * numDof );
+      shiftBlockRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComp, numEqn, numDof*stack.stencilSize, stack.numConnectedElems,
+                                                               stack.localFluxJacobian, work );
+    }
     shiftBlockElementsAheadByOneAndReplaceFirstElementWithSum( numComp, numEqn, stack.numConnectedElems,
                                                                stack.localFlux );
 
@@ -697,7 +715,8 @@ public:
     {
       if( m_ghostRank[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )] < 0 )
       {
-        globalIndex const globalRow = m_dofNumber[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )];
+        // the dof offset of this element has already been gathered in setup
+        globalIndex const globalRow = stack.dofColIndices[i * numDof];
         localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - m_rankOffset );
         GEOS_ASSERT_GE( localRow, 0 );
         GEOS_ASSERT_GT( m_localMatrix.numRows(), localRow + numComp );
@@ -705,11 +724,14 @@ public:
         for( integer ic = 0; ic < numComp; ++ic )
         {
           RAJA::atomicAdd( parallelDeviceAtomic{}, &m_localRhs[localRow + ic], stack.localFlux[i * numEqn + ic] );
-          m_localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >
-            ( localRow + ic,
-            stack.dofColIndices.data(),
-            stack.localFluxJacobian[i * numEqn + ic].dataIfContiguous(),
-            stack.stencilSize * numDof );
+          if( !m_residualOnly )
+          {
+            m_localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >
+              ( localRow + ic,
+              stack.dofColIndices.data(),
+              stack.localFluxJacobian[i * numEqn + ic].dataIfContiguous(),
+              stack.stencilSize * numDof );
+          }
         }
 
         // call the lambda to assemble additional terms, such as thermal terms
@@ -791,6 +813,7 @@ public:
    * @param[in] rankOffset the offset of my MPI rank
    * @param[in] dofKey string to get the element degrees of freedom numbers
    * @param[in] hasCapPressure flag specifying whether capillary pressure is used or not
+   * @param[in] residualOnly flag to skip the assembly of the Jacobian
    * @param[in] solverName name of the solver (to name accessors)
    * @param[in] elemManager reference to the element region manager
    * @param[in] stencilWrapper reference to the stencil wrapper
@@ -805,6 +828,7 @@ public:
                    globalIndex const rankOffset,
                    string const & dofKey,
                    integer const hasCapPressure,
+                   integer const residualOnly,
                    UpwindingParameters upwindingParams,
                    string const & solverName,
                    ElementRegionManager const & elemManager,
@@ -827,27 +851,29 @@ public:
       {
         using kernelType =
           FaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER, isothermalCompositionalMultiphaseFVMKernelUtilities::C1PPUPhaseFlux >;
-        typename kernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-        typename kernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-        typename kernelType::CapPressureAccessors capPressureAccessors( elemManager, solverName );
-        typename kernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
+        auto const & compFlowAccessors = elemManager.getCachedAccessors< typename kernelType::CompFlowAccessors >( solverName );
+        auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename kernelType::MultiFluidAccessors >( solverName );
+        auto const & capPressureAccessors = elemManager.getCachedAccessors< typename kernelType::CapPressureAccessors >( solverName );
+        auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
 
         kernelType kernel( numPhases, rankOffset, hasCapPressure, stencilWrapper, dofNumberAccessor,
                            compFlowAccessors, multiFluidAccessors, capPressureAccessors, permeabilityAccessors,
                            dt, localMatrix, localRhs );
+        kernel.setResidualOnly( residualOnly );
         kernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
       }
       else
       {
         using kernelType = FaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER >;
-        typename kernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-        typename kernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-        typename kernelType::CapPressureAccessors capPressureAccessors( elemManager, solverName );
-        typename kernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
+        auto const & compFlowAccessors = elemManager.getCachedAccessors< typename kernelType::CompFlowAccessors >( solverName );
+        auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename kernelType::MultiFluidAccessors >( solverName );
+        auto const & capPressureAccessors = elemManager.getCachedAccessors< typename kernelType::CapPressureAccessors >( solverName );
+        auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
 
         kernelType kernel( numPhases, rankOffset, hasCapPressure, stencilWrapper, dofNumberAccessor,
                            compFlowAccessors, multiFluidAccessors, capPressureAccessors, permeabilityAccessors,
                            dt, localMatrix, localRhs );
+        kernel.setResidualOnly( residualOnly );
         kernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
       }
     } );
@@ -1416,7 +1442,8 @@ public:
     {
       if( m_ghostRank[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )] < 0 )
       {
-        globalIndex const globalRow = m_dofNumber[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )];
+        // the dof offset of this element has already been gathered in setup
+        globalIndex const globalRow = stack.dofColIndices[i * numDof];
         localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - m_rankOffset );
         GEOS_ASSERT_GE( localRow, 0 );
         GEOS_ASSERT_GT( m_localMatrix.numRows(), localRow + numComp );
@@ -1551,11 +1578,11 @@ public:
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
       using kernelType = DiffusionDispersionFaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER >;
-      typename kernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-      typename kernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-      typename kernelType::DiffusionAccessors diffusionAccessors( elemManager, solverName );
-      typename kernelType::DispersionAccessors dispersionAccessors( elemManager, solverName );
-      typename kernelType::PorosityAccessors porosityAccessors( elemManager, solverName );
+      auto const & compFlowAccessors = elemManager.getCachedAccessors< typename kernelType::CompFlowAccessors >( solverName );
+      auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename kernelType::MultiFluidAccessors >( solverName );
+      auto const & diffusionAccessors = elemManager.getCachedAccessors< typename kernelType::DiffusionAccessors >( solverName );
+      auto const & dispersionAccessors = elemManager.getCachedAccessors< typename kernelType::DispersionAccessors >( solverName );
+      auto const & porosityAccessors = elemManager.getCachedAccessors< typename kernelType::PorosityAccessors >( solverName );
 
       kernelType kernel( numPhases, rankOffset, stencilWrapper,
                          dofNumberAccessor, compFlowAccessors, multiFluidAccessors,
@@ -2058,10 +2085,10 @@ public:
         dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
         using kernelType = DirichletFaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, typename FluidType::KernelWrapper >;
-        typename kernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-        typename kernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-        typename kernelType::CapPressureAccessors capPressureAccessors( elemManager, solverName );
-        typename kernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
+        auto const & compFlowAccessors = elemManager.getCachedAccessors< typename kernelType::CompFlowAccessors >( solverName );
+        auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename kernelType::MultiFluidAccessors >( solverName );
+        auto const & capPressureAccessors = elemManager.getCachedAccessors< typename kernelType::CapPressureAccessors >( solverName );
+        auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
 
         // for now, we neglect capillary pressure in the kernel
         bool const hasCapPressure = false;
@@ -2208,8 +2235,12 @@ struct CFLKernel
           arrayView2d< real64 const, compflow::USD_COMP > const & compOutflux,
           arrayView1d< real64 > const & phaseCFLNumber,
           arrayView1d< real64 > const & compCFLNumber,
+          arrayView1d< integer const > const & ghostRank,
+          real64 const explicitCFLThreshold,
           real64 & maxPhaseCFLNumber,
-          real64 & maxCompCFLNumber );
+          real64 & maxCompCFLNumber,
+          localIndex & numCells,
+          localIndex & numExplicitCells );
 
 };
 
@@ -2290,7 +2321,6 @@ struct AquiferBCKernel
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_COMP > > const & phaseCompFrac,
           ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dPhaseCompFrac,
-          real64 const & timeAtBeginningOfStep,
           real64 const & dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
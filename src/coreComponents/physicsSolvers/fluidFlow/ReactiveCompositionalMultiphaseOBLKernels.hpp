@@ -1110,7 +1110,8 @@ public:
 
       if( m_ghostRank[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )] < 0 )
       {
-        globalIndex const globalRow = m_dofNumber[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )];
+        // the dof offset of this element has already been gathered in setup
+        globalIndex const globalRow = stack.dofColIndices[i * numDofs];
         localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - m_rankOffset );
         GEOS_ASSERT_GE( localRow, 0 );
         GEOS_ASSERT_GE( m_localMatrix.numRows(), localRow + numEqns );
@@ -1218,8 +1219,8 @@ public:
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
       using KERNEL_TYPE = FaceBasedAssemblyKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY, STENCILWRAPPER >;
-      typename KERNEL_TYPE::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
+      auto const & compFlowAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::CompFlowAccessors >( solverName );
+      auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::PermeabilityAccessors >( solverName );
 
       KERNEL_TYPE kernel( rankOffset, stencilWrapper, dofNumberAccessor, compFlowAccessors, permeabilityAccessors,
                           dt, transMultExp, localMatrix, localRhs );
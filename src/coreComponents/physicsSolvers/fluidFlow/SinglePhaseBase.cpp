@@ -303,8 +303,54 @@ void SinglePhaseBase::updateThermalConductivity( ElementSubRegionBase & subRegio
 
 void SinglePhaseBase::updateFluidState( ObjectManagerBase & subRegion ) const
 {
-  updateFluidModel( subRegion );
-  updateMobility( subRegion );
+  if( m_isThermal )
+  {
+    updateThermalState( subRegion );
+  }
+  else
+  {
+    updateFluidModel( subRegion );
+    updateMobility( subRegion );
+  }
+}
+
+void SinglePhaseBase::updateThermalState( ObjectManagerBase & dataGroup ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const pres = dataGroup.getField< fields::flow::pressure >();
+  arrayView1d< real64 const > const temp = dataGroup.getField< fields::flow::temperature >();
+
+  arrayView1d< real64 > const mob = dataGroup.getField< fields::flow::mobility >();
+  arrayView1d< real64 > const dMob_dPres = dataGroup.getField< fields::flow::dMobility_dPressure >();
+  arrayView1d< real64 > const dMob_dTemp = dataGroup.getField< fields::flow::dMobility_dTemperature >();
+
+  SingleFluidBase & fluid =
+    getConstitutiveModel< SingleFluidBase >( dataGroup, dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() ) );
+  FluidPropViews fluidProps = getFluidProperties( fluid );
+  ThermalFluidPropViews thermalFluidProps = getThermalFluidProperties( fluid );
+
+  string const & solidInternalEnergyName = dataGroup.getReference< string >( viewKeyStruct::solidInternalEnergyNamesString() );
+  SolidInternalEnergy & solidInternalEnergy = getConstitutiveModel< SolidInternalEnergy >( dataGroup, solidInternalEnergyName );
+  SolidInternalEnergy::KernelWrapper solidInternalEnergyWrapper = solidInternalEnergy.createKernelUpdates();
+
+  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    thermalSinglePhaseBaseKernels::ThermalStateUpdateKernel::launch< parallelDevicePolicy<> >( fluidWrapper,
+                                                                                               solidInternalEnergyWrapper,
+                                                                                               pres,
+                                                                                               temp,
+                                                                                               fluidProps.dens,
+                                                                                               fluidProps.dDens_dPres,
+                                                                                               thermalFluidProps.dDens_dTemp,
+                                                                                               fluidProps.visc,
+                                                                                               fluidProps.dVisc_dPres,
+                                                                                               thermalFluidProps.dVisc_dTemp,
+                                                                                               mob,
+                                                                                               dMob_dPres,
+                                                                                               dMob_dTemp );
+  } );
 }
 
 void SinglePhaseBase::updateMobility( ObjectManagerBase & dataGroup ) const
@@ -635,9 +681,11 @@ void SinglePhaseBase::computeHydrostaticEquilibrium()
 }
 
 void SinglePhaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM( time_n ),
-                                         real64 const & GEOS_UNUSED_PARAM( dt ),
+                                         real64 const & dt,
                                          DomainPartition & domain )
 {
+  real64 const extrapolationFactor = initialGuessExtrapolationFactor( dt );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -645,26 +693,54 @@ void SinglePhaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM( time_
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion, SurfaceElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                                    auto & subRegion )
     {
-      arrayView1d< real64 const > const & pres = subRegion.template getField< fields::flow::pressure >();
+      arrayView1d< real64 > const & pres = subRegion.template getField< fields::flow::pressure >();
       arrayView1d< real64 const > const & initPres = subRegion.template getField< fields::flow::initialPressure >();
       arrayView1d< real64 > const & deltaPres = subRegion.template getField< fields::flow::deltaPressure >();
 
       singlePhaseBaseKernels::StatisticsKernel::
         saveDeltaPressure( subRegion.size(), pres, initPres, deltaPres );
+
+      // the extrapolated initial guess needs the solution at the beginning of the previous step, compute it before saving the state
+      array1d< real64 > presGuess;
+      array1d< real64 > tempGuess;
+      if( extrapolationFactor > 0.0 )
+      {
+        presGuess.resize( subRegion.size() );
+        singlePhaseBaseKernels::SolutionExtrapolationKernel::
+          launch( subRegion.size(), extrapolationFactor, pres,
+                  subRegion.template getField< fields::flow::pressure_n >(), presGuess.toView() );
+        if( m_isThermal )
+        {
+          tempGuess.resize( subRegion.size() );
+          singlePhaseBaseKernels::SolutionExtrapolationKernel::
+            launch( subRegion.size(), extrapolationFactor,
+                    subRegion.template getField< fields::flow::temperature >(),
+                    subRegion.template getField< fields::flow::temperature_n >(), tempGuess.toView() );
+        }
+      }
+
       saveConvergedState( subRegion );
 
+      if( extrapolationFactor > 0.0 )
+      {
+        pres.setValues< parallelDevicePolicy<> >( presGuess.toViewConst() );
+        if( m_isThermal )
+        {
+          arrayView1d< real64 > const & temp = subRegion.template getField< fields::flow::temperature >();
+          temp.setValues< parallelDevicePolicy<> >( tempGuess.toViewConst() );
+        }
+      }
+
       arrayView1d< real64 > const & dVol = subRegion.template getField< fields::flow::deltaVolume >();
       dVol.zero();
 
       // This should fix NaN density in newly created fracture elements
       updatePorosityAndPermeability( subRegion );
       updateFluidState( subRegion );
-      // for thermal simulations, update solid internal energy
+      // for thermal simulations, update thermal conductivity (the solid internal energy is updated with the fluid state)
       if( m_isThermal )
       {
-        updateSolidInternalEnergyModel( subRegion );
         updateThermalConductivity( subRegion );
-
       }
 
     } );
@@ -692,8 +768,8 @@ void SinglePhaseBase::implicitStepSetup( real64 const & GEOS_UNUSED_PARAM( time_
     } );
   } );
 
-
-
+  // the face multipliers may have been changed since the last step (e.g., fault seal updates)
+  updateStencilTransMultipliers( domain );
 }
 
 void SinglePhaseBase::implicitStepComplete( real64 const & time,
@@ -1227,11 +1303,6 @@ void SinglePhaseBase::updateState( DomainPartition & domain )
     {
       updatePorosityAndPermeability( subRegion );
       updateFluidState( subRegion );
-
-      if( m_isThermal )
-      {
-        updateSolidInternalEnergyModel( subRegion );
-      }
     } );
   } );
 }
@@ -1259,11 +1330,6 @@ void SinglePhaseBase::resetStateToBeginningOfStep( DomainPartition & domain )
 
       updatePorosityAndPermeability( subRegion );
       updateFluidState( subRegion );
-
-      if( m_isThermal )
-      {
-        updateSolidInternalEnergyModel( subRegion );
-      }
     } );
   } );
 }
@@ -276,6 +276,8 @@ public:
   /**
    * @brief Function to update all constitutive state and dependent variables
    * @param dataGroup group that contains the fields
+   *
+   * In thermal simulations, the solid internal energy is also updated, in the same kernel as the fluid and the mobility.
    */
   void
   updateFluidState( ObjectManagerBase & subRegion ) const;
@@ -307,6 +309,13 @@ public:
   void
   updateMobility( ObjectManagerBase & dataGroup ) const;
 
+  /**
+   * @brief Function to update the fluid model, the mobility and the solid internal energy in a single kernel
+   * @param dataGroup group that contains the fields
+   */
+  void
+  updateThermalState( ObjectManagerBase & dataGroup ) const;
+
   virtual void initializePreSubGroups() override;
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
@@ -654,6 +654,33 @@ struct ScalingForSystemSolutionKernel
 
 /******************************** StatisticsKernel ********************************/
 
+/**
+ * @brief Kernel extrapolating in time a primary variable, to build the initial guess of a time step
+ */
+struct SolutionExtrapolationKernel
+{
+  /**
+   * @brief Compute x + factor * ( x - x_n )
+   * @param[in] size the number of elements
+   * @param[in] factor the ratio between the next and the previous time step sizes
+   * @param[in] var the variable at the end of the previous time step
+   * @param[in] var_n the variable at the beginning of the previous time step
+   * @param[out] guess the extrapolated variable
+   */
+  static void
+  launch( localIndex const size,
+          real64 const factor,
+          arrayView1d< real64 const > const & var,
+          arrayView1d< real64 const > const & var_n,
+          arrayView1d< real64 > const & guess )
+  {
+    forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const ei )
+    {
+      guess[ei] = var[ei] + factor * ( var[ei] - var_n[ei] );
+    } );
+  }
+};
+
 struct StatisticsKernel
 {
   static void
@@ -22,6 +22,7 @@
 #include "constitutive/fluid/singlefluid/SingleFluidSelector.hpp"
 #include "constitutive/permeability/PermeabilityFields.hpp"
 #include "constitutive/ConstitutivePassThru.hpp"
+#include "constitutive/solid/CoupledSolidBase.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
@@ -57,8 +58,20 @@ using namespace singlePhaseFVMKernels;
 template< typename BASE >
 SinglePhaseFVM< BASE >::SinglePhaseFVM( const string & name,
                                         Group * const parent ):
-  BASE( name, parent )
-{}
+  BASE( name, parent ),
+  m_overlapGhostExchange( 0 ),
+  m_deferGhostExchange( false ),
+  m_ghostPressureOutdated( false )
+{
+  if( std::is_same< BASE, SinglePhaseBase >::value )
+  {
+    this->registerWrapper( viewKeyStruct::overlapGhostExchangeString(), &m_overlapGhostExchange ).
+      setApplyDefaultValue( 0 ).
+      setInputFlag( InputFlags::OPTIONAL ).
+      setDescription( "Flag to overlap the exchange of the ghost pressures with the assembly in the Newton loop (isothermal, cell regions only). "
+                      "The accumulation terms and the fluxes between locally owned cells are assembled while the exchange is in flight." );
+  }
+}
 
 template< typename BASE >
 void SinglePhaseFVM< BASE >::initializePreSubGroups()
@@ -80,6 +93,63 @@ void SinglePhaseFVM< BASE >::initializePreSubGroups()
     LinearSolverParameters & linParams = m_linearSolverParameters.get();
     linParams.amg.numFunctions = 2;
   }
+
+  if( m_overlapGhostExchange )
+  {
+    GEOS_THROW_IF( m_isThermal,
+                   this->getDataContext() << ": " << viewKeyStruct::overlapGhostExchangeString() <<
+                   " is only supported in isothermal simulations",
+                   InputError );
+
+    // the state of the ghost cells is only updated on cell regions after the exchange
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                  MeshLevel & mesh,
+                                                                  arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions< SurfaceElementSubRegion >( regionNames,
+                                                                             [&]( localIndex const,
+                                                                                  SurfaceElementSubRegion const & subRegion )
+      {
+        GEOS_THROW( this->getDataContext() << ": " << viewKeyStruct::overlapGhostExchangeString() <<
+                    " is not supported with the surface elements of " << subRegion.getDataContext(),
+                    InputError );
+      } );
+    } );
+  }
+}
+
+template< typename BASE >
+real64 SinglePhaseFVM< BASE >::nonlinearImplicitStep( real64 const & time_n,
+                                                      real64 const & dt,
+                                                      integer const cycleNumber,
+                                                      DomainPartition & domain )
+{
+  // the ghost pressures are only left outdated within the Newton loop of this solver, whose next assembly
+  // synchronizes them; the coupled solvers driving their own Newton loop get them synchronized right away
+  m_deferGhostExchange = m_overlapGhostExchange;
+  real64 const dtReturn = BASE::nonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  m_deferGhostExchange = false;
+
+  // the loop may end on a system solution without a subsequent assembly
+  if( m_ghostPressureOutdated )
+  {
+    this->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                        MeshLevel & mesh,
+                                                                        arrayView1d< string const > const & regionNames )
+    {
+      FieldIdentifiers fieldsToBeSync;
+      fieldsToBeSync.addElementFields( { fields::flow::pressure::key() }, regionNames );
+      CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), true );
+
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                            CellElementSubRegion & subRegion )
+      {
+        updateGhostCellState( subRegion );
+      } );
+    } );
+    m_ghostPressureOutdated = false;
+  }
+  return dtReturn;
 }
 
 template< typename BASE >
@@ -255,6 +325,193 @@ real64 SinglePhaseFVM< BASE >::calculateResidualNorm( real64 const & GEOS_UNUSED
 }
 
 
+template< typename BASE >
+void SinglePhaseFVM< BASE >::assembleSystem( real64 const time_n,
+                                             real64 const dt,
+                                             DomainPartition & domain,
+                                             DofManager const & dofManager,
+                                             CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                             arrayView1d< real64 > const & localRhs )
+{
+  if( m_ghostPressureOutdated )
+  {
+    assembleSystemWithGhostExchange( time_n, dt, domain, dofManager, localMatrix, localRhs );
+    m_ghostPressureOutdated = false;
+  }
+  else
+  {
+    BASE::assembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
+  }
+}
+
+template< typename BASE >
+void SinglePhaseFVM< BASE >::assembleSystemWithGhostExchange( real64 const GEOS_UNUSED_PARAM( time_n ),
+                                                              real64 const dt,
+                                                              DomainPartition & domain,
+                                                              DofManager const & dofManager,
+                                                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                              arrayView1d< real64 > const & localRhs )
+{
+  GEOS_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  string const & dofKey = dofManager.getKey( BASE::viewKeyStruct::elemDofFieldString() );
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                MeshLevel & mesh,
+                                                                arrayView1d< string const > const & regionNames )
+  {
+    ElementRegionManager & elemManager = mesh.getElemManager();
+
+    auto const assembleFluxes = [&]( ConnectionSubset const subset )
+    {
+      fluxApprox.forAllStencils( mesh, [&]( auto & stencil )
+      {
+        typename TYPEOFREF( stencil ) ::KernelWrapper stencilWrapper = stencil.createKernelWrapper();
+
+        singlePhaseFVMKernels::
+          FaceBasedAssemblyKernelFactory::createAndLaunch< parallelDevicePolicy<> >( dofManager.rankOffset(),
+                                                                                     dofKey,
+                                                                                     this->getName(),
+                                                                                     elemManager,
+                                                                                     stencilWrapper,
+                                                                                     dt,
+                                                                                     localMatrix.toViewConstSizes(),
+                                                                                     localRhs.toView(),
+                                                                                     subset );
+      } );
+    };
+
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addElementFields( { fields::flow::pressure::key() }, regionNames );
+
+    CommunicationTools & commTools = CommunicationTools::getInstance();
+    MPI_iCommData icomm( commTools.getCommID() );
+    commTools.beginSynchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), icomm, true );
+
+    // the accumulation terms and the interior fluxes only read the state of the locally owned cells
+    elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion const & subRegion )
+    {
+      this->accumulationAssemblyLaunch( dofManager, subRegion, localMatrix, localRhs );
+    } );
+    assembleFluxes( ConnectionSubset::Interior );
+
+    commTools.finalizeSynchronizeFields( mesh, domain.getNeighbors(), icomm, true );
+
+    elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                               CellElementSubRegion & subRegion )
+    {
+      updateGhostCellState( subRegion );
+    } );
+    assembleFluxes( ConnectionSubset::Boundary );
+  } );
+}
+
+template< typename BASE >
+void SinglePhaseFVM< BASE >::updateGhostCellState( CellElementSubRegion & subRegion ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+  arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+  arrayView1d< real64 const > const pres_n = subRegion.getField< fields::flow::pressure_n >();
+  arrayView1d< real64 const > const temp = subRegion.getField< fields::flow::temperature >();
+  arrayView1d< real64 const > const temp_n = subRegion.getField< fields::flow::temperature_n >();
+
+  // same porosity and permeability update as FlowSolverBase::updatePorosityAndPermeability, on the ghost cells
+  bool const isSequential = subRegion.hasField< fields::flow::pressure_k >();
+  arrayView1d< real64 const > const pres_k = isSequential ? subRegion.getField< fields::flow::pressure_k >().toViewConst() : pres;
+  arrayView1d< real64 const > const temp_k = isSequential ? subRegion.getField< fields::flow::temperature_k >().toViewConst() : temp;
+
+  string const & solidName = subRegion.getReference< string >( BASE::viewKeyStruct::solidNamesString() );
+  CoupledSolidBase & porousSolid = subRegion.getConstitutiveModel< CoupledSolidBase >( solidName );
+
+  constitutive::ConstitutivePassThru< CoupledSolidBase >::execute( porousSolid, [=] ( auto & castedPorousSolid )
+  {
+    typename TYPEOFREF( castedPorousSolid ) ::KernelWrapper porousWrapper = castedPorousSolid.createKernelUpdates();
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_DEVICE ( localIndex const k )
+    {
+      if( ghostRank[k] < 0 )
+      {
+        return;
+      }
+      for( localIndex q = 0; q < porousWrapper.numGauss(); ++q )
+      {
+        porousWrapper.updateStateFromPressureAndTemperature( k, q,
+                                                             pres[k],
+                                                             pres_k[k],
+                                                             pres_n[k],
+                                                             temp[k],
+                                                             temp_k[k],
+                                                             temp_n[k] );
+      }
+    } );
+  } );
+
+  if( !isSequential && subRegion.hasField< fields::flow::pressureAtPorosityUpdate >() )
+  {
+    arrayView1d< real64 > const presAtUpdate = subRegion.getField< fields::flow::pressureAtPorosityUpdate >();
+    arrayView1d< real64 > const tempAtUpdate = subRegion.getField< fields::flow::temperatureAtPorosityUpdate >();
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( ghostRank[k] >= 0 )
+      {
+        presAtUpdate[k] = pres[k];
+        tempAtUpdate[k] = temp[k];
+      }
+    } );
+  }
+
+  // then the fluid and the mobility, as in SinglePhaseBase::updateFluidState
+  SingleFluidBase & fluid =
+    SolverBase::getConstitutiveModel< SingleFluidBase >( subRegion, subRegion.getReference< string >( BASE::viewKeyStruct::fluidNamesString() ) );
+
+  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( ghostRank[k] < 0 )
+      {
+        return;
+      }
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k], temp[k] );
+      }
+    } );
+  } );
+
+  typename BASE::FluidPropViews const fluidProps = this->getFluidProperties( fluid );
+  arrayView2d< real64 const > const dens = fluidProps.dens;
+  arrayView2d< real64 const > const dDens_dPres = fluidProps.dDens_dPres;
+  arrayView2d< real64 const > const visc = fluidProps.visc;
+  arrayView2d< real64 const > const dVisc_dPres = fluidProps.dVisc_dPres;
+  arrayView1d< real64 > const mob = subRegion.getField< fields::flow::mobility >();
+  arrayView1d< real64 > const dMob_dPres = subRegion.getField< fields::flow::dMobility_dPressure >();
+
+  forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+  {
+    if( ghostRank[k] >= 0 )
+    {
+      MobilityKernel::compute( dens[k][0], dDens_dPres[k][0], visc[k][0], dVisc_dPres[k][0], mob[k], dMob_dPres[k] );
+    }
+  } );
+}
+
+template< typename BASE >
+void SinglePhaseFVM< BASE >::resetStateToBeginningOfStep( DomainPartition & domain )
+{
+  // the state of all the cells, ghosts included, is reset to the beginning of the step
+  BASE::resetStateToBeginningOfStep( domain );
+  m_ghostPressureOutdated = false;
+}
+
 template< typename BASE >
 void SinglePhaseFVM< BASE >::applySystemSolution( DofManager const & dofManager,
                                                   arrayView1d< real64 const > const & localSolution,
@@ -288,6 +545,13 @@ void SinglePhaseFVM< BASE >::applySystemSolution( DofManager const & dofManager,
                                  scalingFactor );
   }
 
+  if( m_deferGhostExchange )
+  {
+    // the ghost pressures are exchanged during the next assembly, overlapped with the interior work
+    m_ghostPressureOutdated = true;
+    return;
+  }
+
   this->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                       MeshLevel & mesh,
                                                                       arrayView1d< string const > const & regionNames )
@@ -880,7 +1144,7 @@ void SinglePhaseFVM< SinglePhaseBase >::applyAquiferBC( real64 const time,
         return;
       }
 
-      AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = bc.createKernelWrapper();
+      AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = bc.createKernelWrapper( time, dt );
       real64 const & aquiferDens = bc.getWaterPhaseDensity();
 
       singlePhaseFVMKernels::AquiferBCKernel::launch( stencil,
@@ -894,7 +1158,6 @@ void SinglePhaseFVM< SinglePhaseBase >::applyAquiferBC( real64 const time,
                                                       flowAccessors.get< fields::flow::gravityCoefficient >(),
                                                       fluidAccessors.get< fields::singlefluid::density >(),
                                                       fluidAccessors.get< fields::singlefluid::dDensity_dPressure >(),
-                                                      time,
                                                       dt,
                                                       localMatrix.toViewConstSizes(),
                                                       localRhs.toView() );
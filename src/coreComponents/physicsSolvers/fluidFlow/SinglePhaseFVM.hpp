@@ -119,6 +119,12 @@ public:
    */
   /**@{*/
 
+  virtual real64
+  nonlinearImplicitStep( real64 const & time_n,
+                         real64 const & dt,
+                         integer const cycleNumber,
+                         DomainPartition & domain ) override;
+
   virtual void
   setupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
@@ -131,6 +137,14 @@ public:
                ParallelVector & solution,
                bool const setSparsity = true ) override;
 
+  virtual void
+  assembleSystem( real64 const time_n,
+                  real64 const dt,
+                  DomainPartition & domain,
+                  DofManager const & dofManager,
+                  CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                  arrayView1d< real64 > const & localRhs ) override;
+
   virtual void
   applyBoundaryConditions( real64 const time_n,
                            real64 const dt,
@@ -152,6 +166,10 @@ public:
                        real64 const scalingFactor,
                        real64 const dt,
                        DomainPartition & domain ) override;
+
+  virtual void
+  resetStateToBeginningOfStep( DomainPartition & domain ) override;
+
   virtual void
   assembleFluxTerms( real64 const time_n,
                      real64 const dt,
@@ -190,8 +208,38 @@ public:
 
   virtual void initializePreSubGroups() override;
 
+  struct viewKeyStruct : BASE::viewKeyStruct
+  {
+    static constexpr char const * overlapGhostExchangeString() { return "overlapGhostExchange"; }
+  };
+
 private:
 
+  /**
+   * @brief Complete the deferred synchronization of the pressure while assembling the system
+   * @param time_n previous time value
+   * @param dt time step
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the system matrix
+   * @param localRhs the system right-hand side vector
+   *
+   * The accumulation terms and the fluxes between locally owned cells are assembled while the ghost
+   * pressures are exchanged, and the fluxes involving ghost cells once the state of these cells is updated.
+   */
+  void assembleSystemWithGhostExchange( real64 const time_n,
+                                        real64 const dt,
+                                        DomainPartition & domain,
+                                        DofManager const & dofManager,
+                                        CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                        arrayView1d< real64 > const & localRhs );
+
+  /**
+   * @brief Update the porosity, permeability, fluid and mobility of the ghost cells of a subregion
+   * @param subRegion the subregion holding the ghost cells
+   */
+  void updateGhostCellState( CellElementSubRegion & subRegion ) const;
+
   /**
    * @brief Function to perform the application of Dirichlet BCs on faces
    * @param time_n current time
@@ -208,7 +256,14 @@ private:
                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
                              arrayView1d< real64 > const & localRhs );
 
-  // no data needed here, see SinglePhaseBase
+  /// flag to overlap the exchange of the ghost pressures with the assembly in the Newton loop
+  integer m_overlapGhostExchange;
+
+  /// flag indicating whether the synchronization of the pressure is deferred to the assembly
+  bool m_deferGhostExchange;
+
+  /// flag indicating whether the ghost pressures are outdated since the last system solution
+  bool m_ghostPressureOutdated;
 
 };
 
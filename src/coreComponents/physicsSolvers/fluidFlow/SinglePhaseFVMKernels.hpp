@@ -46,6 +46,16 @@ using namespace constitutive;
 
 /******************************** FaceBasedAssemblyKernelBase ********************************/
 
+/**
+ * @brief The connections assembled by a launch of FaceBasedAssemblyKernel
+ */
+enum class ConnectionSubset : integer
+{
+  All,      ///< all the connections
+  Interior, ///< only the connections between locally owned elements
+  Boundary  ///< only the connections involving at least one ghost element
+};
+
 /**
  * @brief Base class for FaceBasedAssemblyKernel that holds all data not dependent
  *        on template parameters (like stencil type and number of dofs).
@@ -297,6 +307,24 @@ public:
   localIndex numPointsInFlux( localIndex const iconn ) const
   { return m_stencilWrapper.numPointsInFlux( iconn ); }
 
+  /**
+   * @brief Check whether a connection only involves locally owned elements
+   * @param[in] iconn the connection index
+   * @return true if the connection does not read any ghost element
+   */
+  GEOS_HOST_DEVICE
+  bool isInteriorConnection( localIndex const iconn ) const
+  {
+    for( localIndex i = 0; i < m_sei[iconn].size(); ++i )
+    {
+      if( m_ghostRank[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )] >= 0 )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   /**
    * @brief Performs the setup phase for the kernel.
    * @param[in] iconn the connection index
@@ -512,7 +540,8 @@ public:
     {
       if( m_ghostRank[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )] < 0 )
       {
-        globalIndex const globalRow = m_dofNumber[m_seri( iconn, i )][m_sesri( iconn, i )][m_sei( iconn, i )];
+        // the dof offset of this element has already been gathered in setup
+        globalIndex const globalRow = stack.dofColIndices[i * numDof];
         localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - m_rankOffset );
         GEOS_ASSERT_GE( localRow, 0 );
         GEOS_ASSERT_GT( m_localMatrix.numRows(), localRow );
@@ -535,16 +564,24 @@ public:
    * @tparam KERNEL_TYPE the kernel type
    * @param[in] numConnections the number of connections
    * @param[inout] kernelComponent the kernel component providing access to setup/compute/complete functions and stack variables
+   * @param[in] subset the connections to assemble, the interior ones can be assembled before the ghost values are received
    */
   template< typename POLICY, typename KERNEL_TYPE >
   static void
   launch( localIndex const numConnections,
-          KERNEL_TYPE const & kernelComponent )
+          KERNEL_TYPE const & kernelComponent,
+          ConnectionSubset const subset = ConnectionSubset::All )
   {
     GEOS_MARK_FUNCTION;
 
     forAll< POLICY >( numConnections, [=] GEOS_HOST_DEVICE ( localIndex const iconn )
     {
+      if( subset != ConnectionSubset::All &&
+          kernelComponent.isInteriorConnection( iconn ) != ( subset == ConnectionSubset::Interior ) )
+      {
+        return;
+      }
+
       typename KERNEL_TYPE::StackVariables stack( kernelComponent.stencilSize( iconn ),
                                                   kernelComponent.numPointsInFlux( iconn ) );
 
@@ -587,6 +624,7 @@ public:
    * @param[in] dt time step size
    * @param[inout] localMatrix the local CRS matrix
    * @param[inout] localRhs the local right-hand side vector
+   * @param[in] subset the connections to assemble
    */
   template< typename POLICY, typename STENCILWRAPPER >
   static void
@@ -597,7 +635,8 @@ public:
                    STENCILWRAPPER const & stencilWrapper,
                    real64 const & dt,
                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
-                   arrayView1d< real64 > const & localRhs )
+                   arrayView1d< real64 > const & localRhs,
+                   ConnectionSubset const subset = ConnectionSubset::All )
   {
     integer constexpr NUM_EQN = 1;
     integer constexpr NUM_DOF = 1;
@@ -607,14 +646,14 @@ public:
     dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
     using kernelType = FaceBasedAssemblyKernel< NUM_EQN, NUM_DOF, STENCILWRAPPER >;
-    typename kernelType::SinglePhaseFlowAccessors flowAccessors( elemManager, solverName );
-    typename kernelType::SinglePhaseFluidAccessors fluidAccessors( elemManager, solverName );
-    typename kernelType::PermeabilityAccessors permAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+    auto const & permAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
 
     kernelType kernel( rankOffset, stencilWrapper, dofNumberAccessor,
                        flowAccessors, fluidAccessors, permAccessors,
                        dt, localMatrix, localRhs );
-    kernelType::template launch< POLICY >( stencilWrapper.size(), kernel );
+    kernelType::template launch< POLICY >( stencilWrapper.size(), kernel, subset );
   }
 };
 
@@ -917,9 +956,9 @@ public:
 
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
-      typename kernelType::SinglePhaseFlowAccessors singlePhaseFlowAccessors( elemManager, solverName );
-      typename kernelType::SinglePhaseFluidAccessors singlePhaseFluidAccessors( elemManager, solverName );
-      typename kernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
+      auto const & singlePhaseFlowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+      auto const & singlePhaseFluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+      auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
 
       kernelType kernel( rankOffset,
                          faceManager,
@@ -992,7 +1031,6 @@ struct AquiferBCKernel
           ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
           ElementViewConst< arrayView2d< real64 const > > const & dens,
           ElementViewConst< arrayView2d< real64 const > > const & dDens_dPres,
-          real64 const & timeAtBeginningOfStep,
           real64 const & dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
@@ -1017,9 +1055,7 @@ struct AquiferBCKernel
 
       // compute the aquifer influx rate using the pressure influence function and the aquifer props
       real64 dAquiferVolFlux_dPres = 0.0;
-      real64 const aquiferVolFlux = aquiferBCWrapper.compute( timeAtBeginningOfStep,
-                                                              dt,
-                                                              pres[er][esr][ei],
+      real64 const aquiferVolFlux = aquiferBCWrapper.compute( pres[er][esr][ei],
                                                               pres_n[er][esr][ei],
                                                               gravCoef[er][esr][ei],
                                                               areaFraction,
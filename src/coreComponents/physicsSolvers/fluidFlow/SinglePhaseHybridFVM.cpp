@@ -21,6 +21,7 @@
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutivePassThru.hpp"
 #include "constitutive/fluid/singlefluid/SingleFluidBase.hpp"
+#include "constitutive/permeability/ConstantPermeability.hpp"
 #include "fieldSpecification/AquiferBoundaryCondition.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "finiteVolume/HybridMimeticDiscretization.hpp"
@@ -69,6 +70,19 @@ void SinglePhaseHybridFVM::registerDataOnMesh( Group & meshBodies )
     // primary variables: face pressures at the previous converged time step
     faceManager.registerField< fields::flow::facePressure_n >( getName() );
   } );
+
+  // 3) Register the transmissibility matrices precomputed in the cells
+  forDiscretizationOnMeshTargets( meshBodies, [&] ( string const &,
+                                                    MeshLevel & mesh,
+                                                    arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      subRegion.registerField< fields::flow::transMatrix >( getName() );
+      subRegion.registerField< fields::flow::transMatrixSinglePrecision >( getName() );
+    } );
+  } );
 }
 
 void SinglePhaseHybridFVM::initializePreSubGroups()
@@ -137,6 +151,65 @@ void SinglePhaseHybridFVM::initializePostInitialConditionsPreSubGroups()
   } );
 }
 
+void SinglePhaseHybridFVM::precomputeData( MeshLevel & mesh, arrayView1d< string const > const & regionNames )
+{
+  SinglePhaseBase::precomputeData( mesh, regionNames );
+
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+
+  // tolerance for transmissibility calculation
+  real64 const lengthTolerance = domain.getMeshBody( 0 ).getGlobalLengthScale() * m_areaRelTol;
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion & subRegion )
+  {
+    string const & permName = subRegion.getReference< string >( viewKeyStruct::permeabilityNamesString() );
+    PermeabilityBase const & permeability = getConstitutiveModel< PermeabilityBase >( subRegion, permName );
+
+    // the transmissibility matrices can only be reused if the permeability does not change during the simulation
+    if( dynamicCast< ConstantPermeability const * >( &permeability ) == nullptr )
+    {
+      return;
+    }
+
+    hybridFVMKernels::TransMatrixPrecomputeKernel::allocate( subRegion.numFacesPerElement(),
+                                                             false,
+                                                             hmDiscretization.useSinglePrecisionTransMatrix(),
+                                                             subRegion );
+
+    mimeticInnerProductDispatch( mimeticInnerProductBase,
+                                 [&] ( auto const mimeticInnerProduct )
+    {
+      using IP = TYPEOFREF( mimeticInnerProduct );
+
+      internal::kernelLaunchSelectorFaceSwitch( subRegion.numFacesPerElement(), [&] ( auto NUM_FACES )
+      {
+        hybridFVMKernels::TransMatrixPrecomputeKernel::
+          launch< IP, NUM_FACES() >( subRegion.size(),
+                                     nodeManager.referencePosition(),
+                                     faceManager.getField< fields::flow::transMultiplier >(),
+                                     faceManager.nodeList().toViewConst(),
+                                     subRegion.faceList().toViewConst(),
+                                     subRegion.getElementCenter(),
+                                     subRegion.getElementVolume(),
+                                     permeability.permeability(),
+                                     lengthTolerance,
+                                     false,
+                                     subRegion.getField< fields::flow::transMatrix >(),
+                                     subRegion.getField< fields::flow::transMatrixSinglePrecision >() );
+      } );
+    } );
+  } );
+}
+
 void SinglePhaseHybridFVM::implicitStepSetup( real64 const & time_n,
                                               real64 const & dt,
                                               DomainPartition & domain )
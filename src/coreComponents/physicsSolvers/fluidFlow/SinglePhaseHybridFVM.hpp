@@ -184,6 +184,11 @@ public:
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
+protected:
+
+  /// precompute the transmissibility matrices of the elements
+  virtual void precomputeData( MeshLevel & mesh, arrayView1d< string const > const & regionNames ) override;
+
 private:
 
   /// relative tolerance (redundant with FluxApproximationBase)
@@ -167,6 +167,7 @@ public:
     m_elemList( faceManager.elementList() ),
     m_elemPerm( permeability.permeability() ),
     m_transMultiplier( faceManager.getField< fields::flow::transMultiplier >() ),
+    m_transMatrixCache( subRegion ),
     m_elemPres( subRegion.getField< fields::flow::pressure >() ),
     m_facePres( faceManager.getField< fields::flow::facePressure >() ),
     m_elemDens ( fluid.density() ),
@@ -356,19 +357,24 @@ public:
   {
     GEOS_UNUSED_VAR( ei, stack, kernelOp );
 
-    real64 const perm[ 3 ] = { m_elemPerm[ei][0][0], m_elemPerm[ei][0][1], m_elemPerm[ei][0][2] };
-
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    IP::template compute< NUM_FACE >( m_nodePosition,
-                                      m_transMultiplier,
-                                      m_faceToNodes,
-                                      m_elemToFaces[ei],
-                                      m_elemCenter[ei],
-                                      m_elemVolume[ei],
-                                      perm,
-                                      m_lengthTolerance,
-                                      stack.transMatrix );
+    // the local transmissibility matrix is only recomputed at each iteration if the permeability changes
+    if( m_transMatrixCache.isEmpty() )
+    {
+      real64 const perm[ 3 ] = { m_elemPerm[ei][0][0], m_elemPerm[ei][0][1], m_elemPerm[ei][0][2] };
+      IP::template compute< NUM_FACE >( m_nodePosition,
+                                        m_transMultiplier,
+                                        m_faceToNodes,
+                                        m_elemToFaces[ei],
+                                        m_elemCenter[ei],
+                                        m_elemVolume[ei],
+                                        perm,
+                                        m_lengthTolerance,
+                                        stack.transMatrix );
+    }
+    else
+    {
+      m_transMatrixCache.template load< NUM_FACE >( ei, 0, stack.transMatrix );
+    }
 
     /*
      * compute auxiliary quantities at the one sided faces of this element:
@@ -524,6 +530,9 @@ protected:
   arrayView3d< real64 const > const m_elemPerm;
   arrayView1d< real64 const > const m_transMultiplier;
 
+  /// transmissibility matrices precomputed in the elements
+  hybridFVMKernels::TransMatrixCache const m_transMatrixCache;
+
   /// pressure and fluid data
   arrayView1d< real64 const > const m_elemPres;
   arrayView1d< real64 const > const m_facePres;
@@ -598,7 +607,7 @@ public:
         dofNumberAccessor.setName( solverName + "/accessors/" + elemDofKey );
 
         using kernelType = ElementBasedAssemblyKernel< NUM_FACES, IP >;
-        typename kernelType::FlowAccessors flowAccessors( elemManager, solverName );
+        auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::FlowAccessors >( solverName );
 
         ElementBasedAssemblyKernel< NUM_FACES, IP >
         kernel( rankOffset, er, esr, lengthTolerance, faceDofKey, nodeManager, faceManager,
@@ -805,9 +814,9 @@ public:
     arrayView1d< integer const > const ghostRank = faceManager.ghostRank();
 
     using kernelType = ResidualNormKernel;
-    typename kernelType::SinglePhaseFlowAccessors flowAccessors( elemManager, solverName );
-    typename kernelType::SinglePhaseFluidAccessors fluidAccessors( elemManager, solverName );
-    typename kernelType::PorosityAccessors poroAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+    auto const & poroAccessors = elemManager.getCachedAccessors< typename kernelType::PorosityAccessors >( solverName );
 
     ResidualNormKernel kernel( rankOffset, localResidual, dofNumber, ghostRank,
                                regionFilter, faceManager, flowAccessors, fluidAccessors, poroAccessors, defaultViscosity, dt, minNormalizer );
@@ -344,13 +344,13 @@ public:
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
       using KERNEL_TYPE = FaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER >;
-      typename KERNEL_TYPE::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::StabCompFlowAccessors stabCompFlowAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::StabMultiFluidAccessors stabMultiFluidAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::CapPressureAccessors capPressureAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
-      typename KERNEL_TYPE::RelPermAccessors relPermAccessors( elemManager, solverName );
+      auto const & compFlowAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::CompFlowAccessors >( solverName );
+      auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::MultiFluidAccessors >( solverName );
+      auto const & stabCompFlowAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::StabCompFlowAccessors >( solverName );
+      auto const & stabMultiFluidAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::StabMultiFluidAccessors >( solverName );
+      auto const & capPressureAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::CapPressureAccessors >( solverName );
+      auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::PermeabilityAccessors >( solverName );
+      auto const & relPermAccessors = elemManager.getCachedAccessors< typename KERNEL_TYPE::RelPermAccessors >( solverName );
 
       KERNEL_TYPE kernel( numPhases, rankOffset, hasCapPressure, stencilWrapper, dofNumberAccessor,
                           compFlowAccessors, stabCompFlowAccessors, multiFluidAccessors, stabMultiFluidAccessors,
@@ -490,6 +490,209 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  /**
+   * @brief Launch the update over the cells in the order of a permutation grouping them by phase state,
+   *   so that neighboring threads follow the same branches of the flash
+   * @param[in] ordering the permutation of the cells computed by PhaseStateOrderingKernel
+   * @param[in] fluidWrapper the kernel wrapper of the fluid model
+   * @param[in] pres the pressure
+   * @param[in] temp the temperature
+   * @param[in] compFrac the global component fractions
+   */
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( arrayView1d< localIndex const > const & ordering,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    forAll< POLICY >( ordering.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const k = ordering[a];
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+      }
+    } );
+  }
+
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( localIndex const size,
+          real64 const tolerance,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compFrac,
+          arrayView1d< real64 > const & lastPres,
+          arrayView1d< real64 > const & lastTemp,
+          arrayView2d< real64, compflow::USD_COMP > const & lastCompFrac )
+  {
+    localIndex const numComp = compFrac.size( 1 );
+    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      // the fluid properties are only re-evaluated if the state has changed since their last evaluation
+      if( !isStateChanged( numComp, tolerance, pres[k], temp[k], compFrac[k], lastPres[k], lastTemp[k], lastCompFrac[k] ) )
+      {
+        return;
+      }
+
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+      }
+
+      saveState( numComp, pres[k], temp[k], compFrac[k], lastPres[k], lastTemp[k], lastCompFrac[k] );
+    } );
+  }
+
+  /**
+   * @brief Check whether the state of a cell has changed since the last evaluation of its fluid properties
+   * @tparam COMP_FRAC the type of the slice of component fractions
+   * @param[in] numComp the number of components
+   * @param[in] tolerance the relative tolerance on pressure and temperature, and absolute tolerance on component fractions
+   * @param[in] pres the pressure
+   * @param[in] temp the temperature
+   * @param[in] compFrac the global component fractions
+   * @param[in] lastPres the pressure at the last evaluation of the fluid properties
+   * @param[in] lastTemp the temperature at the last evaluation of the fluid properties
+   * @param[in] lastCompFrac the global component fractions at the last evaluation of the fluid properties
+   * @return true if the state has changed beyond the tolerance
+   */
+  template< typename COMP_FRAC >
+  GEOS_HOST_DEVICE
+  static bool
+  isStateChanged( localIndex const numComp,
+                  real64 const tolerance,
+                  real64 const pres,
+                  real64 const temp,
+                  COMP_FRAC const & compFrac,
+                  real64 const lastPres,
+                  real64 const lastTemp,
+                  arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & lastCompFrac )
+  {
+    if( LvArray::math::abs( pres - lastPres ) > tolerance * LvArray::math::abs( pres )
+        || LvArray::math::abs( temp - lastTemp ) > tolerance * LvArray::math::abs( temp ) )
+    {
+      return true;
+    }
+    for( localIndex ic = 0; ic < numComp; ++ic )
+    {
+      if( LvArray::math::abs( compFrac[ic] - lastCompFrac[ic] ) > tolerance )
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Save the state at which the fluid properties of a cell have been evaluated
+   * @tparam COMP_FRAC the type of the slice of component fractions
+   * @param[in] numComp the number of components
+   * @param[in] pres the pressure
+   * @param[in] temp the temperature
+   * @param[in] compFrac the global component fractions
+   * @param[out] lastPres the saved pressure
+   * @param[out] lastTemp the saved temperature
+   * @param[out] lastCompFrac the saved global component fractions
+   */
+  template< typename COMP_FRAC >
+  GEOS_HOST_DEVICE
+  static void
+  saveState( localIndex const numComp,
+             real64 const pres,
+             real64 const temp,
+             COMP_FRAC const & compFrac,
+             real64 & lastPres,
+             real64 & lastTemp,
+             arraySlice1d< real64, compflow::USD_COMP - 1 > const & lastCompFrac )
+  {
+    lastPres = pres;
+    lastTemp = temp;
+    for( localIndex ic = 0; ic < numComp; ++ic )
+    {
+      lastCompFrac[ic] = compFrac[ic];
+    }
+  }
+};
+
+/******************************** FluidStateUpdateKernel ********************************/
+
+/**
+ * @brief Fused kernel computing the global component fractions from the component densities and
+ *        evaluating the fluid properties in a single pass over the cells
+ *
+ * The component fractions are kept in a stack array between the two steps, so that the component
+ * densities are read only once per cell and the fluid update does not re-read the fractions from memory.
+ */
+struct FluidStateUpdateKernel
+{
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( localIndex const size,
+          real64 const tolerance,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compDens,
+          arrayView2d< real64, compflow::USD_COMP > const & compFrac,
+          arrayView3d< real64, compflow::USD_COMP_DC > const & dCompFrac_dCompDens,
+          arrayView1d< real64 > const & lastPres,
+          arrayView1d< real64 > const & lastTemp,
+          arrayView2d< real64, compflow::USD_COMP > const & lastCompFrac,
+          arrayView1d< localIndex const > const & ordering )
+  {
+    localIndex const numComp = compDens.size( 1 );
+    bool const isOrdered = !ordering.empty();
+    forAll< POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      // the cells are visited grouped by phase state if a permutation is given, so that neighboring threads follow the same branches of the flash
+      localIndex const k = isOrdered ? ordering[a] : a;
+
+      // Step 1: compute the global component fractions and their derivatives
+
+      stackArray1d< real64, MultiFluidBase::MAX_NUM_COMPONENTS > compFracLocal( numComp );
+
+      real64 totalDensity = 0.0;
+      for( localIndex ic = 0; ic < numComp; ++ic )
+      {
+        totalDensity += compDens[k][ic];
+      }
+      real64 const totalDensityInv = 1.0 / totalDensity;
+
+      for( localIndex ic = 0; ic < numComp; ++ic )
+      {
+        compFracLocal[ic] = compDens[k][ic] * totalDensityInv;
+        compFrac[k][ic] = compFracLocal[ic];
+        for( localIndex jc = 0; jc < numComp; ++jc )
+        {
+          dCompFrac_dCompDens[k][ic][jc] = -compFracLocal[ic] * totalDensityInv;
+        }
+        dCompFrac_dCompDens[k][ic][ic] += totalDensityInv;
+      }
+
+      // Step 2: evaluate the fluid properties, unless the state has not changed since their last evaluation
+
+      if( tolerance > 0.0 )
+      {
+        if( !FluidUpdateKernel::isStateChanged( numComp, tolerance, pres[k], temp[k], compFracLocal,
+                                                lastPres[k], lastTemp[k], lastCompFrac[k] ) )
+        {
+          return;
+        }
+        FluidUpdateKernel::saveState( numComp, pres[k], temp[k], compFracLocal,
+                                      lastPres[k], lastTemp[k], lastCompFrac[k] );
+      }
+
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k], temp[k], compFracLocal.toSliceConst() );
+      }
+    } );
+  }
 };
 
 /******************************** SolidInternalEnergyUpdateKernel ********************************/
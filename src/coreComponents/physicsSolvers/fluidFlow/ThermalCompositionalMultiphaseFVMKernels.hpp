@@ -645,13 +645,13 @@ public:
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
       using KernelType = FaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER >;
-      typename KernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-      typename KernelType::ThermalCompFlowAccessors thermalCompFlowAccessors( elemManager, solverName );
-      typename KernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-      typename KernelType::ThermalMultiFluidAccessors thermalMultiFluidAccessors( elemManager, solverName );
-      typename KernelType::CapPressureAccessors capPressureAccessors( elemManager, solverName );
-      typename KernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
-      typename KernelType::ThermalConductivityAccessors thermalConductivityAccessors( elemManager, solverName );
+      auto const & compFlowAccessors = elemManager.getCachedAccessors< typename KernelType::CompFlowAccessors >( solverName );
+      auto const & thermalCompFlowAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalCompFlowAccessors >( solverName );
+      auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename KernelType::MultiFluidAccessors >( solverName );
+      auto const & thermalMultiFluidAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalMultiFluidAccessors >( solverName );
+      auto const & capPressureAccessors = elemManager.getCachedAccessors< typename KernelType::CapPressureAccessors >( solverName );
+      auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename KernelType::PermeabilityAccessors >( solverName );
+      auto const & thermalConductivityAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalConductivityAccessors >( solverName );
 
       KernelType kernel( numPhases, rankOffset, hasCapPressure, stencilWrapper, dofNumberAccessor,
                          compFlowAccessors, thermalCompFlowAccessors, multiFluidAccessors, thermalMultiFluidAccessors,
@@ -953,11 +953,11 @@ public:
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
       using kernelType = DiffusionDispersionFaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, STENCILWRAPPER >;
-      typename kernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-      typename kernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-      typename kernelType::DiffusionAccessors diffusionAccessors( elemManager, solverName );
-      typename kernelType::DispersionAccessors dispersionAccessors( elemManager, solverName );
-      typename kernelType::PorosityAccessors porosityAccessors( elemManager, solverName );
+      auto const & compFlowAccessors = elemManager.getCachedAccessors< typename kernelType::CompFlowAccessors >( solverName );
+      auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename kernelType::MultiFluidAccessors >( solverName );
+      auto const & diffusionAccessors = elemManager.getCachedAccessors< typename kernelType::DiffusionAccessors >( solverName );
+      auto const & dispersionAccessors = elemManager.getCachedAccessors< typename kernelType::DispersionAccessors >( solverName );
+      auto const & porosityAccessors = elemManager.getCachedAccessors< typename kernelType::PorosityAccessors >( solverName );
 
       kernelType kernel( numPhases, rankOffset, stencilWrapper,
                          dofNumberAccessor, compFlowAccessors, multiFluidAccessors,
@@ -1396,13 +1396,13 @@ public:
         dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
         using KernelType = DirichletFaceBasedAssemblyKernel< NUM_COMP, NUM_DOF, typename FluidType::KernelWrapper >;
-        typename KernelType::CompFlowAccessors compFlowAccessors( elemManager, solverName );
-        typename KernelType::ThermalCompFlowAccessors thermalCompFlowAccessors( elemManager, solverName );
-        typename KernelType::MultiFluidAccessors multiFluidAccessors( elemManager, solverName );
-        typename KernelType::ThermalMultiFluidAccessors thermalMultiFluidAccessors( elemManager, solverName );
-        typename KernelType::CapPressureAccessors capPressureAccessors( elemManager, solverName );
-        typename KernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
-        typename KernelType::ThermalConductivityAccessors thermalConductivityAccessors( elemManager, solverName );
+        auto const & compFlowAccessors = elemManager.getCachedAccessors< typename KernelType::CompFlowAccessors >( solverName );
+        auto const & thermalCompFlowAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalCompFlowAccessors >( solverName );
+        auto const & multiFluidAccessors = elemManager.getCachedAccessors< typename KernelType::MultiFluidAccessors >( solverName );
+        auto const & thermalMultiFluidAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalMultiFluidAccessors >( solverName );
+        auto const & capPressureAccessors = elemManager.getCachedAccessors< typename KernelType::CapPressureAccessors >( solverName );
+        auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename KernelType::PermeabilityAccessors >( solverName );
+        auto const & thermalConductivityAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalConductivityAccessors >( solverName );
 
         // for now, we neglect capillary pressure in the kernel
         bool const hasCapPressure = false;
@@ -478,6 +478,72 @@ struct SolidInternalEnergyUpdateKernel
   }
 };
 
+/******************************** ThermalStateUpdateKernel ********************************/
+
+/**
+ * @brief Fused update of the fluid properties, of the mobility and of the solid internal energy,
+ *        so that the pressure, temperature and fluid properties of each element are read in a single pass
+ */
+struct ThermalStateUpdateKernel
+{
+
+  /**
+   * @brief Launch the fused update
+   * @tparam POLICY the execution policy
+   * @tparam FLUID_WRAPPER the type of the fluid kernel wrapper
+   * @tparam SOLID_INTERNAL_ENERGY_WRAPPER the type of the solid internal energy kernel wrapper
+   * @param[in] fluidWrapper the fluid kernel wrapper
+   * @param[in] solidInternalEnergyWrapper the solid internal energy kernel wrapper
+   * @param[in] pres the pressure
+   * @param[in] temp the temperature
+   * @param[in] dens the fluid density, updated by the fluid wrapper
+   * @param[in] dDens_dPres the derivative of the fluid density wrt pressure, updated by the fluid wrapper
+   * @param[in] dDens_dTemp the derivative of the fluid density wrt temperature, updated by the fluid wrapper
+   * @param[in] visc the fluid viscosity, updated by the fluid wrapper
+   * @param[in] dVisc_dPres the derivative of the fluid viscosity wrt pressure, updated by the fluid wrapper
+   * @param[in] dVisc_dTemp the derivative of the fluid viscosity wrt temperature, updated by the fluid wrapper
+   * @param[out] mob the mobility
+   * @param[out] dMob_dPres the derivative of the mobility wrt pressure
+   * @param[out] dMob_dTemp the derivative of the mobility wrt temperature
+   */
+  template< typename POLICY, typename FLUID_WRAPPER, typename SOLID_INTERNAL_ENERGY_WRAPPER >
+  static void
+  launch( FLUID_WRAPPER const & fluidWrapper,
+          SOLID_INTERNAL_ENERGY_WRAPPER const & solidInternalEnergyWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const > const & dens,
+          arrayView2d< real64 const > const & dDens_dPres,
+          arrayView2d< real64 const > const & dDens_dTemp,
+          arrayView2d< real64 const > const & visc,
+          arrayView2d< real64 const > const & dVisc_dPres,
+          arrayView2d< real64 const > const & dVisc_dTemp,
+          arrayView1d< real64 > const & mob,
+          arrayView1d< real64 > const & dMob_dPres,
+          arrayView1d< real64 > const & dMob_dTemp )
+  {
+    forAll< POLICY >( fluidWrapper.numElems(), [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      real64 const p = pres[k];
+      real64 const t = temp[k];
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, p, t );
+      }
+      MobilityKernel::compute( dens[k][0],
+                               dDens_dPres[k][0],
+                               dDens_dTemp[k][0],
+                               visc[k][0],
+                               dVisc_dPres[k][0],
+                               dVisc_dTemp[k][0],
+                               mob[k],
+                               dMob_dPres[k],
+                               dMob_dTemp[k] );
+      solidInternalEnergyWrapper.update( k, t );
+    } );
+  }
+};
+
 /******************************** ResidualNormKernel ********************************/
 
 /**
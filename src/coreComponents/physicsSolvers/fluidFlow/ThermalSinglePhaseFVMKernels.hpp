@@ -249,20 +249,37 @@ public:
         dFlux_dT[ke] *= mobility;
       }
 
+      // gather the upwinded mobility derivative and enthalpy (used in Step 4) in a single pass over the upwind cells
       real64 dMob_dT[2]{};
+      real64 enthalpy = 0.0;
+      real64 dEnthalpy_dP[2]{0.0, 0.0};
+      real64 dEnthalpy_dT[2]{0.0, 0.0};
 
       if( alpha <= 0.0 || alpha >= 1.0 )
       {
         localIndex const k_up = 1 - localIndex( fmax( fmin( alpha, 1.0 ), 0.0 ) );
-
-        dMob_dT[k_up] = m_dMob_dTemp[seri[k_up]][sesri[k_up]][sei[k_up]];
+        localIndex const er_up  = seri[k_up];
+        localIndex const esr_up = sesri[k_up];
+        localIndex const ei_up  = sei[k_up];
+
+        dMob_dT[k_up] = m_dMob_dTemp[er_up][esr_up][ei_up];
+        enthalpy = m_enthalpy[er_up][esr_up][ei_up][0];
+        dEnthalpy_dP[k_up] = m_dEnthalpy_dPres[er_up][esr_up][ei_up][0];
+        dEnthalpy_dT[k_up] = m_dEnthalpy_dTemp[er_up][esr_up][ei_up][0];
       }
       else
       {
         real64 const mobWeights[2] = { alpha, 1.0 - alpha };
         for( integer ke = 0; ke < 2; ++ke )
         {
-          dMob_dT[ke] = mobWeights[ke] * m_dMob_dTemp[seri[ke]][sesri[ke]][sei[ke]];
+          localIndex const er  = seri[ke];
+          localIndex const esr = sesri[ke];
+          localIndex const ei  = sei[ke];
+
+          dMob_dT[ke] = mobWeights[ke] * m_dMob_dTemp[er][esr][ei];
+          enthalpy += mobWeights[ke] * m_enthalpy[er][esr][ei][0];
+          dEnthalpy_dP[ke] = mobWeights[ke] * m_dEnthalpy_dPres[er][esr][ei][0];
+          dEnthalpy_dT[ke] = mobWeights[ke] * m_dEnthalpy_dTemp[er][esr][ei][0];
         }
       }
 
@@ -281,29 +298,6 @@ public:
       }
 
       // Step 4: compute the enthalpy flux
-      real64 enthalpy = 0.0;
-      real64 dEnthalpy_dP[2]{0.0, 0.0};
-      real64 dEnthalpy_dT[2]{0.0, 0.0};
-
-      if( alpha <= 0.0 || alpha >= 1.0 )
-      {
-        localIndex const k_up = 1 - localIndex( fmax( fmin( alpha, 1.0 ), 0.0 ) );
-
-        enthalpy = m_enthalpy[seri[k_up]][sesri[k_up]][sei[k_up]][0];
-        dEnthalpy_dP[k_up] = m_dEnthalpy_dPres[seri[k_up]][sesri[k_up]][sei[k_up]][0];
-        dEnthalpy_dT[k_up] = m_dEnthalpy_dTemp[seri[k_up]][sesri[k_up]][sei[k_up]][0];
-      }
-      else
-      {
-        real64 const mobWeights[2] = { alpha, 1.0 - alpha };
-        for( integer ke = 0; ke < 2; ++ke )
-        {
-          enthalpy += mobWeights[ke] * m_enthalpy[seri[ke]][sesri[ke]][sei[ke]][0];
-          dEnthalpy_dP[ke] = mobWeights[ke] * m_dEnthalpy_dPres[seri[ke]][sesri[ke]][sei[ke]][0];
-          dEnthalpy_dT[ke] = mobWeights[ke] * m_dEnthalpy_dTemp[seri[ke]][sesri[ke]][sei[ke]][0];
-        }
-      }
-
       stack.energyFlux += fluxVal * enthalpy;
 
       for( integer ke = 0; ke < 2; ++ke )
@@ -462,12 +456,12 @@ public:
     dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
     using KernelType = FaceBasedAssemblyKernel< NUM_EQN, NUM_DOF, STENCILWRAPPER >;
-    typename KernelType::SinglePhaseFlowAccessors flowAccessors( elemManager, solverName );
-    typename KernelType::ThermalSinglePhaseFlowAccessors thermalFlowAccessors( elemManager, solverName );
-    typename KernelType::SinglePhaseFluidAccessors fluidAccessors( elemManager, solverName );
-    typename KernelType::ThermalSinglePhaseFluidAccessors thermalFluidAccessors( elemManager, solverName );
-    typename KernelType::PermeabilityAccessors permAccessors( elemManager, solverName );
-    typename KernelType::ThermalConductivityAccessors thermalConductivityAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename KernelType::SinglePhaseFlowAccessors >( solverName );
+    auto const & thermalFlowAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalSinglePhaseFlowAccessors >( solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename KernelType::SinglePhaseFluidAccessors >( solverName );
+    auto const & thermalFluidAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalSinglePhaseFluidAccessors >( solverName );
+    auto const & permAccessors = elemManager.getCachedAccessors< typename KernelType::PermeabilityAccessors >( solverName );
+    auto const & thermalConductivityAccessors = elemManager.getCachedAccessors< typename KernelType::ThermalConductivityAccessors >( solverName );
 
     KernelType kernel( rankOffset, stencilWrapper, dofNumberAccessor,
                        flowAccessors, thermalFlowAccessors, fluidAccessors, thermalFluidAccessors,
@@ -797,12 +791,12 @@ public:
 
       dofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
-      typename kernelType::SinglePhaseFlowAccessors singlePhaseFlowAccessors( elemManager, solverName );
-      typename kernelType::ThermalSinglePhaseFlowAccessors thermalSinglePhaseFlowAccessors( elemManager, solverName );
-      typename kernelType::SinglePhaseFluidAccessors singlePhaseFluidAccessors( elemManager, solverName );
-      typename kernelType::ThermalSinglePhaseFluidAccessors thermalSinglePhaseFluidAccessors( elemManager, solverName );
-      typename kernelType::PermeabilityAccessors permeabilityAccessors( elemManager, solverName );
-      typename kernelType::ThermalConductivityAccessors thermalConductivityAccessors( elemManager, solverName );
+      auto const & singlePhaseFlowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+      auto const & thermalSinglePhaseFlowAccessors = elemManager.getCachedAccessors< typename kernelType::ThermalSinglePhaseFlowAccessors >( solverName );
+      auto const & singlePhaseFluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+      auto const & thermalSinglePhaseFluidAccessors = elemManager.getCachedAccessors< typename kernelType::ThermalSinglePhaseFluidAccessors >( solverName );
+      auto const & permeabilityAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
+      auto const & thermalConductivityAccessors = elemManager.getCachedAccessors< typename kernelType::ThermalConductivityAccessors >( solverName );
 
       kernelType kernel( rankOffset,
                          faceManager,
@@ -386,9 +386,12 @@ void ProppantTransport::preStepUpdate( real64 const & time,
       arrayView1d< real64 > const excessPackVolume = subRegion.getField< fields::proppant::proppantExcessPackVolume >();
       arrayView2d< real64 > const cellBasedFlux = subRegion.getField< fields::proppant::cellBasedFlux >();
 
+      // copied so that the device kernel does not capture the solver
+      integer const numComponents = m_numComponents;
+
       forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
       {
-        for( localIndex c = 0; c < m_numComponents; ++c )
+        for( localIndex c = 0; c < numComponents; ++c )
         {
           componentDens_n[ei][c] = componentDens[ei][0][c];
         }
@@ -413,21 +416,20 @@ void ProppantTransport::postStepUpdate( real64 const & time_n,
                                                                arrayView1d< string const > const & regionNames )
   {
 
-    mesh.getElemManager().forElementSubRegions( regionNames, [&]( localIndex const,
-                                                                  ElementSubRegionBase & subRegion )
-    {
-      updateProppantMobility( subRegion );
-    } );
-
+    real64 const minAperture = m_minAperture;
     real64 const maxProppantConcentration = m_maxProppantConcentration;
     mesh.getElemManager().forElementSubRegions( regionNames, [&]( localIndex const,
                                                                   ElementSubRegionBase & subRegion )
     {
+      arrayView1d< real64 const > const aperture = subRegion.getReference< array1d< real64 > >( FaceElementSubRegion::viewKeyStruct::elementApertureString() );
+      arrayView1d< integer > const isProppantMobile = subRegion.getField< fields::proppant::isProppantMobile >();
       arrayView1d< real64 > const & packVolFrac = subRegion.getField< fields::proppant::proppantPackVolumeFraction >();
       arrayView1d< real64 > const & proppantConc = subRegion.getField< fields::proppant::proppantConcentration >();
 
+      // the mobility is evaluated with the concentration of the step, before it is capped at the packing limit
       forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
       {
+        isProppantMobile[ei] = aperture[ei] > minAperture && proppantConc[ei] < maxProppantConcentration;
         if( proppantConc[ei] >= maxProppantConcentration || packVolFrac[ei] >= 1.0 )
         {
           packVolFrac[ei] = 1.0;
@@ -795,6 +797,7 @@ void ProppantTransport::applyBoundaryConditions( real64 const time_n,
           subRegion.getReference< array2d< real64 > >( fields::proppant::componentConcentration::key() );
         arrayView2d< real64 const > const bcCompConc =
           subRegion.getReference< array2d< real64 > >( fields::proppant::bcComponentConcentration::key() );
+        integer const numComponents = m_numComponents;
 
         forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
         {
@@ -806,7 +809,7 @@ void ProppantTransport::applyBoundaryConditions( real64 const time_n,
           localIndex const localRow = dofIndex - rankOffset;
           real64 rhsValue;
 
-          for( localIndex ic = 0; ic < m_numComponents; ++ic )
+          for( localIndex ic = 0; ic < numComponents; ++ic )
           {
             FieldSpecificationEqual::SpecifyFieldValue( dofIndex + ic + 1,
                                                         rankOffset,
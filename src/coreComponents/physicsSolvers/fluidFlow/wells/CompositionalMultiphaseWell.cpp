@@ -1046,6 +1046,9 @@ void CompositionalMultiphaseWell::assembleFluxTerms( real64 const GEOS_UNUSED_PA
                                              localMatrix,
                                              localRhs );
     } );
+
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 }
 
@@ -1119,6 +1122,9 @@ void CompositionalMultiphaseWell::assembleAccumulationTerms( DomainPartition con
                                                      localMatrix,
                                                      localRhs );
     } );
+
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 }
 
@@ -1169,6 +1175,9 @@ void CompositionalMultiphaseWell::assembleVolumeBalanceTerms( DomainPartition co
                                                       localMatrix,
                                                       localRhs );
     } );
+
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 }
 
@@ -1439,6 +1448,9 @@ void CompositionalMultiphaseWell::computePerforationRates( DomainPartition & dom
                                                     dCompPerfRate_dComp );
 
     } );
+
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 
 }
@@ -1591,12 +1603,15 @@ void CompositionalMultiphaseWell::assemblePressureRelations( real64 const & time
 
     ElementRegionManager const & elemManager = mesh.getElemManager();
 
+    // the control switches are evaluated on device and flagged for each well, the flags are brought back once for all the wells
+    arrayView1d< integer > const controlSwitches = resetControlSwitches( regionNames.size() );
+
     elemManager.forElementSubRegions< WellElementSubRegion >( regionNames,
-                                                              [&]( localIndex const,
+                                                              [&]( localIndex const wellIndex,
                                                                    WellElementSubRegion const & subRegion )
     {
 
-      WellControls & wellControls = getWellControls( subRegion );
+      WellControls const & wellControls = getWellControls( subRegion );
 
       // get the degrees of freedom, depth info, next welem index
       string const wellDofKey = dofManager.getKey( wellElementDofName() );
@@ -1619,8 +1634,6 @@ void CompositionalMultiphaseWell::assemblePressureRelations( real64 const & time
       arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens =
         subRegion.getField< fields::well::dTotalMassDensity_dGlobalCompDensity >();
 
-
-      bool controlHasSwitched = false;
       isothermalCompositionalMultiphaseBaseKernels::
         KernelLaunchSelector1< PressureRelationKernel >( numFluidComponents(),
                                                          subRegion.size(),
@@ -1637,15 +1650,24 @@ void CompositionalMultiphaseWell::assemblePressureRelations( real64 const & time
                                                          wellElemTotalMassDens,
                                                          dWellElemTotalMassDens_dPres,
                                                          dWellElemTotalMassDens_dCompDens,
-                                                         controlHasSwitched,
+                                                         wellIndex,
+                                                         controlSwitches,
                                                          localMatrix,
                                                          localRhs );
+    } );
+
+    arrayView1d< integer const > const controlHasSwitched = getControlSwitches();
 
-      if( controlHasSwitched )
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames,
+                                                              [&]( localIndex const wellIndex,
+                                                                   WellElementSubRegion const & subRegion )
+    {
+      if( controlHasSwitched[wellIndex] == 1 )
       {
         // TODO: move the switch logic into wellControls
         // TODO: implement a more general switch when more then two constraints per well type are allowed
 
+        WellControls & wellControls = getWellControls( subRegion );
         real64 const timeAtEndOfStep = time_n + dt;
 
         if( wellControls.getControl() == WellControls::Control::BHP )
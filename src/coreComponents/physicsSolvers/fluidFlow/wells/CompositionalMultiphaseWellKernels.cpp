@@ -298,7 +298,7 @@ FluxKernel::
   arrayView1d< real64 const > const & injection = wellControls.getInjectionStream();
 
   // loop over the well elements to compute the fluxes between elements
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
     // create local work arrays
     real64 compFracUp[NC]{};
@@ -591,7 +591,8 @@ PressureRelationKernel::
           arrayView1d< real64 const > const & wellElemTotalMassDens,
           arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
           arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          bool & controlHasSwitched,
+          localIndex const wellIndex,
+          arrayView1d< integer > const & controlSwitches,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
@@ -629,8 +630,6 @@ PressureRelationKernel::
   real64 const & dCurrentTotalVolRate_dRate =
     wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dRateString() );
 
-  RAJA::ReduceMax< parallelDeviceReduce, localIndex > switchControl( 0 );
-
   // loop over the well elements to compute the pressure relations between well elements
   forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
@@ -651,7 +650,8 @@ PressureRelationKernel::
                                             newControl );
       if( currentControl != newControl )
       {
-        switchControl.max( 1 );
+        // only the well head forms the control equation, the flag is read back once all the wells are assembled
+        controlSwitches[wellIndex] = 1;
       }
 
       ControlEquationHelper::compute< NC >( rankOffset,
@@ -721,7 +721,6 @@ PressureRelationKernel::
       }
     }
   } );
-  controlHasSwitched = ( switchControl.get() == 1 );
 }
 
 #define INST_PressureRelationKernel( NC ) \
@@ -741,7 +740,8 @@ PressureRelationKernel::
                   arrayView1d< real64 const > const & wellElemTotalMassDens, \
                   arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres, \
                   arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens, \
-                  bool & controlHasSwitched, \
+                  localIndex const wellIndex, \
+                  arrayView1d< integer > const & controlSwitches, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                   arrayView1d< real64 > const & localRhs )
 
@@ -1106,7 +1106,7 @@ PerforationKernel::
 {
 
   // loop over the perforations to compute the perforation rates
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
   {
 
     // get the index of the reservoir elem
@@ -1301,7 +1301,7 @@ AccumulationKernel::
 
   using namespace compositionalMultiphaseUtilities;
 
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
 
     if( wellElemGhostRank[iwelem] >= 0 )
@@ -1441,7 +1441,7 @@ VolumeBalanceKernel::
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
 
     if( wellElemGhostRank[iwelem] >= 0 )
@@ -1579,8 +1579,20 @@ PresTempCompFracInitializationKernel::
   // Step 2: we assign average quantities over the well (i.e., over all the ranks)
   // For composition and temperature, we make a distinction between injection and production
 
+  // the sums are gathered in a single buffer to reduce them over the ranks in one collective call
+  stackArray1d< real64, MAX_NUM_COMP + 2 > localSums( numComps + 2 );
+  stackArray1d< real64, MAX_NUM_COMP + 2 > globalSums( numComps + 2 );
+  localSums[0] = sumTotalMassDens.get();
+  localSums[1] = sumTemp.get();
+  for( integer ic = 0; ic < numComps; ++ic )
+  {
+    localSums[ic+2] = sumCompFrac[ic].get();
+  }
+  MpiWrapper::allReduce( localSums.data(), globalSums.data(), numComps + 2,
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOSX );
+
   // for total mass density, we always use the values of the perforated reservoir elements, even for injectors
-  real64 const avgTotalMassDens = MpiWrapper::sum( sumTotalMassDens.get() ) / numPerforations;
+  real64 const avgTotalMassDens = globalSums[0] / numPerforations;
 
   stackArray1d< real64, MAX_NUM_COMP > avgCompFrac( numComps );
   real64 avgTemp = 0;
@@ -1589,12 +1601,12 @@ PresTempCompFracInitializationKernel::
   if( isProducer )
   {
     // use average temperature from reservoir
-    avgTemp = MpiWrapper::sum( sumTemp.get() ) / numPerforations;
+    avgTemp = globalSums[1] / numPerforations;
 
     // use average comp frac from reservoir
     for( integer ic = 0; ic < numComps; ++ic )
     {
-      avgCompFrac[ic] = MpiWrapper::sum( sumCompFrac[ic].get() ) / numPerforations;
+      avgCompFrac[ic] = globalSums[ic+2] / numPerforations;
     }
   }
   // for an injector, we use the injection stream values
@@ -217,7 +217,8 @@ struct PressureRelationKernel
           arrayView1d< real64 const > const & wellElemTotalMassDens,
           arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
           arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          bool & controlHasSwitched,
+          localIndex const wellIndex,
+          arrayView1d< integer > const & controlSwitches,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 
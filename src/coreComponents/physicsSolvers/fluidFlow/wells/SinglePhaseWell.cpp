@@ -476,6 +476,8 @@ void SinglePhaseWell::assembleFluxTerms( real64 const GEOS_UNUSED_PARAM( time_n
                           localRhs );
     } );
 
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 }
 
@@ -495,13 +497,15 @@ void SinglePhaseWell::assemblePressureRelations( real64 const & time_n,
 
     ElementRegionManager const & elemManager = mesh.getElemManager();
 
+    // the control switches are evaluated on device and flagged for each well, the flags are brought back once for all the wells
+    arrayView1d< integer > const controlSwitches = resetControlSwitches( regionNames.size() );
 
     elemManager.forElementSubRegions< WellElementSubRegion >( regionNames,
-                                                              [&]( localIndex const,
+                                                              [&]( localIndex const wellIndex,
                                                                    WellElementSubRegion const & subRegion )
     {
 
-      WellControls & wellControls = getWellControls( subRegion );
+      WellControls const & wellControls = getWellControls( subRegion );
 
       // get the degrees of freedom numbers, depth, next well elem index
       string const wellDofKey = dofManager.getKey( wellElementDofName() );
@@ -522,27 +526,36 @@ void SinglePhaseWell::assemblePressureRelations( real64 const & time_n,
       arrayView2d< real64 const > const & wellElemDensity = fluid.density();
       arrayView2d< real64 const > const & dWellElemDensity_dPres = fluid.dDensity_dPressure();
 
-      localIndex const controlHasSwitched =
-        PressureRelationKernel::launch( subRegion.size(),
-                                        dofManager.rankOffset(),
-                                        subRegion.isLocallyOwned(),
-                                        subRegion.getTopWellElementIndex(),
-                                        wellControls,
-                                        time_n + dt, // controls evaluated with BHP/rate of the end of the time interval
-                                        wellElemDofNumber,
-                                        wellElemGravCoef,
-                                        nextWellElemIndex,
-                                        wellElemPressure,
-                                        wellElemDensity,
-                                        dWellElemDensity_dPres,
-                                        localMatrix,
-                                        localRhs );
-
-      if( controlHasSwitched == 1 )
+      PressureRelationKernel::launch( subRegion.size(),
+                                      dofManager.rankOffset(),
+                                      subRegion.isLocallyOwned(),
+                                      subRegion.getTopWellElementIndex(),
+                                      wellControls,
+                                      time_n + dt, // controls evaluated with BHP/rate of the end of the time interval
+                                      wellElemDofNumber,
+                                      wellElemGravCoef,
+                                      nextWellElemIndex,
+                                      wellElemPressure,
+                                      wellElemDensity,
+                                      dWellElemDensity_dPres,
+                                      wellIndex,
+                                      controlSwitches,
+                                      localMatrix,
+                                      localRhs );
+    } );
+
+    arrayView1d< integer const > const controlHasSwitched = getControlSwitches();
+
+    elemManager.forElementSubRegions< WellElementSubRegion >( regionNames,
+                                                              [&]( localIndex const wellIndex,
+                                                                   WellElementSubRegion const & subRegion )
+    {
+      if( controlHasSwitched[wellIndex] == 1 )
       {
         // Note: if BHP control is not viable, we switch to TOTALVOLRATE
         //       if TOTALVOLRATE is not viable, we switch to BHP
 
+        WellControls & wellControls = getWellControls( subRegion );
         real64 const timeAtEndOfStep = time_n + dt;
 
         if( wellControls.getControl() == WellControls::Control::BHP )
@@ -558,7 +571,6 @@ void SinglePhaseWell::assemblePressureRelations( real64 const & time_n,
                                                         << " from rate constraint to BHP constraint" );
         }
       }
-
     } );
   } );
 }
@@ -607,6 +619,9 @@ void SinglePhaseWell::assembleAccumulationTerms( DomainPartition const & domain,
                                   localRhs );
 
     } );
+
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 
 }
@@ -774,6 +789,9 @@ void SinglePhaseWell::computePerforationRates( DomainPartition & domain )
                                  perfRate,
                                  dPerfRate_dPres );
     } );
+
+    // the kernels of the wells are launched asynchronously, so we wait for all of them at once
+    parallelDeviceSync();
   } );
 }
 
@@ -159,7 +159,7 @@ FluxKernel::
           arrayView1d< real64 > const & localRhs )
 {
   // loop over the well elements to compute the fluxes between elements
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
 
     // 1) Compute the flux and its derivatives
@@ -235,7 +235,7 @@ FluxKernel::
 
 /******************************** PressureRelationKernel ********************************/
 
-localIndex
+void
 PressureRelationKernel::
   launch( localIndex const size,
           globalIndex const rankOffset,
@@ -249,6 +249,8 @@ PressureRelationKernel::
           arrayView1d< real64 const > const & wellElemPressure,
           arrayView2d< real64 const > const & wellElemDensity,
           arrayView2d< real64 const > const & dWellElemDensity_dPres,
+          localIndex const wellIndex,
+          arrayView1d< integer > const & controlSwitches,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
@@ -271,8 +273,6 @@ PressureRelationKernel::
   real64 const & dCurrentVolRate_dRate =
     wellControls.getReference< real64 >( SinglePhaseWell::viewKeyStruct::dCurrentVolRate_dRateString() );
 
-  RAJA::ReduceMax< parallelDeviceReduce, localIndex > switchControl( 0 );
-
   // loop over the well elements to compute the pressure relations between well elements
   forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
@@ -291,7 +291,8 @@ PressureRelationKernel::
                                             newControl );
       if( currentControl != newControl )
       {
-        switchControl.max( 1 );
+        // only the well head forms the control equation, the flag is read back once all the wells are assembled
+        controlSwitches[wellIndex] = 1;
       }
 
       ControlEquationHelper::compute( rankOffset,
@@ -348,7 +349,6 @@ PressureRelationKernel::
       }
     }
   } );
-  return switchControl.get();
 }
 
 /******************************** PerforationKernel ********************************/
@@ -481,7 +481,7 @@ PerforationKernel::
           arrayView2d< real64 > const & dPerfRate_dPres )
 {
 
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
   {
 
     // get the reservoir (sub)region and element indices
@@ -528,7 +528,7 @@ AccumulationKernel::
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  forAll< parallelDeviceAsyncPolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
   {
 
     if( wellElemGhostRank[iwelem] >= 0 )
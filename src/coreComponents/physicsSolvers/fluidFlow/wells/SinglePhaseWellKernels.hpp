@@ -138,7 +138,7 @@ struct PressureRelationKernel
   using COFFSET = singlePhaseWellKernels::ColOffset;
   using TAG = singlePhaseWellKernels::ElemTag;
 
-  static localIndex
+  static void
   launch( localIndex const size,
           globalIndex const rankOffset,
           bool const isLocallyOwned,
@@ -151,6 +151,8 @@ struct PressureRelationKernel
           arrayView1d< real64 const > const & wellElemPressure,
           arrayView2d< real64 const > const & wellElemDensity,
           arrayView2d< real64 const > const & dWellElemDensity_dPres,
+          localIndex const wellIndex,
+          arrayView1d< integer > const & controlSwitches,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 
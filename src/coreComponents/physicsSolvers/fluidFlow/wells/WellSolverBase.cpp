@@ -264,6 +264,20 @@ void WellSolverBase::precomputeData( DomainPartition & domain )
   } );
 }
 
+arrayView1d< integer > WellSolverBase::resetControlSwitches( localIndex const numWells )
+{
+  m_controlSwitches.resize( numWells );
+  m_controlSwitches.setValues< parallelDevicePolicy<> >( 0 );
+  return m_controlSwitches.toView();
+}
+
+arrayView1d< integer const > WellSolverBase::getControlSwitches()
+{
+  // single device-to-host copy for all the wells of the mesh level
+  m_controlSwitches.move( hostMemorySpace, false );
+  return m_controlSwitches.toViewConst();
+}
+
 WellControls & WellSolverBase::getWellControls( WellElementSubRegion const & subRegion )
 { return this->getGroup< WellControls >( subRegion.getWellControlsName() ); }
 
@@ -303,6 +303,19 @@ protected:
                            real64 const & dt,
                            DomainPartition & domain ) = 0;
 
+  /**
+   * @brief Reset the flags signaling the control switches of the wells of a mesh level
+   * @param numWells the number of target well regions of the mesh level
+   * @return a view of the flags, set on device by the pressure relation kernels at the position of the well in the target regions
+   */
+  arrayView1d< integer > resetControlSwitches( localIndex const numWells );
+
+  /**
+   * @brief Bring the flags signaling the control switches back to host, once the pressure relations of all the wells are assembled
+   * @return a host view of the flags, equal to 1 for the wells whose control has switched
+   */
+  arrayView1d< integer const > getControlSwitches();
+
   /// name of the flow solver
   string m_flowSolverName;
 
@@ -314,6 +327,9 @@ protected:
 
   string const m_ratesOutputDir;
 
+  /// flags signaling the control switches of the wells, copied back to host once per assembly instead of once per well
+  array1d< integer > m_controlSwitches;
+
 };
 
 }
@@ -74,7 +74,8 @@ addCouplingNumNonzeros( SolverBase const * const solver,
         perforationData->getField< fields::perforation::reservoirElementIndex >();
 
       // Loop over perforations and increase row lengths for reservoir and well elements accordingly
-      forAll< serialPolicy >( perforationData->size(), [=] ( localIndex const iperf )
+      // (several perforations may share a reservoir or a well element, hence the atomics)
+      forAll< parallelHostPolicy >( perforationData->size(), [=] ( localIndex const iperf )
       {
         // get the reservoir (sub)region and element indices
         localIndex const er = resElementRegion[iperf];
@@ -90,7 +91,7 @@ addCouplingNumNonzeros( SolverBase const * const solver,
 
           for( integer idof = 0; idof < resNumDof; ++idof )
           {
-            rowLengths[localRow + idof] += wellNumDof;
+            RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localRow + idof], wellNumDof );
           }
         }
 
@@ -102,7 +103,7 @@ addCouplingNumNonzeros( SolverBase const * const solver,
 
           for( integer idof = 0; idof < wellNumDof; ++idof )
           {
-            rowLengths[localRow + idof] += resNumDof;
+            RAJA::atomicAdd( parallelHostAtomic{}, &rowLengths[localRow + idof], resNumDof );
           }
         }
       } );
@@ -21,6 +21,7 @@
 #define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_COUPLEDSOLVER_HPP_
 
 #include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/multiphysics/SequentialCouplingAccelerator.hpp"
 
 #include <tuple>
 
@@ -399,6 +400,12 @@ protected:
     integer & iter = solverParams.m_numNewtonIterations;
     iter = 0;
     bool isConverged = false;
+    bool const useAcceleration = solverParams.m_subcyclingOption != 0 &&
+                                 solverParams.sequentialAcceleration() != NonlinearSolverParameters::SequentialAcceleration::None;
+    if( useAcceleration )
+    {
+      m_sequentialAccelerator.setParameters( solverParams.sequentialAcceleration(), solverParams.m_sequentialAccelerationDepth );
+    }
     /// Sequential coupling loop
     while( iter < solverParams.m_maxIterNewton )
     {
@@ -411,6 +418,12 @@ protected:
           solver->getSolverStatistics().initializeTimeStepStatistics(); // initialize counters for subsolvers
         } );
         resetStateToBeginningOfStep( domain );
+
+        if( useAcceleration )
+        {
+          gatherSequentialIterate( domain, m_sequentialIterate, m_sequentialIterateGhostRank );
+          m_sequentialAccelerator.reset( m_sequentialIterate.toViewConst(), m_sequentialIterateGhostRank.toViewConst() );
+        }
       }
 
       // Increment the solver statistics for reporting purposes
@@ -426,6 +439,14 @@ protected:
                                                            cycleNumber,
                                                            domain );
 
+        // the fixed-point map runs from the output of the first solver to its output at the next iteration
+        if( useAcceleration && idx() == 0 )
+        {
+          gatherSequentialIterate( domain, m_sequentialIterate, m_sequentialIterateGhostRank );
+          m_sequentialAccelerator.accelerate( m_sequentialIterate.toView() );
+          scatterSequentialIterate( domain, m_sequentialIterate.toViewConst() );
+        }
+
         mapSolutionBetweenSolvers( domain, idx() );
 
         if( dtReturnTemporary < dtReturn )
@@ -472,6 +493,34 @@ protected:
     GEOS_UNUSED_VAR( domain, solverType );
   }
 
+  /**
+   * @brief Collect the variables computed by the first solver, which are accelerated in sequential schemes
+   * @param domain the domain partition
+   * @param iterate the values of the variables, including the ghosted ones
+   * @param ghostRank the ghost rank of each value
+   */
+  virtual void gatherSequentialIterate( DomainPartition & domain,
+                                        array1d< real64 > & iterate,
+                                        array1d< integer > & ghostRank ) const
+  {
+    GEOS_UNUSED_VAR( domain, iterate, ghostRank );
+    GEOS_ERROR( getDataContext() << ": " << NonlinearSolverParameters::viewKeysStruct::sequentialAccelerationString() <<
+                " is not supported by this coupled solver" );
+  }
+
+  /**
+   * @brief Overwrite the variables computed by the first solver with their accelerated values
+   * @param domain the domain partition
+   * @param iterate the values of the variables, in the order of gatherSequentialIterate
+   *
+   * Implementations are responsible for updating the quantities that depend on the variables.
+   */
+  virtual void scatterSequentialIterate( DomainPartition & domain,
+                                         arrayView1d< real64 const > const & iterate )
+  {
+    GEOS_UNUSED_VAR( domain, iterate );
+  }
+
   bool checkSequentialConvergence( int const & iter,
                                    real64 const & time_n,
                                    real64 const & dt,
@@ -588,6 +637,15 @@ protected:
 
   /// Names of the single-physics solvers
   std::array< string, sizeof...( SOLVERS ) > m_names;
+
+  /// Acceleration of the outer loop of the sequential scheme
+  SequentialCouplingAccelerator m_sequentialAccelerator;
+
+  /// Variables of the first solver accelerated in the sequential scheme
+  array1d< real64 > m_sequentialIterate;
+
+  /// Ghost rank of each of the accelerated variables
+  array1d< integer > m_sequentialIterateGhostRank;
 };
 
 } /* namespace geos */
@@ -52,21 +52,30 @@ void FlowProppantTransportSolver::preStepUpdate( real64 const & time_n,
     } );
   }
 
-  flowSolver()->setupSystem( domain,
-                             flowSolver()->getDofManager(),
-                             flowSolver()->getLocalMatrix(),
-                             flowSolver()->getSystemRhs(),
-                             flowSolver()->getSystemSolution() );
+  // Only rebuild the sparsity patterns if the mesh has changed, the matrix values are zeroed during assembly
+  Timestamp const meshModificationTimestamp = getMeshModificationTimestamp( domain );
 
+  if( meshModificationTimestamp > flowSolver()->getSystemSetupTimestamp() )
+  {
+    flowSolver()->setupSystem( domain,
+                               flowSolver()->getDofManager(),
+                               flowSolver()->getLocalMatrix(),
+                               flowSolver()->getSystemRhs(),
+                               flowSolver()->getSystemSolution() );
+    flowSolver()->setSystemSetupTimestamp( meshModificationTimestamp );
+  }
 
   flowSolver()->implicitStepSetup( time_n, dt, domain );
 
-  proppantTransportSolver()->setupSystem( domain,
-                                          proppantTransportSolver()->getDofManager(),
-                                          proppantTransportSolver()->getLocalMatrix(),
-                                          proppantTransportSolver()->getSystemRhs(),
-                                          proppantTransportSolver()->getSystemSolution() );
-
+  if( meshModificationTimestamp > proppantTransportSolver()->getSystemSetupTimestamp() )
+  {
+    proppantTransportSolver()->setupSystem( domain,
+                                            proppantTransportSolver()->getDofManager(),
+                                            proppantTransportSolver()->getLocalMatrix(),
+                                            proppantTransportSolver()->getSystemRhs(),
+                                            proppantTransportSolver()->getSystemSolution() );
+    proppantTransportSolver()->setSystemSetupTimestamp( meshModificationTimestamp );
+  }
 
   proppantTransportSolver()->implicitStepSetup( time_n, dt, domain );
 
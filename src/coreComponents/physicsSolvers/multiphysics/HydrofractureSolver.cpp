@@ -427,12 +427,15 @@ void HydrofractureSolver< POROMECHANICS_SOLVER >::setupSystem( DomainPartition &
   SparsityPattern< globalIndex > patternOriginal;
   dofManager.setSparsityPattern( patternOriginal );
 
+  SparsityPatternView< globalIndex const > const patternOriginalView = patternOriginal.toViewConst();
+
   // Get the original row lengths (diagonal blocks only)
   array1d< localIndex > rowLengths( patternOriginal.numRows() );
-  for( localIndex localRow = 0; localRow < patternOriginal.numRows(); ++localRow )
+  arrayView1d< localIndex > const rowLengthsView = rowLengths.toView();
+  forAll< parallelHostPolicy >( patternOriginal.numRows(), [=]( localIndex const localRow )
   {
-    rowLengths[localRow] = patternOriginal.numNonZeros( localRow );
-  }
+    rowLengthsView[localRow] = patternOriginalView.numNonZeros( localRow );
+  } );
 
   // Add the number of nonzeros induced by coupling
   addFluxApertureCouplingNNZ( domain, dofManager, rowLengths.toView() );
@@ -443,12 +446,13 @@ void HydrofractureSolver< POROMECHANICS_SOLVER >::setupSystem( DomainPartition &
                                                          patternOriginal.numColumns(),
                                                          rowLengths.data() );
 
-  // Copy the original nonzeros
-  for( localIndex localRow = 0; localRow < patternOriginal.numRows(); ++localRow )
+  // Copy the original nonzeros, the capacity of each row is already sufficient so the rows can be filled concurrently
+  SparsityPatternView< globalIndex > const patternView = pattern.toView();
+  forAll< parallelHostPolicy >( patternOriginal.numRows(), [=]( localIndex const localRow )
   {
-    globalIndex const * cols = patternOriginal.getColumns( localRow ).dataIfContiguous();
-    pattern.insertNonZeros( localRow, cols, cols + patternOriginal.numNonZeros( localRow ) );
-  }
+    globalIndex const * cols = patternOriginalView.getColumns( localRow ).dataIfContiguous();
+    patternView.insertNonZeros( localRow, cols, cols + patternOriginalView.numNonZeros( localRow ) );
+  } );
 
   // Add the nonzeros from coupling
   addFluxApertureCouplingSparsityPattern( domain, dofManager, pattern.toView() );
@@ -19,6 +19,7 @@
 
 #include "PhaseFieldFractureSolver.hpp"
 
+#include "common/MpiWrapper.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "finiteElement/Kinematics.h"
@@ -57,6 +58,8 @@ void PhaseFieldFractureSolver::mapSolutionBetweenSolvers( DomainPartition & doma
   GEOS_MARK_FUNCTION;
   if( solverType ==  static_cast< integer >( SolverType::Damage ) )
   {
+    real64 maxDamageChange = 0.0;
+
     forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                   MeshLevel & mesh,
                                                                   arrayView1d< string const > const & regionNames )
@@ -73,7 +76,7 @@ void PhaseFieldFractureSolver::mapSolutionBetweenSolvers( DomainPartition & doma
       ElementRegionManager & elemManager = mesh.getElemManager();
 
       // begin region loop
-      elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [discretizationName, nodalDamage]
+      elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [discretizationName, nodalDamage, &maxDamageChange]
                                                                   ( localIndex const,
                                                                   CellElementSubRegion & elementSubRegion )
       {
@@ -81,7 +84,7 @@ void PhaseFieldFractureSolver::mapSolutionBetweenSolvers( DomainPartition & doma
         constitutive::SolidBase &
         solidModel = elementSubRegion.getConstitutiveModel< constitutive::SolidBase >( solidModelName );
 
-        ConstitutivePassThru< DamageBase >::execute( solidModel, [&elementSubRegion, discretizationName, nodalDamage]( auto & damageModel )
+        ConstitutivePassThru< DamageBase >::execute( solidModel, [&elementSubRegion, discretizationName, nodalDamage, &maxDamageChange]( auto & damageModel )
         {
           using CONSTITUTIVE_TYPE = TYPEOFREF( damageModel );
           typename CONSTITUTIVE_TYPE::KernelWrapper constitutiveUpdate = damageModel.createKernelUpdates();
@@ -92,17 +95,29 @@ void PhaseFieldFractureSolver::mapSolutionBetweenSolvers( DomainPartition & doma
           finiteElement::FiniteElementBase const &
           fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( discretizationName );
 
-          finiteElement::FiniteElementDispatchHandler< ALL_FE_TYPES >::dispatch3D( fe, [=, &elementSubRegion] ( auto & finiteElement )
+          finiteElement::FiniteElementDispatchHandler< ALL_FE_TYPES >::dispatch3D( fe, [=, &elementSubRegion, &maxDamageChange] ( auto & finiteElement )
           {
             using FE_TYPE = TYPEOFREF( finiteElement );
 
             DamageInterpolationKernel< FE_TYPE > interpolationKernel( elementSubRegion );
 
-            interpolationKernel.interpolateDamage( elemToNodes, nodalDamage, damageFieldOnMaterial );
+            maxDamageChange = LvArray::math::max( maxDamageChange,
+                                                  interpolationKernel.interpolateDamage( elemToNodes, nodalDamage, damageFieldOnMaterial ) );
           } );
         } );
       } );
     } );
+
+    // the Jacobian of the mechanics depends on the damage, so that a preconditioner reused within the step is outdated
+    if( MpiWrapper::max( maxDamageChange ) > 0.0 )
+    {
+      solidMechanicsSolver()->expireReusedPreconditioner();
+    }
+  }
+  else if( solverType == static_cast< integer >( SolverType::SolidMechanics ) )
+  {
+    // the mechanics updates the strain energy history driving the damage, hence the Jacobian of the damage
+    damageSolver()->expireReusedPreconditioner();
   }
 }
 
@@ -97,10 +97,19 @@ struct DamageInterpolationKernel
     m_numElems( subRegion.size() )
   {}
 
-  void interpolateDamage( arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes,
-                          arrayView1d< real64 const > const nodalDamage,
-                          arrayView2d< real64 > damageFieldOnMaterial )
+  /**
+   * @brief Interpolate the nodal damage to the quadrature points of the material
+   * @param elemToNodes the element-to-node map
+   * @param nodalDamage the nodal damage
+   * @param damageFieldOnMaterial the damage at the quadrature points
+   * @return the largest change of the damage at the quadrature points of the subregion
+   */
+  real64 interpolateDamage( arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes,
+                            arrayView1d< real64 const > const nodalDamage,
+                            arrayView2d< real64 > damageFieldOnMaterial )
   {
+    RAJA::ReduceMax< ReducePolicy< parallelDevicePolicy<> >, real64 > maxDamageChange( 0.0 );
+
     forAll< parallelDevicePolicy<> >( m_numElems, [=] GEOS_HOST_DEVICE ( localIndex const k )
     {
       constexpr localIndex numNodesPerElement = FE_TYPE::numNodes;
@@ -111,17 +120,21 @@ struct DamageInterpolationKernel
         real64 N[ numNodesPerElement ];
         FE_TYPE::calcN( q, N );
 
-        damageFieldOnMaterial( k, q ) = 0;
+        real64 damage = 0;
         for( localIndex a = 0; a < numNodesPerElement; ++a )
         {
-          damageFieldOnMaterial( k, q ) += N[a] * nodalDamage[elemToNodes( k, a )];
+          damage += N[a] * nodalDamage[elemToNodes( k, a )];
           //solution is probably not going to work because the solution of the coupled solver
           //has both damage and displacements. Using the damageResult field from the Damage solver
           //is probably better
         }
+        maxDamageChange.max( LvArray::math::abs( damage - damageFieldOnMaterial( k, q ) ) );
+        damageFieldOnMaterial( k, q ) = damage;
       }
 
     } );
+
+    return maxDamageChange.get();
   }
 
   localIndex m_numElems;
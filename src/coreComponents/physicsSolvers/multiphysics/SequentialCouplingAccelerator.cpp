@@ -0,0 +1,214 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SequentialCouplingAccelerator.cpp
+ */
+
+#include "SequentialCouplingAccelerator.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/MpiWrapper.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+
+namespace geos
+{
+
+void SequentialCouplingAccelerator::setParameters( AccelerationType const type, integer const depth )
+{
+  m_type = type;
+  m_depth = LvArray::math::max( depth, 1 );
+}
+
+void SequentialCouplingAccelerator::reset( arrayView1d< real64 const > const & iterate,
+                                           arrayView1d< integer const > const & ghostRank )
+{
+  iterate.move( hostMemorySpace, false );
+  ghostRank.move( hostMemorySpace, false );
+
+  localIndex const n = iterate.size();
+  m_iterate.resize( n );
+  m_ghostRank.resize( n );
+  m_previousResidual.resize( n );
+  m_previousOutput.resize( n );
+  for( localIndex i = 0; i < n; ++i )
+  {
+    m_iterate[i] = iterate[i];
+    m_ghostRank[i] = ghostRank[i];
+  }
+
+  if( m_type == AccelerationType::Anderson )
+  {
+    m_residualDifferences.resize( m_depth, n );
+    m_outputDifferences.resize( m_depth, n );
+  }
+
+  m_numDifferences = 0;
+  m_nextDifference = 0;
+  m_numIterations = 0;
+  m_relaxation = 1.0;
+}
+
+real64 SequentialCouplingAccelerator::dot( arrayView1d< real64 const > const & x,
+                                           arrayView1d< real64 const > const & y ) const
+{
+  real64 localDot = 0.0;
+  for( localIndex i = 0; i < x.size(); ++i )
+  {
+    if( m_ghostRank[i] < 0 )
+    {
+      localDot += x[i] * y[i];
+    }
+  }
+  return MpiWrapper::sum( localDot );
+}
+
+void SequentialCouplingAccelerator::accelerate( arrayView1d< real64 > const & iterate )
+{
+  if( m_type == AccelerationType::None )
+  {
+    return;
+  }
+
+  GEOS_ERROR_IF_NE_MSG( iterate.size(), m_iterate.size(),
+                        "The size of the sequential iterate changed since the beginning of the time step" );
+
+  iterate.move( hostMemorySpace, true );
+  localIndex const n = iterate.size();
+
+  // residual of the fixed-point map, f_k = G( x_k ) - x_k
+  array1d< real64 > residual( n );
+  for( localIndex i = 0; i < n; ++i )
+  {
+    residual[i] = iterate[i] - m_iterate[i];
+  }
+
+  if( m_type == AccelerationType::Aitken )
+  {
+    // Irons-Tuck form of the Aitken relaxation:
+    // omega_k = -omega_{k-1} * f_{k-1} . ( f_k - f_{k-1} ) / || f_k - f_{k-1} ||^2
+    if( m_numIterations > 0 )
+    {
+      array1d< real64 > residualDifference( n );
+      for( localIndex i = 0; i < n; ++i )
+      {
+        residualDifference[i] = residual[i] - m_previousResidual[i];
+      }
+      real64 const denominator = dot( residualDifference.toViewConst(), residualDifference.toViewConst() );
+      if( denominator > 0.0 )
+      {
+        m_relaxation = -m_relaxation * dot( m_previousResidual.toViewConst(), residualDifference.toViewConst() ) / denominator;
+      }
+    }
+    for( localIndex i = 0; i < n; ++i )
+    {
+      m_previousResidual[i] = residual[i];
+      iterate[i] = m_iterate[i] + m_relaxation * residual[i];
+    }
+  }
+  else
+  {
+    if( m_numIterations > 0 )
+    {
+      for( localIndex i = 0; i < n; ++i )
+      {
+        m_residualDifferences[m_nextDifference][i] = residual[i] - m_previousResidual[i];
+        m_outputDifferences[m_nextDifference][i] = iterate[i] - m_previousOutput[i];
+      }
+      m_nextDifference = ( m_nextDifference + 1 ) % m_depth;
+      m_numDifferences = LvArray::math::min( m_numDifferences + 1, m_depth );
+    }
+    for( localIndex i = 0; i < n; ++i )
+    {
+      m_previousResidual[i] = residual[i];
+      m_previousOutput[i] = iterate[i];
+    }
+    andersonUpdate( iterate );
+  }
+
+  for( localIndex i = 0; i < n; ++i )
+  {
+    m_iterate[i] = iterate[i];
+  }
+  ++m_numIterations;
+}
+
+void SequentialCouplingAccelerator::andersonUpdate( arrayView1d< real64 > const & iterate )
+{
+  integer const m = m_numDifferences;
+  if( m == 0 )
+  {
+    return;
+  }
+
+  localIndex const n = iterate.size();
+
+  // normal equations of min || f_k - dF gamma ||, with all the dot products reduced at once
+  array1d< real64 > localProducts( m * m + m );
+  for( integer a = 0; a < m; ++a )
+  {
+    for( localIndex i = 0; i < n; ++i )
+    {
+      if( m_ghostRank[i] >= 0 )
+      {
+        continue;
+      }
+      for( integer b = 0; b <= a; ++b )
+      {
+        localProducts[a * m + b] += m_residualDifferences[a][i] * m_residualDifferences[b][i];
+      }
+      localProducts[m * m + a] += m_residualDifferences[a][i] * m_previousResidual[i];
+    }
+  }
+  array1d< real64 > products( m * m + m );
+  MpiWrapper::allReduce( localProducts.data(), products.data(), m * m + m,
+                         MpiWrapper::getMpiOp( MpiWrapper::Reduction::Sum ), MPI_COMM_GEOSX );
+
+  array2d< real64 > normalMatrix( m, m );
+  array1d< real64 > rhs( m );
+  array1d< real64 > gamma( m );
+  real64 trace = 0.0;
+  for( integer a = 0; a < m; ++a )
+  {
+    for( integer b = 0; b <= a; ++b )
+    {
+      normalMatrix[a][b] = products[a * m + b];
+      normalMatrix[b][a] = products[a * m + b];
+    }
+    rhs[a] = products[m * m + a];
+    trace += normalMatrix[a][a];
+  }
+  if( trace <= 0.0 )
+  {
+    return;
+  }
+
+  // a small Tikhonov regularization keeps the system solvable when the differences become colinear
+  for( integer a = 0; a < m; ++a )
+  {
+    normalMatrix[a][a] += 1e-10 * trace / m;
+  }
+  BlasLapackLA::solveLinearSystem( normalMatrix.toSliceConst(), rhs.toSliceConst(), gamma.toSlice() );
+
+  // x_{k+1} = G( x_k ) - dG gamma
+  for( integer a = 0; a < m; ++a )
+  {
+    for( localIndex i = 0; i < n; ++i )
+    {
+      iterate[i] -= gamma[a] * m_outputDifferences[a][i];
+    }
+  }
+}
+
+} /* namespace geos */
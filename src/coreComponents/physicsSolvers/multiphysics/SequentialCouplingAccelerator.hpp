@@ -0,0 +1,119 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SequentialCouplingAccelerator.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_MULTIPHYSICS_SEQUENTIALCOUPLINGACCELERATOR_HPP_
+#define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_SEQUENTIALCOUPLINGACCELERATOR_HPP_
+
+#include "physicsSolvers/NonlinearSolverParameters.hpp"
+
+namespace geos
+{
+
+/**
+ * @class SequentialCouplingAccelerator
+ * @brief Acceleration of the fixed-point iteration x_{k+1} = G( x_k ) of a sequentially coupled solver
+ *
+ * The iterate is a distributed vector assembled by the coupled solver, including ghosted values.
+ * Only the locally owned values enter the dot products, and since the ghosted values are updated
+ * with the same (global) coefficients, they stay consistent without a synchronization.
+ */
+class SequentialCouplingAccelerator
+{
+public:
+
+  /// Type of acceleration
+  using AccelerationType = NonlinearSolverParameters::SequentialAcceleration;
+
+  /**
+   * @brief Set the type of acceleration
+   * @param type the type of acceleration
+   * @param depth the number of previous iterations used by the Anderson acceleration
+   */
+  void setParameters( AccelerationType const type, integer const depth );
+
+  /**
+   * @brief Start a new sequence of iterations
+   * @param iterate the initial iterate x_0
+   * @param ghostRank the ghost rank of each value of the iterate
+   */
+  void reset( arrayView1d< real64 const > const & iterate,
+              arrayView1d< integer const > const & ghostRank );
+
+  /**
+   * @brief Replace the output of the fixed-point map by the accelerated iterate
+   * @param[inout] iterate on input, G( x_k ), on output, x_{k+1}
+   */
+  void accelerate( arrayView1d< real64 > const & iterate );
+
+private:
+
+  /**
+   * @brief Dot product over the locally owned values, reduced over all ranks
+   * @param x the first vector
+   * @param y the second vector
+   * @return the dot product
+   */
+  real64 dot( arrayView1d< real64 const > const & x,
+              arrayView1d< real64 const > const & y ) const;
+
+  /**
+   * @brief Compute the Anderson update from the stored differences
+   * @param[inout] iterate on input, G( x_k ), on output, x_{k+1}
+   */
+  void andersonUpdate( arrayView1d< real64 > const & iterate );
+
+  /// Type of acceleration
+  AccelerationType m_type = AccelerationType::None;
+
+  /// Maximum number of stored differences for the Anderson acceleration
+  integer m_depth = 0;
+
+  /// Ghost rank of each value of the iterate
+  array1d< integer > m_ghostRank;
+
+  /// Input of the fixed-point map at the current iteration, x_k
+  array1d< real64 > m_iterate;
+
+  /// Residual of the previous iteration, G( x_{k-1} ) - x_{k-1}
+  array1d< real64 > m_previousResidual;
+
+  /// Output of the fixed-point map at the previous iteration, G( x_{k-1} )
+  array1d< real64 > m_previousOutput;
+
+  /// Differences between successive residuals, one row per stored iteration
+  array2d< real64 > m_residualDifferences;
+
+  /// Differences between successive outputs of the fixed-point map, one row per stored iteration
+  array2d< real64 > m_outputDifferences;
+
+  /// Number of stored differences
+  integer m_numDifferences = 0;
+
+  /// Row in which the next differences are stored
+  integer m_nextDifference = 0;
+
+  /// Number of iterations since the last reset
+  integer m_numIterations = 0;
+
+  /// Relaxation factor of the Aitken acceleration
+  real64 m_relaxation = 1.0;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_PHYSICSSOLVERS_MULTIPHYSICS_SEQUENTIALCOUPLINGACCELERATOR_HPP_ */
@@ -23,6 +23,7 @@
 #include "constitutive/solid/PorousSolid.hpp"
 #include "constitutive/fluid/singlefluid/SingleFluidBase.hpp"
 #include "linearAlgebra/solvers/BlockPreconditioner.hpp"
+#include "linearAlgebra/solvers/KrylovPreconditioner.hpp"
 #include "linearAlgebra/solvers/SeparateComponentPreconditioner.hpp"
 #include "mesh/utilities/AverageOverQuadraturePointsKernel.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBase.hpp"
@@ -344,19 +345,44 @@ void SinglePhasePoromechanics::createPreconditioner()
 {
   if( m_linearSolverParameters.get().preconditionerType == LinearSolverParameters::PreconditionerType::block )
   {
+    LinearSolverParameters const & mechParams = solidMechanicsSolver()->getLinearSolverParameters();
+    LinearSolverParameters const & flowParams = flowSolver()->getLinearSolverParameters();
+
+    GEOS_THROW_IF( m_linearSolverParameters.get().preconditionerSinglePrecision,
+                   GEOS_FMT( "{}: the block preconditioner does not support single precision", getDataContext() ),
+                   InputError );
+
+    // an inner Krylov solve makes the preconditioner change from one outer iteration to the next
+    GEOS_THROW_IF( ( mechParams.krylov.innerSolve || flowParams.krylov.innerSolve ) &&
+                   m_linearSolverParameters.get().solverType != LinearSolverParameters::SolverType::fgmres,
+                   GEOS_FMT( "{}: the inner Krylov solves of the blocks require the `fgmres` outer solver", getDataContext() ),
+                   InputError );
+
+    // the block is either solved with a Krylov method, or preconditioned once
+    auto makeBlockSolver = []( LinearSolverParameters const & params,
+                               std::unique_ptr< PreconditionerBase< LAInterface > > blockPrecond ) -> std::unique_ptr< PreconditionerBase< LAInterface > >
+    {
+      if( params.krylov.innerSolve )
+      {
+        return std::make_unique< KrylovPreconditioner< LAInterface > >( params, std::move( blockPrecond ) );
+      }
+      return blockPrecond;
+    };
+
     auto precond = std::make_unique< BlockPreconditioner< LAInterface > >( BlockShapeOption::UpperTriangular,
                                                                            SchurComplementOption::RowsumDiagonalProbing,
                                                                            BlockScalingOption::FrobeniusNorm );
 
-    auto mechPrecond = LAInterface::createPreconditioner( solidMechanicsSolver()->getLinearSolverParameters() );
+    auto mechPrecond = LAInterface::createPreconditioner( mechParams );
     precond->setupBlock( 0,
                          { { solidMechanics::totalDisplacement::key(), { 3, true } } },
-                         std::make_unique< SeparateComponentPreconditioner< LAInterface > >( 3, std::move( mechPrecond ) ) );
+                         makeBlockSolver( mechParams,
+                                          std::make_unique< SeparateComponentPreconditioner< LAInterface > >( 3, std::move( mechPrecond ) ) ) );
 
-    auto flowPrecond = LAInterface::createPreconditioner( flowSolver()->getLinearSolverParameters() );
+    auto flowPrecond = LAInterface::createPreconditioner( flowParams );
     precond->setupBlock( 1,
                          { { flow::pressure::key(), { 1, true } } },
-                         std::move( flowPrecond ) );
+                         makeBlockSolver( flowParams, std::move( flowPrecond ) ) );
 
     m_precond = std::move( precond );
   }
@@ -381,10 +407,6 @@ void SinglePhasePoromechanics::updateState( DomainPartition & domain )
                                                                    CellElementSubRegion & subRegion )
     {
       flowSolver()->updateFluidState( subRegion );
-      if( m_isThermal )
-      {
-        flowSolver()->updateSolidInternalEnergyModel( subRegion );
-      }
     } );
   } );
 }
@@ -438,6 +460,87 @@ void SinglePhasePoromechanics::mapSolutionBetweenSolvers( DomainPartition & doma
   }
 }
 
+void SinglePhasePoromechanics::gatherSequentialIterate( DomainPartition & domain,
+                                                       array1d< real64 > & iterate,
+                                                       array1d< integer > & ghostRank ) const
+{
+  integer const numVarsPerElem = m_isThermal ? 2 : 1;
+
+  localIndex size = 0;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel const & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion const & subRegion )
+    {
+      size += numVarsPerElem * subRegion.size();
+    } );
+  } );
+  iterate.resize( size );
+  ghostRank.resize( size );
+
+  localIndex offset = 0;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel const & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion const & subRegion )
+    {
+      arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+      arrayView1d< real64 const > const temp = subRegion.getField< fields::flow::temperature >();
+      arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+      pres.move( hostMemorySpace, false );
+      temp.move( hostMemorySpace, false );
+      elemGhostRank.move( hostMemorySpace, false );
+
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        iterate[offset] = pres[ei];
+        ghostRank[offset++] = elemGhostRank[ei];
+        if( m_isThermal )
+        {
+          iterate[offset] = temp[ei];
+          ghostRank[offset++] = elemGhostRank[ei];
+        }
+      }
+    } );
+  } );
+}
+
+void SinglePhasePoromechanics::scatterSequentialIterate( DomainPartition & domain,
+                                                        arrayView1d< real64 const > const & iterate )
+{
+  localIndex offset = 0;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                          CellElementSubRegion & subRegion )
+    {
+      arrayView1d< real64 > const pres = subRegion.getField< fields::flow::pressure >();
+      arrayView1d< real64 > const temp = subRegion.getField< fields::flow::temperature >();
+      pres.move( hostMemorySpace, true );
+      temp.move( hostMemorySpace, true );
+
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        pres[ei] = iterate[offset++];
+        if( m_isThermal )
+        {
+          temp[ei] = iterate[offset++];
+        }
+      }
+
+      // the quantities computed by the flow solver must be consistent with the accelerated pressure and temperature
+      flowSolver()->updatePorosityAndPermeability( subRegion );
+      flowSolver()->updateFluidState( subRegion );
+    } );
+  } );
+}
+
 void SinglePhasePoromechanics::updateBulkDensity( ElementSubRegionBase & subRegion )
 {
   // get the fluid model (to access fluid density)
@@ -128,6 +128,13 @@ public:
 
   virtual void mapSolutionBetweenSolvers( DomainPartition & Domain, integer const idx ) override final;
 
+  virtual void gatherSequentialIterate( DomainPartition & domain,
+                                        array1d< real64 > & iterate,
+                                        array1d< integer > & ghostRank ) const override;
+
+  virtual void scatterSequentialIterate( DomainPartition & domain,
+                                         arrayView1d< real64 const > const & iterate ) override;
+
   struct viewKeyStruct : Base::viewKeyStruct
   {
     /// Names of the porous materials
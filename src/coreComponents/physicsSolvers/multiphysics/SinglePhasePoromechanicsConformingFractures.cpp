@@ -495,7 +495,6 @@ void SinglePhasePoromechanicsConformingFractures::
   ElementRegionManager const & elemManager = mesh.getElemManager();
 
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
-  arrayView2d< real64 const > const & faceNormal = faceManager.faceNormal();
 
   string const & dispDofKey = dofManager.getKey( solidMechanics::totalDisplacement::key() );
   string const & presDofKey = dofManager.getKey( m_pressureKey );
@@ -515,17 +514,16 @@ void SinglePhasePoromechanicsConformingFractures::
     presDofNumber = subRegion.getReference< globalIndex_array >( presDofKey );
     arrayView1d< real64 const > const & pressure = subRegion.getReference< array1d< real64 > >( flow::pressure::key() );
     ArrayOfArraysView< localIndex const > const & elemsToFaces = subRegion.faceList().toViewConst();
+    arrayView3d< real64 const > const & rotationMatrix =
+      subRegion.getReference< array3d< real64 > >( LagrangianContactSolver::viewKeyStruct::rotationMatrixString() );
 
-    forAll< serialPolicy >( subRegion.size(), [=]( localIndex const kfe )
+    forAll< parallelHostPolicy >( subRegion.size(), [=]( localIndex const kfe )
     {
       localIndex const kf0 = elemsToFaces[kfe][0];
       localIndex const numNodesPerFace = faceToNodeMap.sizeOfArray( kf0 );
 
-      real64 Nbar[3];
-      Nbar[ 0 ] = faceNormal[elemsToFaces[kfe][0]][0] - faceNormal[elemsToFaces[kfe][1]][0];
-      Nbar[ 1 ] = faceNormal[elemsToFaces[kfe][0]][1] - faceNormal[elemsToFaces[kfe][1]][1];
-      Nbar[ 2 ] = faceNormal[elemsToFaces[kfe][0]][2] - faceNormal[elemsToFaces[kfe][1]][2];
-      LvArray::tensorOps::normalize< 3 >( Nbar );
+      // the normal of the fracture element is the first column of its rotation matrix, computed by the contact solver
+      real64 const Nbar[3] = { rotationMatrix( kfe, 0, 0 ), rotationMatrix( kfe, 1, 0 ), rotationMatrix( kfe, 2, 0 ) };
 
       globalIndex rowDOF[12];
       real64 nodeRHS[12];
@@ -537,12 +535,12 @@ void SinglePhasePoromechanicsConformingFractures::
       {
         localIndex const faceIndex = elemsToFaces[kfe][kf];
 
+        // Compute local area contribution for each node
+        array1d< real64 > nodalArea;
+        contactSolver()->computeFaceNodalArea( nodePosition, faceToNodeMap, faceIndex, nodalArea );
+
         for( localIndex a=0; a<numNodesPerFace; ++a )
         {
-          // Compute local area contribution for each node
-          array1d< real64 > nodalArea;
-          contactSolver()->computeFaceNodalArea( nodePosition, faceToNodeMap, elemsToFaces[kfe][kf], nodalArea );
-
           real64 const nodalForceMag = -( pressure[kfe] ) * nodalArea[a];
           array1d< real64 > globalNodalForce( 3 );
           LvArray::tensorOps::scaledCopy< 3 >( globalNodalForce, Nbar, nodalForceMag );
@@ -589,7 +587,6 @@ void SinglePhasePoromechanicsConformingFractures::
   NodeManager const & nodeManager = mesh.getNodeManager();
   ElementRegionManager const & elemManager = mesh.getElemManager();
 
-  arrayView2d< real64 const > const & faceNormal = faceManager.faceNormal();
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
 
   CRSMatrixView< real64 const, localIndex const > const &
@@ -620,20 +617,20 @@ void SinglePhasePoromechanicsConformingFractures::
     arrayView1d< real64 const > const & area = subRegion.getElementArea().toViewConst();
 
     arrayView1d< integer const > const & fractureState = subRegion.getField< fields::contact::fractureState >();
+    arrayView3d< real64 const > const & rotationMatrix =
+      subRegion.getReference< array3d< real64 > >( LagrangianContactSolver::viewKeyStruct::rotationMatrixString() );
 
-    forAll< serialPolicy >( subRegion.size(), [&]( localIndex const kfe )
+    // each fracture element only adds to its own row, so the elements are processed in parallel without atomics
+    forAll< parallelHostPolicy >( subRegion.size(), [&]( localIndex const kfe )
     {
-      localIndex const kf0 = elemsToFaces[kfe][0], kf1 = elemsToFaces[kfe][1];
+      localIndex const kf0 = elemsToFaces[kfe][0];
       localIndex const numNodesPerFace = faceToNodeMap.sizeOfArray( kf0 );
       globalIndex nodeDOF[24];
       globalIndex elemDOF[1];
       elemDOF[0] = presDofNumber[kfe];
 
-      real64 Nbar[3];
-      Nbar[ 0 ] = faceNormal[kf0][0] - faceNormal[kf1][0];
-      Nbar[ 1 ] = faceNormal[kf0][1] - faceNormal[kf1][1];
-      Nbar[ 2 ] = faceNormal[kf0][2] - faceNormal[kf1][2];
-      LvArray::tensorOps::normalize< 3 >( Nbar );
+      // the normal of the fracture element is the first column of its rotation matrix, computed by the contact solver
+      real64 const Nbar[3] = { rotationMatrix( kfe, 0, 0 ), rotationMatrix( kfe, 1, 0 ), rotationMatrix( kfe, 2, 0 ) };
 
       stackArray1d< real64, 2*3*4 > dRdU( 2*3*numNodesPerFace );
 
@@ -753,11 +750,6 @@ void SinglePhasePoromechanicsConformingFractures::updateState( DomainPartition &
     {
       // update fluid model
       poromechanicsSolver()->flowSolver()->updateFluidState( subRegion );
-      if( m_isThermal )
-      {
-        // update solid internal energy
-        poromechanicsSolver()->flowSolver()->updateSolidInternalEnergyModel( subRegion );
-      }
     } );
   } );
 }
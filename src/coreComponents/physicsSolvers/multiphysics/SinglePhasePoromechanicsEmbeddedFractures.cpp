@@ -606,11 +606,6 @@ void SinglePhasePoromechanicsEmbeddedFractures::updateState( DomainPartition & d
       flowSolver()->updatePorosityAndPermeability( subRegion );
       // update fluid model
       flowSolver()->updateFluidState( subRegion );
-      if( m_isThermal )
-      {
-        // update solid internal energy
-        flowSolver()->updateSolidInternalEnergyModel( subRegion );
-      }
     } );
   } );
 }
@@ -1,11 +1,19 @@
 set( kernelPath "coreComponents/physicsSolvers/multiphysics/poromechanicsKernels" )
 
-set( SinglePhasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( SinglePhasePoromechanicsEFEMPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( MultiphasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( ThermalMultiphasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( ThermalSinglePhasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( ThermalSinglePhasePoromechanicsEFEMPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
+# The kernel launch policies are cache variables, so that the block sizes can be tuned per target
+# architecture in the host-config (or on the cmake command line) without modifying the sources
+set( SinglePhasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the SinglePhasePoromechanics kernels" )
+set( SinglePhasePoromechanicsEFEMPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the SinglePhasePoromechanicsEFEM kernels" )
+set( MultiphasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the MultiphasePoromechanics kernels" )
+set( ThermalMultiphasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ThermalMultiphasePoromechanics kernels" )
+set( ThermalSinglePhasePoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ThermalSinglePhasePoromechanics kernels" )
+set( ThermalSinglePhasePoromechanicsEFEMPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ThermalSinglePhasePoromechanicsEFEM kernels" )
 
 
 configure_file( ${CMAKE_SOURCE_DIR}/${kernelPath}/policies.hpp.in
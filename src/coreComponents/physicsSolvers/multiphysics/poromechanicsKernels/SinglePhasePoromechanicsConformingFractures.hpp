@@ -309,10 +309,10 @@ public:
     flowDofNumberAccessor.setName( solverName + "/accessors/" + dofKey );
 
     using kernelType = ConnectorBasedAssemblyKernel< NUM_EQN, NUM_DOF >;
-    typename kernelType::SinglePhaseFlowAccessors flowAccessors( elemManager, solverName );
-    typename kernelType::SinglePhaseFluidAccessors fluidAccessors( elemManager, solverName );
-    typename kernelType::PermeabilityAccessors permAccessors( elemManager, solverName );
-    typename kernelType::FracturePermeabilityAccessors fracPermAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+    auto const & permAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
+    auto const & fracPermAccessors = elemManager.getCachedAccessors< typename kernelType::FracturePermeabilityAccessors >( solverName );
 
     kernelType kernel( rankOffset, stencilWrapper, flowDofNumberAccessor,
                        flowAccessors, fluidAccessors, permAccessors, fracPermAccessors,
@@ -284,10 +284,10 @@ public:
     dispJumpDofNumberAccessor.setName( solverName + "/accessors/" + dispJumpDofKey );
 
     using kernelType = ConnectorBasedAssemblyKernel< NUM_EQN, NUM_DOF >;
-    typename kernelType::SinglePhaseFlowAccessors flowAccessors( elemManager, solverName );
-    typename kernelType::SinglePhaseFluidAccessors fluidAccessors( elemManager, solverName );
-    typename kernelType::PermeabilityAccessors permAccessors( elemManager, solverName );
-    typename kernelType::FracturePermeabilityAccessors edfmPermAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+    auto const & permAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
+    auto const & edfmPermAccessors = elemManager.getCachedAccessors< typename kernelType::FracturePermeabilityAccessors >( solverName );
 
 
     kernelType kernel( rankOffset, stencilWrapper,
@@ -389,15 +389,15 @@ public:
     dispJumpDofNumberAccessor.setName( solverName + "/accessors/" + dispJumpDofKey );
 
     using kernelType = ConnectorBasedAssemblyKernel< NUM_EQN, NUM_DOF >;
-    typename kernelType::SinglePhaseFlowAccessors flowAccessors( elemManager, solverName );
-    typename kernelType::ThermalSinglePhaseFlowAccessors thermalFlowAccessors( elemManager, solverName );
+    auto const & flowAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFlowAccessors >( solverName );
+    auto const & thermalFlowAccessors = elemManager.getCachedAccessors< typename kernelType::ThermalSinglePhaseFlowAccessors >( solverName );
 
-    typename kernelType::SinglePhaseFluidAccessors fluidAccessors( elemManager, solverName );
-    typename kernelType::ThermalSinglePhaseFluidAccessors thermalFluidAccessors( elemManager, solverName );
+    auto const & fluidAccessors = elemManager.getCachedAccessors< typename kernelType::SinglePhaseFluidAccessors >( solverName );
+    auto const & thermalFluidAccessors = elemManager.getCachedAccessors< typename kernelType::ThermalSinglePhaseFluidAccessors >( solverName );
 
-    typename kernelType::PermeabilityAccessors permAccessors( elemManager, solverName );
-    typename kernelType::FracturePermeabilityAccessors edfmPermAccessors( elemManager, solverName );
-    typename kernelType::ThermalConductivityAccessors thermalConductivityAccessors( elemManager, solverName );
+    auto const & permAccessors = elemManager.getCachedAccessors< typename kernelType::PermeabilityAccessors >( solverName );
+    auto const & edfmPermAccessors = elemManager.getCachedAccessors< typename kernelType::FracturePermeabilityAccessors >( solverName );
+    auto const & thermalConductivityAccessors = elemManager.getCachedAccessors< typename kernelType::ThermalConductivityAccessors >( solverName );
 
     kernelType kernel( rankOffset, stencilWrapper,
                        flowDofNumberAccessor, dispJumpDofNumberAccessor,
@@ -18,6 +18,7 @@
 
 #include "PhaseFieldDamageFEM.hpp"
 #include "PhaseFieldDamageFEMKernels.hpp"
+#include "PhaseFieldDamageMatrixFreeOperator.hpp"
 #include <math.h>
 #include <vector>
 
@@ -37,6 +38,7 @@
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
 #include "finiteElement/Kinematics.h"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
 
 #include "mesh/DomainPartition.hpp"
 
@@ -55,7 +57,8 @@ using namespace constitutive;
 PhaseFieldDamageFEM::PhaseFieldDamageFEM( const string & name,
                                           Group * const parent ):
   SolverBase( name, parent ),
-  m_fieldName( "primaryField" )
+  m_fieldName( "primaryField" ),
+  m_useMatrixFreeOperator( 0 )
 {
 
   registerWrapper< string >( PhaseFieldDamageFEMViewKeys.timeIntegrationOption.key() ).
@@ -79,6 +82,12 @@ PhaseFieldDamageFEM::PhaseFieldDamageFEM( const string & name,
     setApplyDefaultValue( 1.5 ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "The upper bound of the damage" );
+
+  registerWrapper( viewKeyStruct::useMatrixFreeOperatorString(), &m_useMatrixFreeOperator ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to apply the Jacobian matrix-free in the Krylov solver. "
+                    "Only the diagonal of the Jacobian is assembled, and the preconditioner must be jacobi or none." );
 }
 
 PhaseFieldDamageFEM::~PhaseFieldDamageFEM()
@@ -99,6 +108,19 @@ void PhaseFieldDamageFEM::registerDataOnMesh( Group & meshBodies )
       .setPlotLevel( PlotLevel::LEVEL_0 )
       .setDescription( "Primary field variable" );
 
+    if( m_useMatrixFreeOperator )
+    {
+      nodes.registerWrapper< real64_array >( viewKeyStruct::matrixFreeInputString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setDescription( "Input vector of the matrix-free damage operator" );
+
+      nodes.registerWrapper< real64_array >( viewKeyStruct::matrixFreeOutputString() ).
+        setPlotLevel( PlotLevel::NOPLOT ).
+        setRestartFlags( RestartFlags::NO_WRITE ).
+        setDescription( "Output vector of the matrix-free damage operator" );
+    }
+
     ElementRegionManager & elemManager = mesh.getElemManager();
 
     elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [ &]( localIndex const, CellElementSubRegion & subRegion )
@@ -152,6 +174,19 @@ void PhaseFieldDamageFEM::postProcessInput()
     GEOS_ERROR( getDataContext() << ": invalid local dissipation option - must be Linear or Quadratic" );
   }
 
+  GEOS_THROW_IF( m_useMatrixFreeOperator &&
+                 m_linearSolverParameters.get().solverType == LinearSolverParameters::SolverType::direct,
+                 getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                 " requires an iterative linear solver",
+                 InputError );
+
+  GEOS_THROW_IF( m_useMatrixFreeOperator &&
+                 m_linearSolverParameters.get().preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                 m_linearSolverParameters.get().preconditionerType != LinearSolverParameters::PreconditionerType::none,
+                 getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                 " only assembles the diagonal of the Jacobian, and requires the jacobi (or no) preconditioner",
+                 InputError );
+
   // Set basic parameters for solver
   // m_linearSolverParameters.logLevel = 0;
   // m_linearSolverParameters.solverType = "gmres";
@@ -216,6 +251,39 @@ void PhaseFieldDamageFEM::setupDofs( DomainPartition const & GEOS_UNUSED_PARAM(
 
 }
 
+void PhaseFieldDamageFEM::setupSystem( DomainPartition & domain,
+                                       DofManager & dofManager,
+                                       CRSMatrix< real64, globalIndex > & localMatrix,
+                                       ParallelVector & rhs,
+                                       ParallelVector & solution,
+                                       bool const setSparsity )
+{
+  GEOS_MARK_FUNCTION;
+
+  if( !m_useMatrixFreeOperator )
+  {
+    SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
+    return;
+  }
+
+  // the matrix-free operator only needs the diagonal of the Jacobian for the Jacobi preconditioner
+  // and for the constrained rows, so that only the diagonal is allocated and assembled
+  SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, false );
+
+  if( setSparsity )
+  {
+    SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( localIndex row = 0; row < dofManager.numLocalDofs(); ++row )
+    {
+      sparsityPattern.insertNonZero( row, rankOffset + row );
+    }
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+  }
+}
+
 void PhaseFieldDamageFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM( time_n ),
                                           real64 const dt,
                                           DomainPartition & domain,
@@ -237,22 +305,40 @@ void PhaseFieldDamageFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM( time_n
     localMatrix.zero();
     localRhs.zero();
 
-    PhaseFieldDamageKernelFactory kernelFactory( dofIndex,
-                                                 dofManager.rankOffset(),
-                                                 localMatrix,
-                                                 localRhs,
-                                                 dt,
-                                                 m_fieldName,
-                                                 m_localDissipationOption=="Linear" ? 1 : 2 );
-
-    finiteElement::
-      regionBasedKernelApplication< parallelDevicePolicy<>,
-                                    constitutive::DamageBase,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            this->getDiscretizationName(),
-                                                            viewKeyStruct::solidModelNamesString(),
-                                                            kernelFactory );
+    auto const launch = [&]( auto & kernelFactory )
+    {
+      finiteElement::
+        regionBasedKernelApplication< parallelDevicePolicy<>,
+                                      constitutive::DamageBase,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              this->getDiscretizationName(),
+                                                              viewKeyStruct::solidModelNamesString(),
+                                                              kernelFactory );
+    };
+
+    if( m_useMatrixFreeOperator )
+    {
+      PhaseFieldDamageDiagonalKernelFactory kernelFactory( dofIndex,
+                                                           dofManager.rankOffset(),
+                                                           localMatrix,
+                                                           localRhs,
+                                                           dt,
+                                                           m_fieldName,
+                                                           getLocalDissipationOption() );
+      launch( kernelFactory );
+    }
+    else
+    {
+      PhaseFieldDamageKernelFactory kernelFactory( dofIndex,
+                                                   dofManager.rankOffset(),
+                                                   localMatrix,
+                                                   localRhs,
+                                                   dt,
+                                                   m_fieldName,
+                                                   getLocalDissipationOption() );
+      launch( kernelFactory );
+    }
 #else // this has your changes to the old base code
     matrix.zero();
     rhs.zero();
@@ -465,6 +551,12 @@ void PhaseFieldDamageFEM::applyBoundaryConditions(
   arrayView1d< real64 > const & localRhs )
 {
   GEOS_MARK_FUNCTION;
+  if( m_useMatrixFreeOperator )
+  {
+    m_constrainedRows.resize( localMatrix.numRows() );
+    m_constrainedRows.zero();
+  }
+
   applyDirichletBCImplicit( time_n + dt, dofManager, domain, localMatrix, localRhs );
 
   // Apply the crack irreversibility constraint
@@ -501,6 +593,61 @@ void PhaseFieldDamageFEM::applyBoundaryConditions(
 //  }
 }
 
+void PhaseFieldDamageFEM::solveLinearSystem( DofManager const & dofManager,
+                                             ParallelMatrix & matrix,
+                                             ParallelVector & rhs,
+                                             ParallelVector & solution )
+{
+  if( !m_useMatrixFreeOperator )
+  {
+    SolverBase::solveLinearSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  matrix.setDofManager( &dofManager );
+
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+
+  // the assembled matrix only holds the diagonal of the Jacobian, used by the Jacobi preconditioner
+  if( !m_precond )
+  {
+    m_precond = LAInterface::createPreconditioner( params );
+  }
+  {
+    Timer timer_setup( m_timers["linear solver setup"] );
+    m_precond->setup( matrix );
+  }
+
+  PhaseFieldDamageMatrixFreeOperator const matrixFreeOperator( *this,
+                                                               domain,
+                                                               dofManager,
+                                                               matrix,
+                                                               m_constrainedRows.toViewConst() );
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver =
+    KrylovSolver< ParallelVector >::create( params, matrixFreeOperator, *m_precond );
+  {
+    Timer timer_solve( m_timers["linear solver solve"] );
+    solver->solve( rhs, solution );
+  }
+  m_linearSolverResult = solver->result();
+
+  if( params.stopIfError )
+  {
+    GEOS_ERROR_IF( m_linearSolverResult.breakdown(), getDataContext() << ": Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOS_WARNING_IF( !m_linearSolverResult.success(), getDataContext() << ": Linear solution failed" );
+  }
+}
+
 real64
 PhaseFieldDamageFEM::calculateResidualNorm( real64 const & GEOS_UNUSED_PARAM( time_n ),
                                             real64 const & GEOS_UNUSED_PARAM( dt ),
@@ -583,6 +730,8 @@ void PhaseFieldDamageFEM::applyDirichletBCImplicit( real64 const time,
 
 {
   FieldSpecificationManager const & fsManager = FieldSpecificationManager::getInstance();
+  arrayView1d< integer > const constrainedRows = m_constrainedRows.toView();
+  globalIndex const rankOffset = dofManager.rankOffset();
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & )
@@ -605,6 +754,21 @@ void PhaseFieldDamageFEM::applyDirichletBCImplicit( real64 const time,
                                                                     dofManager.rankOffset(),
                                                                     localMatrix,
                                                                     localRhs );
+
+      if( m_useMatrixFreeOperator )
+      {
+        // record the constrained rows, the matrix-free operator replaces them by their diagonal
+        arrayView1d< globalIndex const > const dofNumber = targetGroup.getReference< globalIndex_array >( dofManager.getKey( m_fieldName ) );
+        localIndex const numLocalRows = constrainedRows.size();
+        forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+        {
+          globalIndex const localRow = dofNumber[ targetSet[ i ] ] - rankOffset;
+          if( localRow >= 0 && localRow < numLocalRows )
+          {
+            constrainedRows[ localRow ] = 1;
+          }
+        } );
+      }
     } );
 
     fsManager.applyFieldValue< serialPolicy >( time, mesh, viewKeyStruct::coeffNameString() );
@@ -632,6 +796,9 @@ void PhaseFieldDamageFEM::applyIrreversibilityConstraint( DofManager const & dof
 
     real64 const damangeUpperBound = m_damageUpperBound;
 
+    bool const recordConstrainedRows = m_useMatrixFreeOperator;
+    arrayView1d< integer > const constrainedRows = m_constrainedRows.toView();
+
     forAll< parallelDevicePolicy<> >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIndex )
     {
       localIndex const dof = dofIndex[nodeIndex];
@@ -658,6 +825,10 @@ void PhaseFieldDamageFEM::applyIrreversibilityConstraint( DofManager const & dof
           if( localRow >= 0 && localRow < localRhs.size() )
           {
             localRhs[ localRow ] = rhsContribution;
+            if( recordConstrainedRows )
+            {
+              constrainedRows[ localRow ] = 1;
+            }
           }
         }
       }
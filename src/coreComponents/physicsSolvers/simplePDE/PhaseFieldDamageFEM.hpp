@@ -76,6 +76,13 @@ public:
   virtual void setupDofs( DomainPartition const & domain,
                           DofManager & dofManager ) const override;
 
+  virtual void setupSystem( DomainPartition & domain,
+                            DofManager & dofManager,
+                            CRSMatrix< real64, globalIndex > & localMatrix,
+                            ParallelVector & rhs,
+                            ParallelVector & solution,
+                            bool const setSparsity = true ) override;
+
   virtual void assembleSystem( real64 const time, real64 const dt,
                                DomainPartition & domain,
                                DofManager const & dofManager,
@@ -94,6 +101,12 @@ public:
                                         DofManager const & dofManager,
                                         arrayView1d< real64 const > const & localRhs ) override;
 
+  virtual void
+  solveLinearSystem( DofManager const & dofManager,
+                     ParallelMatrix & matrix,
+                     ParallelVector & rhs,
+                     ParallelVector & solution ) override;
+
   virtual void applySystemSolution( DofManager const & dofManager,
                                     arrayView1d< real64 const > const & localSolution,
                                     real64 const scalingFactor,
@@ -141,6 +154,9 @@ public:
     static constexpr char const * irreversibilityFlagString() { return "irreversibilityFlag"; }
     static constexpr char const * damageUpperBoundString() { return "damageUpperBound"; }
     static constexpr char const * solidModelNamesString() { return "solidMaterialNames"; }
+    static constexpr char const * useMatrixFreeOperatorString() { return "useMatrixFreeOperator"; }
+    static constexpr char const * matrixFreeInputString() { return "damageMatrixFreeInput"; }
+    static constexpr char const * matrixFreeOutputString() { return "damageMatrixFreeOutput"; }
 
     dataRepository::ViewKey timeIntegrationOption = { "timeIntegrationOption" };
     dataRepository::ViewKey fieldVarName = { "fieldName" };
@@ -161,6 +177,15 @@ public:
     return m_fieldName;
   }
 
+  /**
+   * @brief Get the local dissipation option as passed to the damage kernels.
+   * @return 1 for the Linear option, 2 for the Quadratic option
+   */
+  int getLocalDissipationOption() const
+  {
+    return m_localDissipationOption == "Linear" ? 1 : 2;
+  }
+
 protected:
   virtual void postProcessInput() override final;
 
@@ -172,6 +197,12 @@ private:
   integer m_irreversibilityFlag;
   real64 m_damageUpperBound;
 
+  /// Flag to apply the Jacobian matrix-free in the Krylov solver
+  integer m_useMatrixFreeOperator;
+
+  /// Local row mask of the rows constrained by the boundary conditions, used by the matrix-free operator
+  array1d< integer > m_constrainedRows;
+
   array1d< real64 > m_coeff;
 
   PhaseFieldDamageFEM();
@@ -143,13 +143,8 @@ public:
             nodalDamageLocal{ 0.0 }
     {}
 
-#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
-    /// Dummy
-    int xLocal;
-#else
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ];
-#endif
 
     /// C-array storage for the element local primary field variable.
     real64 nodalDamageLocal[numNodesPerElem];
@@ -173,9 +168,7 @@ public:
     {
       localIndex const localNodeIndex = m_elemsToNodes( k, a );
 
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
       LvArray::tensorOps::copy< 3 >( stack.xLocal[ a ], m_X[ localNodeIndex ] );
-#endif
 
       stack.nodalDamageLocal[ a ] = m_nodalDamage[ localNodeIndex ];
       stack.localRowDofIndex[a] = m_dofNumber[localNodeIndex];
@@ -309,6 +302,300 @@ using PhaseFieldDamageKernelFactory = finiteElement::KernelFactory< PhaseFieldDa
                                                                     string const,
                                                                     int >;
 
+/**
+ * @brief Implements the residual of PhaseFieldDamageKernel and only the diagonal of its Jacobian.
+ * @copydoc PhaseFieldDamageKernel
+ *
+ * ### PhaseFieldDamageDiagonalKernel Description
+ * Used by the matrix-free solve of PhaseFieldDamageFEM: the product with the Jacobian is
+ * applied by PhaseFieldDamageOperatorApply, and the matrix only has a diagonal sparsity
+ * pattern, holding the diagonal used by the Jacobi preconditioner and by the constrained rows.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class PhaseFieldDamageDiagonalKernel :
+  public PhaseFieldDamageKernel< SUBREGION_TYPE,
+                                 CONSTITUTIVE_TYPE,
+                                 FE_TYPE >
+{
+public:
+  /// An alias for the base class.
+  using Base = PhaseFieldDamageKernel< SUBREGION_TYPE,
+                                       CONSTITUTIVE_TYPE,
+                                       FE_TYPE >;
+
+  using Base::Base;
+  using typename Base::StackVariables;
+  using Base::numNodesPerElem;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+
+  /**
+   * @copydoc geos::finiteElement::ImplicitKernelBase::complete
+   *
+   * Adds the element residual to the global vector, and the diagonal of the element Jacobian
+   * to the diagonal of the global matrix.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOS_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    for( int a = 0; a < numNodesPerElem; ++a )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ a ] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+      m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                              &stack.localColDofIndex[ a ],
+                                                                              &stack.localJacobian[ a ][ a ],
+                                                                              1 );
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ a ] );
+      maxForce = fmax( maxForce, fabs( stack.localResidual[ a ] ) );
+    }
+
+    return maxForce;
+  }
+};
+
+using PhaseFieldDamageDiagonalKernelFactory = finiteElement::KernelFactory< PhaseFieldDamageDiagonalKernel,
+                                                                            arrayView1d< globalIndex const > const,
+                                                                            globalIndex,
+                                                                            CRSMatrixView< real64, globalIndex const > const,
+                                                                            arrayView1d< real64 > const,
+                                                                            real64 const,
+                                                                            string const,
+                                                                            int >;
+
+//*****************************************************************************
+/**
+ * @brief Implements the action of the Jacobian of the damage equation on a nodal vector.
+ * @copydoc geos::finiteElement::KernelBase
+ *
+ * ### PhaseFieldDamageOperatorApply Description
+ * Computes y += J x element by element without forming the global matrix, where J is
+ * the Jacobian assembled by PhaseFieldDamageKernel for the current nodal damage
+ * (including its sign convention). The operator is a Helmholtz-like combination of the
+ * stiffness and of the damage-weighted mass terms, and is evaluated from the values
+ * and gradients of x at the quadrature points.
+ *
+ * The input vector must hold valid values on ghost nodes. The kernel is launched on
+ * all elements (ghosts included) so that the output is complete on locally owned nodes.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class PhaseFieldDamageOperatorApply :
+  public finiteElement::KernelBase< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE,
+                                    1,
+                                    1 >
+{
+public:
+  /// An alias for the base class.
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          1,
+                                          1 >;
+
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  /// Maximum number of nodes per element, see PhaseFieldDamageKernel.
+  static constexpr int numNodesPerElem = Base::maxNumTestSupportPointsPerElem;
+
+  /**
+   * @brief Constructor
+   * @copydoc geos::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param fieldName The name of the nodal damage field.
+   * @param localDissipationOption The local dissipation option (1: Linear, 2: Quadratic).
+   * @param input The nodal input vector x.
+   * @param output The nodal output vector y, to which J x is added.
+   */
+  PhaseFieldDamageOperatorApply( NodeManager const & nodeManager,
+                                 EdgeManager const & edgeManager,
+                                 FaceManager const & faceManager,
+                                 localIndex const targetRegionIndex,
+                                 SUBREGION_TYPE const & elementSubRegion,
+                                 FE_TYPE const & finiteElementSpace,
+                                 CONSTITUTIVE_TYPE & inputConstitutiveType,
+                                 string const fieldName,
+                                 int const localDissipationOption,
+                                 arrayView1d< real64 const > const input,
+                                 arrayView1d< real64 > const output ):
+    Base( elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType ),
+    m_X( nodeManager.referencePosition()),
+    m_nodalDamage( nodeManager.template getReference< array1d< real64 > >( fieldName )),
+    m_input( input ),
+    m_output( output ),
+    m_localDissipationOption( localDissipationOption )
+  {
+    GEOS_UNUSED_VAR( edgeManager );
+    GEOS_UNUSED_VAR( faceManager );
+    GEOS_UNUSED_VAR( targetRegionIndex );
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::StackVariables
+   *
+   * Adds stack arrays for the nodal damage and the element input and output vectors.
+   */
+  struct StackVariables : Base::StackVariables
+  {
+public:
+
+    /**
+     * @brief Constructor
+     */
+    GEOS_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            xLocal(),
+            nodalDamageLocal{ 0.0 },
+            inLocal{ 0.0 },
+            outLocal{ 0.0 }
+    {}
+
+    /// C-array stack storage for element local the nodal positions.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// C-array storage for the element local damage.
+    real64 nodalDamageLocal[ numNodesPerElem ];
+
+    /// C-array storage for the element local input vector.
+    real64 inLocal[ numNodesPerElem ];
+
+    /// C-array storage for the element local output vector.
+    real64 outLocal[ numNodesPerElem ];
+  };
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::setup
+   *
+   * Copies the nodal positions, damage and input vector into the local stack arrays.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+
+      LvArray::tensorOps::copy< 3 >( stack.xLocal[ a ], m_X[ localNodeIndex ] );
+
+      stack.nodalDamageLocal[ a ] = m_nodalDamage[ localNodeIndex ];
+      stack.inLocal[ a ] = m_input[ localNodeIndex ];
+    }
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### PhaseFieldDamageOperatorApply Description
+   * Interpolates the input vector at the quadrature point and integrates the
+   * stiffness and mass terms of the Jacobian of PhaseFieldDamageKernel.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 const strainEnergyDensity = m_constitutiveUpdate.getStrainEnergyDensity( k, q );
+    real64 const ell = m_constitutiveUpdate.getRegularizationLength();
+    real64 const Gc = m_constitutiveUpdate.getCriticalFractureEnergy();
+
+    real64 N[ numNodesPerElem ];
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+    FE_TYPE::calcN( q, N );
+
+    real64 qp_damage = 0.0;
+    real64 qp_grad_damage[3] = {0, 0, 0};
+    FE_TYPE::valueAndGradient( N, dNdX, stack.nodalDamageLocal, qp_damage, qp_grad_damage );
+
+    real64 qp_in = 0.0;
+    real64 qp_grad_in[3] = {0, 0, 0};
+    FE_TYPE::valueAndGradient( N, dNdX, stack.inLocal, qp_in, qp_grad_in );
+
+    // coefficients of the stiffness and mass terms, must match PhaseFieldDamageKernel::quadraturePointKernel
+    real64 stiffnessCoeff;
+    real64 massCoeff;
+    if( m_localDissipationOption == 1 )
+    {
+      real64 const D = fmax( m_constitutiveUpdate.getEnergyThreshold( k, q ), strainEnergyDensity );
+      stiffnessCoeff = 0.375 * ell * ell;
+      massCoeff = (0.5 * ell * D/Gc) * m_constitutiveUpdate.getDegradationSecondDerivative( qp_damage );
+    }
+    else
+    {
+      stiffnessCoeff = ell * ell;
+      massCoeff = 1 + m_constitutiveUpdate.getDegradationSecondDerivative( qp_damage ) * ell * strainEnergyDensity/Gc;
+    }
+
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      stack.outLocal[ a ] -= detJ * ( stiffnessCoeff * LvArray::tensorOps::AiBi< 3 >( qp_grad_in, dNdX[a] )
+                                      + massCoeff * N[a] * qp_in );
+    }
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * Scatters the element output vector to the nodal output array.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_output[ m_elemsToNodes( k, a ) ], stack.outLocal[ a ] );
+    }
+    return 0;
+  }
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The global damage field array.
+  arrayView1d< real64 const > const m_nodalDamage;
+
+  /// The nodal input vector.
+  arrayView1d< real64 const > const m_input;
+
+  /// The nodal output vector.
+  arrayView1d< real64 > const m_output;
+
+  int const m_localDissipationOption;
+};
+
+/// The factory used to construct a PhaseFieldDamageOperatorApply kernel.
+using PhaseFieldDamageOperatorApplyFactory = finiteElement::KernelFactory< PhaseFieldDamageOperatorApply,
+                                                                           string const,
+                                                                           int,
+                                                                           arrayView1d< real64 const > const,
+                                                                           arrayView1d< real64 > const >;
+
 } // namespace geos
 
 #include "finiteElement/kernelInterface/SparsityKernelBase.hpp"
@@ -0,0 +1,155 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PhaseFieldDamageMatrixFreeOperator.cpp
+ */
+
+#include "PhaseFieldDamageMatrixFreeOperator.hpp"
+
+#include "PhaseFieldDamageFEM.hpp"
+#include "PhaseFieldDamageFEMKernels.hpp"
+#include "constitutive/solid/Damage.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+
+namespace geos
+{
+
+using namespace dataRepository;
+
+PhaseFieldDamageMatrixFreeOperator::PhaseFieldDamageMatrixFreeOperator( PhaseFieldDamageFEM const & solver,
+                                                                        DomainPartition & domain,
+                                                                        DofManager const & dofManager,
+                                                                        ParallelMatrix const & matrix,
+                                                                        arrayView1d< integer const > const & constrainedRows ):
+  LinearOperator< ParallelVector >(),
+  m_solver( solver ),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_constrainedRows( constrainedRows ),
+  m_numGlobalRows( matrix.numGlobalRows() ),
+  m_numLocalRows( matrix.numLocalRows() ),
+  m_comm( matrix.comm() )
+{
+  GEOS_ERROR_IF_NE( m_constrainedRows.size(), m_numLocalRows );
+
+  m_diagonal.create( m_numLocalRows, m_comm );
+  matrix.extractDiagonal( m_diagonal );
+
+  // ghost values of the input are filled by synchronization, make sure nodes without dofs hold zeros
+  m_solver.forDiscretizationOnMeshTargets( m_domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & )
+  {
+    mesh.getNodeManager().getReference< array1d< real64 > >( PhaseFieldDamageFEM::viewKeyStruct::matrixFreeInputString() ).zero();
+  } );
+}
+
+void PhaseFieldDamageMatrixFreeOperator::apply( ParallelVector const & src,
+                                                ParallelVector & dst ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  string const & fieldName = m_solver.getFieldName();
+
+  m_dofManager.copyVectorToField( src.values(),
+                                  fieldName,
+                                  PhaseFieldDamageFEM::viewKeyStruct::matrixFreeInputString(),
+                                  1.0 );
+
+  m_solver.forDiscretizationOnMeshTargets( m_domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { PhaseFieldDamageFEM::viewKeyStruct::matrixFreeInputString() } );
+
+    CommunicationTools::getInstance().synchronizeFieldsPersistent( fieldsToBeSync,
+                                                                   mesh,
+                                                                   m_domain.getNeighbors(),
+                                                                   true );
+
+    arrayView1d< real64 > const output =
+      nodeManager.getReference< array1d< real64 > >( PhaseFieldDamageFEM::viewKeyStruct::matrixFreeOutputString() );
+    output.zero();
+
+    arrayView1d< real64 const > const input =
+      nodeManager.getReference< array1d< real64 > >( PhaseFieldDamageFEM::viewKeyStruct::matrixFreeInputString() );
+
+    PhaseFieldDamageOperatorApplyFactory kernelFactory( fieldName,
+                                                        m_solver.getLocalDissipationOption(),
+                                                        input,
+                                                        output );
+
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< >,
+                                    constitutive::DamageBase,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            m_solver.getDiscretizationName(),
+                                                            PhaseFieldDamageFEM::viewKeyStruct::solidModelNamesString(),
+                                                            kernelFactory );
+  } );
+
+  arrayView1d< real64 > const localDst = dst.open();
+
+  m_dofManager.copyFieldToVector( localDst,
+                                  PhaseFieldDamageFEM::viewKeyStruct::matrixFreeOutputString(),
+                                  fieldName,
+                                  1.0 );
+
+  arrayView1d< real64 const > const localSrc = src.values();
+  arrayView1d< real64 const > const localDiag = m_diagonal.values();
+  arrayView1d< integer const > const constrainedRows = m_constrainedRows;
+  forAll< parallelDevicePolicy<> >( m_numLocalRows, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    if( constrainedRows[i] )
+    {
+      localDst[i] = localDiag[i] * localSrc[i];
+    }
+  } );
+
+  dst.close();
+}
+
+globalIndex PhaseFieldDamageMatrixFreeOperator::numGlobalRows() const
+{
+  return m_numGlobalRows;
+}
+
+globalIndex PhaseFieldDamageMatrixFreeOperator::numGlobalCols() const
+{
+  return m_numGlobalRows;
+}
+
+localIndex PhaseFieldDamageMatrixFreeOperator::numLocalRows() const
+{
+  return m_numLocalRows;
+}
+
+localIndex PhaseFieldDamageMatrixFreeOperator::numLocalCols() const
+{
+  return m_numLocalRows;
+}
+
+MPI_Comm PhaseFieldDamageMatrixFreeOperator::comm() const
+{
+  return m_comm;
+}
+
+} // namespace geos
@@ -124,6 +124,22 @@ DECLARE_FIELD( contactForce,
                WRITE_AND_READ,
                "Contact force" );
 
+DECLARE_FIELD( matrixFreeInput,
+               "matrixFreeInput",
+               array2d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Nodal input vector of the matrix-free stiffness operator" );
+
+DECLARE_FIELD( matrixFreeOutput,
+               "matrixFreeOutput",
+               array2d< real64 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Nodal output vector of the matrix-free stiffness operator" );
+
 }
 
 }
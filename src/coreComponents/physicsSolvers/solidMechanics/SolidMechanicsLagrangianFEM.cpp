@@ -19,6 +19,7 @@
 #define GEOSX_DISPATCH_VEM /// enables VEM in FiniteElementDispatch
 
 #include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 #include "kernels/ImplicitSmallStrainNewmark.hpp"
 #include "kernels/ImplicitSmallStrainQuasiStatic.hpp"
 #include "kernels/ExplicitSmallStrain.hpp"
@@ -26,13 +27,19 @@
 #include "kernels/FixedStressThermoPoromechanics.hpp"
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/Timer.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "constitutive/contact/ContactBase.hpp"
+#include "constitutive/solid/ElasticIsotropic.hpp"
+#include "constitutive/solid/ElasticOrthotropic.hpp"
+#include "constitutive/solid/ElasticTransverseIsotropic.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/TractionBoundaryCondition.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/utilities/LAIHelperFunctions.hpp"
 #include "LvArray/src/output.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/DomainPartition.hpp"
@@ -60,7 +67,11 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
   m_maxNumResolves( 10 ),
   m_strainTheory( 0 ),
   m_iComm( CommunicationTools::getInstance().getCommID() ),
-  m_isFixedStressPoromechanicsUpdate( false )
+  m_isFixedStressPoromechanicsUpdate( false ),
+  m_useMatrixFreeOperator( 0 ),
+  m_useElementColoring( 0 ),
+  m_numElementColors( 0 ),
+  m_rigidBodyModesTimestamp( 0 )
 {
 
   registerWrapper( viewKeyStruct::newmarkGammaString(), &m_newmarkGamma ).
@@ -115,6 +126,18 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
     setInputFlag( InputFlags::FALSE ).
     setDescription( "The maximum force contribution in the problem domain." );
 
+  registerWrapper( viewKeyStruct::useMatrixFreeOperatorString(), &m_useMatrixFreeOperator ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to apply the stiffness operator matrix-free in the Krylov solver (QuasiStatic, linear elastic solids only). "
+                    "Only the diagonal of the Jacobian is assembled, and the preconditioner must be jacobi or none." );
+
+  registerWrapper( viewKeyStruct::useElementColoringString(), &m_useElementColoring ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to color the elements such that no two elements of a color share a node (ExplicitDynamic only). "
+                    "The explicit kernels are then launched color by color and scatter the nodal forces without atomics." );
+
 }
 
 void SolidMechanicsLagrangianFEM::postProcessInput()
@@ -125,6 +148,32 @@ void SolidMechanicsLagrangianFEM::postProcessInput()
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
+
+  if( m_useMatrixFreeOperator )
+  {
+    GEOS_THROW_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                   getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                   " is only supported with the QuasiStatic time integration option",
+                   InputError );
+    GEOS_THROW_IF( m_contactRelationName != viewKeyStruct::noContactRelationNameString(),
+                   getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                   " is not supported with contact",
+                   InputError );
+    GEOS_THROW_IF( linParams.solverType == LinearSolverParameters::SolverType::direct,
+                   getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                   " requires an iterative linear solver",
+                   InputError );
+    GEOS_THROW_IF( linParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                   linParams.preconditionerType != LinearSolverParameters::PreconditionerType::none,
+                   getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                   " only assembles the diagonal of the Jacobian, and requires the jacobi (or no) preconditioner",
+                   InputError );
+  }
+
+  GEOS_THROW_IF( m_useElementColoring && m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic,
+                 getDataContext() << ": " << viewKeyStruct::useElementColoringString() <<
+                 " is only supported with the ExplicitDynamic time integration option",
+                 InputError );
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -173,6 +222,15 @@ void SolidMechanicsLagrangianFEM::registerDataOnMesh( Group & meshBodies )
     nodes.registerField< solidMechanics::contactForce >( getName() ).
       reference().resizeDimension< 1 >( 3 );
 
+    if( m_useMatrixFreeOperator )
+    {
+      nodes.registerField< solidMechanics::matrixFreeInput >( getName() ).
+        reference().resizeDimension< 1 >( 3 );
+
+      nodes.registerField< solidMechanics::matrixFreeOutput >( getName() ).
+        reference().resizeDimension< 1 >( 3 );
+    }
+
     Group & nodeSets = nodes.sets();
     nodeSets.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::sendOrReceiveNodesString() ).
       setPlotLevel( PlotLevel::NOPLOT ).
@@ -245,6 +303,19 @@ void SolidMechanicsLagrangianFEM::initializePreSubGroups()
     {
       string & solidMaterialName = subRegion.getReference< string >( viewKeyStruct::solidMaterialNamesString() );
       solidMaterialName = SolverBase::getConstitutiveName< SolidBase >( subRegion );
+
+      if( m_useMatrixFreeOperator )
+      {
+        // the matrix-free operator applies the elastic stiffness, which is the Jacobian of the linear elastic models only
+        string const solidType = subRegion.getConstitutiveModel< SolidBase >( solidMaterialName ).getCatalogName();
+        GEOS_THROW_IF( solidType != ElasticIsotropic::catalogName() &&
+                       solidType != ElasticTransverseIsotropic::catalogName() &&
+                       solidType != ElasticOrthotropic::catalogName(),
+                       getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                       " is only supported with linear elastic solids, not with " << solidType <<
+                       " in " << subRegion.getDataContext(),
+                       InputError );
+      }
     } );
   } );
 
@@ -268,40 +339,160 @@ real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( MeshLevel & mesh,
                                                             std::string const & elementListName )
 {
   GEOS_MARK_FUNCTION;
-  real64 rval = 0;
-  if( m_strainTheory==0 )
+
+  auto launch = [&]( string const & listName, integer const useAtomics )
   {
-    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, elementListName );
-    rval = finiteElement::
-             regionBasedKernelApplication< parallelDevicePolicy<   >,
-                                           constitutive::SolidBase,
-                                           CellElementSubRegion >( mesh,
-                                                                   targetRegions,
-                                                                   finiteElementName,
-                                                                   viewKeyStruct::solidMaterialNamesString(),
-                                                                   kernelFactory );
-  }
-  else if( m_strainTheory==1 )
+    real64 rval = 0;
+    if( m_strainTheory==0 )
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitSmallStrainFactory( dt, listName, useAtomics );
+      rval = finiteElement::
+               regionBasedKernelApplication< parallelDevicePolicy<   >,
+                                             constitutive::SolidBase,
+                                             CellElementSubRegion >( mesh,
+                                                                     targetRegions,
+                                                                     finiteElementName,
+                                                                     viewKeyStruct::solidMaterialNamesString(),
+                                                                     kernelFactory );
+    }
+    else if( m_strainTheory==1 )
+    {
+      auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainFactory( dt, listName, useAtomics );
+      rval = finiteElement::
+               regionBasedKernelApplication< parallelDevicePolicy<   >,
+                                             constitutive::SolidBase,
+                                             CellElementSubRegion >( mesh,
+                                                                     targetRegions,
+                                                                     finiteElementName,
+                                                                     viewKeyStruct::solidMaterialNamesString(),
+                                                                     kernelFactory );
+    }
+    else
+    {
+      GEOS_ERROR( getWrapperDataContext( viewKeyStruct::strainTheoryString() ) <<
+                  ": Invalid option for strain theory (0 = infinitesimal strain, 1 = finite strain" );
+    }
+    return rval;
+  };
+
+  real64 rval = 0;
+  if( m_useElementColoring )
   {
-    auto kernelFactory = solidMechanicsLagrangianFEMKernels::ExplicitFiniteStrainFactory( dt, elementListName );
-    rval = finiteElement::
-             regionBasedKernelApplication< parallelDevicePolicy<   >,
-                                           constitutive::SolidBase,
-                                           CellElementSubRegion >( mesh,
-                                                                   targetRegions,
-                                                                   finiteElementName,
-                                                                   viewKeyStruct::solidMaterialNamesString(),
-                                                                   kernelFactory );
+    // the elements of a color do not share any node, so the colors are launched one after the other without atomics
+    for( integer color = 0; color < m_numElementColors; ++color )
+    {
+      rval = launch( getElemColorListName( elementListName, color ), 0 );
+    }
   }
   else
   {
-    GEOS_ERROR( getWrapperDataContext( viewKeyStruct::strainTheoryString() ) <<
-                ": Invalid option for strain theory (0 = infinitesimal strain, 1 = finite strain" );
+    rval = launch( elementListName, 1 );
   }
 
   return rval;
 }
 
+void SolidMechanicsLagrangianFEM::colorElements( DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  string const elementListNames[2] = { viewKeyStruct::elemsAttachedToSendOrReceiveNodesString(),
+                                       viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() };
+
+  // first, greedily color each element list, assigning to each element the lowest color not taken by an element sharing one of its nodes
+  m_numElementColors = 0;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&]( string const &,
+                                       MeshLevel & mesh,
+                                       auto const & regionNames )
+  {
+    localIndex const numNodes = mesh.getNodeManager().size();
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = subRegion.nodeList();
+
+      for( string const & elementListName : elementListNames )
+      {
+        SortedArrayView< localIndex const > const elementList =
+          subRegion.getReference< SortedArray< localIndex > >( elementListName ).toViewConst();
+
+        std::vector< std::vector< integer > > nodeColors( numNodes );
+        std::vector< std::vector< localIndex > > colorElems;
+        std::vector< bool > isColorTaken;
+        for( localIndex const k : elementList )
+        {
+          isColorTaken.assign( colorElems.size(), false );
+          for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+          {
+            for( integer const c : nodeColors[elemsToNodes[k][a]] )
+            {
+              isColorTaken[c] = true;
+            }
+          }
+
+          integer color = 0;
+          while( color < LvArray::integerConversion< integer >( colorElems.size() ) && isColorTaken[color] )
+          {
+            ++color;
+          }
+          if( color == LvArray::integerConversion< integer >( colorElems.size() ) )
+          {
+            colorElems.emplace_back();
+          }
+          colorElems[color].push_back( k );
+
+          for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+          {
+            nodeColors[elemsToNodes[k][a]].push_back( color );
+          }
+        }
+
+        for( integer color = 0; color < LvArray::integerConversion< integer >( colorElems.size() ); ++color )
+        {
+          string const colorListName = getElemColorListName( elementListName, color );
+          subRegion.registerWrapper< SortedArray< localIndex > >( colorListName ).
+            setPlotLevel( PlotLevel::NOPLOT ).
+            setRestartFlags( RestartFlags::NO_WRITE ).
+            reference().insert( colorElems[color].begin(), colorElems[color].end() );
+          subRegion.excludeWrappersFromPacking( { colorListName } );
+        }
+        m_numElementColors = std::max( m_numElementColors, LvArray::integerConversion< integer >( colorElems.size() ) );
+      }
+    } );
+  } );
+
+  // then, register empty lists for the colors that are not used in a sub-region, since all the colors are launched on all the sub-regions
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&]( string const &,
+                                       MeshLevel & mesh,
+                                       auto const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames,
+                                                                        [&]( localIndex const,
+                                                                             CellElementSubRegion & subRegion )
+    {
+      for( string const & elementListName : elementListNames )
+      {
+        for( integer color = 0; color < m_numElementColors; ++color )
+        {
+          string const colorListName = getElemColorListName( elementListName, color );
+          if( !subRegion.hasWrapper( colorListName ) )
+          {
+            subRegion.registerWrapper< SortedArray< localIndex > >( colorListName ).
+              setPlotLevel( PlotLevel::NOPLOT ).
+              setRestartFlags( RestartFlags::NO_WRITE );
+            subRegion.excludeWrappersFromPacking( { colorListName } );
+          }
+        }
+      }
+    } );
+  } );
+
+  GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: the elements have been split into {} colors on rank 0", getName(), m_numElementColors ) );
+}
+
 
 void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
 {
@@ -388,7 +579,6 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
             localIndex const numSupportPoints =
               finiteElement.template numSupportPoints< FE_TYPE >( feStack );
 
-//#if ! defined( CALC_FEM_SHAPE_IN_KERNEL ) // we don't calculate detJ in this case
             for( localIndex q=0; q<numQuadraturePointsPerElem; ++q )
             {
               FE_TYPE::calcN( q, feStack, N );
@@ -398,7 +588,6 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
                 mass[elemsToNodes[k][a]] += rho[k][q] * detJ[k][q] * N[a];
               }
             }
-//#endif
 
             bool isAttachedToGhostNode = false;
             for( localIndex a=0; a<elementSubRegion.numNodesPerElement(); ++a )
@@ -441,6 +630,11 @@ void SolidMechanicsLagrangianFEM::initializePostInitialConditionsPreSubGroups()
     } );
 
   } );
+
+  if( m_useElementColoring )
+  {
+    colorElements( domain );
+  }
 }
 
 real64 SolidMechanicsLagrangianFEM::solverStep( real64 const & time_n,
@@ -658,6 +852,14 @@ void SolidMechanicsLagrangianFEM::applyDisplacementBCImplicit( real64 const time
 
   integer isDisplacementBCApplied[3]{};
 
+  if( m_useMatrixFreeOperator )
+  {
+    m_dirichletRows.resize( localMatrix.numRows() );
+    m_dirichletRows.zero();
+  }
+  arrayView1d< integer > const dirichletRows = m_dirichletRows.toView();
+  globalIndex const rankOffset = dofManager.rankOffset();
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & )
@@ -682,6 +884,22 @@ void SolidMechanicsLagrangianFEM::applyDisplacementBCImplicit( real64 const time
                                                                      localMatrix,
                                                                      localRhs );
 
+      if( m_useMatrixFreeOperator )
+      {
+        // record the constrained rows, the matrix-free operator replaces them by their diagonal
+        arrayView1d< globalIndex const > const dofNumber = targetGroup.getReference< globalIndex_array >( dofKey );
+        integer const component = ( bc.getComponent() >= 0 ) ? bc.getComponent() : 0;
+        localIndex const numLocalRows = dirichletRows.size();
+        forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+        {
+          globalIndex const localRow = dofNumber[ targetSet[ i ] ] + component - rankOffset;
+          if( localRow >= 0 && localRow < numLocalRows )
+          {
+            dirichletRows[ localRow ] = 1;
+          }
+        } );
+      }
+
       if( targetSet.size() > 0 && bc.getComponent() == 0 )
       {
         isDisplacementBCApplied[0] = 1;
@@ -949,6 +1167,34 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
                                                bool const setSparsity )
 {
   GEOS_MARK_FUNCTION;
+
+  if( m_useMatrixFreeOperator )
+  {
+    // the matrix-free operator only needs the diagonal of the Jacobian for the Jacobi preconditioner
+    // and for the Dirichlet rows, so that only the diagonal is allocated and assembled
+    SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, false );
+
+    SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( localIndex row = 0; row < dofManager.numLocalDofs(); ++row )
+    {
+      sparsityPattern.insertNonZero( row, rankOffset + row );
+    }
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
+
+    if( m_precond )
+    {
+      m_precond->clear();
+    }
+    else
+    {
+      m_precond = LAInterface::createPreconditioner( m_linearSolverParameters.get() );
+    }
+    return;
+  }
+
   SolverBase::setupSystem( domain, dofManager, localMatrix, rhs, solution, setSparsity );
 
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
@@ -999,7 +1245,52 @@ void SolidMechanicsLagrangianFEM::setupSystem( DomainPartition & domain,
   sparsityPattern.compress();
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( sparsityPattern ) );
 
+  // The rigid body modes are only passed to the preconditioner of the system of this solver,
+  // and they are recomputed only when the mesh changed since the last setup
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  bool const useRigidBodyModes = &dofManager == &m_dofManager &&
+                                 params.solverType != LinearSolverParameters::SolverType::direct &&
+                                 params.preconditionerType == LinearSolverParameters::PreconditionerType::amg &&
+                                 params.amg.nullSpaceType == LinearSolverParameters::AMG::NullSpaceType::rigidBodyModes;
+  if( useRigidBodyModes && updateRigidBodyModes( domain.getMeshBody( 0 ).getBaseDiscretization(), dofManager ) )
+  {
+    // the preconditioner keeps pointers to the previous modes
+    m_precond.reset();
+  }
 
+  if( useRigidBodyModes )
+  {
+    if( m_precond )
+    {
+      m_precond->clear();
+    }
+    else if( m_rigidBodyModes.empty() )
+    {
+      m_precond = LAInterface::createPreconditioner( m_linearSolverParameters.get() );
+    }
+    else
+    {
+      m_precond = LAInterface::createPreconditioner( m_linearSolverParameters.get(), m_rigidBodyModes );
+    }
+  }
+}
+
+bool SolidMechanicsLagrangianFEM::updateRigidBodyModes( MeshLevel const & mesh, DofManager const & dofManager )
+{
+  GEOS_MARK_FUNCTION;
+
+  Timestamp const meshTimestamp = mesh.getModificationTimestamp();
+  if( !m_rigidBodyModes.empty() && m_rigidBodyModesTimestamp == meshTimestamp )
+  {
+    return false;
+  }
+
+  LAIHelperFunctions::computeRigidBodyModes( mesh,
+                                             dofManager,
+                                             { solidMechanics::totalDisplacement::key() },
+                                             m_rigidBodyModes );
+  m_rigidBodyModesTimestamp = meshTimestamp;
+  return true;
 }
 
 void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM( time_n ),
@@ -1029,12 +1320,24 @@ void SolidMechanicsLagrangianFEM::assembleSystem( real64 const GEOS_UNUSED_PARAM
     if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
     {
       //GEOS_UNUSED_VAR( dt );
-      assemblyLaunch< constitutive::SolidBase,
-                      solidMechanicsLagrangianFEMKernels::QuasiStaticFactory >( domain,
-                                                                                dofManager,
-                                                                                localMatrix,
-                                                                                localRhs,
-                                                                                dt );
+      if( m_useMatrixFreeOperator )
+      {
+        assemblyLaunch< constitutive::SolidBase,
+                        solidMechanicsLagrangianFEMKernels::QuasiStaticDiagonalFactory >( domain,
+                                                                                          dofManager,
+                                                                                          localMatrix,
+                                                                                          localRhs,
+                                                                                          dt );
+      }
+      else
+      {
+        assemblyLaunch< constitutive::SolidBase,
+                        solidMechanicsLagrangianFEMKernels::QuasiStaticFactory >( domain,
+                                                                                  dofManager,
+                                                                                  localMatrix,
+                                                                                  localRhs,
+                                                                                  dt );
+      }
     }
     else if( m_timeIntegrationOption == TimeIntegrationOption::ImplicitDynamic )
     {
@@ -1232,6 +1535,60 @@ SolidMechanicsLagrangianFEM::applySystemSolution( DofManager const & dofManager,
   } );
 }
 
+void SolidMechanicsLagrangianFEM::solveLinearSystem( DofManager const & dofManager,
+                                                     ParallelMatrix & matrix,
+                                                     ParallelVector & rhs,
+                                                     ParallelVector & solution )
+{
+  if( !m_useMatrixFreeOperator )
+  {
+    SolverBase::solveLinearSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF( m_isFixedStressPoromechanicsUpdate,
+                 getDataContext() << ": " << viewKeyStruct::useMatrixFreeOperatorString() <<
+                 " is not supported with the fixed-stress poromechanics update" );
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  matrix.setDofManager( &dofManager );
+
+  DomainPartition & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+
+  {
+    Timer timer_setup( m_timers["linear solver setup"] );
+    m_precond->setup( matrix );
+  }
+
+  SolidMechanicsMatrixFreeOperator const matrixFreeOperator( *this,
+                                                             domain,
+                                                             dofManager,
+                                                             matrix,
+                                                             m_dirichletRows.toViewConst() );
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver =
+    KrylovSolver< ParallelVector >::create( params, matrixFreeOperator, *m_precond );
+  {
+    Timer timer_solve( m_timers["linear solver solve"] );
+    solver->solve( rhs, solution );
+  }
+  m_linearSolverResult = solver->result();
+
+  if( params.stopIfError )
+  {
+    GEOS_ERROR_IF( m_linearSolverResult.breakdown(), getDataContext() << ": Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOS_WARNING_IF( !m_linearSolverResult.success(), getDataContext() << ": Linear solution failed" );
+  }
+}
+
 void SolidMechanicsLagrangianFEM::resetStateToBeginningOfStep( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
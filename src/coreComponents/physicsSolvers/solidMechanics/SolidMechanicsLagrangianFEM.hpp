@@ -159,6 +159,12 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs ) override;
 
+  virtual void
+  solveLinearSystem( DofManager const & dofManager,
+                     ParallelMatrix & matrix,
+                     ParallelVector & rhs,
+                     ParallelVector & solution ) override;
+
   virtual void resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
   virtual void implicitStepComplete( real64 const & time,
@@ -237,8 +243,10 @@ public:
     static constexpr char const * contactRelationNameString() { return "contactRelationName"; }
     static constexpr char const * noContactRelationNameString() { return "NOCONTACT"; }
     static constexpr char const * maxForceString() { return "maxForce"; }
+    static constexpr char const * useMatrixFreeOperatorString() { return "useMatrixFreeOperator"; }
     static constexpr char const * elemsAttachedToSendOrReceiveNodesString() { return "elemsAttachedToSendOrReceiveNodes"; }
     static constexpr char const * elemsNotAttachedToSendOrReceiveNodesString() { return "elemsNotAttachedToSendOrReceiveNodes"; }
+    static constexpr char const * useElementColoringString() { return "useElementColoring"; }
 
     static constexpr char const * sendOrReceiveNodesString() { return "sendOrReceiveNodes";}
     static constexpr char const * nonSendOrReceiveNodesString() { return "nonSendOrReceiveNodes";}
@@ -262,6 +270,17 @@ public:
     return subRegion.getReference< SortedArray< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesString() );
   }
 
+  /**
+   * @brief Get the name of the list containing the elements of a given color
+   * @param elementListName the name of the list that has been colored
+   * @param color the color
+   * @return the name of the list of the elements of this color
+   */
+  static string getElemColorListName( string const & elementListName, integer const color )
+  {
+    return GEOS_FMT( "{}Color{}", elementListName, color );
+  }
+
   real64 & getMaxForce() { return m_maxForce; }
 
   arrayView1d< ParallelVector > const & getRigidBodyModes() const
@@ -274,6 +293,14 @@ public:
     return m_rigidBodyModes;
   }
 
+  /**
+   * @brief Compute the rigid body modes of the displacement field, unless they were computed for the current mesh.
+   * @param mesh the mesh level holding the displacement field
+   * @param dofManager the degree-of-freedom manager of the system
+   * @return true if the modes were recomputed, in which case the preconditioners built with the previous modes must be recreated
+   */
+  bool updateRigidBodyModes( MeshLevel const & mesh, DofManager const & dofManager );
+
 protected:
   virtual void postProcessInput() override final;
 
@@ -293,12 +320,33 @@ protected:
   MPI_iCommData m_iComm;
   bool m_isFixedStressPoromechanicsUpdate;
 
+  /// Flag to apply the stiffness matrix-free in the Krylov solver
+  integer m_useMatrixFreeOperator;
+
+  /// Flag to color the elements so that the explicit kernels scatter the nodal forces without atomics
+  integer m_useElementColoring;
+
+  /// Maximum number of element colors over the sub-regions
+  integer m_numElementColors;
+
+  /// Local row mask of the Dirichlet constrained rows, used by the matrix-free operator
+  array1d< integer > m_dirichletRows;
+
   /// Rigid body modes
   array1d< ParallelVector > m_rigidBodyModes;
 
+  /// Modification timestamp of the mesh for which the rigid body modes were computed
+  Timestamp m_rigidBodyModesTimestamp;
+
 private:
   virtual void setConstitutiveNames( ElementSubRegionBase & subRegion ) const override;
 
+  /**
+   * @brief Split the element lists used by the explicit kernels into colors, such that no two elements of a color share a node
+   * @param domain the domain partition
+   */
+  void colorElements( DomainPartition & domain );
+
 };
 
 ENUM_STRINGS( SolidMechanicsLagrangianFEM::TimeIntegrationOption,
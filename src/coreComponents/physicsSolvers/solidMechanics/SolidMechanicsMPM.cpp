@@ -71,6 +71,7 @@ SolidMechanicsMPM::SolidMechanicsMPM( const string & name,
   m_reactionHistory( 0 ),
   m_needsNeighborList( 0 ),
   m_neighborRadius( -1.0 ),
+  m_neighborSkin( 0.0 ),
   m_binSizeMultiplier( 1 ),
   m_cpdiDomainScaling( 0 ),
   m_smallMass( DBL_MAX ),
@@ -155,6 +156,12 @@ SolidMechanicsMPM::SolidMechanicsMPM( const string & name,
     setApplyDefaultValue( -1.0 ).
     setDescription( "Neighbor radius for SPH-type calculations" );
 
+  registerWrapper( "neighborSkin", &m_neighborSkin ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Skin distance added to the neighbor radius when constructing the neighbor list. "
+                    "The list is then only reconstructed when a particle has moved by more than half the skin (serial runs only)" );
+
   registerWrapper( "binSizeMultiplier", &m_binSizeMultiplier ).
     setInputFlag( InputFlags::FALSE ).
     setApplyDefaultValue( 1 ).
@@ -247,6 +254,8 @@ void SolidMechanicsMPM::postProcessInput()
     m_needsNeighborList = 1;
   }
 
+  GEOS_ERROR_IF( m_neighborSkin < 0.0, "neighborSkin must be non-negative." );
+
   // Set number of active dimensions based on m_planeStrain
   m_numDims = m_planeStrain ? 2 : 3;
 
@@ -939,7 +948,7 @@ real64 SolidMechanicsMPM::explicitStep( real64 const & time_n,
   //#######################################################################################
   solverProfilingIf( "Construct neighbor list", m_needsNeighborList == 1 );
   //#######################################################################################
-  if( m_needsNeighborList == 1 )
+  if( m_needsNeighborList == 1 && neighborListNeedsUpdate( particleManager ) )
   { // This optimization compares neighbor list creation time for different
     // bin sizes, and finds an optimum.  It can be non deterministic and
     // is currently disabled to ensure integrated tests pass.
@@ -1921,8 +1930,11 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
   // Time this function
   real64 tStart = MPI_Wtime();
 
+  // Particles within the skin are included as well, so that the list remains valid while particles move by less than half the skin
+  real64 const searchRadius = m_neighborRadius + m_neighborSkin;
+
   // Expand bin limits by neighbor radius to account for the buffer zone of ghost particles outside the patch limits
-  real64 neighborRadiusSquared = m_neighborRadius * m_neighborRadius;
+  real64 neighborRadiusSquared = searchRadius * searchRadius;
   real64 xmin = m_xLocalMinNoGhost[0] - m_neighborRadius,
          xmax = m_xLocalMaxNoGhost[0] + m_neighborRadius,
          ymin = m_xLocalMinNoGhost[1] - m_neighborRadius,
@@ -1931,7 +1943,7 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
          zmax = m_xLocalMaxNoGhost[2] + m_neighborRadius;
 
   // Initialize bin sort
-  real64 binWidth = m_binSizeMultiplier * m_neighborRadius;
+  real64 binWidth = m_binSizeMultiplier * searchRadius;
   int nxbins = std::ceil( ( xmax - xmin ) / binWidth ),
       nybins = std::ceil( ( ymax - ymin ) / binWidth ),
       nzbins = m_planeStrain ? 1 : std::ceil( ( zmax - zmin ) / binWidth );
@@ -2021,12 +2033,12 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
 
         // Bin ijk indices bounding a sphere of radius m_neighborRadius centered at 'this' particle
         int imin, imax, jmin, jmax, kmin, kmax;
-        imin = std::floor( ( xA[a][0] - m_neighborRadius - xmin ) / dx ),
-        jmin = std::floor( ( xA[a][1] - m_neighborRadius - ymin ) / dy ),
-        kmin = std::floor( ( xA[a][2] - m_neighborRadius - zmin ) / dz );
-        imax = std::floor( ( xA[a][0] + m_neighborRadius - xmin ) / dx ),
-        jmax = std::floor( ( xA[a][1] + m_neighborRadius - ymin ) / dy ),
-        kmax = std::floor( ( xA[a][2] + m_neighborRadius - zmin ) / dz );
+        imin = std::floor( ( xA[a][0] - searchRadius - xmin ) / dx ),
+        jmin = std::floor( ( xA[a][1] - searchRadius - ymin ) / dy ),
+        kmin = std::floor( ( xA[a][2] - searchRadius - zmin ) / dz );
+        imax = std::floor( ( xA[a][0] + searchRadius - xmin ) / dx ),
+        jmax = std::floor( ( xA[a][1] + searchRadius - ymin ) / dy ),
+        kmax = std::floor( ( xA[a][2] + searchRadius - zmin ) / dz );
 
         // Adjust bin ijk indices if necessary
         imin = std::max( imin, 0 );
@@ -2091,9 +2103,63 @@ real64 SolidMechanicsMPM::computeNeighborList( ParticleManager & particleManager
       } );
   } );
 
+  // Save the particle positions to later check whether the list needs to be reconstructed
+  if( m_neighborSkin > 0.0 )
+  {
+    m_neighborListPositions.resize( 0 );
+    particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+    {
+      arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
+      m_neighborListPositions.emplace_back( particlePosition.size( 0 ), particlePosition.size( 1 ) );
+      m_neighborListPositions.back().setValues< serialPolicy >( particlePosition );
+    } );
+  }
+
   return( MPI_Wtime() - tStart );
 }
 
+bool SolidMechanicsMPM::neighborListNeedsUpdate( ParticleManager & particleManager )
+{
+  // Ghost particles are recreated at each step in parallel, so the list can only be reused in serial runs
+  if( m_neighborSkin <= 0.0 || MpiWrapper::commSize( MPI_COMM_GEOSX ) > 1 )
+  {
+    return true;
+  }
+
+  real64 const maxDisplacementSquared = 0.25 * m_neighborSkin * m_neighborSkin;
+  bool needsUpdate = false;
+  size_t subRegionIndex = 0;
+  particleManager.forParticleSubRegions( [&]( ParticleSubRegion & subRegion )
+  {
+    arrayView2d< real64 const > const particlePosition = subRegion.getParticleCenter();
+
+    // The list must be reconstructed if particles have been added or deleted since its construction
+    if( subRegionIndex >= m_neighborListPositions.size() ||
+        particlePosition.size( 0 ) != m_neighborListPositions[subRegionIndex].size( 0 ) )
+    {
+      needsUpdate = true;
+    }
+    else
+    {
+      arrayView2d< real64 const > const neighborListPosition = m_neighborListPositions[subRegionIndex].toViewConst();
+      RAJA::ReduceMax< serialReduce, real64 > displacementSquared( 0.0 );
+      forAll< serialPolicy >( particlePosition.size( 0 ), [=] GEOS_HOST ( localIndex const p )
+      {
+        real64 rSquared = 0.0;
+        for( int i=0; i<3; i++ )
+        {
+          rSquared += ( particlePosition[p][i] - neighborListPosition[p][i] ) * ( particlePosition[p][i] - neighborListPosition[p][i] );
+        }
+        displacementSquared.max( rSquared );
+      } );
+      needsUpdate = needsUpdate || displacementSquared.get() > maxDisplacementSquared;
+    }
+    subRegionIndex++;
+  } );
+
+  return needsUpdate || subRegionIndex != m_neighborListPositions.size();
+}
+
 void SolidMechanicsMPM::optimizeBinSort( ParticleManager & particleManager )
 {
   // Each partition determines its optimal multiplier which results in the minimum time for neighbor list construction
@@ -2836,10 +2902,10 @@ void SolidMechanicsMPM::particleToGrid( ParticleManager & particleManager,
     int const numDims = m_numDims;
     int voigtMap[3][3] = { {0, 5, 4}, {5, 1, 3}, {4, 3, 2} };
     int const damageFieldPartitioning = m_damageFieldPartitioning;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp ) // Can be parallized using atomics -
-                                                                                                // remember to pass copies of class
-                                                                                                // variables
-      {                                                                                          // Grid max damage will require reduction
+    int const numContactGroups = m_numContactGroups;
+    // particles sharing grid nodes are processed concurrently, hence the atomic updates of the grid fields
+    forAll< parallelHostPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp )
+      {
         localIndex const p = activeParticleIndices[pp];
 
         for( int g = 0; g < 8 * numberOfVerticesPerParticle; g++ )
@@ -2854,20 +2920,23 @@ void SolidMechanicsMPM::particleToGrid( ParticleManager & particleManager,
                                                                                                                                                                              // for
                                                                                                                                                                              // "B"
                                                                                                                                                                              // field
-          int const fieldIndex = nodeFlag * m_numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
-          gridMass[mappedNode][fieldIndex] += particleMass[p] * shapeFunctionValues[pp][g];
+          int const fieldIndex = nodeFlag * numContactGroups + particleGroup[p]; // This ranges from 0 to nMatFields-1
+          RAJA::atomicAdd( parallelHostAtomic{}, &gridMass[mappedNode][fieldIndex], particleMass[p] * shapeFunctionValues[pp][g] );
           // TODO: Normalizing by volume might be better
-          gridDamage[mappedNode][fieldIndex] += particleMass[p] * ( particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp] ) * shapeFunctionValues[pp][g];
-          gridMaxDamage[mappedNode][fieldIndex] = fmax( gridMaxDamage[mappedNode][fieldIndex], particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp] );
+          RAJA::atomicAdd( parallelHostAtomic{}, &gridDamage[mappedNode][fieldIndex],
+                           particleMass[p] * ( particleSurfaceFlag[p] == 1 ? 1 : particleDamage[pp] ) * shapeFunctionValues[pp][g] );
+          RAJA::atomicMax( parallelHostAtomic{}, &gridMaxDamage[mappedNode][fieldIndex], particleSurfaceFlag[p] == 1 ? 1.0 : particleDamage[pp] );
           for( int i=0; i<numDims; i++ )
           {
-            gridMomentum[mappedNode][fieldIndex][i] += particleMass[p] * particleVelocity[p][i] * shapeFunctionValues[pp][g];
+            RAJA::atomicAdd( parallelHostAtomic{}, &gridMomentum[mappedNode][fieldIndex][i], particleMass[p] * particleVelocity[p][i] * shapeFunctionValues[pp][g] );
             // TODO: Switch to volume weighting?
-            gridMaterialPosition[mappedNode][fieldIndex][i] += particleMass[p] * (particlePosition[p][i] - gridPosition[mappedNode][i]) * shapeFunctionValues[pp][g];
+            RAJA::atomicAdd( parallelHostAtomic{}, &gridMaterialPosition[mappedNode][fieldIndex][i],
+                             particleMass[p] * (particlePosition[p][i] - gridPosition[mappedNode][i]) * shapeFunctionValues[pp][g] );
             for( int k=0; k<numDims; k++ )
             {
               int voigt = voigtMap[k][i];
-              gridInternalForce[mappedNode][fieldIndex][i] -= particleStress[p][voigt] * shapeFunctionGradientValues[pp][g][k] * particleVolume[p];
+              RAJA::atomicSub( parallelHostAtomic{}, &gridInternalForce[mappedNode][fieldIndex][i],
+                               particleStress[p][voigt] * shapeFunctionGradientValues[pp][g][k] * particleVolume[p] );
             }
           }
         }
@@ -3089,7 +3158,8 @@ void SolidMechanicsMPM::gridToParticle( real64 dt,
     int const numDims = m_numDims;
     int const damageFieldPartitioning = m_damageFieldPartitioning;
     int const numContactGroups = m_numContactGroups;
-    forAll< serialPolicy >( activeParticleIndices.size(), [=] GEOS_HOST_DEVICE ( localIndex const pp )
+    // each particle only gathers from the grid, so the particles can be processed concurrently
+    forAll< parallelHostPolicy >( activeParticleIndices.size(), [=] GEOS_HOST ( localIndex const pp )
     {
       localIndex const p = activeParticleIndices[pp];
 
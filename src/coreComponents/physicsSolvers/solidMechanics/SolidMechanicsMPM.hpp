@@ -258,6 +258,8 @@ public:
 
   real64 computeNeighborList( ParticleManager & particleManager );
 
+  bool neighborListNeedsUpdate( ParticleManager & particleManager );
+
   void optimizeBinSort( ParticleManager & particleManager );
 
   real64 kernel( real64 const & r ); // distance from particle to query point
@@ -395,7 +397,9 @@ protected:
 
   int m_needsNeighborList;
   real64 m_neighborRadius;
+  real64 m_neighborSkin;
   int m_binSizeMultiplier;
+  std::vector< array2d< real64 > > m_neighborListPositions; // Particle positions at the last neighbor list construction, by subregion
 
   int m_useDamageAsSurfaceFlag;
 
@@ -0,0 +1,150 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#define GEOSX_DISPATCH_VEM /// enables VEM in FiniteElementDispatch
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+
+#include "SolidMechanicsLagrangianFEM.hpp"
+#include "kernels/SmallStrainStiffnessApply.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+
+namespace geos
+{
+
+using namespace dataRepository;
+using namespace fields;
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                                                    DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    ParallelMatrix const & matrix,
+                                                                    arrayView1d< integer const > const & dirichletRows ):
+  LinearOperator< ParallelVector >(),
+  m_solver( solver ),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_dirichletRows( dirichletRows ),
+  m_numGlobalRows( matrix.numGlobalRows() ),
+  m_numLocalRows( matrix.numLocalRows() ),
+  m_comm( matrix.comm() )
+{
+  GEOS_ERROR_IF_NE( m_dirichletRows.size(), m_numLocalRows );
+
+  m_diagonal.create( m_numLocalRows, m_comm );
+  matrix.extractDiagonal( m_diagonal );
+
+  // ghost values of the input are filled by synchronization, make sure nodes without dofs hold zeros
+  m_solver.forDiscretizationOnMeshTargets( m_domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & )
+  {
+    mesh.getNodeManager().getField< solidMechanics::matrixFreeInput >().zero();
+  } );
+}
+
+void SolidMechanicsMatrixFreeOperator::apply( ParallelVector const & src,
+                                              ParallelVector & dst ) const
+{
+  GEOS_MARK_FUNCTION;
+
+  m_dofManager.copyVectorToField( src.values(),
+                                  solidMechanics::totalDisplacement::key(),
+                                  solidMechanics::matrixFreeInput::key(),
+                                  1.0 );
+
+  m_solver.forDiscretizationOnMeshTargets( m_domain.getMeshBodies(), [&] ( string const &,
+                                                                           MeshLevel & mesh,
+                                                                           arrayView1d< string const > const & regionNames )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    FieldIdentifiers fieldsToBeSync;
+    fieldsToBeSync.addFields( FieldLocation::Node, { solidMechanics::matrixFreeInput::key() } );
+
+    CommunicationTools::getInstance().synchronizeFieldsPersistent( fieldsToBeSync,
+                                                                   mesh,
+                                                                   m_domain.getNeighbors(),
+                                                                   true );
+
+    arrayView2d< real64 > const output = nodeManager.getField< solidMechanics::matrixFreeOutput >();
+    output.zero();
+
+    solidMechanicsLagrangianFEMKernels::
+      SmallStrainStiffnessApplyFactory kernelFactory( nodeManager.getField< solidMechanics::matrixFreeInput >().toViewConst(),
+                                                      output );
+
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< >,
+                                    constitutive::SolidBase,
+                                    CellElementSubRegion >( mesh,
+                                                            regionNames,
+                                                            m_solver.getDiscretizationName(),
+                                                            SolidMechanicsLagrangianFEM::viewKeyStruct::solidMaterialNamesString(),
+                                                            kernelFactory );
+  } );
+
+  arrayView1d< real64 > const localDst = dst.open();
+
+  m_dofManager.copyFieldToVector( localDst,
+                                  solidMechanics::matrixFreeOutput::key(),
+                                  solidMechanics::totalDisplacement::key(),
+                                  1.0 );
+
+  arrayView1d< real64 const > const localSrc = src.values();
+  arrayView1d< real64 const > const localDiag = m_diagonal.values();
+  arrayView1d< integer const > const dirichletRows = m_dirichletRows;
+  forAll< parallelDevicePolicy<> >( m_numLocalRows, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    if( dirichletRows[i] )
+    {
+      localDst[i] = localDiag[i] * localSrc[i];
+    }
+  } );
+
+  dst.close();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalRows() const
+{
+  return m_numGlobalRows;
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalCols() const
+{
+  return m_numGlobalRows;
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalRows() const
+{
+  return m_numLocalRows;
+}
+
+localIndex SolidMechanicsMatrixFreeOperator::numLocalCols() const
+{
+  return m_numLocalRows;
+}
+
+MPI_Comm SolidMechanicsMatrixFreeOperator::comm() const
+{
+  return m_comm;
+}
+
+} // namespace geos
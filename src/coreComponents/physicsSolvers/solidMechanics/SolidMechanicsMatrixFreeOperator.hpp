@@ -0,0 +1,106 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/common/LinearOperator.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+namespace geos
+{
+
+class DofManager;
+class DomainPartition;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ * @brief Applies the quasi-static small strain stiffness operator without using the assembled matrix.
+ *
+ * The action of the operator is computed element by element with the
+ * solidMechanicsLagrangianFEMKernels::SmallStrainStiffnessApply kernel, using the
+ * nodal fields solidMechanics::matrixFreeInput and solidMechanics::matrixFreeOutput
+ * as work arrays. Rows constrained by a Dirichlet boundary condition are replaced by
+ * their diagonal entry, consistently with FieldSpecificationEqual::SpecifyFieldValue.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param solver the solid mechanics solver providing mesh targets and discretization
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager of the linear system
+   * @param matrix the matrix holding only the assembled diagonal of the Jacobian, used for the constrained rows
+   * @param dirichletRows local row mask, nonzero for rows constrained by a Dirichlet condition
+   */
+  SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                    DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    ParallelMatrix const & matrix,
+                                    arrayView1d< integer const > const & dirichletRows );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~SolidMechanicsMatrixFreeOperator() override = default;
+
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override;
+
+  virtual globalIndex numGlobalRows() const override;
+
+  virtual globalIndex numGlobalCols() const override;
+
+  virtual localIndex numLocalRows() const override;
+
+  virtual localIndex numLocalCols() const override;
+
+  virtual MPI_Comm comm() const override;
+
+private:
+
+  /// The solid mechanics solver
+  SolidMechanicsLagrangianFEM const & m_solver;
+
+  /// The domain partition holding the nodal work arrays
+  DomainPartition & m_domain;
+
+  /// The degree-of-freedom manager
+  DofManager const & m_dofManager;
+
+  /// Local row mask of the Dirichlet constrained rows
+  arrayView1d< integer const > const m_dirichletRows;
+
+  /// Assembled diagonal of the Jacobian
+  ParallelVector m_diagonal;
+
+  /// Number of global rows and columns
+  globalIndex const m_numGlobalRows;
+
+  /// Number of local rows and columns
+  localIndex const m_numLocalRows;
+
+  /// MPI communicator
+  MPI_Comm const m_comm;
+};
+
+} // namespace geos
+
+#endif //GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
@@ -77,6 +77,102 @@ bool SolidMechanicsStatistics::execute( real64 const GEOS_UNUSED_PARAM( time_n )
   return false;
 }
 
+ExecutableGroup::ReadOnlyTask SolidMechanicsStatistics::executeReadOnly( real64 const GEOS_UNUSED_PARAM( time_n ),
+                                                                         real64 const GEOS_UNUSED_PARAM( dt ),
+                                                                         integer const GEOS_UNUSED_PARAM( cycleNumber ),
+                                                                         integer const GEOS_UNUSED_PARAM( eventCounter ),
+                                                                         real64 const GEOS_UNUSED_PARAM( eventProgress ),
+                                                                         DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  // Host copy of the displacement of each mesh target, and its local min/max once computed
+  struct Snapshot
+  {
+    NodeStatistics * nodeStatistics;
+    array2d< real64 > displacement;
+    array1d< integer > ghostRank;
+    real64 minDisplacement[3];
+    real64 maxDisplacement[3];
+  };
+  auto const snapshots = std::make_shared< std::vector< Snapshot > >();
+
+  // Step 1: capture the displacement at the end of the step
+
+  m_solver->forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                          MeshLevel & mesh,
+                                                                          arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    solidMechanics::arrayViewConst2dLayoutTotalDisplacement const u =
+      nodeManager.getField< solidMechanics::totalDisplacement >();
+    u.move( hostMemorySpace, false );
+    ghostRank.move( hostMemorySpace, false );
+
+    snapshots->emplace_back();
+    Snapshot & snapshot = snapshots->back();
+    snapshot.nodeStatistics = &nodeManager.getReference< NodeStatistics >( viewKeyStruct::nodeStatisticsString() );
+    snapshot.displacement.resize( nodeManager.size(), 3 );
+    snapshot.ghostRank.resize( nodeManager.size() );
+
+    arrayView2d< real64 > const displacement = snapshot.displacement.toView();
+    arrayView1d< integer > const ghostRankCopy = snapshot.ghostRank.toView();
+    forAll< parallelHostPolicy >( nodeManager.size(), [=] ( localIndex const a )
+    {
+      ghostRankCopy[a] = ghostRank[a];
+      for( integer i = 0; i < 3; ++i )
+      {
+        displacement[a][i] = u[a][i];
+      }
+    } );
+  } );
+
+  ExecutableGroup::ReadOnlyTask task;
+
+  // Step 2: compute the local min/max quantities on a task thread
+
+  task.compute = [snapshots]()
+  {
+    for( Snapshot & snapshot : *snapshots )
+    {
+      for( integer i = 0; i < 3; ++i )
+      {
+        snapshot.minDisplacement[i] = LvArray::NumericLimits< real64 >::max;
+        snapshot.maxDisplacement[i] = -LvArray::NumericLimits< real64 >::max;
+      }
+      for( localIndex a = 0; a < snapshot.ghostRank.size(); ++a )
+      {
+        if( snapshot.ghostRank[a] < 0 )
+        {
+          for( integer i = 0; i < 3; ++i )
+          {
+            snapshot.minDisplacement[i] = LvArray::math::min( snapshot.minDisplacement[i], snapshot.displacement[a][i] );
+            snapshot.maxDisplacement[i] = LvArray::math::max( snapshot.maxDisplacement[i], snapshot.displacement[a][i] );
+          }
+        }
+      }
+    }
+  };
+
+  // Step 3: synchronize the results over the MPI ranks on the main thread
+
+  task.complete = [this, snapshots]()
+  {
+    for( Snapshot const & snapshot : *snapshots )
+    {
+      for( integer i = 0; i < 3; ++i )
+      {
+        snapshot.nodeStatistics->minDisplacement[i] = snapshot.minDisplacement[i];
+        snapshot.nodeStatistics->maxDisplacement[i] = snapshot.maxDisplacement[i];
+      }
+      synchronizeNodeStatistics( *snapshot.nodeStatistics );
+    }
+  };
+
+  return task;
+}
+
 void SolidMechanicsStatistics::computeNodeStatistics( MeshLevel & mesh ) const
 {
   GEOS_MARK_FUNCTION;
@@ -126,6 +222,11 @@ void SolidMechanicsStatistics::computeNodeStatistics( MeshLevel & mesh ) const
   nodeStatistics.minDisplacement[1] = minDispY.get();
   nodeStatistics.minDisplacement[2] = minDispZ.get();
 
+  synchronizeNodeStatistics( nodeStatistics );
+}
+
+void SolidMechanicsStatistics::synchronizeNodeStatistics( NodeStatistics & nodeStatistics ) const
+{
   MpiWrapper::allReduce( nodeStatistics.maxDisplacement.data(),
                          nodeStatistics.maxDisplacement.data(),
                          3,
@@ -60,6 +60,16 @@ public:
                         real64 const eventProgress,
                         DomainPartition & domain ) override;
 
+  virtual bool supportsReadOnlyExecution() const override
+  { return true; }
+
+  virtual ReadOnlyTask executeReadOnly( real64 const time_n,
+                                        real64 const dt,
+                                        integer const cycleNumber,
+                                        integer const eventCounter,
+                                        real64 const eventProgress,
+                                        DomainPartition & domain ) override;
+
   /**@}*/
 
   /**
@@ -89,6 +99,12 @@ private:
     array1d< real64 > maxDisplacement;
   };
 
+  /**
+   * @brief Reduce the local min/max displacements stored in the node statistics over the MPI ranks and log them
+   * @param[in,out] nodeStatistics the node statistics
+   */
+  void synchronizeNodeStatistics( NodeStatistics & nodeStatistics ) const;
+
   void registerDataOnMesh( Group & meshBodies ) override;
 };
 
@@ -84,7 +84,8 @@ public:
                         FE_TYPE const & finiteElementSpace,
                         CONSTITUTIVE_TYPE & inputConstitutiveType,
                         real64 const dt,
-                        string const elementListName );
+                        string const elementListName,
+                        integer const useAtomics );
 
 
   //*****************************************************************************
@@ -144,7 +145,8 @@ public:
 /// The factory used to construct a ExplicitFiniteStrain kernel.
 using ExplicitFiniteStrainFactory = finiteElement::KernelFactory< ExplicitFiniteStrain,
                                                                   real64,
-                                                                  string const >;
+                                                                  string const,
+                                                                  integer const >;
 
 } // namespace solidMechanicsLagrangianFEMKernels
 
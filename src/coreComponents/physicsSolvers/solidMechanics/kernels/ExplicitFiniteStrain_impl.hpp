@@ -41,7 +41,8 @@ ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitFini
                                                                                           FE_TYPE const & finiteElementSpace,
                                                                                           CONSTITUTIVE_TYPE & inputConstitutiveType,
                                                                                           real64 const dt,
-                                                                                          string const elementListName ):
+                                                                                          string const elementListName,
+                                                                                          integer const useAtomics ):
   Base( nodeManager,
         edgeManager,
         faceManager,
@@ -50,7 +51,8 @@ ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitFini
         finiteElementSpace,
         inputConstitutiveType,
         dt,
-        elementListName )
+        elementListName,
+        useAtomics )
 {}
 
 template< typename SUBREGION_TYPE,
@@ -66,9 +68,7 @@ void ExplicitFiniteStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::setup(
     localIndex const nodeIndex = m_elemsToNodes( k, a );
     for( int i=0; i<numDofPerTrialSupportPoint; ++i )
     {
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
       stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
-#endif
       stack.uLocal[ a ][ i ] = m_u[ nodeIndex ][ i ];
       stack.varLocal[ a ][ i ] = m_vel[ nodeIndex ][ i ];
     }
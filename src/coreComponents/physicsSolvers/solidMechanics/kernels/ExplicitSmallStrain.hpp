@@ -96,6 +96,8 @@ public:
    * @param dt The time interval for the step.
    * @param elementListName The name of the entry that holds the list of
    *   elements to be processed during this kernel launch.
+   * @param useAtomics Flag to scatter the nodal forces with atomics, which is
+   *   not needed when no two elements of the list share a node.
    */
   ExplicitSmallStrain( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -105,7 +107,8 @@ public:
                        FE_TYPE const & finiteElementSpace,
                        CONSTITUTIVE_TYPE & inputConstitutiveType,
                        real64 const dt,
-                       string const elementListName );
+                       string const elementListName,
+                       integer const useAtomics );
 
   //*****************************************************************************
   /**
@@ -130,13 +133,8 @@ public:
     /// C-array stack storage for element local primary variable values.
     real64 varLocal[ numNodesPerElem ][ numDofPerTestSupportPoint ];
 
-#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
-    /// Dummy
-    int xLocal;
-#else
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ];
-#endif
   };
   //***************************************************************************
 
@@ -208,6 +206,9 @@ protected:
   /// The list of elements to process for the kernel launch.
   SortedArrayView< localIndex const > const m_elementList;
 
+  /// Flag to scatter the nodal forces with atomics
+  integer const m_useAtomics;
+
 
 };
 
@@ -216,7 +217,8 @@ protected:
 /// The factory used to construct a ExplicitSmallStrain kernel.
 using ExplicitSmallStrainFactory = finiteElement::KernelFactory< ExplicitSmallStrain,
                                                                  real64,
-                                                                 string const >;
+                                                                 string const,
+                                                                 integer const >;
 
 
 
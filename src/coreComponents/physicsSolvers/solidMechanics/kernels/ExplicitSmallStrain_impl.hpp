@@ -42,7 +42,8 @@ ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitSmall
                                                                                         FE_TYPE const & finiteElementSpace,
                                                                                         CONSTITUTIVE_TYPE & inputConstitutiveType,
                                                                                         real64 const dt,
-                                                                                        string const elementListName ):
+                                                                                        string const elementListName,
+                                                                                        integer const useAtomics ):
   Base( elementSubRegion,
         finiteElementSpace,
         inputConstitutiveType ),
@@ -51,7 +52,8 @@ ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::ExplicitSmall
   m_vel( nodeManager.getField< fields::solidMechanics::velocity >() ),
   m_acc( nodeManager.getField< fields::solidMechanics::acceleration >() ),
   m_dt( dt ),
-  m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() )
+  m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() ),
+  m_useAtomics( useAtomics )
 {
   GEOS_UNUSED_VAR( edgeManager );
   GEOS_UNUSED_VAR( faceManager );
@@ -72,9 +74,7 @@ void ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::setup( l
     localIndex const nodeIndex = m_elemsToNodes( k, a );
     for( int i=0; i<numDofPerTrialSupportPoint; ++i )
     {
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
       stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
-#endif
 
 #if UPDATE_STRESS==2
       stack.varLocal[ a ][ i ] = m_vel[ nodeIndex ][ i ] * m_dt;
@@ -169,7 +169,14 @@ real64 ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::comple
     localIndex const nodeIndex = m_elemsToNodes( k, a );
     for( int b = 0; b < numDofPerTestSupportPoint; ++b )
     {
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+      if( m_useAtomics )
+      {
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+      }
+      else
+      {
+        m_acc( nodeIndex, b ) += stack.fLocal[ a ][ b ];
+      }
     }
   }
   return 0;
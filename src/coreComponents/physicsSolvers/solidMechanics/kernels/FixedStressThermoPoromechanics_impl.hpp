@@ -93,9 +93,7 @@ setup( localIndex const k,
 
     for( int i = 0; i < 3; ++i )
     {
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
       stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
-#endif
       stack.u_local[ a ][i] = m_disp[ localNodeIndex ][i];
       stack.uhat_local[ a ][i] = m_uhat[ localNodeIndex ][i];
       stack.localRowDofIndex[a*3+i] = m_dofNumber[localNodeIndex]+i;
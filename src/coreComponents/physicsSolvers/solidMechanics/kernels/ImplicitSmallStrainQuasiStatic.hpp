@@ -127,13 +127,8 @@ public:
                                        constitutiveStiffness()
     {}
 
-#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
-    /// Dummy
-    int xLocal;
-#else
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ];
-#endif
 
     /// Stack storage for the element local nodal displacement
     real64 u_local[numNodesPerElem][numDofPerTrialSupportPoint];
@@ -265,6 +260,96 @@ using QuasiStaticFactory = finiteElement::KernelFactory< ImplicitSmallStrainQuas
                                                          real64 const,
                                                          real64 const (&)[3] >;
 
+/**
+ * @brief Implements the residual of ImplicitSmallStrainQuasiStatic and only the diagonal of its Jacobian.
+ * @copydoc ImplicitSmallStrainQuasiStatic
+ *
+ * ### ImplicitSmallStrainQuasiStaticDiagonal Description
+ * Used by the matrix-free solve of SolidMechanicsLagrangianFEM: the product with the Jacobian
+ * is applied by SmallStrainStiffnessApply, and the matrix only has a diagonal sparsity pattern,
+ * holding the diagonal used by the Jacobi preconditioner and by the Dirichlet rows. The element
+ * Jacobian is still computed, but only its diagonal entries are added to the matrix.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ImplicitSmallStrainQuasiStaticDiagonal :
+  public ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                         CONSTITUTIVE_TYPE,
+                                         FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = ImplicitSmallStrainQuasiStatic< SUBREGION_TYPE,
+                                               CONSTITUTIVE_TYPE,
+                                               FE_TYPE >;
+
+  using Base::Base;
+  using typename Base::StackVariables;
+  using Base::numDofPerTestSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_finiteElementSpace;
+
+  /**
+   * @copydoc geos::finiteElement::ImplicitKernelBase::complete
+   *
+   * Adds the element residual to the global vector, and the diagonal of the element Jacobian to the
+   * diagonal of the global matrix.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOS_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+    for( int localNode = 0; localNode < numSupportPoints; ++localNode )
+    {
+      for( int dim = 0; dim < numDofPerTestSupportPoint; ++dim )
+      {
+        localIndex const i = numDofPerTestSupportPoint * localNode + dim;
+        localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+        if( dof < 0 || dof >= m_matrix.numRows() )
+          continue;
+        m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                                &stack.localRowDofIndex[ i ],
+                                                                                &stack.localJacobian[ i ][ i ],
+                                                                                1 );
+
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+        maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+      }
+    }
+    return maxForce;
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+  }
+};
+
+/// The factory used to construct a QuasiStatic kernel assembling only the diagonal of the Jacobian.
+using QuasiStaticDiagonalFactory = finiteElement::KernelFactory< ImplicitSmallStrainQuasiStaticDiagonal,
+                                                                 arrayView1d< globalIndex const > const,
+                                                                 globalIndex,
+                                                                 CRSMatrixView< real64, globalIndex const > const,
+                                                                 arrayView1d< real64 > const,
+                                                                 real64 const,
+                                                                 real64 const (&)[3] >;
+
 } // namespace solidMechanicsLagrangianFEMKernels
 
 } // namespace geos
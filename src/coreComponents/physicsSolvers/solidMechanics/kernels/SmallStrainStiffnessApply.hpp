@@ -0,0 +1,201 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SmallStrainStiffnessApply.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_SMALLSTRAINSTIFFNESSAPPLY_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_SMALLSTRAINSTIFFNESSAPPLY_HPP_
+
+#include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsFields.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Implements the action of the small strain stiffness operator on a nodal vector.
+ * @copydoc geos::finiteElement::KernelBase
+ * @tparam SUBREGION_TYPE The type of subregion that the kernel will act on.
+ *
+ * ### SmallStrainStiffnessApply Description
+ * Computes y += A x element by element without forming the global matrix, where A
+ * is the operator assembled by ImplicitSmallStrainQuasiStatic (including its sign
+ * convention and the virtual element stabilization). The elastic stiffness of the
+ * constitutive model is used, which is the tangent of the linear elastic models only,
+ * the ones SolidMechanicsLagrangianFEM accepts with its matrix-free solve.
+ *
+ * The input vector must hold valid values on ghost nodes. The kernel is launched on
+ * all elements (ghosts included) so that the output is complete on locally owned nodes.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class SmallStrainStiffnessApply : public finiteElement::KernelBase< SUBREGION_TYPE,
+                                                                    CONSTITUTIVE_TYPE,
+                                                                    FE_TYPE,
+                                                                    3,
+                                                                    3 >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          3,
+                                          3 >;
+
+  /// Maximum number of nodes per element, which is equal to the maxNumTestSupportPointPerElem and
+  /// maxNumTrialSupportPointPerElem by definition.
+  static constexpr int numNodesPerElem = Base::maxNumTestSupportPointsPerElem;
+
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  /**
+   * @brief Constructor
+   * @copydoc geos::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   * @param input The nodal input vector x.
+   * @param output The nodal output vector y, to which A x is added.
+   */
+  SmallStrainStiffnessApply( NodeManager & nodeManager,
+                             EdgeManager const & edgeManager,
+                             FaceManager const & faceManager,
+                             localIndex const targetRegionIndex,
+                             SUBREGION_TYPE const & elementSubRegion,
+                             FE_TYPE const & finiteElementSpace,
+                             CONSTITUTIVE_TYPE & inputConstitutiveType,
+                             arrayView2d< real64 const > const input,
+                             arrayView2d< real64 > const output );
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::StackVariables
+   *
+   * ### SmallStrainStiffnessApply Description
+   * Adds stack arrays for the element input and output vectors.
+   */
+  struct StackVariables : Base::StackVariables
+  {
+public:
+    GEOS_HOST_DEVICE
+    StackVariables():
+      xLocal(),
+      inLocal{ {0.0} },
+      outLocal{ {0.0} }
+    {}
+
+    /// C-array stack storage for element local the nodal positions.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// C-array stack storage for the element local input vector.
+    real64 inLocal[ numNodesPerElem ][ numDofPerTrialSupportPoint ];
+
+    /// C-array stack storage for the element local output vector.
+    real64 outLocal[ numNodesPerElem ][ numDofPerTestSupportPoint ];
+
+    /// Stack variables needed for the underlying FEM type
+    typename FE_TYPE::StackVariables feStack;
+  };
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::setup
+   *
+   * Copies the input vector and nodal positions into the local stack arrays.
+   */
+  GEOS_HOST_DEVICE
+  void setup( localIndex const k,
+              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### SmallStrainStiffnessApply Description
+   * Computes the strain of the input vector, the corresponding elastic stress and
+   * integrates its divergence into the element output vector.
+   */
+  GEOS_HOST_DEVICE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * ### SmallStrainStiffnessApply Description
+   * Adds the stabilization contribution and scatters the element output vector
+   * to the nodal output array.
+   */
+  GEOS_HOST_DEVICE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const;
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::kernelLaunch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent );
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The nodal input vector.
+  arrayView2d< real64 const > const m_input;
+
+  /// The nodal output vector.
+  arrayView2d< real64 > const m_output;
+
+  /// Data structure containing mesh data used to setup the finite element
+  typename FE_TYPE::template MeshData< SUBREGION_TYPE > m_meshData;
+
+  /**
+   * @brief Get a parameter representative of the stiffness, used as physical scaling for the
+   * stabilization matrix.
+   * @param[in] k Element index.
+   * @return A parameter representative of the stiffness matrix dstress/dstrain
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 computeStabilizationScaling( localIndex const k ) const
+  {
+    // Must match ImplicitSmallStrainQuasiStatic::computeStabilizationScaling
+    return 2.0 * m_constitutiveUpdate.getShearModulus( k );
+  }
+};
+
+/// The factory used to construct a SmallStrainStiffnessApply kernel.
+using SmallStrainStiffnessApplyFactory = finiteElement::KernelFactory< SmallStrainStiffnessApply,
+                                                                       arrayView2d< real64 const > const,
+                                                                       arrayView2d< real64 > const >;
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif //GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_SMALLSTRAINSTIFFNESSAPPLY_HPP_
@@ -0,0 +1,155 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SmallStrainStiffnessApply_impl.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_SMALLSTRAINSTIFFNESSAPPLY_IMPL_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_SMALLSTRAINSTIFFNESSAPPLY_IMPL_HPP_
+
+#include "SmallStrainStiffnessApply.hpp"
+
+namespace geos
+{
+
+namespace solidMechanicsLagrangianFEMKernels
+{
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+SmallStrainStiffnessApply< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+SmallStrainStiffnessApply( NodeManager & nodeManager,
+                           EdgeManager const & edgeManager,
+                           FaceManager const & faceManager,
+                           localIndex const targetRegionIndex,
+                           SUBREGION_TYPE const & elementSubRegion,
+                           FE_TYPE const & finiteElementSpace,
+                           CONSTITUTIVE_TYPE & inputConstitutiveType,
+                           arrayView2d< real64 const > const input,
+                           arrayView2d< real64 > const output ):
+  Base( elementSubRegion,
+        finiteElementSpace,
+        inputConstitutiveType ),
+  m_X( nodeManager.referencePosition() ),
+  m_input( input ),
+  m_output( output )
+{
+  finiteElement::FiniteElementBase::initialize< FE_TYPE >( nodeManager,
+                                                           edgeManager,
+                                                           faceManager,
+                                                           elementSubRegion,
+                                                           m_meshData );
+  GEOS_UNUSED_VAR( targetRegionIndex );
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void SmallStrainStiffnessApply< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+setup( localIndex const k,
+       StackVariables & stack ) const
+{
+  m_finiteElementSpace.template setup< FE_TYPE >( k, m_meshData, stack.feStack );
+
+  localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  for( localIndex a = 0; a < numSupportPoints; ++a )
+  {
+    localIndex const localNodeIndex = m_elemsToNodes( k, a );
+
+    for( int i = 0; i < numDofPerTrialSupportPoint; ++i )
+    {
+      stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+      stack.inLocal[ a ][ i ] = m_input[ localNodeIndex ][ i ];
+    }
+  }
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+void SmallStrainStiffnessApply< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+quadraturePointKernel( localIndex const k,
+                       localIndex const q,
+                       StackVariables & stack ) const
+{
+  real64 dNdX[ numNodesPerElem ][ 3 ];
+  real64 const detJxW = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, stack.feStack, dNdX );
+
+  real64 strain[6] = {0};
+  FE_TYPE::symmetricGradient( dNdX, stack.inLocal, strain );
+
+  real64 stiffness[6][6] = {{0}};
+  m_constitutiveUpdate.getElasticStiffness( k, q, stiffness );
+
+  // same sign convention as the Jacobian of ImplicitSmallStrainQuasiStatic
+  real64 stress[6] = {0};
+  LvArray::tensorOps::Ri_eq_AijBj< 6, 6 >( stress, stiffness, strain );
+  LvArray::tensorOps::scale< 6 >( stress, -detJxW );
+
+  FE_TYPE::plusGradNajAij( dNdX, stress, stack.outLocal );
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+GEOS_HOST_DEVICE
+GEOS_FORCE_INLINE
+real64 SmallStrainStiffnessApply< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::
+complete( localIndex const k,
+          StackVariables & stack ) const
+{
+  // Add stabilization to block diagonal parts (this is a no-operation with FEM classes)
+  real64 const stabilizationScaling = computeStabilizationScaling( k );
+  m_finiteElementSpace.template addEvaluatedGradGradStabilizationVector< FE_TYPE, numDofPerTrialSupportPoint >( stack.feStack,
+                                                                                                                stack.inLocal,
+                                                                                                                stack.outLocal,
+                                                                                                                -stabilizationScaling );
+
+  localIndex const numSupportPoints = m_finiteElementSpace.template numSupportPoints< FE_TYPE >( stack.feStack );
+
+  for( localIndex a = 0; a < numSupportPoints; ++a )
+  {
+    localIndex const localNodeIndex = m_elemsToNodes( k, a );
+    for( int i = 0; i < numDofPerTestSupportPoint; ++i )
+    {
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_output( localNodeIndex, i ), stack.outLocal[ a ][ i ] );
+    }
+  }
+  return 0;
+}
+
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+template< typename POLICY,
+          typename KERNEL_TYPE >
+real64
+SmallStrainStiffnessApply< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch( localIndex const numElems,
+                                                                                       KERNEL_TYPE const & kernelComponent )
+{
+  return Base::template kernelLaunch< POLICY, KERNEL_TYPE >( numElems, kernelComponent );
+}
+
+} // namespace solidMechanicsLagrangianFEMKernels
+
+} // namespace geos
+
+#endif //GEOS_PHYSICSSOLVERS_SOLIDMECHANICS_KERNELS_SMALLSTRAINSTIFFNESSAPPLY_IMPL_HPP_
@@ -4,11 +4,21 @@
 
 set( kernelPath "coreComponents/physicsSolvers/solidMechanics/kernels" )
 
-set( ExplicitSmallStrainPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( ExplicitFiniteStrainPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( FixedStressThermoPoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( ImplicitSmallStrainNewmarkPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
-set( ImplicitSmallStrainQuasiStaticPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >" )
+# Cache variables, see PoromechanicsKernels.cmake
+set( ExplicitSmallStrainPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ExplicitSmallStrain kernels" )
+set( ExplicitFiniteStrainPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ExplicitFiniteStrain kernels" )
+set( FixedStressThermoPoromechanicsPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the FixedStressThermoPoromechanics kernels" )
+set( ImplicitSmallStrainNewmarkPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ImplicitSmallStrainNewmark kernels" )
+set( ImplicitSmallStrainQuasiStaticPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ImplicitSmallStrainQuasiStatic kernels" )
+set( ImplicitSmallStrainQuasiStaticDiagonalPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the ImplicitSmallStrainQuasiStaticDiagonal kernels" )
+set( SmallStrainStiffnessApplyPolicy "geos::parallelDevicePolicy< ${GEOSX_BLOCK_SIZE} >"
+     CACHE STRING "RAJA launch policy of the SmallStrainStiffnessApply kernels" )
 
 
 configure_file( ${CMAKE_SOURCE_DIR}/${kernelPath}/policies.hpp.in
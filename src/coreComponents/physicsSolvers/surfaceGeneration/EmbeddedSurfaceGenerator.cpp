@@ -143,64 +143,75 @@ void EmbeddedSurfaceGenerator::initializePostSubGroups()
      */
     real64 const planeCenter[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( fracture.getCenter() );
     real64 const normalVector[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( fracture.getNormal() );
-    // Initialize variables
-    globalIndex nodeIndex;
-    integer isPositive, isNegative;
-    real64 distVec[ 3 ];
 
     elemManager.forElementSubRegionsComplete< CellElementSubRegion >(
       [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
     {
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
       FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
+      localIndex const numNodesPerElement = subRegion.numNodesPerElement();
 
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
-      forAll< serialPolicy >( subRegion.size(), [ &, ghostRank,
-                                                  cellToNodes,
-                                                  nodesCoord ] ( localIndex const cellIndex )
+      // The cut test only reads the mesh, so it runs in parallel over the cells. The surfaces are then added
+      // in the order of the cells, which keeps the numbering of the embedded elements and nodes deterministic.
+      array1d< integer > isCut( subRegion.size() );
+      forAll< parallelHostPolicy >( subRegion.size(), [ghostRank,
+                                                       cellToNodes,
+                                                       nodesCoord,
+                                                       numNodesPerElement,
+                                                       planeCenter,
+                                                       normalVector,
+                                                       isCut = isCut.toView()] ( localIndex const cellIndex )
       {
         if( ghostRank[cellIndex] < 0 )
         {
-          isPositive = 0;
-          isNegative = 0;
-          for( localIndex kn = 0; kn < subRegion.numNodesPerElement(); kn++ )
+          integer isPositive = 0;
+          integer isNegative = 0;
+          for( localIndex kn = 0; kn < numNodesPerElement; kn++ )
           {
-            nodeIndex = cellToNodes[cellIndex][kn];
+            localIndex const nodeIndex = cellToNodes[cellIndex][kn];
+            real64 distVec[ 3 ];
             LvArray::tensorOps::copy< 3 >( distVec, nodesCoord[nodeIndex] );
             LvArray::tensorOps::subtract< 3 >( distVec, planeCenter );
             // check if the dot product is zero
-            if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) > 0 )
+            real64 const prodScalarProd = LvArray::tensorOps::AiBi< 3 >( distVec, normalVector );
+            if( prodScalarProd > 0 )
             {
               isPositive = 1;
             }
-            else if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) < 0 )
+            else if( prodScalarProd < 0 )
             {
               isNegative = 1;
             }
           } // end loop over nodes
-          if( isPositive * isNegative == 1 )
+          isCut[cellIndex] = isPositive * isNegative;
+        }
+      } );
+
+      forAll< serialPolicy >( subRegion.size(), [ &, isCut = isCut.toViewConst() ] ( localIndex const cellIndex )
+      {
+        if( isCut[cellIndex] == 1 )
+        {
+          bool added = embeddedSurfaceSubRegion.addNewEmbeddedSurface( cellIndex,
+                                                                       er,
+                                                                       esr,
+                                                                       nodeManager,
+                                                                       embSurfNodeManager,
+                                                                       edgeManager,
+                                                                       cellToEdges,
+                                                                       &fracture );
+
+          if( added )
           {
-            bool added = embeddedSurfaceSubRegion.addNewEmbeddedSurface( cellIndex,
-                                                                         er,
-                                                                         esr,
-                                                                         nodeManager,
-                                                                         embSurfNodeManager,
-                                                                         edgeManager,
-                                                                         cellToEdges,
-                                                                         &fracture );
-
-            if( added )
-            {
-              GEOS_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
+            GEOS_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
 
-              // Add the information to the CellElementSubRegion
-              subRegion.addFracturedElement( cellIndex, localNumberOfSurfaceElems );
+            // Add the information to the CellElementSubRegion
+            subRegion.addFracturedElement( cellIndex, localNumberOfSurfaceElems );
 
-              newObjects.newElements[ {embeddedSurfaceRegion.getIndexInParent(), embeddedSurfaceSubRegion.getIndexInParent()} ].insert( localNumberOfSurfaceElems );
+            newObjects.newElements[ {embeddedSurfaceRegion.getIndexInParent(), embeddedSurfaceSubRegion.getIndexInParent()} ].insert( localNumberOfSurfaceElems );
 
-              localNumberOfSurfaceElems++;
-            }
+            localNumberOfSurfaceElems++;
           }
         }
       } );// end loop over cells
@@ -4467,15 +4467,17 @@ real64 SurfaceGenerator::minimumToughnessOnNode( localIndex const nodeID,
 void SurfaceGenerator::assignNewGlobalIndicesSerial( ObjectManagerBase & object,
                                                      std::set< localIndex > const & indexList )
 {
-  // in serial, we can simply loop over the indexList and assign new global indices based on
-  // the value of the maxGlobalIndex() + 1;
+  // in serial, we can simply loop over the indexList and assign consecutive new global indices
+  // starting from maxGlobalIndex() + 1. Note that maxGlobalIndex() is only updated by setMaxGlobalIndex(),
+  // so the offset of each new object must be added explicitly.
   arrayView1d< globalIndex > const & localToGlobal = object.localToGlobalMap();
+  globalIndex const firstNewGlobalIndex = object.maxGlobalIndex() + 1;
+  localIndex nIndicesAssigned = 0;
   for( localIndex const newLocalIndex : indexList )
   {
-    globalIndex const newGlobalIndex = object.maxGlobalIndex() + 1;
-
-    localToGlobal[newLocalIndex] = newGlobalIndex;
+    localToGlobal[newLocalIndex] = firstNewGlobalIndex + nIndicesAssigned;
     object.updateGlobalToLocalMap( newLocalIndex );
+    nIndicesAssigned += 1;
   }
 
   object.setMaxGlobalIndex();
@@ -4484,8 +4486,10 @@ void SurfaceGenerator::assignNewGlobalIndicesSerial( ObjectManagerBase & object,
 void SurfaceGenerator::assignNewGlobalIndicesSerial( ElementRegionManager & elementManager,
                                                      map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & newElems )
 {
-  // in serial, we can simply iterate over the entries in newElems and assign new global indices based on
-  // the value of the maxGlobalIndex() + 1 for the ElementRegionManager.
+  // in serial, we can simply iterate over the entries in newElems and assign consecutive new global indices
+  // starting from the value of the maxGlobalIndex() + 1 for the ElementRegionManager.
+  globalIndex const firstNewGlobalIndex = elementManager.maxGlobalIndex() + 1;
+  localIndex nIndicesAssigned = 0;
 
   // loop over entries of newElems, which gives elementRegion/subRegion local indices
   for( auto const & iter: newElems )
@@ -4500,10 +4504,9 @@ void SurfaceGenerator::assignNewGlobalIndicesSerial( ElementRegionManager & elem
     // loop over the new elems in the subRegion
     for( localIndex const newLocalIndex : indexList )
     {
-      globalIndex const newGlobalIndex = elementManager.maxGlobalIndex() + 1;
-
-      localToGlobal[newLocalIndex] = newGlobalIndex;
+      localToGlobal[newLocalIndex] = firstNewGlobalIndex + nIndicesAssigned;
       subRegion.updateGlobalToLocalMap( newLocalIndex );
+      nIndicesAssigned += 1;
     }
   }
 
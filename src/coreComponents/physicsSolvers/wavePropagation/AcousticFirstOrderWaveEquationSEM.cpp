@@ -539,10 +539,10 @@ real64 AcousticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & t
     fieldsToBeSync.addElementFields( {wavesolverfields::Velocity_x::key(), wavesolverfields::Velocity_y::key(), wavesolverfields::Velocity_z::key()}, regionNames );
 
     CommunicationTools & syncFields = CommunicationTools::getInstance();
-    syncFields.synchronizeFields( fieldsToBeSync,
-                                  mesh,
-                                  domain.getNeighbors(),
-                                  true );
+    syncFields.synchronizeFieldsPersistent( fieldsToBeSync,
+                                            mesh,
+                                            domain.getNeighbors(),
+                                            true );
 
     // compute the seismic traces since last step.
     arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
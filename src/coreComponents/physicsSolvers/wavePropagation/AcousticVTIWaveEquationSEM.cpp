@@ -93,7 +93,11 @@ void AcousticVTIWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       subRegion.registerField< fields::wavesolverfields::Delta >( getName() );
       subRegion.registerField< fields::wavesolverfields::Epsilon >( getName() );
       subRegion.registerField< fields::wavesolverfields::F >( getName() );
+      subRegion.registerField< fields::wavesolverfields::Theta >( getName() );
+      subRegion.registerField< fields::wavesolverfields::Phi >( getName() );
       subRegion.registerField< fields::wavesolverfields::MediumVelocity >( getName() );
+      subRegion.registerField< fields::wavesolverfields::AnisotropyCoefficients >( getName() ).
+        reference().resizeDimension< 1 >( acousticVTIWaveEquationSEMKernels::AnisotropyCoefficients::NUM );
     } );
   } );
 }
@@ -278,6 +282,18 @@ void AcousticVTIWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
       arrayView1d< real32 const > const epsilon  = elementSubRegion.getField< fields::wavesolverfields::Epsilon >();
       arrayView1d< real32 const > const delta    = elementSubRegion.getField< fields::wavesolverfields::Delta >();
       arrayView1d< real32 const > const vti_f    = elementSubRegion.getField< fields::wavesolverfields::F >();
+      arrayView1d< real32 const > const theta    = elementSubRegion.getField< fields::wavesolverfields::Theta >();
+      arrayView1d< real32 const > const phi      = elementSubRegion.getField< fields::wavesolverfields::Phi >();
+
+      // the combinations of the anisotropy parameters used by the stiffness kernel are computed once
+      arrayView2d< real32 > const coefficients = elementSubRegion.getField< fields::wavesolverfields::AnisotropyCoefficients >();
+      acousticVTIWaveEquationSEMKernels::AnisotropyCoefficientsKernel::launch< EXEC_POLICY >( elementSubRegion.size(),
+                                                                                             epsilon,
+                                                                                             delta,
+                                                                                             vti_f,
+                                                                                             theta,
+                                                                                             phi,
+                                                                                             coefficients );
 
       finiteElement::FiniteElementBase const &
       fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
@@ -643,10 +659,10 @@ real64 AcousticVTIWaveEquationSEM::explicitStepInternal( real64 const & time_n,
     fieldsToBeSync.addFields( FieldLocation::Node, { fields::wavesolverfields::Pressure_q_np1::key() } );
 
     CommunicationTools & syncFields = CommunicationTools::getInstance();
-    syncFields.synchronizeFields( fieldsToBeSync,
-                                  mesh,
-                                  domain.getNeighbors(),
-                                  true );
+    syncFields.synchronizeFieldsPersistent( fieldsToBeSync,
+                                            mesh,
+                                            domain.getNeighbors(),
+                                            true );
 
     // compute the seismic traces since last step.
     arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
@@ -187,6 +187,64 @@ struct PrecomputeSourceAndReceiverKernel
   }
 };
 
+/**
+ * @brief Layout of the packed anisotropy coefficients of an element, computed once from the Thomsen
+ *   parameters and the tilt of the symmetry axis. The stiffness operators of Fletcher's equations in
+ *   p and q are split into a transverse part (gradients orthogonal to the symmetry axis) and an axial
+ *   part (gradient along the symmetry axis), which reduce to the xy and z parts in VTI media.
+ */
+struct AnisotropyCoefficients
+{
+  /// Coefficient of the transverse operator on p in the p-equation, -(1+2 epsilon)
+  static constexpr int P_XY = 0;
+  /// Coefficient of the transverse operator on p in the q-equation, -(2 delta + f)
+  static constexpr int QP_XY = 1;
+  /// Coefficient of the transverse operator on q in the q-equation and of the axial operator on p in the p-equation, f-1
+  static constexpr int F_MINUS_ONE = 2;
+  /// Coefficient of the axial operator on q in the p-equation, -f
+  static constexpr int PQ_Z = 3;
+  /// Index of the first component of the unit symmetry axis, followed by the two others
+  static constexpr int AXIS = 4;
+  /// Number of packed coefficients per element
+  static constexpr int NUM = 7;
+};
+
+struct AnisotropyCoefficientsKernel
+{
+  /**
+   * @brief Launches the precomputation of the packed anisotropy coefficients
+   * @tparam EXEC_POLICY the execution policy
+   * @param[in] size the number of cells in the subRegion
+   * @param[in] epsilon cell-wise Thomsen epsilon parameter
+   * @param[in] delta cell-wise Thomsen delta parameter
+   * @param[in] vti_f cell-wise f parameter in Fletcher's equation
+   * @param[in] theta cell-wise tilt angle of the symmetry axis from the vertical direction
+   * @param[in] phi cell-wise azimuth angle of the symmetry axis
+   * @param[out] coefficients cell-wise packed coefficients, laid out as in AnisotropyCoefficients
+   */
+  template< typename EXEC_POLICY >
+  static void
+  launch( localIndex const size,
+          arrayView1d< real32 const > const epsilon,
+          arrayView1d< real32 const > const delta,
+          arrayView1d< real32 const > const vti_f,
+          arrayView1d< real32 const > const theta,
+          arrayView1d< real32 const > const phi,
+          arrayView2d< real32 > const coefficients )
+  {
+    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const e )
+    {
+      coefficients( e, AnisotropyCoefficients::P_XY ) = -1 - 2*epsilon[e];
+      coefficients( e, AnisotropyCoefficients::QP_XY ) = -2*delta[e] - vti_f[e];
+      coefficients( e, AnisotropyCoefficients::F_MINUS_ONE ) = vti_f[e] - 1;
+      coefficients( e, AnisotropyCoefficients::PQ_Z ) = -vti_f[e];
+      coefficients( e, AnisotropyCoefficients::AXIS ) = sin( theta[e] ) * cos( phi[e] );
+      coefficients( e, AnisotropyCoefficients::AXIS + 1 ) = sin( theta[e] ) * sin( phi[e] );
+      coefficients( e, AnisotropyCoefficients::AXIS + 2 ) = cos( theta[e] );
+    } );
+  }
+};
+
 template< typename FE_TYPE >
 struct MassMatrixKernel
 {
@@ -433,9 +491,7 @@ public:
     m_q_n( nodeManager.getField< fields::wavesolverfields::Pressure_q_n >() ),
     m_stiffnessVector_p( nodeManager.getField< fields::wavesolverfields::StiffnessVector_p >() ),
     m_stiffnessVector_q( nodeManager.getField< fields::wavesolverfields::StiffnessVector_q >() ),
-    m_epsilon( elementSubRegion.template getField< fields::wavesolverfields::Epsilon >() ),
-    m_delta( elementSubRegion.template getField< fields::wavesolverfields::Delta >() ),
-    m_vti_f( elementSubRegion.template getField< fields::wavesolverfields::F >() ),
+    m_coefficients( elementSubRegion.template getField< fields::wavesolverfields::AnisotropyCoefficients >() ),
     m_dt( dt )
   {
     GEOS_UNUSED_VAR( edgeManager );
@@ -455,11 +511,23 @@ public:
 public:
     GEOS_HOST_DEVICE
     StackVariables():
-      xLocal()
+      xLocal(),
+      pqLocal(),
+      stiffnessVectorLocal(),
+      coefficients()
     {}
 
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// C-array stack storage for element local the nodal pressure (first row) and auxiliary variable (second row).
+    real64 pqLocal[ 2 ][ numNodesPerElem ];
+
+    /// C-array stack storage for element local the product of the stiffness matrix and the nodal pressure, for the equations in p and q.
+    real64 stiffnessVectorLocal[ 2 ][ numNodesPerElem ];
+
+    /// C-array stack storage for the packed anisotropy coefficients of the element.
+    real64 coefficients[ AnisotropyCoefficients::NUM ];
   };
   //***************************************************************************
 
@@ -467,7 +535,7 @@ public:
   /**
    * @copydoc geos::finiteElement::KernelBase::setup
    *
-   * Copies the primary variable, and position into the local stack array.
+   * Copies the primary variables, the position and the anisotropy coefficients into the local stack array.
    */
   GEOS_HOST_DEVICE
   GEOS_FORCE_INLINE
@@ -482,6 +550,14 @@ public:
       {
         stack.xLocal[ a ][ i ] = m_nodeCoords[ nodeIndex ][ i ];
       }
+      stack.pqLocal[ 0 ][ a ] = m_p_n[ nodeIndex ];
+      stack.pqLocal[ 1 ][ a ] = m_q_n[ nodeIndex ];
+      stack.stiffnessVectorLocal[ 0 ][ a ] = 0.0;
+      stack.stiffnessVectorLocal[ 1 ][ a ] = 0.0;
+    }
+    for( int c = 0; c < AnisotropyCoefficients::NUM; ++c )
+    {
+      stack.coefficients[ c ] = m_coefficients( k, c );
     }
   }
 
@@ -489,7 +565,9 @@ public:
    * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
    *
    * ### ExplicitAcousticVTISEM Description
-   * Calculates stiffness vector
+   * Calculates the contribution of the quadrature point to the element stiffness vectors
+   * with the sum-factorized stiffness application of the finite element space. The gradients
+   * are split along the symmetry axis of the element, which handles both VTI and TTI media.
    *
    */
   GEOS_HOST_DEVICE
@@ -498,25 +576,45 @@ public:
                               localIndex const q,
                               StackVariables & stack ) const
   {
-    // Pseudo Stiffness xy
-    m_finiteElementSpace.template computeStiffnessxyTerm( q, stack.xLocal, [&] ( int i, int j, real64 val )
+    GEOS_UNUSED_VAR( k );
+    real64 const (&c)[ AnisotropyCoefficients::NUM ] = stack.coefficients;
+    m_finiteElementSpace.template applyCoupledStiffnessTerm< 2 >( q, stack.xLocal, stack.pqLocal, stack.stiffnessVectorLocal,
+                                                                  [&] ( real64 const (&grad)[2][3], real64 (& flux)[2][3] )
     {
-      real32 const localIncrement_p = val*(-1-2*m_epsilon[k])*m_p_n[m_elemsToNodes[k][j]];
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector_p[m_elemsToNodes[k][i]], localIncrement_p );
-      real32 const localIncrement_q = val*((-2*m_delta[k]-m_vti_f[k])*m_p_n[m_elemsToNodes[k][j]] +(m_vti_f[k]-1)*m_q_n[m_elemsToNodes[k][j]]);
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector_q[m_elemsToNodes[k][i]], localIncrement_q );
+      real64 const * const axis = &c[ AnisotropyCoefficients::AXIS ];
+      real64 const pAxial = grad[0][0]*axis[0] + grad[0][1]*axis[1] + grad[0][2]*axis[2];
+      real64 const qAxial = grad[1][0]*axis[0] + grad[1][1]*axis[1] + grad[1][2]*axis[2];
+      for( int i = 0; i < 3; ++i )
+      {
+        real64 const pz = pAxial*axis[i];
+        real64 const qz = qAxial*axis[i];
+        real64 const pxy = grad[0][i] - pz;
+        real64 const qxy = grad[1][i] - qz;
+        flux[0][i] = c[ AnisotropyCoefficients::P_XY ]*pxy
+                     + c[ AnisotropyCoefficients::F_MINUS_ONE ]*pz + c[ AnisotropyCoefficients::PQ_Z ]*qz;
+        flux[1][i] = c[ AnisotropyCoefficients::QP_XY ]*pxy + c[ AnisotropyCoefficients::F_MINUS_ONE ]*qxy - qz;
+      }
     } );
+  }
 
-    // Pseudo-Stiffness z
-
-    m_finiteElementSpace.template computeStiffnesszTerm( q, stack.xLocal, [&] ( int i, int j, real64 val )
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticVTISEM Description
+   * Adds the element stiffness vectors to the nodal stiffness vectors.
+   */
+  GEOS_HOST_DEVICE
+  GEOS_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a< numNodesPerElem; ++a )
     {
-      real32 const localIncrement_p = val*((m_vti_f[k]-1)*m_p_n[m_elemsToNodes[k][j]] - m_vti_f[k]*m_q_n[m_elemsToNodes[k][j]]);
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector_p[m_elemsToNodes[k][i]], localIncrement_p );
-
-      real32 const localIncrement_q = -val*m_q_n[m_elemsToNodes[k][j]];
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector_q[m_elemsToNodes[k][i]], localIncrement_q );
-    } );
+      localIndex const nodeIndex = m_elemsToNodes( k, a );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector_p[nodeIndex], real32( stack.stiffnessVectorLocal[ 0 ][ a ] ) );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector_q[nodeIndex], real32( stack.stiffnessVectorLocal[ 1 ][ a ] ) );
+    }
+    return 0;
   }
 
 protected:
@@ -535,14 +633,8 @@ protected:
   /// The array containing the product of the stiffness matrix and the nodal pressure for the equation in q.
   arrayView1d< real32 > const m_stiffnessVector_q;
 
-  /// The array containing the epsilon Thomsen parameter.
-  arrayView1d< real32 const > const m_epsilon;
-
-  /// The array containing the delta Thomsen parameter.
-  arrayView1d< real32 const > const m_delta;
-
-  /// The array containing the f parameter.
-  arrayView1d< real32 const > const m_vti_f;
+  /// The array containing the packed anisotropy coefficients of the elements.
+  arrayView2d< real32 const > const m_coefficients;
 
   /// The time increment for this time integration step.
   real64 const m_dt;
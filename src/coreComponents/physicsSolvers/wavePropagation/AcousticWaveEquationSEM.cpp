@@ -25,6 +25,7 @@
 #include "fieldSpecification/PerfectlyMatchedLayer.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/ElementType.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "WaveSolverUtils.hpp"
 
@@ -36,9 +37,17 @@ using namespace dataRepository;
 AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
                                                   Group * const parent ):
   WaveSolverBase( name,
-                  parent )
+                  parent ),
+  m_recomputingForward( false )
 {
 
+  registerWrapper( viewKeyStruct::imagingConditionString(), &m_imagingCondition ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( ImagingCondition::CrossCorrelation ).
+    setDescription( "Imaging condition applied during the backward propagation to compute the partial gradient. "
+                    "With sourceNormalized, the cross-correlation is divided by the illumination of the forward wavefield. "
+                    "Options are:\n* " + EnumStrings< ImagingCondition >::concat( "\n* " ) );
+
   registerWrapper( viewKeyStruct::pressureNp1AtReceiversString(), &m_pressureNp1AtReceivers ).
     setInputFlag( InputFlags::FALSE ).
     setSizedFromParent( 0 ).
@@ -88,6 +97,13 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       nodeManager.getField< fields::AuxiliaryVar2PML >().resizeDimension< 1 >( 3 );
     }
 
+    /// register the running Fourier transforms only when the gradient is computed in the frequency domain
+    if( !m_gradientFrequencies.empty() )
+    {
+      nodeManager.registerField< fields::PressureDoubleDerivativeDFT >( getName() );
+      nodeManager.getField< fields::PressureDoubleDerivativeDFT >().resizeDimension< 1 >( 2*m_gradientFrequencies.size() );
+    }
+
     FaceManager & faceManager = mesh.getFaceManager();
     faceManager.registerField< fields::FreeSurfaceFaceIndicator >( getName() );
 
@@ -98,6 +114,11 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       subRegion.registerField< fields::MediumVelocity >( getName() );
       subRegion.registerField< fields::MediumDensity >( getName() );
       subRegion.registerField< fields::PartialGradient >( getName() );
+      if( m_imagingCondition == ImagingCondition::SourceNormalized )
+      {
+        subRegion.registerField< fields::PartialGradientCorrelation,
+                                 fields::ForwardIllumination >( getName() );
+      }
     } );
 
   } );
@@ -180,10 +201,12 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
 
       {
         GEOS_MARK_SCOPE( acousticWaveEquationSEMKernels::PrecomputeSourceAndReceiverKernel );
+        ElementSpatialIndex spatialIndex;
+        spatialIndex.build< EXEC_POLICY >( elemsToNodes, X32 );
         acousticWaveEquationSEMKernels::
           PrecomputeSourceAndReceiverKernel::
           launch< EXEC_POLICY, FE_TYPE >
-          ( elementSubRegion.size(),
+          ( spatialIndex.createKernelWrapper(),
           numNodesPerElem,
           numFacesPerElem,
           X32,
@@ -298,6 +321,11 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
       /// Partial gradient if gradient as to be computed
       arrayView1d< real32 > grad = elementSubRegion.getField< fields::PartialGradient >();
       grad.zero();
+      if( m_imagingCondition == ImagingCondition::SourceNormalized )
+      {
+        elementSubRegion.getField< fields::PartialGradientCorrelation >().zero();
+        elementSubRegion.getField< fields::ForwardIllumination >().zero();
+      }
 
       finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
       {
@@ -628,6 +656,48 @@ void AcousticWaveEquationSEM::initializePML()
       }
     }
 
+    /// Split the nodes between the PML region and the interior, so that the interior
+    /// nodes are updated without evaluating the damping profile at each time step
+    {
+      real32 const xMin[ 3 ] = {param.xMinPML[0], param.xMinPML[1], param.xMinPML[2]};
+      real32 const xMax[ 3 ] = {param.xMaxPML[0], param.xMaxPML[1], param.xMaxPML[2]};
+      real32 const dMin[ 3 ] = {param.thicknessMinXYZPML[0], param.thicknessMinXYZPML[1], param.thicknessMinXYZPML[2]};
+      real32 const dMax[ 3 ] = {param.thicknessMaxXYZPML[0], param.thicknessMaxXYZPML[1], param.thicknessMaxXYZPML[2]};
+      real32 const cMinPML[ 3 ] = {param.waveSpeedMinXYZPML[0], param.waveSpeedMinXYZPML[1], param.waveSpeedMinXYZPML[2]};
+      real32 const cMaxPML[ 3 ] = {param.waveSpeedMaxXYZPML[0], param.waveSpeedMaxXYZPML[1], param.waveSpeedMaxXYZPML[2]};
+      real32 const r = param.reflectivityPML;
+
+      array1d< localIndex > & pmlNodes = m_pmlNodes;
+      array1d< localIndex > & interiorNodes = m_interiorNodes;
+      pmlNodes.clear();
+      interiorNodes.clear();
+
+      forAll< serialPolicy >( nodeManager.size(), [=, &pmlNodes, &interiorNodes] ( localIndex const a )
+      {
+        real32 sigma[3];
+        real32 const xLocal[ 3 ] = { X32[a][0], X32[a][1], X32[a][2] };
+        acousticWaveEquationSEMKernels::PMLKernelHelper::computeDampingProfilePML(
+          xLocal,
+          xMin,
+          xMax,
+          dMin,
+          dMax,
+          cMinPML,
+          cMaxPML,
+          r,
+          sigma );
+
+        if( isZero( indicatorPML[a] - 1.0 ) || sigma[0] + sigma[1] + sigma[2] > 0 )
+        {
+          pmlNodes.emplace_back( a );
+        }
+        else
+        {
+          interiorNodes.emplace_back( a );
+        }
+      } );
+    }
+
     /// WARNING: don't forget to reset the indicator to zero
     /// so it can be used by the PML application
     indicatorPML.zero();
@@ -753,6 +823,13 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
                                                      DomainPartition & domain,
                                                      bool computeGradient )
 {
+  bool const useCheckpoints = m_maxCheckpoints > 0;
+  bool const useFrequencies = !m_gradientFrequencies.empty();
+  if( computeGradient && cycleNumber >= 0 && useCheckpoints )
+  {
+    storeForwardCheckpoint( time_n, dt, cycleNumber, domain );
+  }
+
   real64 dtOut = explicitStepInternal( time_n, dt, cycleNumber, domain );
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(),
@@ -766,7 +843,33 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
     arrayView1d< real32 > const p_n = nodeManager.getField< fields::Pressure_n >();
     arrayView1d< real32 > const p_np1 = nodeManager.getField< fields::Pressure_np1 >();
 
-    if( computeGradient && cycleNumber >= 0 )
+    if( computeGradient && cycleNumber >= 0 && useFrequencies )
+    {
+      // accumulate the discrete Fourier transforms of p_dt2 instead of storing the snapshots
+      arrayView2d< real32 > const p_dt2_dft = nodeManager.getField< fields::PressureDoubleDerivativeDFT >();
+      arrayView1d< real64 const > const freqs = m_gradientFrequencies.toViewConst();
+      localIndex const numFreqs = freqs.size();
+      real64 const time = cycleNumber * dt;
+      bool const firstStep = cycleNumber == 0;
+
+      GEOS_MARK_SCOPE ( accumulateDFT );
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIdx )
+      {
+        real32 const pdt2 = (p_np1[nodeIdx] - 2*p_n[nodeIdx] + p_nm1[nodeIdx])/(dt*dt);
+        for( localIndex f = 0; f < numFreqs; ++f )
+        {
+          real64 const omegaT = 2.0 * M_PI * freqs[f] * time;
+          if( firstStep )
+          {
+            p_dt2_dft[nodeIdx][2*f] = 0.0;
+            p_dt2_dft[nodeIdx][2*f+1] = 0.0;
+          }
+          p_dt2_dft[nodeIdx][2*f] += pdt2 * cos( omegaT );
+          p_dt2_dft[nodeIdx][2*f+1] -= pdt2 * sin( omegaT );
+        }
+      } );
+    }
+    else if( computeGradient && cycleNumber >= 0 && !useCheckpoints )
     {
 
       arrayView1d< real32 > const p_dt2 = nodeManager.getField< fields::PressureDoubleDerivative >();
@@ -777,7 +880,8 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
         {
           int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
           std::string lifoPrefix = GEOS_FMT( "lifo/rank_{:05}/pdt2_shot{:06}", rank, m_shotIndex );
-          m_lifo = std::make_unique< LifoStorage< real32, localIndex > >( lifoPrefix, p_dt2, m_lifoOnDevice, m_lifoOnHost, m_lifoSize );
+          m_lifo = std::make_unique< LifoStorage< real32, localIndex > >( lifoPrefix, p_dt2, m_lifoOnDevice, m_lifoOnHost, m_lifoSize,
+                                                                         m_lifoCompressionTolerance );
         }
 
         m_lifo->pushWait();
@@ -840,31 +944,54 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
                                                       DomainPartition & domain,
                                                       bool computeGradient )
 {
-  real64 dtOut = explicitStepInternal( time_n, dt, cycleNumber, domain );
-  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
-                                  [&] ( string const &,
-                                        MeshLevel & mesh,
-                                        arrayView1d< string const > const & regionNames )
-  {
-    NodeManager & nodeManager = mesh.getNodeManager();
-
-    arrayView1d< real32 const > const mass = nodeManager.getField< fields::MassVector >();
-
-    arrayView1d< real32 > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
-    arrayView1d< real32 > const p_n = nodeManager.getField< fields::Pressure_n >();
-    arrayView1d< real32 > const p_np1 = nodeManager.getField< fields::Pressure_np1 >();
+  EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
+  real64 const & maxTime = event.getReference< real64 >( EventManager::viewKeyStruct::maxTimeString() );
+  int const maxCycle = int(round( maxTime/dt ));
 
-    EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
-    real64 const & maxTime = event.getReference< real64 >( EventManager::viewKeyStruct::maxTimeString() );
-    int const maxCycle = int(round( maxTime/dt ));
+  bool const useCheckpoints = m_maxCheckpoints > 0;
+  bool const useFrequencies = !m_gradientFrequencies.empty();
+  bool const updateGradient = computeGradient && cycleNumber < maxCycle;
+  if( updateGradient && useCheckpoints )
+  {
+    // must be done before the backward step, which uses the same pressure fields
+    recomputeForwardStep( dt, domain );
+  }
 
-    if( computeGradient && cycleNumber < maxCycle )
+  // p_dt2 is made available before the backward step, in the stiffness kernel of which the gradient is accumulated
+  if( updateGradient && !useCheckpoints )
+  {
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                    [&] ( string const &,
+                                          MeshLevel & mesh,
+                                          arrayView1d< string const > const & )
     {
-      ElementRegionManager & elemManager = mesh.getElemManager();
+      NodeManager & nodeManager = mesh.getNodeManager();
 
       arrayView1d< real32 > const p_dt2 = nodeManager.getField< fields::PressureDoubleDerivative >();
 
-      if( m_enableLifo )
+      if( useFrequencies )
+      {
+        // p_dt2 is reconstructed from its Fourier transforms, i.e. restricted to the gradient frequencies
+        arrayView2d< real32 const > const p_dt2_dft = nodeManager.getField< fields::PressureDoubleDerivativeDFT >();
+        arrayView1d< real64 const > const freqs = m_gradientFrequencies.toViewConst();
+        localIndex const numFreqs = freqs.size();
+        real64 const time = cycleNumber * dt;
+
+        GEOS_MARK_SCOPE ( reconstructFromDFT );
+        forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIdx )
+        {
+          real64 pdt2 = 0.0;
+          for( localIndex f = 0; f < numFreqs; ++f )
+          {
+            real64 const omegaT = 2.0 * M_PI * freqs[f] * time;
+            // the negative frequencies contribute the complex conjugate, except for the zero frequency
+            real64 const scaling = ( freqs[f] > 0 ? 2.0 : 1.0 ) / maxCycle;
+            pdt2 += scaling * ( p_dt2_dft[nodeIdx][2*f] * cos( omegaT ) - p_dt2_dft[nodeIdx][2*f+1] * sin( omegaT ) );
+          }
+          p_dt2[nodeIdx] = pdt2;
+        } );
+      }
+      else if( m_enableLifo )
       {
         m_lifo->pop( p_dt2 );
         if( m_lifo->empty() )
@@ -890,43 +1017,236 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
         wf.close( );
         remove( fileName.c_str() );
       }
-      elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                  CellElementSubRegion & elementSubRegion )
+    } );
+  }
+
+  real64 dtOut = explicitStepInternal( time_n, dt, cycleNumber, domain, updateGradient );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+
+    arrayView1d< real32 > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
+    arrayView1d< real32 > const p_n = nodeManager.getField< fields::Pressure_n >();
+    arrayView1d< real32 > const p_np1 = nodeManager.getField< fields::Pressure_np1 >();
+
+    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      p_nm1[a] = p_n[a];
+      p_n[a]   = p_np1[a];
+    } );
+  } );
+
+  return dtOut;
+}
+
+void AcousticWaveEquationSEM::saveState( DomainPartition & domain,
+                                         arrayView2d< real32 > const & states,
+                                         localIndex const slot )
+{
+  GEOS_MARK_FUNCTION;
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    localIndex const numNodes = nodeManager.size();
+
+    arrayView1d< real32 const > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
+    arrayView1d< real32 const > const p_n = nodeManager.getField< fields::Pressure_n >();
+
+    forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      states[slot][a] = p_nm1[a];
+      states[slot][numNodes+a] = p_n[a];
+    } );
+
+    if( m_usePML )
+    {
+      arrayView2d< real32 const > const v_n = nodeManager.getField< fields::AuxiliaryVar1PML >();
+      arrayView1d< real32 const > const u_n = nodeManager.getField< fields::AuxiliaryVar4PML >();
+      forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const a )
       {
-        arrayView1d< real32 const > const velocity = elementSubRegion.getField< fields::MediumVelocity >();
-        arrayView1d< real32 > grad = elementSubRegion.getField< fields::PartialGradient >();
-        arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = elementSubRegion.nodeList();
-        constexpr localIndex numNodesPerElem = 8;
-        arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
-        GEOS_MARK_SCOPE ( updatePartialGradient );
-        forAll< EXEC_POLICY >( elementSubRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const eltIdx )
+        for( integer i=0; i<3; ++i )
         {
-          if( elemGhostRank[eltIdx]<0 )
-          {
-            for( localIndex i = 0; i < numNodesPerElem; ++i )
-            {
-              localIndex nodeIdx = elemsToNodes[eltIdx][i];
-              grad[eltIdx] += (-2/velocity[eltIdx]) * mass[nodeIdx]/8.0 * (p_dt2[nodeIdx] * p_n[nodeIdx]);
-            }
-          }
+          states[slot][(2+i)*numNodes+a] = v_n[a][i];
+        }
+        states[slot][5*numNodes+a] = u_n[a];
+      } );
+    }
+  } );
+}
+
+void AcousticWaveEquationSEM::restoreState( DomainPartition & domain,
+                                            arrayView2d< real32 const > const & states,
+                                            localIndex const slot )
+{
+  GEOS_MARK_FUNCTION;
+
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    localIndex const numNodes = nodeManager.size();
+
+    arrayView1d< real32 > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
+    arrayView1d< real32 > const p_n = nodeManager.getField< fields::Pressure_n >();
+
+    forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      p_nm1[a] = states[slot][a];
+      p_n[a] = states[slot][numNodes+a];
+    } );
+
+    if( m_usePML )
+    {
+      arrayView2d< real32 > const v_n = nodeManager.getField< fields::AuxiliaryVar1PML >();
+      arrayView1d< real32 > const u_n = nodeManager.getField< fields::AuxiliaryVar4PML >();
+      forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const a )
+      {
+        for( integer i=0; i<3; ++i )
+        {
+          v_n[a][i] = states[slot][(2+i)*numNodes+a];
+        }
+        u_n[a] = states[slot][5*numNodes+a];
+      } );
+    }
+  } );
+}
+
+void AcousticWaveEquationSEM::storeForwardCheckpoint( real64 const & time_n,
+                                                      real64 const & dt,
+                                                      integer const cycleNumber,
+                                                      DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  if( !m_checkpointSchedule )
+  {
+    EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
+    real64 const & maxTime = event.getReference< real64 >( EventManager::viewKeyStruct::maxTimeString() );
+    int const maxCycle = int(round( maxTime/dt ));
+
+    m_checkpointSchedule = std::make_unique< BinomialCheckpointSchedule >( maxCycle - cycleNumber, m_maxCheckpoints );
+    m_numCheckpointedSteps = 0;
+    m_checkpointStartTime = time_n;
+    m_checkpointStartCycle = cycleNumber;
+
+    localIndex stateSize = 0;
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                    [&] ( string const &,
+                                          MeshLevel & mesh,
+                                          arrayView1d< string const > const & )
+    {
+      stateSize = mesh.getNodeManager().size() * ( m_usePML ? 6 : 2 );
+    } );
+    m_checkpointStates.resize( m_maxCheckpoints, stateSize );
+    m_backwardState.resize( 1, stateSize );
+
+    // the source values are replaced by the adjoint sources before the backward propagation
+    m_forwardSourceValue = m_sourceValue;
+  }
+
+  integer const slot = m_checkpointSchedule->forwardStep( m_numCheckpointedSteps++ );
+  if( slot >= 0 )
+  {
+    saveState( domain, m_checkpointStates.toView(), slot );
+  }
+}
+
+void AcousticWaveEquationSEM::recomputeForwardStep( real64 const & dt,
+                                                    DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF( !m_checkpointSchedule || m_numCheckpointedSteps <= 0,
+                 getDataContext() << ": No forward step left to recompute from the checkpoints" );
+
+  BinomialCheckpointSchedule & schedule = *m_checkpointSchedule;
+  integer const step = --m_numCheckpointedSteps;
+  schedule.releaseAfter( step );
+
+  arrayView2d< real32 > const checkpointStates = m_checkpointStates.toView();
+
+  saveState( domain, m_backwardState.toView(), 0 );
+  restoreState( domain, checkpointStates.toViewConst(), schedule.lastCheckpointSlot() );
+
+  // the forward steps are recomputed with the forward sources and without recording the seismic traces
+  std::swap( m_sourceValue, m_forwardSourceValue );
+  m_recomputingForward = true;
+
+  auto forwardStep = [&]( integer const forwardStepIndex )
+  {
+    explicitStepInternal( m_checkpointStartTime + forwardStepIndex*dt, dt, m_checkpointStartCycle + forwardStepIndex, domain );
+  };
+
+  integer currentStep = schedule.lastCheckpointStep();
+  while( currentStep < step )
+  {
+    integer const nextCheckpoint = std::min( schedule.nextCheckpoint( currentStep, step + 1 ), step );
+    for( ; currentStep < nextCheckpoint; ++currentStep )
+    {
+      forwardStep( currentStep );
+      forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                      [&] ( string const &,
+                                            MeshLevel & mesh,
+                                            arrayView1d< string const > const & )
+      {
+        NodeManager & nodeManager = mesh.getNodeManager();
+        arrayView1d< real32 > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
+        arrayView1d< real32 > const p_n = nodeManager.getField< fields::Pressure_n >();
+        arrayView1d< real32 const > const p_np1 = nodeManager.getField< fields::Pressure_np1 >();
+        forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+        {
+          p_nm1[a] = p_n[a];
+          p_n[a]   = p_np1[a];
         } );
       } );
     }
+    if( currentStep < step )
+    {
+      saveState( domain, checkpointStates, schedule.push( currentStep ) );
+    }
+  }
 
-    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+  forwardStep( step );
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                  [&] ( string const &,
+                                        MeshLevel & mesh,
+                                        arrayView1d< string const > const & )
+  {
+    NodeManager & nodeManager = mesh.getNodeManager();
+    arrayView1d< real32 const > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
+    arrayView1d< real32 const > const p_n = nodeManager.getField< fields::Pressure_n >();
+    arrayView1d< real32 const > const p_np1 = nodeManager.getField< fields::Pressure_np1 >();
+    arrayView1d< real32 > const p_dt2 = nodeManager.getField< fields::PressureDoubleDerivative >();
+    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const nodeIdx )
     {
-      p_nm1[a] = p_n[a];
-      p_n[a]   = p_np1[a];
+      p_dt2[nodeIdx] = (p_np1[nodeIdx] - 2*p_n[nodeIdx] + p_nm1[nodeIdx])/(dt*dt);
     } );
   } );
 
-  return dtOut;
+  m_recomputingForward = false;
+  std::swap( m_sourceValue, m_forwardSourceValue );
+  restoreState( domain, m_backwardState.toViewConst(), 0 );
+
+  if( step == 0 )
+  {
+    m_checkpointSchedule.reset();
+  }
 }
 
 real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
                                                       real64 const & dt,
                                                       integer cycleNumber,
-                                                      DomainPartition & domain )
+                                                      DomainPartition & domain,
+                                                      bool const updateGradient )
 {
   GEOS_MARK_FUNCTION;
 
@@ -952,16 +1272,60 @@ real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
 
     bool const usePML = m_usePML;
 
-    auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
+    /// move the fields of the step to the device at once, rather than one by one when the kernels capture them
+    FieldIdentifiers fieldsOfStep;
+    fieldsOfStep.addFields( FieldLocation::Node, { fields::referencePosition32::key(),
+                                                   fields::MassVector::key(),
+                                                   fields::DampingVector::key(),
+                                                   fields::Pressure_nm1::key(),
+                                                   fields::Pressure_n::key(),
+                                                   fields::Pressure_np1::key(),
+                                                   fields::FreeSurfaceNodeIndicator::key(),
+                                                   fields::StiffnessVector::key(),
+                                                   fields::ForcingRHS::key() } );
+    fieldsOfStep.addElementFields( { fields::MediumDensity::key() }, regionNames );
+    if( updateGradient )
+    {
+      fieldsOfStep.addFields( FieldLocation::Node, { fields::PressureDoubleDerivative::key() } );
+      fieldsOfStep.addElementFields( { fields::MediumVelocity::key(),
+                                       fields::PartialGradient::key() }, regionNames );
+      if( m_imagingCondition == ImagingCondition::SourceNormalized )
+      {
+        fieldsOfStep.addElementFields( { fields::PartialGradientCorrelation::key(),
+                                         fields::ForwardIllumination::key() }, regionNames );
+      }
+    }
+    mesh.moveFields( fieldsOfStep, parallelDeviceMemorySpace, false );
 
-    finiteElement::
-      regionBasedKernelApplication< EXEC_POLICY,
-                                    constitutive::NullModel,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            getDiscretizationName(),
-                                                            "",
-                                                            kernelFactory );
+    auto launchStiffnessKernel = [&]( auto & kernelFactory )
+    {
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    };
+
+    // during the backward propagation, the imaging condition is applied in the stiffness kernel,
+    // which already reads the adjoint pressure of the elements
+    if( !updateGradient )
+    {
+      auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
+      launchStiffnessKernel( kernelFactory );
+    }
+    else if( m_imagingCondition == ImagingCondition::CrossCorrelation )
+    {
+      auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMGradientFactory< ImagingCondition::CrossCorrelation >( dt );
+      launchStiffnessKernel( kernelFactory );
+    }
+    else
+    {
+      auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMGradientFactory< ImagingCondition::SourceNormalized >( dt );
+      launchStiffnessKernel( kernelFactory );
+    }
 
     EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
     real64 const & minTime = event.getReference< real64 >( EventManager::viewKeyStruct::minTimeString() );
@@ -985,6 +1349,9 @@ real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
           p_np1[a] += dt2*(rhs[a]-stiffnessVector[a]);
           p_np1[a] /= mass[a]+0.5*dt*damping[a];
         }
+        // prepare next step: the stiffness and forcing terms are not read after the update
+        stiffnessVector[a] = 0.0;
+        rhs[a] = 0.0;
       } );
     }
     else
@@ -1008,9 +1375,26 @@ real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
       /// Compute (divV) and (B.pressureGrad - C.auxUGrad) vectors for the PML region
       applyPML( time_n, domain );
 
+      arrayView1d< localIndex const > const pmlNodes = m_pmlNodes.toViewConst();
+      arrayView1d< localIndex const > const interiorNodes = m_interiorNodes.toViewConst();
+
+      /// the damping profile, divV and the PML auxiliary variables vanish outside of the PML region
+      GEOS_MARK_SCOPE ( updatePInterior );
+      forAll< EXEC_POLICY >( interiorNodes.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
+      {
+        localIndex const a = interiorNodes[n];
+        if( freeSurfaceNodeIndicator[a] != 1 )
+        {
+          p_np1[a] = dt2*(rhs[a] - stiffnessVector[a])/mass[a]
+                     - p_nm1[a]
+                     + 2*p_n[a];
+        }
+      } );
+
       GEOS_MARK_SCOPE ( updatePWithPML );
-      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+      forAll< EXEC_POLICY >( pmlNodes.size(), [=] GEOS_HOST_DEVICE ( localIndex const n )
       {
+        localIndex const a = pmlNodes[n];
         if( freeSurfaceNodeIndicator[a] != 1 )
         {
           real32 sigma[3];
@@ -1061,26 +1445,26 @@ real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
     }
 
     CommunicationTools & syncFields = CommunicationTools::getInstance();
-    syncFields.synchronizeFields( fieldsToBeSync,
-                                  mesh,
-                                  domain.getNeighbors(),
-                                  true );
+    syncFields.synchronizeFieldsPersistent( fieldsToBeSync,
+                                            mesh,
+                                            domain.getNeighbors(),
+                                            true );
 
     /// compute the seismic traces since last step.
     arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
-    if( time_n >= 0 )
+    if( time_n >= 0 && !m_recomputingForward )
     {
       computeAllSeismoTraces( time_n, dt, p_np1, p_n, pReceivers );
     }
-    /// prepare next step
-    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
-    {
-      stiffnessVector[a] = 0.0;
-      rhs[a] = 0.0;
-    } );
-
+    /// prepare next step (without PML, the stiffness and forcing terms are reset by the update kernel)
     if( usePML )
     {
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+      {
+        stiffnessVector[a] = 0.0;
+        rhs[a] = 0.0;
+      } );
+
       arrayView2d< real32 > const grad_n = nodeManager.getField< fields::AuxiliaryVar2PML >();
       arrayView1d< real32 > const divV_n = nodeManager.getField< fields::AuxiliaryVar3PML >();
       grad_n.zero();
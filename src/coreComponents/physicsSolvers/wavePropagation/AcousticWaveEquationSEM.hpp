@@ -119,22 +119,34 @@ public:
     static constexpr char const * receiverIsLocalString() { return "receiverIsLocal"; }
 
     static constexpr char const * pressureNp1AtReceiversString() { return "pressureNp1AtReceivers"; }
+    static constexpr char const * imagingConditionString() { return "imagingCondition"; }
 
   } waveEquationViewKeys;
 
 
+  /**
+   * @brief Imaging condition used to compute the partial gradient
+   */
+  enum class ImagingCondition : integer
+  {
+    CrossCorrelation,  ///< Cross-correlation of the forward and adjoint wavefields
+    SourceNormalized   ///< Cross-correlation normalized by the illumination of the forward wavefield
+  };
+
   /** internal function to the class to compute explicitStep either for backward or forward.
    * (requires not to be private because it is called from GEOS_HOST_DEVICE method)
    * @param time_n time at the beginning of the step
    * @param dt the perscribed timestep
    * @param cycleNumber the current cycle number
    * @param domain the domain object
+   * @param updateGradient flag to accumulate the partial gradient in the stiffness kernel (backward propagation only)
    * @return return the timestep that was achieved during the step.
    */
   real64 explicitStepInternal( real64 const & time_n,
                                real64 const & dt,
                                integer const cycleNumber,
-                               DomainPartition & domain );
+                               DomainPartition & domain,
+                               bool const updateGradient = false );
 
 protected:
 
@@ -165,11 +177,68 @@ private:
    */
   virtual void applyPML( real64 const time, DomainPartition & domain ) override;
 
+  /**
+   * @brief Copy the state of the time stepping (pressure at the two last steps and PML auxiliary variables) into a row of @p states
+   * @param domain the partition domain
+   * @param states the array of stored states
+   * @param slot the row of @p states where the state is copied
+   */
+  void saveState( DomainPartition & domain, arrayView2d< real32 > const & states, localIndex const slot );
+
+  /**
+   * @brief Restore the state of the time stepping from a row of @p states
+   * @param domain the partition domain
+   * @param states the array of stored states
+   * @param slot the row of @p states from which the state is restored
+   */
+  void restoreState( DomainPartition & domain, arrayView2d< real32 const > const & states, localIndex const slot );
+
+  /**
+   * @brief Store the forward state before the current step if required by the binomial checkpointing schedule
+   * @param time_n time at the beginning of the step
+   * @param dt the perscribed timestep
+   * @param cycleNumber the current cycle number
+   * @param domain the partition domain
+   */
+  void storeForwardCheckpoint( real64 const & time_n, real64 const & dt, integer const cycleNumber, DomainPartition & domain );
+
+  /**
+   * @brief Recompute the second time derivative of the forward pressure at the last forward step not yet reversed,
+   * starting from the closest checkpoint. The backward state is left unchanged.
+   * @param dt the perscribed timestep
+   * @param domain the partition domain
+   */
+  void recomputeForwardStep( real64 const & dt, DomainPartition & domain );
+
   /// Pressure_np1 at the receiver location for each time step for each receiver
   array2d< real32 > m_pressureNp1AtReceivers;
 
+  /// Forward states stored by the binomial checkpointing, one per row
+  array2d< real32 > m_checkpointStates;
+
+  /// Backward state saved while the forward steps are recomputed
+  array2d< real32 > m_backwardState;
+
+  /// Source values of the forward propagation, used to recompute the forward steps
+  array2d< real32 > m_forwardSourceValue;
+
+  /// Flag set while the forward steps are recomputed (disables the seismic traces)
+  bool m_recomputingForward;
+
+  /// Imaging condition used to compute the partial gradient
+  ImagingCondition m_imagingCondition;
+
+  /// Nodes of the PML region or with a non-zero damping profile, updated with the PML scheme
+  array1d< localIndex > m_pmlNodes;
+
+  /// Remaining nodes, updated with the undamped scheme when the PML is used
+  array1d< localIndex > m_interiorNodes;
+
 };
 
+ENUM_STRINGS( AcousticWaveEquationSEM::ImagingCondition,
+              "crossCorrelation",
+              "sourceNormalized" );
 
 namespace fields
 {
@@ -270,6 +339,15 @@ DECLARE_FIELD( PressureDoubleDerivative,
                WRITE_AND_READ,
                "Double derivative of the pressure for each node to compute the gradient" );
 
+DECLARE_FIELD( PressureDoubleDerivativeDFT,
+               "pressureDoubleDerivativeDFT",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "Real and imaginary parts of the discrete Fourier transforms of the double derivative of the pressure "
+               "at the gradient frequencies" );
+
 DECLARE_FIELD( PartialGradient,
                "partialGradient",
                array1d< real32 >,
@@ -278,6 +356,22 @@ DECLARE_FIELD( PartialGradient,
                WRITE_AND_READ,
                "Partiel gradient computed during backward propagation" );
 
+DECLARE_FIELD( PartialGradientCorrelation,
+               "partialGradientCorrelation",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "Cross-correlation of the forward and adjoint wavefields, normalized to obtain the partial gradient" );
+
+DECLARE_FIELD( ForwardIllumination,
+               "forwardIllumination",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "Illumination of the forward wavefield, by which the cross-correlation is normalized" );
+
 DECLARE_FIELD( AuxiliaryVar1PML,
                "auxiliaryVar1PML",
                array2d< real32 >,
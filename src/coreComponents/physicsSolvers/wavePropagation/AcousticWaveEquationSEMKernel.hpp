@@ -20,7 +20,9 @@
 #define GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_ACOUSTICWAVEEQUATIONSEMKERNEL_HPP_
 
 #include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "WaveSolverUtils.hpp"
+#include "AcousticWaveEquationSEM.hpp"
 #if !defined( GEOS_USE_HIP )
 #include "finiteElement/elementFormulations/Qk_Hexahedron_Lagrange_GaussLobatto.hpp"
 #endif
@@ -39,7 +41,7 @@ struct PrecomputeSourceAndReceiverKernel
    * @brief Launches the precomputation of the source and receiver terms
    * @tparam EXEC_POLICY execution policy
    * @tparam FE_TYPE finite element type
-   * @param[in] size the number of cells in the subRegion
+   * @param[in] spatialIndex index of the bounding boxes of the cells in the subRegion
    * @param[in] numNodesPerElem number of nodes per element
    * @param[in] nodeCoords coordinates of the nodes
    * @param[in] elemsToNodes map from element to nodes
@@ -57,7 +59,7 @@ struct PrecomputeSourceAndReceiverKernel
    */
   template< typename EXEC_POLICY, typename FE_TYPE >
   static void
-  launch( localIndex const size,
+  launch( ElementSpatialIndex::KernelWrapper const & spatialIndex,
           localIndex const numNodesPerElem,
           localIndex const numFacesPerElem,
           arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
@@ -82,102 +84,109 @@ struct PrecomputeSourceAndReceiverKernel
           localIndex const rickerOrder )
   {
 
-    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
-    {
-      real64 const center[3] = { elemCenter[k][0],
-                                 elemCenter[k][1],
-                                 elemCenter[k][2] };
+    // Step 1: locate the sources, and precompute the source term
 
-      // Step 1: locate the sources, and precompute the source term
+    /// loop over all the sources that haven't been found yet, visiting only the elements whose box contains them
+    forAll< EXEC_POLICY >( sourceCoordinates.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const isrc )
+    {
+      if( sourceIsAccessible[isrc] != 0 )
+      {
+        return;
+      }
+      real64 const coords[3] = { sourceCoordinates[isrc][0],
+                                 sourceCoordinates[isrc][1],
+                                 sourceCoordinates[isrc][2] };
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+      spatialIndex.forCandidates( coords, [&]( localIndex const k )
       {
-        if( sourceIsAccessible[isrc] == 0 )
+        real64 const center[3] = { elemCenter[k][0],
+                                   elemCenter[k][1],
+                                   elemCenter[k][2] };
+        bool const sourceFound =
+          WaveSolverUtils::locateSourceElement( numFacesPerElem,
+                                                center,
+                                                faceNormal,
+                                                faceCenter,
+                                                elemsToFaces[k],
+                                                coords );
+        if( !sourceFound )
         {
-          real64 const coords[3] = { sourceCoordinates[isrc][0],
-                                     sourceCoordinates[isrc][1],
-                                     sourceCoordinates[isrc][2] };
-
-          bool const sourceFound =
-            WaveSolverUtils::locateSourceElement( numFacesPerElem,
-                                                  center,
-                                                  faceNormal,
-                                                  faceCenter,
-                                                  elemsToFaces[k],
-                                                  coords );
-          if( sourceFound )
-          {
-            real64 coordsOnRefElem[3]{};
-
+          return false;
+        }
 
-            WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
-                                                                              elemsToNodes[k],
-                                                                              nodeCoords,
-                                                                              coordsOnRefElem );
+        real64 coordsOnRefElem[3]{};
+        WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
+                                                                          elemsToNodes[k],
+                                                                          nodeCoords,
+                                                                          coordsOnRefElem );
 
-            sourceIsAccessible[isrc] = 1;
-            real64 Ntest[FE_TYPE::numNodes];
-            FE_TYPE::calcN( coordsOnRefElem, Ntest );
+        sourceIsAccessible[isrc] = 1;
+        real64 Ntest[FE_TYPE::numNodes];
+        FE_TYPE::calcN( coordsOnRefElem, Ntest );
 
-            for( localIndex a = 0; a < numNodesPerElem; ++a )
-            {
-              sourceNodeIds[isrc][a] = elemsToNodes[k][a];
-              sourceConstants[isrc][a] = Ntest[a];
-            }
+        for( localIndex a = 0; a < numNodesPerElem; ++a )
+        {
+          sourceNodeIds[isrc][a] = elemsToNodes[k][a];
+          sourceConstants[isrc][a] = Ntest[a];
+        }
 
-            for( localIndex cycle = 0; cycle < sourceValue.size( 0 ); ++cycle )
-            {
-              sourceValue[cycle][isrc] = WaveSolverUtils::evaluateRicker( cycle * dt, timeSourceFrequency, timeSourceDelay, rickerOrder );
-            }
-          }
+        for( localIndex cycle = 0; cycle < sourceValue.size( 0 ); ++cycle )
+        {
+          sourceValue[cycle][isrc] = WaveSolverUtils::evaluateRicker( cycle * dt, timeSourceFrequency, timeSourceDelay, rickerOrder );
         }
-      } // end loop over all sources
+        return true;
+      } );
+    } );
 
+    // Step 2: locate the receivers, and precompute the receiver term
 
-      // Step 2: locate the receivers, and precompute the receiver term
+    /// loop over all the receivers that haven't been found yet, visiting only the elements whose box contains them
+    forAll< EXEC_POLICY >( receiverCoordinates.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] != 0 )
+      {
+        return;
+      }
+      real64 const coords[3] = { receiverCoordinates[ircv][0],
+                                 receiverCoordinates[ircv][1],
+                                 receiverCoordinates[ircv][2] };
 
-      /// loop over all the receivers that haven't been found yet
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
+      spatialIndex.forCandidates( coords, [&]( localIndex const k )
       {
-        if( receiverIsLocal[ircv] == 0 )
+        real64 const center[3] = { elemCenter[k][0],
+                                   elemCenter[k][1],
+                                   elemCenter[k][2] };
+        bool const receiverFound =
+          WaveSolverUtils::locateSourceElement( numFacesPerElem,
+                                                center,
+                                                faceNormal,
+                                                faceCenter,
+                                                elemsToFaces[k],
+                                                coords );
+        if( !receiverFound || elemGhostRank[k] >= 0 )
         {
-          real64 const coords[3] = { receiverCoordinates[ircv][0],
-                                     receiverCoordinates[ircv][1],
-                                     receiverCoordinates[ircv][2] };
-
-          real64 coordsOnRefElem[3]{};
-          bool const receiverFound =
-            WaveSolverUtils::locateSourceElement( numFacesPerElem,
-                                                  center,
-                                                  faceNormal,
-                                                  faceCenter,
-                                                  elemsToFaces[k],
-                                                  coords );
-
-          if( receiverFound && elemGhostRank[k] < 0 )
-          {
-            WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
-                                                                              elemsToNodes[k],
-                                                                              nodeCoords,
-                                                                              coordsOnRefElem );
+          return false;
+        }
 
-            receiverIsLocal[ircv] = 1;
+        real64 coordsOnRefElem[3]{};
+        WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
+                                                                          elemsToNodes[k],
+                                                                          nodeCoords,
+                                                                          coordsOnRefElem );
 
-            real64 Ntest[FE_TYPE::numNodes];
-            FE_TYPE::calcN( coordsOnRefElem, Ntest );
+        receiverIsLocal[ircv] = 1;
 
-            for( localIndex a = 0; a < numNodesPerElem; ++a )
-            {
-              receiverNodeIds[ircv][a] = elemsToNodes[k][a];
-              receiverConstants[ircv][a] = Ntest[a];
-            }
-          }
-        }
-      } // end loop over receivers
+        real64 Ntest[FE_TYPE::numNodes];
+        FE_TYPE::calcN( coordsOnRefElem, Ntest );
 
+        for( localIndex a = 0; a < numNodesPerElem; ++a )
+        {
+          receiverNodeIds[ircv][a] = elemsToNodes[k][a];
+          receiverConstants[ircv][a] = Ntest[a];
+        }
+        return true;
+      } );
     } );
-
   }
 };
 
@@ -758,11 +767,19 @@ public:
 public:
     GEOS_HOST_DEVICE
     StackVariables():
-      xLocal()
+      xLocal(),
+      pLocal(),
+      stiffnessVectorLocal()
     {}
 
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// C-array stack storage for element local the nodal pressure.
+    real64 pLocal[ numNodesPerElem ];
+
+    /// C-array stack storage for element local the product of the stiffness matrix and the nodal pressure.
+    real64 stiffnessVectorLocal[ numNodesPerElem ];
   };
   //***************************************************************************
 
@@ -785,6 +802,8 @@ public:
       {
         stack.xLocal[ a ][ i ] = m_nodeCoords[ nodeIndex ][ i ];
       }
+      stack.pLocal[ a ] = m_p_n[ nodeIndex ];
+      stack.stiffnessVectorLocal[ a ] = 0.0;
     }
   }
 
@@ -792,7 +811,8 @@ public:
    * @copydoc geos::finiteElement::KernelBase::quadraturePointKernel
    *
    * ### ExplicitAcousticSEM Description
-   * Calculates stiffness vector
+   * Calculates the contribution of the quadrature point to the element stiffness vector
+   * with the sum-factorized stiffness application of the finite element space.
    *
    */
   GEOS_HOST_DEVICE
@@ -801,12 +821,29 @@ public:
                               localIndex const q,
                               StackVariables & stack ) const
   {
-    m_finiteElementSpace.template computeStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, real64 val )
+    GEOS_UNUSED_VAR( k );
+    m_finiteElementSpace.template applyStiffnessTerm( q, stack.xLocal, stack.pLocal, stack.stiffnessVectorLocal );
+  }
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticSEM Description
+   * Scales the element stiffness vector by the inverse of the density and
+   * adds it to the nodal stiffness vector.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    real32 const invDensity = 1./m_density[k];
+    for( localIndex a=0; a< numNodesPerElem; ++a )
     {
-      real32 invDensity = 1./m_density[k];
-      real32 const localIncrement = invDensity*val*m_p_n[m_elemsToNodes[k][j]];
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[m_elemsToNodes[k][i]], localIncrement );
-    } );
+      real32 const localIncrement = invDensity*stack.stiffnessVectorLocal[ a ];
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[m_elemsToNodes[k][a]], localIncrement );
+    }
+    return 0;
   }
 
 protected:
@@ -835,6 +872,153 @@ using ExplicitAcousticSEMFactory = finiteElement::KernelFactory< ExplicitAcousti
                                                                  real64 >;
 
 
+/**
+ * @brief Stiffness kernel of the backward propagation, which also applies the imaging condition.
+ * @copydoc ExplicitAcousticSEM
+ * @tparam IMAGING_CONDITION The imaging condition applied to compute the partial gradient.
+ *
+ * ### ExplicitAcousticSEMGradient Description
+ * The partial gradient is accumulated in the complete function from the adjoint pressure already
+ * gathered for the stiffness term and the second time derivative of the forward pressure, so that
+ * the fields of the step are read once.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE,
+          AcousticWaveEquationSEM::ImagingCondition IMAGING_CONDITION >
+class ExplicitAcousticSEMGradient : public ExplicitAcousticSEM< SUBREGION_TYPE,
+                                                                CONSTITUTIVE_TYPE,
+                                                                FE_TYPE >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = ExplicitAcousticSEM< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE >;
+
+  using typename Base::StackVariables;
+  using Base::m_elemsToNodes;
+  using Base::m_elemGhostRank;
+
+  /// Number of vertices per element over which the imaging condition is lumped
+  static constexpr int numVerticesPerElem = 8;
+
+  /// Flag to accumulate the illumination of the forward wavefield
+  static constexpr bool sourceNormalized = IMAGING_CONDITION == AcousticWaveEquationSEM::ImagingCondition::SourceNormalized;
+
+  /**
+   * @brief Constructor
+   * @copydoc ExplicitAcousticSEM::ExplicitAcousticSEM
+   */
+  ExplicitAcousticSEMGradient( NodeManager & nodeManager,
+                               EdgeManager const & edgeManager,
+                               FaceManager const & faceManager,
+                               localIndex const targetRegionIndex,
+                               SUBREGION_TYPE const & elementSubRegion,
+                               FE_TYPE const & finiteElementSpace,
+                               CONSTITUTIVE_TYPE & inputConstitutiveType,
+                               real64 const dt ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          targetRegionIndex,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          dt ),
+    m_p_dt2( nodeManager.getField< fields::PressureDoubleDerivative >() ),
+    m_mass( nodeManager.getField< fields::MassVector >() ),
+    m_velocity( elementSubRegion.template getField< fields::MediumVelocity >() ),
+    m_grad( elementSubRegion.template getField< fields::PartialGradient >() ),
+    m_correlation( sourceNormalized ? elementSubRegion.template getField< fields::PartialGradientCorrelation >().toView() : arrayView1d< real32 >() ),
+    m_illumination( sourceNormalized ? elementSubRegion.template getField< fields::ForwardIllumination >().toView() : arrayView1d< real32 >() )
+  {}
+
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticSEMGradient Description
+   * Adds the element stiffness vector to the nodal stiffness vector, and accumulates
+   * the imaging condition of the step in the partial gradient of the locally owned elements.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    Base::complete( k, stack );
+
+    if( m_elemGhostRank[k] >= 0 )
+    {
+      return 0;
+    }
+
+    real32 correlation = 0.0;
+    real32 illumination = 0.0;
+    for( localIndex a = 0; a < numVerticesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, a );
+      real32 const weight = m_mass[nodeIndex] / numVerticesPerElem;
+      correlation += weight * m_p_dt2[nodeIndex] * stack.pLocal[a];
+      if constexpr ( sourceNormalized )
+      {
+        illumination += weight * m_p_dt2[nodeIndex] * m_p_dt2[nodeIndex];
+      }
+    }
+
+    real32 const factor = -2.0 / m_velocity[k];
+    if constexpr ( sourceNormalized )
+    {
+      m_correlation[k] += factor * correlation;
+      m_illumination[k] += illumination;
+      m_grad[k] = m_illumination[k] > 0.0 ? m_correlation[k] / m_illumination[k] : 0.0;
+    }
+    else
+    {
+      m_grad[k] += factor * correlation;
+    }
+    return 0;
+  }
+
+protected:
+  /// The array containing the second time derivative of the forward pressure.
+  arrayView1d< real32 const > const m_p_dt2;
+
+  /// The array containing the diagonal of the mass matrix.
+  arrayView1d< real32 const > const m_mass;
+
+  /// The array containing the cell-wise velocity.
+  arrayView1d< real32 const > const m_velocity;
+
+  /// The array containing the cell-wise partial gradient.
+  arrayView1d< real32 > const m_grad;
+
+  /// The array containing the cell-wise cross-correlation (source-normalized imaging condition only).
+  arrayView1d< real32 > const m_correlation;
+
+  /// The array containing the cell-wise illumination of the forward wavefield (source-normalized imaging condition only).
+  arrayView1d< real32 > const m_illumination;
+};
+
+/**
+ * @brief Helper to bind the imaging condition of the gradient kernel in the factory.
+ * @tparam IMAGING_CONDITION The imaging condition applied to compute the partial gradient.
+ */
+template< AcousticWaveEquationSEM::ImagingCondition IMAGING_CONDITION >
+struct ExplicitAcousticSEMGradientBinder
+{
+  /// The gradient kernel with the bound imaging condition
+  template< typename SUBREGION_TYPE, typename CONSTITUTIVE_TYPE, typename FE_TYPE >
+  using Kernel = ExplicitAcousticSEMGradient< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE, IMAGING_CONDITION >;
+};
+
+/// The factory used to construct a ExplicitAcousticSEMGradient kernel.
+template< AcousticWaveEquationSEM::ImagingCondition IMAGING_CONDITION >
+using ExplicitAcousticSEMGradientFactory = finiteElement::KernelFactory< ExplicitAcousticSEMGradientBinder< IMAGING_CONDITION >::template Kernel,
+                                                                         real64 >;
+
+
 } // namespace acousticWaveEquationSEMKernels
 
 } // namespace geos
@@ -0,0 +1,200 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file BinomialCheckpointSchedule.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_BINOMIALCHECKPOINTSCHEDULE_HPP_
+#define GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_BINOMIALCHECKPOINTSCHEDULE_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @class BinomialCheckpointSchedule
+ * @brief Schedule of the forward states to store in order to reverse a time stepping with a bounded memory.
+ *
+ * The steps 0, ..., numSteps-1 of the forward sweep are reversed in decreasing order. Only a fixed number of
+ * forward states (the state before a given step) can be kept at the same time, and the other ones are recomputed
+ * from the closest checkpoint. The checkpoints are placed with the binomial strategy of Griewank (revolve): with
+ * s checkpoints, C(s+r, s) steps can be reversed with each step being recomputed at most r times, so that the
+ * number of checkpoints only grows logarithmically with the number of steps for a fixed recomputation factor.
+ *
+ * The schedule only manages step indices. The checkpoints are stored in slots 0, ..., maxCheckpoints-1 used as
+ * a stack: the last slot in use always holds the latest checkpoint.
+ */
+class BinomialCheckpointSchedule
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param numSteps number of steps of the forward sweep
+   * @param maxCheckpoints maximum number of forward states stored at the same time
+   */
+  BinomialCheckpointSchedule( integer const numSteps, integer const maxCheckpoints ):
+    m_numSteps( numSteps ),
+    m_maxCheckpoints( maxCheckpoints ),
+    m_nextForwardCheckpoint( 0 )
+  {
+    GEOS_ERROR_IF_LT_MSG( maxCheckpoints, 1, "At least one checkpoint is needed" );
+    m_checkpoints.reserve( maxCheckpoints );
+  }
+
+  /**
+   * @brief Advance the forward sweep, the steps being visited in increasing order.
+   * @param step index of the step about to be taken
+   * @return the slot where the state before @p step must be stored, or -1 if it must not be stored
+   */
+  integer forwardStep( integer const step )
+  {
+    if( step != m_nextForwardCheckpoint )
+    {
+      return -1;
+    }
+    integer const slot = push( step );
+    m_nextForwardCheckpoint = nextCheckpoint( step, m_numSteps );
+    return slot;
+  }
+
+  /**
+   * @brief Release the checkpoints no longer needed to reverse the steps up to @p step.
+   * @param step index of the next step to reverse
+   */
+  void releaseAfter( integer const step )
+  {
+    while( !m_checkpoints.empty() && m_checkpoints.back() > step )
+    {
+      m_checkpoints.pop_back();
+    }
+    GEOS_ERROR_IF( m_checkpoints.empty(), "No checkpoint available to recompute step " << step );
+  }
+
+  /**
+   * @brief Compute where the next checkpoint must be stored when advancing from the latest checkpoint.
+   * @param start step of the latest checkpoint
+   * @param end end (excluded) of the range of steps [start, end) that remains to be reversed
+   * @return the step before which the next checkpoint must be stored, or @p end if no checkpoint must be stored
+   */
+  integer nextCheckpoint( integer const start, integer const end ) const
+  {
+    integer const numRemainingSteps = end - start;
+    // number of checkpoints available for the range, including the one held at start
+    integer const numAvailable = m_maxCheckpoints - numCheckpoints() + 1;
+    if( numRemainingSteps <= 1 || numAvailable <= 1 )
+    {
+      return end;
+    }
+
+    // smallest number of repetitions such that the range can be reversed
+    integer numRepetitions = 1;
+    while( beta( numAvailable, numRepetitions ) < numRemainingSteps )
+    {
+      ++numRepetitions;
+    }
+    // the part after the new checkpoint is reversed with one checkpoint less, the part before with one repetition less
+    long long const offset = std::max( 1LL, numRemainingSteps - beta( numAvailable - 1, numRepetitions ) );
+    return start + LvArray::integerConversion< integer >( offset );
+  }
+
+  /**
+   * @brief Register a new checkpoint.
+   * @param step step before which the state is stored
+   * @return the slot where the state must be stored
+   */
+  integer push( integer const step )
+  {
+    GEOS_ERROR_IF_GE_MSG( numCheckpoints(), m_maxCheckpoints, "Maximum number of checkpoints exceeded" );
+    GEOS_ERROR_IF( !m_checkpoints.empty() && m_checkpoints.back() >= step, "Checkpoints must be stored in increasing step order" );
+    m_checkpoints.push_back( step );
+    return numCheckpoints() - 1;
+  }
+
+  /**
+   * @return the number of checkpoints currently stored
+   */
+  integer numCheckpoints() const
+  {
+    return LvArray::integerConversion< integer >( m_checkpoints.size() );
+  }
+
+  /**
+   * @return the step of the latest checkpoint
+   */
+  integer lastCheckpointStep() const
+  {
+    GEOS_ERROR_IF( m_checkpoints.empty(), "No checkpoint stored" );
+    return m_checkpoints.back();
+  }
+
+  /**
+   * @return the slot of the latest checkpoint
+   */
+  integer lastCheckpointSlot() const
+  {
+    return numCheckpoints() - 1;
+  }
+
+  /**
+   * @return the maximum number of checkpoints stored at the same time
+   */
+  integer maxCheckpoints() const
+  {
+    return m_maxCheckpoints;
+  }
+
+private:
+
+  /**
+   * @brief Maximum number of steps reversible with a given number of checkpoints and repetitions.
+   * @param numCheckpoints number of checkpoints
+   * @param numRepetitions maximum number of times a step is recomputed
+   * @return the binomial coefficient C(numCheckpoints+numRepetitions, numCheckpoints), saturated to avoid overflows
+   */
+  static long long beta( integer const numCheckpoints, integer const numRepetitions )
+  {
+    long long constexpr maxValue = 1LL << 40;
+    long long value = 1;
+    for( integer i = 1; i <= numCheckpoints; ++i )
+    {
+      // exact since the product of i consecutive integers is divisible by i!
+      value = value * ( numRepetitions + i ) / i;
+      if( value > maxValue )
+      {
+        return maxValue;
+      }
+    }
+    return value;
+  }
+
+  /// number of steps of the forward sweep
+  integer const m_numSteps;
+
+  /// maximum number of checkpoints stored at the same time
+  integer const m_maxCheckpoints;
+
+  /// step before which the next checkpoint of the forward sweep is stored
+  integer m_nextForwardCheckpoint;
+
+  /// steps of the stored checkpoints, in increasing order (the index is the slot)
+  std::vector< integer > m_checkpoints;
+};
+
+} /* namespace geos */
+
+#endif /* GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_BINOMIALCHECKPOINTSCHEDULE_HPP_ */
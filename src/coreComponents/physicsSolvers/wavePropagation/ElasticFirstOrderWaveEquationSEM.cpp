@@ -104,6 +104,12 @@ ElasticFirstOrderWaveEquationSEM::ElasticFirstOrderWaveEquationSEM( const std::s
     setSizedFromParent( 0 ).
     setDescription( "Region containing the receivers" );
 
+  registerWrapper( viewKeyStruct::fuseStressVelocityUpdateString(), &m_fuseStressVelocityUpdate ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Set to 1 to update the stress and the velocity of each element in a single kernel, "
+                    "which reads and writes the stress once per time step at the cost of a copy of the displacement" );
+
 }
 
 ElasticFirstOrderWaveEquationSEM::~ElasticFirstOrderWaveEquationSEM()
@@ -138,6 +144,14 @@ void ElasticFirstOrderWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
                                wavesolverfields::DampingVectorz,
                                wavesolverfields::FreeSurfaceNodeIndicator >( getName() );
 
+    /// register the displacement of the previous step only when the fused update, which reads it, is used
+    if( m_fuseStressVelocityUpdate )
+    {
+      nodeManager.registerField< wavesolverfields::Displacementx_n,
+                                 wavesolverfields::Displacementy_n,
+                                 wavesolverfields::Displacementz_n >( getName() );
+    }
+
     FaceManager & faceManager = mesh.getFaceManager();
     faceManager.registerField< wavesolverfields::FreeSurfaceFaceIndicator >( getName() );
 
@@ -548,6 +562,22 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
     arrayView1d< real32 > const uy_np1 = nodeManager.getField< wavesolverfields::Displacementy_np1 >();
     arrayView1d< real32 > const uz_np1 = nodeManager.getField< wavesolverfields::Displacementz_np1 >();
 
+    bool const fuseUpdate = m_fuseStressVelocityUpdate;
+    arrayView1d< real32 > ux_n;
+    arrayView1d< real32 > uy_n;
+    arrayView1d< real32 > uz_n;
+    if( fuseUpdate )
+    {
+      ux_n = nodeManager.getField< wavesolverfields::Displacementx_n >();
+      uy_n = nodeManager.getField< wavesolverfields::Displacementy_n >();
+      uz_n = nodeManager.getField< wavesolverfields::Displacementz_n >();
+
+      // the damping is applied once to all the nodes, before and after the element loops of all the subregions
+      elasticFirstOrderWaveEquationSEMKernels::
+        prepareFusedVelocityUpdate< EXEC_POLICY >( nodeManager.size(), mass, dampingx, dampingy, dampingz, dt,
+                                                   ux_np1, uy_np1, uz_np1, ux_n, uy_n, uz_n );
+    }
+
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
                                                                                           CellElementSubRegion & elementSubRegion )
     {
@@ -575,6 +605,43 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
       {
         using FE_TYPE = TYPEOFREF( finiteElement );
 
+        if( fuseUpdate )
+        {
+          elasticFirstOrderWaveEquationSEMKernels::
+            StressVelocityComputation< FE_TYPE > kernel( finiteElement );
+          kernel.template launch< EXEC_POLICY, ATOMIC_POLICY >
+            ( elementSubRegion.size(),
+            regionIndex,
+            X,
+            elemsToNodes,
+            ux_n,
+            uy_n,
+            uz_n,
+            density,
+            velocityVp,
+            velocityVs,
+            lambda,
+            mu,
+            sourceConstants,
+            sourceIsAccessible,
+            sourceElem,
+            sourceRegion,
+            sourceValue,
+            mass,
+            dt,
+            cycleNumber,
+            stressxx,
+            stressyy,
+            stresszz,
+            stressxy,
+            stressxz,
+            stressyz,
+            ux_np1,
+            uy_np1,
+            uz_np1 );
+          return;
+        }
+
         elasticFirstOrderWaveEquationSEMKernels::
           StressComputation< FE_TYPE > kernel( finiteElement );
         kernel.template launch< EXEC_POLICY, ATOMIC_POLICY >
@@ -646,6 +713,13 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
 
     } );
 
+    if( fuseUpdate )
+    {
+      elasticFirstOrderWaveEquationSEMKernels::
+        finalizeFusedVelocityUpdate< EXEC_POLICY >( nodeManager.size(), mass, dampingx, dampingy, dampingz, dt,
+                                                    ux_np1, uy_np1, uz_np1 );
+    }
+
     FieldIdentifiers fieldsToBeSync;
     fieldsToBeSync.addFields( FieldLocation::Node, { wavesolverfields::Displacementx_np1::key(), wavesolverfields::Displacementy_np1::key(), wavesolverfields::Displacementz_np1::key()} );
     fieldsToBeSync.addElementFields( {wavesolverfields::Stresstensorxx::key(), wavesolverfields::Stresstensoryy::key(), wavesolverfields::Stresstensorzz::key(),
@@ -654,10 +728,10 @@ real64 ElasticFirstOrderWaveEquationSEM::explicitStepInternal( real64 const & ti
 
 
     CommunicationTools & syncFields = CommunicationTools::getInstance();
-    syncFields.synchronizeFields( fieldsToBeSync,
-                                  domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ),
-                                  domain.getNeighbors(),
-                                  true );
+    syncFields.synchronizeFieldsPersistent( fieldsToBeSync,
+                                            domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ),
+                                            domain.getNeighbors(),
+                                            true );
 
     // compute the seismic traces since last step.
     arrayView2d< real32 > const uxReceivers   = m_displacementxNp1AtReceivers.toView();
@@ -138,6 +138,8 @@ public:
     static constexpr char const * receiverElemString() { return "rcvElem"; }
     static constexpr char const * receiverRegionString() { return "receiverRegion"; }
 
+    static constexpr char const * fuseStressVelocityUpdateString() { return "fuseStressVelocityUpdate"; }
+
   } waveEquationViewKeys;
 
   /** internal function to the class to compute explicitStep either for backward or forward.
@@ -222,6 +224,9 @@ private:
   /// Array containing the elements which contain the region which the receiver belongs
   array1d< localIndex > m_receiverRegion;
 
+  /// Flag to update the stress and the velocity in a single element kernel
+  integer m_fuseStressVelocityUpdate;
+
 };
 
 } /* namespace geos */
@@ -623,6 +623,273 @@ struct VelocityComputation
 };
 
 
+/**
+ * @brief Copy the displacement of the previous step and apply the explicit part of the damping
+ * @tparam EXEC_POLICY the execution policy
+ * @param[in] size_node the number of nodes
+ * @param[in] mass the diagonal of the mass matrix
+ * @param[in] dampingx the x-component of the diagonal of the damping matrix
+ * @param[in] dampingy the y-component of the diagonal of the damping matrix
+ * @param[in] dampingz the z-component of the diagonal of the damping matrix
+ * @param[in] dt the time step
+ * @param[inout] ux_np1 the x-component of the displacement
+ * @param[inout] uy_np1 the y-component of the displacement
+ * @param[inout] uz_np1 the z-component of the displacement
+ * @param[out] ux_n the x-component of the displacement of the previous step
+ * @param[out] uy_n the y-component of the displacement of the previous step
+ * @param[out] uz_n the z-component of the displacement of the previous step
+ */
+template< typename EXEC_POLICY >
+void
+prepareFusedVelocityUpdate( localIndex const size_node,
+                            arrayView1d< real32 const > const mass,
+                            arrayView1d< real32 const > const dampingx,
+                            arrayView1d< real32 const > const dampingy,
+                            arrayView1d< real32 const > const dampingz,
+                            real64 const dt,
+                            arrayView1d< real32 > const ux_np1,
+                            arrayView1d< real32 > const uy_np1,
+                            arrayView1d< real32 > const uz_np1,
+                            arrayView1d< real32 > const ux_n,
+                            arrayView1d< real32 > const uy_n,
+                            arrayView1d< real32 > const uz_n )
+{
+  forAll< EXEC_POLICY >( size_node, [=] GEOS_HOST_DEVICE ( localIndex const a )
+  {
+    ux_n[a] = ux_np1[a];
+    uy_n[a] = uy_np1[a];
+    uz_n[a] = uz_np1[a];
+    ux_np1[a] *= 1.0-((dt/2)*(dampingx[a]/mass[a]));
+    uy_np1[a] *= 1.0-((dt/2)*(dampingy[a]/mass[a]));
+    uz_np1[a] *= 1.0-((dt/2)*(dampingz[a]/mass[a]));
+  } );
+}
+
+/**
+ * @brief Apply the implicit part of the damping
+ * @tparam EXEC_POLICY the execution policy
+ * @param[in] size_node the number of nodes
+ * @param[in] mass the diagonal of the mass matrix
+ * @param[in] dampingx the x-component of the diagonal of the damping matrix
+ * @param[in] dampingy the y-component of the diagonal of the damping matrix
+ * @param[in] dampingz the z-component of the diagonal of the damping matrix
+ * @param[in] dt the time step
+ * @param[inout] ux_np1 the x-component of the displacement
+ * @param[inout] uy_np1 the y-component of the displacement
+ * @param[inout] uz_np1 the z-component of the displacement
+ */
+template< typename EXEC_POLICY >
+void
+finalizeFusedVelocityUpdate( localIndex const size_node,
+                             arrayView1d< real32 const > const mass,
+                             arrayView1d< real32 const > const dampingx,
+                             arrayView1d< real32 const > const dampingy,
+                             arrayView1d< real32 const > const dampingz,
+                             real64 const dt,
+                             arrayView1d< real32 > const ux_np1,
+                             arrayView1d< real32 > const uy_np1,
+                             arrayView1d< real32 > const uz_np1 )
+{
+  forAll< EXEC_POLICY >( size_node, [=] GEOS_HOST_DEVICE ( localIndex const a )
+  {
+    ux_np1[a] /= 1.0+((dt/2)*(dampingx[a]/mass[a]));
+    uy_np1[a] /= 1.0+((dt/2)*(dampingy[a]/mass[a]));
+    uz_np1[a] /= 1.0+((dt/2)*(dampingz[a]/mass[a]));
+  } );
+}
+
+/**
+ * @brief Fused stress and velocity update of the first-order formulation.
+ * @tparam FE_TYPE the finite element type
+ *
+ * The displacement of the element nodes at the previous step is gathered once, the stress of the element is
+ * updated in registers, and its contribution to the velocity update is accumulated before the stress is written
+ * back, so that the stress is read and written once per step (instead of read twice and written once by the
+ * StressComputation and VelocityComputation kernels). Since the stress of an element depends on the displacement
+ * of the previous step, that displacement is read from a copy (u_n) while the new one (u_np1) is accumulated.
+ * The damping of u_np1 before and after the launches is applied by prepareFusedVelocityUpdate and finalizeFusedVelocityUpdate.
+ */
+template< typename FE_TYPE >
+struct StressVelocityComputation
+{
+
+  StressVelocityComputation( FE_TYPE const & finiteElement )
+    : m_finiteElement( finiteElement )
+  {}
+
+  /**
+   * @brief Launch the fused stress and velocity update on the elements of a subregion
+   * @tparam EXEC_POLICY the execution policy
+   * @tparam ATOMIC_POLICY the atomic policy
+   * The arguments are those of StressComputation::launch and VelocityComputation::launch,
+   * with the displacement of the previous step @p ux_n, @p uy_n, @p uz_n read by the stress update.
+   */
+  template< typename EXEC_POLICY, typename ATOMIC_POLICY >
+  void
+  launch( localIndex const size,
+          localIndex const regionIndex,
+          arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
+          arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes,
+          arrayView1d< real32 const > const ux_n,
+          arrayView1d< real32 const > const uy_n,
+          arrayView1d< real32 const > const uz_n,
+          arrayView1d< real32 const > const density,
+          arrayView1d< real32 const > const velocityVp,
+          arrayView1d< real32 const > const velocityVs,
+          arrayView1d< real32 > const lambda,
+          arrayView1d< real32 > const mu,
+          arrayView2d< real64 const > const sourceConstants,
+          arrayView1d< localIndex const > const sourceIsLocal,
+          arrayView1d< localIndex const > const sourceElem,
+          arrayView1d< localIndex const > const sourceRegion,
+          arrayView2d< real32 const > const sourceValue,
+          arrayView1d< real32 const > const mass,
+          real64 const dt,
+          integer const cycleNumber,
+          arrayView2d< real32 > const stressxx,
+          arrayView2d< real32 > const stressyy,
+          arrayView2d< real32 > const stresszz,
+          arrayView2d< real32 > const stressxy,
+          arrayView2d< real32 > const stressxz,
+          arrayView2d< real32 > const stressyz,
+          arrayView1d< real32 > const ux_np1,
+          arrayView1d< real32 > const uy_np1,
+          arrayView1d< real32 > const uz_np1 )
+  {
+    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
+      constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
+
+      // gather the element data once
+      real64 xLocal[numNodesPerElem][3];
+      real32 uxLocal[numNodesPerElem];
+      real32 uyLocal[numNodesPerElem];
+      real32 uzLocal[numNodesPerElem];
+      real32 massLocal[numNodesPerElem];
+      for( localIndex a=0; a< numNodesPerElem; ++a )
+      {
+        localIndex const nodeIndex = elemsToNodes( k, a );
+        for( localIndex i=0; i<3; ++i )
+        {
+          xLocal[a][i] = nodeCoords( nodeIndex, i );
+        }
+        uxLocal[a] = ux_n[nodeIndex];
+        uyLocal[a] = uy_n[nodeIndex];
+        uzLocal[a] = uz_n[nodeIndex];
+      }
+      for( localIndex a=0; a< numNodesPerElem; ++a )
+      {
+        massLocal[a] = m_finiteElement.computeMassTerm( a, xLocal );
+      }
+
+      real32 const muk = density[k] * velocityVs[k] * velocityVs[k];
+      real32 const lambdak = density[k] * velocityVp[k] * velocityVp[k] - 2.0*muk;
+      mu[k] = muk;
+      lambda[k] = lambdak;
+
+      // stress update
+      real32 sxx[numNodesPerElem] = {0.0};
+      real32 syy[numNodesPerElem] = {0.0};
+      real32 szz[numNodesPerElem] = {0.0};
+      real32 sxy[numNodesPerElem] = {0.0};
+      real32 sxz[numNodesPerElem] = {0.0};
+      real32 syz[numNodesPerElem] = {0.0};
+      real32 auxx[numNodesPerElem] = {0.0};
+      real32 auyy[numNodesPerElem] = {0.0};
+      real32 auzz[numNodesPerElem] = {0.0};
+      real32 auxy[numNodesPerElem] = {0.0};
+      real32 auxz[numNodesPerElem] = {0.0};
+      real32 auyz[numNodesPerElem] = {0.0};
+
+      auto strainTerm = [&] ( int i, int j, real32 df1, real32 df2, real32 df3 )
+      {
+        auxx[j]+= df1*uxLocal[i];
+        auyy[j]+= df2*uyLocal[i];
+        auzz[j]+= df3*uzLocal[i];
+        auxy[j]+= df1*uyLocal[i]+df2*uxLocal[i];
+        auxz[j]+= df1*uzLocal[i]+df3*uxLocal[i];
+        auyz[j]+= df2*uzLocal[i]+df3*uyLocal[i];
+      };
+
+      for( localIndex q=0; q<numQuadraturePointsPerElem; ++q )
+      {
+        m_finiteElement.template computeFirstOrderStiffnessTermX( q, xLocal, strainTerm );
+        m_finiteElement.template computeFirstOrderStiffnessTermY( q, xLocal, strainTerm );
+        m_finiteElement.template computeFirstOrderStiffnessTermZ( q, xLocal, strainTerm );
+      }
+
+      for( localIndex i = 0; i < numNodesPerElem; ++i )
+      {
+        real32 const diag = lambdak*(auxx[i]+auyy[i]+auzz[i]);
+        sxx[i] = stressxx[k][i] + dt*(diag+2*muk*auxx[i])/massLocal[i];
+        syy[i] = stressyy[k][i] + dt*(diag+2*muk*auyy[i])/massLocal[i];
+        szz[i] = stresszz[k][i] + dt*(diag+2*muk*auzz[i])/massLocal[i];
+        sxy[i] = stressxy[k][i] + dt*muk*auxy[i]/massLocal[i];
+        sxz[i] = stressxz[k][i] + dt*muk*auxz[i]/massLocal[i];
+        syz[i] = stressyz[k][i] + dt*muk*auyz[i]/massLocal[i];
+      }
+
+      // source injection
+      for( localIndex isrc = 0; isrc < sourceConstants.size( 0 ); ++isrc )
+      {
+        if( sourceIsLocal[isrc] == 1 && sourceElem[isrc]==k && sourceRegion[isrc] == regionIndex )
+        {
+          for( localIndex i = 0; i < numNodesPerElem; ++i )
+          {
+            real32 const localIncrement = dt*(sourceConstants[isrc][i]*sourceValue[cycleNumber][isrc])/massLocal[i];
+            sxx[i] += localIncrement;
+            syy[i] += localIncrement;
+            szz[i] += localIncrement;
+          }
+        }
+      }
+
+      for( localIndex i = 0; i < numNodesPerElem; ++i )
+      {
+        stressxx[k][i] = sxx[i];
+        stressyy[k][i] = syy[i];
+        stresszz[k][i] = szz[i];
+        stressxy[k][i] = sxy[i];
+        stressxz[k][i] = sxz[i];
+        stressyz[k][i] = syz[i];
+      }
+
+      // velocity update with the stress held in registers
+      real32 flowx[numNodesPerElem] = {0.0};
+      real32 flowy[numNodesPerElem] = {0.0};
+      real32 flowz[numNodesPerElem] = {0.0};
+
+      auto divergenceTerm = [&] ( int i, int j, real32 df1, real32 df2, real32 df3 )
+      {
+        flowx[i] -= sxx[j]*df1 + sxy[j]*df2 + sxz[j]*df3;
+        flowy[i] -= sxy[j]*df1 + syy[j]*df2 + syz[j]*df3;
+        flowz[i] -= sxz[j]*df1 + syz[j]*df2 + szz[j]*df3;
+      };
+
+      for( localIndex q=0; q<numQuadraturePointsPerElem; ++q )
+      {
+        m_finiteElement.template computeFirstOrderStiffnessTermX( q, xLocal, divergenceTerm );
+        m_finiteElement.template computeFirstOrderStiffnessTermY( q, xLocal, divergenceTerm );
+        m_finiteElement.template computeFirstOrderStiffnessTermZ( q, xLocal, divergenceTerm );
+      }
+
+      for( localIndex i = 0; i < numNodesPerElem; ++i )
+      {
+        localIndex const nodeIndex = elemsToNodes( k, i );
+        real32 const invMass = 1.0 / mass[nodeIndex];
+        RAJA::atomicAdd< ATOMIC_POLICY >( &ux_np1[nodeIndex], dt*flowx[i]*invMass );
+        RAJA::atomicAdd< ATOMIC_POLICY >( &uy_np1[nodeIndex], dt*flowy[i]*invMass );
+        RAJA::atomicAdd< ATOMIC_POLICY >( &uz_np1[nodeIndex], dt*flowz[i]*invMass );
+      }
+    } );
+  }
+
+  /// The finite element space/discretization object for the element type in the subRegion
+  FE_TYPE const & m_finiteElement;
+};
+
+
 } // namespace ElasticFirstOrderWaveEquationSEMKernels
 
 } // namespace geos
@@ -25,6 +25,7 @@
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/ElementType.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "WaveSolverUtils.hpp"
 
 namespace geos
@@ -107,6 +108,14 @@ ElasticWaveEquationSEM::ElasticWaveEquationSEM( const std::string & name,
     setApplyDefaultValue( { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 } ).
     setDescription( "Moment of the source: 6 real values describing a symmetric tensor in Voigt notation."
                     "The default value is { 1, 1, 1, 0, 0, 0 } (diagonal moment, corresponding to a pure explosion)." );
+
+  registerWrapper( viewKeyStruct::useDASStrainReceiversString(), &m_useDASStrainReceivers ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to model each DAS channel with a single strain receiver, evaluating the axial strain at the channel "
+                    "from the gradients of the basis functions, instead of a pair of displacement receivers at both ends of the gauge length. "
+                    "The strain is then a point value, which matches the gauge-averaged strain when the gauge length is small "
+                    "compared to the wavelength" );
 }
 
 ElasticWaveEquationSEM::~ElasticWaveEquationSEM()
@@ -305,6 +314,7 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
   sourceIsAccessible.zero();
 
   arrayView2d< real64 const > const receiverCoordinates = m_receiverCoordinates.toViewConst();
+  arrayView2d< real64 const > const linearDASGeometry = m_linearDASGeometry.toViewConst();
   arrayView2d< localIndex > const receiverNodeIds = m_receiverNodeIds.toView();
   arrayView2d< real64 > const receiverConstants = m_receiverConstants.toView();
   arrayView1d< localIndex > const receiverIsLocal = m_receiverIsLocal.toView();
@@ -346,10 +356,13 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
 
       localIndex const numFacesPerElem = elementSubRegion.numFacesPerElement();
 
+      GEOS_MARK_SCOPE( elasticWaveEquationSEMKernels::PrecomputeSourceAndReceiverKernel );
+      ElementSpatialIndex spatialIndex;
+      spatialIndex.build< EXEC_POLICY >( elemsToNodes, X );
       elasticWaveEquationSEMKernels::
         PrecomputeSourceAndReceiverKernel::
         launch< EXEC_POLICY, FE_TYPE >
-        ( elementSubRegion.size(),
+        ( spatialIndex.createKernelWrapper(),
         numFacesPerElem,
         X,
         elemGhostRank,
@@ -365,6 +378,8 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
         sourceConstantsy,
         sourceConstantsz,
         receiverCoordinates,
+        linearDASGeometry,
+        m_useDAS && m_useDASStrainReceivers,
         receiverIsLocal,
         receiverNodeIds,
         receiverConstants,
@@ -390,7 +405,32 @@ void ElasticWaveEquationSEM::computeDAS ( arrayView2d< real32 > const xCompRcv,
   localIndex const numReceiversGlobal = linearDASGeometry.size( 0 );
   localIndex const nsamplesSeismoTrace = m_nsamplesSeismoTrace;
 
-  if( m_nsamplesSeismoTrace > 0 )
+  if( m_nsamplesSeismoTrace > 0 && m_useDASStrainReceivers )
+  {
+    /// the strain receivers hold the derivatives along the fiber of the three displacement components,
+    /// computed on the rank owning the channel: projecting them on the fiber gives the axial strain,
+    /// without any synchronization across MPI ranks
+    forAll< EXEC_POLICY >( numReceiversGlobal, [=] GEOS_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] == 1 )
+      {
+        real32 const cd = cos( linearDASGeometry[ircv][0] );
+        real32 const sd = sin( linearDASGeometry[ircv][0] );
+        real32 const ca = cos( linearDASGeometry[ircv][1] );
+        real32 const sa = sin( linearDASGeometry[ircv][1] );
+
+        for( localIndex iSample = 0; iSample < nsamplesSeismoTrace; ++iSample )
+        {
+          // store strain data in the z-component of the receiver (copied to x below)
+          zCompRcv[iSample][ircv] =
+            cd * ca * xCompRcv[iSample][ircv]
+            + cd * sa * yCompRcv[iSample][ircv]
+            + sd * zCompRcv[iSample][ircv];
+        }
+      }
+    } );
+  }
+  else if( m_nsamplesSeismoTrace > 0 )
   {
     /// synchronize receivers across MPI ranks
     MpiWrapper::allReduce( xCompRcv.data(),
@@ -774,10 +814,10 @@ real64 ElasticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
     fieldsToBeSync.addFields( FieldLocation::Node, { fields::Displacementx_np1::key(), fields::Displacementy_np1::key(), fields::Displacementz_np1::key() } );
 
     CommunicationTools & syncFields = CommunicationTools::getInstance();
-    syncFields.synchronizeFields( fieldsToBeSync,
-                                  domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ),
-                                  domain.getNeighbors(),
-                                  true );
+    syncFields.synchronizeFieldsPersistent( fieldsToBeSync,
+                                            domain.getMeshBody( 0 ).getMeshLevel( m_discretizationName ),
+                                            domain.getNeighbors(),
+                                            true );
 
     // compute the seismic traces since last step.
     arrayView2d< real32 > const uXReceivers   = m_displacementXNp1AtReceivers.toView();
@@ -846,7 +886,7 @@ void ElasticWaveEquationSEM::cleanup( real64 const time_n,
     computeAllSeismoTraces( time_n, 0, uz_np1, uz_n, uZReceivers );
 
     /// Compute DAS data if requested
-    /// Pairs of receivers are assumed to be modeled ( see WaveSolverBase::initializeDAS() )
+    /// Pairs of receivers, or strain receivers, are assumed to be modeled ( see ElasticWaveEquationSEM::initializeDAS() )
     if( m_useDAS )
     {
       computeDAS( uXReceivers, uYReceivers, uZReceivers );
@@ -877,6 +917,15 @@ void ElasticWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
   }
 }
 
+void ElasticWaveEquationSEM::initializeDAS()
+{
+  /// the strain receivers are located at the center of the DAS channels
+  if( !m_useDASStrainReceivers )
+  {
+    WaveSolverBase::initializeDAS();
+  }
+}
+
 void ElasticWaveEquationSEM::initializePML()
 {
   GEOS_ERROR( getDataContext() << ": PML for the elastic wave propagator not yet implemented" );
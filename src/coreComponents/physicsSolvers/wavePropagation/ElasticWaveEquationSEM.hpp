@@ -104,7 +104,7 @@ public:
 
   /**
    * TODO: move implementation into WaveSolverBase once 'm_receiverIsLocal' is also moved
-   * @brief Compute DAS data from the appropriate three-component receiver pairs
+   * @brief Compute DAS data from the appropriate three-component receiver pairs, or from the strain receivers
    * @param xCompRcv the array holding the x-component of pairs of receivers
    * @param yCompRcv the array holding the y-component of pairs of receivers
    * @param zCompRcv the array holding the z-component of pairs of receivers
@@ -140,6 +140,8 @@ public:
     static constexpr char const * sourceForceString() { return "sourceForce"; }
     static constexpr char const * sourceMomentString() { return "sourceMoment"; }
 
+    static constexpr char const * useDASStrainReceiversString() { return "useDASStrainReceivers"; }
+
   } waveEquationViewKeys;
 
 
@@ -183,6 +185,11 @@ private:
    */
   virtual void initializePML() override;
 
+  /**
+   * @brief Initialize DAS fiber geometry. The point receivers are only duplicated when the DAS strain receivers are not used
+   */
+  virtual void initializeDAS() override;
+
   /**
    * @brief Apply Perfectly Matched Layer (PML) to the regions defined in the geometry box from the xml
    * @param time the time to apply the BC
@@ -231,6 +238,9 @@ private:
   /// Symmetric tensor describing the moment of the source
   R2SymTensor m_sourceMoment;
 
+  /// Flag to model the DAS channels with strain receivers instead of pairs of displacement receivers
+  integer m_useDASStrainReceivers;
+
 };
 
 
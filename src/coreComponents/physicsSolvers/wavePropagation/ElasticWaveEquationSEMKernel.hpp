@@ -20,6 +20,7 @@
 #define GEOS_PHYSICSSOLVERS_WAVEPROPAGATION_ELASTICWAVEEQUATIONSEMKERNEL_HPP_
 
 #include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "mesh/utilities/ElementSpatialIndex.hpp"
 #include "WaveSolverUtils.hpp"
 
 
@@ -37,7 +38,7 @@ struct PrecomputeSourceAndReceiverKernel
    * @brief Launches the precomputation of the source and receiver terms
    * @tparam EXEC_POLICY execution policy
    * @tparam FE_TYPE finite element type
-   * @param[in] size the number of cells in the subRegion
+   * @param[in] spatialIndex index of the bounding boxes of the cells in the subRegion
    * @param[in] numFacesPerElem number of face on an element
    * @param[in] nodeCoords coordinates of the nodes
    * @param[in] elemGhostRank array containing the ghost rank
@@ -48,6 +49,8 @@ struct PrecomputeSourceAndReceiverKernel
    * @param[in] faceCenter array containing the center of all faces
    * @param[in] sourceCoordinates coordinates of the source terms
    * @param[in] receiverCoordinates coordinates of the receiver terms
+   * @param[in] linearDASGeometry geometry of the DAS channels (dip, azimuth, gauge length), used for the strain receivers
+   * @param[in] useDASStrainReceivers flag indicating whether the receivers are DAS strain receivers
    * @param[in] dt time-step
    * @param[in] timeSourceFrequency Peak frequency of the source
    * @param[in] rickerOrder Order of the Ricker wavelet
@@ -58,12 +61,13 @@ struct PrecomputeSourceAndReceiverKernel
    * @param[out] sourceConstantsz constant part of the source terms in z-direction
    * @param[out] receiverIsLocal flag indicating whether the receiver is local or not
    * @param[out] receiverNodeIds indices of the nodes of the element where the receiver is located
-   * @param[out] receiverNodeConstants constant part of the receiver term
+   * @param[out] receiverNodeConstants constant part of the receiver term: the basis functions at the receiver,
+   *             or their derivatives along the fiber for the DAS strain receivers
    * @param[out] sourceValue array containing the value of the time dependent source (Ricker for e.g)
    */
   template< typename EXEC_POLICY, typename FE_TYPE >
   static void
-  launch( localIndex const size,
+  launch( ElementSpatialIndex::KernelWrapper const & spatialIndex,
           localIndex const numFacesPerElem,
           arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
           arrayView1d< integer const > const elemGhostRank,
@@ -79,6 +83,8 @@ struct PrecomputeSourceAndReceiverKernel
           arrayView2d< real64 > const sourceConstantsy,
           arrayView2d< real64 > const sourceConstantsz,
           arrayView2d< real64 const > const receiverCoordinates,
+          arrayView2d< real64 const > const linearDASGeometry,
+          integer const useDASStrainReceivers,
           arrayView1d< localIndex > const receiverIsLocal,
           arrayView2d< localIndex > const receiverNodeIds,
           arrayView2d< real64 > const receiverConstants,
@@ -90,129 +96,162 @@ struct PrecomputeSourceAndReceiverKernel
           R1Tensor const sourceForce,
           R2SymTensor const sourceMoment )
   {
+    constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
 
-    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
-    {
-
-      constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
+    // Step 1: locate the sources, and precompute the source term
 
-      real64 const center[3] = { elemCenter[k][0],
-                                 elemCenter[k][1],
-                                 elemCenter[k][2] };
-
-      // Step 1: locate the sources, and precompute the source term
+    /// loop over all the sources that haven't been found yet, visiting only the elements whose box contains them
+    forAll< EXEC_POLICY >( sourceCoordinates.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const isrc )
+    {
+      if( sourceIsAccessible[isrc] != 0 )
+      {
+        return;
+      }
+      real64 const coords[3] = { sourceCoordinates[isrc][0],
+                                 sourceCoordinates[isrc][1],
+                                 sourceCoordinates[isrc][2] };
 
-      /// loop over all the source that haven't been found yet
-      for( localIndex isrc = 0; isrc < sourceCoordinates.size( 0 ); ++isrc )
+      spatialIndex.forCandidates( coords, [&]( localIndex const k )
       {
-        if( sourceIsAccessible[isrc] == 0 )
+        real64 const center[3] = { elemCenter[k][0],
+                                   elemCenter[k][1],
+                                   elemCenter[k][2] };
+        bool const sourceFound =
+          WaveSolverUtils::locateSourceElement( numFacesPerElem,
+                                                center,
+                                                faceNormal,
+                                                faceCenter,
+                                                elemsToFaces[k],
+                                                coords );
+        if( !sourceFound )
         {
-          real64 const coords[3] = { sourceCoordinates[isrc][0],
-                                     sourceCoordinates[isrc][1],
-                                     sourceCoordinates[isrc][2] };
-
-          real64 xLocal[numNodesPerElem][3];
+          return false;
+        }
 
-          for( localIndex a=0; a< numNodesPerElem; ++a )
+        real64 xLocal[numNodesPerElem][3];
+        for( localIndex a = 0; a < numNodesPerElem; ++a )
+        {
+          for( localIndex i = 0; i < 3; ++i )
           {
-            for( localIndex i=0; i<3; ++i )
-            {
-              xLocal[a][i] = nodeCoords( elemsToNodes( k, a ), i );
-            }
+            xLocal[a][i] = nodeCoords( elemsToNodes( k, a ), i );
           }
+        }
 
+        real64 coordsOnRefElem[3]{};
+        WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
+                                                                          elemsToNodes[k],
+                                                                          nodeCoords,
+                                                                          coordsOnRefElem );
+        sourceIsAccessible[isrc] = 1;
+
+        real64 N[FE_TYPE::numNodes];
+        real64 gradN[FE_TYPE::numNodes][3];
+        FE_TYPE::calcN( coordsOnRefElem, N );
+        FE_TYPE::calcGradN( coordsOnRefElem, xLocal, gradN );
+        R2SymTensor moment = sourceMoment;
+        for( localIndex q = 0; q < numNodesPerElem; ++q )
+        {
+          real64 inc[3] = { 0, 0, 0 };
+          sourceNodeIds[isrc][q] = elemsToNodes[k][q];
+          inc[0] += sourceForce[0] * N[q];
+          inc[1] += sourceForce[1] * N[q];
+          inc[2] += sourceForce[2] * N[q];
+
+          LvArray::tensorOps::Ri_add_symAijBj< 3 >( inc, moment.data, gradN[q] );
+          sourceConstantsx[isrc][q] += inc[0];
+          sourceConstantsy[isrc][q] += inc[1];
+          sourceConstantsz[isrc][q] += inc[2];
+        }
 
-          bool const sourceFound =
-            WaveSolverUtils::locateSourceElement( numFacesPerElem,
-                                                  center,
-                                                  faceNormal,
-                                                  faceCenter,
-                                                  elemsToFaces[k],
-                                                  coords );
-
-          if( sourceFound )
-          {
-            real64 coordsOnRefElem[3]{};
-
+        for( localIndex cycle = 0; cycle < sourceValue.size( 0 ); ++cycle )
+        {
+          sourceValue[cycle][isrc] = WaveSolverUtils::evaluateRicker( cycle * dt, timeSourceFrequency, timeSourceDelay, rickerOrder );
+        }
+        return true;
+      } );
+    } );
 
-            WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
-                                                                              elemsToNodes[k],
-                                                                              nodeCoords,
-                                                                              coordsOnRefElem );
-            sourceIsAccessible[isrc] = 1;
+    // Step 2: locate the receivers, and precompute the receiver term
 
-            real64 N[FE_TYPE::numNodes];
-            real64 gradN[FE_TYPE::numNodes][3];
-            FE_TYPE::calcN( coordsOnRefElem, N );
-            FE_TYPE::calcGradN( coordsOnRefElem, xLocal, gradN );
-            R2SymTensor moment = sourceMoment;
-            for( localIndex q=0; q< numNodesPerElem; ++q )
-            {
-              real64 inc[3] = { 0, 0, 0 };
-              sourceNodeIds[isrc][q] = elemsToNodes[k][q];
-              inc[0] += sourceForce[0] * N[q];
-              inc[1] += sourceForce[1] * N[q];
-              inc[2] += sourceForce[2] * N[q];
-
-              LvArray::tensorOps::Ri_add_symAijBj< 3 >( inc, moment.data, gradN[q] );
-              sourceConstantsx[isrc][q] += inc[0];
-              sourceConstantsy[isrc][q] += inc[1];
-              sourceConstantsz[isrc][q] += inc[2];
-            }
-
-            for( localIndex cycle = 0; cycle < sourceValue.size( 0 ); ++cycle )
-            {
-              sourceValue[cycle][isrc] = WaveSolverUtils::evaluateRicker( cycle * dt, timeSourceFrequency, timeSourceDelay, rickerOrder );
-            }
+    /// loop over all the receivers that haven't been found yet, visiting only the elements whose box contains them
+    forAll< EXEC_POLICY >( receiverCoordinates.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ircv )
+    {
+      if( receiverIsLocal[ircv] != 0 )
+      {
+        return;
+      }
+      real64 const coords[3] = { receiverCoordinates[ircv][0],
+                                 receiverCoordinates[ircv][1],
+                                 receiverCoordinates[ircv][2] };
 
-          }
+      spatialIndex.forCandidates( coords, [&]( localIndex const k )
+      {
+        real64 const center[3] = { elemCenter[k][0],
+                                   elemCenter[k][1],
+                                   elemCenter[k][2] };
+        bool const receiverFound =
+          WaveSolverUtils::locateSourceElement( numFacesPerElem,
+                                                center,
+                                                faceNormal,
+                                                faceCenter,
+                                                elemsToFaces[k],
+                                                coords );
+        if( !receiverFound || elemGhostRank[k] >= 0 )
+        {
+          return false;
         }
-      } // end loop over all sources
 
+        real64 coordsOnRefElem[3]{};
+        WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
+                                                                          elemsToNodes[k],
+                                                                          nodeCoords,
+                                                                          coordsOnRefElem );
 
-      // Step 2: locate the receivers, and precompute the receiver term
+        receiverIsLocal[ircv] = 1;
 
-      /// loop over all the receivers that haven't been found yet
-      for( localIndex ircv = 0; ircv < receiverCoordinates.size( 0 ); ++ircv )
-      {
-        if( receiverIsLocal[ircv] == 0 )
+        if( useDASStrainReceivers )
         {
-          real64 const coords[3] = { receiverCoordinates[ircv][0],
-                                     receiverCoordinates[ircv][1],
-                                     receiverCoordinates[ircv][2] };
-
-          real64 coordsOnRefElem[3]{};
-          bool const receiverFound =
-            WaveSolverUtils::locateSourceElement( numFacesPerElem,
-                                                  center,
-                                                  faceNormal,
-                                                  faceCenter,
-                                                  elemsToFaces[k],
-                                                  coords );
-
-          if( receiverFound && elemGhostRank[k] < 0 )
+          /// the axial strain along the fiber direction d is d_i ( \sum_a dN_a/dx_j u_a,i ) d_j,
+          /// so the receiver constants are the derivatives of the basis functions along d,
+          /// and the three components are combined with d once the traces are recorded
+          real64 xLocal[numNodesPerElem][3];
+          for( localIndex a = 0; a < numNodesPerElem; ++a )
           {
-            WaveSolverUtils::computeCoordinatesOnReferenceElement< FE_TYPE >( coords,
-                                                                              elemsToNodes[k],
-                                                                              nodeCoords,
-                                                                              coordsOnRefElem );
+            for( localIndex i = 0; i < 3; ++i )
+            {
+              xLocal[a][i] = nodeCoords( elemsToNodes( k, a ), i );
+            }
+          }
 
-            receiverIsLocal[ircv] = 1;
+          real64 const dip = linearDASGeometry[ircv][0];
+          real64 const azimuth = linearDASGeometry[ircv][1];
+          real64 const direction[3] = { cos( dip ) * cos( azimuth ),
+                                        cos( dip ) * sin( azimuth ),
+                                        sin( dip ) };
 
-            real64 Ntest[numNodesPerElem];
+          real64 gradN[FE_TYPE::numNodes][3];
+          FE_TYPE::calcGradN( coordsOnRefElem, xLocal, gradN );
 
-            FE_TYPE::calcN( coordsOnRefElem, Ntest );
+          for( localIndex a = 0; a < numNodesPerElem; ++a )
+          {
+            receiverNodeIds[ircv][a] = elemsToNodes[k][a];
+            receiverConstants[ircv][a] = LvArray::tensorOps::AiBi< 3 >( gradN[a], direction );
+          }
+        }
+        else
+        {
+          real64 Ntest[numNodesPerElem];
+          FE_TYPE::calcN( coordsOnRefElem, Ntest );
 
-            for( localIndex a = 0; a < numNodesPerElem; ++a )
-            {
-              receiverNodeIds[ircv][a] = elemsToNodes[k][a];
-              receiverConstants[ircv][a] = Ntest[a];
-            }
+          for( localIndex a = 0; a < numNodesPerElem; ++a )
+          {
+            receiverNodeIds[ircv][a] = elemsToNodes[k][a];
+            receiverConstants[ircv][a] = Ntest[a];
           }
         }
-      } // end loop over receivers
+        return true;
+      } );
     } );
-
   }
 };
 
@@ -453,6 +492,10 @@ public:
     {}
     /// C-array stack storage for element local the nodal positions.
     real64 xLocal[ numNodesPerElem ][ 3 ]{};
+    /// C-array stack storage for element local the nodal displacement.
+    real64 uLocal[ numNodesPerElem ][ 3 ]{};
+    /// C-array stack storage for element local the product of the stiffness matrix and the nodal displacement.
+    real64 stiffnessVectorLocal[ numNodesPerElem ][ 3 ]{};
     real32 mu=0;
     real32 lambda=0;
   };
@@ -477,6 +520,9 @@ public:
       {
         stack.xLocal[ a ][ i ] = m_nodeCoords[ nodeIndex ][ i ];
       }
+      stack.uLocal[ a ][ 0 ] = m_ux_n[ nodeIndex ];
+      stack.uLocal[ a ][ 1 ] = m_uy_n[ nodeIndex ];
+      stack.uLocal[ a ][ 2 ] = m_uz_n[ nodeIndex ];
     }
     stack.mu = m_density[k] * m_velocityVs[k] * m_velocityVs[k];
     stack.lambda = m_density[k] *m_velocityVp[k] * m_velocityVp[k] - 2.0*stack.mu;
@@ -495,29 +541,44 @@ public:
                               localIndex const q,
                               StackVariables & stack ) const
   {
-
-    m_finiteElementSpace.template computeFirstOrderStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, real64 val, real64 J[3][3], int p, int r )
+    GEOS_UNUSED_VAR( k );
+    real64 const lambda = stack.lambda;
+    real64 const mu = stack.mu;
+    m_finiteElementSpace.template applyFirstOrderStiffnessTerm( q, stack.xLocal, stack.uLocal, stack.stiffnessVectorLocal,
+                                                                [&] ( real64 const (&grad)[3][3], real64 (& sigma)[3][3] )
     {
-      real32 const Rxx_ij = val*((stack.lambda+2.0*stack.mu)*J[p][0]*J[r][0]+stack.mu*(J[p][1]*J[r][1]+J[p][2]*J[r][2]));
-      real32 const Ryy_ij = val*((stack.lambda+2.0*stack.mu)*J[p][1]*J[r][1]+stack.mu*(J[p][0]*J[r][0]+J[p][2]*J[r][2]));
-      real32 const Rzz_ij = val*((stack.lambda+2.0*stack.mu)*J[p][2]*J[r][2]+stack.mu*(J[p][0]*J[r][0]+J[p][1]*J[r][1]));
-      real32 const Rxy_ij = val*(stack.lambda*J[p][0]*J[r][1]+stack.mu*J[p][1]*J[r][0]);
-      real32 const Ryx_ij = val*(stack.mu*J[p][0]*J[r][1]+stack.lambda*J[p][1]*J[r][0]);
-      real32 const Rxz_ij = val*(stack.lambda*J[p][0]*J[r][2]+stack.mu*J[p][2]*J[r][0]);
-      real32 const Rzx_ij = val*(stack.mu*J[p][0]*J[r][2]+stack.lambda*J[p][2]*J[r][0]);
-      real32 const Ryz_ij = val*(stack.lambda*J[p][1]*J[r][2]+stack.mu*J[p][2]*J[r][1]);
-      real32 const Rzy_ij = val*(stack.mu*J[p][1]*J[r][2]+stack.lambda*J[p][2]*J[r][1]);
-
-      real32 const localIncrementx = (Rxx_ij * m_ux_n[m_elemsToNodes[k][j]] + Rxy_ij*m_uy_n[m_elemsToNodes[k][j]] + Rxz_ij*m_uz_n[m_elemsToNodes[k][j]]);
-      real32 const localIncrementy = (Ryx_ij * m_ux_n[m_elemsToNodes[k][j]] + Ryy_ij*m_uy_n[m_elemsToNodes[k][j]] + Ryz_ij*m_uz_n[m_elemsToNodes[k][j]]);
-      real32 const localIncrementz = (Rzx_ij * m_ux_n[m_elemsToNodes[k][j]] + Rzy_ij*m_uy_n[m_elemsToNodes[k][j]] + Rzz_ij*m_uz_n[m_elemsToNodes[k][j]]);
-
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectorx[m_elemsToNodes[k][i]], localIncrementx );
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectory[m_elemsToNodes[k][i]], localIncrementy );
-      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectorz[m_elemsToNodes[k][i]], localIncrementz );
+      real64 const lambdaDiv = lambda*( grad[0][0] + grad[1][1] + grad[2][2] );
+      for( int i = 0; i < 3; ++i )
+      {
+        for( int j = 0; j < 3; ++j )
+        {
+          sigma[i][j] = mu*( grad[i][j] + grad[j][i] );
+        }
+        sigma[i][i] += lambdaDiv;
+      }
     } );
   }
 
+  /**
+   * @copydoc geos::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitElasticSEM Description
+   * Adds the element stiffness vector to the nodal stiffness vectors.
+   */
+  GEOS_HOST_DEVICE
+  inline
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a< numNodesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, a );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectorx[nodeIndex], real32( stack.stiffnessVectorLocal[ a ][ 0 ] ) );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectory[nodeIndex], real32( stack.stiffnessVectorLocal[ a ][ 1 ] ) );
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVectorz[nodeIndex], real32( stack.stiffnessVectorLocal[ a ][ 2 ] ) );
+    }
+    return 0;
+  }
 
 protected:
   /// The array containing the nodal position array.
@@ -37,7 +37,10 @@ using namespace dataRepository;
 WaveSolverBase::WaveSolverBase( const std::string & name,
                                 Group * const parent ):
   SolverBase( name,
-              parent )
+              parent ),
+  m_numCheckpointedSteps( 0 ),
+  m_checkpointStartTime( 0.0 ),
+  m_checkpointStartCycle( 0 )
 {
 
   registerWrapper( viewKeyStruct::sourceCoordinatesString(), &m_sourceCoordinates ).
@@ -120,6 +123,33 @@ WaveSolverBase::WaveSolverBase( const std::string & name,
     setApplyDefaultValue( -80 ).
     setDescription( "Set the capacity of the lifo host storage (if negative, opposite of percentage of remaining memory)" );
 
+  registerWrapper( viewKeyStruct::lifoCompressionToleranceString(), &m_lifoCompressionTolerance ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( -1.0 ).
+    setDescription( "Set the compression of the lifo buffers stored on disk (if negative, no compression; if zero, lossless compression; "
+                    "if positive, lossy compression with this absolute error bound)" );
+
+  registerWrapper( viewKeyStruct::maxCheckpointsString(), &m_maxCheckpoints ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Set the maximum number of forward states stored to compute the gradient with binomial checkpointing "
+                    "(if zero, all the forward snapshots are stored with the lifo or on disk; if positive, the snapshots are "
+                    "recomputed from the checkpoints during the backward propagation)" );
+
+  registerWrapper( viewKeyStruct::gradientFrequenciesString(), &m_gradientFrequencies ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Frequencies (in Hz) of the discrete Fourier transforms of the forward wavefield accumulated during the forward "
+                    "propagation to compute the gradient (if empty, the forward snapshots are stored; if not empty, no snapshot is "
+                    "stored and the gradient is computed from the forward wavefield restricted to these frequencies)" );
+
+
+  registerWrapper( viewKeyStruct::reuseMediumOnReinitString(), &m_reuseMediumOnReinit ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Set to 1 to keep the mass and damping matrices, the PML and the free-surface setup computed for the current medium "
+                    "when the solver is re-initialized, so that only the source and receiver terms are recomputed for a new shot. "
+                    "The partial gradient is not reset either, so that it accumulates over the shots. "
+                    "Must be set to 0 before re-initializing after a modification of the medium properties" );
 
   registerWrapper( viewKeyStruct::usePMLString(), &m_usePML ).
     setInputFlag( InputFlags::FALSE ).
@@ -178,7 +208,22 @@ void WaveSolverBase::reinit()
 {
   initializePreSubGroups();
   postProcessInput();
-  initializePostInitialConditionsPreSubGroups();
+
+  if( m_reuseMediumOnReinit )
+  {
+    // same medium, new shot: only the source and receiver terms have to be recomputed
+    DomainPartition & domain = getGroupByPath< DomainPartition >( "/Problem/domain" );
+    forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
+                                                                  MeshLevel & mesh,
+                                                                  arrayView1d< string const > const & regionNames )
+    {
+      precomputeSourceAndReceiverTerm( mesh, regionNames );
+    } );
+  }
+  else
+  {
+    initializePostInitialConditionsPreSubGroups();
+  }
 }
 
 void WaveSolverBase::registerDataOnMesh( Group & meshBodies )
@@ -267,6 +312,25 @@ void WaveSolverBase::postProcessInput()
                  ": Invalid number of physical coordinates for the sources",
                  InputError );
 
+  GEOS_THROW_IF( m_maxCheckpoints < 0,
+                 getWrapperDataContext( viewKeyStruct::maxCheckpointsString() ) <<
+                 ": The maximum number of checkpoints must be nonnegative",
+                 InputError );
+
+  for( localIndex i = 0; i < m_gradientFrequencies.size(); ++i )
+  {
+    GEOS_THROW_IF( m_gradientFrequencies[i] < 0,
+                   getWrapperDataContext( viewKeyStruct::gradientFrequenciesString() ) <<
+                   ": The gradient frequencies must be nonnegative",
+                   InputError );
+  }
+
+  GEOS_THROW_IF( !m_gradientFrequencies.empty() && m_maxCheckpoints > 0,
+                 getWrapperDataContext( viewKeyStruct::gradientFrequenciesString() ) <<
+                 ": The frequency-domain gradient cannot be combined with the checkpointing (" <<
+                 viewKeyStruct::maxCheckpointsString() << " must be zero)",
+                 InputError );
+
   GEOS_THROW_IF( m_receiverCoordinates.size( 1 ) != 3,
                  getWrapperDataContext( viewKeyStruct::receiverCoordinatesString() ) <<
                  ": Invalid number of physical coordinates for the receivers",
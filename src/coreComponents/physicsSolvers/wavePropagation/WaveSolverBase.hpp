@@ -24,6 +24,7 @@
 #include "mesh/MeshFields.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 #include "common/LifoStorage.hpp"
+#include "BinomialCheckpointSchedule.hpp"
 #if !defined( GEOS_USE_HIP )
 #include "finiteElement/elementFormulations/Qk_Hexahedron_Lagrange_GaussLobatto.hpp"
 #endif
@@ -106,6 +107,10 @@ public:
     static constexpr char const * lifoSizeString() { return "lifoSize"; }
     static constexpr char const * lifoOnDeviceString() { return "lifoOnDevice"; }
     static constexpr char const * lifoOnHostString() { return "lifoOnHost"; }
+    static constexpr char const * lifoCompressionToleranceString() { return "lifoCompressionTolerance"; }
+    static constexpr char const * maxCheckpointsString() { return "maxCheckpoints"; }
+    static constexpr char const * gradientFrequenciesString() { return "gradientFrequencies"; }
+    static constexpr char const * reuseMediumOnReinitString() { return "reuseMediumOnReinit"; }
 
     static constexpr char const * useDASString() { return "useDAS"; }
     static constexpr char const * linearDASGeometryString() { return "linearDASGeometry"; }
@@ -123,6 +128,7 @@ public:
 
   /**
    * @brief Re-initialize source and receivers positions in the mesh, and resize the pressureNp1_at_receivers array
+   * @note If reuseMediumOnReinit is set, the precomputations that only depend on the medium are kept
    */
   void reinit() override final;
 
@@ -250,6 +256,9 @@ protected:
   // Indicate the current shot computed for naming saved temporary data
   integer m_shotIndex;
 
+  /// Flag to keep the medium precomputations (mass, damping, PML) when the solver is re-initialized for a new shot
+  integer m_reuseMediumOnReinit;
+
   /// Flag to apply PML
   integer m_usePML;
 
@@ -283,9 +292,30 @@ protected:
   /// Number of buffers to store on host by LIFO  (if negative, opposite of percentage of remaining memory)
   localIndex m_lifoOnHost;
 
+  /// Compression of the LIFO buffers stored on disk (negative: none, 0: lossless, positive: lossy absolute error bound)
+  real64 m_lifoCompressionTolerance;
+
   /// LIFO to store p_dt2
   std::unique_ptr< LifoStorage< real32, localIndex > > m_lifo;
 
+  /// Maximum number of forward states stored by the binomial checkpointing (if zero, all the snapshots are stored)
+  integer m_maxCheckpoints;
+
+  /// Frequencies at which the forward wavefield is accumulated to compute the gradient (if empty, the snapshots are stored)
+  array1d< real64 > m_gradientFrequencies;
+
+  /// Binomial checkpointing schedule of the current shot
+  std::unique_ptr< BinomialCheckpointSchedule > m_checkpointSchedule;
+
+  /// Number of forward steps recorded by the checkpointing and not yet reversed
+  integer m_numCheckpointedSteps;
+
+  /// Time at the beginning of the first forward step recorded by the checkpointing
+  real64 m_checkpointStartTime;
+
+  /// Cycle number of the first forward step recorded by the checkpointing
+  integer m_checkpointStartCycle;
+
   struct parametersPML
   {
     /// Mininum (x,y,z) coordinates of inner PML boundaries
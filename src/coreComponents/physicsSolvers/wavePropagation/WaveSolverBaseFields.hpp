@@ -56,6 +56,30 @@ DECLARE_FIELD( F,
                WRITE_AND_READ,
                "f quantity in VTI/TTI Fletcher's equations" );
 
+DECLARE_FIELD( Theta,
+               "theta",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "Tilt angle (in radians) of the symmetry axis from the vertical direction in TTI media" );
+
+DECLARE_FIELD( Phi,
+               "phi",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "Azimuth angle (in radians) of the symmetry axis in TTI media" );
+
+DECLARE_FIELD( AnisotropyCoefficients,
+               "anisotropyCoefficients",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Packed coefficients of the VTI/TTI stiffness operators and symmetry axis, precomputed for each element" );
+
 DECLARE_FIELD( StiffnessVector_p,
                "stiffnessVector_p",
                array1d< real32 >,
@@ -296,6 +320,30 @@ DECLARE_FIELD( Displacementz_np1,
                WRITE_AND_READ,
                "z-component of displacement at time n+1." );
 
+DECLARE_FIELD( Displacementx_n,
+               "displacementx_n",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "x-component of displacement at time n." );
+
+DECLARE_FIELD( Displacementy_n,
+               "displacementy_n",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "y-component of displacement at time n." );
+
+DECLARE_FIELD( Displacementz_n,
+               "displacementz_n",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "z-component of displacement at time n." );
+
 DECLARE_FIELD( Stresstensorxx,
                "stresstensorxx",
                array2d< real32 >,
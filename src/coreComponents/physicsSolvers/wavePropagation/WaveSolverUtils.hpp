@@ -120,9 +120,11 @@ struct WaveSolverUtils
     real32 const a1 = (LvArray::math::abs( dt ) < WaveSolverBase::epsilonLoc ) ? 1.0 : (time_np1 - timeSeismo)/dt;
     real32 const a2 = 1.0 - a1;
 
+    // the samples stay on device until the traces are written out (which moves varAtReceivers to the host),
+    // so the interpolation kernel is launched asynchronously to avoid a device synchronization per sample
     if( nsamplesSeismoTrace > 0 )
     {
-      forAll< WaveSolverBase::EXEC_POLICY >( receiverConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ircv )
+      forAll< parallelDeviceAsyncPolicy<> >( receiverConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ircv )
       {
         if( receiverIsLocal[ircv] == 1 )
         {
@@ -162,9 +164,10 @@ struct WaveSolverUtils
     real32 const a1 = (dt < WaveSolverBase::epsilonLoc) ? 1.0 : (time_np1 - timeSeismo)/dt;
     real32 const a2 = 1.0 - a1;
 
+    // asynchronous launch, see computeSeismoTrace
     if( nsamplesSeismoTrace > 0 )
     {
-      forAll< WaveSolverBase::EXEC_POLICY >( receiverConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ircv )
+      forAll< parallelDeviceAsyncPolicy<> >( receiverConstants.size( 0 ), [=] GEOS_HOST_DEVICE ( localIndex const ircv )
       {
         if( receiverIsLocal[ircv] == 1 )
         {
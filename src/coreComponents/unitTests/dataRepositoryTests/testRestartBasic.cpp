@@ -23,6 +23,7 @@
 #include "utils.hpp"
 
 // TPL includes
+#include <conduit_relay.hpp>
 #include <gtest/gtest.h>
 
 // System includes
@@ -76,6 +77,7 @@ public:
     m_group = std::make_unique< Group >( m_groupName, *m_node );
     m_wrapper = &m_group->registerWrapper< T >( m_wrapperName );
     m_group->loadFromConduit();
+    finishLoadingTree();
 
     // Compare metadata
     EXPECT_EQ( m_group->size(), m_groupSize );
@@ -132,6 +134,61 @@ TYPED_TEST( SingleWrapperTest, WriteAndRead )
   this->test();
 }
 
+TEST( IncrementalRestartTest, unchangedDataIsReferenced )
+{
+  localIndex const size = 1000;
+  std::unique_ptr< conduit::Node > node = std::make_unique< conduit::Node >();
+  std::unique_ptr< Group > group = std::make_unique< Group >( "root", *node );
+  array1d< real64 > & unchanged = group->registerWrapper< array1d< real64 > >( "unchanged" ).reference();
+  array1d< real64 > & changed = group->registerWrapper< array1d< real64 > >( "changed" ).reference();
+  unchanged.resize( size );
+  changed.resize( size );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    unchanged[i] = i;
+    changed[i] = -i;
+  }
+
+  RestartDataIndex writtenData;
+  auto const writeIncrementally = [&]( string const & fileName, conduit::Node & output )
+  {
+    group->prepareToWrite();
+    string const filePath = gatherTree( fileName, *node, 0, false, output );
+    referenceUnchangedData( output, filePath, writtenData );
+    conduit::relay::io::save( output, filePath, "hdf5" );
+    group->finishWriting();
+  };
+
+  conduit::Node baseOutput;
+  writeIncrementally( "testRestartBasic_IncrementalRestartTest_0", baseOutput );
+  EXPECT_TRUE( baseOutput[ "root/unchanged/__values__" ].dtype().is_number() );
+
+  changed[0] = 1.0;
+  conduit::Node nextOutput;
+  writeIncrementally( "testRestartBasic_IncrementalRestartTest_1", nextOutput );
+  EXPECT_EQ( nextOutput[ "root/unchanged/__values__" ].number_of_children(), 1 );
+  EXPECT_TRUE( nextOutput[ "root/changed/__values__" ].dtype().is_number() );
+
+  // Load the second restart, the unchanged data being read from the first one
+  group = nullptr;
+  node = std::make_unique< conduit::Node >();
+  loadTree( "testRestartBasic_IncrementalRestartTest_1", *node );
+  group = std::make_unique< Group >( "root", *node );
+  array1d< real64 > const & unchangedLoaded = group->registerWrapper< array1d< real64 > >( "unchanged" ).reference();
+  array1d< real64 > const & changedLoaded = group->registerWrapper< array1d< real64 > >( "changed" ).reference();
+  group->loadFromConduit();
+  finishLoadingTree();
+
+  ASSERT_EQ( unchangedLoaded.size(), size );
+  ASSERT_EQ( changedLoaded.size(), size );
+  EXPECT_EQ( changedLoaded[0], 1.0 );
+  for( localIndex i = 1; i < size; ++i )
+  {
+    EXPECT_EQ( unchangedLoaded[i], i );
+    EXPECT_EQ( changedLoaded[i], -i );
+  }
+}
+
 } // namespace testing
 } // namespace dataRepository
 } // namespace geos
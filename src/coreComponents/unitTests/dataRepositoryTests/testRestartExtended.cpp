@@ -445,6 +445,7 @@ TEST( testRestartExtended, testRestartExtended )
 
   /* Load the data */
   root->loadFromConduit();
+  finishLoadingTree();
 
   /* Group sizes should have carried over. */
   EXPECT_EQ( root->size(), group_size );
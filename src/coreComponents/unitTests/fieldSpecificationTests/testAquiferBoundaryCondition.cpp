@@ -70,19 +70,18 @@ TEST( FieldSpecification, Aquifer )
 
   aquiferBC.postProcessInputRecursive();
 
-  AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = aquiferBC.createKernelWrapper();
-
   real64 const timeAtBeginningOfStep = 0.0;
   real64 const dt = 8640.0;
+
+  AquiferBoundaryCondition::KernelWrapper aquiferBCWrapper = aquiferBC.createKernelWrapper( timeAtBeginningOfStep, dt );
+
   real64 const pres = 2.7212e+07;
   real64 const dPres = 0.0;
   real64 const gravCoef = -49.05;
   real64 const areaFraction = 1.0;
   real64 dAquiferVolFlux_dPres = 0.0;
 
-  real64 const aquiferVolFlux = aquiferBCWrapper.compute( timeAtBeginningOfStep,
-                                                          dt,
-                                                          pres,
+  real64 const aquiferVolFlux = aquiferBCWrapper.compute( pres,
                                                           dPres,
                                                           gravCoef,
                                                           areaFraction,
@@ -114,6 +114,44 @@ TEST( testHDFIO, IdxArrayHistory )
   }
 }
 
+TEST( testHDFIO, WriteDataset )
+{
+  Array< real64, 3 > arr( 3, 5, 2 );
+  real64 count = 0.0;
+  forValuesInSlice( arr.toSlice(), [&count]( real64 & value )
+  {
+    value = count++;
+  } );
+
+  {
+    HDFFile file( "dataset", true, true, MPI_COMM_SELF );
+    file.writeDataset( "values", arr.data(), { arr.size( 0 ), arr.size( 1 ), arr.size( 2 ) } );
+    ASSERT_TRUE( file.hasDataset( "values" ) );
+  }
+
+  // read the data back using hdf api
+  hid_t const fileId = H5Fopen( "dataset.hdf5", H5F_ACC_RDONLY, H5P_DEFAULT );
+  hid_t const dataset = H5Dopen( fileId, "values", H5P_DEFAULT );
+  hid_t const space = H5Dget_space( dataset );
+  ASSERT_EQ( H5Sget_simple_extent_ndims( space ), 3 );
+  hsize_t dims[3];
+  H5Sget_simple_extent_dims( space, dims, nullptr );
+  EXPECT_EQ( dims[0], 3 );
+  EXPECT_EQ( dims[1], 5 );
+  EXPECT_EQ( dims[2], 2 );
+
+  Array< real64, 3 > values( 3, 5, 2 );
+  H5Dread( dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data() );
+  for( localIndex i = 0; i < arr.size(); ++i )
+  {
+    EXPECT_EQ( values.data()[i], arr.data()[i] );
+  }
+
+  H5Sclose( space );
+  H5Dclose( dataset );
+  H5Fclose( fileId );
+}
+
 int main( int ac, char * av[] )
 {
   ::testing::InitGoogleTest( &ac, av );
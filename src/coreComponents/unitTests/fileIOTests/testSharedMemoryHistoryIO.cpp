@@ -0,0 +1,143 @@
+#include "fileIO/timeHistory/SharedMemoryHistoryIO.hpp"
+#include "mainInterface/initialization.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace geos;
+
+namespace
+{
+
+/// Map a time history segment read-only, as a consumer process would
+SharedMemoryHistoryHeader const * mapSegment( string const & name, size_t & size )
+{
+  int const fd = shm_open( name.c_str(), O_RDONLY, 0 );
+  EXPECT_GE( fd, 0 );
+  struct stat status;
+  fstat( fd, &status );
+  size = static_cast< size_t >( status.st_size );
+  void * const data = mmap( nullptr, size, PROT_READ, MAP_SHARED, fd, 0 );
+  close( fd );
+  EXPECT_NE( data, MAP_FAILED );
+  return static_cast< SharedMemoryHistoryHeader const * >( data );
+}
+
+SharedMemoryHistorySlot const * getSlot( SharedMemoryHistoryHeader const * header, std::uint64_t record )
+{
+  buffer_unit_type const * const base = reinterpret_cast< buffer_unit_type const * >( header );
+  return reinterpret_cast< SharedMemoryHistorySlot const * >( base + header->headerBytes + ( record % header->slotCount ) * header->slotStride );
+}
+
+}
+
+TEST( testSharedMemoryHistoryIO, SingleValueHistory )
+{
+  string const segmentName( "/testSharedMemoryHistoryIO_single" );
+  HistoryMetadata spec( "Time History", 1, std::type_index( typeid(real64)));
+
+  SharedMemoryHistoryIO io( segmentName, spec, 0, 4 );
+  io.init( false );
+
+  size_t size = 0;
+  SharedMemoryHistoryHeader const * header = mapSegment( segmentName, size );
+  EXPECT_EQ( std::memcmp( header->magic, "GEOSTHSM", 8 ), 0 );
+  EXPECT_EQ( header->state.load(), 1u );
+  EXPECT_EQ( header->slotCount, 4u );
+  EXPECT_EQ( header->typeKind, 'f' );
+  EXPECT_EQ( header->typeSize, sizeof( real64 ) );
+  EXPECT_STREQ( header->name, "Time History" );
+
+  real64 time = 0.0;
+  for( localIndex tidx = 0; tidx < 10; ++tidx )
+  {
+    time += 0.5;
+    buffer_unit_type * buffer = io.getBufferHead( );
+    memcpy( buffer, &time, sizeof(real64));
+    EXPECT_EQ( io.getBufferedCount(), 1 );
+    io.write( );
+
+    // the record is published, and the oldest ones are overwritten when the ring wraps around
+    EXPECT_EQ( header->publishedCount.load(), std::uint64_t( tidx + 1 ) );
+    SharedMemoryHistorySlot const * slot = getSlot( header, tidx );
+    EXPECT_EQ( slot->sequence.load(), std::uint64_t( 2 * tidx + 2 ) );
+    EXPECT_EQ( slot->record, std::uint64_t( tidx ) );
+    real64 value;
+    memcpy( &value, slot + 1, sizeof(real64));
+    EXPECT_EQ( value, time );
+  }
+
+  io.compressInFile( );
+  EXPECT_EQ( header->state.load(), 3u );
+
+  munmap( const_cast< SharedMemoryHistoryHeader * >( header ), size );
+  shm_unlink( segmentName.c_str() );
+}
+
+TEST( testSharedMemoryHistoryIO, GrowingRecords )
+{
+  string const segmentName( "/testSharedMemoryHistoryIO_growing" );
+  HistoryMetadata spec( "Growing History", 2, std::type_index( typeid(localIndex)));
+
+  SharedMemoryHistoryIO io( segmentName, spec, 5, 8 );
+  io.init( false );
+
+  size_t size = 0;
+  SharedMemoryHistoryHeader const * header = mapSegment( segmentName, size );
+  EXPECT_EQ( header->publishedCount.load(), 5u );
+
+  // records collected between two writes are only published by the write
+  for( localIndex count = 1; count <= 2; ++count )
+  {
+    io.updateCollectingCount( count );
+    buffer_unit_type * buffer = io.getBufferHead( );
+    for( localIndex i = 0; i < count; ++i )
+    {
+      memcpy( buffer + i * sizeof(localIndex), &i, sizeof(localIndex));
+    }
+  }
+  EXPECT_EQ( io.getBufferedCount(), 2 );
+  EXPECT_EQ( header->publishedCount.load(), 5u );
+  EXPECT_EQ( getSlot( header, 6 )->sequence.load() % 2, 1u );
+  io.write( );
+  EXPECT_EQ( header->publishedCount.load(), 7u );
+  EXPECT_EQ( getSlot( header, 6 )->sequence.load(), 14u );
+  EXPECT_EQ( getSlot( header, 6 )->count, 2u );
+
+  // a larger record replaces the segment by one with larger slots
+  io.updateCollectingCount( 100 );
+  buffer_unit_type * buffer = io.getBufferHead( );
+  localIndex const last = 99;
+  memcpy( buffer + last * sizeof(localIndex), &last, sizeof(localIndex));
+  io.write( );
+  EXPECT_EQ( header->state.load(), 2u );
+  munmap( const_cast< SharedMemoryHistoryHeader * >( header ), size );
+
+  header = mapSegment( segmentName, size );
+  EXPECT_EQ( header->state.load(), 1u );
+  EXPECT_GE( header->slotBytes, 100 * sizeof(localIndex) );
+  EXPECT_EQ( header->publishedCount.load(), 8u );
+  SharedMemoryHistorySlot const * slot = getSlot( header, 7 );
+  EXPECT_EQ( slot->count, 100u );
+  localIndex value;
+  memcpy( &value, reinterpret_cast< buffer_unit_type const * >( slot + 1 ) + last * sizeof(localIndex), sizeof(localIndex));
+  EXPECT_EQ( value, last );
+
+  munmap( const_cast< SharedMemoryHistoryHeader * >( header ), size );
+  shm_unlink( segmentName.c_str() );
+}
+
+int main( int ac, char * av[] )
+{
+  ::testing::InitGoogleTest( &ac, av );
+  geos::basicSetup( ac, av );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -46,7 +46,7 @@ using namespace geos::dataRepository;
 
 
 template< class V >
-void TestMeshImport( string const & meshFilePath, V const & validate, string const fractureName="" )
+void TestMeshImport( string const & meshFilePath, V const & validate, string const fractureName="", string const & extraAttributes="" )
 {
   string const pattern = R"xml(
     <Mesh>
@@ -55,10 +55,11 @@ void TestMeshImport( string const & meshFilePath, V const & validate, string con
         file="{}"
         partitionRefinement="0"
         useGlobalIds="0"
+        {}
         {} />
     </Mesh>
   )xml";
-  string const meshNode = GEOS_FMT( pattern, meshFilePath, fractureName.empty() ? "" : "faceBlocks=\"{" + fractureName + "}\"" );
+  string const meshNode = GEOS_FMT( pattern, meshFilePath, fractureName.empty() ? "" : "faceBlocks=\"{" + fractureName + "}\"", extraAttributes );
   xmlWrapper::xmlDocument xmlDocument;
   xmlDocument.loadString( meshNode );
   xmlWrapper::xmlNode xmlMeshNode = xmlDocument.getChild( "Mesh" );
@@ -422,6 +423,39 @@ TEST( VTKImport, cube )
 
 }
 
+TEST( VTKImport, renumberNodes )
+{
+  SKIP_TEST_IN_PARALLEL( "Not relevant in parallel" );
+
+  auto validate = []( CellBlockManagerABC const & cellBlockManager ) -> void
+  {
+    // The renumbering only permutes the nodes, the sizes of the mesh objects and node sets are unchanged.
+    ASSERT_EQ( cellBlockManager.numNodes(), 64 );
+    ASSERT_EQ( cellBlockManager.numEdges(), 144 );
+    ASSERT_EQ( cellBlockManager.numFaces(), 108 );
+    ASSERT_EQ( cellBlockManager.getNodeSets().at( "all" ).size(), 64 );
+
+    // The nodes are numbered in the order in which the cells visit them:
+    // each cell only introduces nodes numbered right after the largest node index of the previous cells.
+    localIndex numVisitedNodes = 0;
+    cellBlockManager.getCellBlocks().forSubGroups< CellBlockABC >( [&]( CellBlockABC const & cellBlock )
+    {
+      array2d< localIndex, cells::NODE_MAP_PERMUTATION > const elemToNodes = cellBlock.getElemToNodes();
+      for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+      {
+        for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+        {
+          ASSERT_LE( elemToNodes( k, a ), numVisitedNodes );
+          numVisitedNodes = std::max( numVisitedNodes, elemToNodes( k, a ) + 1 );
+        }
+      }
+    } );
+    ASSERT_EQ( numVisitedNodes, cellBlockManager.numNodes() );
+  };
+
+  TestMeshImport( testMeshDir + "/cube.vtu", validate, "", "renumberNodes=\"1\"" );
+}
+
 TEST( VTKImport, supportedElements )
 {
   SKIP_TEST_IN_PARALLEL( "Neither relevant nor implemented in parallel" );
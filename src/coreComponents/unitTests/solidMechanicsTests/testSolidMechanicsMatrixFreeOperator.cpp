@@ -0,0 +1,201 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsMatrixFreeOperator.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// Two solvers on the same region: one assembling the full Jacobian, one applying it matrix-free
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SolidMechanics_LagrangianFEM name="assembled"
+                                    timeIntegrationOption="QuasiStatic"
+                                    discretization="FE1"
+                                    targetRegions="{ region }">
+        <LinearSolverParameters solverType="gmres"
+                                preconditionerType="jacobi"
+                                krylovTol="1.0e-10" />
+      </SolidMechanics_LagrangianFEM>
+      <SolidMechanics_LagrangianFEM name="matrixFree"
+                                    timeIntegrationOption="QuasiStatic"
+                                    discretization="FE1"
+                                    useMatrixFreeOperator="1"
+                                    targetRegions="{ region }">
+        <LinearSolverParameters solverType="cg"
+                                preconditionerType="jacobi"
+                                krylovTol="1.0e-10" />
+      </SolidMechanics_LagrangianFEM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 2 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 1.5 }"
+                    nx="{ 2 }"
+                    ny="{ 2 }"
+                    nz="{ 2 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Events maxTime="1.0">
+      <PeriodicEvent name="solverApplications"
+                     forceDt="1.0"
+                     target="/Solvers/assembled" />
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace name="FE1"
+                            order="1" />
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ rock }" />
+    </ElementRegions>
+    <Constitutive>
+      <ElasticIsotropic name="rock"
+                        defaultDensity="2700"
+                        defaultBulkModulus="5.0e9"
+                        defaultShearModulus="3.0e9" />
+    </Constitutive>
+  </Problem>
+  )xml";
+
+class SolidMechanicsMatrixFreeOperatorTest : public ::testing::Test
+{
+public:
+
+  SolidMechanicsMatrixFreeOperatorTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    PhysicsSolverManager & solverManager = state.getProblemManager().getPhysicsSolverManager();
+    assembled = &solverManager.getGroup< SolidMechanicsLagrangianFEM >( "assembled" );
+    matrixFree = &solverManager.getGroup< SolidMechanicsLagrangianFEM >( "matrixFree" );
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    for( SolidMechanicsLagrangianFEM * const solver : { assembled, matrixFree } )
+    {
+      solver->setupSystem( domain,
+                           solver->getDofManager(),
+                           solver->getLocalMatrix(),
+                           solver->getSystemRhs(),
+                           solver->getSystemSolution() );
+
+      solver->implicitStepSetup( time, dt, domain );
+
+      arrayView1d< real64 > const localRhs = solver->getSystemRhs().open();
+      solver->assembleSystem( time,
+                              dt,
+                              domain,
+                              solver->getDofManager(),
+                              solver->getLocalMatrix().toViewConstSizes(),
+                              localRhs );
+      solver->getSystemRhs().close();
+
+      solver->getSystemMatrix().create( solver->getLocalMatrix().toViewConst(),
+                                        solver->getDofManager().numLocalDofs(),
+                                        MPI_COMM_GEOSX );
+    }
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1.0;
+
+  GeosxState state;
+  SolidMechanicsLagrangianFEM * assembled;
+  SolidMechanicsLagrangianFEM * matrixFree;
+};
+
+real64 constexpr SolidMechanicsMatrixFreeOperatorTest::time;
+real64 constexpr SolidMechanicsMatrixFreeOperatorTest::dt;
+
+TEST_F( SolidMechanicsMatrixFreeOperatorTest, diagonalMatchesAssembledMatrix )
+{
+  DofManager const & dofManager = assembled->getDofManager();
+  localIndex const numLocalDofs = dofManager.numLocalDofs();
+
+  // the matrix-free solver only allocates the diagonal
+  EXPECT_EQ( matrixFree->getSystemMatrix().numGlobalNonzeros(), matrixFree->getDofManager().numGlobalDofs() );
+
+  ParallelVector diagAssembled;
+  ParallelVector diagMatrixFree;
+  diagAssembled.create( numLocalDofs, MPI_COMM_GEOSX );
+  diagMatrixFree.create( numLocalDofs, MPI_COMM_GEOSX );
+
+  assembled->getSystemMatrix().extractDiagonal( diagAssembled );
+  matrixFree->getSystemMatrix().extractDiagonal( diagMatrixFree );
+
+  real64 const scale = diagAssembled.normInf();
+  diagMatrixFree.axpy( -1.0, diagAssembled );
+  EXPECT_LE( diagMatrixFree.normInf(), 1.0e-12 * scale );
+}
+
+TEST_F( SolidMechanicsMatrixFreeOperatorTest, applyMatchesAssembledMatrix )
+{
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  DofManager const & dofManager = matrixFree->getDofManager();
+  localIndex const numLocalDofs = dofManager.numLocalDofs();
+
+  ParallelVector src;
+  ParallelVector dstAssembled;
+  ParallelVector dstMatrixFree;
+  src.create( numLocalDofs, MPI_COMM_GEOSX );
+  dstAssembled.create( numLocalDofs, MPI_COMM_GEOSX );
+  dstMatrixFree.create( numLocalDofs, MPI_COMM_GEOSX );
+  src.rand( 1984 );
+
+  assembled->getSystemMatrix().apply( src, dstAssembled );
+
+  // no Dirichlet rows, so that the whole operator is applied element by element
+  array1d< integer > dirichletRows( numLocalDofs );
+  SolidMechanicsMatrixFreeOperator const matrixFreeOperator( *matrixFree,
+                                                             domain,
+                                                             dofManager,
+                                                             matrixFree->getSystemMatrix(),
+                                                             dirichletRows.toViewConst() );
+  matrixFreeOperator.apply( src, dstMatrixFree );
+
+  real64 const scale = dstAssembled.normInf();
+  dstMatrixFree.axpy( -1.0, dstAssembled );
+  EXPECT_LE( dstMatrixFree.normInf(), 1.0e-12 * scale );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
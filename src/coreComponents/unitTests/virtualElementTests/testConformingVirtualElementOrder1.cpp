@@ -256,6 +256,50 @@ static void testCellsInMeshLevel( MeshLevel const & mesh )
   } );
 }
 
+template< localIndex MAXCELLNODES, localIndex MAXFACENODES >
+static void testStoredProjectors( MeshLevel const & mesh )
+{
+  CellElementSubRegion const & cellSubRegion =
+    mesh.getElemManager().getRegion< CellElementRegion >( 0 ).getSubRegion< CellElementSubRegion >( 0 );
+
+  using VEM = ConformingVirtualElementOrder1< MAXCELLNODES, MAXFACENODES >;
+  typename VEM::template MeshData< CellElementSubRegion > meshData;
+  FiniteElementBase::initialize< VEM >( mesh.getNodeManager(), mesh.getEdgeManager(),
+                                        mesh.getFaceManager(), cellSubRegion,
+                                        meshData );
+
+  // Store the projectors, and check that reading them gives the computed ones.
+  VEM virtualElement;
+  array2d< real64 > basisFunctionsIntegralMean;
+  array2d< real64 > stabilizationMatrix;
+  array3d< real64 > basisDerivativesIntegralMean;
+  virtualElement.storeProjectors( meshData, basisFunctionsIntegralMean, stabilizationMatrix, basisDerivativesIntegralMean );
+
+  for( localIndex cellIndex = 0; cellIndex < cellSubRegion.size(); ++cellIndex )
+  {
+    typename VEM::StackVariables computedStack;
+    typename VEM::StackVariables storedStack;
+    VEM::setupStack( cellIndex, meshData, computedStack );
+    virtualElement.template setup< VEM >( cellIndex, meshData, storedStack );
+
+    ASSERT_EQ( computedStack.numSupportPoints, storedStack.numSupportPoints );
+    EXPECT_EQ( computedStack.quadratureWeight, storedStack.quadratureWeight );
+    for( localIndex i = 0; i < computedStack.numSupportPoints; ++i )
+    {
+      EXPECT_EQ( computedStack.basisFunctionsIntegralMean[i], storedStack.basisFunctionsIntegralMean[i] );
+      for( localIndex d = 0; d < 3; ++d )
+      {
+        EXPECT_EQ( computedStack.basisDerivativesIntegralMean[i][d], storedStack.basisDerivativesIntegralMean[i][d] );
+      }
+      for( localIndex j = 0; j < computedStack.numSupportPoints; ++j )
+      {
+        // the stored matrix is symmetrized from its upper triangle
+        EXPECT_EQ( computedStack.stabilizationMatrix[std::min( i, j )][std::max( i, j )], storedStack.stabilizationMatrix[i][j] );
+      }
+    }
+  }
+}
+
 TEST( ConformingVirtualElementOrder1, hexahedra )
 {
   string const inputStream=
@@ -308,6 +352,7 @@ TEST( ConformingVirtualElementOrder1, hexahedra )
 
   // Test computed projectors for all cells in MeshLevel
   testCellsInMeshLevel< 10, 6 >( mesh );
+  testStoredProjectors< 10, 6 >( mesh );
 }
 
 TEST( ConformingVirtualElementOrder1, wedges )
@@ -361,6 +406,7 @@ TEST( ConformingVirtualElementOrder1, wedges )
 
   // Test computed projectors for all cells in MeshLevel
   testCellsInMeshLevel< 8, 9 >( mesh );
+  testStoredProjectors< 8, 9 >( mesh );
 }
 
 int main( int argc, char * * argv )
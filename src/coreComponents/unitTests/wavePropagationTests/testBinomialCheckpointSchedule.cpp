@@ -0,0 +1,99 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2020-     GEOSX Contributors
+ * All right reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "physicsSolvers/wavePropagation/BinomialCheckpointSchedule.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+// Reverses a time stepping whose state is the step index, following the schedule used by
+// AcousticWaveEquationSEM, and returns the total number of forward steps taken.
+long long reverseTimeStepping( integer const numSteps, integer const maxCheckpoints )
+{
+  BinomialCheckpointSchedule schedule( numSteps, maxCheckpoints );
+  std::vector< integer > slots( maxCheckpoints, -1 );
+  long long numForwardSteps = 0;
+
+  for( integer step = 0; step < numSteps; ++step )
+  {
+    integer const slot = schedule.forwardStep( step );
+    if( slot >= 0 )
+    {
+      slots[slot] = step;
+    }
+    EXPECT_LE( schedule.numCheckpoints(), maxCheckpoints );
+    ++numForwardSteps;
+  }
+
+  for( integer step = numSteps - 1; step >= 0; --step )
+  {
+    schedule.releaseAfter( step );
+    integer currentStep = slots[schedule.lastCheckpointSlot()];
+    EXPECT_EQ( currentStep, schedule.lastCheckpointStep() );
+    EXPECT_LE( currentStep, step );
+
+    while( currentStep < step )
+    {
+      integer const nextCheckpoint = std::min( schedule.nextCheckpoint( currentStep, step + 1 ), step );
+      EXPECT_GT( nextCheckpoint, currentStep );
+      numForwardSteps += nextCheckpoint - currentStep;
+      currentStep = nextCheckpoint;
+      if( currentStep < step )
+      {
+        slots[schedule.push( currentStep )] = currentStep;
+      }
+      EXPECT_LE( schedule.numCheckpoints(), maxCheckpoints );
+    }
+    EXPECT_EQ( currentStep, step );
+    ++numForwardSteps;
+  }
+  return numForwardSteps;
+}
+
+TEST( BinomialCheckpointSchedule, singleCheckpoint )
+{
+  // every step is recomputed from the initial state
+  integer const numSteps = 20;
+  EXPECT_EQ( reverseTimeStepping( numSteps, 1 ), numSteps + numSteps * ( numSteps + 1 ) / 2 );
+}
+
+TEST( BinomialCheckpointSchedule, enoughCheckpoints )
+{
+  // every state is stored, each step is only recomputed once from its own checkpoint
+  integer const numSteps = 20;
+  EXPECT_EQ( reverseTimeStepping( numSteps, numSteps ), 2 * numSteps );
+}
+
+TEST( BinomialCheckpointSchedule, logarithmicMemory )
+{
+  // with 10 checkpoints, C(10+6,10) >= 5000 steps are reversed with at most 6 repetitions per step
+  integer const numSteps = 5000;
+  long long const numForwardSteps = reverseTimeStepping( numSteps, 10 );
+  EXPECT_LE( numForwardSteps, 8LL * numSteps );
+
+  for( integer numSteps2 : { 1, 2, 7, 100, 999 } )
+  {
+    for( integer maxCheckpoints : { 1, 2, 3, 5 } )
+    {
+      reverseTimeStepping( numSteps2, maxCheckpoints );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
@@ -128,6 +128,12 @@
 /// The default block size for GEOSX on this platform
 #define GEOSX_BLOCK_SIZE 32
 
+/// Bit mask of the numbers of fluid components supported by the compositional flow kernels (bit n for n components)
+#define GEOS_COMPOSITIONAL_NUM_COMPONENTS_MASK 62
+
+/// Largest number of fluid components supported by the compositional flow kernels
+#define GEOS_COMPOSITIONAL_MAX_NUM_COMPONENTS 5
+
 /// Version information for HDF5
 #define HDF5_VERSION 1.12.1
 
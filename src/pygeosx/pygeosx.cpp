@@ -25,6 +25,7 @@
 #include "fileIO/python/PyHistoryCollectionType.hpp"
 #include "fileIO/python/PyHistoryOutputType.hpp"
 #include "fileIO/python/PyVTKOutputType.hpp"
+#include "fileIO/Outputs/PythonOutput.hpp"
 #include "mainInterface/initialization.hpp"
 #include "LvArray/src/python/PyArray.hpp"
 
@@ -225,13 +226,112 @@ PyObject * run( PyObject * self, PyObject * args ) noexcept
   }
   catch( std::exception const & e )
   {
-    PyErr_SetString( PyExc_RuntimeError, e.what() );
+    // Keep the exception raised by a callback, if any.
+    if( PyErr_Occurred() == nullptr )
+    {
+      PyErr_SetString( PyExc_RuntimeError, e.what() );
+    }
     return nullptr;
   }
 
   return PyLong_FromLong( static_cast< int >( g_state->getState() ) );
 }
 
+static constexpr char const * resetDocString =
+  "reset()\n"
+  "--\n\n"
+  "Rewind the simulation to its start, keeping the mesh and the data of the domain.\n"
+  "\n"
+  "Used to run another realization of an ensemble without setting up the mesh again:\n"
+  "the fields can be modified before calling ``apply_initial_conditions`` and ``run``.\n"
+  "\n"
+  "Returns\n"
+  "_______\n"
+  "None\n";
+PyObject * reset( PyObject * self, PyObject * args ) noexcept
+{
+  GEOS_UNUSED_VAR( self, args );
+
+  PYTHON_ERROR_IF( g_state == nullptr, PyExc_RuntimeError, "state must be initialized", nullptr );
+
+  try
+  {
+    g_state->resetSimulation();
+  }
+  catch( std::exception const & e )
+  {
+    PyErr_SetString( PyExc_RuntimeError, e.what() );
+    return nullptr;
+  }
+
+  Py_RETURN_NONE;
+}
+
+static constexpr char const * setCallbackDocString =
+  "set_callback(name, callback)\n"
+  "--\n\n"
+  "Set a callback called by a Python output event, in place of returning from ``run``.\n"
+  "\n"
+  "The event loop then runs all the steps natively, and only calls into Python at the\n"
+  "frequency of the event. If the callback raises an exception, ``run`` stops and raises it.\n"
+  "\n"
+  "Parameters\n"
+  "__________\n"
+  "name : str\n"
+  "    The name of the Python output.\n"
+  "callback : callable or None\n"
+  "    Called with the time, the time step and the cycle number. If ``None``, the\n"
+  "    event returns from ``run`` again.\n"
+  "\n"
+  "Returns\n"
+  "_______\n"
+  "None\n";
+PyObject * setCallback( PyObject * self, PyObject * args ) noexcept
+{
+  GEOS_UNUSED_VAR( self );
+
+  PYTHON_ERROR_IF( g_state == nullptr, PyExc_RuntimeError, "state must be initialized", nullptr );
+
+  char const * name;
+  PyObject * callback;
+  if( !PyArg_ParseTuple( args, "sO", &name, &callback ) )
+  {
+    return nullptr;
+  }
+
+  PYTHON_ERROR_IF( callback != Py_None && !PyCallable_Check( callback ), PyExc_TypeError,
+                   "callback must be callable or None", nullptr );
+
+  dataRepository::Group & outputManager =
+    g_state->getProblemManager().getGroup( g_state->getProblemManager().groupKeys.outputManager );
+  PythonOutput * const output = outputManager.getGroupPointer< PythonOutput >( name );
+  if( output == nullptr )
+  {
+    PyErr_Format( PyExc_KeyError, "No Python output named %s", name );
+    return nullptr;
+  }
+
+  if( callback == Py_None )
+  {
+    output->setCallback( {} );
+    Py_RETURN_NONE;
+  }
+
+  Py_INCREF( callback );
+  std::shared_ptr< PyObject > const function( callback, []( PyObject * const obj ){ Py_DECREF( obj ); } );
+  output->setCallback( [function]( real64 const time_n, real64 const dt, integer const cycleNumber )
+  {
+    LvArray::python::PyObjectRef<> ret{ PyObject_CallFunction( function.get(), "ddi", time_n, dt, cycleNumber ) };
+    if( ret == nullptr )
+    {
+      // The Python exception stays set, and is raised once the event loop has been left.
+      throw std::runtime_error( "Python callback failed" );
+    }
+  } );
+
+  Py_RETURN_NONE;
+}
+
 static constexpr char const * getStateDocString =
   "getState()\n"
   "--\n\n"
@@ -348,6 +448,8 @@ static PyMethodDef pygeosxFuncs[] = {
   { "reinit", geos::reinit, METH_VARARGS, geos::reinitDocString },
   { "apply_initial_conditions", geos::applyInitialConditions, METH_NOARGS, geos::applyInitialConditionsDocString },
   { "run", geos::run, METH_NOARGS, geos::runDocString },
+  { "set_callback", geos::setCallback, METH_VARARGS, geos::setCallbackDocString },
+  { "reset", geos::reset, METH_NOARGS, geos::resetDocString },
   { "getState", geos::getState, METH_NOARGS, geos::getStateDocString },
   { "_finalize", geos::finalize, METH_NOARGS, geos::finalizeDocString },
   { nullptr, nullptr, 0, nullptr }        /* Sentinel */